@@ -1,9 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
+#include <libcore/devices/memory_access_protocol.hpp>
 #include <libcore/module.hpp>
+#include <libcore/utility/math/byte.hpp>
 #include <libcore/utility/math/units.hpp>
 
 namespace sjsu
@@ -28,6 +35,14 @@ struct AccelerometerSettings_t
   /// orientation measurements will require 2Gs of precision to account for
   /// accelerations caused by translation rather than simply rotation.
   units::acceleration::standard_gravity_t gravity = 2_SG;
+
+  /// Number of samples the device should collect in its FIFO before raising
+  /// its watermark interrupt. Attach a Gpio interrupt to the device's
+  /// interrupt pin and drain the FIFO with Read(std::span<Acceleration_t>)
+  /// when it fires, rather than polling Read() for every sample. 0 leaves the
+  /// FIFO and its interrupt disabled. Drivers clamp this to the depth of the
+  /// device's FIFO and ignore it if the device does not have one.
+  uint32_t fifo_watermark = 0;
 };
 
 /// @ingroup movement
@@ -56,5 +71,71 @@ class Accelerometer : public Module<AccelerometerSettings_t>
   /// @return An Acceleration object which contains the acceleration in the
   ///         X, Y, and Z axis.
   virtual Acceleration_t Read() = 0;
+
+  /// Read a batch of samples. Drivers for devices with a FIFO override this to
+  /// drain the FIFO in a single burst, see ReadFifo(), so the bus overhead is
+  /// paid once per batch rather than once per sample. The default
+  /// implementation calls Read() for each sample.
+  ///
+  /// Drivers that override Read() should add `using Accelerometer::Read;` so
+  /// this overload is not hidden.
+  ///
+  /// @param samples - buffer to fill, oldest sample first.
+  /// @return size_t - number of samples read, which can be fewer than the
+  ///         size of the buffer if the device's FIFO held fewer samples.
+  virtual size_t Read(std::span<Acceleration_t> samples)
+  {
+    for (auto & sample : samples)
+    {
+      sample = Read();
+    }
+    return samples.size();
+  }
+
+ protected:
+  /// Number of samples read from a FIFO per bus transaction by ReadFifo().
+  static constexpr size_t kFifoBurstSamples = 32;
+
+  /// Read samples from a FIFO data register of a device that holds each
+  /// sample as three 16-bit axes, X then Y then Z, in the endianness of the
+  /// register's address. The samples are read in bursts of up to
+  /// kFifoBurstSamples samples, so the device must return the next sample in
+  /// the FIFO when a read runs past the last axis of the current one.
+  ///
+  /// @param device - protocol used to communicate with the device.
+  /// @param fifo - the FIFO data register.
+  /// @param samples - buffer to fill with samples, oldest first.
+  /// @param resolution - acceleration represented by 1 count of a 16-bit
+  ///        axis, which depends on the full scale the device is set to.
+  template <MemoryAccessProtocol::AddressWidth address_width,
+            std::endian endianness>
+  static void ReadFifo(
+      MemoryAccessProtocol & device,
+      const MemoryAccessProtocol::Address<address_width, endianness> & fifo,
+      std::span<Acceleration_t> samples,
+      units::acceleration::meters_per_second_squared_t resolution)
+  {
+    constexpr size_t kSampleSize = 3 * sizeof(int16_t);
+    std::array<uint8_t, kFifoBurstSamples * kSampleSize> burst;
+
+    while (!samples.empty())
+    {
+      const size_t kCount = std::min(samples.size(), kFifoBurstSamples);
+      device.Read(fifo.address,
+                  std::span<uint8_t>(burst.data(), kCount * kSampleSize));
+
+      for (size_t i = 0; i < kCount; i++)
+      {
+        auto axis = [&burst, i, resolution](size_t index) {
+          const auto kBytes = std::span<const uint8_t>(burst).subspan(
+              (i * kSampleSize) + (index * sizeof(int16_t)), sizeof(int16_t));
+          return resolution * ToInteger<int16_t>(endianness, kBytes);
+        };
+        samples[i] = { .x = axis(0), .y = axis(1), .z = axis(2) };
+      }
+
+      samples = samples.subspan(kCount);
+    }
+  }
 };
 }  // namespace sjsu
@@ -0,0 +1,165 @@
+#include <libcore/devices/accelerometer.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+constexpr MemoryAccessProtocol::Specification_t<
+    MemoryAccessProtocol::AddressWidth::kByte1,
+    std::endian::little>
+    kSpecification{};
+
+constexpr auto kFifoData =
+    MemoryAccessProtocol::Address(kSpecification,
+                                  { .address = 0x28, .width = 6 });
+
+constexpr units::acceleration::meters_per_second_squared_t kResolution(0.5);
+
+/// Device whose FIFO data register returns the next queued byte on each read.
+class FifoProtocol : public MemoryAccessProtocol
+{
+ public:
+  void Write(std::span<const uint8_t>, std::span<const uint8_t>) override {}
+  void Read(std::span<const uint8_t> address,
+            std::span<uint8_t> payload) override
+  {
+    reads++;
+    CHECK(0x28 == address[0]);
+    REQUIRE(payload.size() <= fifo.size());
+    std::copy_n(fifo.begin(), payload.size(), payload.begin());
+    fifo.erase(fifo.begin(), fifo.begin() + payload.size());
+  }
+
+  /// Queue a sample of little endian X, Y and Z axes.
+  void Push(int16_t x, int16_t y, int16_t z)
+  {
+    for (int16_t axis : { x, y, z })
+    {
+      fifo.push_back(static_cast<uint8_t>(axis));
+      fifo.push_back(static_cast<uint8_t>(axis >> 8));
+    }
+  }
+
+  size_t reads = 0;
+  std::vector<uint8_t> fifo;
+};
+
+/// Driver of a device with a FIFO that drains it in bursts.
+class FifoAccelerometer : public Accelerometer
+{
+ public:
+  explicit FifoAccelerometer(FifoProtocol & device) : device_(device) {}
+
+  void ModuleInitialize() override {}
+
+  Acceleration_t Read() override
+  {
+    Acceleration_t sample;
+    Read(std::span<Acceleration_t>(&sample, 1));
+    return sample;
+  }
+
+  size_t Read(std::span<Acceleration_t> samples) override
+  {
+    const size_t kQueued = device_.fifo.size() / 6;
+    samples              = samples.first(std::min(samples.size(), kQueued));
+    ReadFifo(device_, kFifoData, samples, kResolution);
+    return samples.size();
+  }
+
+ private:
+  FifoProtocol & device_;
+};
+
+/// Driver of a device without a FIFO, counting the samples it reads.
+class SingleAccelerometer : public Accelerometer
+{
+ public:
+  using Accelerometer::Read;
+
+  void ModuleInitialize() override {}
+
+  Acceleration_t Read() override
+  {
+    reads++;
+    return { .x = kResolution * reads, .y = {}, .z = {} };
+  }
+
+  int reads = 0;
+};
+}  // namespace
+
+TEST_CASE("Testing Accelerometer")
+{
+  SECTION("Batch reads default to a read per sample")
+  {
+    // Setup
+    SingleAccelerometer accelerometer;
+    std::array<Accelerometer::Acceleration_t, 3> samples;
+
+    // Exercise
+    const size_t kCount = accelerometer.Read(samples);
+
+    // Verify
+    CHECK(3 == kCount);
+    CHECK(3 == accelerometer.reads);
+    CHECK(0.5f == samples[0].x.to<float>());
+    CHECK(1.5f == samples[2].x.to<float>());
+  }
+
+  SECTION("A batch is drained from the FIFO in one burst")
+  {
+    // Setup
+    FifoProtocol device;
+    FifoAccelerometer accelerometer(device);
+    Accelerometer & interface = accelerometer;
+    device.Push(2, -4, 20);
+    device.Push(-32768, 32767, 0);
+    device.Push(6, 8, 10);
+    std::array<Accelerometer::Acceleration_t, 3> samples;
+
+    // Exercise
+    const size_t kCount = interface.Read(samples);
+
+    // Verify
+    CHECK(3 == kCount);
+    CHECK(1 == device.reads);
+    CHECK(device.fifo.empty());
+    CHECK(1.0f == samples[0].x.to<float>());
+    CHECK(-2.0f == samples[0].y.to<float>());
+    CHECK(10.0f == samples[0].z.to<float>());
+    CHECK(-16384.0f == samples[1].x.to<float>());
+    CHECK(16383.5f == samples[1].y.to<float>());
+    CHECK(5.0f == samples[2].z.to<float>());
+  }
+
+  SECTION("Large batches are read a burst at a time")
+  {
+    // Setup
+    FifoProtocol device;
+    FifoAccelerometer accelerometer(device);
+    for (int16_t i = 0; i < 70; i++)
+    {
+      device.Push(i, 0, 0);
+    }
+    std::array<Accelerometer::Acceleration_t, 80> samples;
+
+    // Exercise
+    const size_t kCount = accelerometer.Read(samples);
+
+    // Verify
+    CHECK(70 == kCount);
+    CHECK(3 == device.reads);
+    CHECK(0.0f == samples[0].x.to<float>());
+    CHECK(16.0f == samples[32].x.to<float>());
+    CHECK(34.5f == samples[69].x.to<float>());
+  }
+}
+}  // namespace sjsu
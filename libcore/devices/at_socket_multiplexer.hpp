@@ -0,0 +1,445 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string_view>
+
+#include <libcore/devices/internet_socket.hpp>
+#include <libcore/module.hpp>
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/ring_buffer.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Shares the multiple connections of an AT command modem, such as the
+/// ESP8266 with `AT+CIPMUX=1`, between several InternetSockets, so that, for
+/// example, MQTT and HTTP traffic can use the modem at the same time.
+///
+/// Every byte the modem sends is parsed by one receiver, which moves the
+/// payload of each `+IPD,<link>,<length>:` frame into the receive buffer of
+/// its link and records command responses and `<link>,CLOSED` notifications.
+/// Since data for any link is demultiplexed while another link waits for a
+/// command response, a socket never loses data sent to another.
+///
+/// The receiver runs whenever a socket waits. Poll() runs it once, and can be
+/// called from the application's main loop so that data is buffered, and
+/// readiness handlers called, while no socket is being used.
+///
+/// The modem must be connected to an access point before connecting sockets.
+///
+/// USAGE:
+///
+///    sjsu::AtSocketMultiplexer<2> modem(uart);
+///    modem.Initialize();
+///
+///    sjsu::InternetSocket & mqtt = modem.GetSocket(0);
+///    sjsu::InternetSocket & http = modem.GetSocket(1);
+///    mqtt.Connect(sjsu::InternetSocket::Protocol::kTCP, "broker", 1883, 5s);
+///    http.Connect(sjsu::InternetSocket::Protocol::kTCP, "server", 80, 5s);
+///
+/// @tparam kLinks - number of sockets, from 1 to 5, the link IDs of the
+///         ESP8266.
+/// @tparam kBufferSize - bytes of received data each socket can buffer. Must
+///         be a power of 2.
+template <size_t kLinks = 5, size_t kBufferSize = 256>
+class AtSocketMultiplexer : public Module<>
+{
+ public:
+  static_assert(kLinks >= 1 && kLinks <= 5,
+                "AT modems support between 1 and 5 links.");
+
+  /// Time to wait for the response of commands without a timeout.
+  static constexpr std::chrono::nanoseconds kCommandTimeout =
+      std::chrono::seconds(2);
+
+  /// Largest amount of data the modem accepts in a single send command.
+  static constexpr size_t kMaxSendSize = 2048;
+
+  /// One connection of the modem.
+  class Link : public InternetSocket
+  {
+   public:
+    /// The sockets are used through the multiplexer, which must be
+    /// initialized first.
+    void ModuleInitialize() override {}
+
+    bool Connect(Protocol protocol,
+                 std::string_view address,
+                 uint16_t port,
+                 std::chrono::nanoseconds timeout) override
+    {
+      std::array<char, 128> command;
+      const int kLength =
+          snprintf(command.data(), command.size(),  // NOLINT
+                   "AT+CIPSTART=%zu,\"%s\",\"%.*s\",%u\r\n", id_,
+                   (protocol == Protocol::kTCP) ? "TCP" : "UDP",
+                   static_cast<int>(address.size()), address.data(), port);
+      if (kLength < 0 || static_cast<size_t>(kLength) >= command.size())
+      {
+        return false;
+      }
+
+      received_.Clear();
+      connected_ = mux_->Command(
+          std::string_view(command.data(), kLength), Response::kOk, timeout);
+      return connected_;
+    }
+
+    /// @throw sjsu::Exception - std::errc::not_connected if the link is not
+    ///        connected, or std::errc::timed_out if the modem did not accept
+    ///        the data before the timeout.
+    void Write(std::span<const uint8_t> data,
+               std::chrono::nanoseconds timeout) override
+    {
+      if (!connected_)
+      {
+        throw Exception(std::errc::not_connected,
+                        "Cannot write to a link that is not connected.");
+      }
+
+      while (!data.empty())
+      {
+        const size_t kSize = std::min(data.size(), kMaxSendSize);
+        std::array<char, 32> command;
+        const int kLength = snprintf(command.data(), command.size(),  // NOLINT
+                                     "AT+CIPSEND=%zu,%zu\r\n", id_, kSize);
+
+        if (!mux_->Command(std::string_view(command.data(), kLength),
+                           Response::kPrompt, timeout) ||
+            !mux_->Command(data.first(kSize), Response::kSendOk, timeout))
+        {
+          throw Exception(std::errc::timed_out,
+                          "Modem did not accept the data to send.");
+        }
+
+        data = data.subspan(kSize);
+      }
+    }
+
+    using InternetSocket::Write;
+
+    size_t Read(std::span<uint8_t> buffer,
+                std::chrono::nanoseconds timeout) override
+    {
+      Wait(timeout, [this]() -> bool {
+        mux_->Poll();
+        return !received_.IsEmpty() || !connected_;
+      });
+      return received_.Read(buffer);
+    }
+
+    void Close() override
+    {
+      if (connected_)
+      {
+        std::array<char, 24> command;
+        const int kLength = snprintf(command.data(), command.size(),  // NOLINT
+                                     "AT+CIPCLOSE=%zu\r\n", id_);
+        mux_->Command(std::string_view(command.data(), kLength),
+                      Response::kOk, kCommandTimeout);
+        connected_ = false;
+      }
+      received_.Clear();
+    }
+
+    bool IsConnected() override
+    {
+      mux_->Poll();
+      return connected_;
+    }
+
+    size_t Receive(std::span<uint8_t> buffer) override
+    {
+      mux_->Poll();
+      return received_.Read(buffer);
+    }
+
+    bool SetReadinessHandler(ReadinessHandler handler) override
+    {
+      handler_ = handler;
+      return true;
+    }
+
+    std::span<const uint8_t> PeekReceived() override
+    {
+      mux_->Poll();
+      return received_.Peek();
+    }
+
+    void ConsumeReceived(size_t count) override
+    {
+      received_.Consume(count);
+    }
+
+    /// @return uint32_t - number of received bytes dropped because the
+    ///         receive buffer was full.
+    uint32_t GetDroppedBytes() const
+    {
+      return dropped_bytes_;
+    }
+
+   private:
+    friend class AtSocketMultiplexer;
+
+    void Store(uint8_t byte)
+    {
+      if (!received_.Push(byte))
+      {
+        dropped_bytes_++;
+      }
+    }
+
+    void Notify(Readiness readiness)
+    {
+      if (handler_)
+      {
+        handler_(readiness);
+      }
+    }
+
+    AtSocketMultiplexer * mux_ = nullptr;
+    size_t id_                 = 0;
+    bool connected_            = false;
+    uint32_t dropped_bytes_    = 0;
+    ReadinessHandler handler_;
+    RingBuffer<uint8_t, kBufferSize> received_;
+  };
+
+  /// @param uart - the UART connected to the modem.
+  explicit AtSocketMultiplexer(Uart & uart) : uart_(uart)
+  {
+    for (size_t i = 0; i < kLinks; i++)
+    {
+      links_[i].mux_ = this;
+      links_[i].id_  = i;
+    }
+  }
+
+  /// Turns off command echo and enables multiple connections.
+  ///
+  /// @throw sjsu::Exception - std::errc::io_error if the modem did not
+  ///        accept the commands.
+  void ModuleInitialize() override
+  {
+    uart_.Initialize();
+    uart_.Flush();
+    length_    = 0;
+    remaining_ = 0;
+
+    if (!Command("ATE0\r\n", Response::kOk, kCommandTimeout) ||
+        !Command("AT+CIPMUX=1\r\n", Response::kOk, kCommandTimeout))
+    {
+      throw Exception(std::errc::io_error,
+                      "Modem did not enable multiple connections.");
+    }
+
+    for (Link & link : links_)
+    {
+      link.connected_ = false;
+      link.received_.Clear();
+    }
+  }
+
+  /// @param link - ID of the modem's connection, from 0 to kLinks - 1.
+  /// @return InternetSocket & - the socket that uses the connection.
+  Link & GetSocket(size_t link)
+  {
+    return links_[link];
+  }
+
+  /// Parse every byte received from the modem, buffering received data in the
+  /// socket of its link.
+  void Poll()
+  {
+    // Parse the received bytes in place when the UART driver supports it.
+    auto bytes = uart_.PeekReceived();
+    while (!bytes.empty())
+    {
+      for (uint8_t byte : bytes)
+      {
+        Parse(byte);
+      }
+      uart_.ConsumeReceived(bytes.size());
+      bytes = uart_.PeekReceived();
+    }
+
+    std::array<uint8_t, 32> buffer;
+    while (uart_.HasData())
+    {
+      const size_t kLength = uart_.Read(buffer);
+      for (size_t i = 0; i < kLength; i++)
+      {
+        Parse(buffer[i]);
+      }
+    }
+  }
+
+ private:
+  enum class Response : uint8_t
+  {
+    kNone,
+    kOk,
+    kError,
+    kPrompt,
+    kSendOk,
+  };
+
+  /// Send a command, or data, then receive until the modem responds with
+  /// `expected` or an error. Other responses, such as the OK that comes before
+  /// the send prompt, are skipped.
+  ///
+  /// @return true - if the modem responded with `expected` before the
+  ///         timeout.
+  bool Command(std::span<const uint8_t> command,
+               Response expected,
+               std::chrono::nanoseconds timeout)
+  {
+    response_ = Response::kNone;
+    uart_.Write(command);
+    Wait(timeout, [this, expected]() -> bool {
+      Poll();
+      return response_ == expected || response_ == Response::kError;
+    });
+    return response_ == expected;
+  }
+
+  bool Command(std::string_view command,
+               Response expected,
+               std::chrono::nanoseconds timeout)
+  {
+    return Command(
+        std::span(reinterpret_cast<const uint8_t *>(command.data()),
+                  command.size()),
+        expected, timeout);
+  }
+
+  void Parse(uint8_t byte)
+  {
+    // Payload of a +IPD frame, which can contain any byte.
+    if (remaining_ > 0)
+    {
+      links_[target_].Store(byte);
+      if (--remaining_ == 0)
+      {
+        links_[target_].Notify(InternetSocket::Readiness::kReadable);
+      }
+      return;
+    }
+
+    if (length_ == 0)
+    {
+      // The send prompt is not followed by the end of a line, but by a space
+      // that is skipped along with any other space before a line.
+      if (byte == '>')
+      {
+        response_ = Response::kPrompt;
+      }
+      if (byte == '>' || byte == ' ' || byte == '\r')
+      {
+        return;
+      }
+    }
+
+    if (byte == ':' && Line().starts_with("+IPD,"))
+    {
+      StartFrame(Line().substr(5));
+      length_ = 0;
+      return;
+    }
+
+    if (byte == '\n')
+    {
+      ParseLine(Trim(Line()));
+      length_ = 0;
+      return;
+    }
+
+    if (length_ < line_.size())
+    {
+      line_[length_++] = static_cast<char>(byte);
+    }
+  }
+
+  /// @param header - `<link>,<length>` of a +IPD frame, optionally followed
+  ///        by the address of the host.
+  void StartFrame(std::string_view header)
+  {
+    size_t link       = 0;
+    size_t length     = 0;
+    const char * end  = header.data() + header.size();
+    auto [next, code] = std::from_chars(header.data(), end, link);
+    if (code != std::errc{} || next == end || *next != ',')
+    {
+      return;
+    }
+    std::from_chars(next + 1, end, length);
+
+    // Data for unknown links is parsed as lines, which are ignored.
+    if (link < kLinks)
+    {
+      target_    = link;
+      remaining_ = length;
+    }
+  }
+
+  void ParseLine(std::string_view line)
+  {
+    if (line == "OK")
+    {
+      response_ = Response::kOk;
+    }
+    else if (line == "SEND OK")
+    {
+      response_ = Response::kSendOk;
+    }
+    else if (line == "ERROR" || line == "FAIL" || line == "SEND FAIL")
+    {
+      response_ = Response::kError;
+    }
+    else if (line.size() > 2 && line[0] >= '0' &&
+             line[0] < static_cast<char>('0' + kLinks) && line[1] == ',')
+    {
+      Link & link = links_[line[0] - '0'];
+      if (line.substr(2) == "CONNECT")
+      {
+        link.connected_ = true;
+      }
+      else if (line.substr(2) == "CLOSED" || line.substr(2) == "CONNECT FAIL")
+      {
+        link.connected_ = false;
+        link.Notify(InternetSocket::Readiness::kClosed);
+      }
+    }
+  }
+
+  std::string_view Line() const
+  {
+    return std::string_view(line_.data(), length_);
+  }
+
+  static std::string_view Trim(std::string_view line)
+  {
+    while (!line.empty() && (line.back() == ' ' || line.back() == '\r'))
+    {
+      line.remove_suffix(1);
+    }
+    return line;
+  }
+
+  Uart & uart_;
+  std::array<Link, kLinks> links_;
+  std::array<char, 64> line_;
+  size_t length_     = 0;
+  size_t target_     = 0;
+  size_t remaining_  = 0;
+  Response response_ = Response::kNone;
+};
+}  // namespace sjsu
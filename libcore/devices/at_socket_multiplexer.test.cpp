@@ -0,0 +1,186 @@
+#include <libcore/devices/at_socket_multiplexer.hpp>
+
+#include <deque>
+#include <functional>
+#include <string>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// A modem that answers each write with the reply of `respond`.
+class ScriptedModem : public Uart
+{
+ public:
+  void ModuleInitialize() override {}
+  bool HasData() override
+  {
+    return !rx.empty();
+  }
+  void Write(std::span<const uint8_t> data) override
+  {
+    const std::string kWritten(data.begin(), data.end());
+    tx += kWritten;
+    Reply(respond(kWritten));
+  }
+  size_t Read(std::span<uint8_t> data) override
+  {
+    size_t count = 0;
+    while (count < data.size() && !rx.empty())
+    {
+      data[count++] = rx.front();
+      rx.pop_front();
+    }
+    return count;
+  }
+
+  using Uart::Read;
+  using Uart::Write;
+
+  void Reply(std::string_view reply)
+  {
+    rx.insert(rx.end(), reply.begin(), reply.end());
+  }
+
+  std::function<std::string(const std::string &)> respond =
+      [](const std::string & written) -> std::string {
+    if (written.starts_with("AT+CIPSTART=0"))
+    {
+      return "0,CONNECT\r\n\r\nOK\r\n";
+    }
+    if (written.starts_with("AT+CIPSTART=1"))
+    {
+      return "1,CONNECT\r\n\r\nOK\r\n";
+    }
+    if (written.starts_with("AT+CIPSEND"))
+    {
+      return "\r\nOK\r\n> ";
+    }
+    if (written.starts_with("AT"))
+    {
+      return "\r\nOK\r\n";
+    }
+    return "\r\nRecv " + std::to_string(written.size()) +
+           " bytes\r\n\r\nSEND OK\r\n";
+  };
+  std::string tx;
+  std::deque<uint8_t> rx;
+};
+
+std::string ReadAll(InternetSocket & socket)
+{
+  std::array<uint8_t, 16> buffer;
+  size_t length = socket.Read(buffer, std::chrono::milliseconds(1));
+  return std::string(buffer.begin(), buffer.begin() + length);
+}
+}  // namespace
+
+TEST_CASE("Testing AtSocketMultiplexer")
+{
+  constexpr auto kTcp     = InternetSocket::Protocol::kTCP;
+  constexpr auto kTimeout = std::chrono::milliseconds(1);
+
+  ScriptedModem modem;
+  AtSocketMultiplexer<2, 16> test_subject(modem);
+  test_subject.Initialize();
+
+  auto & socket0 = test_subject.GetSocket(0);
+  auto & socket1 = test_subject.GetSocket(1);
+
+  SECTION("Initialize enables multiple connections")
+  {
+    // Verify
+    CHECK("ATE0\r\nAT+CIPMUX=1\r\n" == modem.tx);
+  }
+
+  SECTION("Initialize throws when the modem does not respond")
+  {
+    // Setup
+    modem.respond = [](const std::string &) { return "\r\nERROR\r\n"; };
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.ModuleInitialize(), sjsu::Exception);
+  }
+
+  SECTION("Connect starts a connection on the socket's link")
+  {
+    // Setup
+    modem.tx.clear();
+
+    // Exercise
+    bool connected = socket1.Connect(kTcp, "example.com", 80, kTimeout);
+
+    // Verify
+    CHECK(connected);
+    CHECK(socket1.IsConnected());
+    CHECK(!socket0.IsConnected());
+    CHECK("AT+CIPSTART=1,\"TCP\",\"example.com\",80\r\n" == modem.tx);
+  }
+
+  SECTION("Received frames are delivered to the socket of their link")
+  {
+    // Setup
+    socket0.Connect(kTcp, "broker", 1883, kTimeout);
+    socket1.Connect(kTcp, "server", 80, kTimeout);
+    modem.Reply("\r\n+IPD,1,6:a\r\nb:c\r\n+IPD,0,5:hello");
+
+    // Exercise & Verify
+    CHECK("hello" == ReadAll(socket0));
+    CHECK("a\r\nb:c" == ReadAll(socket1));
+  }
+
+  SECTION("Data for another link is kept while a link sends")
+  {
+    // Setup
+    socket0.Connect(kTcp, "broker", 1883, kTimeout);
+    socket1.Connect(kTcp, "server", 80, kTimeout);
+    modem.respond = [previous = modem.respond](
+                        const std::string & written) -> std::string {
+      return "+IPD,1,2:hi" + previous(written);
+    };
+    modem.tx.clear();
+    const uint8_t kData[] = { 'p', 'i', 'n', 'g' };
+
+    // Exercise
+    socket0.Write(kData, kTimeout);
+
+    // Verify
+    CHECK("AT+CIPSEND=0,4\r\nping" == modem.tx);
+    CHECK("hihi" == ReadAll(socket1));
+  }
+
+  SECTION("Remote close is reported to the socket")
+  {
+    // Setup
+    InternetSocket::Readiness readiness = InternetSocket::Readiness::kWritable;
+    socket0.Connect(kTcp, "broker", 1883, kTimeout);
+    socket0.SetReadinessHandler(
+        [&readiness](InternetSocket::Readiness state) { readiness = state; });
+
+    // Exercise
+    modem.Reply("0,CLOSED\r\n");
+
+    // Verify
+    CHECK(!socket0.IsConnected());
+    CHECK(InternetSocket::Readiness::kClosed == readiness);
+    CHECK_THROWS_AS(socket0.Write(std::span<const uint8_t>(), kTimeout),
+                    sjsu::Exception);
+  }
+
+  SECTION("Data that does not fit the receive buffer is dropped")
+  {
+    // Setup
+    socket0.Connect(kTcp, "broker", 1883, kTimeout);
+
+    // Exercise
+    modem.Reply("+IPD,0,20:0123456789abcdefghij");
+    test_subject.Poll();
+
+    // Verify
+    CHECK(4 == socket0.GetDroppedBytes());
+    CHECK("0123456789abcdef" == ReadAll(socket0));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,377 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <libcore/peripherals/storage.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu
+{
+/// A Storage that caches the blocks of another Storage in RAM, so that small
+/// reads and writes, such as those of a filesystem or a log, only access the
+/// device when a block is not already cached or when the cache is synced.
+///
+/// - Blocks are kept in kBlocks statically allocated lines, and the least
+///   recently used lines are replaced.
+/// - Writes are write-back: they only change the cached block, which is
+///   written to the device by Sync(), by PowerDown(), or when its line is
+///   replaced. Call Sync() before removing the media or losing power.
+/// - Reads that miss fetch every block the read still needs in one device
+///   read, up to the size of the cache. A read that continues where the last
+///   one ended also fetches the blocks after it, up to `read_ahead` blocks,
+///   so sequential reads access the device once every few blocks.
+///
+/// Erase() is passed on to the device at once and drops the cached copies of
+/// the erased blocks, including unsynced writes to them, so erasing and then
+/// writing a block keeps its order on the device.
+///
+/// USAGE:
+///
+///    sjsu::BlockCache<8> cache(sd_card);
+///    cache.Initialize();
+///
+///    FileSystem filesystem(cache);
+///    // ...
+///    cache.Sync();
+///
+/// @tparam kBlocks - number of blocks the cache holds.
+/// @tparam kBlockSize - block size of the cached storage, in bytes.
+template <size_t kBlocks, size_t kBlockSize = 512>
+class BlockCache : public Storage
+{
+ public:
+  static_assert(kBlocks > 0, "BlockCache must hold at least one block.");
+
+  /// @param storage - the storage to cache.
+  /// @param read_ahead - number of blocks fetched by a read that continues
+  ///        the previous one. 1 disables read-ahead.
+  explicit BlockCache(Storage & storage, size_t read_ahead = 4)
+      : storage_(storage),
+        read_ahead_(std::clamp(read_ahead, size_t{ 1 }, kBlocks))
+  {
+  }
+
+  /// @throw sjsu::Exception - std::errc::invalid_argument if the block size
+  ///        of the storage is not kBlockSize.
+  void ModuleInitialize() override
+  {
+    storage_.Initialize();
+
+    if (storage_.GetBlockSize().to<size_t>() != kBlockSize)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Block size of the storage does not match the cache.");
+    }
+
+    block_count_ = static_cast<uint32_t>(storage_.GetCapacity().to<size_t>() /
+                                         kBlockSize);
+    lines_.fill(Line_t{});
+    next_read_ = kNoBlock;
+  }
+
+  /// Writes every modified block to the storage, then powers it down.
+  void ModulePowerDown() override
+  {
+    Sync();
+    storage_.PowerDown();
+  }
+
+  Type GetMemoryType() override
+  {
+    return storage_.GetMemoryType();
+  }
+
+  bool IsMediaPresent() override
+  {
+    return storage_.IsMediaPresent();
+  }
+
+  bool IsReadOnly() override
+  {
+    return storage_.IsReadOnly();
+  }
+
+  units::data::byte_t GetCapacity() override
+  {
+    return storage_.GetCapacity();
+  }
+
+  units::data::byte_t GetBlockSize() override
+  {
+    return storage_.GetBlockSize();
+  }
+
+  void Erase(uint32_t block_address, size_t blocks_count) override
+  {
+    for (Line_t & line : lines_)
+    {
+      if (line.valid && line.block >= block_address &&
+          line.block - block_address < blocks_count)
+      {
+        line.valid = false;
+      }
+    }
+    storage_.Erase(block_address, blocks_count);
+  }
+
+  void Write(uint32_t block_address, std::span<const uint8_t> data) override
+  {
+    for (uint32_t block = block_address; !data.empty(); block++)
+    {
+      const size_t kSize = std::min(data.size(), kBlockSize);
+
+      // Whole blocks are replaced, so they do not need to be read first.
+      const size_t kLine =
+          (kSize == kBlockSize) ? Allocate(block) : Fetch(block, 1);
+      std::copy_n(data.begin(), kSize, Block(kLine).begin());
+      lines_[kLine].dirty = true;
+
+      data = data.subspan(kSize);
+    }
+  }
+
+  using Storage::Write;
+
+  void Read(uint32_t block_address, std::span<uint8_t> data) override
+  {
+    const size_t kRequested = (data.size() + kBlockSize - 1) / kBlockSize;
+    const bool kSequential  = (block_address == next_read_);
+
+    for (uint32_t block = block_address; !data.empty(); block++)
+    {
+      const size_t kSize = std::min(data.size(), kBlockSize);
+      const size_t kRest = kRequested - (block - block_address);
+
+      const size_t kLine =
+          Fetch(block, kSequential ? std::max(kRest, read_ahead_) : kRest);
+      std::copy_n(Block(kLine).begin(), kSize, data.begin());
+
+      data = data.subspan(kSize);
+    }
+
+    next_read_ = static_cast<uint32_t>(block_address + kRequested);
+  }
+
+  using Storage::Read;
+
+  TransferHints_t GetTransferHints() override
+  {
+    return storage_.GetTransferHints();
+  }
+
+  /// Writes modified blocks to the storage first, so that the view of a
+  /// memory-mapped storage is current.
+  std::span<const uint8_t> Map(uint32_t block_address,
+                               size_t blocks_count) override
+  {
+    Sync();
+    return storage_.Map(block_address, blocks_count);
+  }
+
+  /// Write every modified block to the storage. Blocks cached in consecutive
+  /// lines are written together.
+  void Sync()
+  {
+    for (size_t line = 0; line < kBlocks; line++)
+    {
+      if (lines_[line].valid && lines_[line].dirty)
+      {
+        line += WriteBack(line) - 1;
+      }
+    }
+  }
+
+  /// Drop every cached block, without writing modified blocks to the
+  /// storage, such as after the media has been changed.
+  void Invalidate()
+  {
+    lines_.fill(Line_t{});
+    next_read_ = kNoBlock;
+  }
+
+  /// @return uint32_t - number of blocks read or written that were cached.
+  uint32_t GetHits() const
+  {
+    return hits_;
+  }
+
+  /// @return uint32_t - number of blocks read or written that had to be
+  ///         fetched from the storage.
+  uint32_t GetMisses() const
+  {
+    return misses_;
+  }
+
+ private:
+  static constexpr uint32_t kNoBlock = UINT32_MAX;
+
+  struct Line_t
+  {
+    uint32_t block     = kNoBlock;
+    uint32_t last_used = 0;
+    bool valid         = false;
+    bool dirty         = false;
+  };
+
+  std::span<uint8_t, kBlockSize> Block(size_t line)
+  {
+    return std::span<uint8_t, kBlockSize>(&buffer_[line * kBlockSize],
+                                          kBlockSize);
+  }
+
+  /// @return size_t - the line of `block`, or kBlocks if it is not cached.
+  size_t Find(uint32_t block) const
+  {
+    for (size_t line = 0; line < kBlocks; line++)
+    {
+      if (lines_[line].valid && lines_[line].block == block)
+      {
+        return line;
+      }
+    }
+    return kBlocks;
+  }
+
+  /// Mark a line as just used.
+  size_t Touch(size_t line)
+  {
+    lines_[line].last_used = ++tick_;
+    return line;
+  }
+
+  /// @return size_t - the line of `block`, reading it and up to `count` - 1
+  ///         blocks after it from the storage if it is not cached.
+  size_t Fetch(uint32_t block, size_t count)
+  {
+    const size_t kCached = Find(block);
+    if (kCached != kBlocks)
+    {
+      hits_++;
+      return Touch(kCached);
+    }
+    misses_++;
+
+    // Stop before the end of the storage and before any block that is already
+    // cached, so no block is ever cached twice.
+    count = std::min(count, kBlocks);
+    if (block_count_ > block)
+    {
+      count = std::min<size_t>(count, block_count_ - block);
+    }
+    for (size_t i = 1; i < count; i++)
+    {
+      if (Find(static_cast<uint32_t>(block + i)) != kBlocks)
+      {
+        count = i;
+        break;
+      }
+    }
+
+    const size_t kFirst = Replace(count);
+    storage_.Read(block,
+                  std::span<uint8_t>(&buffer_[kFirst * kBlockSize],
+                                     count * kBlockSize));
+    for (size_t i = 0; i < count; i++)
+    {
+      lines_[kFirst + i] = Line_t{
+        .block     = static_cast<uint32_t>(block + i),
+        .last_used = tick_ + 1,
+        .valid     = true,
+        .dirty     = false,
+      };
+    }
+    return Touch(kFirst);
+  }
+
+  /// @return size_t - the line of `block`, which is cached without reading it
+  ///         from the storage if it is not already cached.
+  size_t Allocate(uint32_t block)
+  {
+    const size_t kCached = Find(block);
+    if (kCached != kBlocks)
+    {
+      hits_++;
+      return Touch(kCached);
+    }
+    misses_++;
+
+    const size_t kLine = Replace(1);
+    lines_[kLine]      = Line_t{ .block = block, .valid = true };
+    return Touch(kLine);
+  }
+
+  /// Free the `count` consecutive lines that were used least recently,
+  /// writing back any modified blocks they hold.
+  ///
+  /// @return size_t - the first of the lines.
+  size_t Replace(size_t count)
+  {
+    // Empty lines have never been used, so are picked first.
+    size_t first  = 0;
+    uint32_t best = UINT32_MAX;
+    for (size_t start = 0; start + count <= kBlocks; start++)
+    {
+      uint32_t newest = 0;
+      for (size_t line = start; line < start + count; line++)
+      {
+        const uint32_t kUsed = lines_[line].valid ? lines_[line].last_used : 0;
+        newest               = std::max(newest, kUsed);
+      }
+
+      if (newest < best)
+      {
+        best  = newest;
+        first = start;
+      }
+    }
+
+    for (size_t line = first; line < first + count; line++)
+    {
+      if (lines_[line].valid && lines_[line].dirty)
+      {
+        WriteBack(line);
+      }
+      lines_[line].valid = false;
+    }
+    return first;
+  }
+
+  /// Write the modified block of `line` to the storage, along with the
+  /// modified blocks that follow it in the next lines.
+  ///
+  /// @return size_t - number of lines written.
+  size_t WriteBack(size_t line)
+  {
+    size_t count = 1;
+    while (line + count < kBlocks && lines_[line + count].valid &&
+           lines_[line + count].dirty &&
+           lines_[line + count].block == lines_[line].block + count)
+    {
+      count++;
+    }
+
+    storage_.Write(lines_[line].block,
+                   std::span<const uint8_t>(&buffer_[line * kBlockSize],
+                                            count * kBlockSize));
+    for (size_t i = 0; i < count; i++)
+    {
+      lines_[line + i].dirty = false;
+    }
+    return count;
+  }
+
+  Storage & storage_;
+  size_t read_ahead_;
+  std::array<uint8_t, kBlocks * kBlockSize> buffer_{};
+  std::array<Line_t, kBlocks> lines_{};
+  uint32_t block_count_ = 0;
+  uint32_t next_read_   = kNoBlock;
+  uint32_t tick_        = 0;
+  uint32_t hits_        = 0;
+  uint32_t misses_      = 0;
+};
+}  // namespace sjsu
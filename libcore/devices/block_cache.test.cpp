@@ -0,0 +1,154 @@
+#include <libcore/devices/block_cache.hpp>
+
+#include <array>
+#include <vector>
+
+#include <libcore/testing/ram_storage.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+constexpr size_t kTestBlockSize = 4;
+}  // namespace
+
+TEST_CASE("Testing BlockCache")
+{
+  testing::RamStorage storage({ .type       = Storage::Type::kSD,
+                                .block_size = kTestBlockSize,
+                                .record     = true });
+  for (size_t i = 0; i < storage.memory.size(); i++)
+  {
+    storage.memory[i] = static_cast<uint8_t>(i);
+  }
+  BlockCache<4, kTestBlockSize> test_subject(storage, 3);
+  using Access_t = testing::RamStorage::Access_t;
+
+  SECTION("Initialize() throws if the block sizes differ")
+  {
+    // Setup
+    storage.settings.block_size = 8;
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.Initialize(), sjsu::Exception);
+  }
+
+  SECTION("Reads of cached blocks do not access the storage")
+  {
+    // Setup
+    test_subject.Initialize();
+    std::array<uint8_t, 2> first;
+    std::array<uint8_t, 2> second;
+
+    // Exercise
+    test_subject.Read(5, first);
+    test_subject.Read(5, second);
+
+    // Verify
+    CHECK(storage.accesses == std::vector<Access_t>{ { 'r', 5, 1 } });
+    CHECK(std::array<uint8_t, 2>{ 20, 21 } == second);
+    CHECK(1 == test_subject.GetHits());
+    CHECK(1 == test_subject.GetMisses());
+  }
+
+  SECTION("Reads of several blocks are one access")
+  {
+    // Setup
+    test_subject.Initialize();
+    std::array<uint8_t, 3 * kTestBlockSize> data;
+
+    // Exercise
+    test_subject.Read(2, data);
+
+    // Verify
+    CHECK(storage.accesses == std::vector<Access_t>{ { 'r', 2, 3 } });
+    CHECK(8 == data[0]);
+    CHECK(19 == data[11]);
+  }
+
+  SECTION("Sequential reads fetch the blocks ahead")
+  {
+    // Setup
+    test_subject.Initialize();
+    std::array<uint8_t, kTestBlockSize> data;
+
+    // Exercise
+    for (uint32_t block = 0; block < 4; block++)
+    {
+      test_subject.Read(block, data);
+    }
+
+    // Verify
+    CHECK(storage.accesses ==
+          std::vector<Access_t>{ { 'r', 0, 1 }, { 'r', 1, 3 } });
+    CHECK(12 == data[0]);
+  }
+
+  SECTION("Writes are held until Sync() and written together")
+  {
+    // Setup
+    test_subject.Initialize();
+    const std::array<uint8_t, 2 * kTestBlockSize> kData = { 1, 2, 3, 4,
+                                                          5, 6, 7, 8 };
+    const std::array<uint8_t, 1> kPartial = { 0xAA };
+
+    // Exercise
+    test_subject.Write(6, kData);
+    test_subject.Write(9, kPartial);
+    const size_t kAccessesBeforeSync = storage.accesses.size();
+    test_subject.Sync();
+    test_subject.Sync();
+
+    // Verify
+    CHECK(1 == kAccessesBeforeSync);
+    CHECK(storage.accesses ==
+          std::vector<Access_t>{
+              { 'r', 9, 1 }, { 'w', 6, 2 }, { 'w', 9, 1 } });
+    CHECK(8 == storage.memory[7 * kTestBlockSize + 3]);
+    CHECK(0xAA == storage.memory[9 * kTestBlockSize]);
+    CHECK(37 == storage.memory[9 * kTestBlockSize + 1]);
+  }
+
+  SECTION("Replacing a modified block writes it back")
+  {
+    // Setup
+    test_subject.Initialize();
+    const std::array<uint8_t, kTestBlockSize> kData = { 9, 9, 9, 9 };
+    std::array<uint8_t, kTestBlockSize> data;
+    test_subject.Write(0, kData);
+
+    // Exercise
+    for (uint32_t block : { 4, 6, 8, 10 })
+    {
+      test_subject.Read(block, data);
+    }
+
+    // Verify
+    CHECK(9 == storage.memory[0]);
+    CHECK(storage.accesses.back() == Access_t{ 'r', 10, 1 });
+    CHECK(std::count(storage.accesses.begin(),
+                     storage.accesses.end(),
+                     Access_t{ 'w', 0, 1 }) == 1);
+  }
+
+  SECTION("Erase() drops cached copies of the erased blocks")
+  {
+    // Setup
+    test_subject.Initialize();
+    const std::array<uint8_t, kTestBlockSize> kData = { 9, 9, 9, 9 };
+    std::array<uint8_t, kTestBlockSize> data;
+    test_subject.Write(3, kData);
+
+    // Exercise
+    test_subject.Erase(3, 1);
+    test_subject.Read(3, data);
+    test_subject.Sync();
+
+    // Verify
+    CHECK(0xFF == data[0]);
+    CHECK(storage.accesses ==
+          std::vector<Access_t>{ { 'e', 3, 1 }, { 'r', 3, 1 } });
+  }
+}
+}  // namespace sjsu
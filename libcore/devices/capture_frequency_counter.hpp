@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include <libcore/devices/frequency_counter.hpp>
+#include <libcore/module.hpp>
+#include <libcore/peripherals/pulse_capture.hpp>
+#include <libcore/utility/math/units.hpp>
+
+namespace sjsu
+{
+/// Settings for the CaptureFrequencyCounter.
+struct CaptureFrequencyCounterSettings_t
+{
+  /// Number of periods of the signal each period measurement is averaged
+  /// over. More periods reduce the jitter of the result, but take longer.
+  uint32_t periods = 8;
+
+  /// Above this frequency, the count method is used, if a FrequencyCounter
+  /// was given. Below half of this frequency, the period method is used
+  /// again.
+  units::frequency::hertz_t count_method_above = 20_kHz;
+};
+
+/// Measures the frequency of a signal from timestamps of its edges, captured
+/// by the hardware timer of a PulseCapture, with a resolution of a tick of
+/// that timer.
+///
+/// Low frequencies are measured with the period method: the time taken by a
+/// number of periods, which is accurate no matter how often GetFrequency() is
+/// called. Capture interrupts are only enabled until enough periods have
+/// been captured, so the interrupt load stays bounded.
+///
+/// At high frequencies, an interrupt per edge is too costly, so when a
+/// FrequencyCounter is given, the counter switches to the count method above
+/// `count_method_above`: the number of edges counted by a hardware counter
+/// between calls of GetFrequency(). Switching has hysteresis, and back to the
+/// period method happens below half of that frequency.
+///
+/// The capture timer is assumed to count up through its full 32 bit range.
+///
+/// USAGE:
+///
+///    sjsu::FrequencyCounter high_frequencies(&hardware_counter);
+///    sjsu::CaptureFrequencyCounter tachometer(
+///        capture, 1_MHz, &high_frequencies);
+///    tachometer.Initialize();
+///
+///    units::frequency::hertz_t frequency = tachometer.GetFrequency();
+class CaptureFrequencyCounter
+    : public Module<CaptureFrequencyCounterSettings_t>
+{
+ public:
+  /// Ways of measuring the frequency.
+  enum class Method : uint8_t
+  {
+    /// Time a number of periods with captured edges.
+    kPeriod,
+    /// Count edges over the time between calls of GetFrequency().
+    kCount,
+  };
+
+  /// @param capture - the capture timer that timestamps the rising edges of
+  ///        the signal.
+  /// @param capture_clock - frequency of the ticks of the capture timer.
+  /// @param counter - optional counter of the edges of the same signal, used
+  ///        for the count method. If nullptr, the period method is always
+  ///        used.
+  CaptureFrequencyCounter(const PulseCapture & capture,
+                          units::frequency::hertz_t capture_clock,
+                          FrequencyCounter * counter = nullptr)
+      : capture_(capture),
+        capture_clock_(static_cast<uint64_t>(capture_clock.to<float>())),
+        counter_(counter)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    periods_          = std::max(settings.periods, uint32_t{ 1 });
+    switch_frequency_ = settings.count_method_above;
+
+    capture_.Initialize([this](PulseCapture::CaptureStatus_t status) {
+      OnCapture(status);
+    });
+    capture_.ConfigureCapture(PulseCapture::CaptureEdgeMode::kRising);
+    if (counter_ != nullptr)
+    {
+      counter_->Initialize();
+    }
+    StartPeriodMethod();
+  }
+
+  void ModulePowerDown() override
+  {
+    capture_.EnableCaptureInterrupt(false);
+  }
+
+  /// Get the most recent measurement of the frequency, and switch between
+  /// the period and count methods if the frequency calls for it.
+  ///
+  /// With the period method, the result only changes once the configured
+  /// number of periods have been captured since the last measurement, and is
+  /// 0Hz until the first measurement completes.
+  ///
+  /// @return units::frequency::hertz_t - frequency of the signal.
+  units::frequency::hertz_t GetFrequency()
+  {
+    if (method_ == Method::kCount)
+    {
+      frequency_ = counter_->GetFrequency();
+      if (frequency_ < switch_frequency_ / 2)
+      {
+        StartPeriodMethod();
+      }
+      return frequency_;
+    }
+
+    if (!complete_)
+    {
+      return frequency_;
+    }
+
+    // Capture interrupts are disabled, so the timestamps are stable.
+    const uint32_t kTicks = last_ - first_;
+    if (kTicks != 0)
+    {
+      frequency_ = units::frequency::hertz_t(
+          static_cast<float>(periods_ * capture_clock_) /
+          static_cast<float>(kTicks));
+    }
+
+    if (counter_ != nullptr && frequency_ > switch_frequency_)
+    {
+      StartCountMethod();
+    }
+    else
+    {
+      StartPeriodMethod();
+    }
+    return frequency_;
+  }
+
+  /// @return Method - the method of the measurement in progress.
+  Method GetMethod() const
+  {
+    return method_;
+  }
+
+ private:
+  /// Capture interrupt handler. Timestamps periods_ + 1 rising edges, then
+  /// stops until the measurement is read.
+  void OnCapture(PulseCapture::CaptureStatus_t status)
+  {
+    if (edges_ == 0)
+    {
+      first_ = status.count;
+    }
+    last_ = status.count;
+    edges_++;
+
+    if (edges_ > periods_)
+    {
+      capture_.EnableCaptureInterrupt(false);
+      complete_ = true;
+    }
+  }
+
+  void StartPeriodMethod()
+  {
+    method_   = Method::kPeriod;
+    edges_    = 0;
+    complete_ = false;
+    capture_.EnableCaptureInterrupt(true);
+  }
+
+  void StartCountMethod()
+  {
+    capture_.EnableCaptureInterrupt(false);
+    method_ = Method::kCount;
+    counter_->Reset();
+  }
+
+  const PulseCapture & capture_;
+  uint64_t capture_clock_;
+  FrequencyCounter * counter_;
+  uint32_t periods_                           = 1;
+  units::frequency::hertz_t switch_frequency_ = 0_Hz;
+  units::frequency::hertz_t frequency_        = 0_Hz;
+  Method method_                              = Method::kPeriod;
+  uint32_t edges_                             = 0;
+  uint32_t first_                             = 0;
+  uint32_t last_                              = 0;
+  std::atomic<bool> complete_                 = false;
+};
+}  // namespace sjsu
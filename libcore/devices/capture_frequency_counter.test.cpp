@@ -0,0 +1,148 @@
+#include <libcore/devices/capture_frequency_counter.hpp>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Capture timer whose edges are triggered by the test.
+class FakeCapture : public PulseCapture
+{
+ public:
+  void Initialize(CaptureCallback isr, int32_t) const override
+  {
+    callback = isr;
+  }
+  void ConfigureCapture(CaptureEdgeMode mode) const override
+  {
+    edge = mode;
+  }
+  void EnableCaptureInterrupt(bool enabled) const override
+  {
+    interrupt_enabled = enabled;
+  }
+  void Edge(uint32_t count) const
+  {
+    if (interrupt_enabled)
+    {
+      callback({ .count = count, .flags = 0 });
+    }
+  }
+
+  mutable CaptureCallback callback;
+  mutable CaptureEdgeMode edge   = CaptureEdgeMode::kNone;
+  mutable bool interrupt_enabled = false;
+};
+}  // namespace
+
+TEST_CASE("Testing CaptureFrequencyCounter")
+{
+  // Setup
+  FakeCapture capture;
+
+  SECTION("Averages the time of the configured number of periods")
+  {
+    // Setup
+    CaptureFrequencyCounter counter(capture, 1_MHz);
+    counter.settings.periods = 4;
+    counter.Initialize();
+
+    // Exercise
+    // Periods of 100, 101, 99 and 100 ticks, then an edge past the periods.
+    for (uint32_t count : { 1000, 1100, 1201, 1300, 1400, 1500 })
+    {
+      capture.Edge(count);
+    }
+    auto frequency = counter.GetFrequency();
+
+    // Verify
+    CHECK(PulseCapture::CaptureEdgeMode::kRising == capture.edge);
+    CHECK(10'000 == doctest::Approx(frequency.to<float>()));
+    CHECK(capture.interrupt_enabled);
+    CHECK(CaptureFrequencyCounter::Method::kPeriod == counter.GetMethod());
+  }
+
+  SECTION("Keeps the previous result until enough periods are captured")
+  {
+    // Setup
+    CaptureFrequencyCounter counter(capture, 1_MHz);
+    counter.settings.periods = 2;
+    counter.Initialize();
+
+    // Exercise
+    capture.Edge(0);
+    capture.Edge(500);
+    auto before = counter.GetFrequency();
+    capture.Edge(1000);
+    auto after = counter.GetFrequency();
+
+    // Verify
+    CHECK(0 == before.to<float>());
+    CHECK(2000 == doctest::Approx(after.to<float>()));
+  }
+
+  SECTION("Timer wrap around")
+  {
+    // Setup
+    CaptureFrequencyCounter counter(capture, 1_MHz);
+    counter.settings.periods = 1;
+    counter.Initialize();
+
+    // Exercise
+    capture.Edge(0xFFFF'FF00);
+    capture.Edge(0x0000'0100);
+    auto frequency = counter.GetFrequency();
+
+    // Verify
+    CHECK(1'000'000.0f / 512 == doctest::Approx(frequency.to<float>()));
+  }
+
+  SECTION("Switches to and from the count method")
+  {
+    // Setup
+    Mock<HardwareCounter> mock_counter;
+    Fake(Method(mock_counter, ModuleInitialize));
+    Fake(Method(mock_counter, SetDirection));
+    int32_t edges = 0;
+    When(Method(mock_counter, GetCount)).AlwaysDo([&edges]() {
+      return edges;
+    });
+    std::chrono::nanoseconds now = 0ns;
+    SetUptimeFunction([&now]() { return now; });
+    FrequencyCounter edge_counter(&mock_counter.get());
+
+    CaptureFrequencyCounter counter(capture, 1_MHz, &edge_counter);
+    counter.settings.periods            = 1;
+    counter.settings.count_method_above = 20_kHz;
+    counter.Initialize();
+
+    // Exercise
+    capture.Edge(0);
+    capture.Edge(25);  // 40kHz
+    auto captured                = counter.GetFrequency();
+    bool interrupts_after_switch = capture.interrupt_enabled;
+
+    // 50'000 edges in 1 second
+    edges = 50'000;
+    now   = 1s;
+    auto counted = counter.GetFrequency();
+    auto method  = counter.GetMethod();
+
+    // 5'000 edges in the next second is below half of 20kHz.
+    edges = 55'000;
+    now   = 2s;
+    counter.GetFrequency();
+
+    // Verify
+    CHECK(40'000 == doctest::Approx(captured.to<float>()));
+    CHECK(!interrupts_after_switch);
+    CHECK(50'000 == doctest::Approx(counted.to<float>()));
+    CHECK(CaptureFrequencyCounter::Method::kCount == method);
+    CHECK(CaptureFrequencyCounter::Method::kPeriod == counter.GetMethod());
+    CHECK(capture.interrupt_enabled);
+
+    SetUptimeFunction(DefaultUptime);
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include <libcore/module.hpp>
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/gpio_port.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/ring_buffer.hpp>
+
+namespace sjsu
+{
+/// Debounces 32 inputs at once with vertical counters: each bit of the word
+/// has its own counter, whose digits are spread across kBits words, so every
+/// counter is advanced with a few bitwise operations per sample.
+///
+/// An input changes state once it has differed from its debounced state for
+/// 2^kBits samples in a row. Any sample that agrees with the debounced state
+/// resets the input's counter, so bounces never produce a change.
+///
+/// @tparam kBits - number of bits of each counter, from 1 to 8.
+template <size_t kBits = 2>
+class VerticalDebouncer
+{
+ public:
+  static_assert(kBits >= 1 && kBits <= 8,
+                "VerticalDebouncer counters must have between 1 and 8 bits.");
+
+  /// Number of samples in a row an input must differ to change state.
+  static constexpr size_t kSamples = size_t{ 1 } << kBits;
+
+  /// @param state - initial debounced state of the inputs.
+  constexpr explicit VerticalDebouncer(uint32_t state = 0) : state_(state) {}
+
+  /// Add a sample of each input.
+  ///
+  /// @param sample - new state of every input.
+  /// @return uint32_t - the inputs whose debounced state changed.
+  constexpr uint32_t Update(uint32_t sample)
+  {
+    const uint32_t kDifferent = sample ^ state_;
+
+    // Count up the inputs that differ and clear the counters of the rest. The
+    // carry out of the last digit is set for counters that wrapped to 0.
+    uint32_t carry = kDifferent;
+    for (uint32_t & digit : digits_)
+    {
+      const uint32_t kNext = digit ^ carry;
+      carry                = digit & carry;
+      digit                = kNext & kDifferent;
+    }
+
+    state_ ^= carry;
+    return carry;
+  }
+
+  /// @return uint32_t - the debounced state of every input.
+  constexpr uint32_t State() const
+  {
+    return state_;
+  }
+
+  /// @param state - new debounced state of the inputs, clearing every counter.
+  constexpr void Reset(uint32_t state)
+  {
+    state_ = state;
+    digits_.fill(0);
+  }
+
+ private:
+  std::array<uint32_t, kBits> digits_{};
+  uint32_t state_;
+};
+
+/// Pins of a GpioPort to debounce.
+struct DebouncedPort_t
+{
+  /// The port to read.
+  GpioPort * port;
+  /// The pins of the port to debounce, other pins never produce events.
+  uint32_t mask = UINT32_MAX;
+};
+
+/// Debounces many Gpio and GpioPort inputs, such as the buttons of a panel,
+/// by sampling all of them from a single periodic interrupt, rather than with
+/// an interrupt and a timer per input that fire on every bounce.
+///
+/// Sample() is called at a fixed period, usually from the SystemTimer's
+/// callback. Each call reads every input, 32 bits per word, and debounces
+/// each word with a VerticalDebouncer. Each debounced change is queued as an
+/// Event_t in a lock-free ring buffer, which the application drains with
+/// GetEvent().
+///
+/// Inputs are numbered with the Gpio first, in order, from 0. Each port then
+/// takes the next whole word, so bit `b` of port `p` is input
+/// PortInput(p, b).
+///
+/// The sampling period times 2^kCounterBits is the debounce time: 4 samples of
+/// 5ms debounce for 20ms.
+///
+/// USAGE:
+///
+///    sjsu::Gpio * buttons[] = { &up, &down, &left, &right };
+///    sjsu::DebouncedInputs<1> inputs(buttons);
+///    inputs.Initialize();
+///
+///    system_timer.settings.frequency = 200_Hz;
+///    system_timer.settings.callback  = [&inputs]() { inputs.Sample(); };
+///    system_timer.Initialize();
+///
+///    while (auto event = inputs.GetEvent())
+///    {
+///      // Buttons pull their pins low when pressed.
+///      if (event->edge == sjsu::Gpio::Edge::kFalling)
+///      {
+///        OnPress(event->input);
+///      }
+///    }
+///
+/// @tparam kWords - number of 32 bit words of inputs.
+/// @tparam kQueueSize - number of events that can wait in the queue. Must be a
+///         power of 2.
+/// @tparam kCounterBits - bits of each debounce counter.
+template <size_t kWords, size_t kQueueSize = 32, size_t kCounterBits = 2>
+class DebouncedInputs : public Module<>
+{
+ public:
+  /// A debounced change of an input.
+  struct Event_t
+  {
+    /// The number of the input that changed.
+    uint16_t input;
+    /// kRising if the input is now HIGH, kFalling if it is now LOW.
+    Gpio::Edge edge;
+  };
+
+  /// @param pins - the inputs read one pin at a time. Must outlive this
+  ///        object.
+  /// @param ports - the inputs read a port at a time. Must outlive this
+  ///        object.
+  explicit DebouncedInputs(std::span<Gpio * const> pins,
+                           std::span<const DebouncedPort_t> ports = {})
+      : pins_(pins), ports_(ports)
+  {
+  }
+
+  /// @throw sjsu::Exception - std::errc::argument_list_too_long if the pins
+  ///        and ports need more than kWords words.
+  void ModuleInitialize() override
+  {
+    if (PinWords() + ports_.size() > kWords)
+    {
+      throw Exception(std::errc::argument_list_too_long,
+                      "More inputs were given than DebouncedInputs can hold.");
+    }
+
+    for (Gpio * pin : pins_)
+    {
+      pin->Initialize();
+      pin->SetAsInput();
+    }
+
+    for (const DebouncedPort_t & port : ports_)
+    {
+      port.port->Initialize();
+      port.port->SetDirection(port.mask, Gpio::Direction::kInput);
+    }
+
+    // Start from the current state of the inputs, so there are no events
+    // until something changes.
+    for (size_t word = 0; word < Words(); word++)
+    {
+      const uint32_t kSample = ReadWord(word);
+      debouncers_[word].Reset(kSample);
+      state_[word] = kSample;
+    }
+    events_.Clear();
+  }
+
+  /// Read every input and queue an event for each debounced change. Call at
+  /// a fixed period, such as from a SystemTimer callback. Must not be called
+  /// from more than one context.
+  void Sample()
+  {
+    for (size_t word = 0; word < Words(); word++)
+    {
+      uint32_t changes = debouncers_[word].Update(ReadWord(word));
+      if (changes == 0)
+      {
+        continue;
+      }
+
+      const uint32_t kState = debouncers_[word].State();
+      state_[word].store(kState, std::memory_order_release);
+
+      while (changes != 0)
+      {
+        const auto kBit = static_cast<uint32_t>(std::countr_zero(changes));
+        changes &= changes - 1;
+
+        const Event_t kEvent = {
+          .input = static_cast<uint16_t>(word * 32 + kBit),
+          .edge  = ((kState >> kBit) & 1) ? Gpio::Edge::kRising
+                                          : Gpio::Edge::kFalling,
+        };
+
+        if (!events_.Push(kEvent))
+        {
+          dropped_events_.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+
+  /// Remove and return the oldest debounced change. Must not be called from
+  /// more than one context.
+  ///
+  /// @return std::optional<Event_t> - the oldest event, or std::nullopt if
+  ///         nothing has changed.
+  std::optional<Event_t> GetEvent()
+  {
+    return events_.Pop();
+  }
+
+  /// @param input - the number of the input.
+  /// @return true - if the debounced state of the input is HIGH.
+  bool Read(uint16_t input) const
+  {
+    return (ReadWordState(input / 32) >> (input % 32)) & 1;
+  }
+
+  /// @param word - the word of inputs, where inputs 0 to 31 are word 0.
+  /// @return uint32_t - the debounced state of the 32 inputs of the word.
+  uint32_t ReadWordState(size_t word) const
+  {
+    return state_[word].load(std::memory_order_acquire);
+  }
+
+  /// @param port - index of the port, within the `ports` given.
+  /// @param bit - the pin of the port.
+  /// @return uint16_t - the number of the input of the pin.
+  uint16_t PortInput(size_t port, uint8_t bit) const
+  {
+    return static_cast<uint16_t>((PinWords() + port) * 32 + bit);
+  }
+
+  /// @return uint32_t - the number of events dropped because the queue was
+  ///         full.
+  uint32_t GetDroppedEvents() const
+  {
+    return dropped_events_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  size_t PinWords() const
+  {
+    return (pins_.size() + 31) / 32;
+  }
+
+  size_t Words() const
+  {
+    return PinWords() + ports_.size();
+  }
+
+  uint32_t ReadWord(size_t word) const
+  {
+    if (word >= PinWords())
+    {
+      const DebouncedPort_t & port = ports_[word - PinWords()];
+      return port.port->Read() & port.mask;
+    }
+
+    const size_t kFirst = word * 32;
+    const size_t kCount = std::min(pins_.size() - kFirst, size_t{ 32 });
+    uint32_t sample     = 0;
+    for (size_t i = 0; i < kCount; i++)
+    {
+      sample |= uint32_t{ pins_[kFirst + i]->Read() } << i;
+    }
+    return sample;
+  }
+
+  std::span<Gpio * const> pins_;
+  std::span<const DebouncedPort_t> ports_;
+  std::array<VerticalDebouncer<kCounterBits>, kWords> debouncers_;
+  std::array<std::atomic<uint32_t>, kWords> state_{};
+  RingBuffer<Event_t, kQueueSize> events_;
+  std::atomic<uint32_t> dropped_events_ = 0;
+};
+}  // namespace sjsu
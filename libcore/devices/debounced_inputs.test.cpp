@@ -0,0 +1,190 @@
+#include <libcore/devices/debounced_inputs.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+class FakeButton : public Gpio
+{
+ public:
+  void ModuleInitialize() override {}
+  void SetDirection(Direction new_direction) override
+  {
+    direction = new_direction;
+  }
+  void Set(State) override {}
+  void Toggle() override {}
+  bool Read() override
+  {
+    return level;
+  }
+  void AttachInterrupt(InterruptCallback, Edge) override {}
+  void DetachInterrupt() override {}
+
+  Direction direction = Direction::kOutput;
+  bool level          = true;
+};
+
+class FakeButtonPort : public GpioPort
+{
+ public:
+  void ModuleInitialize() override {}
+  void SetDirection(uint32_t mask, Gpio::Direction) override
+  {
+    inputs |= mask;
+  }
+  void Set(uint32_t) override {}
+  void Clear(uint32_t) override {}
+  uint32_t Read() override
+  {
+    return levels;
+  }
+
+  uint32_t inputs = 0;
+  uint32_t levels = 0;
+};
+}  // namespace
+
+TEST_CASE("Testing VerticalDebouncer")
+{
+  SECTION("Changes after 2^kBits samples that differ in a row")
+  {
+    // Setup
+    VerticalDebouncer<2> test_subject(0b00);
+
+    // Exercise & Verify
+    CHECK(0 == test_subject.Update(0b11));
+    CHECK(0 == test_subject.Update(0b11));
+    CHECK(0 == test_subject.Update(0b11));
+    CHECK(0b11 == test_subject.Update(0b11));
+    CHECK(0b11 == test_subject.State());
+    CHECK(0 == test_subject.Update(0b11));
+  }
+
+  SECTION("Bounces restart the count of each input on its own")
+  {
+    // Setup
+    VerticalDebouncer<2> test_subject(0b00);
+    std::vector<uint32_t> changes;
+
+    // Exercise
+    for (uint32_t sample : { 0b11, 0b11, 0b10, 0b11, 0b11, 0b11, 0b11 })
+    {
+      changes.push_back(test_subject.Update(sample));
+    }
+
+    // Verify
+    CHECK(changes == std::vector<uint32_t>{ 0, 0, 0, 0b10, 0, 0, 0b01 });
+    CHECK(0b11 == test_subject.State());
+  }
+
+  SECTION("Reset() sets the state without a change")
+  {
+    // Setup
+    VerticalDebouncer<1> test_subject(0);
+    test_subject.Update(1);
+
+    // Exercise
+    test_subject.Reset(1);
+
+    // Verify
+    CHECK(0 == test_subject.Update(1));
+    CHECK(0 == test_subject.Update(0));
+    CHECK(1 == test_subject.Update(0));
+  }
+}
+
+TEST_CASE("Testing DebouncedInputs")
+{
+  std::array<FakeButton, 34> buttons;
+  std::array<Gpio *, 34> pins;
+  for (size_t i = 0; i < pins.size(); i++)
+  {
+    pins[i] = &buttons[i];
+  }
+  FakeButtonPort port;
+  port.levels                    = 0b0110;
+  const DebouncedPort_t kPorts[] = { { .port = &port, .mask = 0b1111 } };
+
+  DebouncedInputs<3, 4> test_subject(pins, kPorts);
+
+  SECTION("Initialize() sets inputs and starts from their state")
+  {
+    // Exercise
+    test_subject.Initialize();
+    test_subject.Sample();
+
+    // Verify
+    CHECK(Gpio::Direction::kInput == buttons[0].direction);
+    CHECK(0b1111 == port.inputs);
+    CHECK(UINT32_MAX == test_subject.ReadWordState(0));
+    CHECK(0b11 == test_subject.ReadWordState(1));
+    CHECK(0b0110 == test_subject.ReadWordState(2));
+    CHECK(!test_subject.GetEvent());
+  }
+
+  SECTION("Queues an event per debounced change, in order of input")
+  {
+    // Setup
+    test_subject.Initialize();
+    buttons[33].level = false;
+    buttons[1].level  = false;
+    port.levels       = 0b1110;
+
+    // Exercise
+    for (size_t i = 0; i < 4; i++)
+    {
+      test_subject.Sample();
+    }
+
+    // Verify
+    auto first  = test_subject.GetEvent();
+    auto second = test_subject.GetEvent();
+    auto third  = test_subject.GetEvent();
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(third);
+    CHECK(1 == first->input);
+    CHECK(Gpio::Edge::kFalling == first->edge);
+    CHECK(33 == second->input);
+    CHECK(test_subject.PortInput(0, 3) == third->input);
+    CHECK(64 + 3 == third->input);
+    CHECK(Gpio::Edge::kRising == third->edge);
+    CHECK(!test_subject.GetEvent());
+    CHECK(!test_subject.Read(1));
+    CHECK(test_subject.Read(2));
+  }
+
+  SECTION("Counts events dropped when the queue is full")
+  {
+    // Setup
+    test_subject.Initialize();
+    for (size_t i = 0; i < 6; i++)
+    {
+      buttons[i].level = false;
+    }
+
+    // Exercise
+    for (size_t i = 0; i < 4; i++)
+    {
+      test_subject.Sample();
+    }
+
+    // Verify
+    CHECK(2 == test_subject.GetDroppedEvents());
+  }
+
+  SECTION("Initialize() throws if the inputs need too many words")
+  {
+    // Setup
+    DebouncedInputs<2> too_small(pins, kPorts);
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(too_small.Initialize(), sjsu::Exception);
+  }
+}
+}  // namespace sjsu
@@ -5,20 +5,58 @@
 // @{
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <utility>
 
 #include <libcore/module.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
+#include <libcore/utility/seqlock.hpp>
+#include <libcore/utility/time/time.hpp>
 
 namespace sjsu
 {
+/// Generic settings for a standard DistanceSensor device
+struct DistanceSensorSettings_t
+{
+  /// Measure continuously rather than once per call of GetDistance().
+  ///
+  /// In continuous mode the driver starts back to back measurements when
+  /// initialized and records each one as the device signals that it is ready,
+  /// typically from its data ready interrupt. GetDistance(),
+  /// GetSignalStrengthPercent() and GetMeasurement() then return the latest
+  /// measurement immediately, rather than blocking for the 20ms to 50ms a
+  /// time-of-flight measurement takes. Use OnMeasurement() to be notified of
+  /// each new measurement.
+  ///
+  /// Drivers for devices that cannot measure continuously ignore this.
+  bool continuous = false;
+};
+
 /// Interface for a sensor that can measure distance in a single dimension, such
 /// as 1D lidar, ultrasonic range sensor, or infared distance sensor.
 /// @ingroup sensors
-class DistanceSensor : public Module<>
+class DistanceSensor : public Module<DistanceSensorSettings_t>
 {
  public:
-  /// Trigger a capture of the current distance reading and return it.
+  /// A distance measurement and the signal strength it was made with.
+  struct Measurement_t
+  {
+    /// Measured distance.
+    units::length::millimeter_t distance = {};
+    /// Strength of the signal of the measurement, from 0 to 100.
+    float signal_strength_percent = 0;
+    /// Uptime when the measurement completed.
+    std::chrono::nanoseconds timestamp = 0ns;
+  };
+
+  /// Function called with each new measurement in continuous mode. It may be
+  /// called from an interrupt.
+  using MeasurementCallback = InplaceFunction<void(const Measurement_t &)>;
+
+  /// Trigger a capture of the current distance reading and return it. In
+  /// continuous mode, return the distance of the latest measurement.
   ///
   /// @return measured distance
   virtual units::length::millimeter_t GetDistance() = 0;
@@ -27,5 +65,63 @@ class DistanceSensor : public Module<>
   ///
   /// @return the strength of the signal the strength of the measurement.
   virtual float GetSignalStrengthPercent() = 0;
+
+  /// Get a distance and the signal strength of the same measurement. In
+  /// continuous mode this returns the latest measurement immediately, which
+  /// is the only way to be sure both values come from the same measurement
+  /// while new ones keep arriving.
+  ///
+  /// @return Measurement_t - the measurement. In continuous mode, a
+  ///         measurement with a timestamp of 0 if none has completed yet.
+  virtual Measurement_t GetMeasurement()
+  {
+    if (settings.continuous)
+    {
+      return latest_.Read();
+    }
+
+    Measurement_t measurement;
+    measurement.distance                = GetDistance();
+    measurement.signal_strength_percent = GetSignalStrengthPercent();
+    measurement.timestamp               = Uptime();
+    return measurement;
+  }
+
+  /// Set the function to call with each new measurement in continuous mode.
+  /// Set it before Initialize(), as it may be called from an interrupt.
+  ///
+  /// @param callback - function to call, or nullptr to stop notifications.
+  void OnMeasurement(MeasurementCallback callback)
+  {
+    callback_ = std::move(callback);
+  }
+
+ protected:
+  /// Record a completed measurement in continuous mode and notify the
+  /// OnMeasurement() callback. Drivers call this from their data ready
+  /// interrupt, or wherever they learn that a measurement is ready. Never
+  /// blocks.
+  ///
+  /// @param measurement - the measurement that completed.
+  void Publish(const Measurement_t & measurement)
+  {
+    latest_.Write(measurement);
+    if (callback_)
+    {
+      callback_(measurement);
+    }
+  }
+
+  /// @return Measurement_t - the latest measurement passed to Publish(),
+  ///         which drivers return from GetDistance() and
+  ///         GetSignalStrengthPercent() in continuous mode.
+  Measurement_t Latest() const
+  {
+    return latest_.Read();
+  }
+
+ private:
+  SeqLock<Measurement_t> latest_;
+  MeasurementCallback callback_ = nullptr;
 };
 }  // namespace sjsu
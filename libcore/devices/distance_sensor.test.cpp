@@ -0,0 +1,126 @@
+#include <libcore/devices/distance_sensor.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Time-of-flight sensor whose measurements take 30ms each.
+class TimeOfFlightSensor : public DistanceSensor
+{
+ public:
+  explicit TimeOfFlightSensor(VirtualClock & clock) : clock_(clock) {}
+
+  void ModuleInitialize() override
+  {
+    if (settings.continuous)
+    {
+      ScheduleNext();
+    }
+  }
+
+  units::length::millimeter_t GetDistance() override
+  {
+    if (settings.continuous)
+    {
+      return Latest().distance;
+    }
+    single_shots++;
+    clock_.Advance(30ms);
+    return units::length::millimeter_t(target);
+  }
+
+  float GetSignalStrengthPercent() override
+  {
+    return (settings.continuous) ? Latest().signal_strength_percent : 75.0f;
+  }
+
+  int32_t target   = 100;
+  int single_shots = 0;
+
+ private:
+  /// Data ready interrupt of the next back to back measurement.
+  void ScheduleNext()
+  {
+    clock_.ScheduleAfter(30ms, [this]() {
+      Measurement_t measurement;
+      measurement.distance                = units::length::millimeter_t(target);
+      measurement.signal_strength_percent = static_cast<float>(target) / 10;
+      measurement.timestamp               = Uptime();
+      Publish(measurement);
+      ScheduleNext();
+    });
+  }
+
+  VirtualClock & clock_;
+};
+}  // namespace
+
+TEST_CASE("Testing DistanceSensor")
+{
+  VirtualClock clock;
+  clock.Start();
+  TimeOfFlightSensor sensor(clock);
+
+  SECTION("Single measurements block until they complete")
+  {
+    // Setup
+    sensor.Initialize();
+
+    // Exercise
+    auto measurement = sensor.GetMeasurement();
+
+    // Verify
+    CHECK(1 == sensor.single_shots);
+    CHECK(100 == measurement.distance.to<int32_t>());
+    CHECK(75.0f == measurement.signal_strength_percent);
+    CHECK(30ms == measurement.timestamp);
+  }
+
+  SECTION("Continuous mode returns the latest measurement immediately")
+  {
+    // Setup
+    sensor.settings.continuous = true;
+    sensor.Initialize();
+
+    // Exercise & Verify
+    CHECK(0ns == sensor.GetMeasurement().timestamp);
+
+    clock.Advance(35ms);
+    sensor.target = 250;
+    CHECK(100 == sensor.GetDistance().to<int32_t>());
+    CHECK(10.0f == sensor.GetSignalStrengthPercent());
+
+    clock.Advance(30ms);
+    auto measurement = sensor.GetMeasurement();
+    CHECK(250 == measurement.distance.to<int32_t>());
+    CHECK(25.0f == measurement.signal_strength_percent);
+    CHECK(60ms == measurement.timestamp);
+    CHECK(65ms == clock.Now());
+    CHECK(0 == sensor.single_shots);
+  }
+
+  SECTION("Each measurement is passed to the callback")
+  {
+    // Setup
+    std::vector<int32_t> distances;
+    sensor.OnMeasurement([&distances](const auto & measurement) {
+      distances.push_back(measurement.distance.template to<int32_t>());
+    });
+    sensor.settings.continuous = true;
+    sensor.Initialize();
+
+    // Exercise
+    clock.Advance(60ms);
+    sensor.target = 50;
+    clock.Advance(30ms);
+
+    // Verify
+    CHECK(std::vector<int32_t>{ 100, 100, 50 } == distances);
+  }
+}
+}  // namespace sjsu
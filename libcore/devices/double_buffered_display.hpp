@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <libcore/devices/framebuffer_display.hpp>
+#include <libcore/devices/pixel_display.hpp>
+#include <libcore/peripherals/interrupt.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/utility/inplace_function.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// A PixelDisplay with two framebuffers in RAM, so that the next frame can be
+/// drawn while the previous one is still being sent to the panel.
+///
+/// Drawing always targets the back buffer. Update() waits for the previous
+/// flush to finish, swaps the buffers and starts sending the changed region
+/// of the new front buffer with the asynchronous flush handler. It then
+/// copies that region into the new back buffer, so drawing of the next frame
+/// continues from the frame being sent, and returns without waiting for the
+/// transfer. A frame is never modified while it is being sent, so the panel
+/// never shows a partly drawn frame.
+///
+/// Only the region passed to Update() is sent and copied. Graphics passes
+/// everything it has drawn since the last update.
+///
+/// USAGE:
+///
+///    using Format = sjsu::PixelDisplay::PixelFormat;
+///
+///    sjsu::DoubleBufferedDisplay<240, 320, Format::kRgb565> display(
+///        [&](sjsu::PixelDisplay::Region_t area,
+///            std::span<const sjsu::Spi::Segment_t> segments,
+///            sjsu::InterruptCallback on_complete) {
+///          tft.SetWindow(area);
+///          if (!tft_device.TransferAsync(segments, on_complete))
+///          {
+///            on_complete();
+///          }
+///        });
+///    sjsu::Graphics graphics(display);
+///
+/// @tparam kWidth - width of the display in pixels.
+/// @tparam kHeight - height of the display in pixels.
+/// @tparam kFormat - layout of the pixels, which should match what the panel
+///         expects to receive.
+template <size_t kWidth, size_t kHeight, PixelDisplay::PixelFormat kFormat>
+class DoubleBufferedDisplay : public PixelDisplay
+{
+ public:
+  /// One of the two framebuffers.
+  using Buffer_t = FramebufferDisplay<kWidth, kHeight, kFormat>;
+
+  /// Starts sending framebuffer bytes to the panel, without waiting for them
+  /// to be sent.
+  ///
+  /// @param area - the area of the display the segments cover, to be set as
+  ///        the panel's address window. Monochrome areas always cover whole
+  ///        pages.
+  /// @param segments - the bytes of the area, row by row, as the transmit
+  ///        buffers of SPI segments. Valid until `on_complete` is called.
+  /// @param on_complete - must be called once the bytes have been sent, or
+  ///        if they could not be sent. May be called from an interrupt.
+  using AsyncFlushHandler =
+      InplaceFunction<void(Region_t area,
+                           std::span<const Spi::Segment_t> segments,
+                           InterruptCallback on_complete)>;
+
+  /// @param flush - starts sending framebuffer bytes to the panel.
+  explicit DoubleBufferedDisplay(AsyncFlushHandler flush) : flush_(flush) {}
+
+  DoubleBufferedDisplay(const DoubleBufferedDisplay &) = delete;
+  DoubleBufferedDisplay & operator=(const DoubleBufferedDisplay &) = delete;
+
+  void ModuleInitialize() override {}
+
+  size_t GetWidth() override
+  {
+    return kWidth;
+  }
+
+  size_t GetHeight() override
+  {
+    return kHeight;
+  }
+
+  Color_t AvailableColors() override
+  {
+    return Back().AvailableColors();
+  }
+
+  void Clear() override
+  {
+    Back().Clear();
+  }
+
+  bool Clear(Region_t region) override
+  {
+    return Back().Clear(region);
+  }
+
+  bool Scroll(int32_t rows) override
+  {
+    return Back().Scroll(rows);
+  }
+
+  void DrawPixel(int32_t x, int32_t y, Color_t color) override
+  {
+    Back().DrawPixel(x, y, color);
+  }
+
+  void DrawSpan(int32_t x, int32_t y, int32_t width, Color_t color) override
+  {
+    Back().DrawSpan(x, y, width, color);
+  }
+
+  void FillRectangle(Region_t region, Color_t color) override
+  {
+    Back().FillRectangle(region, color);
+  }
+
+  void DrawBitmap(Region_t region,
+                  std::span<const uint8_t> bitmap,
+                  Color_t color) override
+  {
+    Back().DrawBitmap(region, bitmap, color);
+  }
+
+  void DrawBitmap(Region_t region, std::span<const uint16_t> pixels) override
+  {
+    Back().DrawBitmap(region, pixels);
+  }
+
+  void Update() override
+  {
+    Update({ .x      = 0,
+             .y      = 0,
+             .width  = static_cast<int32_t>(kWidth),
+             .height = static_cast<int32_t>(kHeight) });
+  }
+
+  /// Swap the buffers and start sending `region` of the frame just drawn.
+  /// Waits first if the previous frame is still being sent.
+  ///
+  /// @param region - area of the display that has changed since the last
+  ///        update.
+  void Update(Region_t region) override
+  {
+    if (region.IsEmpty())
+    {
+      return;
+    }
+
+    WaitForFlush();
+    back_ ^= 1;
+
+    Buffer_t & front = buffers_[back_ ^ 1];
+    size_t count     = 0;
+    Buffer_t::ForEachRun(
+        region, [this, &front, &count](Region_t, size_t offset, size_t size) {
+          segments_[count++] = Spi::Segment_t{
+            .transmit = front.Buffer().subspan(offset, size),
+          };
+        });
+
+    flushing_ = true;
+    flush_(Buffer_t::Align(region),
+           std::span<const Spi::Segment_t>(segments_.data(), count),
+           [this]() { flushing_ = false; });
+
+    // The new back buffer holds the frame before the one being sent, which
+    // only differs from it within `region`.
+    uint8_t * back = Back().GetFramebuffer().data;
+    Buffer_t::ForEachRun(
+        region, [&front, back](Region_t, size_t offset, size_t size) {
+          std::copy_n(front.Buffer().data() + offset, size, back + offset);
+        });
+  }
+
+  /// The back buffer, which changes after each Update().
+  Framebuffer_t GetFramebuffer() override
+  {
+    return Back().GetFramebuffer();
+  }
+
+  /// @return true - if a frame is being sent to the panel.
+  bool IsFlushing() const
+  {
+    return flushing_;
+  }
+
+  /// Wait until the frame being sent to the panel, if any, has been sent.
+  void WaitForFlush()
+  {
+    Wait(std::chrono::nanoseconds::max(), [this]() { return !flushing_; });
+  }
+
+  /// @return std::span<const uint8_t> - the framebuffer being drawn into.
+  std::span<const uint8_t> BackBuffer() const
+  {
+    return buffers_[back_].Buffer();
+  }
+
+  /// @return std::span<const uint8_t> - the framebuffer last sent, or being
+  ///         sent, to the panel.
+  std::span<const uint8_t> FrontBuffer() const
+  {
+    return buffers_[back_ ^ 1].Buffer();
+  }
+
+ private:
+  Buffer_t & Back()
+  {
+    return buffers_[back_];
+  }
+
+  std::array<Buffer_t, 2> buffers_;
+  std::array<Spi::Segment_t, Buffer_t::kLines> segments_;
+  AsyncFlushHandler flush_;
+  size_t back_                = 0;
+  std::atomic<bool> flushing_ = false;
+};
+}  // namespace sjsu
@@ -0,0 +1,92 @@
+#include <libcore/devices/double_buffered_display.hpp>
+
+#include <vector>
+
+#include <libcore/systems/graphics.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing DoubleBufferedDisplay")
+{
+  // Setup
+  using Format  = PixelDisplay::PixelFormat;
+  using Display = DoubleBufferedDisplay<8, 16, Format::kMonochromePages>;
+
+  PixelDisplay::Region_t flushed_area;
+  std::vector<std::vector<uint8_t>> flushed;
+  InterruptCallback complete = nullptr;
+
+  Display display([&](PixelDisplay::Region_t area,
+                      std::span<const Spi::Segment_t> segments,
+                      InterruptCallback on_complete) {
+    flushed_area = area;
+    flushed.clear();
+    for (const auto & segment : segments)
+    {
+      flushed.emplace_back(segment.transmit.begin(), segment.transmit.end());
+    }
+    complete = on_complete;
+  });
+
+  SECTION("Drawing only changes the back buffer")
+  {
+    // Exercise
+    display.DrawPixel(2, 9, {});
+
+    // Verify
+    CHECK(0b0000'0010 == display.BackBuffer()[8 + 2]);
+    CHECK(0 == display.FrontBuffer()[8 + 2]);
+    CHECK(flushed.empty());
+  }
+
+  SECTION("Update() sends the frame drawn and copies it to the back buffer")
+  {
+    // Setup
+    display.DrawPixel(2, 9, {});
+
+    // Exercise
+    display.Update({ .x = 2, .y = 9, .width = 3, .height = 1 });
+
+    // Verify
+    CHECK(flushed_area ==
+          PixelDisplay::Region_t{ .x = 2, .y = 8, .width = 3, .height = 8 });
+    REQUIRE(1 == flushed.size());
+    CHECK(std::vector<uint8_t>{ 0b0000'0010, 0, 0 } == flushed[0]);
+    CHECK(0b0000'0010 == display.FrontBuffer()[8 + 2]);
+    CHECK(0b0000'0010 == display.BackBuffer()[8 + 2]);
+  }
+
+  SECTION("IsFlushing() until the flush handler completes")
+  {
+    // Exercise
+    display.Update();
+    const bool kFlushingBefore = display.IsFlushing();
+    complete();
+
+    // Verify
+    CHECK(kFlushingBefore);
+    CHECK(!display.IsFlushing());
+    REQUIRE(1 == flushed.size());
+    CHECK(16 == flushed[0].size());
+  }
+
+  SECTION("Graphics draws the next frame while the last one is sent")
+  {
+    // Setup
+    Graphics graphics(display);
+    graphics.DrawPixel(1, 1);
+    graphics.Update();
+    complete();
+
+    // Exercise
+    graphics.DrawPixel(3, 1);
+
+    // Verify
+    CHECK(0b0000'0010 == display.FrontBuffer()[1]);
+    CHECK(0 == display.FrontBuffer()[3]);
+    CHECK(0b0000'0010 == display.BackBuffer()[1]);
+    CHECK(0b0000'0010 == display.BackBuffer()[3]);
+  }
+}
+}  // namespace sjsu
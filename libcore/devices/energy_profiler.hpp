@@ -0,0 +1,325 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <libcore/devices/battery_charge.hpp>
+#include <libcore/devices/coulomb_counter.hpp>
+#include <libcore/utility/log.hpp>
+#include <libcore/utility/math/units.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+class EnergyProfiler;
+
+/// Charge used by a phase of the firmware, such as a radio transmission or
+/// a sensor measurement, as attributed by an EnergyProfiler.
+///
+/// A region is usually a static variable declared by SJ2_ENERGY_SCOPE(). Its
+/// constructor is constexpr, so it is constant initialized. A region belongs
+/// to the profiler that last attributed charge to it.
+class EnergyRegion
+{
+ public:
+  /// @param name - name of the region.
+  explicit constexpr EnergyRegion(const char * name) : name_(name) {}
+
+  EnergyRegion(const EnergyRegion &) = delete;
+  EnergyRegion & operator=(const EnergyRegion &) = delete;
+
+  /// Attribute a span of time and the charge used during it to this region.
+  ///
+  /// @param charge - charge used.
+  /// @param time - length of the span.
+  /// @param state_of_charge - fraction of the battery's state of charge
+  ///        used, 0 if it is not measured.
+  void Attribute(units::charge::microampere_hour_t charge,
+                 std::chrono::nanoseconds time,
+                 float state_of_charge = 0)
+  {
+    charge_ += charge;
+    time_ += time;
+    state_of_charge_ += state_of_charge;
+  }
+
+  /// Count a completed visit of the region.
+  void CountVisit()
+  {
+    visits_++;
+  }
+
+  /// Clear the totals of the region.
+  void Reset()
+  {
+    charge_          = units::charge::microampere_hour_t{ 0 };
+    time_            = std::chrono::nanoseconds{ 0 };
+    state_of_charge_ = 0;
+    visits_          = 0;
+  }
+
+  /// @return const char* - name of the region.
+  const char * Name() const
+  {
+    return name_;
+  }
+
+  /// @return uint32_t - number of completed visits.
+  uint32_t Visits() const
+  {
+    return visits_;
+  }
+
+  /// @return units::charge::microampere_hour_t - total charge attributed.
+  units::charge::microampere_hour_t Charge() const
+  {
+    return charge_;
+  }
+
+  /// @return std::chrono::nanoseconds - total time attributed.
+  std::chrono::nanoseconds Time() const
+  {
+    return time_;
+  }
+
+  /// @return float - total fraction of the battery's state of charge used,
+  ///         such as 0.01 for 1%.
+  float StateOfCharge() const
+  {
+    return state_of_charge_;
+  }
+
+  /// @return units::current::microampere_t - mean current while in the
+  ///         region, 0 if no time has been attributed.
+  units::current::microampere_t AverageCurrent() const
+  {
+    if (time_.count() == 0)
+    {
+      return units::current::microampere_t{ 0 };
+    }
+    const auto kHours = std::chrono::duration<float, std::ratio<3600>>(time_);
+    return units::current::microampere_t{ charge_.to<float>() /
+                                          kHours.count() };
+  }
+
+  /// @return units::charge::microampere_hour_t - mean charge per visit, 0 if
+  ///         there have been no visits.
+  units::charge::microampere_hour_t ChargePerVisit() const
+  {
+    if (visits_ == 0)
+    {
+      return units::charge::microampere_hour_t{ 0 };
+    }
+    return charge_ / static_cast<float>(visits_);
+  }
+
+ private:
+  friend class EnergyProfiler;
+
+  const char * name_;
+  const EnergyProfiler * profiler_ = nullptr;
+  EnergyRegion * next_             = nullptr;
+  uint32_t visits_                 = 0;
+  units::charge::microampere_hour_t charge_{ 0 };
+  std::chrono::nanoseconds time_{ 0 };
+  float state_of_charge_ = 0;
+};
+
+/// Attributes the charge measured by a CoulombCounter, and optionally the
+/// state of charge reported by a BatteryCharge, to the regions of code that
+/// are running, so power modes and optimizations can be compared by the
+/// microampere-hours they use.
+///
+/// The counter is read at every region boundary, and the charge used since
+/// the last boundary is attributed to the innermost region that was
+/// running. Nested regions are therefore exclusive: the charge of a region
+/// does not include the regions within it, and the totals of all regions,
+/// including Unmarked() for time outside of every region, add up to the
+/// charge measured since Start().
+///
+/// Reading the counter, often over I2C, takes time and charge of its own, so
+/// mark phases of the firmware rather than short functions, and make sure
+/// the counter's resolution is fine enough for the charge of each phase.
+///
+/// Regions must be entered and left in nested order from a single context,
+/// such as the main loop.
+///
+/// USAGE:
+///
+///    sjsu::EnergyProfiler profiler(fuel_gauge, &fuel_gauge_charge);
+///    profiler.Start();
+///
+///    while (true)
+///    {
+///      {
+///        SJ2_ENERGY_SCOPE(profiler, "measure");
+///        sensor.Measure();
+///      }
+///      {
+///        SJ2_ENERGY_SCOPE(profiler, "transmit");
+///        radio.Send(packet);
+///      }
+///      Delay(1s);
+///    }
+///
+///    profiler.Dump();
+class EnergyProfiler
+{
+ public:
+  /// Enters a region for its lifetime.
+  class Scope
+  {
+   public:
+    /// @param profiler - profiler to attribute the charge with.
+    /// @param region - region entered.
+    Scope(EnergyProfiler & profiler, EnergyRegion & region)
+        : profiler_(profiler), outer_(profiler.Enter(region))
+    {
+    }
+
+    Scope(const Scope &) = delete;
+    Scope & operator=(const Scope &) = delete;
+
+    ~Scope()
+    {
+      profiler_.Leave(outer_);
+    }
+
+   private:
+    EnergyProfiler & profiler_;
+    EnergyRegion & outer_;
+  };
+
+  /// @param counter - coulomb counter that measures the charge used.
+  /// @param battery - state of charge of the battery to also attribute, or
+  ///        null to only use the counter.
+  explicit EnergyProfiler(CoulombCounter & counter,
+                          BatteryCharge * battery = nullptr)
+      : counter_(counter), battery_(battery)
+  {
+  }
+
+  /// Take the first sample, which the first region boundary is measured
+  /// from. The counter and battery must be initialized.
+  void Start()
+  {
+    last_ = Sample();
+  }
+
+  /// @return EnergyRegion & - region that time outside of every marked
+  ///         region is attributed to.
+  EnergyRegion & Unmarked()
+  {
+    return unmarked_;
+  }
+
+  /// Attribute the charge used since the last boundary to the region that
+  /// is running, such as before printing a report.
+  void Update()
+  {
+    AttributeTo(*current_);
+  }
+
+  /// Call `callback` with every region that has been attributed charge by
+  /// this profiler, most recently first attributed first.
+  ///
+  /// @param callback - callable with the signature `void(EnergyRegion &)`.
+  template <typename Callback>
+  void ForEach(Callback && callback)
+  {
+    for (EnergyRegion * region = regions_; region != nullptr;
+         region                = region->next_)
+    {
+      callback(*region);
+    }
+  }
+
+  /// Print the totals of every region through log::Print.
+  void Dump()
+  {
+    Update();
+    ForEach([](const EnergyRegion & region) {
+      log::Print("{}: visits={} charge={}uAh time={}ms current={}uA "
+                 "battery={}%\n",
+                 region.Name(),
+                 region.Visits(),
+                 region.Charge().to<float>(),
+                 std::chrono::duration_cast<std::chrono::milliseconds>(
+                     region.Time())
+                     .count(),
+                 region.AverageCurrent().to<float>(),
+                 region.StateOfCharge() * 100);
+    });
+  }
+
+ private:
+  struct Sample_t
+  {
+    units::charge::microampere_hour_t charge;
+    std::chrono::nanoseconds time;
+    float state_of_charge;
+  };
+
+  Sample_t Sample()
+  {
+    return {
+      .charge          = counter_.GetCharge(),
+      .time            = Uptime(),
+      .state_of_charge = battery_ ? battery_->Read() : 0,
+    };
+  }
+
+  void AttributeTo(EnergyRegion & region)
+  {
+    if (region.profiler_ != this)
+    {
+      region.profiler_ = this;
+      region.next_     = regions_;
+      regions_         = &region;
+    }
+
+    const Sample_t kNow = Sample();
+    region.Attribute(kNow.charge - last_.charge,
+                     kNow.time - last_.time,
+                     last_.state_of_charge - kNow.state_of_charge);
+    last_ = kNow;
+  }
+
+  EnergyRegion & Enter(EnergyRegion & region)
+  {
+    AttributeTo(*current_);
+    EnergyRegion & outer = *current_;
+    current_             = &region;
+    return outer;
+  }
+
+  void Leave(EnergyRegion & outer)
+  {
+    AttributeTo(*current_);
+    current_->CountVisit();
+    current_ = &outer;
+  }
+
+  CoulombCounter & counter_;
+  BatteryCharge * battery_;
+  EnergyRegion unmarked_{ "(unmarked)" };
+  EnergyRegion * current_ = &unmarked_;
+  EnergyRegion * regions_ = nullptr;
+  Sample_t last_          = {};
+};
+}  // namespace sjsu
+
+#define SJ2_ENERGY_CONCAT_HELPER(a, b) a##b
+#define SJ2_ENERGY_CONCAT(a, b) SJ2_ENERGY_CONCAT_HELPER(a, b)
+
+/// Attribute the charge used by the rest of the enclosing scope to a region
+/// named `name`, stored in a static EnergyRegion. At most one use per line.
+///
+/// @param profiler - the sjsu::EnergyProfiler.
+/// @param name - string literal name of the region.
+#define SJ2_ENERGY_SCOPE(profiler, name)                                   \
+  static constinit ::sjsu::EnergyRegion SJ2_ENERGY_CONCAT(                 \
+      sj2_energy_region, __LINE__)(name);                                  \
+  ::sjsu::EnergyProfiler::Scope SJ2_ENERGY_CONCAT(sj2_energy_scope,        \
+                                                  __LINE__)(               \
+      profiler, SJ2_ENERGY_CONCAT(sj2_energy_region, __LINE__))
@@ -0,0 +1,167 @@
+#include <libcore/devices/energy_profiler.hpp>
+
+#include <chrono>
+#include <string_view>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+std::chrono::nanoseconds energy_test_uptime = 0ns;
+
+class SettableCoulombCounter : public CoulombCounter
+{
+ public:
+  void ModuleInitialize() override {}
+
+  units::charge::microampere_hour_t GetCharge() override
+  {
+    return charge;
+  }
+
+  units::charge::microampere_hour_t charge{ 0 };
+};
+
+class SettableBatteryCharge : public BatteryCharge
+{
+ public:
+  void ModuleInitialize() override {}
+
+  float Read() override
+  {
+    return level;
+  }
+
+  float level = 1.0f;
+};
+
+void MarkedPhase(EnergyProfiler & profiler,
+                 SettableCoulombCounter & counter,
+                 float charge)
+{
+  SJ2_ENERGY_SCOPE(profiler, "marked phase");
+  counter.charge += units::charge::microampere_hour_t{ charge };
+  energy_test_uptime += 1ms;
+}
+}  // namespace
+
+TEST_CASE("Testing EnergyProfiler")
+{
+  SetUptimeFunction([]() { return energy_test_uptime; });
+  energy_test_uptime = 0ns;
+  SettableCoulombCounter counter;
+  SettableBatteryCharge battery;
+
+  auto advance = [&counter, &battery](std::chrono::nanoseconds time,
+                                      float charge,
+                                      float level = 1.0f) {
+    energy_test_uptime = time;
+    counter.charge     = units::charge::microampere_hour_t{ charge };
+    battery.level      = level;
+  };
+
+  SECTION("Charge goes to the innermost region that is running")
+  {
+    // Setup
+    EnergyProfiler profiler(counter);
+    EnergyRegion outer("outer");
+    EnergyRegion inner("inner");
+    profiler.Start();
+
+    // Exercise
+    advance(10ms, 1);
+    {
+      EnergyProfiler::Scope outer_scope(profiler, outer);
+      advance(20ms, 3);
+      {
+        EnergyProfiler::Scope inner_scope(profiler, inner);
+        advance(50ms, 9);
+      }
+      advance(60ms, 10);
+    }
+    advance(100ms, 12);
+    profiler.Update();
+
+    // Verify
+    CHECK(3 == outer.Charge().to<float>());
+    CHECK(20ms == outer.Time());
+    CHECK(1 == outer.Visits());
+
+    CHECK(6 == inner.Charge().to<float>());
+    CHECK(30ms == inner.Time());
+    CHECK(1 == inner.Visits());
+    // 6uAh in 30ms is a mean of 720mA.
+    CHECK(720'000 == doctest::Approx(inner.AverageCurrent().to<float>()));
+
+    CHECK(3 == profiler.Unmarked().Charge().to<float>());
+    CHECK(50ms == profiler.Unmarked().Time());
+  }
+
+  SECTION("The battery's state of charge is attributed too")
+  {
+    // Setup
+    EnergyProfiler profiler(counter, &battery);
+    EnergyRegion radio("radio");
+    profiler.Start();
+
+    // Exercise
+    {
+      EnergyProfiler::Scope scope(profiler, radio);
+      advance(1s, 100, 0.75f);
+    }
+    advance(2s, 110, 0.5f);
+    profiler.Update();
+
+    // Verify
+    CHECK(0.25f == doctest::Approx(radio.StateOfCharge()));
+    CHECK(0.25f == doctest::Approx(profiler.Unmarked().StateOfCharge()));
+  }
+
+  SECTION("SJ2_ENERGY_SCOPE() marks a region for each visit")
+  {
+    // Setup
+    EnergyProfiler profiler(counter);
+    profiler.Start();
+
+    // Exercise
+    MarkedPhase(profiler, counter, 2);
+    MarkedPhase(profiler, counter, 4);
+
+    // Verify
+    const EnergyRegion * marked = nullptr;
+    profiler.ForEach([&marked](const EnergyRegion & region) {
+      if (std::string_view("marked phase") == region.Name())
+      {
+        marked = &region;
+      }
+    });
+    REQUIRE(marked != nullptr);
+    CHECK(2 == marked->Visits());
+    CHECK(6 == marked->Charge().to<float>());
+    CHECK(3 == marked->ChargePerVisit().to<float>());
+    CHECK(2ms == marked->Time());
+  }
+
+  SECTION("Reset() clears the totals of a region")
+  {
+    // Setup
+    EnergyRegion region("reset");
+    region.Attribute(units::charge::microampere_hour_t{ 5 }, 1s, 0.1f);
+    region.CountVisit();
+
+    // Exercise
+    region.Reset();
+
+    // Verify
+    CHECK(0 == region.Visits());
+    CHECK(0 == region.Charge().to<float>());
+    CHECK(0ns == region.Time());
+    CHECK(0 == region.AverageCurrent().to<float>());
+    CHECK(0 == region.ChargePerVisit().to<float>());
+  }
+
+  SetUptimeFunction(DefaultUptime);
+}
+}  // namespace sjsu
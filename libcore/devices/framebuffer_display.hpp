@@ -0,0 +1,393 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <libcore/devices/parallel_bus.hpp>
+#include <libcore/devices/pixel_display.hpp>
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/utility/inplace_function.hpp>
+
+namespace sjsu
+{
+/// A PixelDisplay that keeps its framebuffer in RAM, for drivers of panels
+/// that are written to over a bus, such as SPI OLEDs and TFTs.
+///
+/// Drawing only touches RAM. Update() sends the changed area to the panel by
+/// calling the flush handler with contiguous runs of framebuffer bytes, which
+/// DMA capable buses can send straight from the framebuffer. The handler is
+/// given the area of the display the bytes cover, to set the panel's address
+/// window before sending them. Rows are padded to a multiple of 4 bytes, so
+/// they are word aligned for fast fills.
+///
+/// Graphics detects this display through GetFramebuffer() and writes pixels
+/// directly into the framebuffer.
+///
+/// USAGE:
+///
+///    using Format = sjsu::PixelDisplay::PixelFormat;
+///
+///    sjsu::FramebufferDisplay<128, 64, Format::kMonochromePages> display(
+///        [&](sjsu::PixelDisplay::Region_t area,
+///            std::span<const uint8_t> data) {
+///          oled.SetWindow(area);
+///          sjsu::SendFramebuffer(spi, data);
+///        });
+///    sjsu::Graphics graphics(display);
+///
+/// @tparam kWidth - width of the display in pixels.
+/// @tparam kHeight - height of the display in pixels.
+/// @tparam kFormat - layout of the pixels, which should match what the panel
+///         expects to receive.
+template <size_t kWidth, size_t kHeight, PixelDisplay::PixelFormat kFormat>
+class FramebufferDisplay : public PixelDisplay
+{
+ public:
+  static_assert(kFormat != PixelFormat::kNone,
+                "FramebufferDisplay requires a pixel format.");
+
+  /// Number of rows of pixels in a row of the framebuffer. Monochrome
+  /// framebuffers store a page of 8 rows per row of bytes.
+  static constexpr size_t kRowsPerLine =
+      (kFormat == PixelFormat::kMonochromePages) ? 8 : 1;
+  /// Number of bytes used by a pixel, or by a column of a page.
+  static constexpr size_t kBytesPerPixel =
+      (kFormat == PixelFormat::kRgb565)   ? 2
+      : (kFormat == PixelFormat::kRgb888) ? 3
+                                          : 1;
+  /// Number of rows of bytes in the framebuffer.
+  static constexpr size_t kLines = (kHeight + kRowsPerLine - 1) / kRowsPerLine;
+  /// Number of bytes of pixels in a row of the framebuffer.
+  static constexpr size_t kLineBytes = kWidth * kBytesPerPixel;
+  /// Number of bytes from the start of one row of the framebuffer to the next.
+  static constexpr size_t kStride = (kLineBytes + 3) & ~size_t{ 3 };
+
+  /// Called with each contiguous run of bytes to send to the panel.
+  ///
+  /// @param area - the area of the display the bytes cover. Monochrome areas
+  ///        always cover whole pages.
+  /// @param data - the framebuffer bytes of that area, row by row.
+  using FlushHandler =
+      InplaceFunction<void(Region_t area, std::span<const uint8_t> data)>;
+
+  /// @param flush - sends framebuffer bytes to the panel.
+  explicit FramebufferDisplay(FlushHandler flush = nullptr) : flush_(flush) {}
+
+  void ModuleInitialize() override {}
+
+  size_t GetWidth() override
+  {
+    return kWidth;
+  }
+
+  size_t GetHeight() override
+  {
+    return kHeight;
+  }
+
+  Color_t AvailableColors() override
+  {
+    switch (kFormat)
+    {
+      case PixelFormat::kRgb565:
+        return { .red = 5, .green = 6, .blue = 5, .alpha = 0 };
+      case PixelFormat::kRgb888:
+        return { .red = 8, .green = 8, .blue = 8, .alpha = 0 };
+      default: return {};
+    }
+  }
+
+  void Clear() override
+  {
+    buffer_.fill(0);
+  }
+
+  bool Clear(Region_t region) override
+  {
+    if constexpr (kFormat == PixelFormat::kMonochromePages)
+    {
+      ForEachPage(region, [](uint8_t & column, uint8_t rows) {
+        column = static_cast<uint8_t>(column & ~rows);
+      });
+    }
+    else
+    {
+      for (int32_t row = region.y; row < region.Bottom(); row++)
+      {
+        std::fill_n(Line(row) + (region.x * kBytesPerPixel),
+                    region.width * kBytesPerPixel,
+                    uint8_t{ 0 });
+      }
+    }
+    return true;
+  }
+
+  bool Scroll(int32_t rows) override
+  {
+    if constexpr (kFormat == PixelFormat::kMonochromePages)
+    {
+      if (rows % 8 != 0)
+      {
+        return false;
+      }
+    }
+
+    const size_t kMoved = static_cast<size_t>(rows) / kRowsPerLine * kStride;
+    std::copy(buffer_.begin() + kMoved, buffer_.end(), buffer_.begin());
+    std::fill(buffer_.end() - kMoved, buffer_.end(), uint8_t{ 0 });
+    return true;
+  }
+
+  void DrawPixel(int32_t x, int32_t y, Color_t color) override
+  {
+    Memory().DrawPixel(x, y, color);
+  }
+
+  void DrawSpan(int32_t x, int32_t y, int32_t width, Color_t color) override
+  {
+    FillRectangle({ .x = x, .y = y, .width = width, .height = 1 }, color);
+  }
+
+  void FillRectangle(Region_t region, Color_t color) override
+  {
+    if constexpr (kFormat == PixelFormat::kMonochromePages)
+    {
+      ForEachPage(region, [](uint8_t & column, uint8_t rows) {
+        column = static_cast<uint8_t>(column | rows);
+      });
+    }
+    else
+    {
+      // Write the first pixel, then repeat its bytes across the row.
+      for (int32_t row = region.y; row < region.Bottom(); row++)
+      {
+        Memory().DrawPixel(region.x, row, color);
+        uint8_t * first = Line(row) + (region.x * kBytesPerPixel);
+        for (size_t i = kBytesPerPixel; i < region.width * kBytesPerPixel; i++)
+        {
+          first[i] = first[i - kBytesPerPixel];
+        }
+      }
+    }
+  }
+
+  using PixelDisplay::DrawBitmap;
+
+  void DrawBitmap(Region_t region,
+                  std::span<const uint8_t> bitmap,
+                  Color_t color) override
+  {
+    // Read the bitmap a byte of a row at a time, visiting only set pixels.
+    const size_t kBitmapStride  = (static_cast<size_t>(region.width) + 7) / 8;
+    const Framebuffer_t kMemory = Memory();
+
+    for (int32_t row = 0; row < region.height; row++)
+    {
+      for (size_t byte = 0; byte < kBitmapStride; byte++)
+      {
+        const size_t kIndex = (row * kBitmapStride) + byte;
+        if (kIndex >= bitmap.size())
+        {
+          return;
+        }
+
+        for (uint32_t bits = bitmap[kIndex]; bits != 0; bits &= bits - 1)
+        {
+          const auto kColumn =
+              static_cast<int32_t>((byte * 8) + std::countr_zero(bits));
+          if (kColumn < region.width)
+          {
+            kMemory.DrawPixel(region.x + kColumn, region.y + row, color);
+          }
+        }
+      }
+    }
+  }
+
+  void Update() override
+  {
+    Update({ .x      = 0,
+             .y      = 0,
+             .width  = static_cast<int32_t>(kWidth),
+             .height = static_cast<int32_t>(kHeight) });
+  }
+
+  void Update(Region_t region) override
+  {
+    if (!flush_)
+    {
+      return;
+    }
+
+    ForEachRun(region, [this](Region_t area, size_t offset, size_t size) {
+      flush_(area, Buffer().subspan(offset, size));
+    });
+  }
+
+  /// Split the bytes of the framebuffer that hold `region` into contiguous
+  /// runs: a single run when the region spans whole rows without padding,
+  /// otherwise one run per row of bytes.
+  ///
+  /// @param region - area of the display, within its bounds.
+  /// @param callback - called with the area each run covers, the offset of
+  ///        the run in Buffer() and its size in bytes.
+  template <typename Callback>
+  static void ForEachRun(Region_t region, Callback && callback)
+  {
+    if (region.IsEmpty())
+    {
+      return;
+    }
+
+    const size_t kFirst = static_cast<size_t>(region.y) / kRowsPerLine;
+    const size_t kLast =
+        (static_cast<size_t>(region.Bottom()) - 1) / kRowsPerLine;
+    const size_t kOffset = static_cast<size_t>(region.x) * kBytesPerPixel;
+    const size_t kBytes  = static_cast<size_t>(region.width) * kBytesPerPixel;
+
+    // Whole rows without padding are contiguous, so send them at once.
+    if (kBytes == kStride)
+    {
+      callback(LineArea(kFirst, kLast, region),
+               kFirst * kStride,
+               (kLast - kFirst + 1) * kStride);
+      return;
+    }
+
+    for (size_t line = kFirst; line <= kLast; line++)
+    {
+      callback(
+          LineArea(line, line, region), (line * kStride) + kOffset, kBytes);
+    }
+  }
+
+  /// @param region - area of the display, within its bounds.
+  /// @return Region_t - `region` grown to cover whole rows of bytes, which for
+  ///         monochrome framebuffers is whole pages.
+  static Region_t Align(Region_t region)
+  {
+    if (region.IsEmpty())
+    {
+      return {};
+    }
+    return LineArea(static_cast<size_t>(region.y) / kRowsPerLine,
+                    (static_cast<size_t>(region.Bottom()) - 1) / kRowsPerLine,
+                    region);
+  }
+
+  Framebuffer_t GetFramebuffer() override
+  {
+    return Memory();
+  }
+
+  /// @return std::span<const uint8_t> - the whole framebuffer.
+  std::span<const uint8_t> Buffer() const
+  {
+    return buffer_;
+  }
+
+ private:
+  Framebuffer_t Memory()
+  {
+    return Framebuffer_t{
+      .format = kFormat,
+      .data   = buffer_.data(),
+      .stride = kStride,
+    };
+  }
+
+  uint8_t * Line(size_t line)
+  {
+    return &buffer_[line * kStride];
+  }
+
+  /// Call `function` with each byte of the pages `region` covers, along with
+  /// a mask of the rows of that byte within `region`.
+  template <typename Function>
+  void ForEachPage(Region_t region, Function function)
+  {
+    for (int32_t top = region.y & ~7; top < region.Bottom(); top += 8)
+    {
+      const int32_t kFirst = std::max(region.y, top) - top;
+      const int32_t kLast  = std::min(region.Bottom(), top + 8) - top;
+      const auto kRows =
+          static_cast<uint8_t>((0xFF << kFirst) & (0xFF >> (8 - kLast)));
+
+      uint8_t * line = Line(static_cast<size_t>(top) / 8);
+      for (int32_t column = region.x; column < region.Right(); column++)
+      {
+        function(line[column], kRows);
+      }
+    }
+  }
+
+  /// @return Region_t - the columns of `region` within rows of bytes `first`
+  ///         to `last` of the framebuffer.
+  static Region_t LineArea(size_t first, size_t last, Region_t region)
+  {
+    const int32_t kTop    = static_cast<int32_t>(first * kRowsPerLine);
+    const int32_t kBottom = std::min(static_cast<int32_t>(kHeight),
+                                     static_cast<int32_t>((last + 1) *
+                                                          kRowsPerLine));
+    return Region_t{
+      .x      = region.x,
+      .y      = kTop,
+      .width  = region.width,
+      .height = kBottom - kTop,
+    };
+  }
+
+  alignas(uint32_t) std::array<uint8_t, kStride * kLines> buffer_{};
+  FlushHandler flush_;
+};
+
+/// Send framebuffer bytes to a panel over SPI. Uses the const transmit
+/// Transfer(), which DMA capable drivers send directly from the framebuffer.
+///
+/// @param spi - the SPI bus of the panel, with its chip select asserted.
+/// @param data - bytes given to a FramebufferDisplay's flush handler.
+inline void SendFramebuffer(Spi & spi, std::span<const uint8_t> data)
+{
+  spi.Transfer(data, std::span<uint8_t>{});
+}
+
+/// Send framebuffer bytes to a panel over an 8080 style parallel bus, which
+/// latches each word on the rising edge of its write strobe. Buses 16 or more
+/// bits wide are sent two bytes per word, the first byte in the upper half.
+///
+/// @param bus - data lines of the panel, set as outputs.
+/// @param write_strobe - the panel's active low write strobe pin.
+/// @param data - bytes given to a FramebufferDisplay's flush handler.
+inline void SendFramebuffer(ParallelBus & bus,
+                            Gpio & write_strobe,
+                            std::span<const uint8_t> data)
+{
+  const size_t kBytesPerWord = (bus.BusWidth() >= 16) ? 2 : 1;
+
+  // Send the words in batches, so buses can write several words per call.
+  std::array<uint16_t, 32> words;
+  size_t count = 0;
+  for (size_t i = 0; i < data.size(); i += kBytesPerWord)
+  {
+    uint32_t word = data[i];
+    if (kBytesPerWord == 2)
+    {
+      const uint32_t kLow = (i + 1 < data.size()) ? data[i + 1] : 0;
+      word                = (word << 8) | kLow;
+    }
+
+    words[count++] = static_cast<uint16_t>(word);
+    if (count == words.size())
+    {
+      bus.Write(words, write_strobe);
+      count = 0;
+    }
+  }
+  bus.Write(std::span<const uint16_t>(words.data(), count), write_strobe);
+}
+}  // namespace sjsu
@@ -0,0 +1,218 @@
+#include <libcore/devices/framebuffer_display.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <libcore/systems/graphics.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+using Format = PixelDisplay::PixelFormat;
+
+struct Flush_t
+{
+  PixelDisplay::Region_t area;
+  size_t offset;
+  size_t size;
+};
+}  // namespace
+
+TEST_CASE("Testing FramebufferDisplay")
+{
+  std::vector<Flush_t> flushes;
+
+  SECTION("Monochrome pixels are stored as pages of columns")
+  {
+    // Setup
+    FramebufferDisplay<10, 16, Format::kMonochromePages> display;
+
+    // Exercise
+    display.DrawPixel(3, 0, {});
+    display.DrawPixel(3, 9, {});
+
+    // Verify
+    // 10 byte pages are padded to 12 bytes.
+    static_assert(12 == decltype(display)::kStride);
+    CHECK(0b0000'0001 == display.Buffer()[3]);
+    CHECK(0b0000'0010 == display.Buffer()[12 + 3]);
+  }
+
+  SECTION("Monochrome fills and clears set whole pages at once")
+  {
+    // Setup
+    FramebufferDisplay<8, 16, Format::kMonochromePages> display;
+
+    // Exercise
+    display.FillRectangle({ .x = 1, .y = 6, .width = 2, .height = 4 }, {});
+    display.Clear({ .x = 2, .y = 7, .width = 1, .height = 1 });
+
+    // Verify
+    CHECK(0b1100'0000 == display.Buffer()[1]);
+    CHECK(0b0100'0000 == display.Buffer()[2]);
+    CHECK(0b0000'0011 == display.Buffer()[8 + 1]);
+    CHECK(0b0000'0011 == display.Buffer()[8 + 2]);
+  }
+
+  SECTION("RGB565 pixels are stored most significant byte first")
+  {
+    // Setup
+    FramebufferDisplay<4, 2, Format::kRgb565> display;
+
+    // Exercise
+    display.FillRectangle({ .x = 1, .y = 1, .width = 2, .height = 1 },
+                          { .red = 0x1F, .green = 0, .blue = 0x01 });
+
+    // Verify
+    CHECK(0xF8 == display.Buffer()[8 + 2]);
+    CHECK(0x01 == display.Buffer()[8 + 3]);
+    CHECK(0xF8 == display.Buffer()[8 + 4]);
+    CHECK(0x01 == display.Buffer()[8 + 5]);
+    CHECK(0x00 == display.Buffer()[8 + 6]);
+  }
+
+  SECTION("RGB888 pixels are stored as red, green then blue")
+  {
+    // Setup
+    FramebufferDisplay<2, 1, Format::kRgb888> display;
+
+    // Exercise
+    display.DrawPixel(1, 0, { .red = 1, .green = 2, .blue = 3 });
+
+    // Verify
+    static_assert(8 == decltype(display)::kStride);
+    CHECK(1 == display.Buffer()[3]);
+    CHECK(2 == display.Buffer()[4]);
+    CHECK(3 == display.Buffer()[5]);
+  }
+
+  SECTION("Update() of whole rows is a single flush")
+  {
+    // Setup
+    FramebufferDisplay<8, 32, Format::kMonochromePages> display(
+        [&](PixelDisplay::Region_t area, std::span<const uint8_t> data) {
+          flushes.push_back({ area, 0, data.size() });
+        });
+
+    // Exercise
+    display.Update({ .x = 0, .y = 3, .width = 8, .height = 10 });
+
+    // Verify
+    REQUIRE(1 == flushes.size());
+    CHECK(flushes[0].area ==
+          PixelDisplay::Region_t{ .x = 0, .y = 0, .width = 8, .height = 16 });
+    CHECK(16 == flushes[0].size);
+  }
+
+  SECTION("Update() of part of the rows flushes each row")
+  {
+    // Setup
+    const uint8_t * start = nullptr;
+    FramebufferDisplay<4, 3, Format::kRgb565> display(
+        [&](PixelDisplay::Region_t area, std::span<const uint8_t> data) {
+          const auto kOffset = static_cast<size_t>(data.data() - start);
+          flushes.push_back({ area, kOffset, data.size() });
+        });
+    start = display.Buffer().data();
+
+    // Exercise
+    display.Update({ .x = 1, .y = 1, .width = 2, .height = 2 });
+
+    // Verify
+    REQUIRE(2 == flushes.size());
+    CHECK(flushes[0].area ==
+          PixelDisplay::Region_t{ .x = 1, .y = 1, .width = 2, .height = 1 });
+    CHECK(8 + 2 == flushes[0].offset);
+    CHECK(4 == flushes[0].size);
+    CHECK(16 + 2 == flushes[1].offset);
+  }
+
+  SECTION("Scroll() moves rows up and clears the bottom")
+  {
+    // Setup
+    FramebufferDisplay<4, 16, Format::kMonochromePages> display;
+    display.DrawPixel(0, 9, {});
+
+    // Exercise
+    bool scrolled_by_page = display.Scroll(8);
+    bool scrolled_by_row  = display.Scroll(1);
+
+    // Verify
+    CHECK(scrolled_by_page);
+    CHECK(!scrolled_by_row);
+    CHECK(0b0000'0010 == display.Buffer()[0]);
+    CHECK(0 == display.Buffer()[4]);
+  }
+
+  SECTION("Graphics writes into the framebuffer directly")
+  {
+    // Setup
+    class CountingDisplay
+        : public FramebufferDisplay<8, 8, Format::kMonochromePages>
+    {
+     public:
+      void DrawPixel(int32_t x, int32_t y, Color_t color) override
+      {
+        draw_pixel_calls++;
+        FramebufferDisplay::DrawPixel(x, y, color);
+      }
+      int draw_pixel_calls = 0;
+    } display;
+    Graphics graphics(display);
+
+    // Exercise
+    graphics.DrawPixel(2, 1);
+
+    // Verify
+    CHECK(0 == display.draw_pixel_calls);
+    CHECK(0b0000'0010 == display.Buffer()[2]);
+  }
+
+  SECTION("Glyphs are written in columns, whether aligned to a page or not")
+  {
+    // Setup
+    using Display = FramebufferDisplay<16, 24, Format::kMonochromePages>;
+    Display display;
+    Display expected;
+    Graphics graphics(display);
+    graphics.SetFont(font::kBasicColumns);
+    const auto & glyph = *font::kBasic.Find(U'g');
+
+    // Exercise
+    graphics.DrawCharacter(0, 0, 'g');
+    graphics.DrawCharacter(5, 11, 'g');
+
+    // Verify
+    expected.DrawBitmap(
+        { .x = 0, .y = 0, .width = 8, .height = 8 }, glyph, {});
+    expected.DrawBitmap(
+        { .x = 5, .y = 11, .width = 8, .height = 8 }, glyph, {});
+    CHECK(std::equal(display.Buffer().begin(),
+                     display.Buffer().end(),
+                     expected.Buffer().begin()));
+    CHECK(graphics.GetDirtyRegion() ==
+          PixelDisplay::Region_t{ .x = 0, .y = 0, .width = 13, .height = 19 });
+  }
+
+  SECTION("Fonts in the row layout are drawn the same way")
+  {
+    // Setup
+    using Display = FramebufferDisplay<16, 16, Format::kMonochromePages>;
+    Display rows;
+    Display columns;
+    Graphics rows_graphics(rows);
+    Graphics columns_graphics(columns);
+    columns_graphics.SetFont(font::kBasicColumns);
+
+    // Exercise
+    rows_graphics.DrawCharacter(3, 2, 'Q');
+    columns_graphics.DrawCharacter(3, 2, 'Q');
+
+    // Verify
+    CHECK(std::equal(
+        rows.Buffer().begin(), rows.Buffer().end(), columns.Buffer().begin()));
+  }
+}
+}  // namespace sjsu
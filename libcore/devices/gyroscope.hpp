@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <libcore/module.hpp>
+#include <libcore/utility/math/units.hpp>
+
+namespace sjsu
+{
+/// Generic settings for a standard Gyroscope device
+struct GyroscopeSettings_t
+{
+  /// The maximum absolute angular velocity that can be read by the gyroscope.
+  /// As with AccelerometerSettings_t::gravity, a smaller full scale gives
+  /// more precise measurements of slower rotations.
+  units::angular_velocity::degrees_per_second_t full_scale =
+      units::angular_velocity::degrees_per_second_t(250);
+
+  /// Number of samples the device should collect in its FIFO before raising
+  /// its watermark interrupt. See AccelerometerSettings_t::fifo_watermark.
+  uint32_t fifo_watermark = 0;
+};
+
+/// @ingroup movement
+/// Abstract interface for devices that behave as gyroscopes, which measure the
+/// rate of rotation about their X, Y and Z axes.
+class Gyroscope : public Module<GyroscopeSettings_t>
+{
+ public:
+  /// Rate of rotation about each axis, counter clockwise when looking down
+  /// the axis towards the origin.
+  struct AngularVelocity_t
+  {
+    /// Rotation about the x axis
+    units::angular_velocity::radians_per_second_t x;
+    /// Rotation about the y axis
+    units::angular_velocity::radians_per_second_t y;
+    /// Rotation about the z axis
+    units::angular_velocity::radians_per_second_t z;
+  };
+
+  /// Read the rate of rotation about each axis.
+  ///
+  /// @return AngularVelocity_t - rate of rotation about the X, Y and Z axis.
+  virtual AngularVelocity_t Read() = 0;
+
+  /// Read a batch of samples. Drivers for devices with a FIFO override this to
+  /// drain the FIFO in a single burst. The default implementation calls Read()
+  /// for each sample.
+  ///
+  /// @param samples - buffer to fill, oldest sample first.
+  /// @return size_t - number of samples read.
+  virtual size_t Read(std::span<AngularVelocity_t> samples)
+  {
+    for (auto & sample : samples)
+    {
+      sample = Read();
+    }
+    return samples.size();
+  }
+};
+}  // namespace sjsu
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 
 #include <libcore/module.hpp>
@@ -21,5 +23,24 @@ class InfraredReceiver : public Module<>
   ///
   /// @param handler Callback handler to invoke.
   virtual void SetInterruptCallback(DataReceivedHandler handler) = 0;
+
+  /// Callback handler that is invoked with each pulse as soon as it has been
+  /// captured, with its duration in microseconds and its index within the
+  /// frame, where index 0 is the header mark of a new frame.
+  using PulseReceivedHandler =
+      std::function<void(uint16_t duration, size_t index)>;
+
+  /// Sets the callback handler that is invoked with each captured pulse, for
+  /// decoding frames as they arrive with a streaming decoder such as
+  /// infrared::PulseDurationDecoder.
+  ///
+  /// The default implementation does not support pulse callbacks.
+  ///
+  /// @param handler Callback handler to invoke.
+  /// @return true - if the receiver supports pulse callbacks.
+  virtual bool SetPulseCallback([[maybe_unused]] PulseReceivedHandler handler)
+  {
+    return false;
+  }
 };
 }  // namespace sjsu
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <libcore/module.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
 #include <span>
 #include <string_view>
@@ -26,6 +28,22 @@ class InternetSocket : public Module<>
     kUDP,
   };
 
+  /// Changes in the state of the socket reported to a ReadinessHandler.
+  enum class Readiness : uint8_t
+  {
+    /// Received data can be read without waiting.
+    kReadable,
+    /// Data can be sent without waiting.
+    kWritable,
+    /// The connection was closed by the remote host or was lost.
+    kClosed,
+  };
+
+  /// Called when the state of the socket changes. May be called from an
+  /// interrupt or from the driver's receive task, so should only record the
+  /// change or wake the task handling the socket.
+  using ReadinessHandler = InplaceFunction<void(Readiness readiness)>;
+
   /// Establishes a direct communication link to a specific remote host
   /// identified by its address, port, and the communication protocol.
   ///
@@ -59,6 +77,93 @@ class InternetSocket : public Module<>
 
   /// Closes the connection established by the Connect() method.
   virtual void Close() = 0;
+
+  /// Check that the connection is still established, such as before reusing
+  /// an idle connection. Drivers that can tell should override this method.
+  ///
+  /// @return true - if the connection has not been closed or lost. The
+  ///         default implementation cannot tell, so always returns true.
+  virtual bool IsConnected()
+  {
+    return true;
+  }
+
+  /// Send several buffers as one message, such as a header and a body,
+  /// without copying them into one buffer first. Drivers that can queue the
+  /// buffers in one send command should override this method.
+  ///
+  /// The default implementation calls Write() for each buffer in order.
+  ///
+  /// @param buffers - the buffers to send, one after the other.
+  /// @param timeout - Amount of time before this function should gives up.
+  virtual void Write(std::span<const std::span<const uint8_t>> buffers,
+                     std::chrono::nanoseconds timeout)
+  {
+    for (const auto & buffer : buffers)
+    {
+      Write(buffer, timeout);
+    }
+  }
+
+  /// Send as much of `data` as can be sent without waiting. Drivers with a
+  /// send buffer should override this method.
+  ///
+  /// The default implementation performs a blocking Write() of all of
+  /// `data`, which allows code written against the non-blocking API to work
+  /// with blocking drivers.
+  ///
+  /// @param data - data to send.
+  /// @return size_t - number of bytes from the start of `data` that were
+  ///         sent or queued. Send the rest once kWritable is reported.
+  virtual size_t Send(std::span<const uint8_t> data)
+  {
+    Write(data, std::chrono::nanoseconds::max());
+    return data.size();
+  }
+
+  /// Copy out the data that has been received, without waiting.
+  ///
+  /// @param buffer - where to copy the received data.
+  /// @return size_t - number of bytes copied, 0 if nothing has been
+  ///         received.
+  virtual size_t Receive(std::span<uint8_t> buffer)
+  {
+    return Read(buffer, std::chrono::nanoseconds(0));
+  }
+
+  /// Ask to be told when the socket becomes readable or writable, or is
+  /// closed, so that Send() and Receive() can be retried without polling.
+  ///
+  /// @param handler - called when the state of the socket changes. Pass
+  ///        nullptr to stop being told.
+  /// @return true - if the driver will call the handler.
+  /// @return false - if the driver does not support readiness callbacks, in
+  ///         which case the socket must be polled.
+  virtual bool SetReadinessHandler(
+      [[maybe_unused]] ReadinessHandler handler)
+  {
+    return false;
+  }
+
+  /// Get the received data in place, within the driver's own receive
+  /// buffer, rather than copying it out with Read(). Drivers that buffer
+  /// received data should override this method and ConsumeReceived().
+  ///
+  /// @return std::span<const uint8_t> - the largest contiguous region of
+  ///         received data, which stays valid until ConsumeReceived(). May be
+  ///         shorter than all of the received data. The default
+  ///         implementation returns an empty span, in which case Read() or
+  ///         Receive() must be used.
+  virtual std::span<const uint8_t> PeekReceived()
+  {
+    return {};
+  }
+
+  /// Return the start of the region returned by PeekReceived() to the
+  /// driver, which may then reuse it.
+  ///
+  /// @param count - number of bytes to release.
+  virtual void ConsumeReceived([[maybe_unused]] size_t count) {}
 };
 
 /// An interface for devices that can communicate wirelessly via the Wifi
@@ -0,0 +1,84 @@
+#include <libcore/devices/internet_socket.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// A blocking socket that records what is written.
+class BlockingSocket : public InternetSocket
+{
+ public:
+  void ModuleInitialize() override {}
+  bool Connect(Protocol, std::string_view, uint16_t,
+               std::chrono::nanoseconds) override
+  {
+    return true;
+  }
+  void Write(std::span<const uint8_t> data, std::chrono::nanoseconds) override
+  {
+    writes.emplace_back(data.begin(), data.end());
+  }
+  size_t Read(std::span<uint8_t> buffer,
+              std::chrono::nanoseconds timeout) override
+  {
+    last_read_timeout = timeout;
+    buffer[0]         = 0x42;
+    return 1;
+  }
+  void Close() override {}
+
+  using InternetSocket::Write;
+
+  std::vector<std::vector<uint8_t>> writes;
+  std::chrono::nanoseconds last_read_timeout = std::chrono::nanoseconds::max();
+};
+}  // namespace
+
+TEST_CASE("Testing InternetSocket Interface")
+{
+  BlockingSocket test_subject;
+
+  SECTION("Writing a list of buffers writes each in order")
+  {
+    // Setup
+    const uint8_t kHeader[] = { 'H', ':' };
+    const uint8_t kBody[]   = { 'b' };
+    const std::span<const uint8_t> kBuffers[] = { kHeader, kBody };
+
+    // Exercise
+    test_subject.Write(kBuffers, std::chrono::milliseconds(10));
+
+    // Verify
+    CHECK(test_subject.writes ==
+          std::vector<std::vector<uint8_t>>{ { 'H', ':' }, { 'b' } });
+  }
+
+  SECTION("Blocking drivers send all data and receive without waiting")
+  {
+    // Setup
+    const uint8_t kData[] = { 1, 2, 3 };
+    uint8_t buffer[4];
+
+    // Exercise
+    size_t sent     = test_subject.Send(kData);
+    size_t received = test_subject.Receive(buffer);
+
+    // Verify
+    CHECK(3 == sent);
+    CHECK(1 == received);
+    CHECK(std::chrono::nanoseconds(0) == test_subject.last_read_timeout);
+  }
+
+  SECTION("Optional capabilities are off by default")
+  {
+    // Exercise & Verify
+    CHECK(!test_subject.SetReadinessHandler(
+        [](InternetSocket::Readiness) {}));
+    CHECK(test_subject.PeekReceived().empty());
+  }
+}
+}  // namespace sjsu
@@ -5,13 +5,16 @@
 #include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <span>
 #include <type_traits>
 #include <utility>
 
 #include <libcore/peripherals/i2c.hpp>
+#include <libcore/peripherals/spi_bus.hpp>
 #include <libcore/utility/math/byte.hpp>
 #include <libcore/utility/enum.hpp>
+#include <libcore/utility/result.hpp>
 
 namespace sjsu
 {
@@ -368,6 +371,30 @@ class MemoryAccessProtocol
   virtual void Read(std::span<const uint8_t> address,
                     std::span<uint8_t> payload) = 0;
 
+  /// Write to a register without throwing. Protocols whose transport can
+  /// report errors without throwing, such as I2cProtocol, should override this
+  /// method. The default implementation captures the error thrown by Write().
+  ///
+  /// @param address - Register address to write to
+  /// @param payload - bytes in this buffer to be written into the register
+  /// @return Result<void> - the error of the write, if any.
+  virtual Result<void> TryWrite(std::span<const uint8_t> address,
+                                std::span<const uint8_t> payload)
+  {
+    return Capture([this, address, payload]() { Write(address, payload); });
+  }
+
+  /// Read from a register without throwing. See TryWrite().
+  ///
+  /// @param address - Register address to read from
+  /// @param payload - buffer for bytes read from the register will be stored
+  /// @return Result<void> - the error of the read, if any.
+  virtual Result<void> TryRead(std::span<const uint8_t> address,
+                               std::span<uint8_t> payload)
+  {
+    return Capture([this, address, payload]() { Read(address, payload); });
+  }
+
   // ===========================================================================
   // Class Methods
   // ===========================================================================
@@ -388,6 +415,26 @@ class MemoryAccessProtocol
   {
     return AccessHandler(*this, device_register);
   }
+
+ protected:
+  /// Convert an address to an integer, keeping only its `width` least
+  /// significant bytes, so that caches of device registers key each register
+  /// by the address the device is configured to use.
+  ///
+  /// @param endianness - endianness of `address`.
+  /// @param address - bytes of the address.
+  /// @param width - address width of the device in bytes.
+  /// @return uint32_t - the address as an integer.
+  static uint32_t AddressToInteger(std::endian endianness,
+                                   std::span<const uint8_t> address,
+                                   size_t width)
+  {
+    const size_t kWidth = std::min(address.size(), width);
+    return ToInteger<uint32_t>(endianness,
+                               (endianness == std::endian::big)
+                                   ? address.last(kWidth)
+                                   : address.first(kWidth));
+  }
 };  // namespace sjsu
 
 // TODO(#1330): Not implemented
@@ -442,8 +489,9 @@ class MockProtocol<MemoryAccessProtocol::AddressWidth::kByte2>
 
 /// Generic MemoryAccessProtocol for common I2C devices
 ///
-/// @tparam MaximumPayloadSize - The size of register in bytes.
-template <size_t MaximumPayloadSize = 1>
+/// Writes send the register address and the payload as one gather write with
+/// I2c::WriteGather(), so payloads of any length are written without copying
+/// them into an intermediate buffer.
 class I2cProtocol : public MemoryAccessProtocol
 {
  public:
@@ -457,34 +505,624 @@ class I2cProtocol : public MemoryAccessProtocol
   void Write(std::span<const uint8_t> address,
              std::span<const uint8_t> value) override
   {
-    constexpr auto kAddressSize = MemoryAccessProtocol::kAddressSizeLimit;
-    constexpr auto kBufferSize  = kAddressSize + MaximumPayloadSize;
+    i2c_.Write(i2c_address_, address, value);
+  }
+
+  void Read(std::span<const uint8_t> address,
+            std::span<uint8_t> receive) override
+  {
+    i2c_.WriteThenRead(i2c_address_, address, receive);
+  }
+
+  Result<void> TryWrite(std::span<const uint8_t> address,
+                        std::span<const uint8_t> value) override
+  {
+    return i2c_.TryWrite(i2c_address_, address, value);
+  }
+
+  Result<void> TryRead(std::span<const uint8_t> address,
+                       std::span<uint8_t> receive) override
+  {
+    return i2c_.TryWriteThenRead(i2c_address_, address, receive);
+  }
+
+ private:
+  uint8_t i2c_address_;
+  sjsu::I2c & i2c_;
+};
+
+/// Generic MemoryAccessProtocol for register mapped SPI devices such as IMUs
+/// and radio transceivers.
+///
+/// Each access is a single chip select assertion made up of an address phase
+/// followed by a data phase. Most SPI devices mark the direction of the access
+/// and whether the register address should auto-increment using flag bits in
+/// the first byte of the address phase. These are configured with
+/// SpiProtocol::Convention_t. Accesses larger than 1 byte set the auto
+/// increment flag, turning them into burst accesses across consecutive
+/// registers.
+class SpiProtocol : public MemoryAccessProtocol
+{
+ public:
+  /// Flag bits that are OR'd into the first byte of the address phase.
+  struct Convention_t
+  {
+    /// Flag set for read accesses. Most devices use the MSB.
+    uint8_t read_flag = 0x80;
+
+    /// Flag set for write accesses. Most devices use no flag.
+    uint8_t write_flag = 0x00;
+
+    /// Flag set for accesses longer than 1 byte to make the device increment
+    /// its register address after each byte, for example 0x40 on many
+    /// STMicroelectronics sensors. Leave 0 for devices that always increment.
+    uint8_t increment_flag = 0x00;
+  };
+
+  /// @param device - the device on a SpiBus to communicate with. The
+  ///        SpiDevice handles the chip select and bus settings.
+  /// @param convention - flags used to indicate read/write and burst accesses.
+  SpiProtocol(sjsu::SpiDevice & device, Convention_t convention)
+      : device_(device), convention_(convention)
+  {
+  }
+
+  /// Use the default Convention_t, with the MSB of the address marking reads.
+  ///
+  /// @param device - the device on a SpiBus to communicate with.
+  explicit SpiProtocol(sjsu::SpiDevice & device)
+      : SpiProtocol(device, Convention_t{})
+  {
+  }
+
+  void Write(std::span<const uint8_t> address,
+             std::span<const uint8_t> payload) override
+  {
+    auto address_phase = BuildAddressPhase(
+        address, convention_.write_flag, payload.size());
+
+    device_.Transfer({
+        Spi::Segment_t{ .transmit = address_phase },
+        Spi::Segment_t{ .transmit = payload },
+    });
+  }
+
+  void Read(std::span<const uint8_t> address,
+            std::span<uint8_t> payload) override
+  {
+    auto address_phase =
+        BuildAddressPhase(address, convention_.read_flag, payload.size());
+
+    device_.Transfer({
+        Spi::Segment_t{ .transmit = address_phase },
+        Spi::Segment_t{ .receive = payload },
+    });
+  }
+
+ private:
+  /// Fixed size storage for the address phase of a transfer.
+  struct AddressPhase_t
+  {
+    std::array<uint8_t, kAddressSizeLimit> buffer;
+    size_t length;
 
-    if (address.size() + value.size() >= kBufferSize)
+    operator std::span<const uint8_t>() const
     {
-      throw Exception(
-          std::errc::not_enough_memory,
-          "I2cProtocol Object does not have enough buffer storage to "
-          "perform this write operation.");
+      return std::span<const uint8_t>(buffer.data(), length);
     }
+  };
 
-    std::array<uint8_t, kBufferSize> buffer;
+  AddressPhase_t BuildAddressPhase(std::span<const uint8_t> address,
+                                   uint8_t direction_flag,
+                                   size_t payload_length) const
+  {
+    AddressPhase_t phase{};
+    phase.length = std::min(address.size(), phase.buffer.size());
+    std::copy_n(address.begin(), phase.length, phase.buffer.begin());
 
-    std::copy(address.begin(), address.end(), buffer.begin());
-    std::copy(value.begin(), value.end(), buffer.begin() + address.size());
+    if (phase.length > 0)
+    {
+      phase.buffer[0] |= direction_flag;
+      if (payload_length > 1)
+      {
+        phase.buffer[0] |= convention_.increment_flag;
+      }
+    }
 
-    i2c_.Write(i2c_address_, buffer);
+    return phase;
+  }
+
+  sjsu::SpiDevice & device_;
+  Convention_t convention_;
+};
+
+/// Batches accesses to a MemoryAccessProtocol in order to reduce the number of
+/// bus transactions needed to configure a device.
+///
+/// While the batch is alive, writes are stored in a small cache rather than
+/// being sent to the device, and reads of bytes that are in the cache are
+/// served from it. Read-modify-write operations such as `|=` therefore only
+/// read a register over the bus once and write it once. When the batch is
+/// flushed, either explicitly with Flush() or when it goes out of scope, all
+/// written bytes are sent to the device and runs of written bytes at
+/// consecutive addresses are merged into a single burst write.
+///
+/// Only use a batch with registers that can be written with a burst of
+/// consecutive addresses (most sensors auto-increment their register pointer)
+/// and whose values do not change on their own while the batch is active.
+///
+/// Usage:
+///
+///    {
+///      MemoryAccessBatch batch(device_protocol, kSpecification);
+///      batch[kControl1] = 0x57;
+///      batch[kControl2] |= 0x80;
+///      batch[kControl3] = 0x00;
+///    }  // kControl1..3 written in one burst here
+///
+/// @tparam kCapacity - number of register bytes the batch can cache. If a
+///         write does not fit, the batch is flushed early.
+template <size_t kCapacity = 32>
+class MemoryAccessBatch : public MemoryAccessProtocol
+{
+ public:
+  /// @param protocol - the protocol to perform the bus transactions with.
+  /// @param specification - address width and endianness of the addresses used
+  ///        with this batch.
+  template <AddressWidth address_width, std::endian endianness>
+  MemoryAccessBatch(MemoryAccessProtocol & protocol,
+                    Specification_t<address_width, endianness> specification)
+      : protocol_(protocol),
+        address_width_(Value(specification.AddressWidth())),
+        endianness_(specification.Endianness()),
+        uncaught_exceptions_(std::uncaught_exceptions())
+  {
+  }
+
+  MemoryAccessBatch(const MemoryAccessBatch &) = delete;
+  MemoryAccessBatch & operator=(const MemoryAccessBatch &) = delete;
+
+  /// Flushes any pending writes. Pending writes are discarded instead if the
+  /// batch is being destroyed because of an exception, since a second
+  /// exception would terminate the program. Call Flush() explicitly to handle
+  /// bus errors before the batch goes out of scope.
+  ~MemoryAccessBatch() noexcept(false)
+  {
+    if (std::uncaught_exceptions() == uncaught_exceptions_)
+    {
+      Flush();
+    }
+  }
+
+  void Write(std::span<const uint8_t> address,
+             std::span<const uint8_t> payload) override
+  {
+    const uint32_t kStart = ToAddress(address);
+
+    if (payload.size() > kCapacity)
+    {
+      // Too large to ever fit in the cache, so pending writes are sent first,
+      // to keep the writes in order, and then this one is written directly.
+      Flush();
+      Discard();
+      protocol_.Write(address, payload);
+      return;
+    }
+
+    if (!HasRoomFor(kStart, payload.size()))
+    {
+      Flush();
+      Discard();
+    }
+
+    for (size_t i = 0; i < payload.size(); i++)
+    {
+      Store(kStart + i, payload[i], true);
+    }
   }
 
   void Read(std::span<const uint8_t> address,
-            std::span<uint8_t> receive) override
+            std::span<uint8_t> payload) override
   {
-    i2c_.WriteThenRead(i2c_address_, address, receive);
+    const uint32_t kStart = ToAddress(address);
+
+    // Serve the read from the cache if every byte is cached.
+    bool all_cached = true;
+    for (size_t i = 0; i < payload.size() && all_cached; i++)
+    {
+      if (auto * entry = Find(kStart + i))
+      {
+        payload[i] = entry->value;
+      }
+      else
+      {
+        all_cached = false;
+      }
+    }
+
+    if (all_cached)
+    {
+      return;
+    }
+
+    // Otherwise read the whole range in one transaction, then overlay any
+    // bytes that have been written in this batch, as they are newer than the
+    // contents of the device.
+    protocol_.Read(address, payload);
+
+    for (size_t i = 0; i < payload.size(); i++)
+    {
+      if (auto * entry = Find(kStart + i))
+      {
+        payload[i] = entry->value;
+      }
+    }
+
+    // Remember the bytes that were read so that a following write to the same
+    // register does not need to read it again.
+    if (HasRoomFor(kStart, payload.size()))
+    {
+      for (size_t i = 0; i < payload.size(); i++)
+      {
+        if (Find(kStart + i) == nullptr)
+        {
+          Store(kStart + i, payload[i], false);
+        }
+      }
+    }
+  }
+
+  /// Send every pending write to the device. Consecutive written bytes are
+  /// combined into a single write. Cached bytes remain valid afterwards.
+  void Flush()
+  {
+    size_t index = 0;
+
+    while (index < count_)
+    {
+      if (!entries_[index].dirty)
+      {
+        index++;
+        continue;
+      }
+
+      // Extend the run while the next entry is dirty and directly follows the
+      // previous one in the address space.
+      size_t end = index + 1;
+      while (end < count_ && entries_[end].dirty &&
+             entries_[end].address == entries_[end - 1].address + 1)
+      {
+        end++;
+      }
+
+      std::array<uint8_t, kCapacity> burst;
+      for (size_t i = index; i < end; i++)
+      {
+        burst[i - index] = entries_[i].value;
+      }
+
+      const auto kAddressBytes =
+          ToByteArray<uint32_t, kAddressSizeLimit>(endianness_,
+                                                   entries_[index].address);
+      protocol_.Write(
+          ByteArrayToSpan(endianness_, kAddressBytes, address_width_),
+          std::span<const uint8_t>(burst.data(), end - index));
+
+      for (size_t i = index; i < end; i++)
+      {
+        entries_[i].dirty = false;
+      }
+
+      index = end;
+    }
+  }
+
+  /// Drop every cached byte, including writes that have not been flushed.
+  void Discard()
+  {
+    count_ = 0;
+  }
+
+  /// @return size_t - number of bytes currently held in the cache.
+  size_t CachedBytes() const
+  {
+    return count_;
   }
 
  private:
-  uint8_t i2c_address_;
-  sjsu::I2c & i2c_;
+  struct Entry_t
+  {
+    uint32_t address;
+    uint8_t value;
+    bool dirty;
+  };
+
+  uint32_t ToAddress(std::span<const uint8_t> address) const
+  {
+    return AddressToInteger(endianness_, address, address_width_);
+  }
+
+  Entry_t * Find(uint32_t address)
+  {
+    auto * end      = entries_.data() + count_;
+    auto * position = LowerBound(address);
+    if (position != end && position->address == address)
+    {
+      return position;
+    }
+    return nullptr;
+  }
+
+  Entry_t * LowerBound(uint32_t address)
+  {
+    return std::lower_bound(entries_.data(),
+                            entries_.data() + count_,
+                            address,
+                            [](const Entry_t & entry, uint32_t key) {
+                              return entry.address < key;
+                            });
+  }
+
+  /// @return true - if the bytes from address to address + length can be
+  ///         stored without exceeding the capacity of the cache.
+  bool HasRoomFor(uint32_t address, size_t length)
+  {
+    size_t new_entries = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+      if (Find(address + i) == nullptr)
+      {
+        new_entries++;
+      }
+    }
+    return count_ + new_entries <= kCapacity;
+  }
+
+  /// Insert or update a cached byte. The caller must ensure there is room.
+  void Store(uint32_t address, uint8_t value, bool dirty)
+  {
+    Entry_t * position = LowerBound(address);
+    Entry_t * end      = entries_.data() + count_;
+
+    if (position != end && position->address == address)
+    {
+      position->value = value;
+      position->dirty = position->dirty || dirty;
+      return;
+    }
+
+    std::copy_backward(position, end, end + 1);
+    *position = Entry_t{ .address = address, .value = value, .dirty = dirty };
+    count_++;
+  }
+
+  MemoryAccessProtocol & protocol_;
+  size_t address_width_;
+  std::endian endianness_;
+  int uncaught_exceptions_;
+  std::array<Entry_t, kCapacity> entries_;
+  size_t count_ = 0;
+};
+
+/// Keeps a RAM copy of selected device registers so that reading them does not
+/// require a bus transaction.
+///
+/// Registers are opted in with Track(). Every write made through the cache is
+/// written through to the device and also remembered for any tracked bytes.
+/// Reads of tracked bytes with a known value are served from RAM, which also
+/// works for write-only registers that cannot be read back from the device.
+/// This makes read-modify-write operators, such as `|=`, on configuration
+/// registers cost a single bus write. Reads that include untracked bytes are
+/// always performed on the device.
+///
+/// Only track registers whose value cannot be changed by the device itself,
+/// such as configuration registers. Never track status or data registers.
+///
+/// Usage:
+///
+///    ShadowCacheProtocol cache(device_protocol, kSpecification);
+///    cache.Track(kControl1);
+///    cache.Track(kControl2);
+///    cache[kControl1] = 0x10;   // 1 bus write
+///    cache[kControl1] |= 0x01;  // 1 bus write, value read from RAM
+///
+/// @tparam kCapacity - maximum number of register bytes that can be tracked.
+template <size_t kCapacity = 32>
+class ShadowCacheProtocol : public MemoryAccessProtocol
+{
+ public:
+  /// @param protocol - the protocol used to communicate with the device.
+  /// @param specification - address width and endianness of the addresses used
+  ///        with this cache.
+  template <AddressWidth address_width, std::endian endianness>
+  ShadowCacheProtocol(MemoryAccessProtocol & protocol,
+                      Specification_t<address_width, endianness> specification)
+      : protocol_(protocol),
+        address_width_(Value(specification.AddressWidth())),
+        endianness_(specification.Endianness())
+  {
+  }
+
+  /// Opt a register into the shadow cache. Its value is unknown until it is
+  /// written or read through this cache, or until Refresh() is called.
+  ///
+  /// @param device_register - register to keep a shadow copy of.
+  /// @throw std::errc::not_enough_memory - if the cache cannot track every
+  ///        byte of the register.
+  template <AddressWidth address_width, std::endian endianness>
+  void Track(const Address<address_width, endianness> & device_register)
+  {
+    const uint32_t kStart = ToAddress(device_register.address);
+
+    size_t new_entries = 0;
+    for (size_t i = 0; i < device_register.width; i++)
+    {
+      if (Find(kStart + i) == nullptr)
+      {
+        new_entries++;
+      }
+    }
+
+    if (count_ + new_entries > kCapacity)
+    {
+      throw Exception(std::errc::not_enough_memory,
+                      "ShadowCacheProtocol does not have enough storage to "
+                      "track this register.");
+    }
+
+    for (size_t i = 0; i < device_register.width; i++)
+    {
+      Insert(kStart + i);
+    }
+  }
+
+  /// Forget the cached value of a register so that the next read is performed
+  /// on the device. Use this after an operation that changes the register
+  /// without going through the cache, such as a device reset.
+  ///
+  /// @param device_register - register to invalidate.
+  template <AddressWidth address_width, std::endian endianness>
+  void Invalidate(const Address<address_width, endianness> & device_register)
+  {
+    const uint32_t kStart = ToAddress(device_register.address);
+    for (size_t i = 0; i < device_register.width; i++)
+    {
+      if (auto * entry = Find(kStart + i))
+      {
+        entry->valid = false;
+      }
+    }
+  }
+
+  /// Forget the cached value of every tracked register.
+  void InvalidateAll()
+  {
+    for (size_t i = 0; i < count_; i++)
+    {
+      entries_[i].valid = false;
+    }
+  }
+
+  /// Read a register from the device and update its cached value.
+  ///
+  /// @param device_register - register to refresh.
+  template <AddressWidth address_width, std::endian endianness>
+  void Refresh(const Address<address_width, endianness> & device_register)
+  {
+    Invalidate(device_register);
+
+    // A tracked register can never be wider than the capacity of the cache,
+    // so a buffer of that size is always large enough.
+    std::array<uint8_t, kCapacity> buffer;
+    const size_t kLength = std::min<size_t>(device_register.width, kCapacity);
+    Read(device_register.address, std::span(buffer.data(), kLength));
+  }
+
+  void Write(std::span<const uint8_t> address,
+             std::span<const uint8_t> payload) override
+  {
+    protocol_.Write(address, payload);
+
+    const uint32_t kStart = ToAddress(address);
+    for (size_t i = 0; i < payload.size(); i++)
+    {
+      if (auto * entry = Find(kStart + i))
+      {
+        entry->value = payload[i];
+        entry->valid = true;
+      }
+    }
+  }
+
+  void Read(std::span<const uint8_t> address,
+            std::span<uint8_t> payload) override
+  {
+    const uint32_t kStart = ToAddress(address);
+
+    bool all_cached = true;
+    for (size_t i = 0; i < payload.size() && all_cached; i++)
+    {
+      auto * entry = Find(kStart + i);
+      if (entry != nullptr && entry->valid)
+      {
+        payload[i] = entry->value;
+      }
+      else
+      {
+        all_cached = false;
+      }
+    }
+
+    if (all_cached)
+    {
+      return;
+    }
+
+    protocol_.Read(address, payload);
+
+    for (size_t i = 0; i < payload.size(); i++)
+    {
+      if (auto * entry = Find(kStart + i))
+      {
+        entry->value = payload[i];
+        entry->valid = true;
+      }
+    }
+  }
+
+ private:
+  struct Entry_t
+  {
+    uint32_t address;
+    uint8_t value;
+    bool valid;
+  };
+
+  uint32_t ToAddress(std::span<const uint8_t> address) const
+  {
+    return AddressToInteger(endianness_, address, address_width_);
+  }
+
+  Entry_t * LowerBound(uint32_t address)
+  {
+    return std::lower_bound(entries_.data(),
+                            entries_.data() + count_,
+                            address,
+                            [](const Entry_t & entry, uint32_t key) {
+                              return entry.address < key;
+                            });
+  }
+
+  Entry_t * Find(uint32_t address)
+  {
+    Entry_t * position = LowerBound(address);
+    if (position != entries_.data() + count_ && position->address == address)
+    {
+      return position;
+    }
+    return nullptr;
+  }
+
+  void Insert(uint32_t address)
+  {
+    Entry_t * position = LowerBound(address);
+    Entry_t * end      = entries_.data() + count_;
+
+    if (position != end && position->address == address)
+    {
+      return;
+    }
+
+    std::copy_backward(position, end, end + 1);
+    *position = Entry_t{ .address = address, .value = 0, .valid = false };
+    count_++;
+  }
+
+  MemoryAccessProtocol & protocol_;
+  size_t address_width_;
+  std::endian endianness_;
+  std::array<Entry_t, kCapacity> entries_;
+  size_t count_ = 0;
 };
 
 /// Used to validate at compile time a set of addresses do not overlap in
@@ -3,6 +3,7 @@
 #include <libcore/utility/math/bit.hpp>
 #include <numeric>
 #include <string>
+#include <vector>
 
 namespace sjsu
 {
@@ -703,6 +704,361 @@ TEST_CASE_TEMPLATE("Testing MemoryAccessProtocol",
     }
   }
 }
+
+/// MockProtocol that records every bus transaction made through it.
+class CountingProtocol
+    : public MockProtocol<MemoryAccessProtocol::AddressWidth::kByte1>
+{
+ public:
+  struct WriteRecord_t
+  {
+    uint8_t address;
+    std::vector<uint8_t> payload;
+  };
+
+  void Write(std::span<const uint8_t> address,
+             std::span<const uint8_t> payload) override
+  {
+    writes.push_back({ address[0], { payload.begin(), payload.end() } });
+    MockProtocol::Write(address, payload);
+  }
+
+  void Read(std::span<const uint8_t> address,
+            std::span<uint8_t> payload) override
+  {
+    reads++;
+    MockProtocol::Read(address, payload);
+  }
+
+  std::vector<WriteRecord_t> writes;
+  int reads = 0;
+};
+
+TEST_CASE("Testing MemoryAccessBatch")
+{
+  constexpr auto kControl1 = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x20, .width = 1 });
+  constexpr auto kControl2 = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x21, .width = 1 });
+  constexpr auto kControl3 = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x22, .width = 1 });
+  constexpr auto kThreshold = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x30, .width = 2 });
+
+  CountingProtocol device;
+  device.memory_map.fill(0);
+  device.memory_map[0x21] = 0x01;
+
+  SECTION("Writes to consecutive registers are merged on scope exit")
+  {
+    // Exercise
+    {
+      MemoryAccessBatch batch(device, kSpec1);
+      batch[kControl1] = 0x57;
+      batch[kControl3] = 0x33;
+      batch[kControl2] |= 0x80;
+      batch[kThreshold] = 0x1234;
+
+      // Verify: nothing written until the batch is flushed
+      CHECK(device.writes.empty());
+    }
+
+    // Verify
+    REQUIRE(2 == device.writes.size());
+    CHECK(0x20 == device.writes[0].address);
+    CHECK(std::vector<uint8_t>{ 0x57, 0x81, 0x33 } ==
+          device.writes[0].payload);
+    CHECK(0x30 == device.writes[1].address);
+    CHECK(std::vector<uint8_t>{ 0x12, 0x34 } == device.writes[1].payload);
+    // Verify: Only the |= needed to read from the device
+    CHECK(1 == device.reads);
+  }
+
+  SECTION("Reads of written registers are served from the cache")
+  {
+    // Setup
+    MemoryAccessBatch batch(device, kSpec1);
+    batch[kControl1] = 0x42;
+
+    // Exercise
+    uint8_t value = batch[kControl1];
+
+    // Verify
+    CHECK(0x42 == value);
+    CHECK(0 == device.reads);
+  }
+
+  SECTION("Repeated reads only read the device once")
+  {
+    // Setup
+    MemoryAccessBatch batch(device, kSpec1);
+
+    // Exercise
+    uint8_t first  = batch[kControl2];
+    uint8_t second = batch[kControl2];
+    batch.Flush();
+
+    // Verify
+    CHECK(0x01 == first);
+    CHECK(0x01 == second);
+    CHECK(1 == device.reads);
+    // Verify: bytes that were only read are not written back
+    CHECK(device.writes.empty());
+  }
+
+  SECTION("Addresses are trimmed to the width of the batch")
+  {
+    // Setup
+    constexpr auto kWideControl1 = MemoryAccessProtocol::Address(
+        kSpec2, { .address = 0x0120, .width = 1 });
+
+    // Exercise
+    {
+      MemoryAccessBatch batch(device, kSpec1);
+      batch[kControl1]     = 0x11;
+      batch[kWideControl1] = 0x22;
+    }
+
+    // Verify
+    REQUIRE(1 == device.writes.size());
+    CHECK(0x20 == device.writes[0].address);
+    CHECK(std::vector<uint8_t>{ 0x22 } == device.writes[0].payload);
+  }
+
+  SECTION("Cache overflow flushes early")
+  {
+    // Setup
+    MemoryAccessBatch<2> batch(device, kSpec1);
+
+    // Exercise
+    batch[kControl1] = 0x01;
+    batch[kControl2] = 0x02;
+    batch[kControl3] = 0x03;
+
+    // Verify
+    REQUIRE(1 == device.writes.size());
+    CHECK(std::vector<uint8_t>{ 0x01, 0x02 } == device.writes[0].payload);
+    CHECK(1 == batch.CachedBytes());
+
+    // Exercise
+    batch.Discard();
+  }
+}
+
+TEST_CASE("Testing ShadowCacheProtocol")
+{
+  constexpr auto kConfig = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x10, .width = 2 });
+  constexpr auto kStatus = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x12, .width = 1 });
+
+  CountingProtocol device;
+  device.memory_map.fill(0);
+  device.memory_map[0x10] = 0xAB;
+  device.memory_map[0x11] = 0xCD;
+
+  ShadowCacheProtocol cache(device, kSpec1);
+  cache.Track(kConfig);
+
+  SECTION("Reads of tracked registers are served from RAM after a read")
+  {
+    // Exercise
+    uint16_t first  = cache[kConfig];
+    uint16_t second = cache[kConfig];
+
+    // Verify
+    CHECK(0xABCD == first);
+    CHECK(0xABCD == second);
+    CHECK(1 == device.reads);
+  }
+
+  SECTION("Read-modify-write of a tracked register only writes")
+  {
+    // Setup
+    cache[kConfig] = 0x1000;
+
+    // Exercise
+    cache[kConfig] |= 0x0001;
+
+    // Verify
+    CHECK(0 == device.reads);
+    REQUIRE(2 == device.writes.size());
+    CHECK(std::vector<uint8_t>{ 0x10, 0x01 } == device.writes[1].payload);
+  }
+
+  SECTION("Untracked registers are always read from the device")
+  {
+    // Exercise
+    uint8_t first  = cache[kStatus];
+    uint8_t second = cache[kStatus];
+
+    // Verify
+    CHECK(0 == first);
+    CHECK(0 == second);
+    CHECK(2 == device.reads);
+  }
+
+  SECTION("Invalidate() and Refresh()")
+  {
+    // Setup
+    uint16_t initial = cache[kConfig];
+    device.memory_map[0x11] = 0xEF;
+
+    // Exercise
+    uint16_t stale = cache[kConfig];
+    cache.Invalidate(kConfig);
+    uint16_t updated = cache[kConfig];
+    device.memory_map[0x10] = 0x12;
+    cache.Refresh(kConfig);
+    uint16_t refreshed = cache[kConfig];
+
+    // Verify
+    CHECK(0xABCD == initial);
+    CHECK(0xABCD == stale);
+    CHECK(0xABEF == updated);
+    CHECK(0x12EF == refreshed);
+    CHECK(3 == device.reads);
+  }
+
+  SECTION("Track() throws when out of capacity")
+  {
+    // Setup
+    ShadowCacheProtocol<2> small_cache(device, kSpec1);
+    small_cache.Track(kConfig);
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(small_cache.Track(kStatus),
+                        std::errc::not_enough_memory);
+  }
+}
+
+TEST_CASE("Testing I2cProtocol")
+{
+  constexpr uint8_t kDeviceAddress = 0x1D;
+  constexpr auto kBlock            = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x40, .width = 64 });
+
+  Mock<I2c> mock_i2c;
+  std::span<const uint8_t> header;
+  std::span<const uint8_t> payload_written;
+  When(Method(mock_i2c, WriteGather))
+      .AlwaysDo([&](uint8_t address,
+                    std::span<const uint8_t> gather_header,
+                    std::span<const uint8_t> gather_payload,
+                    std::chrono::milliseconds) {
+        CHECK(kDeviceAddress == address);
+        header          = gather_header;
+        payload_written = gather_payload;
+      });
+
+  I2cProtocol protocol(kDeviceAddress, mock_i2c.get());
+
+  SECTION("Write() sends large payloads without copying them")
+  {
+    // Setup
+    std::array<uint8_t, 64> payload;
+    std::iota(payload.begin(), payload.end(), 0);
+
+    // Exercise
+    protocol[kBlock] = payload;
+
+    // Verify
+    Verify(Method(mock_i2c, WriteGather)).Once();
+    REQUIRE(1 == header.size());
+    CHECK(0x40 == header[0]);
+    CHECK(payload.data() == payload_written.data());
+    CHECK(payload.size() == payload_written.size());
+  }
+}
+
+TEST_CASE("Testing SpiProtocol")
+{
+  constexpr auto kWhoAmI = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x0F, .width = 1 });
+  constexpr auto kAcceleration = MemoryAccessProtocol::Address(
+      kSpec1, { .address = 0x28, .width = 6 });
+
+  Mock<Spi> mock_spi;
+  Fake(Method(mock_spi, ModuleInitialize));
+  Mock<Gpio> mock_cs;
+  Fake(Method(mock_cs, ModuleInitialize));
+  Fake(Method(mock_cs, SetDirection));
+  Fake(Method(mock_cs, Set));
+
+  // Capture the bytes sent in each segment and respond to receive segments
+  // with an incrementing pattern.
+  std::vector<std::vector<uint8_t>> transmitted;
+  std::vector<size_t> received_lengths;
+  When(OverloadedMethod(
+           mock_spi, Transfer, void(std::span<const Spi::Segment_t>)))
+      .AlwaysDo([&](std::span<const Spi::Segment_t> segments) {
+        for (const auto & segment : segments)
+        {
+          transmitted.emplace_back(segment.transmit.begin(),
+                                   segment.transmit.end());
+          received_lengths.push_back(segment.receive.size());
+          for (size_t i = 0; i < segment.receive.size(); i++)
+          {
+            segment.receive[i] = static_cast<uint8_t>(i + 1);
+          }
+        }
+      });
+
+  SpiBus bus(mock_spi.get());
+  SpiDevice device(bus, mock_cs.get());
+  device.Initialize();
+
+  SECTION("Write() with the default convention")
+  {
+    // Setup
+    SpiProtocol protocol(device);
+
+    // Exercise
+    protocol[kWhoAmI] = 0x33;
+
+    // Verify
+    REQUIRE(2 == transmitted.size());
+    CHECK(std::vector<uint8_t>{ 0x0F } == transmitted[0]);
+    CHECK(std::vector<uint8_t>{ 0x33 } == transmitted[1]);
+    Verify(Method(mock_cs, Set).Using(Gpio::State::kLow)).Once();
+  }
+
+  SECTION("Read() sets the read flag")
+  {
+    // Setup
+    SpiProtocol protocol(device);
+
+    // Exercise
+    uint8_t value = protocol[kWhoAmI];
+
+    // Verify
+    CHECK(0x01 == value);
+    REQUIRE(2 == transmitted.size());
+    CHECK(std::vector<uint8_t>{ 0x8F } == transmitted[0]);
+    CHECK(1 == received_lengths[1]);
+  }
+
+  SECTION("Burst read sets the increment flag")
+  {
+    // Setup
+    SpiProtocol protocol(device,
+                         SpiProtocol::Convention_t{
+                             .read_flag      = 0x80,
+                             .write_flag     = 0x00,
+                             .increment_flag = 0x40,
+                         });
+
+    // Exercise
+    std::array<uint8_t, 6> samples = protocol[kAcceleration];
+
+    // Verify
+    CHECK(std::array<uint8_t, 6>{ 1, 2, 3, 4, 5, 6 } == samples);
+    REQUIRE(2 == transmitted.size());
+    CHECK(std::vector<uint8_t>{ 0xE8 } == transmitted[0]);
+    CHECK(6 == received_lengths[1]);
+    Verify(Method(mock_cs, Set).Using(Gpio::State::kLow)).Once();
+  }
+}
 }  // namespace sjsu
 
 TYPE_TO_STRING(decltype(sjsu::MemoryAccessProtocol::Address(sjsu::kSpec1, {})));
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <libcore/module.hpp>
 #include <libcore/peripherals/gpio.hpp>
 #include <libcore/utility/error_handling.hpp>
@@ -69,6 +70,25 @@ class ParallelBus : public Module<>
     }
   }
 
+  /// Write each word to the bus in turn, pulsing an 8080 style active low
+  /// write strobe after each, such as to send pixels to a parallel panel.
+  ///
+  /// The default implementation calls Write() and sets the strobe low then
+  /// high for each word. Implementations that can write the bus and strobe
+  /// faster should override this.
+  ///
+  /// @param words - the words to write, in order.
+  /// @param write_strobe - the active low write strobe, set as an output.
+  virtual void Write(std::span<const uint16_t> words, Gpio & write_strobe)
+  {
+    for (const uint16_t word : words)
+    {
+      Write(word);
+      write_strobe.SetLow();
+      write_strobe.SetHigh();
+    }
+  }
+
   // ===========================================================================
   // Helper Functions
   // ===========================================================================
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 #include <libcore/module.hpp>
 
@@ -39,6 +41,181 @@ class PixelDisplay : public Module<>
     }
   };
 
+  /// A rectangular area of the display, in pixels.
+  struct Region_t
+  {
+    /// x coordinate of the left most column of the region
+    int32_t x = 0;
+    /// y coordinate of the top most row of the region
+    int32_t y = 0;
+    /// Number of columns in the region
+    int32_t width = 0;
+    /// Number of rows in the region
+    int32_t height = 0;
+
+    /// @return true if the region contains no pixels.
+    constexpr bool IsEmpty() const
+    {
+      return width <= 0 || height <= 0;
+    }
+
+    /// @return int32_t - x coordinate one past the right most column.
+    constexpr int32_t Right() const
+    {
+      return x + width;
+    }
+
+    /// @return int32_t - y coordinate one past the bottom most row.
+    constexpr int32_t Bottom() const
+    {
+      return y + height;
+    }
+
+    /// @param other - region to combine with this one.
+    /// @return Region_t - the smallest region containing both regions.
+    constexpr Region_t Union(const Region_t & other) const
+    {
+      if (IsEmpty())
+      {
+        return other;
+      }
+      if (other.IsEmpty())
+      {
+        return *this;
+      }
+
+      const int32_t kLeft = std::min(x, other.x);
+      const int32_t kTop  = std::min(y, other.y);
+      return Region_t{
+        .x      = kLeft,
+        .y      = kTop,
+        .width  = std::max(Right(), other.Right()) - kLeft,
+        .height = std::max(Bottom(), other.Bottom()) - kTop,
+      };
+    }
+
+    /// @param other - region to intersect with this one.
+    /// @return Region_t - the area covered by both regions, empty if they do
+    ///         not overlap.
+    constexpr Region_t Intersection(const Region_t & other) const
+    {
+      const int32_t kLeft   = std::max(x, other.x);
+      const int32_t kTop    = std::max(y, other.y);
+      const int32_t kWidth  = std::min(Right(), other.Right()) - kLeft;
+      const int32_t kHeight = std::min(Bottom(), other.Bottom()) - kTop;
+
+      if (kWidth <= 0 || kHeight <= 0)
+      {
+        return Region_t{};
+      }
+
+      return Region_t{
+        .x      = kLeft,
+        .y      = kTop,
+        .width  = kWidth,
+        .height = kHeight,
+      };
+    }
+
+    /// @return true if both regions cover the same pixels.
+    constexpr bool operator==(const Region_t & other) const = default;
+  };
+
+  /// Memory layouts of framebuffers that Graphics can draw into directly.
+  enum class PixelFormat : uint8_t
+  {
+    /// The display does not keep a framebuffer that can be written directly.
+    kNone,
+    /// 1 bit per pixel. Each byte holds a column of 8 rows, least significant
+    /// bit at the top, and each row of bytes holds a "page" of 8 rows, as used
+    /// by SSD1306 style controllers. Any color turns a pixel on.
+    kMonochromePages,
+    /// 16 bits per pixel, most significant byte first: 5 bits of red, 6 bits
+    /// of green and 5 bits of blue, taken from the low bits of Color_t.
+    kRgb565,
+    /// 24 bits per pixel: a byte each of red, green and blue, in that order.
+    kRgb888,
+  };
+
+  /// Describes a framebuffer kept in memory by a display.
+  struct Framebuffer_t
+  {
+    /// Layout of the pixels.
+    PixelFormat format = PixelFormat::kNone;
+    /// Address of the first byte of the first row.
+    uint8_t * data = nullptr;
+    /// Number of bytes from the start of one row, or page for
+    /// kMonochromePages, to the start of the next.
+    size_t stride = 0;
+
+    /// @return true if pixels can be written to `data`.
+    constexpr bool IsValid() const
+    {
+      return format != PixelFormat::kNone && data != nullptr;
+    }
+
+    /// Write a pixel into the framebuffer.
+    ///
+    /// @param x - x coordinate of the pixel, within the display.
+    /// @param y - y coordinate of the pixel, within the display.
+    /// @param color - the color of the pixel.
+    void DrawPixel(int32_t x, int32_t y, Color_t color) const
+    {
+      const size_t kColumn = static_cast<size_t>(x);
+      const size_t kRow    = static_cast<size_t>(y);
+
+      switch (format)
+      {
+        case PixelFormat::kMonochromePages:
+        {
+          uint8_t & column = data[((kRow / 8) * stride) + kColumn];
+          column           = static_cast<uint8_t>(column | (1 << (kRow % 8)));
+          break;
+        }
+        case PixelFormat::kRgb565:
+        {
+          const uint16_t kPixel = ToRgb565(color);
+          uint8_t * pixel       = &data[(kRow * stride) + (kColumn * 2)];
+          pixel[0]              = static_cast<uint8_t>(kPixel >> 8);
+          pixel[1]              = static_cast<uint8_t>(kPixel);
+          break;
+        }
+        case PixelFormat::kRgb888:
+        {
+          uint8_t * pixel = &data[(kRow * stride) + (kColumn * 3)];
+          pixel[0]        = color.red;
+          pixel[1]        = color.green;
+          pixel[2]        = color.blue;
+          break;
+        }
+        case PixelFormat::kNone: break;
+      }
+    }
+
+    /// @param color - color holding 5 bits of red, 6 bits of green and 5 bits
+    ///        of blue.
+    /// @return constexpr uint16_t - the color as an RGB565 pixel.
+    static constexpr uint16_t ToRgb565(Color_t color)
+    {
+      return static_cast<uint16_t>(((color.red & 0x1F) << 11) |
+                                   ((color.green & 0x3F) << 5) |
+                                   (color.blue & 0x1F));
+    }
+
+    /// @param pixel - an RGB565 pixel.
+    /// @return constexpr Color_t - a color holding the pixel's 5 bits of red,
+    ///         6 bits of green and 5 bits of blue.
+    static constexpr Color_t FromRgb565(uint16_t pixel)
+    {
+      return Color_t{
+        .red   = static_cast<uint8_t>((pixel >> 11) & 0x1F),
+        .green = static_cast<uint8_t>((pixel >> 5) & 0x3F),
+        .blue  = static_cast<uint8_t>(pixel & 0x1F),
+        .alpha = 0,
+      };
+    }
+  };
+
   /// Returns the number of pixels wide the display is.
   virtual size_t GetWidth() = 0;
 
@@ -51,6 +228,34 @@ class PixelDisplay : public Module<>
   /// Clear framebuffer
   virtual void Clear() = 0;
 
+  /// Clear only the part of the framebuffer within `region`.
+  ///
+  /// Implementations with a framebuffer should override this method. The
+  /// default implementation does nothing and returns false, in which case the
+  /// caller must clear the whole display instead.
+  ///
+  /// @param region - area to clear. Always within the bounds of the display.
+  /// @return true - if the region was cleared.
+  virtual bool Clear([[maybe_unused]] Region_t region)
+  {
+    return false;
+  }
+
+  /// Move the contents of the framebuffer up by `rows` rows of pixels and
+  /// clear the rows uncovered at the bottom, either by moving the framebuffer
+  /// or with the panel's hardware scrolling.
+  ///
+  /// The default implementation does nothing and returns false, in which case
+  /// the caller must redraw the display instead.
+  ///
+  /// @param rows - number of rows to scroll by, less than the height of the
+  ///        display.
+  /// @return true - if the contents were scrolled.
+  virtual bool Scroll([[maybe_unused]] int32_t rows)
+  {
+    return false;
+  }
+
   /// Draw the specified pixel.
   /// Implementations of this method should not draw directly to the display but
   /// should manipulate A class implementing this interface should
@@ -62,9 +267,124 @@ class PixelDisplay : public Module<>
   /// @param color the color of the pixel. May be ignored on monochrome screens.
   virtual void DrawPixel(int32_t x, int32_t y, Color_t color) = 0;
 
+  // ===========================================================================
+  // Bulk Drawing Methods
+  // ===========================================================================
+  //
+  // The following methods have default implementations that call DrawPixel()
+  // for every pixel. Drivers with a framebuffer or with hardware fills should
+  // override them to write whole rows at a time. Graphics only calls them with
+  // areas within the bounds of the display.
+
+  /// Draw a horizontal run of pixels of one color.
+  ///
+  /// @param x - x coordinate of the left most pixel
+  /// @param y - y coordinate of the row
+  /// @param width - number of pixels to draw going to the right
+  /// @param color - the color of the pixels.
+  virtual void DrawSpan(int32_t x, int32_t y, int32_t width, Color_t color)
+  {
+    for (int32_t column = x; column < x + width; column++)
+    {
+      DrawPixel(column, y, color);
+    }
+  }
+
+  /// Fill a rectangle of pixels with one color.
+  ///
+  /// @param region - the area to fill.
+  /// @param color - the color of the pixels.
+  virtual void FillRectangle(Region_t region, Color_t color)
+  {
+    for (int32_t row = region.y; row < region.Bottom(); row++)
+    {
+      DrawSpan(region.x, row, region.width, color);
+    }
+  }
+
+  /// Draw a 1 bit per pixel bitmap. Set bits are drawn with `color` and clear
+  /// bits are left untouched, as with the font8x8 glyphs.
+  ///
+  /// @param region - where to draw the bitmap and its width and height.
+  /// @param bitmap - rows of `(region.width + 7) / 8` bytes each, top row
+  ///        first. The least significant bit of a row's first byte is its
+  ///        left most pixel.
+  /// @param color - the color of the set pixels.
+  virtual void DrawBitmap(Region_t region,
+                          std::span<const uint8_t> bitmap,
+                          Color_t color)
+  {
+    const size_t kStride = (static_cast<size_t>(region.width) + 7) / 8;
+
+    for (int32_t row = 0; row < region.height; row++)
+    {
+      for (int32_t column = 0; column < region.width; column++)
+      {
+        const size_t kIndex = (row * kStride) + (column / 8);
+        if (kIndex < bitmap.size() && (bitmap[kIndex] >> (column % 8)) & 1)
+        {
+          DrawPixel(region.x + column, region.y + row, color);
+        }
+      }
+    }
+  }
+
+  /// Draw a 16 bit per pixel, RGB565, bitmap. Each pixel is drawn with a
+  /// Color_t holding its 5 bits of red, 6 bits of green and 5 bits of blue.
+  ///
+  /// @param region - where to draw the bitmap and its width and height.
+  /// @param pixels - `region.width * region.height` pixels, row by row, top
+  ///        row first.
+  virtual void DrawBitmap(Region_t region, std::span<const uint16_t> pixels)
+  {
+    for (int32_t row = 0; row < region.height; row++)
+    {
+      for (int32_t column = 0; column < region.width; column++)
+      {
+        const size_t kIndex = (row * region.width) + column;
+        if (kIndex >= pixels.size())
+        {
+          return;
+        }
+
+        DrawPixel(region.x + column,
+                  region.y + row,
+                  Framebuffer_t::FromRgb565(pixels[kIndex]));
+      }
+    }
+  }
+
+  /// Displays that keep their framebuffer in memory may return it, so that
+  /// Graphics writes pixels into it directly rather than calling DrawPixel().
+  /// Pixels written directly are still sent to the panel by Update(). The
+  /// framebuffer may change after each Update(), as with double buffering.
+  ///
+  /// @return Framebuffer_t - the framebuffer, or an invalid Framebuffer_t if
+  ///         the display does not allow direct access, which is the default.
+  virtual Framebuffer_t GetFramebuffer()
+  {
+    return {};
+  }
+
   /// Update screen to match framebuffer.
   /// Implementations of this method that do not use a framebuffer, possibly
   /// due to memory constrains, can refrain from implementing this function.
   virtual void Update() {}
+
+  /// Update only the part of the screen within `region` to match the
+  /// framebuffer. Used by Graphics to push only what was drawn since the last
+  /// update.
+  ///
+  /// Implementations should override this method when the panel can be
+  /// written in parts, and may round the region out to whatever the panel can
+  /// address, such as the 8 row pages of a monochrome OLED. The default
+  /// implementation updates the whole screen.
+  ///
+  /// @param region - area of the screen that has changed. Always within the
+  ///        bounds of the display.
+  virtual void Update([[maybe_unused]] Region_t region)
+  {
+    Update();
+  }
 };
 }  // namespace sjsu
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <libcore/devices/parallel_bus.hpp>
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/gpio_port.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu
+{
+/// A ParallelBus on consecutive pins of a GpioPort, so that the whole bus is
+/// written or read in one port access rather than a call per pin.
+///
+/// An 8080 style write strobe on the same port can be given, which is pulled
+/// low in the same access that writes each word, so writing a word to a
+/// panel takes two port accesses.
+///
+/// USAGE:
+///
+///    // Data on pins 0 to 7 of the port, write strobe on pin 8.
+///    sjsu::PortParallelBus bus(port, 0, 8, 8);
+///    bus.Initialize();
+///    bus.SetAsOutput();
+///    bus.WriteStrobed(words);
+class PortParallelBus : public ParallelBus
+{
+ public:
+  /// Marks that the bus has no write strobe on its port.
+  static constexpr uint8_t kNoStrobe = 0xFF;
+
+  /// @param port - the port of the pins.
+  /// @param first_pin - the port pin of bit 0 of the bus.
+  /// @param width - number of pins of the bus, from 1 to 32 - first_pin.
+  /// @param strobe_pin - optional port pin of an active low write strobe,
+  ///        outside of the bus pins.
+  constexpr PortParallelBus(GpioPort & port,
+                            uint8_t first_pin,
+                            uint8_t width,
+                            uint8_t strobe_pin = kNoStrobe)
+      : port_(port),
+        shift_(first_pin),
+        width_(width),
+        mask_(static_cast<uint32_t>(((uint64_t{ 1 } << width) - 1)
+                                    << first_pin)),
+        strobe_mask_((strobe_pin == kNoStrobe) ? 0 : uint32_t{ 1 }
+                                                         << strobe_pin)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    port_.Initialize();
+    if (strobe_mask_ != 0)
+    {
+      port_.Set(strobe_mask_);
+      port_.SetDirection(strobe_mask_, Gpio::Direction::kOutput);
+    }
+  }
+
+  void Write(uint32_t data) override
+  {
+    port_.Write(mask_, data << shift_);
+  }
+
+  // Keep the overload for a strobe on a separate Gpio visible. WriteStrobed()
+  // uses the strobe on the port.
+  using ParallelBus::Write;
+
+  uint32_t Read() override
+  {
+    return (port_.Read() & mask_) >> shift_;
+  }
+
+  size_t BusWidth() override
+  {
+    return width_;
+  }
+
+  void SetDirection(sjsu::Gpio::Direction direction) override
+  {
+    port_.SetDirection(mask_, direction);
+  }
+
+  /// Write each word to the bus and pulse the write strobe of the port after
+  /// it, which pulls the strobe low in the same access as the data is
+  /// written and releases it with a second access.
+  ///
+  /// @param words - the words to write, in order.
+  /// @throw sjsu::Exception - std::errc::operation_not_supported if the bus
+  ///        was constructed without a strobe pin.
+  void WriteStrobed(std::span<const uint16_t> words)
+  {
+    if (strobe_mask_ == 0)
+    {
+      throw Exception(std::errc::operation_not_supported,
+                      "This parallel bus has no write strobe pin.");
+    }
+
+    const uint32_t kMask = mask_ | strobe_mask_;
+    for (const uint16_t word : words)
+    {
+      port_.Write(kMask, uint32_t{ word } << shift_);
+      port_.Set(strobe_mask_);
+    }
+  }
+
+ private:
+  GpioPort & port_;
+  uint8_t shift_;
+  uint8_t width_;
+  uint32_t mask_;
+  uint32_t strobe_mask_;
+};
+}  // namespace sjsu
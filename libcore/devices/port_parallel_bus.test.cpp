@@ -0,0 +1,132 @@
+#include <libcore/devices/port_parallel_bus.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Records the state of the port after each access.
+class FakePort : public GpioPort
+{
+ public:
+  void ModuleInitialize() override {}
+
+  void SetDirection(uint32_t mask, Gpio::Direction direction) override
+  {
+    directions = (direction == Gpio::Direction::kOutput) ? directions | mask
+                                                          : directions & ~mask;
+  }
+
+  void Set(uint32_t mask) override
+  {
+    Write(mask, UINT32_MAX);
+  }
+
+  void Clear(uint32_t mask) override
+  {
+    Write(mask, 0);
+  }
+
+  uint32_t Read() override
+  {
+    return input;
+  }
+
+  void Write(uint32_t mask, uint32_t value) override
+  {
+    output = (output & ~mask) | (value & mask);
+    accesses.push_back(output);
+  }
+
+  uint32_t directions = 0;
+  uint32_t output     = 0;
+  uint32_t input      = 0;
+  std::vector<uint32_t> accesses;
+};
+}  // namespace
+
+TEST_CASE("Testing PortParallelBus")
+{
+  FakePort port;
+
+  SECTION("Write() and Read() shift the bus to its pins in one access")
+  {
+    // Setup
+    PortParallelBus test_subject(port, 4, 8);
+    test_subject.Initialize();
+    port.output = 0xF000'000F;
+    port.input  = 0x1234'5678;
+
+    // Exercise
+    test_subject.Write(0x1A5);
+    uint32_t result = test_subject.Read();
+
+    // Verify
+    REQUIRE(1 == port.accesses.size());
+    CHECK(0xF000'0A5F == port.output);
+    CHECK(0x67 == result);
+    CHECK(8 == test_subject.BusWidth());
+  }
+
+  SECTION("SetAsOutput() only changes the pins of the bus")
+  {
+    // Setup
+    PortParallelBus test_subject(port, 8, 4);
+    test_subject.Initialize();
+
+    // Exercise
+    test_subject.SetAsOutput();
+
+    // Verify
+    CHECK(0x0F00 == port.directions);
+  }
+
+  SECTION("WriteStrobed() pulls the strobe low with each word")
+  {
+    // Setup
+    PortParallelBus test_subject(port, 0, 8, 8);
+    test_subject.Initialize();
+    port.accesses.clear();
+    const uint16_t kWords[] = { 0x12, 0x34 };
+
+    // Exercise
+    test_subject.WriteStrobed(kWords);
+
+    // Verify
+    CHECK(0x100 == (port.directions & 0x100));
+    CHECK(port.accesses ==
+          std::vector<uint32_t>{ 0x012, 0x112, 0x034, 0x134 });
+  }
+
+  SECTION("WriteStrobed() throws without a strobe pin")
+  {
+    // Setup
+    PortParallelBus test_subject(port, 0, 8);
+    const uint16_t kWords[] = { 0x12 };
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.WriteStrobed(kWords), sjsu::Exception);
+  }
+
+  SECTION("Writing words with a strobe Gpio writes each before its pulse")
+  {
+    // Setup
+    PortParallelBus test_subject(port, 0, 8);
+    Mock<Gpio> mock_strobe;
+    Fake(Method(mock_strobe, Set));
+    const uint16_t kWords[] = { 0x12, 0x34 };
+
+    // Exercise
+    test_subject.Write(kWords, mock_strobe.get());
+
+    // Verify
+    CHECK(port.accesses == std::vector<uint32_t>{ 0x12, 0x34 });
+    Verify(Method(mock_strobe, Set).Using(Gpio::State::kLow),
+           Method(mock_strobe, Set).Using(Gpio::State::kHigh))
+        .Exactly(2);
+  }
+}
+}  // namespace sjsu
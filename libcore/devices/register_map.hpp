@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <libcore/devices/memory_access_protocol.hpp>
+#include <libcore/utility/enum.hpp>
+#include <libcore/utility/math/byte.hpp>
+
+namespace sjsu
+{
+/// Defines which operations are permitted on a register.
+enum class RegisterAccess : uint8_t
+{
+  kReadOnly,
+  kWriteOnly,
+  kReadWrite,
+};
+
+namespace detail
+{
+/// @tparam T - type to check.
+/// Evaluates to true if T is a std::array of integers.
+template <typename T>
+struct IsIntegerArray : std::false_type
+{
+};
+
+/// @tparam T - element type of the array.
+/// @tparam N - number of elements in the array.
+template <typename T, size_t N>
+struct IsIntegerArray<std::array<T, N>> : std::is_integral<T>
+{
+};
+}  // namespace detail
+
+/// Compile-time description of a single register within a device's memory
+/// map. Unlike MemoryAccessProtocol::Address, everything about the register is
+/// known to the compiler, so accesses through a RegisterMap compile down to a
+/// single fixed size transfer with no runtime width checks.
+///
+/// Usage:
+///
+///    using Control      = Register_t<0x20, uint8_t>;
+///    using WhoAmI       = Register_t<0x0F,
+///                                    uint8_t,
+///                                    RegisterAccess::kReadOnly>;
+///    using Acceleration = Register_t<0x28,
+///                                    std::array<int16_t, 3>,
+///                                    RegisterAccess::kReadOnly>;
+///
+/// @tparam address - address of the first byte of the register.
+/// @tparam T - type used to hold the register contents. Must be an integer or
+///         a std::array of integers.
+/// @tparam access - operations permitted on the register.
+/// @tparam width - number of bytes the register occupies on the device. For
+///         integers this may be smaller than the integer, for example a 24-bit
+///         register held in a uint32_t. For arrays it must equal sizeof(T).
+template <uint32_t address,
+          typename T,
+          RegisterAccess access = RegisterAccess::kReadWrite,
+          size_t width          = sizeof(T)>
+struct Register_t
+{
+  static_assert(std::is_integral_v<T> || detail::IsIntegerArray<T>::value,
+                "Register type must be an integer or a std::array of "
+                "integers.");
+  static_assert(width > 0, "Register width must be at least 1 byte.");
+  static_assert(std::is_integral_v<T> ? width <= sizeof(T)
+                                      : width == sizeof(T),
+                "Register width does not match the size of its type.");
+
+  /// Type used to hold the register contents.
+  using ValueType = T;
+
+  /// Address of the first byte of the register.
+  static constexpr uint32_t kAddress = address;
+
+  /// Number of bytes the register occupies on the device.
+  static constexpr size_t kWidth = width;
+
+  /// Operations permitted on the register.
+  static constexpr RegisterAccess kAccess = access;
+
+  /// True if the register may be read.
+  static constexpr bool kReadable = access != RegisterAccess::kWriteOnly;
+
+  /// True if the register may be written.
+  static constexpr bool kWritable = access != RegisterAccess::kReadOnly;
+};
+
+/// Compile-time register map that performs typed accesses to a device through
+/// a MemoryAccessProtocol.
+///
+/// The map is validated when it is instantiated: the registers must not
+/// overlap and must fit within the address space described by the
+/// specification, so there is no need to remember to call
+/// NoRegistersOverlap(). Accessing a register that is not part of the map,
+/// reading a write-only register or writing a read-only register fails to
+/// compile.
+///
+/// Usage:
+///
+///    using Lis3dhMap = RegisterMap<kLis3dhSpecification,
+///                                  WhoAmI,
+///                                  Control,
+///                                  Acceleration>;
+///
+///    Lis3dhMap map(protocol);
+///    if (map.Read<WhoAmI>() == 0x33)
+///    {
+///      map.Write<Control>(0x57);
+///      std::array<int16_t, 3> xyz = map.Read<Acceleration>();
+///    }
+///
+/// @tparam specification - a MemoryAccessProtocol::Specification_t describing
+///         the address width and endianness of the device.
+/// @tparam Registers - list of Register_t types that make up the map.
+template <auto specification, typename... Registers>
+class RegisterMap
+{
+ public:
+  /// Number of bytes used to transmit a register address.
+  static constexpr size_t kAddressWidth =
+      Value(specification.AddressWidth());
+
+  /// Endianness of the device's registers and addresses.
+  static constexpr std::endian kEndianness = specification.Endianness();
+
+  /// @tparam Register - register to look for.
+  /// True if the register is part of this map.
+  template <typename Register>
+  static constexpr bool kContains = (std::is_same_v<Register, Registers> ||
+                                     ...);
+
+  static_assert(((kAddressWidth >= 4 ||
+                  uint64_t{ Registers::kAddress } + Registers::kWidth <=
+                      (uint64_t{ 1 } << (kAddressWidth * 8))) &&
+                 ...),
+                "A register does not fit within the address space of the "
+                "specification.");
+
+  /// @param protocol - protocol used to communicate with the device.
+  explicit constexpr RegisterMap(MemoryAccessProtocol & protocol)
+      : protocol_(protocol)
+  {
+    static_assert(NoOverlap(), "Registers within a RegisterMap overlap.");
+  }
+
+  /// Read a register from the device.
+  ///
+  /// @tparam Register - register to read. Must be part of this map and
+  ///         readable.
+  /// @return Register::ValueType - the contents of the register.
+  template <typename Register>
+  requires(kContains<Register> && Register::kReadable)
+  typename Register::ValueType Read()
+  {
+    using T = typename Register::ValueType;
+
+    std::array<uint8_t, Register::kWidth> bytes;
+    protocol_.Read(kAddress<Register>, bytes);
+
+    if constexpr (std::is_integral_v<T>)
+    {
+      return ToInteger<T>(kEndianness, bytes);
+    }
+    else
+    {
+      using Element = typename T::value_type;
+      return ToIntegerArray<Element, std::tuple_size_v<T>>(kEndianness, bytes);
+    }
+  }
+
+  /// Write a value to a register of the device.
+  ///
+  /// @tparam Register - register to write. Must be part of this map and
+  ///         writable.
+  /// @param value - the value to write.
+  template <typename Register>
+  requires(kContains<Register> && Register::kWritable)
+  void Write(typename Register::ValueType value)
+  {
+    using T = typename Register::ValueType;
+
+    if constexpr (std::is_integral_v<T>)
+    {
+      const auto kBytes = ToByteArray<T, Register::kWidth>(kEndianness, value);
+      protocol_.Write(kAddress<Register>, kBytes);
+    }
+    else
+    {
+      using Element = typename T::value_type;
+      std::array<uint8_t, Register::kWidth> bytes;
+
+      for (size_t i = 0; i < value.size(); i++)
+      {
+        const auto kElement = ToByteArray(kEndianness, value[i]);
+        std::copy(kElement.begin(),
+                  kElement.end(),
+                  bytes.begin() + (i * sizeof(Element)));
+      }
+
+      protocol_.Write(kAddress<Register>, bytes);
+    }
+  }
+
+  /// @return MemoryAccessProtocol& - the protocol used by this map.
+  MemoryAccessProtocol & GetProtocol()
+  {
+    return protocol_;
+  }
+
+ private:
+  /// Address of the register encoded into bytes, computed at compile time.
+  template <typename Register>
+  static constexpr auto kAddress =
+      ToByteArray<uint32_t, kAddressWidth>(kEndianness, Register::kAddress);
+
+  /// @return true - if no two registers in the map share a byte.
+  static constexpr bool NoOverlap()
+  {
+    constexpr size_t kCount = sizeof...(Registers);
+    constexpr std::array<uint64_t, kCount> kStart = { Registers::kAddress... };
+    constexpr std::array<uint64_t, kCount> kEnd   = {
+      (uint64_t{ Registers::kAddress } + Registers::kWidth)...
+    };
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+      for (size_t j = i + 1; j < kCount; j++)
+      {
+        if (kStart[i] < kEnd[j] && kStart[j] < kEnd[i])
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  MemoryAccessProtocol & protocol_;
+};
+}  // namespace sjsu
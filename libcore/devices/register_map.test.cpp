@@ -0,0 +1,141 @@
+#include <libcore/devices/register_map.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+constexpr MemoryAccessProtocol::Specification_t<
+    MemoryAccessProtocol::AddressWidth::kByte1,
+    std::endian::big>
+    kBigEndian{};
+
+constexpr MemoryAccessProtocol::Specification_t<
+    MemoryAccessProtocol::AddressWidth::kByte1,
+    std::endian::little>
+    kLittleEndian{};
+
+using WhoAmI   = Register_t<0x0F, uint8_t, RegisterAccess::kReadOnly>;
+using Control  = Register_t<0x20, uint8_t>;
+using Command  = Register_t<0x21, uint8_t, RegisterAccess::kWriteOnly>;
+using Pressure = Register_t<0x28, uint32_t, RegisterAccess::kReadWrite, 3>;
+using Samples  = Register_t<0x30, std::array<int16_t, 3>>;
+using Missing  = Register_t<0x40, uint8_t>;
+
+template <auto specification>
+using TestMap =
+    RegisterMap<specification, WhoAmI, Control, Command, Pressure, Samples>;
+
+template <typename Map, typename Register>
+concept CanRead = requires(Map map)
+{
+  map.template Read<Register>();
+};
+
+template <typename Map, typename Register>
+concept CanWrite = requires(Map map, typename Register::ValueType value)
+{
+  map.template Write<Register>(value);
+};
+
+static_assert(CanRead<TestMap<kBigEndian>, WhoAmI>);
+static_assert(!CanWrite<TestMap<kBigEndian>, WhoAmI>);
+static_assert(CanWrite<TestMap<kBigEndian>, Command>);
+static_assert(!CanRead<TestMap<kBigEndian>, Command>);
+static_assert(CanRead<TestMap<kBigEndian>, Control>);
+static_assert(CanWrite<TestMap<kBigEndian>, Control>);
+static_assert(!CanRead<TestMap<kBigEndian>, Missing>);
+static_assert(!CanWrite<TestMap<kBigEndian>, Missing>);
+}  // namespace
+
+TEST_CASE("Testing RegisterMap")
+{
+  MockProtocol<MemoryAccessProtocol::AddressWidth::kByte1> protocol;
+  protocol.memory_map.fill(0);
+
+  SECTION("Read() single byte register")
+  {
+    // Setup
+    TestMap<kBigEndian> map(protocol);
+    protocol.memory_map[0x0F] = 0x33;
+
+    // Exercise
+    uint8_t value = map.Read<WhoAmI>();
+
+    // Verify
+    CHECK(0x33 == value);
+  }
+
+  SECTION("Write() single byte register")
+  {
+    // Setup
+    TestMap<kBigEndian> map(protocol);
+
+    // Exercise
+    map.Write<Control>(0x57);
+    map.Write<Command>(0xA5);
+
+    // Verify
+    CHECK(0x57 == protocol.memory_map[0x20]);
+    CHECK(0xA5 == protocol.memory_map[0x21]);
+  }
+
+  SECTION("Register narrower than its type (big endian)")
+  {
+    // Setup
+    TestMap<kBigEndian> map(protocol);
+
+    // Exercise
+    map.Write<Pressure>(0x00'12'34'56);
+    uint32_t value = map.Read<Pressure>();
+
+    // Verify
+    CHECK(0x12 == protocol.memory_map[0x28]);
+    CHECK(0x34 == protocol.memory_map[0x29]);
+    CHECK(0x56 == protocol.memory_map[0x2A]);
+    // The byte following the register is left untouched.
+    CHECK(0x00 == protocol.memory_map[0x2B]);
+    CHECK(0x00'12'34'56 == value);
+  }
+
+  SECTION("Register narrower than its type (little endian)")
+  {
+    // Setup
+    TestMap<kLittleEndian> map(protocol);
+
+    // Exercise
+    map.Write<Pressure>(0x00'12'34'56);
+    uint32_t value = map.Read<Pressure>();
+
+    // Verify
+    CHECK(0x56 == protocol.memory_map[0x28]);
+    CHECK(0x34 == protocol.memory_map[0x29]);
+    CHECK(0x12 == protocol.memory_map[0x2A]);
+    CHECK(0x00'12'34'56 == value);
+  }
+
+  SECTION("Array of integers")
+  {
+    // Setup
+    TestMap<kBigEndian> map(protocol);
+    const std::array<int16_t, 3> kSamples = { 0x0102, -2, 0x7FFF };
+
+    // Exercise
+    map.Write<Samples>(kSamples);
+    std::array<int16_t, 3> samples = map.Read<Samples>();
+
+    // Verify
+    CHECK(0x01 == protocol.memory_map[0x30]);
+    CHECK(0x02 == protocol.memory_map[0x31]);
+    CHECK(0xFF == protocol.memory_map[0x32]);
+    CHECK(0xFE == protocol.memory_map[0x33]);
+    CHECK(0x7F == protocol.memory_map[0x34]);
+    CHECK(0xFF == protocol.memory_map[0x35]);
+    CHECK(kSamples == samples);
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,592 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/peripherals/storage.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/math/crc.hpp>
+#include <libcore/utility/math/units.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Options for SdCard.
+struct SdCardConfig_t
+{
+  /// Fastest clock rate to use after initialization. The card's own
+  /// maximum is used if it is lower.
+  units::frequency::hertz_t clock_rate = 25_MHz;
+  /// Check the CRC of every command and data block.
+  bool check_crc = false;
+  /// Time the card may take to leave its idle state after power up.
+  std::chrono::nanoseconds initialization_timeout = 1s;
+  /// Time the card may take to send a block or finish programming one.
+  std::chrono::nanoseconds transfer_timeout = 500ms;
+  /// Number of blocks reported by GetTransferHints().
+  size_t optimal_blocks = 16;
+};
+
+/// Driver for SD and SDHC/SDXC cards in SPI mode.
+///
+/// The card is brought up at 400kHz, as the SD specification requires, then
+/// the clock is raised to the lower of the card's maximum transfer rate, read
+/// from its CSD register, and `SdCardConfig_t::clock_rate`.
+///
+/// Reads and writes of more than one block use the multi-block commands,
+/// READ_MULTIPLE_BLOCK (CMD18) and WRITE_MULTIPLE_BLOCK (CMD25), so the card
+/// streams the blocks back to back instead of paying the command, access and
+/// programming latency of each one. Multi-block writes are preceded by
+/// SET_WR_BLK_ERASE_COUNT (ACMD23), which lets the card pre-erase the whole
+/// range. The multi-buffer Read() and Write() perform all of their buffers as
+/// a single command, so a filesystem can gather scattered buffers into one
+/// transfer. Block data moves in single Spi transfers, which DMA capable Spi
+/// drivers perform without the CPU.
+///
+/// The CRC of commands is always sent, since the card checks it before it
+/// enters SPI mode. With `SdCardConfig_t::check_crc`, the card is asked to
+/// check the CRC of every command and written block, and the CRC of every
+/// block read is checked, at the cost of a table lookup per byte.
+///
+/// SD cards do not need to be erased before they are written, so Erase() does
+/// nothing.
+///
+/// USAGE:
+///
+///    sjsu::SdCard sd_card(spi2, chip_select, { .clock_rate = 24_MHz });
+///    sjsu::BlockCache<8> cache(sd_card);
+///    cache.Initialize();
+class SdCard : public Storage
+{
+ public:
+  /// Number of bytes in a block.
+  static constexpr size_t kBlockSize = 512;
+  /// Clock rate used while the card is being initialized.
+  static constexpr units::frequency::hertz_t kInitializationClockRate =
+      400_kHz;
+
+  /// @param spi - SPI bus the card is attached to.
+  /// @param chip_select - chip select pin of the card. It is active LOW.
+  /// @param config - options for the driver.
+  /// @param card_detect - card detect switch of the socket, which is LOW when
+  ///        a card is inserted. If null, a card is assumed to be present.
+  SdCard(Spi & spi,
+         Gpio & chip_select,
+         SdCardConfig_t config = {},
+         Gpio * card_detect    = nullptr)
+      : spi_(spi),
+        chip_select_(chip_select),
+        config_(config),
+        card_detect_(card_detect)
+  {
+  }
+
+  /// @throw sjsu::Exception - std::errc::no_such_device if no card responds,
+  ///        std::errc::not_supported if the card does not support the
+  ///        voltage range of SPI mode hosts, and std::errc::timed_out if the
+  ///        card does not finish initializing.
+  void ModuleInitialize() override
+  {
+    chip_select_.Initialize();
+    chip_select_.SetAsOutput();
+    chip_select_.SetHigh();
+    if (card_detect_)
+    {
+      card_detect_->Initialize();
+      card_detect_->SetAsInput();
+    }
+
+    spi_.settings.clock_rate = kInitializationClockRate;
+    spi_.settings.polarity   = SpiSettings_t::Polarity::kIdleLow;
+    spi_.settings.phase      = SpiSettings_t::Phase::kSampleLeading;
+    spi_.settings.frame_size = SpiSettings_t::FrameSize::kEightBits;
+    spi_.Initialize();
+
+    // At least 74 clocks with chip select HIGH so the card finishes powering
+    // up before its first command.
+    spi_.Transfer(Filler(10), {});
+
+    {
+      Selection selection(*this);
+      Identify();
+    }
+    spi_.settings.clock_rate = std::min(config_.clock_rate, max_clock_rate_);
+    spi_.Initialize();
+  }
+
+  Type GetMemoryType() override
+  {
+    return Type::kSD;
+  }
+
+  bool IsMediaPresent() override
+  {
+    return card_detect_ == nullptr || !card_detect_->Read();
+  }
+
+  bool IsReadOnly() override
+  {
+    return read_only_;
+  }
+
+  units::data::byte_t GetCapacity() override
+  {
+    return units::data::byte_t{ static_cast<float>(capacity_) };
+  }
+
+  units::data::byte_t GetBlockSize() override
+  {
+    return units::data::byte_t{ kBlockSize };
+  }
+
+  TransferHints_t GetTransferHints() override
+  {
+    return { .optimal_blocks = config_.optimal_blocks, .alignment = 4 };
+  }
+
+  void Erase(uint32_t, size_t) override {}
+
+  /// @throw sjsu::Exception - std::errc::invalid_argument if `data` is not a
+  ///        whole number of blocks, std::errc::io_error if the card rejects
+  ///        the write and std::errc::timed_out if the card stays busy.
+  void Write(uint32_t block_address, std::span<const uint8_t> data) override
+  {
+    const std::array<std::span<const uint8_t>, 1> kBuffers = { data };
+    Write(block_address, kBuffers);
+  }
+
+  /// Reads may end part way into a block, the rest of the block is skipped.
+  ///
+  /// @throw sjsu::Exception - std::errc::io_error if the card reports an
+  ///        error or a block fails its CRC, and std::errc::timed_out if the
+  ///        card does not send a block.
+  void Read(uint32_t block_address, std::span<uint8_t> data) override
+  {
+    const std::array<std::span<uint8_t>, 1> kBuffers = { data };
+    Read(block_address, kBuffers);
+  }
+
+  /// Write every buffer with a single command. Every buffer must be a whole
+  /// number of blocks.
+  void Write(uint32_t block_address,
+             std::span<const std::span<const uint8_t>> buffers) override
+  {
+    size_t blocks = 0;
+    for (const auto & buffer : buffers)
+    {
+      if (buffer.size() % kBlockSize != 0)
+      {
+        throw Exception(std::errc::invalid_argument,
+                        "SD card writes must be whole blocks.");
+      }
+      blocks += buffer.size() / kBlockSize;
+    }
+    if (blocks == 0)
+    {
+      return;
+    }
+
+    Selection selection(*this);
+    if (blocks == 1)
+    {
+      Expect(Command(kWriteBlock, Address(block_address)));
+      SendBlock(kStartBlockToken, FirstNonEmpty(buffers));
+      return;
+    }
+
+    Expect(Command(kSetWriteEraseCount, static_cast<uint32_t>(blocks)));
+    Expect(Command(kWriteMultipleBlock, Address(block_address)));
+    for (const auto & buffer : buffers)
+    {
+      for (size_t offset = 0; offset < buffer.size(); offset += kBlockSize)
+      {
+        SendBlock(kStartMultipleBlockToken,
+                  buffer.subspan(offset, kBlockSize));
+      }
+    }
+    spi_.Transfer(kStopTransmissionToken);
+    spi_.Transfer(Spi::kFillerByte);
+    WaitUntilReady();
+  }
+
+  /// Read every buffer with a single command. Only the last buffer may end
+  /// part way into a block.
+  void Read(uint32_t block_address,
+            std::span<const std::span<uint8_t>> buffers) override
+  {
+    size_t blocks = 0;
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+      if (i + 1 < buffers.size() && buffers[i].size() % kBlockSize != 0)
+      {
+        throw Exception(std::errc::invalid_argument,
+                        "Only the last buffer can end part way into a block.");
+      }
+      blocks += (buffers[i].size() + kBlockSize - 1) / kBlockSize;
+    }
+    if (blocks == 0)
+    {
+      return;
+    }
+
+    Selection selection(*this);
+    if (blocks == 1)
+    {
+      Expect(Command(kReadBlock, Address(block_address)));
+      ReceiveBlock(FirstNonEmpty(buffers));
+      return;
+    }
+
+    Expect(Command(kReadMultipleBlock, Address(block_address)));
+    try
+    {
+      for (const auto & buffer : buffers)
+      {
+        for (size_t offset = 0; offset < buffer.size(); offset += kBlockSize)
+        {
+          ReceiveBlock(buffer.subspan(
+              offset, std::min(kBlockSize, buffer.size() - offset)));
+        }
+      }
+    }
+    catch (...)
+    {
+      Command(kStopTransmission, 0);
+      throw;
+    }
+    Expect(Command(kStopTransmission, 0));
+    WaitUntilReady();
+  }
+
+  /// @return true if the card is SDHC or SDXC, which are addressed by block
+  ///         rather than by byte.
+  bool IsHighCapacity() const
+  {
+    return high_capacity_;
+  }
+
+  /// @return units::frequency::hertz_t - the card's maximum clock rate, read
+  ///         from its CSD register.
+  units::frequency::hertz_t GetMaximumClockRate() const
+  {
+    return max_clock_rate_;
+  }
+
+ private:
+  // Commands. Application specific commands (ACMDs) are marked with
+  // kApplicationCommand and are preceded by APP_CMD (CMD55).
+  static constexpr uint8_t kApplicationCommand = 0x80;
+  static constexpr uint8_t kGoIdleState        = 0;
+  static constexpr uint8_t kSendInterfaceCond  = 8;
+  static constexpr uint8_t kSendCsd            = 9;
+  static constexpr uint8_t kStopTransmission   = 12;
+  static constexpr uint8_t kSetBlockLength     = 16;
+  static constexpr uint8_t kReadBlock          = 17;
+  static constexpr uint8_t kReadMultipleBlock  = 18;
+  static constexpr uint8_t kWriteBlock         = 24;
+  static constexpr uint8_t kWriteMultipleBlock = 25;
+  static constexpr uint8_t kApplicationPrefix  = 55;
+  static constexpr uint8_t kReadOcr            = 58;
+  static constexpr uint8_t kCrcOnOff           = 59;
+  static constexpr uint8_t kSetWriteEraseCount = kApplicationCommand | 23;
+  static constexpr uint8_t kSendOpCondition    = kApplicationCommand | 41;
+
+  // R1 response bits.
+  static constexpr uint8_t kIdle           = 0x01;
+  static constexpr uint8_t kIllegalCommand = 0x04;
+
+  // Data tokens.
+  static constexpr uint8_t kStartBlockToken         = 0xFE;
+  static constexpr uint8_t kStartMultipleBlockToken = 0xFC;
+  static constexpr uint8_t kStopTransmissionToken   = 0xFD;
+  static constexpr uint8_t kDataResponseMask        = 0x1F;
+  static constexpr uint8_t kDataAccepted            = 0x05;
+
+  /// Bytes clocked out while receiving or skipping data.
+  static constexpr std::array<uint8_t, kBlockSize> kFiller = [] {
+    std::array<uint8_t, kBlockSize> filler;
+    filler.fill(Spi::kFillerByte);
+    return filler;
+  }();
+
+  static std::span<const uint8_t> Filler(size_t length)
+  {
+    return std::span(kFiller).first(length);
+  }
+
+  template <typename Buffer>
+  static Buffer FirstNonEmpty(std::span<const Buffer> buffers)
+  {
+    return *std::find_if(buffers.begin(), buffers.end(), [](Buffer buffer) {
+      return !buffer.empty();
+    });
+  }
+
+  /// Selects the card for its lifetime. Deselecting sends one more byte so
+  /// the card releases MISO.
+  class Selection
+  {
+   public:
+    explicit Selection(SdCard & card) : card_(card)
+    {
+      card_.chip_select_.SetLow();
+    }
+
+    ~Selection()
+    {
+      card_.chip_select_.SetHigh();
+      card_.spi_.Transfer(Spi::kFillerByte);
+    }
+
+   private:
+    SdCard & card_;
+  };
+
+  void Identify()
+  {
+    uint8_t response = kIllegalCommand;
+    for (int attempt = 0; attempt < 10 && response != kIdle; attempt++)
+    {
+      response = Command(kGoIdleState, 0);
+    }
+    if (response != kIdle)
+    {
+      throw Exception(std::errc::no_such_device,
+                      "No SD card responded to GO_IDLE_STATE.");
+    }
+
+    if (config_.check_crc)
+    {
+      Command(kCrcOnOff, 1);
+    }
+
+    // Cards before version 2.00 do not know SEND_IF_COND.
+    std::array<uint8_t, 4> condition;
+    const bool kVersion2 =
+        !(Command(kSendInterfaceCond, 0x1AA, condition) & kIllegalCommand);
+    if (kVersion2 && (condition[2] != 0x01 || condition[3] != 0xAA))
+    {
+      throw Exception(std::errc::not_supported,
+                      "SD card does not support 2.7V to 3.6V.");
+    }
+
+    const uint32_t kHostCapacitySupport = kVersion2 ? (1 << 30) : 0;
+    if (!Wait(config_.initialization_timeout, [this, kHostCapacitySupport] {
+          return Command(kSendOpCondition, kHostCapacitySupport) == 0;
+        }))
+    {
+      throw Exception(std::errc::timed_out,
+                      "SD card did not leave its idle state.");
+    }
+
+    high_capacity_ = false;
+    if (kVersion2)
+    {
+      std::array<uint8_t, 4> ocr;
+      Expect(Command(kReadOcr, 0, ocr));
+      high_capacity_ = ocr[0] & (1 << 6);
+    }
+    if (!high_capacity_)
+    {
+      Expect(Command(kSetBlockLength, kBlockSize));
+    }
+
+    std::array<uint8_t, 16> csd;
+    Expect(Command(kSendCsd, 0));
+    ReceiveBlock(csd, csd.size());
+    ParseCsd(csd);
+  }
+
+  void ParseCsd(std::span<const uint8_t> csd)
+  {
+    // Fields are numbered by bit, where bit 127 is the top bit of byte 0.
+    auto field = [csd](size_t high, size_t low) {
+      uint32_t value = 0;
+      for (size_t bit = high + 1; bit-- > low;)
+      {
+        const uint8_t kByte = csd[15 - (bit / 8)];
+        value = (value << 1) | ((kByte >> (bit % 8)) & 1);
+      }
+      return value;
+    };
+
+    if (field(127, 126) == 1)
+    {
+      capacity_ = (uint64_t{ field(69, 48) } + 1) * 512 * 1024;
+    }
+    else
+    {
+      const uint32_t kShift = field(49, 47) + 2 + field(83, 80);
+      capacity_ = (uint64_t{ field(73, 62) } + 1) << kShift;
+    }
+
+    // TRAN_SPEED: a rate unit of 100kbit/s times a power of 10 and a
+    // multiplier in tenths.
+    static constexpr std::array<uint32_t, 16> kTenths = {
+      0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80,
+    };
+    uint32_t rate = 10'000 * kTenths[field(102, 99)];
+    for (uint32_t i = 0; i < field(98, 96); i++)
+    {
+      rate *= 10;
+    }
+    max_clock_rate_ = units::frequency::hertz_t(rate);
+
+    read_only_ = field(13, 13) || field(12, 12);
+  }
+
+  uint32_t Address(uint32_t block_address) const
+  {
+    return high_capacity_ ? block_address
+                          : block_address * static_cast<uint32_t>(kBlockSize);
+  }
+
+  /// Send a command and return its R1 response, reading any bytes that
+  /// follow it into `extra`.
+  uint8_t Command(uint8_t command,
+                  uint32_t argument,
+                  std::span<uint8_t> extra = {})
+  {
+    if (command & kApplicationCommand)
+    {
+      const uint8_t kResponse = Command(kApplicationPrefix, 0);
+      if (kResponse & ~kIdle)
+      {
+        return kResponse;
+      }
+      command &= ~kApplicationCommand;
+    }
+
+    // Before the first command the card may not be driving MISO yet.
+    if (command != kGoIdleState && command != kStopTransmission)
+    {
+      WaitUntilReady();
+    }
+
+    std::array<uint8_t, 6> frame = {
+      static_cast<uint8_t>(0x40 | command),
+      static_cast<uint8_t>(argument >> 24),
+      static_cast<uint8_t>(argument >> 16),
+      static_cast<uint8_t>(argument >> 8),
+      static_cast<uint8_t>(argument),
+    };
+    frame[5] = static_cast<uint8_t>(
+        (crc::Crc7(std::span(frame).first(5)) << 1) | 1);
+    spi_.Transfer(frame, {});
+
+    // A block may still be arriving when reading stops, so the byte after
+    // STOP_TRANSMISSION is skipped.
+    if (command == kStopTransmission)
+    {
+      spi_.Transfer(Spi::kFillerByte);
+    }
+
+    uint8_t response = Spi::kFillerByte;
+    for (int i = 0; i < 10 && (response & 0x80); i++)
+    {
+      response = spi_.Transfer(Spi::kFillerByte);
+    }
+    if (!(response & 0x80) && !extra.empty())
+    {
+      spi_.Transfer(Filler(extra.size()), extra);
+    }
+    return response;
+  }
+
+  void Expect(uint8_t response)
+  {
+    if (response != 0)
+    {
+      throw Exception(std::errc::io_error, "SD card rejected a command.");
+    }
+  }
+
+  void WaitUntilReady()
+  {
+    if (!Wait(config_.transfer_timeout, [this] {
+          return spi_.Transfer(Spi::kFillerByte) == Spi::kFillerByte;
+        }))
+    {
+      throw Exception(std::errc::timed_out, "SD card stayed busy.");
+    }
+  }
+
+  /// Receive a data block into `data`, skipping any bytes of the block past
+  /// its end.
+  void ReceiveBlock(std::span<uint8_t> data, size_t block_size = kBlockSize)
+  {
+    uint8_t token = Spi::kFillerByte;
+    if (!Wait(config_.transfer_timeout, [this, &token] {
+          token = spi_.Transfer(Spi::kFillerByte);
+          return token != Spi::kFillerByte;
+        }))
+    {
+      throw Exception(std::errc::timed_out, "SD card did not send a block.");
+    }
+    if (token != kStartBlockToken)
+    {
+      throw Exception(std::errc::io_error, "SD card sent a read error.");
+    }
+
+    spi_.Transfer(Filler(data.size()), data);
+    uint16_t crc = config_.check_crc ? crc::Crc16(data) : 0;
+
+    std::array<uint8_t, 32> skipped;
+    for (size_t left = block_size - data.size(); left > 0;)
+    {
+      const size_t kLength = std::min(left, skipped.size());
+      const auto kChunk    = std::span(skipped).first(kLength);
+      spi_.Transfer(Filler(kLength), kChunk);
+      crc = config_.check_crc ? crc::Crc16(kChunk, crc) : 0;
+      left -= kLength;
+    }
+
+    std::array<uint8_t, 2> received_crc;
+    spi_.Transfer(Filler(2), received_crc);
+    if (config_.check_crc &&
+        crc != ((received_crc[0] << 8) | received_crc[1]))
+    {
+      throw Exception(std::errc::io_error, "SD card block failed its CRC.");
+    }
+  }
+
+  void SendBlock(uint8_t token, std::span<const uint8_t> data)
+  {
+    const uint16_t kCrc = config_.check_crc ? crc::Crc16(data) : 0xFFFF;
+    const std::array<uint8_t, 2> kCrcBytes = {
+      static_cast<uint8_t>(kCrc >> 8),
+      static_cast<uint8_t>(kCrc),
+    };
+    const std::array<uint8_t, 1> kToken = { token };
+    const std::array<Spi::Segment_t, 3> kSegments = {
+      Spi::Segment_t{ .transmit = kToken },
+      Spi::Segment_t{ .transmit = data },
+      Spi::Segment_t{ .transmit = kCrcBytes },
+    };
+    spi_.Transfer(kSegments);
+
+    const uint8_t kResponse = spi_.Transfer(Spi::kFillerByte);
+    if ((kResponse & kDataResponseMask) != kDataAccepted)
+    {
+      throw Exception(std::errc::io_error, "SD card rejected a block.");
+    }
+    WaitUntilReady();
+  }
+
+  Spi & spi_;
+  Gpio & chip_select_;
+  SdCardConfig_t config_;
+  Gpio * card_detect_;
+  bool high_capacity_                       = false;
+  bool read_only_                           = false;
+  uint64_t capacity_                        = 0;
+  units::frequency::hertz_t max_clock_rate_ = kInitializationClockRate;
+};
+}  // namespace sjsu
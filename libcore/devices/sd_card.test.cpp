@@ -0,0 +1,480 @@
+#include <libcore/devices/sd_card.hpp>
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Models an SD card in SPI mode behind a Spi, one byte at a time.
+class SimulatedSdCard : public Spi
+{
+ public:
+  static constexpr size_t kBlocks = 2048;
+
+  explicit SimulatedSdCard(bool high_capacity = true)
+      : memory(kBlocks * 512, 0), high_capacity_(high_capacity)
+  {
+    csd.fill(0);
+    // TRAN_SPEED of 25Mbit/s.
+    csd[3] = 0x32;
+    if (high_capacity)
+    {
+      // CSD version 2.0, C_SIZE of 1: 1MiB.
+      SetCsdField(127, 126, 1);
+      SetCsdField(69, 48, 1);
+    }
+    else
+    {
+      // CSD version 1.0, READ_BL_LEN 9, C_SIZE_MULT 7, C_SIZE 3: 1MiB.
+      SetCsdField(83, 80, 9);
+      SetCsdField(49, 47, 7);
+      SetCsdField(73, 62, 3);
+    }
+  }
+
+  void ModuleInitialize() override
+  {
+    clock_rates.push_back(settings.clock_rate);
+  }
+
+  void Transfer(std::span<uint8_t> buffer) override
+  {
+    for (uint8_t & byte : buffer)
+    {
+      byte = Exchange(byte);
+    }
+  }
+
+  void Transfer(std::span<uint16_t>) override {}
+
+  void SetCsdField(size_t high, size_t low, uint32_t value)
+  {
+    for (size_t bit = low; bit <= high; bit++, value >>= 1)
+    {
+      const auto kMask = static_cast<uint8_t>(1 << (bit % 8));
+      uint8_t & byte   = csd[15 - (bit / 8)];
+      byte = static_cast<uint8_t>((value & 1) ? (byte | kMask)
+                                              : (byte & ~kMask));
+    }
+  }
+
+  /// @return std::span<uint8_t> - contents of `block`.
+  std::span<uint8_t> Block(size_t block)
+  {
+    return std::span(memory).subspan(block * 512, 512);
+  }
+
+  std::vector<uint8_t> memory;
+  std::array<uint8_t, 16> csd;
+  /// Each command received, with 0x80 added to application commands.
+  std::vector<uint8_t> commands;
+  std::vector<units::frequency::hertz_t> clock_rates;
+  uint32_t erase_count = 0;
+  bool crc_enabled     = false;
+  bool corrupt_reads   = false;
+
+ private:
+  uint8_t Exchange(uint8_t in)
+  {
+    if (output_.empty() && streaming_ && next_block_ < kBlocks)
+    {
+      QueueBlock(Block(next_block_++));
+    }
+
+    uint8_t out = 0xFF;
+    if (!output_.empty())
+    {
+      out = output_.front();
+      output_.pop_front();
+    }
+
+    if (writing_)
+    {
+      ReceiveData(in);
+    }
+    else if (!command_.empty() || (in & 0xC0) == 0x40)
+    {
+      command_.push_back(in);
+      if (command_.size() == 6)
+      {
+        Execute();
+        command_.clear();
+      }
+    }
+    return out;
+  }
+
+  void Execute()
+  {
+    const uint8_t kIndex     = command_[0] & 0x3F;
+    const uint32_t kArgument = (command_[1] << 24) | (command_[2] << 16) |
+                               (command_[3] << 8) | command_[4];
+    const bool kApplication  = application_;
+    application_             = false;
+    commands.push_back(static_cast<uint8_t>(kApplication << 7 | kIndex));
+
+    const uint8_t kCrc = crc::Crc7(std::span(command_).first(5));
+    if (command_[5] != ((kCrc << 1) | 1))
+    {
+      Respond(0x08);
+      return;
+    }
+
+    const size_t kBlock = high_capacity_ ? kArgument : kArgument / 512;
+    const uint8_t kR1   = idle_ ? 0x01 : 0x00;
+    switch (kIndex)
+    {
+      case 0:
+        idle_ = true;
+        Respond(0x01);
+        break;
+      case 8:
+        Respond(kR1, { 0, 0, static_cast<uint8_t>((kArgument >> 8) & 0xF),
+                       static_cast<uint8_t>(kArgument) });
+        break;
+      case 9:
+        Respond(kR1);
+        QueueBlock(csd);
+        break;
+      case 12:
+        streaming_ = false;
+        output_    = { 0xFF, 0x00, 0x00 };
+        break;
+      case 16: Respond(kR1); break;
+      case 17:
+        Respond(kR1);
+        QueueBlock(Block(kBlock));
+        break;
+      case 18:
+        Respond(kR1);
+        streaming_  = true;
+        next_block_ = kBlock;
+        break;
+      case 24:
+      case 25:
+        Respond(kR1);
+        writing_     = true;
+        multiple_    = (kIndex == 25);
+        write_block_ = kBlock;
+        break;
+      case 55:
+        application_ = true;
+        Respond(kR1);
+        break;
+      case 58:
+        Respond(kR1, { static_cast<uint8_t>(high_capacity_ ? 0xC0 : 0x80),
+                       0xFF, 0x80, 0x00 });
+        break;
+      case 59:
+        crc_enabled = kArgument & 1;
+        Respond(kR1);
+        break;
+      default:
+        if (kApplication && kIndex == 23)
+        {
+          erase_count = kArgument;
+          Respond(kR1);
+        }
+        else if (kApplication && kIndex == 41)
+        {
+          // Leaves the idle state on the second poll.
+          idle_ = (++operating_condition_polls_ < 2);
+          Respond(idle_ ? 0x01 : 0x00);
+        }
+        else
+        {
+          Respond(kR1 | 0x04);
+        }
+        break;
+    }
+  }
+
+  void ReceiveData(uint8_t in)
+  {
+    if (data_.empty() && in == 0xFD)
+    {
+      writing_ = false;
+      output_  = { 0xFF, 0x00, 0x00 };
+      return;
+    }
+    if (data_.empty() && in != 0xFE && in != 0xFC)
+    {
+      return;
+    }
+
+    data_.push_back(in);
+    if (data_.size() < 1 + 512 + 2)
+    {
+      return;
+    }
+
+    const auto kData    = std::span(data_).subspan(1, 512);
+    const uint16_t kCrc = static_cast<uint16_t>(data_[513] << 8 | data_[514]);
+    if (crc_enabled && kCrc != crc::Crc16(kData))
+    {
+      output_ = { 0x0B };
+    }
+    else
+    {
+      std::copy(kData.begin(), kData.end(), Block(write_block_++).begin());
+      output_ = { 0x05, 0x00, 0x00 };
+    }
+    data_.clear();
+    writing_ = multiple_;
+  }
+
+  void Respond(uint8_t r1, std::initializer_list<uint8_t> extra = {})
+  {
+    output_.push_back(0xFF);
+    output_.push_back(r1);
+    output_.insert(output_.end(), extra);
+  }
+
+  void QueueBlock(std::span<const uint8_t> data)
+  {
+    const uint16_t kCrc = crc::Crc16(data);
+    output_.push_back(0xFF);
+    output_.push_back(0xFE);
+    output_.insert(output_.end(), data.begin(), data.end());
+    if (corrupt_reads)
+    {
+      output_[output_.size() - 1] ^= 1;
+    }
+    output_.push_back(static_cast<uint8_t>(kCrc >> 8));
+    output_.push_back(static_cast<uint8_t>(kCrc));
+  }
+
+  bool high_capacity_;
+  std::deque<uint8_t> output_;
+  std::vector<uint8_t> command_;
+  std::vector<uint8_t> data_;
+  bool idle_                     = true;
+  bool application_              = false;
+  bool streaming_                = false;
+  bool writing_                  = false;
+  bool multiple_                 = false;
+  size_t next_block_             = 0;
+  size_t write_block_            = 0;
+  int operating_condition_polls_ = 0;
+};
+
+std::vector<uint8_t> Pattern(size_t length, uint8_t seed)
+{
+  std::vector<uint8_t> pattern(length);
+  for (size_t i = 0; i < length; i++)
+  {
+    pattern[i] = static_cast<uint8_t>(seed + i * 7);
+  }
+  return pattern;
+}
+}  // namespace
+
+TEST_CASE("Testing SdCard")
+{
+  SimulatedSdCard card;
+  Gpio & chip_select = GetInactive<sjsu::Gpio>();
+
+  SECTION("Initialize() identifies the card and raises the clock")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select, { .clock_rate = 50_MHz });
+
+    // Exercise
+    sd_card.Initialize();
+
+    // Verify
+    const std::vector<uint8_t> kExpected = { 0, 8, 55, 0x80 | 41, 55,
+                                             0x80 | 41, 58, 9 };
+    CHECK(kExpected == card.commands);
+    CHECK(sd_card.IsHighCapacity());
+    CHECK(1024 * 1024 == sd_card.GetCapacity().to<size_t>());
+    CHECK(512 == sd_card.GetBlockSize().to<size_t>());
+    CHECK(!sd_card.IsReadOnly());
+    CHECK(Storage::Type::kSD == sd_card.GetMemoryType());
+    REQUIRE(2 == card.clock_rates.size());
+    CHECK(400_kHz == card.clock_rates[0]);
+    // Limited by the TRAN_SPEED of the card.
+    CHECK(25_MHz == card.clock_rates[1]);
+  }
+
+  SECTION("Initialize() keeps to a clock rate lower than the card's")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select, { .clock_rate = 8_MHz });
+
+    // Exercise
+    sd_card.Initialize();
+
+    // Verify
+    CHECK(25_MHz == sd_card.GetMaximumClockRate());
+    CHECK(8_MHz == card.clock_rates.back());
+  }
+
+  SECTION("Initialize() throws if no card responds")
+  {
+    // Setup
+    SdCard sd_card(GetInactive<sjsu::Spi>(), chip_select);
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(sd_card.Initialize(), std::errc::no_such_device);
+  }
+
+  SECTION("Multi-block writes pre-erase and use WRITE_MULTIPLE_BLOCK")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select);
+    sd_card.Initialize();
+    card.commands.clear();
+    const auto kData = Pattern(4 * 512, 3);
+
+    // Exercise
+    sd_card.Write(10, kData);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 55, 0x80 | 23, 25 } == card.commands);
+    CHECK(4 == card.erase_count);
+    CHECK(std::equal(kData.begin(), kData.end(), card.Block(10).begin()));
+  }
+
+  SECTION("Multi-block reads use READ_MULTIPLE_BLOCK and stop it")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select);
+    sd_card.Initialize();
+    card.commands.clear();
+    const auto kData = Pattern(3 * 512, 11);
+    std::copy(kData.begin(), kData.end(), card.Block(20).begin());
+    std::vector<uint8_t> read(3 * 512);
+
+    // Exercise
+    sd_card.Read(20, read);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 18, 12 } == card.commands);
+    CHECK(kData == read);
+  }
+
+  SECTION("Single blocks use the single block commands")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select);
+    sd_card.Initialize();
+    card.commands.clear();
+    const auto kData = Pattern(512, 5);
+    std::vector<uint8_t> read(100);
+
+    // Exercise
+    sd_card.Write(7, kData);
+    sd_card.Read(7, read);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 24, 17 } == card.commands);
+    CHECK(std::equal(read.begin(), read.end(), kData.begin()));
+  }
+
+  SECTION("Gathered buffers are transferred with a single command")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select);
+    sd_card.Initialize();
+    card.commands.clear();
+    const auto kFirst  = Pattern(512, 1);
+    const auto kSecond = Pattern(2 * 512, 2);
+    const std::array<std::span<const uint8_t>, 2> kWrites = { kFirst,
+                                                               kSecond };
+    std::vector<uint8_t> header(512);
+    std::vector<uint8_t> rest(700);
+    const std::array<std::span<uint8_t>, 2> kReads = { header, rest };
+
+    // Exercise
+    sd_card.Write(30, kWrites);
+    sd_card.Read(30, kReads);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 55, 0x80 | 23, 25, 18, 12 } == card.commands);
+    CHECK(3 == card.erase_count);
+    CHECK(kFirst == header);
+    CHECK(std::equal(rest.begin(), rest.end(), kSecond.begin()));
+  }
+
+  SECTION("Writes of part of a block throw")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select);
+    sd_card.Initialize();
+    const auto kData = Pattern(100, 0);
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(sd_card.Write(0, kData), std::errc::invalid_argument);
+  }
+
+  SECTION("Standard capacity cards are addressed by byte")
+  {
+    // Setup
+    SimulatedSdCard standard_card(false);
+    standard_card.SetCsdField(12, 12, 1);
+    SdCard sd_card(standard_card, chip_select);
+    const auto kData = Pattern(2 * 512, 9);
+    std::copy(kData.begin(), kData.end(), standard_card.Block(3).begin());
+    std::vector<uint8_t> read(2 * 512);
+
+    // Exercise
+    sd_card.Initialize();
+    sd_card.Read(3, read);
+
+    // Verify
+    CHECK(!sd_card.IsHighCapacity());
+    const std::vector<uint8_t> kExpected = {
+      0, 8, 55, 0x80 | 41, 55, 0x80 | 41, 58, 16, 9, 18, 12,
+    };
+    CHECK(kExpected == standard_card.commands);
+    CHECK(1024 * 1024 == sd_card.GetCapacity().to<size_t>());
+    CHECK(sd_card.IsReadOnly());
+    CHECK(kData == read);
+  }
+
+  SECTION("CRC checking enables the card's checks and verifies reads")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select, { .check_crc = true });
+    const auto kData = Pattern(2 * 512, 4);
+    std::vector<uint8_t> read(2 * 512);
+
+    // Exercise
+    sd_card.Initialize();
+    sd_card.Write(0, kData);
+    sd_card.Read(0, read);
+
+    // Verify
+    CHECK(card.crc_enabled);
+    CHECK(kData == read);
+
+    // Exercise
+    card.corrupt_reads = true;
+
+    // Verify
+    SJ2_CHECK_EXCEPTION(sd_card.Read(0, read), std::errc::io_error);
+    SJ2_CHECK_EXCEPTION(sd_card.Read(0, std::span(read).first(512)),
+                        std::errc::io_error);
+  }
+
+  SECTION("Without CRC checking corrupted reads are not detected")
+  {
+    // Setup
+    SdCard sd_card(card, chip_select);
+    sd_card.Initialize();
+    card.corrupt_reads = true;
+    std::vector<uint8_t> read(512);
+
+    // Exercise & Verify
+    CHECK_NOTHROW(sd_card.Read(0, read));
+    CHECK(!card.crc_enabled);
+  }
+}
+}  // namespace sjsu
@@ -3,9 +3,12 @@
 #include <cstdint>
 #include <cstdio>
 #include <algorithm>
+#include <array>
+#include <span>
 
 #include <libcore/peripherals/pwm.hpp>
 #include <libcore/module.hpp>
+#include <libcore/utility/error_handling.hpp>
 #include <libcore/utility/math/map.hpp>
 
 namespace sjsu
@@ -65,6 +68,18 @@ class Servo : public Module<RCServoSettings_t>
   {
     servo_pwm_.settings.frequency = settings.frequency;
     servo_pwm_.Initialize();
+
+    // Cache the conversions of the settings, so that positioning the servo
+    // needs neither units math nor division.
+    waveform_period_ = FrequencyToMicrosecondsValue(settings.frequency);
+    min_angle_       = settings.min_angle.to<float>();
+    max_angle_       = settings.max_angle.to<float>();
+
+    angle_to_duty_cycle_ = LinearMap<float>(
+        min_angle_,
+        max_angle_,
+        static_cast<float>(settings.min_pulse.count()) / waveform_period_,
+        static_cast<float>(settings.max_pulse.count()) / waveform_period_);
   }
 
   /// Set the pulse width in microsecond of the RC servo signal directly.
@@ -73,10 +88,7 @@ class Servo : public Module<RCServoSettings_t>
   void SetPulseWidthInMicroseconds(std::chrono::microseconds pulse_width)
   {
     const auto kPulseWidth = static_cast<float>(pulse_width.count());
-    const auto kWaveformPeriod =
-        FrequencyToMicrosecondsValue(CurrentSettings().frequency);
-
-    servo_pwm_.SetDutyCycle(kPulseWidth / kWaveformPeriod);
+    servo_pwm_.SetDutyCycle(kPulseWidth / waveform_period_);
   }
 
   /// Should only be used after pulse bounds and angle bounds have been set.
@@ -84,20 +96,56 @@ class Servo : public Module<RCServoSettings_t>
   /// @param angle - angle to position the servo to.
   void SetAngle(units::angle::degree_t angle)
   {
-    auto local_settings  = CurrentSettings();
-    const auto kMinPulse = static_cast<float>(local_settings.min_pulse.count());
-    const auto kMaxPulse = static_cast<float>(local_settings.max_pulse.count());
-
-    const auto kClampedAngle =
-        std::clamp(angle, local_settings.min_angle, local_settings.max_angle);
-
-    float pulse_width = Map(kClampedAngle.to<float>(),
-                            local_settings.min_angle.to<float>(),
-                            local_settings.max_angle.to<float>(),
-                            kMinPulse,
-                            kMaxPulse);
-    SetPulseWidthInMicroseconds(
-        std::chrono::microseconds(static_cast<uint32_t>(pulse_width)));
+    servo_pwm_.SetDutyCycle(GetDutyCycle(angle));
+  }
+
+  /// @param angle - angle to position the servo to. Clamped to the angle
+  ///        bounds.
+  /// @return float - the duty cycle of the PWM signal for the angle, from 0.0
+  ///         to 1.0.
+  float GetDutyCycle(units::angle::degree_t angle) const
+  {
+    const float kAngle = std::clamp(angle.to<float>(), min_angle_, max_angle_);
+    return angle_to_duty_cycle_(kAngle);
+  }
+
+  /// Position several servos in one update of a PwmGroup, such as all of the
+  /// servos of a robot on one timer. With a synchronized group, every servo
+  /// moves in the same PWM period.
+  ///
+  /// USAGE:
+  ///
+  ///    std::array<sjsu::Pwm *, 2> pwms     = { &hip_pwm, &knee_pwm };
+  ///    std::array<sjsu::Servo *, 2> servos = { &hip, &knee };
+  ///    sjsu::PwmGroup group(pwms);
+  ///
+  ///    sjsu::Servo::SetAngles(group, servos, std::array{ 45_deg, 30_deg });
+  ///
+  /// @param group - group of the PWM channels of `servos`, in the same order.
+  /// @param servos - initialized servos.
+  /// @param angles - angle to position each servo to.
+  /// @throw sjsu::Exception - std::errc::argument_list_too_long if there are
+  ///        more than PwmGroup::kMaxChannels servos.
+  static void SetAngles(PwmGroup & group,
+                        std::span<Servo * const> servos,
+                        std::span<const units::angle::degree_t> angles)
+  {
+    const size_t kCount = std::min(servos.size(), angles.size());
+    if (kCount > PwmGroup::kMaxChannels)
+    {
+      throw Exception(std::errc::argument_list_too_long,
+                      "Too many servos for a PWM group update.");
+    }
+
+    const float kPeriodTicks = static_cast<float>(group.GetPeriodTicks());
+    std::array<uint32_t, PwmGroup::kMaxChannels> ticks;
+    for (size_t i = 0; i < kCount; i++)
+    {
+      const float kDutyCycle = servos[i]->GetDutyCycle(angles[i]);
+      ticks[i] = static_cast<uint32_t>((kDutyCycle * kPeriodTicks) + 0.5f);
+    }
+
+    group.SetDutyTicks(std::span<const uint32_t>(ticks.data(), kCount));
   }
 
  private:
@@ -108,5 +156,9 @@ class Servo : public Module<RCServoSettings_t>
   }
 
   Pwm & servo_pwm_;
+  float waveform_period_ = 1;
+  float min_angle_       = 0;
+  float max_angle_       = 0;
+  LinearMap<float> angle_to_duty_cycle_;
 };
 }  // namespace sjsu
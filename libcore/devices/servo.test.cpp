@@ -1,4 +1,8 @@
 #include <libcore/devices/servo.hpp>
+
+#include <array>
+#include <vector>
+
 #include <libcore/testing/testing_frameworks.hpp>
 
 namespace sjsu
@@ -71,5 +75,43 @@ TEST_CASE("Testing Servo")
         }))
         .Once();
   }
+
+  SECTION("Write angles through a PWM group")
+  {
+    // Setup
+    Mock<Pwm> mock_other_pwm;
+    Fake(Method(mock_other_pwm, ModuleInitialize));
+    Servo other_servo(mock_other_pwm.get());
+
+    class TickGroup : public PwmGroup
+    {
+     public:
+      using PwmGroup::PwmGroup;
+      uint32_t GetPeriodTicks() override
+      {
+        return 20'000;
+      }
+      void SetDutyTicks(std::span<const uint32_t> new_ticks) override
+      {
+        ticks.assign(new_ticks.begin(), new_ticks.end());
+      }
+      std::vector<uint32_t> ticks;
+    };
+    std::array<Pwm *, 2> pwms     = { &mock_pwm.get(), &mock_other_pwm.get() };
+    std::array<Servo *, 2> servos = { &test_servo, &other_servo };
+    TickGroup group(pwms);
+
+    // 50Hz with the default 0 to 90 degrees and 1000us to 2000us pulses, so
+    // a tick is a microsecond.
+    test_servo.Initialize();
+    other_servo.Initialize();
+
+    // Exercise
+    Servo::SetAngles(group, servos, std::array{ 45_deg, 120_deg });
+
+    // Verify
+    CHECK(group.ticks == std::vector<uint32_t>{ 1500, 2000 });
+    Verify(Method(mock_pwm, SetDutyCycle)).Never();
+  }
 }
 }  // namespace sjsu
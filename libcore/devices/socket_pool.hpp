@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include <libcore/devices/internet_socket.hpp>
+#include <libcore/module.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Settings for the SocketPool.
+struct SocketPoolSettings_t
+{
+  /// Idle connections are closed once unused for this long. Should be
+  /// shorter than the time the server keeps idle connections open.
+  std::chrono::nanoseconds idle_timeout = std::chrono::seconds(30);
+};
+
+/// A fixed set of InternetSockets whose connections are kept open between
+/// requests and reused for the same protocol, host and port, so that
+/// repeated requests do not pay for a TCP or TLS handshake each time.
+///
+/// Acquire() returns a Lease, which gives the socket back to the pool when it
+/// is destroyed, leaving its connection open. An idle connection is checked
+/// with IsConnected() before it is reused, and closed once it has been idle
+/// for longer than the idle timeout. When every socket is connected, the
+/// connection that has been idle the longest is closed to make room.
+///
+/// USAGE:
+///
+///    sjsu::InternetSocket * sockets[] = { &socket0, &socket1 };
+///    sjsu::SocketPool pool(sockets);
+///    pool.Initialize();
+///
+///    if (auto lease = pool.Acquire(
+///            sjsu::InternetSocket::Protocol::kTCP, "example.com", 80, 5s))
+///    {
+///      lease->Write(request, 5s);
+///      size_t length = lease->Read(response, 5s);
+///      if (length == 0)
+///      {
+///        lease.Discard();
+///      }
+///    }
+class SocketPool : public Module<SocketPoolSettings_t>
+{
+ public:
+  /// Longest host name that can be pooled.
+  static constexpr size_t kMaxHostLength = 63;
+
+  /// Use of a connected socket of the pool, until the lease is destroyed.
+  /// It can neither be copied nor moved, so is returned directly into the
+  /// caller's storage by Acquire().
+  class Lease
+  {
+   public:
+    Lease(const Lease &) = delete;
+    Lease & operator=(const Lease &) = delete;
+
+    ~Lease()
+    {
+      if (pool_ != nullptr)
+      {
+        pool_->Release(index_, keep_);
+      }
+    }
+
+    /// @return true - if a connected socket was acquired.
+    explicit operator bool() const
+    {
+      return pool_ != nullptr;
+    }
+
+    /// @return InternetSocket * - the connected socket.
+    InternetSocket * operator->() const
+    {
+      return pool_->slots_[index_].socket;
+    }
+
+    /// @return InternetSocket & - the connected socket.
+    InternetSocket & operator*() const
+    {
+      return *operator->();
+    }
+
+    /// Close the connection when the lease ends, rather than keeping it for
+    /// reuse, such as after an error.
+    void Discard()
+    {
+      keep_ = false;
+    }
+
+   private:
+    friend class SocketPool;
+
+    Lease() = default;
+    Lease(SocketPool & pool, size_t index) : pool_(&pool), index_(index) {}
+
+    SocketPool * pool_ = nullptr;
+    size_t index_      = 0;
+    bool keep_         = true;
+  };
+
+  /// @param sockets - the sockets of the pool, one per connection. Must
+  ///        outlive the pool.
+  explicit SocketPool(std::span<InternetSocket * const> sockets)
+      : slots_{}, size_(std::min(sockets.size(), kMaxSockets))
+  {
+    for (size_t i = 0; i < size_; i++)
+    {
+      slots_[i].socket = sockets[i];
+    }
+  }
+
+  void ModuleInitialize() override
+  {
+    for (size_t i = 0; i < size_; i++)
+    {
+      slots_[i].socket->Initialize();
+    }
+  }
+
+  /// Close every connection that is not leased.
+  void ModulePowerDown() override
+  {
+    for (size_t i = 0; i < size_; i++)
+    {
+      if (slots_[i].state == State::kIdle)
+      {
+        Close(slots_[i]);
+      }
+    }
+  }
+
+  /// Get a socket connected to a host, reusing an idle connection to it if
+  /// there is one that is still connected.
+  ///
+  /// @param protocol - Using TCP or UDP.
+  /// @param host - address of the host.
+  /// @param port - port of the host.
+  /// @param timeout - time to wait for a new connection to be established.
+  /// @return Lease - the socket, empty if every socket is leased or the
+  ///         connection could not be established.
+  /// @throw sjsu::Exception - std::errc::invalid_argument if `host` is longer
+  ///        than kMaxHostLength.
+  Lease Acquire(InternetSocket::Protocol protocol,
+                std::string_view host,
+                uint16_t port,
+                std::chrono::nanoseconds timeout)
+  {
+    if (host.size() > kMaxHostLength)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Host name is too long to be pooled.");
+    }
+
+    CloseIdle();
+
+    for (size_t i = 0; i < size_; i++)
+    {
+      Slot_t & slot = slots_[i];
+      if (slot.state == State::kIdle && slot.Matches(protocol, host, port))
+      {
+        if (slot.socket->IsConnected())
+        {
+          slot.state = State::kLeased;
+          reuses_++;
+          return Lease(*this, i);
+        }
+        Close(slot);
+      }
+    }
+
+    const size_t kIndex = FindFree();
+    if (kIndex == size_)
+    {
+      return Lease();
+    }
+
+    Slot_t & slot = slots_[kIndex];
+    if (!slot.socket->Connect(protocol, host, port, timeout))
+    {
+      return Lease();
+    }
+
+    slot.state    = State::kLeased;
+    slot.protocol = protocol;
+    slot.port     = port;
+    slot.length   = static_cast<uint8_t>(host.size());
+    std::copy(host.begin(), host.end(), slot.host.begin());
+    connects_++;
+    return Lease(*this, kIndex);
+  }
+
+  /// Close the connections that have been idle for longer than the idle
+  /// timeout or have been lost. Called by Acquire(), and may also be called
+  /// periodically to release connections sooner.
+  void CloseIdle()
+  {
+    const auto kNow = Uptime();
+    for (size_t i = 0; i < size_; i++)
+    {
+      Slot_t & slot = slots_[i];
+      if (slot.state == State::kIdle &&
+          (kNow - slot.last_used > settings.idle_timeout ||
+           !slot.socket->IsConnected()))
+      {
+        Close(slot);
+      }
+    }
+  }
+
+  /// @return size_t - number of connections open and not leased.
+  size_t GetIdleCount() const
+  {
+    return Count(State::kIdle);
+  }
+
+  /// @return size_t - number of sockets leased.
+  size_t GetLeasedCount() const
+  {
+    return Count(State::kLeased);
+  }
+
+  /// @return uint32_t - number of times Acquire() reused a connection.
+  uint32_t GetReuses() const
+  {
+    return reuses_;
+  }
+
+  /// @return uint32_t - number of new connections established.
+  uint32_t GetConnects() const
+  {
+    return connects_;
+  }
+
+ private:
+  static constexpr size_t kMaxSockets = 8;
+
+  enum class State : uint8_t
+  {
+    kClosed,
+    kIdle,
+    kLeased,
+  };
+
+  struct Slot_t
+  {
+    InternetSocket * socket           = nullptr;
+    State state                       = State::kClosed;
+    InternetSocket::Protocol protocol = InternetSocket::Protocol::kTCP;
+    uint16_t port                     = 0;
+    uint8_t length                    = 0;
+    std::array<char, kMaxHostLength> host{};
+    std::chrono::nanoseconds last_used{ 0 };
+
+    bool Matches(InternetSocket::Protocol other_protocol,
+                 std::string_view other_host,
+                 uint16_t other_port) const
+    {
+      return protocol == other_protocol && port == other_port &&
+             std::string_view(host.data(), length) == other_host;
+    }
+  };
+
+  void Release(size_t index, bool keep)
+  {
+    Slot_t & slot = slots_[index];
+    if (keep && settings.idle_timeout > std::chrono::nanoseconds(0))
+    {
+      slot.state     = State::kIdle;
+      slot.last_used = Uptime();
+    }
+    else
+    {
+      Close(slot);
+    }
+  }
+
+  /// @return size_t - a closed socket, closing the connection idle the
+  ///         longest if every socket is connected, or size_ if every socket
+  ///         is leased.
+  size_t FindFree()
+  {
+    size_t oldest = size_;
+    for (size_t i = 0; i < size_; i++)
+    {
+      if (slots_[i].state == State::kClosed)
+      {
+        return i;
+      }
+      if (slots_[i].state == State::kIdle &&
+          (oldest == size_ || slots_[i].last_used < slots_[oldest].last_used))
+      {
+        oldest = i;
+      }
+    }
+
+    if (oldest != size_)
+    {
+      Close(slots_[oldest]);
+    }
+    return oldest;
+  }
+
+  void Close(Slot_t & slot)
+  {
+    slot.socket->Close();
+    slot.state = State::kClosed;
+  }
+
+  size_t Count(State state) const
+  {
+    return static_cast<size_t>(
+        std::count_if(slots_.begin(),
+                      slots_.begin() + size_,
+                      [state](const Slot_t & slot) {
+                        return slot.state == state;
+                      }));
+  }
+
+  std::array<Slot_t, kMaxSockets> slots_;
+  size_t size_;
+  uint32_t reuses_   = 0;
+  uint32_t connects_ = 0;
+};
+}  // namespace sjsu
@@ -0,0 +1,181 @@
+#include <libcore/devices/socket_pool.hpp>
+
+#include <string>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// A socket that records its connections.
+class PooledSocket : public InternetSocket
+{
+ public:
+  void ModuleInitialize() override {}
+  bool Connect(Protocol, std::string_view host, uint16_t port,
+               std::chrono::nanoseconds) override
+  {
+    connects++;
+    connected  = accept;
+    this->host = std::string(host) + ":" + std::to_string(port);
+    return accept;
+  }
+  void Write(std::span<const uint8_t>, std::chrono::nanoseconds) override {}
+  size_t Read(std::span<uint8_t>, std::chrono::nanoseconds) override
+  {
+    return 0;
+  }
+  void Close() override
+  {
+    connected = false;
+  }
+  bool IsConnected() override
+  {
+    return connected;
+  }
+
+  int connects   = 0;
+  bool accept    = true;
+  bool connected = false;
+  std::string host;
+};
+
+std::chrono::nanoseconds pool_uptime{ 0 };
+}  // namespace
+
+TEST_CASE("Testing SocketPool")
+{
+  PooledSocket socket0;
+  PooledSocket socket1;
+  InternetSocket * sockets[] = { &socket0, &socket1 };
+  SocketPool test_subject(sockets);
+
+  constexpr auto kTcp     = InternetSocket::Protocol::kTCP;
+  constexpr auto kTimeout = std::chrono::seconds(1);
+
+  pool_uptime = std::chrono::seconds(1);
+  SetUptimeFunction([]() { return pool_uptime; });
+  test_subject.settings.idle_timeout = std::chrono::seconds(10);
+  test_subject.Initialize();
+
+  SECTION("Connection is reused for the same host and port")
+  {
+    // Exercise
+    {
+      auto lease = test_subject.Acquire(kTcp, "example.com", 80, kTimeout);
+      REQUIRE(lease);
+      CHECK(1 == test_subject.GetLeasedCount());
+    }
+    auto lease = test_subject.Acquire(kTcp, "example.com", 80, kTimeout);
+
+    // Verify
+    REQUIRE(lease);
+    CHECK(&socket0 == &*lease);
+    CHECK(1 == socket0.connects);
+    CHECK(1 == test_subject.GetReuses());
+    CHECK(1 == test_subject.GetConnects());
+  }
+
+  SECTION("Other hosts get another socket")
+  {
+    // Exercise
+    auto lease0 = test_subject.Acquire(kTcp, "example.com", 80, kTimeout);
+    auto lease1 = test_subject.Acquire(kTcp, "example.com", 443, kTimeout);
+    auto lease2 = test_subject.Acquire(kTcp, "example.org", 80, kTimeout);
+
+    // Verify
+    CHECK(lease0);
+    CHECK(lease1);
+    CHECK(!lease2);
+    CHECK("example.com:80" == socket0.host);
+    CHECK("example.com:443" == socket1.host);
+    CHECK(2 == test_subject.GetLeasedCount());
+  }
+
+  SECTION("Idle connection used the longest is closed to make room")
+  {
+    // Setup
+    {
+      auto lease = test_subject.Acquire(kTcp, "a.com", 80, kTimeout);
+    }
+    pool_uptime += std::chrono::seconds(1);
+    {
+      auto lease = test_subject.Acquire(kTcp, "b.com", 80, kTimeout);
+    }
+
+    // Exercise
+    auto lease = test_subject.Acquire(kTcp, "c.com", 80, kTimeout);
+
+    // Verify
+    CHECK(&socket0 == &*lease);
+    CHECK("c.com:80" == socket0.host);
+    CHECK(socket1.connected);
+    CHECK(1 == test_subject.GetIdleCount());
+  }
+
+  SECTION("Connections idle past the timeout are closed")
+  {
+    // Setup
+    {
+      auto lease = test_subject.Acquire(kTcp, "example.com", 80, kTimeout);
+    }
+    pool_uptime += std::chrono::seconds(11);
+
+    // Exercise
+    test_subject.CloseIdle();
+
+    // Verify
+    CHECK(!socket0.connected);
+    CHECK(0 == test_subject.GetIdleCount());
+  }
+
+  SECTION("Lost and discarded connections are not reused")
+  {
+    // Setup
+    {
+      auto lease = test_subject.Acquire(kTcp, "example.com", 80, kTimeout);
+      lease.Discard();
+    }
+    CHECK(!socket0.connected);
+    {
+      auto lease = test_subject.Acquire(kTcp, "example.com", 80, kTimeout);
+    }
+    socket0.connected = false;
+
+    // Exercise
+    auto lease = test_subject.Acquire(kTcp, "example.com", 80, kTimeout);
+
+    // Verify
+    CHECK(lease);
+    CHECK(3 == socket0.connects);
+    CHECK(0 == test_subject.GetReuses());
+  }
+
+  SECTION("Failed connections return an empty lease")
+  {
+    // Setup
+    socket0.accept = false;
+    socket1.accept = false;
+
+    // Exercise
+    auto lease = test_subject.Acquire(kTcp, "example.com", 80, kTimeout);
+
+    // Verify
+    CHECK(!lease);
+    CHECK(0 == test_subject.GetLeasedCount());
+  }
+
+  SECTION("Host names that are too long throw")
+  {
+    // Setup
+    const std::string kHost(SocketPool::kMaxHostLength + 1, 'a');
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.Acquire(kTcp, kHost, 80, kTimeout),
+                    sjsu::Exception);
+  }
+
+  SetUptimeFunction(DefaultUptime);
+}
+}  // namespace sjsu
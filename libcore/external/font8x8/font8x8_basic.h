@@ -20,11 +20,11 @@
 
 // Constant: font8x8_basic
 // Contains an 8x8 font map for unicode points U+0000 - U+007F (basic latin)
-// SJSU-Dev2: made this lookup table inlined
+// SJSU-Dev2: made this lookup table inlined and constexpr
 #pragma once
-// SJSU-Dev2: made this lookup table inlined
+// SJSU-Dev2: made this lookup table inlined and constexpr
 #include <stdint.h>
-inline uint8_t font8x8_basic[128][8] = {
+inline constexpr uint8_t font8x8_basic[128][8] = {
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0000 (nul)
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0001
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0002
@@ -21,9 +21,9 @@
 // Constant: font8x8_2500
 // Contains an 8x8 font map for unicode points U+2500 - U+257F (box drawing)
 #pragma once
-// SJSU-Dev2: made this lookup table inlined
+// SJSU-Dev2: made this lookup table inlined and constexpr
 #include <stdint.h>
-inline uint8_t font8x8_box[128][8] = {
+inline constexpr uint8_t font8x8_box[128][8] = {
     { 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00},   // U+2500 (thin horizontal)
     { 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00},   // U+2501 (thick horizontal)
     { 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08},   // U+2502 (thin vertical)
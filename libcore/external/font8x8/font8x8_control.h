@@ -21,9 +21,9 @@
 // Constant: font8x8_0080
 // Contains an 8x8 font map for unicode points U+0080 - U+009F (C1/C2 control)
 #pragma once
-// SJSU-Dev2: made this lookup table inlined
+// SJSU-Dev2: made this lookup table inlined and constexpr
 #include <stdint.h>
-inline uint8_t font8x8_control[32][8] = {
+inline constexpr uint8_t font8x8_control[32][8] = {
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0080
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0081
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0082
@@ -28,6 +28,7 @@ using ::sjsu::cortex::CoreDebug_Type;
 // Note: small Cortex-M0/M0+ might implement a simplified debug interface.
 
 //#define OS_USE_TRACE_ITM
+//#define OS_USE_TRACE_RTT
 //#define OS_USE_TRACE_SEMIHOSTING_DEBUG
 //#define OS_USE_TRACE_SEMIHOSTING_STDOUT
 
@@ -47,6 +48,11 @@ static ssize_t
 _trace_write_itm (const char* buf, size_t nbyte);
 #endif
 
+#if defined(OS_USE_TRACE_RTT)
+static ssize_t
+_trace_write_rtt (const char* buf, size_t nbyte);
+#endif
+
 #if defined(OS_USE_TRACE_SEMIHOSTING_STDOUT)
 static ssize_t
 _trace_write_semihosting_stdout(const char* buf, size_t nbyte);
@@ -76,6 +82,8 @@ trace_write (const char* buf __attribute__((unused)),
 {
 #if defined(OS_USE_TRACE_ITM)
   return _trace_write_itm (buf, nbyte);
+#elif defined(OS_USE_TRACE_RTT)
+  return _trace_write_rtt (buf, nbyte);
 #elif defined(OS_USE_TRACE_SEMIHOSTING_STDOUT)
   return _trace_write_semihosting_stdout(buf, nbyte);
 #elif defined(OS_USE_TRACE_SEMIHOSTING_DEBUG)
@@ -132,6 +140,31 @@ _trace_write_itm (const char* buf, size_t nbyte)
 
 // ----------------------------------------------------------------------------
 
+#if defined(OS_USE_TRACE_RTT)
+
+// RTT keeps the trace in a ring buffer in RAM, which the debug probe reads
+// while the core runs. It needs no SWO pin, works on every Cortex-M, and
+// drops what does not fit rather than stopping the core.
+
+#include <libcore/platform/debug_output.hpp>
+
+#if !defined(OS_INTEGER_TRACE_RTT_BUFFER_SIZE)
+#define OS_INTEGER_TRACE_RTT_BUFFER_SIZE     (1024)
+#endif
+
+static sjsu::Rtt<OS_INTEGER_TRACE_RTT_BUFFER_SIZE> trace_rtt;
+
+static ssize_t
+_trace_write_rtt (const char* buf, size_t nbyte)
+{
+  return (ssize_t) trace_rtt.Write (
+      std::span ((const uint8_t*) buf, nbyte));
+}
+
+#endif // OS_USE_TRACE_RTT
+
+// ----------------------------------------------------------------------------
+
 #if defined(OS_USE_TRACE_SEMIHOSTING_DEBUG) || defined(OS_USE_TRACE_SEMIHOSTING_STDOUT)
 
 #include "semihosting.h"
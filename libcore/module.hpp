@@ -1,9 +1,12 @@
 #pragma once
 
+#include <concepts>
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
 
+#include <libcore/utility/event_trace.hpp>
+
 namespace sjsu
 {
 /// Used to keep the SJSU-Dev2 compile time errors consistent, distinct and
@@ -81,7 +84,14 @@ struct EmptySettings_t
 };
 
 /// The basis class for all peripheral, device and system drivers in SJSU-Dev2.
-template <class Settings_t = EmptySettings_t>
+///
+/// @tparam Settings_t - the settings of the module.
+/// @tparam kSaveSettings - keep a copy of the settings used by the latest call
+///         of Initialize(), which is returned by CurrentSettings() and lets
+///         Initialize() skip reinitializing with unchanged settings. Modules
+///         with large settings that do not need either can pass false to keep
+///         a single copy of their settings.
+template <class Settings_t = EmptySettings_t, bool kSaveSettings = true>
 class Module
 {
  public:
@@ -117,17 +127,68 @@ class Module
   /// exception, meaning success, then the state of the module will transition
   /// to State::kInitialized. Once in the initialized state, this function will
   /// not call ModuleInitialize() again unless the state is changed to something
-  /// else.
+  /// else or the settings have changed. Settings that cannot be compared, and
+  /// settings that are not saved, are always treated as changed.
   ///
   /// @return auto& - reference to itself to allow method chaining
   auto & Initialize()
   {
-    ModuleInitialize();
+    if constexpr (kSaveSettings && std::equality_comparable<Settings_t>)
+    {
+      if (state_ == State::kInitialized && settings == current_settings_)
+      {
+        return *this;
+      }
+    }
+
+    {
+      SJ2_TRACE_SCOPE("Module::Initialize", reinterpret_cast<uintptr_t>(this));
+      ModuleInitialize();
+    }
     SaveSettings();
     state_ = State::kInitialized;
     return *this;
   }
 
+  /// Run ModuleInitialize() again with the settings of the last Initialize(),
+  /// its CurrentSettings(), even though they have not changed. Used when
+  /// something the module derives its configuration from has changed, such
+  /// as the system's clock rate. Modules that do not save their settings are
+  /// initialized with `settings`. `settings` itself is left as it was.
+  ///
+  /// Does nothing unless the module is initialized.
+  ///
+  /// @return auto& - reference to itself to allow method chaining
+  auto & Reinitialize()
+  {
+    if (state_ != State::kInitialized)
+    {
+      return *this;
+    }
+
+    if constexpr (kSaveSettings)
+    {
+      Settings_t pending = settings;
+      settings           = current_settings_;
+      try
+      {
+        ModuleInitialize();
+      }
+      catch (...)
+      {
+        settings = pending;
+        throw;
+      }
+      settings = pending;
+    }
+    else
+    {
+      ModuleInitialize();
+    }
+
+    return *this;
+  }
+
   /// Will put the module into a powered down state. All submodules used by this
   /// module will have their power down be called well. Just like how
   /// Initialize() calls all Initialize() methods of its submodules.
@@ -171,9 +232,9 @@ class Module
     return *this;
   }
 
-  /// @return Settings_t - the current operating settings from the latest call
-  /// of Initialize()
-  Settings_t CurrentSettings() const
+  /// @return const Settings_t & - the current operating settings from the
+  /// latest call of Initialize()
+  const Settings_t & CurrentSettings() const requires kSaveSettings
   {
     return current_settings_;
   }
@@ -187,8 +248,9 @@ class Module
   /// Publically accessible settings structure used for configuring generic
   /// aspects of the module. For example, PWM would have a setting for frequency
   /// and UART would have a setting for baud_rate. When the module is
-  /// initialized the settings are saved into a private variable and can be
-  /// retrieved via the CurrentSettings() method.
+  /// initialized the settings are saved into a private variable, unless
+  /// kSaveSettings is false, and can be retrieved via the CurrentSettings()
+  /// method.
   Settings_t settings;
 
   /// Add constexpr constructor which will allow derived classes to have
@@ -211,11 +273,17 @@ class Module
   /// Helper function for saving settings.
   void SaveSettings()
   {
-    current_settings_ = settings;
+    if constexpr (kSaveSettings)
+    {
+      current_settings_ = settings;
+    }
   }
 
-  /// Saved settings from running Initialize()
-  Settings_t current_settings_ = {};
+  /// Saved settings from running Initialize(). Reduced to an empty structure
+  /// when settings are not saved. It is not marked [[no_unique_address]], as
+  /// other members placed in its padding would break MemoryEqualOperator_t.
+  std::conditional_t<kSaveSettings, Settings_t, EmptySettings_t>
+      current_settings_ = {};
 
   /// The current operating state of the module. Default is State::kReset. Once
   /// Initialized, the State::kReset can never be reached again.
@@ -0,0 +1,107 @@
+#include <libcore/module.hpp>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+struct CountedSettings_t : public MemoryEqualOperator_t<CountedSettings_t>
+{
+  uint32_t value = 0;
+};
+
+/// Counts the calls of ModuleInitialize().
+template <bool kSaveSettings>
+class CountedModule : public Module<CountedSettings_t, kSaveSettings>
+{
+ public:
+  void ModuleInitialize() override
+  {
+    initializations++;
+    initialized_value = this->settings.value;
+  }
+
+  int initializations        = 0;
+  uint32_t initialized_value = 0;
+};
+}  // namespace
+
+TEST_CASE("Testing Module")
+{
+  SECTION("Initialize() skips reinitializing with unchanged settings")
+  {
+    // Setup
+    CountedModule<true> test_subject;
+    test_subject.settings.value = 5;
+
+    // Exercise
+    test_subject.Initialize();
+    test_subject.Initialize();
+
+    // Verify
+    CHECK(1 == test_subject.initializations);
+    CHECK(5 == test_subject.CurrentSettings().value);
+  }
+
+  SECTION("Initialize() reinitializes when settings change or after power down")
+  {
+    // Setup
+    CountedModule<true> test_subject;
+    test_subject.Initialize();
+
+    // Exercise
+    test_subject.settings.value = 1;
+    test_subject.Initialize();
+    test_subject.PowerDown();
+    test_subject.Initialize();
+
+    // Verify
+    CHECK(3 == test_subject.initializations);
+    CHECK(State::kInitialized == test_subject.GetState());
+  }
+
+  SECTION("Reinitialize() uses the current settings")
+  {
+    // Setup
+    CountedModule<true> test_subject;
+    test_subject.settings.value = 5;
+    test_subject.Initialize();
+    test_subject.settings.value = 7;
+
+    // Exercise
+    test_subject.Reinitialize();
+
+    // Verify
+    CHECK(2 == test_subject.initializations);
+    CHECK(5 == test_subject.initialized_value);
+    CHECK(7 == test_subject.settings.value);
+  }
+
+  SECTION("Reinitialize() does nothing before Initialize()")
+  {
+    // Setup
+    CountedModule<true> test_subject;
+
+    // Exercise
+    test_subject.Reinitialize();
+
+    // Verify
+    CHECK(0 == test_subject.initializations);
+    CHECK(State::kReset == test_subject.GetState());
+  }
+
+  SECTION("Modules without saved settings always reinitialize")
+  {
+    // Setup
+    CountedModule<false> test_subject;
+
+    // Exercise
+    test_subject.Initialize();
+    test_subject.Initialize();
+
+    // Verify
+    CHECK(2 == test_subject.initializations);
+  }
+}
+}  // namespace sjsu
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <span>
+
 #include <libcore/module.hpp>
 #include <libcore/peripherals/inactive.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
 
 namespace sjsu
@@ -15,6 +20,61 @@ struct AdcSettings_t
   units::voltage::microvolt_t reference_voltage = 3.3_V;
 };
 
+/// Converts ADC samples to microvolts with an integer multiply and shift,
+/// using a scale computed once, rather than the units library on each sample.
+/// The 32 by 32 bit multiply into 64 bits is a single instruction on most
+/// Cortex-M cores.
+///
+/// USAGE:
+///
+///    const sjsu::AdcScale kScale = adc.GetScale();
+///    kScale.ToMicrovolts(samples, microvolts);
+class AdcScale
+{
+ public:
+  /// @param reference_microvolts - the high side voltage reference of the
+  ///        ADC, in microvolts.
+  /// @param maximum_value - the value of a sample at the reference voltage.
+  constexpr AdcScale(uint32_t reference_microvolts, uint32_t maximum_value)
+      : multiplier_(((uint64_t{ reference_microvolts } << kShift) +
+                     (maximum_value / 2)) /
+                    std::max(maximum_value, uint32_t{ 1 }))
+  {
+  }
+
+  /// @param sample - an ADC sample, at most the maximum value.
+  /// @return constexpr uint32_t - the sample in microvolts, rounded to the
+  ///         nearest microvolt.
+  constexpr uint32_t ToMicrovolts(uint32_t sample) const
+  {
+    return static_cast<uint32_t>(
+        ((sample * multiplier_) + (uint64_t{ 1 } << (kShift - 1))) >> kShift);
+  }
+
+  /// Convert a batch of samples.
+  ///
+  /// @param samples - ADC samples, at most the maximum value.
+  /// @param microvolts - filled with the microvolts of each sample. Converts
+  ///        as many samples as fit.
+  void ToMicrovolts(std::span<const uint16_t> samples,
+                    std::span<uint32_t> microvolts) const
+  {
+    const size_t kCount = std::min(samples.size(), microvolts.size());
+    for (size_t i = 0; i < kCount; i++)
+    {
+      microvolts[i] = ToMicrovolts(samples[i]);
+    }
+  }
+
+ private:
+  /// Fraction bits of the multiplier. A sample times the multiplier is about
+  /// the reference voltage shifted by this amount, which fits in 64 bits.
+  static constexpr int kShift = 32;
+
+  /// Microvolts per sample step, as a fixed point number.
+  uint64_t multiplier_;
+};
+
 /// Common abstraction interface for Analog-to-Digital (ADC) Converter. These
 /// peripherals are used to sense a voltage and convert it to a numeric value.
 ///
@@ -32,6 +92,21 @@ class Adc : public Module<AdcSettings_t>
   /// @returns The number of active bits for the ADC.
   virtual uint8_t GetActiveBits() = 0;
 
+  /// Fill `samples` with consecutive conversions of the analog signal, for
+  /// ADCs of up to 16 bits. Implementations with a burst mode or DMA should
+  /// override this method.
+  ///
+  /// The default implementation calls Read() for each sample.
+  ///
+  /// @param samples - buffer to fill with samples.
+  virtual void ReadSamples(std::span<uint16_t> samples)
+  {
+    for (auto & sample : samples)
+    {
+      sample = static_cast<uint16_t>(Read());
+    }
+  }
+
   // ===========================================================================
   // Helper Functions
   // ===========================================================================
@@ -52,6 +127,97 @@ class Adc : public Module<AdcSettings_t>
   {
     return Read() * (CurrentSettings().reference_voltage / GetMaximumValue());
   }
+
+  /// @return AdcScale - converts samples of this ADC to microvolts, based on
+  ///         the reference voltage of the current settings.
+  AdcScale GetScale()
+  {
+    return AdcScale(static_cast<uint32_t>(
+                        CurrentSettings().reference_voltage.to<double>()),
+                    GetMaximumValue());
+  }
+};
+
+/// A set of ADC channels converted together, such as the phase currents of
+/// a motor, producing frames of one sample per channel.
+///
+/// The default implementation reads the channels one after another. Platforms
+/// with a hardware scan sequencer should derive from this class and override
+/// Read(), and StartContinuous() when they can convert frames with DMA at a
+/// set rate.
+///
+/// USAGE:
+///
+///    std::array<sjsu::Adc *, 3> phases = { &phase_a, &phase_b, &phase_c };
+///    sjsu::AdcGroup group(phases);
+///
+///    std::array<uint16_t, 3 * 8> frames;
+///    group.Read(frames);  // 8 frames of phase a, b, c
+class AdcGroup
+{
+ public:
+  /// Called with the half of the continuous buffer that was just filled,
+  /// usually from an interrupt. The other half is being filled meanwhile.
+  using HalfCallback = InplaceFunction<void(std::span<const uint16_t> samples)>;
+
+  /// @param channels - the channels of each frame, in order. Must outlive
+  ///        this object. Each channel must already be initialized.
+  explicit AdcGroup(std::span<Adc * const> channels) : channels_(channels) {}
+
+  virtual ~AdcGroup() = default;
+
+  /// Fill `samples` with whole frames, each holding a sample of every
+  /// channel, in the order of the channels.
+  ///
+  /// @param samples - buffer to fill. Samples past the last whole frame are
+  ///        left untouched.
+  virtual void Read(std::span<uint16_t> samples)
+  {
+    const size_t kFrames = (channels_.empty()) ? 0
+                                               : samples.size() /
+                                                     channels_.size();
+    for (size_t frame = 0; frame < kFrames; frame++)
+    {
+      for (size_t channel = 0; channel < channels_.size(); channel++)
+      {
+        samples[(frame * channels_.size()) + channel] =
+            static_cast<uint16_t>(channels_[channel]->Read());
+      }
+    }
+  }
+
+  /// Start converting frames continuously, at `frame_rate`, into the
+  /// circular `buffer`. Once each half of the buffer has been filled,
+  /// `on_half` is called with it. Continues until StopContinuous().
+  ///
+  /// The default implementation does not support continuous conversion.
+  ///
+  /// @param buffer - circular buffer of a whole, even number of frames.
+  ///        The contents are NOT copied and it must remain valid until
+  ///        StopContinuous().
+  /// @param frame_rate - number of frames to convert per second.
+  /// @param on_half - called with each half of the buffer once filled.
+  /// @return true - if continuous conversion started.
+  virtual bool StartContinuous(
+      [[maybe_unused]] std::span<uint16_t> buffer,
+      [[maybe_unused]] units::frequency::hertz_t frame_rate,
+      [[maybe_unused]] HalfCallback on_half)
+  {
+    return false;
+  }
+
+  /// Stop the conversions started by StartContinuous().
+  virtual void StopContinuous() {}
+
+  /// @return std::span<Adc * const> - the channels of each frame.
+  std::span<Adc * const> Channels() const
+  {
+    return channels_;
+  }
+
+ protected:
+  /// The channels of each frame, in order.
+  std::span<Adc * const> channels_;
 };
 
 /// Template specialization that generates an inactive sjsu::Adc.
@@ -72,7 +238,6 @@ inline sjsu::Adc & GetInactive<sjsu::Adc>()
     }
   };
 
-  static InactiveAdc inactive;
-  return inactive;
+  return inactive_instance<InactiveAdc>;
 }
 }  // namespace sjsu
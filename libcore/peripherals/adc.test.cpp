@@ -1,4 +1,8 @@
 #include <libcore/peripherals/adc.hpp>
+
+#include <array>
+#include <cstdint>
+
 #include <libcore/testing/testing_frameworks.hpp>
 
 namespace sjsu
@@ -90,5 +94,113 @@ TEST_CASE("Testing ADC Interface")
     CHECK(actual_voltage.to<float>() ==
           doctest::Approx(expected_voltage.to<float>()).epsilon(0.01f));
   }
+
+  SECTION("GetScale() converts samples to microvolts")
+  {
+    // Setup
+    Fake(Method(mock_adc, ModuleInitialize));
+    When(Method(mock_adc, GetActiveBits)).AlwaysReturn(12);
+    mock_adc.get().settings.reference_voltage = 3.3_V;
+    mock_adc.get().Initialize();
+    const std::array<uint16_t, 4> kSamples = { 0, 515, 2000, 4095 };
+    std::array<uint32_t, 4> microvolts     = {};
+
+    // Exercise
+    const AdcScale kScale = test_subject.GetScale();
+    kScale.ToMicrovolts(kSamples, microvolts);
+
+    // Verify
+    for (size_t i = 0; i < kSamples.size(); i++)
+    {
+      const double kExpected = kSamples[i] * 3'300'000.0 / 4095;
+      CHECK(microvolts[i] == doctest::Approx(kExpected).epsilon(0.0001));
+    }
+    CHECK(3'300'000 == kScale.ToMicrovolts(4095));
+  }
+}
+
+TEST_CASE("Testing ADC burst reads")
+{
+  SECTION("ReadSamples() reads each sample")
+  {
+    // Setup
+    class CountingAdc : public Adc
+    {
+     public:
+      void ModuleInitialize() override {}
+      uint32_t Read() override
+      {
+        return reading++;
+      }
+      uint8_t GetActiveBits() override
+      {
+        return 12;
+      }
+      uint32_t reading = 0;
+    } adc;
+    std::array<uint16_t, 4> samples = {};
+
+    // Exercise
+    adc.ReadSamples(samples);
+
+    // Verify
+    CHECK(4 == adc.reading);
+    CHECK(samples == std::array<uint16_t, 4>{ 0, 1, 2, 3 });
+  }
+}
+
+TEST_CASE("Testing AdcScale")
+{
+  SECTION("Samples never overflow the product")
+  {
+    // Setup
+    const AdcScale kScale(5'000'000, 65535);
+
+    // Exercise
+    const uint32_t kFullScale = kScale.ToMicrovolts(65535);
+    const uint32_t kHalfScale = kScale.ToMicrovolts(32768);
+
+    // Verify
+    CHECK(5'000'000 == kFullScale);
+    CHECK(kHalfScale == doctest::Approx(2'500'038).epsilon(0.0001));
+  }
+}
+
+TEST_CASE("Testing AdcGroup")
+{
+  Mock<Adc> mock_channel_a;
+  Mock<Adc> mock_channel_b;
+  When(Method(mock_channel_a, Read)).AlwaysReturn(10);
+  When(Method(mock_channel_b, Read)).AlwaysReturn(20);
+  std::array<Adc *, 2> channels = { &mock_channel_a.get(),
+                                    &mock_channel_b.get() };
+  AdcGroup group(channels);
+
+  SECTION("Read() fills whole frames in channel order")
+  {
+    // Setup
+    std::array<uint16_t, 5> samples = { 0, 0, 0, 0, 99 };
+
+    // Exercise
+    group.Read(samples);
+
+    // Verify
+    CHECK(samples == std::array<uint16_t, 5>{ 10, 20, 10, 20, 99 });
+    Verify(Method(mock_channel_a, Read)).Exactly(2);
+    Verify(Method(mock_channel_b, Read)).Exactly(2);
+  }
+
+  SECTION("Continuous conversion is unsupported by default")
+  {
+    // Setup
+    std::array<uint16_t, 8> buffer = {};
+
+    // Exercise
+    bool started = group.StartContinuous(buffer, 20_kHz, [](auto) {});
+
+    // Verify
+    CHECK(!started);
+    CHECK(2 == group.Channels().size());
+  }
 }
 }  // namespace sjsu
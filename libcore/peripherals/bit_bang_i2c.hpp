@@ -0,0 +1,229 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/i2c.hpp>
+#include <libcore/peripherals/interface_concepts.hpp>
+#include <libcore/platform/constants.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/time/edge_timer.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// A software I2c controller that drives the clock and data lines with Gpio,
+/// for boards without a spare I2C peripheral.
+///
+/// The lines are driven open drain by switching the pins between a LOW output
+/// and an input, so any Gpio works as long as the bus has pull up resistors.
+/// When SCL is released, the controller waits for it to actually go HIGH,
+/// so devices can stretch the clock, up to the timeout of the transaction.
+///
+/// The pin types are template parameters. With the default sjsu::Gpio each
+/// pin change is a virtual call. Binding the pins to the platform's concrete,
+/// `final` pin classes lets the compiler inline each change as a register
+/// write. Edges are paced with an EdgeTimer at twice `settings.frequency`,
+/// which absorbs the time taken to change pins. `settings.duty_cycle` is not
+/// used, both halves of the clock are the same length.
+///
+/// USAGE:
+///
+///    sjsu::BitBangI2c i2c(scl, sda);
+///    i2c.settings.frequency = 400_kHz;
+///    i2c.Initialize();
+///    i2c.WriteThenRead(kAddress, { kWhoAmI }, response);
+///
+/// @tparam Scl - type of the clock pin.
+/// @tparam Sda - type of the data pin.
+template <GpioInterface Scl = Gpio, GpioInterface Sda = Gpio>
+class BitBangI2c : public I2c
+{
+ public:
+  /// @param scl - clock pin.
+  /// @param sda - data pin.
+  /// @param cpu_clock - resource ID of the clock driving the CPU, used to
+  ///        time the bits where the CycleCounter counts cycles.
+  BitBangI2c(Scl & scl, Sda & sda, ResourceID cpu_clock = {})
+      : scl_(scl), sda_(sda), cpu_clock_(cpu_clock)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    scl_.Initialize();
+    sda_.Initialize();
+
+    // The outputs only ever drive LOW, HIGH is the pull up of the released
+    // line.
+    scl_.Set(Gpio::kLow);
+    sda_.Set(Gpio::kLow);
+    scl_.SetDirection(Gpio::kInput);
+    sda_.SetDirection(Gpio::kInput);
+
+    timer_.SetRate(settings.frequency * 2, cpu_clock_);
+  }
+
+  /// @throw sjsu::Exception - std::errc::no_such_device_or_address if the
+  ///        device does not acknowledge its address, std::errc::io_error if
+  ///        the bus is held LOW or a byte written is not acknowledged, or
+  ///        std::errc::timed_out if the clock is stretched for longer than
+  ///        the timeout of the transaction.
+  void Transaction(Transaction_t transaction) override
+  {
+    deadline_ = Uptime() + transaction.timeout;
+    timer_.Start();
+
+    if (!sda_.Read() || !scl_.Read())
+    {
+      throw CommonErrors::kBusError;
+    }
+
+    // Start condition: SDA falls while SCL is HIGH.
+    Pull(sda_);
+    timer_.WaitForEdge();
+    Pull(scl_);
+
+    if (transaction.operation == Operation::kWrite)
+    {
+      SendAddress(transaction, Operation::kWrite);
+      for (size_t i = 0; i < transaction.TotalOutLength(); i++)
+      {
+        if (!WriteByte(transaction.GetOutByte(i)))
+        {
+          StopAndThrow(CommonErrors::kBusError);
+        }
+      }
+
+      if (!transaction.repeated)
+      {
+        Stop();
+        return;
+      }
+
+      // Repeated start condition.
+      Release(sda_);
+      timer_.WaitForEdge();
+      ReleaseClock();
+      timer_.WaitForEdge();
+      Pull(sda_);
+      timer_.WaitForEdge();
+      Pull(scl_);
+    }
+
+    SendAddress(transaction, Operation::kRead);
+    for (size_t i = 0; i < transaction.in_length; i++)
+    {
+      // The last byte is not acknowledged, to end the read.
+      transaction.data_in[i] = ReadByte(i + 1 < transaction.in_length);
+    }
+    Stop();
+  }
+
+ private:
+  template <class Pin>
+  static void Pull(Pin & pin)
+  {
+    pin.SetDirection(Gpio::kOutput);
+  }
+
+  template <class Pin>
+  static void Release(Pin & pin)
+  {
+    pin.SetDirection(Gpio::kInput);
+  }
+
+  /// Release SCL and wait for any clock stretching to end.
+  void ReleaseClock()
+  {
+    Release(scl_);
+    if (!scl_.Read())
+    {
+      while (!scl_.Read())
+      {
+        if (Uptime() > deadline_)
+        {
+          StopAndThrow(CommonErrors::kTimeout);
+        }
+      }
+      // Time the rest of the clock from when the device released it.
+      timer_.Start();
+    }
+  }
+
+  void WriteBit(bool bit)
+  {
+    bit ? Release(sda_) : Pull(sda_);
+    timer_.WaitForEdge();
+    ReleaseClock();
+    timer_.WaitForEdge();
+    Pull(scl_);
+  }
+
+  bool ReadBit()
+  {
+    Release(sda_);
+    timer_.WaitForEdge();
+    ReleaseClock();
+    const bool kBit = sda_.Read();
+    timer_.WaitForEdge();
+    Pull(scl_);
+    return kBit;
+  }
+
+  /// @return true - if the byte was acknowledged.
+  bool WriteByte(uint8_t byte)
+  {
+    for (int bit = 7; bit >= 0; bit--)
+    {
+      WriteBit((byte >> bit) & 1);
+    }
+    return !ReadBit();
+  }
+
+  uint8_t ReadByte(bool acknowledge)
+  {
+    uint8_t byte = 0;
+    for (int bit = 0; bit < 8; bit++)
+    {
+      byte = static_cast<uint8_t>((byte << 1) | ReadBit());
+    }
+    WriteBit(!acknowledge);
+    return byte;
+  }
+
+  void SendAddress(const Transaction_t & transaction, Operation operation)
+  {
+    const uint8_t kAddress =
+        static_cast<uint8_t>((transaction.address << 1) | operation);
+    if (!WriteByte(kAddress))
+    {
+      StopAndThrow(CommonErrors::kDeviceNotFound);
+    }
+  }
+
+  /// Stop condition: SDA rises while SCL is HIGH.
+  void Stop()
+  {
+    Pull(sda_);
+    timer_.WaitForEdge();
+    Release(scl_);
+    timer_.WaitForEdge();
+    Release(sda_);
+  }
+
+  [[noreturn]] void StopAndThrow(const Exception & error)
+  {
+    Stop();
+    throw error;
+  }
+
+  Scl & scl_;
+  Sda & sda_;
+  ResourceID cpu_clock_;
+  EdgeTimer timer_;
+  std::chrono::nanoseconds deadline_ = std::chrono::nanoseconds(0);
+};
+}  // namespace sjsu
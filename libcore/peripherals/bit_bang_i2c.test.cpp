@@ -0,0 +1,294 @@
+#include <libcore/peripherals/bit_bang_i2c.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+class SimulatedTarget;
+
+/// A concrete open drain pin on the simulated bus.
+struct BusPin
+{
+  void Initialize() {}
+  void SetDirection(Gpio::Direction direction);
+  void Set(Gpio::State) {}
+  void Toggle() {}
+  bool Read();
+
+  SimulatedTarget * target;
+  bool is_clock;
+  bool pulled_low = false;
+};
+
+/// An I2C target device at address kAddress, which records the bytes written
+/// to it and answers reads with `response`, observing the bus through the
+/// pins of the controller.
+class SimulatedTarget
+{
+ public:
+  static constexpr uint8_t kAddress = 0x42;
+
+  bool Scl() const
+  {
+    return !scl.pulled_low && !holding_clock_;
+  }
+
+  bool Sda() const
+  {
+    return !sda.pulled_low && !holding_data_;
+  }
+
+  bool ReadClock()
+  {
+    if (holding_clock_ && --stretch_reads == 0)
+    {
+      holding_clock_ = false;
+      Update();
+    }
+    return Scl();
+  }
+
+  void Update()
+  {
+    if (!scl.pulled_low && !last_scl_ && stretch_reads > 0)
+    {
+      holding_clock_ = true;
+    }
+
+    const bool kScl = Scl();
+    const bool kSda = Sda();
+    if (kScl && last_scl_ && kSda != last_sda_)
+    {
+      kSda ? OnStop() : OnStart();
+    }
+    else if (kScl && !last_scl_)
+    {
+      OnRise(kSda);
+    }
+    else if (!kScl && last_scl_)
+    {
+      OnFall();
+    }
+    last_scl_ = kScl;
+    last_sda_ = Sda();
+  }
+
+  BusPin scl{ .target = this, .is_clock = true };
+  BusPin sda{ .target = this, .is_clock = false };
+  std::vector<uint8_t> written;
+  std::vector<uint8_t> response;
+  int starts        = 0;
+  int stops         = 0;
+  int stretch_reads = 0;
+
+ private:
+  enum class Phase
+  {
+    kIdle,
+    kReceive,
+    kTransmit,
+  };
+
+  void OnStart()
+  {
+    starts++;
+    phase_        = Phase::kReceive;
+    addressed_    = false;
+    bits_         = 0;
+    shift_        = 0;
+    ack_slot_     = false;
+    holding_data_ = false;
+  }
+
+  void OnStop()
+  {
+    stops++;
+    phase_        = Phase::kIdle;
+    holding_data_ = false;
+  }
+
+  void OnRise(bool data)
+  {
+    if (ack_slot_)
+    {
+      controller_acked_ = !data;
+    }
+    else if (phase_ == Phase::kReceive)
+    {
+      shift_ = static_cast<uint8_t>((shift_ << 1) | data);
+      bits_++;
+    }
+  }
+
+  void OnFall()
+  {
+    if (ack_slot_)
+    {
+      ack_slot_     = false;
+      holding_data_ = false;
+      bits_         = 0;
+      if (phase_ == Phase::kTransmit)
+      {
+        if (controller_acked_ && next_ < response.size())
+        {
+          byte_ = response[next_++];
+          DriveBit();
+        }
+        else
+        {
+          phase_ = Phase::kIdle;
+        }
+      }
+      return;
+    }
+
+    if (phase_ == Phase::kReceive && bits_ == 8)
+    {
+      if (!addressed_)
+      {
+        if ((shift_ >> 1) != kAddress)
+        {
+          phase_ = Phase::kIdle;
+          return;
+        }
+        addressed_        = true;
+        controller_acked_ = true;
+        if (shift_ & 1)
+        {
+          phase_ = Phase::kTransmit;
+        }
+      }
+      else
+      {
+        written.push_back(shift_);
+      }
+      holding_data_ = true;
+      ack_slot_     = true;
+      shift_        = 0;
+      return;
+    }
+
+    if (phase_ == Phase::kTransmit)
+    {
+      if (++bits_ == 8)
+      {
+        holding_data_ = false;
+        ack_slot_     = true;
+        return;
+      }
+      DriveBit();
+    }
+  }
+
+  void DriveBit()
+  {
+    holding_data_ = !((byte_ >> (7 - bits_)) & 1);
+  }
+
+  Phase phase_           = Phase::kIdle;
+  bool addressed_        = false;
+  bool ack_slot_         = false;
+  bool controller_acked_ = false;
+  bool holding_data_     = false;
+  bool holding_clock_    = false;
+  bool last_scl_         = true;
+  bool last_sda_         = true;
+  int bits_              = 0;
+  uint8_t shift_         = 0;
+  uint8_t byte_          = 0;
+  size_t next_           = 0;
+};
+
+void BusPin::SetDirection(Gpio::Direction direction)
+{
+  pulled_low = (direction == Gpio::kOutput);
+  target->Update();
+}
+
+bool BusPin::Read()
+{
+  return is_clock ? target->ReadClock() : target->Sda();
+}
+}  // namespace
+
+TEST_CASE("Testing BitBangI2c")
+{
+  SimulatedTarget target;
+  BitBangI2c test_subject(target.scl, target.sda);
+  test_subject.settings.frequency = 1_MHz;
+  test_subject.Initialize();
+
+  SECTION("Write sends the address and bytes between start and stop")
+  {
+    // Exercise
+    test_subject.Write(SimulatedTarget::kAddress, { 0x12, 0xFE });
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x12, 0xFE } == target.written);
+    CHECK(1 == target.starts);
+    CHECK(1 == target.stops);
+    CHECK(target.Scl());
+    CHECK(target.Sda());
+  }
+
+  SECTION("WriteThenRead uses a repeated start")
+  {
+    // Setup
+    target.response = { 0xC3, 0x5A };
+    const std::array<uint8_t, 1> kRegister = { 0x0F };
+    std::array<uint8_t, 2> received;
+
+    // Exercise
+    test_subject.WriteThenRead(
+        SimulatedTarget::kAddress, kRegister.data(), kRegister.size(),
+        received.data(), received.size());
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x0F } == target.written);
+    CHECK(0xC3 == received[0]);
+    CHECK(0x5A == received[1]);
+    CHECK(2 == target.starts);
+    CHECK(1 == target.stops);
+  }
+
+  SECTION("Clock stretching is waited for")
+  {
+    // Setup
+    target.response      = { 0x99 };
+    target.stretch_reads = 5;
+    std::array<uint8_t, 1> received;
+
+    // Exercise
+    test_subject.Read(SimulatedTarget::kAddress, received);
+
+    // Verify
+    CHECK(0x99 == received[0]);
+    CHECK(0 == target.stretch_reads);
+  }
+
+  SECTION("Unacknowledged addresses throw and release the bus")
+  {
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.Write(0x10, { 0x00 }), sjsu::Exception);
+    CHECK(1 == target.stops);
+    CHECK(target.Scl());
+    CHECK(target.Sda());
+  }
+
+  SECTION("Holding the clock past the timeout throws")
+  {
+    // Setup
+    target.stretch_reads = 1'000'000'000;
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.Write(SimulatedTarget::kAddress,
+                                       { 0x00 },
+                                       std::chrono::milliseconds(1)),
+                    sjsu::Exception);
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/interface_concepts.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/platform/constants.hpp>
+#include <libcore/utility/time/edge_timer.hpp>
+
+namespace sjsu
+{
+/// A software Spi that drives the clock and data lines with Gpio, for boards
+/// without a spare SPI peripheral. Bits are sent most significant bit first,
+/// in frames of `settings.frame_size`, in the mode given by
+/// `settings.polarity` and `settings.phase`.
+///
+/// The pin types are template parameters. With the default sjsu::Gpio each
+/// pin change is a virtual call. Binding the pins to the platform's concrete,
+/// `final` pin classes lets the compiler inline each change as a register
+/// write. Edges are paced with an EdgeTimer at twice `settings.clock_rate`,
+/// which absorbs the time taken to change pins, so the clock runs at the
+/// requested rate as long as the pins can keep up.
+///
+/// USAGE:
+///
+///    // Runtime bound pins
+///    sjsu::BitBangSpi spi(sck, mosi, miso);
+///
+///    // Compile time bound pins
+///    sjsu::BitBangSpi<PlatformPin, PlatformPin, PlatformPin> fast_spi(
+///        sck_pin, mosi_pin, miso_pin);
+///
+///    fast_spi.settings.clock_rate = 1_MHz;
+///    fast_spi.Initialize();
+///
+/// @tparam Sck - type of the clock pin.
+/// @tparam Mosi - type of the pin data is written on.
+/// @tparam Miso - type of the pin data is read from.
+template <GpioInterface Sck = Gpio,
+          GpioInterface Mosi = Gpio,
+          GpioInterface Miso = Gpio>
+class BitBangSpi : public Spi
+{
+ public:
+  /// @param sck - clock pin.
+  /// @param mosi - pin data is written on. Use sjsu::GetInactive<sjsu::Gpio>()
+  ///        if nothing is written.
+  /// @param miso - pin data is read from. Use sjsu::GetInactive<sjsu::Gpio>()
+  ///        if nothing is read.
+  /// @param cpu_clock - resource ID of the clock driving the CPU, used to
+  ///        time the bits where the CycleCounter counts cycles.
+  BitBangSpi(Sck & sck, Mosi & mosi, Miso & miso, ResourceID cpu_clock = {})
+      : sck_(sck), mosi_(mosi), miso_(miso), cpu_clock_(cpu_clock)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    sck_.Initialize();
+    mosi_.Initialize();
+    miso_.Initialize();
+
+    idle_ = (settings.polarity == SpiSettings_t::Polarity::kIdleHigh)
+                ? Gpio::kHigh
+                : Gpio::kLow;
+    sck_.Set(idle_);
+    sck_.SetDirection(Gpio::kOutput);
+    mosi_.SetDirection(Gpio::kOutput);
+    miso_.SetDirection(Gpio::kInput);
+
+    bits_ = static_cast<uint8_t>(settings.frame_size) + 4;
+    timer_.SetRate(settings.clock_rate * 2, cpu_clock_);
+  }
+
+  void Transfer(std::span<uint8_t> buffer) override
+  {
+    TransferFrames(buffer);
+  }
+
+  void Transfer(std::span<uint16_t> buffer) override
+  {
+    TransferFrames(buffer);
+  }
+
+  using Spi::Transfer;
+
+ private:
+  template <typename T>
+  void TransferFrames(std::span<T> buffer)
+  {
+    timer_.Start();
+    for (T & frame : buffer)
+    {
+      frame = static_cast<T>(TransferFrame(frame));
+    }
+  }
+
+  uint32_t TransferFrame(uint32_t frame)
+  {
+    const Gpio::State kActive = (idle_ == Gpio::kHigh) ? Gpio::kLow
+                                                       : Gpio::kHigh;
+    const bool kSampleLeading =
+        (settings.phase == SpiSettings_t::Phase::kSampleLeading);
+
+    uint32_t received = 0;
+    for (int bit = bits_ - 1; bit >= 0; bit--)
+    {
+      const auto kOut = ((frame >> bit) & 1) ? Gpio::kHigh : Gpio::kLow;
+
+      // The data is set up half a clock before the edge it is sampled on.
+      if (kSampleLeading)
+      {
+        mosi_.Set(kOut);
+        timer_.WaitForEdge();
+        sck_.Set(kActive);
+        received = (received << 1) | miso_.Read();
+        timer_.WaitForEdge();
+        sck_.Set(idle_);
+      }
+      else
+      {
+        timer_.WaitForEdge();
+        sck_.Set(kActive);
+        mosi_.Set(kOut);
+        timer_.WaitForEdge();
+        sck_.Set(idle_);
+        received = (received << 1) | miso_.Read();
+      }
+    }
+    return received;
+  }
+
+  Sck & sck_;
+  Mosi & mosi_;
+  Miso & miso_;
+  ResourceID cpu_clock_;
+  EdgeTimer timer_;
+  Gpio::State idle_ = Gpio::kLow;
+  uint8_t bits_     = 8;
+};
+}  // namespace sjsu
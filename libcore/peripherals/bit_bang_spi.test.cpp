@@ -0,0 +1,107 @@
+#include <libcore/peripherals/bit_bang_spi.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// A concrete pin whose level can be shared with another pin, like a wire.
+struct WiredPin
+{
+  void Initialize() {}
+  void SetDirection(Gpio::Direction new_direction)
+  {
+    direction = new_direction;
+  }
+  void Set(Gpio::State state)
+  {
+    *level = (state == Gpio::kHigh);
+    levels.push_back(*level);
+  }
+  void Toggle()
+  {
+    Set(*level ? Gpio::kLow : Gpio::kHigh);
+  }
+  bool Read()
+  {
+    return *level;
+  }
+
+  bool * level;
+  Gpio::Direction direction = Gpio::kInput;
+  std::vector<bool> levels = {};
+};
+}  // namespace
+
+TEST_CASE("Testing BitBangSpi")
+{
+  bool clock = false;
+  bool data  = false;
+  WiredPin sck{ .level = &clock };
+  WiredPin mosi{ .level = &data };
+  WiredPin miso{ .level = &data };
+
+  BitBangSpi test_subject(sck, mosi, miso);
+  test_subject.settings.clock_rate = 1_MHz;
+
+  SECTION("Bytes are clocked out and back in through a loopback")
+  {
+    // Setup
+    test_subject.Initialize();
+    sck.levels.clear();
+    std::array<uint8_t, 2> buffer = { 0xA5, 0x3C };
+
+    // Exercise
+    test_subject.Transfer(buffer);
+
+    // Verify
+    CHECK(0xA5 == buffer[0]);
+    CHECK(0x3C == buffer[1]);
+    CHECK(Gpio::kOutput == sck.direction);
+    CHECK(Gpio::kOutput == mosi.direction);
+    REQUIRE(32 == sck.levels.size());
+    CHECK(sck.levels[0]);
+    CHECK(!sck.levels[1]);
+    CHECK(std::vector<bool>{ true, false, true, false, false, true, false,
+                             true, false, false, true, true, true, true,
+                             false, false } ==
+          std::vector<bool>(mosi.levels.end() - 16, mosi.levels.end()));
+  }
+
+  SECTION("Clock idles HIGH and data changes on the leading edge in mode 3")
+  {
+    // Setup
+    test_subject.settings.polarity = SpiSettings_t::Polarity::kIdleHigh;
+    test_subject.settings.phase    = SpiSettings_t::Phase::kSampleTrailing;
+    test_subject.Initialize();
+    CHECK(clock);
+    uint8_t byte = 0x81;
+
+    // Exercise
+    uint8_t received = test_subject.Transfer(byte);
+
+    // Verify
+    CHECK(0x81 == received);
+    CHECK(clock);
+  }
+
+  SECTION("Frames of other sizes are sent in 16-bit words")
+  {
+    // Setup
+    test_subject.settings.frame_size = SpiSettings_t::FrameSize::kTwelveBits;
+    test_subject.Initialize();
+    sck.levels.clear();
+    std::array<uint16_t, 1> buffer = { 0x0ABC };
+
+    // Exercise
+    test_subject.Transfer(buffer);
+
+    // Verify
+    CHECK(0x0ABC == buffer[0]);
+    CHECK(24 == sck.levels.size());
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,63 @@
+#include <libcore/peripherals/can.hpp>
+#include <libcore/testing/benchmark.hpp>
+#include <libcore/utility/memory_resource.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+namespace
+{
+/// CAN controller whose receive FIFO is never empty, cycling through a range
+/// of IDs.
+class FloodedCan : public Can
+{
+ public:
+  void ModuleInitialize() override {}
+  void Send(const Message_t &) override {}
+  Message_t Receive() override
+  {
+    static constexpr std::array<uint8_t, 8> kPayload = { 1, 2, 3, 4,
+                                                          5, 6, 7, 8 };
+    Message_t message{};
+    message.id = 0x100 + (next_id_++ % 64);
+    message.SetPayload(kPayload);
+    return message;
+  }
+  bool HasData() override
+  {
+    return true;
+  }
+  bool SelfTest(uint32_t) override
+  {
+    return true;
+  }
+  bool IsBusOff() override
+  {
+    return false;
+  }
+
+  using Can::Send;
+
+ private:
+  uint32_t next_id_ = 0;
+};
+}  // namespace
+
+SJ2_BENCHMARK("CanNetwork::ReceiveHandler 32 messages")
+{
+  FloodedCan can;
+  StaticMemoryResource<4096> memory_resource;
+  CanNetwork network(can, &memory_resource);
+  network.Reserve(32);
+  for (uint32_t id = 0x100; id < 0x100 + 32; id++)
+  {
+    benchmark::DoNotOptimize(network.CaptureMessage(id));
+  }
+  network.Initialize();
+
+  return benchmark::Run(name, [&network]() {
+    network.ManuallyCallReceiveHandler();
+  });
+}
+}  // namespace sjsu
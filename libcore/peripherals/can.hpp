@@ -5,17 +5,21 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <initializer_list>
 #include <libcore/module.hpp>
 #include <libcore/peripherals/inactive.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
 #include <libcore/utility/memory_resource.hpp>
+#include <libcore/utility/seqlock.hpp>
 #include <libcore/utility/time/time.hpp>
 #include <optional>
 #include <span>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace sjsu
 {
@@ -26,7 +30,7 @@ class Can;
 struct CanSettings_t
 {
   /// Can message receive handler definition
-  using ReceiveHandler = std::function<void(sjsu::Can &)>;
+  using ReceiveHandler = InplaceFunction<void(sjsu::Can &)>;
 
   /// Standard baud rate for most CANBUS networks
   static constexpr auto kStandardBaudRate = 100_kHz;
@@ -36,6 +40,10 @@ struct CanSettings_t
 
   /// When a message is received this handler is executed.
   ReceiveHandler handler = nullptr;
+
+  /// Baud rate of the data phase of CAN-FD messages with bit rate switching
+  /// enabled. Set to 0 to operate as a classic CAN 2.0B controller.
+  units::frequency::hertz_t data_baud_rate = 0_Hz;
 };
 
 /// The common interface for the CANBUS peripherals.
@@ -75,9 +83,10 @@ class Can : public Module<CanSettings_t>
     /// ID format
     Format format = Format::kStandard;
 
-    /// Set the time in which this message was received. This value is default
-    /// constructed and should not be changed.
-    std::chrono::nanoseconds uptime = Uptime();
+    /// Time at which this message was received, set by the driver when it
+    /// receives the message. 0 for messages that have not been received, so
+    /// that constructing a message does not read the uptime.
+    std::chrono::nanoseconds uptime = std::chrono::nanoseconds(0);
 
     /// Container of the payload contents
     std::array<uint8_t, 8> payload;
@@ -93,11 +102,266 @@ class Can : public Module<CanSettings_t>
     }
   };
 
+  /// This struct represents a CAN-FD message based on ISO 11898-1:2015, which
+  /// carries up to 64 bytes of payload and optionally transmits the payload
+  /// at a higher bit rate than the arbitration phase.
+  struct FdMessage_t
+  {
+    /// The largest payload a CAN-FD message can carry.
+    static constexpr size_t kMaximumPayload = 64;
+
+    /// Payload lengths that can be encoded in a CAN-FD data length code (DLC).
+    /// The index of each length is its DLC.
+    static constexpr std::array<uint8_t, 16> kDlcToLength = {
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64,
+    };
+
+    /// Convert a number of bytes into the smallest data length code (DLC)
+    /// able to hold them.
+    ///
+    /// @param length - number of bytes in the payload.
+    /// @return constexpr uint8_t - the DLC. Lengths greater than 64 bytes
+    ///         return the DLC for 64 bytes.
+    static constexpr uint8_t LengthToDlc(size_t length)
+    {
+      for (uint8_t dlc = 0; dlc < kDlcToLength.size(); dlc++)
+      {
+        if (length <= kDlcToLength[dlc])
+        {
+          return dlc;
+        }
+      }
+      return kDlcToLength.size() - 1;
+    }
+
+    /// CAN message ID
+    uint32_t id;
+
+    /// Length of the payload. Must be one of the lengths in kDlcToLength.
+    uint8_t length = 0;
+
+    /// ID format
+    Message_t::Format format = Message_t::Format::kStandard;
+
+    /// Transmit the payload at CanSettings_t::data_baud_rate rather than the
+    /// arbitration baud rate.
+    bool bit_rate_switch = true;
+
+    /// Time at which this message was received, set by the driver when it
+    /// receives the message. 0 for messages that have not been received, so
+    /// that constructing a message does not read the uptime.
+    std::chrono::nanoseconds uptime = std::chrono::nanoseconds(0);
+
+    /// Container of the payload contents
+    std::array<uint8_t, kMaximumPayload> payload = {};
+
+    /// Copy data from `data` to `payload` array. The length is rounded up to
+    /// the next length a DLC can represent and the extra bytes are set to 0.
+    /// Will be truncated if the size of the data is greater than 64 bytes.
+    ///
+    /// @param data - bytes to be copied into the payload.
+    void SetPayload(std::span<const uint8_t> data) noexcept
+    {
+      const size_t kCopyLength = std::min(payload.size(), data.size());
+      length = kDlcToLength[LengthToDlc(kCopyLength)];
+      std::copy_n(data.begin(), kCopyLength, payload.begin());
+      std::fill(payload.begin() + kCopyLength, payload.begin() + length, 0);
+    }
+  };
+
+  /// Message_t packed into 16 bytes rather than 24, for queues and buffers
+  /// holding many messages. The ID and its flags share one word, the data
+  /// length code shares a word with the lower bits of the uptime, and the
+  /// whole message is 4-byte aligned, so it is copied with four word moves.
+  ///
+  /// The uptime is kept in microseconds modulo kTimestampPeriod, about 268
+  /// seconds. Unpack() rebuilds the full uptime from a later time, such as
+  /// the current uptime.
+  struct PackedMessage_t
+  {
+    /// Bits of the ID in `header`.
+    static constexpr uint32_t kIdMask = 0x1FFF'FFFF;
+    /// Bit of `header` set for a remote request.
+    static constexpr uint32_t kRemoteRequest = 1UL << 29;
+    /// Bit of `header` set for an extended ID.
+    static constexpr uint32_t kExtended = 1UL << 30;
+    /// Bits of the length in `stamp`.
+    static constexpr uint32_t kLengthMask = 0xF;
+    /// Position of the timestamp in `stamp`.
+    static constexpr uint32_t kTimestampShift = 4;
+    /// Period after which the timestamp repeats.
+    static constexpr std::chrono::microseconds kTimestampPeriod =
+        std::chrono::microseconds(1UL << (32 - kTimestampShift));
+
+    /// @param message - message to pack. Its length must be at most 15 and
+    ///        its ID must fit in 29 bits.
+    /// @return constexpr PackedMessage_t - the packed message.
+    static constexpr PackedMessage_t Pack(const Message_t & message)
+    {
+      const auto kMicroseconds =
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              message.uptime)
+              .count();
+
+      PackedMessage_t packed;
+      packed.header =
+          (message.id & kIdMask) |
+          (message.is_remote_request ? kRemoteRequest : 0) |
+          ((message.format == Message_t::Format::kExtended) ? kExtended : 0);
+      packed.stamp = (message.length & kLengthMask) |
+                     (static_cast<uint32_t>(kMicroseconds) << kTimestampShift);
+      packed.payload = message.payload;
+      return packed;
+    }
+
+    /// @param reference - a time at or after the message's uptime and less
+    ///        than kTimestampPeriod after it, usually the current uptime. If
+    ///        0, the uptime of the unpacked message is 0.
+    /// @return constexpr Message_t - the message. Its uptime is the latest
+    ///         time at or before `reference` with the packed timestamp,
+    ///         truncated to microseconds.
+    constexpr Message_t Unpack(
+        std::chrono::nanoseconds reference = std::chrono::nanoseconds(0)) const
+    {
+      Message_t message{};
+      message.id                = header & kIdMask;
+      message.is_remote_request = (header & kRemoteRequest) != 0;
+      message.length            = static_cast<uint8_t>(stamp & kLengthMask);
+      message.format            = (header & kExtended)
+                                      ? Message_t::Format::kExtended
+                                      : Message_t::Format::kStandard;
+      message.payload           = payload;
+
+      if (reference.count() > 0)
+      {
+        const auto kReference =
+            std::chrono::duration_cast<std::chrono::microseconds>(reference);
+        auto elapsed = (kReference - Timestamp()) % kTimestampPeriod;
+        if (elapsed.count() < 0)
+        {
+          elapsed += kTimestampPeriod;
+        }
+        message.uptime = kReference - elapsed;
+      }
+
+      return message;
+    }
+
+    /// @return constexpr std::chrono::microseconds - the uptime of the message
+    ///         modulo kTimestampPeriod.
+    constexpr std::chrono::microseconds Timestamp() const
+    {
+      return std::chrono::microseconds(stamp >> kTimestampShift);
+    }
+
+    /// Compare all fields, including the timestamp and unused payload bytes.
+    constexpr bool operator==(const PackedMessage_t &) const = default;
+
+    /// ID in the lower 29 bits, followed by the remote request and extended
+    /// ID flags.
+    uint32_t header = 0;
+    /// Length in the lower 4 bits, followed by the timestamp in microseconds.
+    uint32_t stamp = 0;
+    /// Container of the payload contents
+    std::array<uint8_t, 8> payload = {};
+  };
+
   /// Send a message via CANBUS to the designated device with the supplied ID
   ///
   /// @param message - Message containing the CANBUS contents.
   virtual void Send(const Message_t & message) = 0;
 
+  /// Send a list of messages via CANBUS. Implementations with multiple
+  /// hardware transmit mailboxes should override this to load as many
+  /// mailboxes as are free at once rather than waiting for each message.
+  /// Messages are sent in the order given.
+  ///
+  /// The default implementation calls Send(const Message_t &) for each message.
+  ///
+  /// @param messages - messages to send.
+  virtual void Send(std::span<const Message_t> messages)
+  {
+    for (const auto & message : messages)
+    {
+      Send(message);
+    }
+  }
+
+  /// Send a CAN-FD message. Requires the peripheral to be initialized with a
+  /// non-zero CanSettings_t::data_baud_rate if bit rate switching is used.
+  ///
+  /// The default implementation is for classic CAN controllers and throws.
+  ///
+  /// @param message - Message containing the CANBUS contents.
+  /// @throw std::errc::operation_not_supported - if this peripheral does not
+  ///        support CAN-FD.
+  virtual void Send([[maybe_unused]] const FdMessage_t & message)
+  {
+    throw Exception(std::errc::operation_not_supported,
+                    "This CAN peripheral does not support CAN-FD.");
+  }
+
+  /// Send a list of CAN-FD messages. See Send(std::span<const Message_t>).
+  ///
+  /// The default implementation calls Send(const FdMessage_t &) for each
+  /// message.
+  ///
+  /// @param messages - messages to send.
+  virtual void Send(std::span<const FdMessage_t> messages)
+  {
+    for (const auto & message : messages)
+    {
+      Send(message);
+    }
+  }
+
+  /// @return size_t - number of transmit mailboxes that can be loaded and
+  ///         aborted individually with LoadMailbox() and AbortMailbox(). The
+  ///         default implementation returns 0, for peripherals that do not
+  ///         support it.
+  virtual size_t TransmitMailboxes()
+  {
+    return 0;
+  }
+
+  /// @param mailbox - transmit mailbox, below TransmitMailboxes().
+  /// @return true - if the mailbox holds a message that has not finished
+  ///         being sent.
+  /// @throw std::errc::operation_not_supported - if TransmitMailboxes() is 0.
+  virtual bool IsMailboxPending([[maybe_unused]] size_t mailbox)
+  {
+    throw Exception(std::errc::operation_not_supported,
+                    "This CAN peripheral has no individual mailboxes.");
+  }
+
+  /// Load a message into an empty transmit mailbox to be sent, without
+  /// waiting. Pending mailboxes are sent in order of their message IDs, as
+  /// they would arbitrate on the bus.
+  ///
+  /// @param mailbox - empty transmit mailbox, below TransmitMailboxes().
+  /// @param message - message to send.
+  /// @throw std::errc::operation_not_supported - if TransmitMailboxes() is 0.
+  virtual void LoadMailbox([[maybe_unused]] size_t mailbox,
+                           [[maybe_unused]] const Message_t & message)
+  {
+    throw Exception(std::errc::operation_not_supported,
+                    "This CAN peripheral has no individual mailboxes.");
+  }
+
+  /// Abort sending the message in a transmit mailbox. A message already on
+  /// the bus cannot be aborted, in which case this waits for it to finish.
+  /// Either way, the mailbox is empty on return.
+  ///
+  /// @param mailbox - transmit mailbox, below TransmitMailboxes().
+  /// @return true - if the message was aborted before being sent.
+  /// @return false - if the message was sent, or the mailbox was empty.
+  /// @throw std::errc::operation_not_supported - if TransmitMailboxes() is 0.
+  virtual bool AbortMailbox([[maybe_unused]] size_t mailbox)
+  {
+    throw Exception(std::errc::operation_not_supported,
+                    "This CAN peripheral has no individual mailboxes.");
+  }
+
   /// Receive a CANBUS message from the queue.
   ///
   /// @return Message_t - messages
@@ -120,10 +384,105 @@ class Can : public Module<CanSettings_t>
   /// @return false - if the device is NOT "bus off"
   virtual bool IsBusOff() = 0;
 
+  /// Counts kept by the peripheral of what happened on the bus. Counts the
+  /// hardware or driver does not keep remain 0. Each count is a 32-bit word
+  /// that wraps around, so rates should be taken from the difference between
+  /// two readings with unsigned arithmetic.
+  struct Counters_t
+  {
+    /// Frames sent by this peripheral.
+    uint32_t frames_transmitted = 0;
+    /// Bits occupied on the bus by the frames sent, see FrameBits().
+    uint32_t bits_transmitted = 0;
+    /// Frames lost because they arrived at a full receive FIFO.
+    uint32_t receive_overruns = 0;
+    /// Times a frame of this peripheral lost arbitration to another node.
+    uint32_t arbitration_lost = 0;
+    /// Transmit error counter (TEC). The peripheral is bus off above 255.
+    uint16_t transmit_error_counter = 0;
+    /// Receive error counter (REC).
+    uint16_t receive_error_counter = 0;
+  };
+
+  /// Read the peripheral's counters. Drivers should keep them in their
+  /// interrupt handlers or read them from hardware registers, so that reading
+  /// them is cheap.
+  ///
+  /// The default implementation returns all zeros.
+  ///
+  /// @return Counters_t - the peripheral's counters.
+  virtual Counters_t GetCounters()
+  {
+    return {};
+  }
+
+  /// Hardware acceptance filter. A received message is accepted if the bits of
+  /// its ID selected by `mask` are equal to the same bits of `id`.
+  struct AcceptanceFilter_t
+  {
+    /// ID to compare received message IDs against.
+    uint32_t id = 0;
+
+    /// Bits of the ID that must match. The default mask requires every bit of
+    /// the ID to match.
+    uint32_t mask = 0x1FFF'FFFF;
+
+    /// ID format of the messages this filter applies to.
+    Message_t::Format format = Message_t::Format::kStandard;
+  };
+
+  /// Add an acceptance filter to the CAN peripheral's hardware.
+  ///
+  /// Before any filters have been added, the peripheral accepts every message
+  /// on the bus. Once at least one filter has been added, only messages
+  /// matching one of the filters are placed in the receive FIFO, which
+  /// removes the cost of receiving and discarding unwanted messages in
+  /// software.
+  ///
+  /// The default implementation does not support hardware filtering and
+  /// returns false.
+  ///
+  /// @param filter - filter to add.
+  /// @return true - if the filter was installed.
+  /// @return false - if the hardware does not support filtering or has no
+  ///         filter banks left. The filters installed so far remain active.
+  virtual bool AddAcceptanceFilter(
+      [[maybe_unused]] const AcceptanceFilter_t & filter)
+  {
+    return false;
+  }
+
+  /// Remove every acceptance filter so the peripheral accepts every message on
+  /// the bus again.
+  virtual void ClearAcceptanceFilters() {}
+
   // ===========================================================================
   // Helper Functions
   // ===========================================================================
 
+  /// @param message - a classic CAN frame.
+  /// @param worst_case_stuffing - count the largest number of stuff bits the
+  ///        frame could need, rather than none.
+  /// @return constexpr uint32_t - number of bits the frame occupies on the bus,
+  ///         including the interframe space.
+  static constexpr uint32_t FrameBits(const Message_t & message,
+                                      bool worst_case_stuffing = false)
+  {
+    // SOF through end of frame, excluding the data field, then 3 bits of
+    // interframe space. Only SOF through the CRC sequence is bit stuffed.
+    const bool kExtended = (message.format == Message_t::Format::kExtended);
+    const uint32_t kDataBits =
+        message.is_remote_request
+            ? 0
+            : 8U * std::min<uint32_t>(message.length, 8U);
+    const uint32_t kFrameBits = (kExtended ? 64U : 44U) + kDataBits;
+    const uint32_t kStuffable = (kExtended ? 54U : 34U) + kDataBits;
+    const uint32_t kStuffBits = worst_case_stuffing ? (kStuffable - 1) / 4 : 0;
+    constexpr uint32_t kInterframeSpace = 3;
+
+    return kFrameBits + kStuffBits + kInterframeSpace;
+  }
+
   /// Send a message via CANBUS to the designated device with the supplied ID
   ///
   /// @param id - ID to send the data to.
@@ -184,26 +543,32 @@ inline sjsu::Can & GetInactive<sjsu::Can>()
     }
   };
 
-  static InactiveCan inactive_can;
-  return inactive_can;
+  return inactive_instance<InactiveCan>;
 }
 
 /// CanNetwork is a canbus message receiver handler and
 class CanNetwork : public sjsu::Module<>
 {
  public:
-  /// The node stored in the CanNetwork map. Holds the latest CAN message and
+  /// Maximum number of messages pulled from the CAN peripheral per call to
+  /// ReceiveHandler().
+  static constexpr size_t kMaximumMessagesPerReceive = 32;
+
+  class Listener;
+
+  /// The node stored in the CanNetwork. Holds the latest CAN message and
   /// contains methods for updating and retreiving can messages in a thread-safe
   /// manner that does not invoke OS locks.
   ///
-  /// Updating the CAN message data is completely lock free. Retrieving
-  /// data is NOT lock free, but instead uses atomics to poll for when the
-  /// Update() function has completed in some other thread. This asymmetry in
-  /// locking is to reduce latency for write case rather than than read case.
-  /// Storing a CAN message is typically done via an interrupt service routine
-  /// or a thread that MUST NOT block in anyway or the system can lock up. Where
-  /// as reading data typically is done by a userspace thread which can
-  /// typically wait a few cycles to get its data.
+  /// The message is protected by a sjsu::SeqLock. Updating the CAN message data
+  /// is completely lock free. Retrieving data is NOT lock free, but instead
+  /// retries the copy if the Update() function modified the message in some
+  /// other thread during the copy. This asymmetry in locking is to reduce
+  /// latency for write case rather than than read case. Storing a CAN message
+  /// is typically done via an interrupt service routine or a thread that MUST
+  /// NOT block in anyway or the system can lock up. Where as reading data
+  /// typically is done by a userspace thread which can typically wait a few
+  /// cycles to get its data.
   class Node_t
   {
    public:
@@ -213,8 +578,7 @@ class CanNetwork : public sjsu::Module<>
     /// Node assignment operator
     Node_t & operator=(const Node_t & node) noexcept
     {
-      data = node.data;
-      access_counter.store(access_counter.load());
+      data_.Write(node.data_.Read());
       return *this;
     }
 
@@ -227,75 +591,311 @@ class CanNetwork : public sjsu::Module<>
     /// Return a CAN message, but only do so if the CAN message of this node is
     /// not currently be modified by another thread that is using the Update()
     /// method.
-    Can::Message_t SecureGet()
+    Can::Message_t SecureGet() const
+    {
+      return data_.Read();
+    }
+
+    /// Return the CAN message only if a new message has been received since
+    /// the last time this method returned a message. Useful for control loops
+    /// that should skip processing when a frame has not been updated.
+    ///
+    /// @param last_sequence - sequence number of the last message processed by
+    ///        the caller. Updated when a new message is returned. Initialize to
+    ///        0 to receive the first message.
+    /// @return std::optional<Can::Message_t> - the new message or std::nullopt
+    ///         if no message has been received since `last_sequence`.
+    std::optional<Can::Message_t> GetIfChanged(uint32_t & last_sequence) const
+    {
+      return data_.ReadIfChanged(last_sequence);
+    }
+
+    /// @return uint32_t - the sequence number of the latest stored message.
+    ///         Increases each time a message is stored in this node.
+    uint32_t Sequence() const
+    {
+      return data_.Sequence();
+    }
+
+    /// @return uint32_t - number of messages received with this node's ID.
+    ///         Wraps around, see Can::Counters_t.
+    uint32_t Received() const
+    {
+      return received_.load(std::memory_order_relaxed);
+    }
+
+    /// @return uint32_t - number of messages received with this node's ID that
+    ///         could not be stored because another update of this node was
+    ///         in progress. These are not counted by Received() and do not
+    ///         appear in the history. Wraps around, see Can::Counters_t.
+    uint32_t Dropped() const
     {
-      // Continuously check if the received CAN message is valid. NOTE: that, in
-      // general, the looping logic for this function almost never occurs as
-      // copies from RAM/cache are fast between ReceiveHandler and GetMessage()
-      while (true)
+      return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /// Result of ReadHistory().
+    struct HistoryRead_t
+    {
+      /// Number of messages copied.
+      size_t count = 0;
+      /// Number of messages overwritten in the history before they were read.
+      uint32_t missed = 0;
+    };
+
+    /// Copy the messages received since the last read out of this node's
+    /// history, oldest first, for IDs captured with a history depth. Never
+    /// locks or retries, so the receive handler can store messages during the
+    /// copy. Messages overwritten in the history before or during the copy
+    /// are skipped and counted as missed.
+    ///
+    /// @param messages - destination of the messages. If it is smaller than
+    ///        the number of new messages, the rest are returned by the next
+    ///        call.
+    /// @param position - number of messages read from the history so far.
+    ///        Updated past the messages returned. Initialize to 0.
+    /// @return HistoryRead_t - the number of messages copied and missed. Both
+    ///         are 0 if the ID was captured without a history.
+    HistoryRead_t ReadHistory(std::span<Can::Message_t> messages,
+                              uint32_t & position) const
+    {
+      if (history_ == nullptr)
       {
-        // First, atomically copy the access_counter to a variable.
-        const auto kReadMessageStart = access_counter.load();
+        return {};
+      }
 
-        // Copy the contents of the mesage into the kCanMessage variable.
-        const Can::Message_t kCanMessage = data;
+      const uint32_t kDepth = HistoryDepth();
+      const uint32_t kEnd   = history_->stored.load(std::memory_order_acquire);
+      uint32_t start        = position;
+      uint32_t missed       = 0;
 
-        // Finally, atomically copy the access_counter again such that the value
-        // between the start and finish can be compared.
-        const auto kReadMessageFinish = access_counter.load();
+      if (kEnd - start > kDepth)
+      {
+        missed = kEnd - kDepth - start;
+        start  = kEnd - kDepth;
+      }
 
-        // If and only if these two values are the same, meaning that the
-        // ReceiveHandler isn't currently modifying the Node_t's data,
-        // can the message be considered valid.
-        if (kReadMessageStart == kReadMessageFinish)
-        {
-          return kCanMessage;
-        }
+      const size_t kCount = std::min<size_t>(kEnd - start, messages.size());
+      for (size_t i = 0; i < kCount; i++)
+      {
+        messages[i] = history_->messages[(start + i) & (kDepth - 1)];
       }
 
-      return {};
-    };
+      // Ensures the copies complete before checking which slots were claimed
+      // by writes during the copy. A message whose slot was claimed may be
+      // torn, so it is dropped.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const uint32_t kClaimed =
+          history_->claimed.load(std::memory_order_relaxed);
+      size_t overwritten = 0;
+      if (kClaimed - start > kDepth)
+      {
+        overwritten = std::min<size_t>(kCount, kClaimed - kDepth - start);
+        std::copy(messages.begin() + overwritten,
+                  messages.begin() + kCount,
+                  messages.begin());
+      }
+
+      position = start + static_cast<uint32_t>(kCount);
+      return { .count  = kCount - overwritten,
+               .missed = missed + static_cast<uint32_t>(overwritten) };
+    }
+
+    /// @return size_t - number of messages the history holds, or 0 if the ID
+    ///         was captured without a history.
+    size_t HistoryDepth() const
+    {
+      return (history_ != nullptr) ? history_->messages.size() : 0;
+    }
 
    private:
     friend CanNetwork;
 
+    /// Ring of the latest messages stored in a node. Each write claims its
+    /// slot before writing it, so a reader can tell which of the messages it
+    /// copied may have been overwritten during the copy.
+    struct History_t
+    {
+      /// @param depth - number of messages held. Must be a power of 2.
+      /// @param memory_resource - resource to allocate the messages from.
+      History_t(size_t depth, std::pmr::memory_resource * memory_resource)
+          : messages(depth, Can::Message_t{}, memory_resource)
+      {
+      }
+
+      /// Storage of the messages, indexed by the count of messages stored
+      /// modulo its size.
+      std::pmr::vector<Can::Message_t> messages;
+      /// Number of messages whose slot has been claimed by a write.
+      std::atomic<uint32_t> claimed = 0;
+      /// Number of messages completely stored.
+      std::atomic<uint32_t> stored = 0;
+    };
+
     /// Updates the can message in a lock-free way. Can only be accessed by the
     /// CanNetwork class.
     ///
     /// @param new_data - New CAN message to store
-    void Update(const Can::Message_t & new_data)
+    /// @return true - if the message was stored.
+    /// @return false - if another update of this node was in progress, such
+    ///         as when the receive handler preempted a copy into this node.
+    ///         Waiting for it to finish could lock up the handler, so the
+    ///         message is dropped and counted in Dropped() instead.
+    bool Update(const Can::Message_t & new_data)
+    {
+      if (!data_.Write(new_data))
+      {
+        dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                       std::memory_order_relaxed);
+        return false;
+      }
+
+      received_.store(received_.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+
+      if (history_ != nullptr)
+      {
+        const uint32_t kIndex =
+            history_->stored.load(std::memory_order_relaxed);
+        const size_t kSlot = kIndex & (history_->messages.size() - 1);
+
+        history_->claimed.store(kIndex + 1, std::memory_order_relaxed);
+        // Ensures the claim is visible before any part of the new message is.
+        std::atomic_thread_fence(std::memory_order_release);
+        history_->messages[kSlot] = new_data;
+        history_->stored.store(kIndex + 1, std::memory_order_release);
+      }
+
+      return true;
+    }
+
+    /// Holds the latest received can message.
+    SeqLock<Can::Message_t> data_{ Can::Message_t{} };
+
+    /// Listeners called with each message stored in this node.
+    Listener * listeners_ = nullptr;
+
+    /// Number of messages stored in this node.
+    std::atomic<uint32_t> received_ = 0;
+
+    /// Number of messages dropped because another update was in progress.
+    std::atomic<uint32_t> dropped_ = 0;
+
+    /// History of the latest messages, if the ID was captured with one.
+    History_t * history_ = nullptr;
+  };
+
+  /// Calls a function with every message stored in the node of a captured ID,
+  /// for as long as it exists. The function is called from the receive
+  /// handler, right after the node is updated, so it can keep values derived
+  /// from the message, such as decoded signals, up to date alongside the node.
+  ///
+  /// As with CaptureMessage(), listeners should be created during startup,
+  /// before the network is initialized.
+  class Listener
+  {
+   public:
+    /// Function called with each received message.
+    using Callback = InplaceFunction<void(const Can::Message_t &)>;
+
+    /// @param network - network to listen to.
+    /// @param id - ID of the messages to listen for. Captured if it was not
+    ///        already.
+    /// @param callback - called with each received message with this ID.
+    /// @param format - format of the frames with this ID.
+    /// @throw std::bad_alloc if the ID must be captured and the network's
+    ///        memory resource is full.
+    Listener(
+        CanNetwork & network,
+        uint32_t id,
+        Callback callback,
+        Can::Message_t::Format format = Can::Message_t::Format::kStandard)
+        : node_(*network.CaptureMessage(id, format)),
+          callback_(callback),
+          next_(node_.listeners_)
     {
-      // Atomic increment of the access counter to notify any threads that are
-      // using GetMesage() that the value of this node is changing.
-      access_counter++;
+      node_.listeners_ = this;
+    }
 
-      // Copy the contents of the new message into the map.
-      data = new_data;
+    Listener(const Listener &) = delete;
+    Listener & operator=(const Listener &) = delete;
 
-      // Another atomic increment of the access counter to notify any thread
-      // using GetMessage() that the value of this node has finished changing.
-      // For GetMessage to be valid, the function must save the access_counter,
-      // copy the message data, then check the access_counter again to make sure
-      // it has not changed. If it has changed, then GetMessage() should
-      // continue polling the map node until access_counter is the same between
-      // copies.
-      access_counter++;
+    ~Listener()
+    {
+      for (Listener ** listener = &node_.listeners_; *listener != nullptr;
+           listener             = &(*listener)->next_)
+      {
+        if (*listener == this)
+        {
+          *listener = next_;
+          break;
+        }
+      }
     }
 
-    /// Holds the latest received can message;
-    Can::Message_t data = {};
+   private:
+    friend CanNetwork;
+
+    Node_t & node_;
+    Callback callback_;
+    Listener * next_;
+  };
+
+  /// Counts kept by the receive handler. Each count is a 32-bit word that
+  /// wraps around, see Can::Counters_t.
+  struct Statistics_t
+  {
+    /// Frames read from the CAN peripheral.
+    uint32_t frames_received = 0;
+    /// Frames read whose ID was not captured, which hardware filtering would
+    /// have dropped.
+    uint32_t frames_ignored = 0;
+    /// Bits occupied on the bus by the frames read, see Can::FrameBits().
+    uint32_t bits_received = 0;
+    /// Frames read whose ID was captured, but that could not be stored
+    /// because their node was being updated, see Node_t::Dropped().
+    uint32_t frames_dropped = 0;
+    /// Calls to the receive handler that stopped at
+    /// kMaximumMessagesPerReceive with frames still in the FIFO.
+    uint32_t receive_limit_reached = 0;
+  };
+
+  /// An entry in the ID index of the CanNetwork. Entries are kept sorted by ID
+  /// in one contiguous array, so looking up a received ID is a binary search
+  /// over adjacent memory rather than a hash and a walk through a linked
+  /// bucket. A standard and an extended frame with the same numeric ID are
+  /// different messages, so entries with equal IDs are ordered by format.
+  struct IndexEntry_t
+  {
+    /// ID of the captured message.
+    uint32_t id;
+
+    /// Format of the captured message's frames.
+    Can::Message_t::Format format;
 
-    /// Used to indicate when the data field is being accessed
-    std::atomic<int> access_counter = 0;
+    /// Node holding the latest message received with this ID.
+    Node_t * node;
   };
 
   /// @param can - CAN peripheral to manage the network of.
   /// @param memory_resource - pointer to a memory resource.
   CanNetwork(Can & can, std::pmr::memory_resource * memory_resource) noexcept
-      : can_(can), messages_(memory_resource)
+      : can_(can), nodes_(memory_resource), index_(memory_resource)
   {
   }
 
+  /// Free the histories of IDs captured with one.
+  ~CanNetwork()
+  {
+    std::pmr::polymorphic_allocator<> allocator = nodes_.get_allocator();
+    for (Node_t & node : nodes_)
+    {
+      if (node.history_ != nullptr)
+      {
+        allocator.delete_object(node.history_);
+      }
+    }
+  }
+
   void ModuleInitialize() override
   {
     can_.settings.handler = [this](sjsu::Can & can) { ReceiveHandler(can); };
@@ -313,37 +913,182 @@ class CanNetwork : public sjsu::Module<>
   ///    Node_t * temperature_node = can_network.CaptureMessage(0x7AA);
   /// ```
   ///
+  /// Capturing an ID that has already been captured with the same format
+  /// returns the existing node. All IDs should be captured during startup,
+  /// before the network is initialized, as the receive handler reads the ID
+  /// index without locking.
+  ///
+  /// Extended IDs must be captured with Can::Message_t::Format::kExtended so
+  /// that the hardware filter installed for them matches 29-bit frames:
+  ///
+  /// ```
+  ///    Node_t * bms_node = can_network.CaptureMessage(
+  ///        0x18FF'50E5, Can::Message_t::Format::kExtended);
+  /// ```
+  ///
   /// @param id - Associated ID of messages to be stored.
+  /// @param format - format of the frames with this ID, used for the hardware
+  ///        acceptance filter.
+  /// @throw std::errc::invalid_argument - if a standard `id` is larger than
+  ///        11 bits.
   /// @throw std::bad_alloc if this static storage allocated for this object is
   /// not enough to hold
   /// @return Node_t* - reference to the CANBUS network Node_t which can be used
   /// at anytime to retreive the latest received message from the CANBUS that is
   /// associated with the set ID.
-  [[nodiscard]] Node_t * CaptureMessage(uint32_t id)
+  [[nodiscard]] Node_t * CaptureMessage(
+      uint32_t id,
+      Can::Message_t::Format format = Can::Message_t::Format::kStandard)
   {
-    Node_t empty_node;
+    constexpr uint32_t kStandardIdLimit = 0x7FF;
+
+    if (format == Can::Message_t::Format::kStandard && id > kStandardIdLimit)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Standard CAN IDs must fit in 11 bits.");
+    }
+
+    // Find where this ID belongs in the sorted index. This single search both
+    // determines if the ID was already captured and provides the insertion
+    // point if it was not.
+    auto position = LowerBound(id, format);
 
-    // Insert an empty Node_t into the map with the following ID as
-    // the key. This is how each ID is remembered when calls to
-    // ReceiveHandler() and GetMessage() are performed. ReceiveHandler() will
-    // ignore messages with IDs that are not already keys within the map.
-    // GetMessage() will throw an exception.
-    messages_.emplace(std::make_pair(id, empty_node));
+    if (IsMatch(position, id, format))
+    {
+      return position->node;
+    }
 
-    // Return reference to the newly made Node_t.
-    return &messages_[id];
+    // Nodes are stored in a deque, which never relocates existing elements
+    // when new ones are added, keeping previously returned Node_t pointers
+    // valid. Inserting into the index can only throw std::bad_alloc before
+    // the index is modified, but at that point the new node has already been
+    // created, so remove it again to leave the network unchanged.
+    Node_t & node = nodes_.emplace_back();
+    try
+    {
+      index_.insert(position,
+                    IndexEntry_t{ .id = id, .format = format, .node = &node });
+    }
+    catch (...)
+    {
+      nodes_.pop_back();
+      throw;
+    }
+
+    // Let the CAN peripheral drop messages with IDs that are not captured
+    // before they ever reach the ReceiveHandler().
+    AddHardwareFilter(id, format);
+
+    return &node;
+  }
+
+  /// Capture an ID and keep a history of its latest messages along with the
+  /// latest message, so that a consumer reading less often than the messages
+  /// arrive can process every one of them with Node_t::ReadHistory().
+  ///
+  /// ```
+  ///    Node_t * encoder_node = can_network.CaptureMessage(0x561, 16);
+  ///
+  ///    // Every 10ms:
+  ///    std::array<Can::Message_t, 16> messages;
+  ///    auto read = encoder_node->ReadHistory(messages, position);
+  ///    for (size_t i = 0; i < read.count; i++) { ... }
+  /// ```
+  ///
+  /// The history is allocated from the network's memory resource. If the ID
+  /// already has a history, it is kept as is.
+  ///
+  /// @param id - Associated ID of messages to be stored.
+  /// @param history_depth - number of messages the history holds. Must be a
+  ///        power of 2.
+  /// @param format - format of the frames with this ID.
+  /// @throw std::errc::invalid_argument - if `history_depth` is not a power
+  ///        of 2, or a standard `id` is larger than 11 bits.
+  /// @throw std::bad_alloc if the memory resource cannot hold the node or its
+  ///        history. The ID stays captured if only the history did not fit.
+  /// @return Node_t* - the node of the ID.
+  [[nodiscard]] Node_t * CaptureMessage(
+      uint32_t id,
+      size_t history_depth,
+      Can::Message_t::Format format = Can::Message_t::Format::kStandard)
+  {
+    if (history_depth == 0 || (history_depth & (history_depth - 1)) != 0)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "CAN message history depth must be a power of 2.");
+    }
+
+    Node_t * node = CaptureMessage(id, format);
+
+    if (node->history_ == nullptr)
+    {
+      std::pmr::polymorphic_allocator<> allocator = nodes_.get_allocator();
+      node->history_ = allocator.new_object<Node_t::History_t>(
+          history_depth, allocator.resource());
+    }
+
+    return node;
+  }
+
+  /// Reserve space for a number of captured IDs up front. Calling this before
+  /// a sequence of CaptureMessage() calls prevents the ID index from being
+  /// grown and copied repeatedly, which would otherwise leave stale copies of
+  /// the index behind in a monotonic memory resource.
+  ///
+  /// @param count - number of IDs that will be captured.
+  /// @throw std::bad_alloc if the memory resource cannot hold the index.
+  void Reserve(size_t count)
+  {
+    index_.reserve(count);
+  }
+
+  /// Find the node associated with a captured ID.
+  ///
+  /// @param id - ID of the message.
+  /// @param format - format of the message's frames.
+  /// @return Node_t* - the node for this ID, or nullptr if the ID was not
+  ///         captured with this format.
+  Node_t * Find(
+      uint32_t id,
+      Can::Message_t::Format format = Can::Message_t::Format::kStandard)
+  {
+    auto position = LowerBound(id, format);
+
+    if (IsMatch(position, id, format))
+    {
+      return position->node;
+    }
+
+    return nullptr;
+  }
+
+  /// @return true - if every captured ID has been installed as a hardware
+  ///         acceptance filter in the CAN peripheral.
+  /// @return false - if the CAN peripheral does not support hardware filters or
+  ///         ran out of filter banks. In this case, every message on the bus is
+  ///         received and uncaptured IDs are filtered out in software.
+  bool IsHardwareFiltering() const
+  {
+    return hardware_filtering_;
   }
 
   /// Manually call the receive handler. This is useful for unit testing and for
   /// CANBUS peripherals that do NOT have a receive message interrupt routine.
   /// In the later case, a software (potentially a thread) can perform the
   /// receive call manually to extract messages from the CAN peripheral FIFO.
+  /// Each call drains up to kMaximumMessagesPerReceive messages from the FIFO.
   /// This method cannot guarantee that data is not lost if the FIFO fills up.
   void ManuallyCallReceiveHandler()
   {
     ReceiveHandler(can_);
   }
 
+  /// @return const Statistics_t & - counts kept by the receive handler.
+  const Statistics_t & GetStatistics() const
+  {
+    return statistics_;
+  }
+
   /// Return the CAN peripheral object which can be used to initialize,
   /// configure, and enable the peripheral as well as transmit messages.
   /// Access to this object, if a CanNetwork
@@ -352,45 +1097,127 @@ class CanNetwork : public sjsu::Module<>
     return can_;
   }
 
-  /// Meant for testing purposes or when direct inspection of the map is useful
-  /// in userspace. Should not be used in SJSU-Dev2 libraries.
-  const auto & GetInternalMap()
+  /// Meant for testing purposes or when direct inspection of the ID index is
+  /// useful in userspace. Should not be used in SJSU-Dev2 libraries.
+  ///
+  /// @return const auto& - the captured IDs and their nodes, sorted by ID.
+  const auto & GetIndex()
   {
-    return messages_;
+    return index_;
   }
 
  private:
-  void ReceiveHandler(sjsu::Can & can)
+  /// Add an acceptance filter for the ID to the CAN peripheral. If the
+  /// peripheral is unable to install the filter, all filters are removed and
+  /// hardware filtering is abandoned so that no captured ID can be dropped by
+  /// the hardware.
+  ///
+  /// @param id - captured ID to accept.
+  /// @param format - format of the frames with this ID.
+  void AddHardwareFilter(uint32_t id, Can::Message_t::Format format)
   {
-    // If there isn't any data available, return early.
-    if (!can.HasData())
+    if (!hardware_filtering_)
     {
       return;
     }
 
-    // Pop the latest can message off the queue.
-    const auto kMessage = can.Receive();
+    const Can::AcceptanceFilter_t kFilter = {
+      .id     = id,
+      .format = format,
+    };
+
+    if (!can_.AddAcceptanceFilter(kFilter))
+    {
+      can_.ClearAcceptanceFilters();
+      hardware_filtering_ = false;
+    }
+  }
 
-    // Check if the map already has a value for this ID. This acts as the last
-    // stage of the CAN filter for the CANBUS Network module. If the key
-    // does NOT exist in the map, then this message will not be saved.
-    // Typically, this only happens when the hardware filter has not been setup
-    // properly to eliminate can messages that should be ignored.
-    //
-    // Map lookups can be costly, especially in a interrupt context, so only
-    // needing to hash/lookup the ID once is preferred. To prevent multiple
-    // lookups, an iterator is stored into the message_node variable.
-    auto message_node = messages_.find(kMessage.id);
+  void ReceiveHandler(sjsu::Can & can)
+  {
+    // Drain the receive FIFO, but bound the number of messages handled per
+    // call so a flooded bus cannot keep the processor in this handler forever.
+    for (size_t i = 0; i < kMaximumMessagesPerReceive; i++)
+    {
+      if (!can.HasData())
+      {
+        return;
+      }
+      StoreMessage(can.Receive());
+    }
 
-    // If the ID has an associated value in the map, then the node std::pair<>
-    // is returned, otherwise, the ::end() node is returned.
-    if (message_node != messages_.end())
+    if (can.HasData())
     {
-      message_node->second.Update(kMessage);
+      statistics_.receive_limit_reached++;
     }
   }
 
+  /// Store the message in its captured node, if its ID was captured.
+  ///
+  /// @param message - message received from the CAN peripheral.
+  void StoreMessage(const Can::Message_t & message)
+  {
+    statistics_.frames_received++;
+    statistics_.bits_received += Can::FrameBits(message);
+
+    // Check if the index has an entry for this ID. This acts as the last stage
+    // of the CAN filter for the CANBUS Network module. If the ID is not in the
+    // index, then this message will not be saved. Typically, this only happens
+    // when the hardware filter has not been setup properly to eliminate can
+    // messages that should be ignored.
+    if (Node_t * node = Find(message.id, message.format))
+    {
+      if (!node->Update(message))
+      {
+        statistics_.frames_dropped++;
+      }
+
+      for (Listener * listener = node->listeners_; listener != nullptr;
+           listener            = listener->next_)
+      {
+        listener->callback_(message);
+      }
+    }
+    else
+    {
+      statistics_.frames_ignored++;
+    }
+  }
+
+  /// @param id - ID to search for.
+  /// @param format - format to search for.
+  /// @return iterator to the first index entry that is not ordered before
+  ///         `id` and `format`.
+  std::pmr::vector<IndexEntry_t>::iterator LowerBound(
+      uint32_t id,
+      Can::Message_t::Format format)
+  {
+    return std::lower_bound(
+        index_.begin(),
+        index_.end(),
+        IndexEntry_t{ .id = id, .format = format, .node = nullptr },
+        [](const IndexEntry_t & entry, const IndexEntry_t & key) {
+          return entry.id < key.id ||
+                 (entry.id == key.id && entry.format < key.format);
+        });
+  }
+
+  /// @param position - result of LowerBound(id, format).
+  /// @param id - ID that was searched for.
+  /// @param format - format that was searched for.
+  /// @return true - if `position` is the entry of `id` and `format`.
+  bool IsMatch(std::pmr::vector<IndexEntry_t>::iterator position,
+               uint32_t id,
+               Can::Message_t::Format format)
+  {
+    return position != index_.end() && position->id == id &&
+           position->format == format;
+  }
+
   Can & can_;
-  std::pmr::unordered_map<uint32_t, Node_t> messages_;
+  std::pmr::deque<Node_t> nodes_;
+  std::pmr::vector<IndexEntry_t> index_;
+  bool hardware_filtering_ = true;
+  Statistics_t statistics_;
 };
 }  // namespace sjsu
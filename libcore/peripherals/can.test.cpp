@@ -1,5 +1,6 @@
 #include <libcore/peripherals/can.hpp>
 
+#include <array>
 #include <vector>
 
 #include <libcore/testing/testing_frameworks.hpp>
@@ -174,6 +175,216 @@ TEST_CASE("Testing CAN Peripheral Interface")
   }
 }
 
+/// Classic CAN controller that records the messages it sends.
+class RecordingCan : public Can
+{
+ public:
+  void ModuleInitialize() override {}
+  void Send(const Message_t & message) override
+  {
+    sent.push_back(message);
+  }
+  Message_t Receive() override
+  {
+    return {};
+  }
+  bool HasData() override
+  {
+    return false;
+  }
+  bool SelfTest(uint32_t) override
+  {
+    return true;
+  }
+  bool IsBusOff() override
+  {
+    return false;
+  }
+
+  using Can::Send;
+
+  std::vector<Message_t> sent;
+};
+
+TEST_CASE("Testing CAN batch and CAN-FD Send()")
+{
+  RecordingCan can;
+
+  SECTION("Send(std::span<const Message_t>)")
+  {
+    // Setup
+    const std::array<Can::Message_t, 3> kMessages = {
+      Can::Message_t{ .id = 0x100, .length = 1, .payload = { 0x01 } },
+      Can::Message_t{ .id = 0x200, .length = 2, .payload = { 0x02, 0x03 } },
+      Can::Message_t{ .id = 0x300, .length = 0, .payload = {} },
+    };
+
+    // Exercise
+    can.Send(std::span<const Can::Message_t>(kMessages));
+
+    // Verify
+    REQUIRE(3 == can.sent.size());
+    CHECK(kMessages[0] == can.sent[0]);
+    CHECK(kMessages[1] == can.sent[1]);
+    CHECK(kMessages[2] == can.sent[2]);
+  }
+
+  SECTION("Send(FdMessage_t) is unsupported by default")
+  {
+    // Setup
+    Can::FdMessage_t message{ .id = 0x123 };
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(can.Send(message), std::errc::operation_not_supported);
+  }
+
+  SECTION("FrameBits()")
+  {
+    // Setup
+    const Can::Message_t kMessage = {
+      .id      = 0x100,
+      .length  = 8,
+      .payload = {},
+    };
+    const Can::Message_t kExtended = {
+      .id      = 0x100,
+      .length  = 0,
+      .format  = Can::Message_t::Format::kExtended,
+      .payload = {},
+    };
+    const Can::Message_t kRemote = {
+      .id                = 0x100,
+      .is_remote_request = true,
+      .length            = 8,
+      .payload           = {},
+    };
+
+    // Exercise & Verify
+    CHECK(111 == Can::FrameBits(kMessage));
+    CHECK(135 == Can::FrameBits(kMessage, true));
+    CHECK(67 == Can::FrameBits(kExtended));
+    CHECK(47 == Can::FrameBits(kRemote));
+  }
+
+  SECTION("GetCounters() is all zeros by default")
+  {
+    // Exercise
+    Can::Counters_t counters = can.GetCounters();
+
+    // Verify
+    CHECK(0 == counters.frames_transmitted);
+    CHECK(0 == counters.bits_transmitted);
+    CHECK(0 == counters.receive_overruns);
+    CHECK(0 == counters.arbitration_lost);
+    CHECK(0 == counters.transmit_error_counter);
+    CHECK(0 == counters.receive_error_counter);
+  }
+
+  SECTION("Mailbox control is unsupported by default")
+  {
+    // Setup
+    const Can::Message_t kMessage = { .id = 0x100, .payload = {} };
+
+    // Exercise & Verify
+    CHECK(0 == can.TransmitMailboxes());
+    SJ2_CHECK_EXCEPTION(can.IsMailboxPending(0),
+                        std::errc::operation_not_supported);
+    SJ2_CHECK_EXCEPTION(can.LoadMailbox(0, kMessage),
+                        std::errc::operation_not_supported);
+    SJ2_CHECK_EXCEPTION(can.AbortMailbox(0),
+                        std::errc::operation_not_supported);
+  }
+
+  SECTION("FdMessage_t::SetPayload() rounds up to a valid length")
+  {
+    // Setup
+    std::array<uint8_t, 10> data = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    std::array<uint8_t, 70> oversized;
+    oversized.fill(0xAA);
+    Can::FdMessage_t message{ .id = 0x123 };
+    message.payload.fill(0xFF);
+
+    // Exercise
+    message.SetPayload(data);
+
+    // Verify
+    CHECK(12 == message.length);
+    CHECK(10 == message.payload[9]);
+    CHECK(0 == message.payload[10]);
+    CHECK(0 == message.payload[11]);
+
+    // Exercise
+    message.SetPayload(oversized);
+
+    // Verify
+    CHECK(64 == message.length);
+    CHECK(0xAA == message.payload[63]);
+  }
+
+  SECTION("FdMessage_t::LengthToDlc()")
+  {
+    // Verify
+    static_assert(0 == Can::FdMessage_t::LengthToDlc(0));
+    static_assert(8 == Can::FdMessage_t::LengthToDlc(8));
+    static_assert(9 == Can::FdMessage_t::LengthToDlc(9));
+    static_assert(9 == Can::FdMessage_t::LengthToDlc(12));
+    static_assert(13 == Can::FdMessage_t::LengthToDlc(25));
+    static_assert(15 == Can::FdMessage_t::LengthToDlc(64));
+    static_assert(15 == Can::FdMessage_t::LengthToDlc(100));
+  }
+
+  SECTION("PackedMessage_t round trip")
+  {
+    // Setup
+    static_assert(16 == sizeof(Can::PackedMessage_t));
+    static_assert(4 == alignof(Can::PackedMessage_t));
+    const Can::Message_t kMessage = {
+      .id                = 0x1ABC'DEF0,
+      .is_remote_request = true,
+      .length            = 5,
+      .format            = Can::Message_t::Format::kExtended,
+      .uptime            = 12'345'678us,
+      .payload           = { 1, 2, 3, 4, 5, 6, 7, 8 },
+    };
+
+    // Exercise
+    const auto kPacked   = Can::PackedMessage_t::Pack(kMessage);
+    const auto kUnpacked = kPacked.Unpack(kMessage.uptime + 1s);
+    const auto kUntimed  = kPacked.Unpack();
+
+    // Verify
+    CHECK(kMessage == kUnpacked);
+    CHECK(12'345'678us == kPacked.Timestamp());
+    CHECK(0ns == kUntimed.uptime);
+    CHECK(0x1ABC'DEF0 == kUntimed.id);
+    CHECK(kPacked == Can::PackedMessage_t::Pack(kUnpacked));
+  }
+
+  SECTION("PackedMessage_t rebuilds the uptime across a wrap")
+  {
+    // Setup
+    constexpr auto kPeriod = Can::PackedMessage_t::kTimestampPeriod;
+    const Can::Message_t kMessage = {
+      .id      = 0x100,
+      .length  = 0,
+      .uptime  = (3 * kPeriod) - 10us,
+      .payload = {},
+    };
+
+    // Exercise
+    const auto kPacked = Can::PackedMessage_t::Pack(kMessage);
+
+    // Verify
+    CHECK(kPeriod - 10us == kPacked.Timestamp());
+    CHECK(kMessage.uptime == kPacked.Unpack(kMessage.uptime).uptime);
+    CHECK(kMessage.uptime == kPacked.Unpack(3 * kPeriod + 5us).uptime);
+    CHECK(kMessage.uptime ==
+          kPacked.Unpack(kMessage.uptime + kPeriod - 1us).uptime);
+    CHECK(kMessage.uptime + kPeriod ==
+          kPacked.Unpack(kMessage.uptime + kPeriod).uptime);
+  }
+}
+
 TEST_CASE("Testing GetInactive<Can>()")
 {
   // Setup
@@ -199,6 +410,8 @@ TEST_CASE("Testing CanNetwork")
 {
   Mock<Can> mock_can;
   Fake(Method(mock_can, Can::ModuleInitialize));
+  When(Method(mock_can, Can::AddAcceptanceFilter)).AlwaysReturn(true);
+  Fake(Method(mock_can, Can::ClearAcceptanceFilters));
 
   Can & can = mock_can.get();
   StaticMemoryResource<1024> memory_resource;
@@ -207,7 +420,7 @@ TEST_CASE("Testing CanNetwork")
   SECTION("Initialize()")
   {
     // Setup
-    When(Method(mock_can, Can::HasData)).Return(true);
+    When(Method(mock_can, Can::HasData)).Return(true).Return(false);
     When(Method(mock_can, Can::Receive)).Return({});
 
     // Exercise
@@ -257,7 +470,13 @@ TEST_CASE("Testing CanNetwork")
       },
     };
 
-    When(Method(mock_can, Can::HasData)).AlwaysReturn(true);
+    // Report a single message in the FIFO for each call to the receive
+    // handler, so that each exercise step below receives one message.
+    bool has_data = false;
+    When(Method(mock_can, Can::HasData)).AlwaysDo([&has_data]() {
+      has_data = !has_data;
+      return has_data;
+    });
     When(Method(mock_can, Can::Receive))
         .Return(kExpectedMessages[0])
         .Return(kExpectedMessages[1])
@@ -356,12 +575,65 @@ TEST_CASE("Testing CanNetwork")
     // Verify: That memory was utilized from the memory resource
     CHECK(initial_memory_usage > memory_resource.MemoryAvailable());
 
-    // Verify: That the internal map contains each of these keys
-    CHECK(network.GetInternalMap().contains(0x111));
-    CHECK(network.GetInternalMap().contains(0x222));
-    CHECK(network.GetInternalMap().contains(0x333));
-    CHECK(network.GetInternalMap().contains(0x444));
-    CHECK(network.GetInternalMap().contains(0x555));
+    // Verify: That the index contains each of these keys
+    CHECK(message0 == network.Find(0x111));
+    CHECK(message1 == network.Find(0x222));
+    CHECK(message2 == network.Find(0x333));
+    CHECK(message3 == network.Find(0x444));
+    CHECK(message4 == network.Find(0x555));
+    CHECK(nullptr == network.Find(0x666));
+  }
+
+  SECTION("CaptureMessage(id) keeps the index sorted")
+  {
+    // Setup
+    network.Reserve(4);
+
+    // Exercise
+    auto * node_0x300 = network.CaptureMessage(0x300);
+    auto * node_0x100 = network.CaptureMessage(0x100);
+    auto * node_0x200 = network.CaptureMessage(0x200);
+    auto * duplicate  = network.CaptureMessage(0x100);
+
+    // Verify
+    const auto & index = network.GetIndex();
+    REQUIRE(3 == index.size());
+    CHECK(0x100 == index[0].id);
+    CHECK(node_0x100 == index[0].node);
+    CHECK(0x200 == index[1].id);
+    CHECK(node_0x200 == index[1].node);
+    CHECK(0x300 == index[2].id);
+    CHECK(node_0x300 == index[2].node);
+    CHECK(node_0x100 == duplicate);
+    // Verify: Only one filter is installed per ID
+    Verify(Method(mock_can, Can::AddAcceptanceFilter)).Exactly(3);
+  }
+
+  SECTION("Node_t::GetIfChanged()")
+  {
+    // Setup
+    When(Method(mock_can, Can::HasData))
+        .Return(true)
+        .Return(false)
+        .Return(false)
+        .Return(true)
+        .AlwaysReturn(false);
+    When(Method(mock_can, Can::Receive))
+        .AlwaysReturn(Can::Message_t{ .id = 0x100, .payload = {} });
+
+    CanNetwork::Node_t * node = network.CaptureMessage(0x100);
+    uint32_t last_sequence    = node->Sequence();
+
+    // Exercise & Verify
+    network.ManuallyCallReceiveHandler();
+    CHECK(node->GetIfChanged(last_sequence).has_value());
+
+    network.ManuallyCallReceiveHandler();
+    CHECK(!node->GetIfChanged(last_sequence).has_value());
+
+    network.ManuallyCallReceiveHandler();
+    CHECK(node->GetIfChanged(last_sequence).has_value());
+    CHECK(node->Sequence() == last_sequence);
   }
 
   SECTION("CaptureMessage(id) std::bad_alloc")
@@ -386,7 +658,7 @@ TEST_CASE("Testing CanNetwork")
   SECTION("ManuallyCallReceiveHandler()")
   {
     // Setup
-    When(Method(mock_can, Can::HasData)).Return(true).Return(false);
+    When(Method(mock_can, Can::HasData)).Return(true).AlwaysReturn(false);
     When(Method(mock_can, Can::Receive)).Return({});
 
     // Exercise
@@ -394,14 +666,288 @@ TEST_CASE("Testing CanNetwork")
     network.ManuallyCallReceiveHandler();
 
     // Verify
-    // Verify: HasData() should be called twice since we called the receive
-    //         handler twice but...
-    Verify(Method(mock_can, Can::HasData)).Twice();
+    // Verify: HasData() should be called three times, twice by the first call
+    //         which drains the FIFO until it is empty and once by the second
+    //         call which finds the FIFO empty, but...
+    Verify(Method(mock_can, Can::HasData)).Exactly(3);
     // Verify: but... the Receive() call should only happen once since HasData()
     //         only return true once in a subcase such as this.
     Verify(Method(mock_can, Can::Receive)).Once();
   }
 
+  SECTION("ManuallyCallReceiveHandler() drains the FIFO")
+  {
+    // Setup
+    When(Method(mock_can, Can::HasData))
+        .Return(true)
+        .Return(true)
+        .Return(true)
+        .AlwaysReturn(false);
+    When(Method(mock_can, Can::Receive))
+        .Return(Can::Message_t{ .id = 0x100, .length = 1, .payload = { 1 } })
+        .Return(Can::Message_t{ .id = 0x200, .length = 1, .payload = { 2 } })
+        .Return(Can::Message_t{ .id = 0x100, .length = 1, .payload = { 3 } });
+
+    CanNetwork::Node_t * node = network.CaptureMessage(0x100);
+
+    // Exercise
+    network.ManuallyCallReceiveHandler();
+
+    // Verify
+    Verify(Method(mock_can, Can::Receive)).Exactly(3);
+    CHECK(3 == node->SecureGet().payload[0]);
+    CHECK(2 == node->Received());
+    CHECK(3 == network.GetStatistics().frames_received);
+    CHECK(1 == network.GetStatistics().frames_ignored);
+    CHECK(0 == network.GetStatistics().receive_limit_reached);
+    // Three standard frames with 1 data byte: 44 + 8 + 3 bits each.
+    CHECK(3 * 55 == network.GetStatistics().bits_received);
+  }
+
+  SECTION("Listener")
+  {
+    // Setup
+    When(Method(mock_can, Can::HasData))
+        .Return(true)
+        .Return(true)
+        .Return(false)
+        .Return(true)
+        .AlwaysReturn(false);
+    When(Method(mock_can, Can::Receive))
+        .Return(Can::Message_t{ .id = 0x100, .length = 1, .payload = { 1 } })
+        .Return(Can::Message_t{ .id = 0x200, .length = 1, .payload = { 2 } })
+        .Return(Can::Message_t{ .id = 0x100, .length = 1, .payload = { 3 } });
+
+    std::vector<uint8_t> first;
+    std::vector<uint8_t> second;
+    CanNetwork::Listener first_listener(
+        network, 0x100, [&first](const Can::Message_t & message) {
+          first.push_back(message.payload[0]);
+        });
+
+    // Exercise
+    {
+      CanNetwork::Listener second_listener(
+          network, 0x100, [&second](const Can::Message_t & message) {
+            second.push_back(message.payload[0]);
+          });
+      network.ManuallyCallReceiveHandler();
+    }
+    network.ManuallyCallReceiveHandler();
+
+    // Verify
+    CHECK(network.Find(0x100) != nullptr);
+    CHECK(std::vector<uint8_t>{ 1, 3 } == first);
+    CHECK(std::vector<uint8_t>{ 1 } == second);
+    CHECK(3 == network.Find(0x100)->SecureGet().payload[0]);
+  }
+
+  SECTION("CaptureMessage(id, history_depth)")
+  {
+    // Setup
+    std::vector<Can::Message_t> received;
+    for (uint8_t i = 0; i < 7; i++)
+    {
+      received.push_back(
+          Can::Message_t{ .id = 0x100, .length = 1, .payload = { i } });
+    }
+    size_t next = 0;
+    size_t pending = 0;
+    When(Method(mock_can, Can::HasData)).AlwaysDo([&pending]() {
+      return pending > 0;
+    });
+    When(Method(mock_can, Can::Receive)).AlwaysDo([&]() {
+      pending--;
+      return received[next++];
+    });
+
+    CanNetwork::Node_t * node = network.CaptureMessage(0x100, 4);
+    std::array<Can::Message_t, 4> messages;
+    uint32_t position = 0;
+
+    // Exercise
+    pending = 3;
+    network.ManuallyCallReceiveHandler();
+    const auto kFirst = node->ReadHistory(std::span(messages).first(2),
+                                          position);
+    const uint8_t kFirstPayload = messages[0].payload[0];
+    const auto kSecond = node->ReadHistory(messages, position);
+    const uint8_t kSecondPayload = messages[0].payload[0];
+    pending = 4;
+    network.ManuallyCallReceiveHandler();
+    const auto kThird = node->ReadHistory(messages, position);
+    const auto kEmpty = node->ReadHistory(messages, position);
+
+    // Verify
+    CHECK(4 == node->HistoryDepth());
+    CHECK(node == network.CaptureMessage(0x100, 8));
+    CHECK(4 == node->HistoryDepth());
+    CHECK(2 == kFirst.count);
+    CHECK(0 == kFirst.missed);
+    CHECK(0 == kFirstPayload);
+    CHECK(1 == kSecond.count);
+    CHECK(2 == kSecondPayload);
+    CHECK(4 == kThird.count);
+    CHECK(0 == kThird.missed);
+    CHECK(3 == messages[0].payload[0]);
+    CHECK(6 == messages[3].payload[0]);
+    CHECK(0 == kEmpty.count);
+    CHECK(7 == position);
+    CHECK(6 == node->SecureGet().payload[0]);
+  }
+
+  SECTION("Node_t::ReadHistory() skips overwritten messages")
+  {
+    // Setup
+    uint8_t count = 0;
+    When(Method(mock_can, Can::HasData)).AlwaysDo([&count]() {
+      return count < 10;
+    });
+    When(Method(mock_can, Can::Receive)).AlwaysDo([&count]() {
+      return Can::Message_t{ .id      = 0x100,
+                             .length  = 1,
+                             .payload = { count++ } };
+    });
+
+    CanNetwork::Node_t * node = network.CaptureMessage(0x100, 4);
+    CanNetwork::Node_t * plain = network.CaptureMessage(0x200);
+    std::array<Can::Message_t, 4> messages;
+    uint32_t position = 0;
+    uint32_t plain_position = 0;
+
+    // Exercise
+    network.ManuallyCallReceiveHandler();
+    const auto kRead = node->ReadHistory(messages, position);
+    const auto kPlain = plain->ReadHistory(messages, plain_position);
+
+    // Verify
+    CHECK(4 == kRead.count);
+    CHECK(6 == kRead.missed);
+    CHECK(6 == messages[0].payload[0]);
+    CHECK(9 == messages[3].payload[0]);
+    CHECK(0 == kPlain.count);
+    CHECK(0 == plain->HistoryDepth());
+  }
+
+  SECTION("CaptureMessage(id, history_depth) requires a power of 2")
+  {
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(std::ignore = network.CaptureMessage(0x100, 3),
+                        std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(std::ignore = network.CaptureMessage(0x100, 0),
+                        std::errc::invalid_argument);
+    CHECK(nullptr == network.Find(0x100));
+  }
+
+  SECTION("ManuallyCallReceiveHandler() bounds messages per call")
+  {
+    // Setup
+    When(Method(mock_can, Can::HasData)).AlwaysReturn(true);
+    When(Method(mock_can, Can::Receive)).AlwaysReturn({});
+
+    // Exercise
+    network.ManuallyCallReceiveHandler();
+
+    // Verify
+    Verify(Method(mock_can, Can::Receive))
+        .Exactly(CanNetwork::kMaximumMessagesPerReceive);
+    CHECK(1 == network.GetStatistics().receive_limit_reached);
+    CHECK(CanNetwork::kMaximumMessagesPerReceive ==
+          network.GetStatistics().frames_received);
+    CHECK(CanNetwork::kMaximumMessagesPerReceive ==
+          network.GetStatistics().frames_ignored);
+  }
+
+  SECTION("CaptureMessage(id, format) installs hardware filters")
+  {
+    // Setup
+    constexpr auto kExtended = Can::Message_t::Format::kExtended;
+    std::vector<Can::AcceptanceFilter_t> filters;
+    When(Method(mock_can, Can::AddAcceptanceFilter))
+        .AlwaysDo([&filters](const Can::AcceptanceFilter_t & filter) {
+          filters.push_back(filter);
+          return true;
+        });
+
+    // Exercise
+    [[maybe_unused]] auto * standard = network.CaptureMessage(0x140);
+    [[maybe_unused]] auto * extended =
+        network.CaptureMessage(0x1234'5678, kExtended);
+    [[maybe_unused]] auto * low_extended =
+        network.CaptureMessage(0x7A, 4, kExtended);
+
+    // Verify
+    CHECK(network.IsHardwareFiltering());
+    REQUIRE(3 == filters.size());
+    CHECK(0x140 == filters[0].id);
+    CHECK(Can::Message_t::Format::kStandard == filters[0].format);
+    CHECK(0x1234'5678 == filters[1].id);
+    CHECK(kExtended == filters[1].format);
+    CHECK(0x7A == filters[2].id);
+    CHECK(kExtended == filters[2].format);
+    Verify(Method(mock_can, Can::ClearAcceptanceFilters)).Never();
+  }
+
+  SECTION("Standard and extended frames with the same ID are separate")
+  {
+    // Setup
+    constexpr auto kExtended = Can::Message_t::Format::kExtended;
+    const Can::Message_t kStandardMessage = { .id      = 0x123,
+                                              .length  = 1,
+                                              .payload = { 0xAA } };
+    const Can::Message_t kExtendedMessage = { .id      = 0x123,
+                                              .length  = 1,
+                                              .format  = kExtended,
+                                              .payload = { 0xBB } };
+    When(Method(mock_can, Can::HasData)).Return(true, true).AlwaysReturn(false);
+    When(Method(mock_can, Can::Receive))
+        .Return(kStandardMessage, kExtendedMessage);
+
+    // Exercise
+    auto * standard  = network.CaptureMessage(0x123);
+    auto * extended  = network.CaptureMessage(0x123, kExtended);
+    auto * duplicate = network.CaptureMessage(0x123, kExtended);
+    network.ManuallyCallReceiveHandler();
+
+    // Verify
+    CHECK(standard != extended);
+    CHECK(extended == duplicate);
+    CHECK(standard == network.Find(0x123));
+    CHECK(extended == network.Find(0x123, kExtended));
+    CHECK(2 == network.GetIndex().size());
+    CHECK(0xAA == standard->SecureGet().payload[0]);
+    CHECK(0xBB == extended->SecureGet().payload[0]);
+    CHECK(1 == standard->Received());
+    CHECK(1 == extended->Received());
+  }
+
+  SECTION("CaptureMessage(id) rejects standard IDs beyond 11 bits")
+  {
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(std::ignore = network.CaptureMessage(0x800),
+                        std::errc::invalid_argument);
+    CHECK(network.GetIndex().empty());
+    Verify(Method(mock_can, Can::AddAcceptanceFilter)).Never();
+  }
+
+  SECTION("CaptureMessage(id) falls back to software filtering")
+  {
+    // Setup
+    When(Method(mock_can, Can::AddAcceptanceFilter))
+        .Return(true)
+        .AlwaysReturn(false);
+
+    // Exercise
+    [[maybe_unused]] auto * node0 = network.CaptureMessage(0x100);
+    [[maybe_unused]] auto * node1 = network.CaptureMessage(0x200);
+    [[maybe_unused]] auto * node2 = network.CaptureMessage(0x300);
+
+    // Verify
+    CHECK(!network.IsHardwareFiltering());
+    Verify(Method(mock_can, Can::AddAcceptanceFilter)).Twice();
+    Verify(Method(mock_can, Can::ClearAcceptanceFilters)).Once();
+  }
+
   SECTION("CanBus()")
   {
     // Setup
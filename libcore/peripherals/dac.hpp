@@ -1,8 +1,11 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
+
 #include <libcore/module.hpp>
 #include <libcore/peripherals/inactive.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
 
 namespace sjsu
@@ -14,6 +17,11 @@ namespace sjsu
 class Dac : public Module<>
 {
  public:
+  /// Called with the half of the stream buffer that has just been played,
+  /// which should be refilled with the next samples, usually from an
+  /// interrupt. The other half is being played meanwhile.
+  using RefillCallback = InplaceFunction<void(std::span<uint16_t> samples)>;
+
   /// Set the DAC output the the value supplied. If the value is above what this
   /// driver can support, the value is clamped.
   ///
@@ -29,6 +37,48 @@ class Dac : public Module<>
 
   /// @return number of active bits for the DAC.
   virtual uint8_t GetActiveBits() = 0;
+
+  /// Play the samples of the circular `buffer`, one every 1 / `sample_rate`
+  /// seconds, in the background, for example with a timer triggered DMA.
+  /// Once each half of the buffer has been played, `refill` is called with
+  /// it to write the next samples. Plays until StopStream().
+  ///
+  /// Fill the whole buffer before starting the stream. A buffer that is never
+  /// refilled repeats, which generates periodic waveforms without a callback.
+  ///
+  /// The default implementation does not support streaming.
+  ///
+  /// USAGE:
+  ///
+  ///    std::array<uint16_t, 256> buffer;
+  ///    synthesizer.Generate(buffer);
+  ///    dac.StartStream(buffer, 44.1_kHz, [&synthesizer](auto half) {
+  ///      synthesizer.Generate(half);
+  ///    });
+  ///
+  /// @param buffer - circular buffer of samples, in the same units as
+  ///        Write(), with an even number of samples. The contents are NOT
+  ///        copied and it must remain valid until StopStream().
+  /// @param sample_rate - number of samples to play per second.
+  /// @param refill - called with each half of the buffer once played.
+  /// @return true - if the stream started.
+  virtual bool StartStream(
+      [[maybe_unused]] std::span<uint16_t> buffer,
+      [[maybe_unused]] units::frequency::hertz_t sample_rate,
+      [[maybe_unused]] RefillCallback refill)
+  {
+    return false;
+  }
+
+  /// Stop the stream started by StartStream(). The output keeps the last
+  /// sample played.
+  virtual void StopStream() {}
+
+  /// @return true - if a stream started by StartStream() is playing.
+  virtual bool IsStreaming()
+  {
+    return false;
+  }
 };
 
 /// Template specialization that generates an inactive sjsu::Dac.
@@ -47,7 +97,6 @@ inline sjsu::Dac & GetInactive<sjsu::Dac>()
     }
   };
 
-  static InactiveDac inactive;
-  return inactive;
+  return inactive_instance<InactiveDac>;
 }
 }  // namespace sjsu
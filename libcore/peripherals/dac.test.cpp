@@ -0,0 +1,31 @@
+#include <libcore/peripherals/dac.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing DAC Interface")
+{
+  Dac & test_subject = GetInactive<Dac>();
+
+  SECTION("Streaming is unsupported by default")
+  {
+    // Setup
+    std::array<uint16_t, 8> buffer = {};
+    int refills                    = 0;
+
+    // Exercise
+    bool started = test_subject.StartStream(
+        buffer, 44.1_kHz, [&refills](std::span<uint16_t>) { refills++; });
+    test_subject.StopStream();
+
+    // Verify
+    CHECK(!started);
+    CHECK(!test_subject.IsStreaming());
+    CHECK(0 == refills);
+  }
+}
+}  // namespace sjsu
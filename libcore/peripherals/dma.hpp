@@ -0,0 +1,452 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <type_traits>
+
+#include <libcore/module.hpp>
+#include <libcore/peripherals/inactive.hpp>
+#include <libcore/utility/cache.hpp>
+#include <libcore/utility/enum.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/inplace_function.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// An abstract interface for Direct Memory Access controllers, which move
+/// data between memory and peripherals, or from memory to memory, without
+/// the CPU.
+///
+/// A controller has a number of channels that each run one transfer at a
+/// time. Drivers that need DMA, such as a Uart transmitting in the
+/// background or a Dac playing a waveform, share the controller by acquiring
+/// a channel for as long as they need it, usually with a DmaChannel.
+///
+/// A transfer is a list of descriptors that the channel performs one after
+/// the other, such as the two halves of a ping-pong buffer or a header and a
+/// payload from different buffers. A circular transfer starts over from the
+/// first descriptor after the last, until it is stopped.
+///
+/// On processors with a data cache, memory that DMA writes should be a
+/// DmaBuffer, or placed with SJ2_NON_CACHEABLE, so the cache maintenance of
+/// PrepareCache() and CompleteCache() cannot corrupt neighbouring data.
+///
+/// USAGE:
+///
+///    sjsu::DmaChannel channel(dma);
+///    const std::array kDescriptors = {
+///      sjsu::Dma::Descriptor_t::ToRegister<uint16_t>(samples, &dac->DATA),
+///    };
+///    channel.Start({
+///        .descriptors = kDescriptors,
+///        .request     = kDacRequest,
+///        .circular    = true,
+///        .callback    = [](sjsu::Dma::Event event, size_t) {
+///          RefillHalf(event == sjsu::Dma::Event::kHalfTransfer);
+///        },
+///    });
+///
+/// @ingroup l1_peripheral
+class Dma : public Module<>
+{
+ public:
+  // ===========================================================================
+  // Interface Defintions
+  // ===========================================================================
+
+  /// Size of each element moved by a descriptor.
+  enum class Width : uint8_t
+  {
+    kByte     = 1,
+    kHalfWord = 2,
+    kWord     = 4,
+  };
+
+  /// Events reported to a transfer's callback.
+  enum class Event : uint8_t
+  {
+    /// Half of the elements of a descriptor have been moved.
+    kHalfTransfer,
+    /// Every element of a descriptor has been moved.
+    kTransferComplete,
+    /// The controller hit a bus error and stopped the channel.
+    kError,
+  };
+
+  /// Called from the controller's interrupt with the event and the index of
+  /// the descriptor it happened in.
+  using Callback = InplaceFunction<void(Event event, size_t descriptor)>;
+
+  /// Request line of transfers that are not paced by a peripheral. They run
+  /// as fast as the bus allows.
+  static constexpr uint32_t kMemoryToMemory = UINT32_MAX;
+
+  /// One block of elements to move.
+  struct Descriptor_t
+  {
+    /// @param source - elements to copy.
+    /// @param destination - where to copy them. Only as many elements as fit
+    ///        are copied.
+    /// @return Descriptor_t - copies memory to memory.
+    template <typename T>
+    static Descriptor_t Memory(std::span<const std::type_identity_t<T>> source,
+                               std::span<T> destination)
+    {
+      return {
+        .source      = source.data(),
+        .destination = destination.data(),
+        .count       = std::min(source.size(), destination.size()),
+        .width       = WidthOf<T>(),
+      };
+    }
+
+    /// @param source - elements to write to the register.
+    /// @param destination - peripheral data register.
+    /// @return Descriptor_t - writes each element to the same register.
+    template <typename T>
+    static Descriptor_t ToRegister(
+        std::span<const std::type_identity_t<T>> source,
+        volatile T * destination)
+    {
+      return {
+        .source                = source.data(),
+        .destination           = destination,
+        .count                 = source.size(),
+        .width                 = WidthOf<T>(),
+        .increment_destination = false,
+      };
+    }
+
+    /// @param source - peripheral data register.
+    /// @param destination - buffer for the elements read.
+    /// @return Descriptor_t - reads the register once for each element.
+    template <typename T>
+    static Descriptor_t FromRegister(const volatile T * source,
+                                     std::span<T> destination)
+    {
+      return {
+        .source           = source,
+        .destination      = destination.data(),
+        .count            = destination.size(),
+        .width            = WidthOf<T>(),
+        .increment_source = false,
+      };
+    }
+
+    /// Address of the first element to read.
+    const volatile void * source = nullptr;
+    /// Address of the first element to write.
+    volatile void * destination = nullptr;
+    /// Number of elements to move.
+    size_t count = 0;
+    /// Size of each element.
+    Width width = Width::kByte;
+    /// Move to the next element of the source after each element. False for
+    /// a peripheral register or to fill memory with one value.
+    bool increment_source = true;
+    /// Move to the next element of the destination after each element.
+    bool increment_destination = true;
+  };
+
+  /// A transfer for Start().
+  struct Transfer_t
+  {
+    /// Descriptors to perform in order. They are NOT copied and must remain
+    /// valid until the transfer completes or is stopped.
+    std::span<const Descriptor_t> descriptors;
+    /// Peripheral request line that paces the transfer. The values are
+    /// specific to each controller. kMemoryToMemory for memory copies.
+    uint32_t request = kMemoryToMemory;
+    /// Start over from the first descriptor after the last one.
+    bool circular = false;
+    /// Called with each event of the transfer, if set.
+    Callback callback = nullptr;
+  };
+
+  // ===========================================================================
+  // Interface Methods
+  // ===========================================================================
+
+  /// @return uint8_t - number of channels, at most 32.
+  virtual uint8_t GetChannelCount() = 0;
+
+  /// Start a transfer on a channel. A transfer already running on the
+  /// channel is stopped first.
+  ///
+  /// @param channel - channel acquired with AcquireChannel().
+  /// @param transfer - transfer to perform.
+  virtual void Start(uint8_t channel, const Transfer_t & transfer) = 0;
+
+  /// Stop the transfer on a channel. No callbacks are made after it returns.
+  ///
+  /// @param channel - channel to stop.
+  virtual void Stop(uint8_t channel) = 0;
+
+  /// @param channel - channel to check.
+  /// @return true - if a transfer is running on the channel.
+  virtual bool IsBusy(uint8_t channel) = 0;
+
+  /// @param channel - channel to check.
+  /// @return size_t - number of elements of the current descriptor that
+  ///         have not been moved yet, such as for finding how far a circular
+  ///         receive buffer has been filled.
+  virtual size_t GetRemaining(uint8_t channel) = 0;
+
+  // ===========================================================================
+  // Helper Functions
+  // ===========================================================================
+
+  /// Claim a free channel. Channels should be acquired from the main program
+  /// rather than from interrupts.
+  ///
+  /// @return uint8_t - the channel.
+  /// @throw std::errc::resource_unavailable_try_again - if every channel is
+  ///        in use.
+  uint8_t AcquireChannel()
+  {
+    const uint8_t kCount = std::min<uint8_t>(GetChannelCount(), 32);
+    const uint32_t kAll  = (kCount == 32) ? UINT32_MAX : (1u << kCount) - 1;
+    const uint32_t kFree = ~acquired_ & kAll;
+    if (kFree == 0)
+    {
+      throw Exception(std::errc::resource_unavailable_try_again,
+                      "Every DMA channel is in use.");
+    }
+
+    const auto kChannel = static_cast<uint8_t>(std::countr_zero(kFree));
+    acquired_ |= 1u << kChannel;
+    return kChannel;
+  }
+
+  /// Stop a channel and return it to the free channels.
+  ///
+  /// @param channel - channel from AcquireChannel().
+  void ReleaseChannel(uint8_t channel)
+  {
+    Stop(channel);
+    acquired_ &= ~(1u << channel);
+  }
+
+  /// Copy memory with a free channel and wait for it to finish.
+  ///
+  /// @param source - elements to copy.
+  /// @param destination - where to copy them. Only as many elements as fit
+  ///        are copied.
+  /// @throw std::errc::resource_unavailable_try_again - if every channel is
+  ///        in use.
+  template <typename T>
+  void Copy(std::span<const std::type_identity_t<T>> source,
+            std::span<T> destination)
+  {
+    const uint8_t kChannel = AcquireChannel();
+    const std::array<Descriptor_t, 1> kDescriptors = {
+      Descriptor_t::Memory(source, destination),
+    };
+    Start(kChannel, { .descriptors = kDescriptors });
+    Wait(std::chrono::nanoseconds::max(),
+         [this, kChannel] { return !IsBusy(kChannel); });
+    ReleaseChannel(kChannel);
+  }
+
+ protected:
+  /// Clean the memory sources and invalidate the memory destinations of a
+  /// transfer, so the DMA reads what the CPU wrote and the cache cannot
+  /// write stale lines over what the DMA writes. Implementations call it in
+  /// Start() before enabling the channel. Does nothing without a data cache.
+  ///
+  /// @param transfer - transfer about to start.
+  static void PrepareCache(const Transfer_t & transfer)
+  {
+    for (const Descriptor_t & descriptor : transfer.descriptors)
+    {
+      const size_t kBytes = descriptor.count * Value(descriptor.width);
+      if (descriptor.increment_source)
+      {
+        DataCache::Clean(descriptor.source, kBytes);
+      }
+      if (descriptor.increment_destination)
+      {
+        DataCache::Invalidate(descriptor.destination, kBytes);
+      }
+    }
+  }
+
+  /// Invalidate the memory destination of a descriptor again, dropping lines
+  /// the CPU speculatively read during the transfer. Implementations call it
+  /// when a descriptor completes, before the callback.
+  ///
+  /// @param descriptor - descriptor that completed.
+  static void CompleteCache(const Descriptor_t & descriptor)
+  {
+    if (descriptor.increment_destination)
+    {
+      DataCache::Invalidate(descriptor.destination,
+                            descriptor.count * Value(descriptor.width));
+    }
+  }
+
+  /// Move elements of a descriptor with the CPU, for controllers that fall
+  /// back to it, such as the inactive Dma.
+  ///
+  /// @param descriptor - elements to move.
+  /// @param begin - index of the first element to move.
+  /// @param end - index one past the last element to move.
+  static void CopyWithCpu(const Descriptor_t & descriptor,
+                          size_t begin,
+                          size_t end)
+  {
+    switch (descriptor.width)
+    {
+      case Width::kByte: CopyElements<uint8_t>(descriptor, begin, end); break;
+      case Width::kHalfWord:
+        CopyElements<uint16_t>(descriptor, begin, end);
+        break;
+      case Width::kWord: CopyElements<uint32_t>(descriptor, begin, end); break;
+    }
+  }
+
+ private:
+  template <typename T>
+  static constexpr Width WidthOf()
+  {
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4,
+                  "DMA elements must be 1, 2 or 4 bytes.");
+    return static_cast<Width>(sizeof(T));
+  }
+
+  template <typename T>
+  static void CopyElements(const Descriptor_t & descriptor,
+                           size_t begin,
+                           size_t end)
+  {
+    auto * source      = static_cast<const volatile T *>(descriptor.source);
+    auto * destination = static_cast<volatile T *>(descriptor.destination);
+    for (size_t i = begin; i < end; i++)
+    {
+      destination[descriptor.increment_destination ? i : 0] =
+          source[descriptor.increment_source ? i : 0];
+    }
+  }
+
+  uint32_t acquired_ = 0;
+};
+
+/// A channel of a Dma, acquired for the lifetime of this object. Drivers
+/// hold one while they use DMA, so that other drivers can use the channel
+/// once it is destroyed.
+///
+/// @throw std::errc::resource_unavailable_try_again - on construction, if
+///        every channel is in use.
+class DmaChannel
+{
+ public:
+  /// @param dma - controller to acquire a channel of.
+  explicit DmaChannel(Dma & dma) : dma_(dma), channel_(dma.AcquireChannel())
+  {
+  }
+
+  DmaChannel(const DmaChannel &) = delete;
+  DmaChannel & operator=(const DmaChannel &) = delete;
+
+  /// Stops any transfer and releases the channel.
+  ~DmaChannel()
+  {
+    dma_.ReleaseChannel(channel_);
+  }
+
+  /// See Dma::Start().
+  void Start(const Dma::Transfer_t & transfer)
+  {
+    dma_.Start(channel_, transfer);
+  }
+
+  /// See Dma::Stop().
+  void Stop()
+  {
+    dma_.Stop(channel_);
+  }
+
+  /// See Dma::IsBusy().
+  bool IsBusy()
+  {
+    return dma_.IsBusy(channel_);
+  }
+
+  /// See Dma::GetRemaining().
+  size_t GetRemaining()
+  {
+    return dma_.GetRemaining(channel_);
+  }
+
+  /// @return uint8_t - number of the channel.
+  uint8_t Number() const
+  {
+    return channel_;
+  }
+
+ private:
+  Dma & dma_;
+  uint8_t channel_;
+};
+
+/// Template specialization that generates an inactive sjsu::Dma. Rather than
+/// doing nothing, it performs each transfer with the CPU as soon as it is
+/// started, so drivers written for DMA still move their data on platforms
+/// without a controller. Circular transfers go through their descriptors
+/// once, since a CPU copy cannot keep running in the background.
+template <>
+inline sjsu::Dma & GetInactive<sjsu::Dma>()
+{
+  class InactiveDma : public sjsu::Dma
+  {
+   public:
+    void ModuleInitialize() override {}
+
+    uint8_t GetChannelCount() override
+    {
+      return 8;
+    }
+
+    void Start(uint8_t, const Transfer_t & transfer) override
+    {
+      for (size_t i = 0; i < transfer.descriptors.size(); i++)
+      {
+        const Descriptor_t & descriptor = transfer.descriptors[i];
+        const size_t kHalf              = descriptor.count / 2;
+
+        CopyWithCpu(descriptor, 0, kHalf);
+        if (transfer.callback)
+        {
+          transfer.callback(Event::kHalfTransfer, i);
+        }
+        CopyWithCpu(descriptor, kHalf, descriptor.count);
+        if (transfer.callback)
+        {
+          transfer.callback(Event::kTransferComplete, i);
+        }
+      }
+    }
+
+    void Stop(uint8_t) override {}
+
+    bool IsBusy(uint8_t) override
+    {
+      return false;
+    }
+
+    size_t GetRemaining(uint8_t) override
+    {
+      return 0;
+    }
+  };
+
+  return inactive_instance<InactiveDma>;
+}
+}  // namespace sjsu
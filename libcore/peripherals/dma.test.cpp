@@ -0,0 +1,192 @@
+#include <libcore/peripherals/dma.hpp>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// A Dma with two channels that records which channels were stopped.
+class TwoChannelDma : public Dma
+{
+ public:
+  void ModuleInitialize() override {}
+
+  uint8_t GetChannelCount() override
+  {
+    return 2;
+  }
+
+  void Start(uint8_t channel, const Transfer_t &) override
+  {
+    started.push_back(channel);
+  }
+
+  void Stop(uint8_t channel) override
+  {
+    stopped.push_back(channel);
+  }
+
+  bool IsBusy(uint8_t) override
+  {
+    return false;
+  }
+
+  size_t GetRemaining(uint8_t) override
+  {
+    return 0;
+  }
+
+  std::vector<uint8_t> started;
+  std::vector<uint8_t> stopped;
+};
+}  // namespace
+
+TEST_CASE("Testing Dma")
+{
+  SECTION("Descriptor_t helpers set the width, count and increments")
+  {
+    // Setup
+    const std::array<uint16_t, 4> kSource = { 1, 2, 3, 4 };
+    std::array<uint16_t, 3> destination;
+    volatile uint32_t data_register = 0;
+    std::array<uint32_t, 2> received;
+
+    // Exercise
+    const auto kMemory = Dma::Descriptor_t::Memory<uint16_t>(kSource,
+                                                             destination);
+    const auto kToRegister =
+        Dma::Descriptor_t::ToRegister<uint16_t>(kSource, nullptr);
+    const auto kFromRegister =
+        Dma::Descriptor_t::FromRegister<uint32_t>(&data_register, received);
+
+    // Verify
+    CHECK(3 == kMemory.count);
+    CHECK(Dma::Width::kHalfWord == kMemory.width);
+    CHECK(kMemory.increment_source);
+    CHECK(kMemory.increment_destination);
+
+    CHECK(4 == kToRegister.count);
+    CHECK(kToRegister.increment_source);
+    CHECK(!kToRegister.increment_destination);
+
+    CHECK(2 == kFromRegister.count);
+    CHECK(Dma::Width::kWord == kFromRegister.width);
+    CHECK(!kFromRegister.increment_source);
+    CHECK(kFromRegister.increment_destination);
+  }
+
+  SECTION("AcquireChannel() hands out each channel once")
+  {
+    // Setup
+    TwoChannelDma dma;
+
+    // Exercise
+    const uint8_t kFirst  = dma.AcquireChannel();
+    const uint8_t kSecond = dma.AcquireChannel();
+
+    // Verify
+    CHECK(0 == kFirst);
+    CHECK(1 == kSecond);
+    SJ2_CHECK_EXCEPTION(dma.AcquireChannel(),
+                        std::errc::resource_unavailable_try_again);
+
+    // Exercise
+    dma.ReleaseChannel(kFirst);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0 } == dma.stopped);
+    CHECK(0 == dma.AcquireChannel());
+  }
+
+  SECTION("DmaChannel releases its channel when destroyed")
+  {
+    // Setup
+    TwoChannelDma dma;
+
+    // Exercise
+    {
+      DmaChannel first(dma);
+      DmaChannel second(dma);
+      first.Start({});
+      second.Start({});
+      CHECK(1 == second.Number());
+    }
+    DmaChannel again(dma);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0, 1 } == dma.started);
+    CHECK(std::vector<uint8_t>{ 1, 0 } == dma.stopped);
+    CHECK(0 == again.Number());
+  }
+
+  SECTION("Inactive Dma copies memory with the CPU")
+  {
+    // Setup
+    Dma & dma                             = GetInactive<sjsu::Dma>();
+    const std::array<uint32_t, 4> kSource = { 10, 20, 30, 40 };
+    std::array<uint32_t, 4> destination   = {};
+
+    // Exercise
+    dma.Copy<uint32_t>(kSource, destination);
+
+    // Verify
+    CHECK(kSource == destination);
+    CHECK(0 == dma.AcquireChannel());
+    dma.ReleaseChannel(0);
+  }
+
+  SECTION("Inactive Dma performs linked descriptors in order")
+  {
+    // Setup
+    DmaChannel channel(GetInactive<sjsu::Dma>());
+    const std::array<uint8_t, 4> kHeader = { 'H', 'E', 'A', 'D' };
+    const uint8_t kFill                  = 0xAA;
+    volatile uint8_t data_register       = 0;
+    std::array<uint8_t, 6> buffer        = {};
+    std::vector<std::pair<Dma::Event, size_t>> events;
+    std::vector<uint8_t> buffer_at_half;
+
+    const Dma::Descriptor_t kFillTail = {
+      .source           = &kFill,
+      .destination      = buffer.data() + 4,
+      .count            = 2,
+      .increment_source = false,
+    };
+    const std::array<Dma::Descriptor_t, 3> kDescriptors = {
+      Dma::Descriptor_t::Memory<uint8_t>(kHeader, buffer),
+      kFillTail,
+      Dma::Descriptor_t::ToRegister<uint8_t>(kHeader, &data_register),
+    };
+
+    // Exercise
+    channel.Start({
+        .descriptors = kDescriptors,
+        .callback    = [&](Dma::Event event, size_t descriptor) {
+          events.push_back({ event, descriptor });
+          if (descriptor == 0 && event == Dma::Event::kHalfTransfer)
+          {
+            buffer_at_half.assign(buffer.begin(), buffer.end());
+          }
+        },
+    });
+
+    // Verify
+    CHECK(std::array<uint8_t, 6>{ 'H', 'E', 'A', 'D', 0xAA, 0xAA } == buffer);
+    CHECK('D' == data_register);
+    CHECK(std::vector<uint8_t>{ 'H', 'E', 0, 0, 0, 0 } == buffer_at_half);
+    const std::vector<std::pair<Dma::Event, size_t>> kExpected = {
+      { Dma::Event::kHalfTransfer, 0 }, { Dma::Event::kTransferComplete, 0 },
+      { Dma::Event::kHalfTransfer, 1 }, { Dma::Event::kTransferComplete, 1 },
+      { Dma::Event::kHalfTransfer, 2 }, { Dma::Event::kTransferComplete, 2 },
+    };
+    CHECK(kExpected == events);
+    CHECK(!channel.IsBusy());
+  }
+}
+}  // namespace sjsu
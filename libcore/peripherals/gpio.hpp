@@ -228,7 +228,6 @@ inline sjsu::Gpio & GetInactive<sjsu::Gpio>()
     void DetachInterrupt() override {}
   };
 
-  static InactiveGpio inactive;
-  return inactive;
+  return inactive_instance<InactiveGpio>;
 }
 }  // namespace sjsu
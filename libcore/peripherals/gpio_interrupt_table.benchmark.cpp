@@ -0,0 +1,45 @@
+#include <libcore/peripherals/gpio_interrupt_table.hpp>
+#include <libcore/testing/benchmark.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+SJ2_BENCHMARK("GpioInterruptTable::Dispatch 1 of 32 pins pending")
+{
+  GpioInterruptTable table;
+  uint32_t count = 0;
+  for (uint8_t pin = 0; pin < GpioInterruptTable::kPins; pin++)
+  {
+    table.Attach(pin, [&count]() { count++; }, Gpio::Edge::kBoth);
+  }
+  uint32_t pending = uint32_t{ 1 } << 30;
+
+  return benchmark::Run(name, [&table, &pending]() {
+    benchmark::DoNotOptimize(pending);
+    benchmark::DoNotOptimize(table.Dispatch(pending));
+  });
+}
+
+SJ2_BENCHMARK("Per-pin dispatch loop 1 of 32 pins pending")
+{
+  std::array<InterruptCallback, GpioInterruptTable::kPins> callbacks;
+  uint32_t count = 0;
+  for (auto & callback : callbacks)
+  {
+    callback = [&count]() { count++; };
+  }
+  uint32_t pending = uint32_t{ 1 } << 30;
+
+  return benchmark::Run(name, [&callbacks, &pending]() {
+    benchmark::DoNotOptimize(pending);
+    for (size_t pin = 0; pin < callbacks.size(); pin++)
+    {
+      if (pending & (uint32_t{ 1 } << pin))
+      {
+        callbacks[pin]();
+      }
+    }
+  });
+}
+}  // namespace sjsu
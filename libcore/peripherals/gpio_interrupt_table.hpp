@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/interrupt.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu
+{
+/// The interrupt callbacks of the pins of a GPIO port that share one
+/// interrupt vector, for platform ports to implement Gpio::AttachInterrupt()
+/// with.
+///
+/// The port's interrupt handler reads its pending register and passes it to
+/// Dispatch(), which visits only the set bits with count-trailing-zeros
+/// rather than checking every pin of the port. A handler with one pending
+/// pin therefore calls its callback after a single scan step, however many
+/// pins share the vector. Callbacks are InterruptCallback, which never
+/// allocate.
+///
+/// The table also keeps a mask of the pins attached for each edge, to write
+/// to the port's edge enable registers.
+///
+/// Attach() and Detach() are not atomic with respect to Dispatch(). Call
+/// them with the port's interrupt disabled, or before it is enabled.
+///
+/// USAGE:
+///
+///    void AttachInterrupt(InterruptCallback callback, Edge edge) override
+///    {
+///      table.Attach(pin, callback, edge);
+///      port->IO0IntEnR = table.Rising();
+///      port->IO0IntEnF = table.Falling();
+///    }
+///
+///    static void PortHandler()
+///    {
+///      const uint32_t kPending = port->IO0IntStatR | port->IO0IntStatF;
+///      port->IO0IntClr         = kPending;
+///      table.Dispatch(kPending);
+///    }
+class GpioInterruptTable
+{
+ public:
+  /// Number of pins of a port, one for each bit of the masks.
+  static constexpr size_t kPins = 32;
+
+  /// Set the callback of a pin and the edges it is attached for.
+  ///
+  /// @param pin - position of the pin in the port.
+  /// @param callback - function to call when the pin is pending.
+  /// @param edge - the edges the pin is attached for.
+  /// @throw sjsu::Exception - std::errc::invalid_argument if `pin` is not
+  ///        below kPins.
+  void Attach(uint8_t pin, InterruptCallback callback, Gpio::Edge edge)
+  {
+    if (pin >= kPins)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "A GPIO port holds at most 32 pins.");
+    }
+
+    const uint32_t kMask = Mask(pin);
+    callbacks_[pin]      = callback;
+    attached_ |= kMask;
+    rising_ &= ~kMask;
+    falling_ &= ~kMask;
+    if (static_cast<uint8_t>(edge) & static_cast<uint8_t>(Gpio::Edge::kRising))
+    {
+      rising_ |= kMask;
+    }
+    if (static_cast<uint8_t>(edge) &
+        static_cast<uint8_t>(Gpio::Edge::kFalling))
+    {
+      falling_ |= kMask;
+    }
+  }
+
+  /// Remove the callback of a pin. Does nothing if `pin` is not attached.
+  ///
+  /// @param pin - position of the pin in the port.
+  void Detach(uint8_t pin)
+  {
+    if (pin >= kPins)
+    {
+      return;
+    }
+
+    const uint32_t kMask = ~Mask(pin);
+    attached_ &= kMask;
+    rising_ &= kMask;
+    falling_ &= kMask;
+    callbacks_[pin] = nullptr;
+  }
+
+  /// Call the callback of every attached pin of `pending`, lowest pin first.
+  /// Pending pins that are not attached are ignored.
+  ///
+  /// @param pending - the port's pending interrupts, a bit for each pin.
+  /// @return size_t - number of callbacks called.
+  size_t Dispatch(uint32_t pending)
+  {
+    pending &= attached_;
+    size_t called = 0;
+    while (pending != 0)
+    {
+      const int kPin = std::countr_zero(pending);
+      // Clear the lowest set bit.
+      pending &= pending - 1;
+      callbacks_[kPin]();
+      called++;
+    }
+    return called;
+  }
+
+  /// @return uint32_t - mask of the attached pins.
+  uint32_t Attached() const
+  {
+    return attached_;
+  }
+
+  /// @return uint32_t - mask of the pins attached for rising edges.
+  uint32_t Rising() const
+  {
+    return rising_;
+  }
+
+  /// @return uint32_t - mask of the pins attached for falling edges.
+  uint32_t Falling() const
+  {
+    return falling_;
+  }
+
+ private:
+  static constexpr uint32_t Mask(uint8_t pin)
+  {
+    return uint32_t{ 1 } << pin;
+  }
+
+  std::array<InterruptCallback, kPins> callbacks_;
+  uint32_t attached_ = 0;
+  uint32_t rising_   = 0;
+  uint32_t falling_  = 0;
+};
+}  // namespace sjsu
@@ -0,0 +1,100 @@
+#include <libcore/peripherals/gpio_interrupt_table.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing GpioInterruptTable")
+{
+  GpioInterruptTable table;
+  std::array<int, GpioInterruptTable::kPins> calls = {};
+  std::array<uint8_t, 4> order                     = {};
+  size_t next                                      = 0;
+
+  auto attach = [&](uint8_t pin, Gpio::Edge edge = Gpio::Edge::kBoth) {
+    table.Attach(
+        pin,
+        [&calls, &order, &next, pin]() {
+          calls[pin]++;
+          if (next < order.size())
+          {
+            order[next++] = pin;
+          }
+        },
+        edge);
+  };
+
+  SECTION("Dispatch() calls each attached pending pin, lowest first")
+  {
+    // Setup
+    attach(31);
+    attach(0);
+    attach(17);
+    attach(5);
+
+    // Exercise
+    const size_t kCalled = table.Dispatch(0x8002'0021);
+
+    // Verify
+    CHECK(4 == kCalled);
+    CHECK(std::array<uint8_t, 4>{ 0, 5, 17, 31 } == order);
+  }
+
+  SECTION("Dispatch() ignores pins that are not pending or not attached")
+  {
+    // Setup
+    attach(3);
+    attach(9);
+
+    // Exercise
+    const size_t kCalled = table.Dispatch(0b1100'0000'1000);
+
+    // Verify
+    CHECK(1 == kCalled);
+    CHECK(1 == calls[3]);
+    CHECK(0 == calls[9]);
+    CHECK(0 == table.Dispatch(0));
+  }
+
+  SECTION("Attach() keeps a mask of the pins of each edge")
+  {
+    // Exercise
+    attach(1, Gpio::Edge::kRising);
+    attach(2, Gpio::Edge::kFalling);
+    attach(4, Gpio::Edge::kBoth);
+    attach(1, Gpio::Edge::kFalling);
+
+    // Verify
+    CHECK(0b10110 == table.Attached());
+    CHECK(0b10000 == table.Rising());
+    CHECK(0b10110 == table.Falling());
+  }
+
+  SECTION("Detach() stops dispatching to the pin")
+  {
+    // Setup
+    attach(7);
+    attach(8);
+
+    // Exercise
+    table.Detach(7);
+    table.Dispatch(0x180);
+
+    // Verify
+    CHECK(0 == calls[7]);
+    CHECK(1 == calls[8]);
+    CHECK(0x100 == table.Attached());
+    CHECK(0x100 == table.Rising());
+    CHECK(0x100 == table.Falling());
+  }
+
+  SECTION("Attach() rejects pins beyond the port")
+  {
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(attach(32), std::errc::invalid_argument);
+  }
+}
+}  // namespace sjsu
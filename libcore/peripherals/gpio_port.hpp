@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+
+#include <libcore/module.hpp>
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/inactive.hpp>
+
+namespace sjsu
+{
+/// An abstract interface for a port of up to 32 GPIO pins that are accessed
+/// together, with a bit of each mask for each pin of the port, so that many
+/// pins are set, cleared or read in a single register access rather than a
+/// virtual call per pin.
+///
+/// @ingroup l1_peripheral
+class GpioPort : public Module<>
+{
+ public:
+  /// Set the direction of the pins of `mask`.
+  ///
+  /// @param mask - the pins to change.
+  /// @param direction - the direction to set the pins to.
+  virtual void SetDirection(uint32_t mask, Gpio::Direction direction) = 0;
+
+  /// Set the pins of `mask` HIGH.
+  ///
+  /// @param mask - the pins to set.
+  virtual void Set(uint32_t mask) = 0;
+
+  /// Set the pins of `mask` LOW.
+  ///
+  /// @param mask - the pins to clear.
+  virtual void Clear(uint32_t mask) = 0;
+
+  /// @return uint32_t - the state of every pin of the port.
+  virtual uint32_t Read() = 0;
+
+  /// Set the pins of `mask` to the matching bits of `value`, leaving the
+  /// other pins unchanged.
+  ///
+  /// The default implementation calls Set() then Clear(). Ports with a
+  /// register that sets and clears pins at once, such as the STM32 BSRR,
+  /// should override this to change every pin in the same access.
+  ///
+  /// @param mask - the pins to change.
+  /// @param value - the new states of the pins.
+  virtual void Write(uint32_t mask, uint32_t value)
+  {
+    Set(value & mask);
+    Clear(~value & mask);
+  }
+
+  // ===========================================================================
+  // Helper Functions
+  // ===========================================================================
+
+  /// Toggle the pins of `mask`.
+  ///
+  /// @param mask - the pins to toggle.
+  void Toggle(uint32_t mask)
+  {
+    Write(mask, ~Read());
+  }
+};
+
+/// Template specialization that generates an inactive sjsu::GpioPort.
+template <>
+inline sjsu::GpioPort & GetInactive<sjsu::GpioPort>()
+{
+  class InactiveGpioPort : public sjsu::GpioPort
+  {
+   public:
+    void ModuleInitialize() override {}
+    void SetDirection(uint32_t, Gpio::Direction) override {}
+    void Set(uint32_t) override {}
+    void Clear(uint32_t) override {}
+    uint32_t Read() override
+    {
+      return 0;
+    }
+  };
+
+  return inactive_instance<InactiveGpioPort>;
+}
+}  // namespace sjsu
@@ -0,0 +1,63 @@
+#include <libcore/peripherals/gpio_port.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Uses the default implementation of Write() and records what it does.
+class RecordingGpioPort : public GpioPort
+{
+ public:
+  void ModuleInitialize() override {}
+  void SetDirection(uint32_t, Gpio::Direction) override {}
+
+  void Set(uint32_t mask) override
+  {
+    set = mask;
+  }
+
+  void Clear(uint32_t mask) override
+  {
+    cleared = mask;
+  }
+
+  uint32_t Read() override
+  {
+    return input;
+  }
+
+  uint32_t set     = 0;
+  uint32_t cleared = 0;
+  uint32_t input   = 0;
+};
+}  // namespace
+
+TEST_CASE("Testing GpioPort Interface")
+{
+  RecordingGpioPort test_subject;
+
+  SECTION("Write() sets and clears the pins of the mask")
+  {
+    // Exercise
+    test_subject.Write(0x0000'00FF, 0x1234'56A5);
+
+    // Verify
+    CHECK(0x0000'00A5 == test_subject.set);
+    CHECK(0x0000'005A == test_subject.cleared);
+  }
+
+  SECTION("Toggle() inverts the pins of the mask")
+  {
+    // Setup
+    test_subject.input = 0b1010;
+
+    // Exercise
+    test_subject.Toggle(0b0110);
+
+    // Verify
+    CHECK(0b0100 == test_subject.set);
+    CHECK(0b0010 == test_subject.cleared);
+  }
+}
+}  // namespace sjsu
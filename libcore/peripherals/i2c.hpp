@@ -1,11 +1,19 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
 #include <initializer_list>
 #include <libcore/module.hpp>
 #include <libcore/peripherals/inactive.hpp>
+#include <libcore/peripherals/system_controller.hpp>
+#include <libcore/platform/constants.hpp>
+#include <libcore/utility/enum.hpp>
 #include <libcore/utility/error_handling.hpp>
 #include <libcore/utility/math/units.hpp>
+#include <libcore/utility/result.hpp>
+#include <libcore/utility/time/time.hpp>
 #include <span>
 
 namespace sjsu
@@ -13,10 +21,64 @@ namespace sjsu
 /// Generic settings for a standard I2C peripheral
 struct I2cSettings_t : public MemoryEqualOperator_t<I2cSettings_t>
 {
+  /// Speed modes of the I2C bus, each named after the fastest frequency it
+  /// allows.
+  enum class Mode : uint8_t
+  {
+    /// Standard mode, up to 100kHz.
+    kStandard,
+    /// Fast mode, up to 400kHz.
+    kFast,
+    /// Fast mode plus, up to 1MHz. The pins must be able to sink 20mA, which
+    /// on many controllers is a separate drive strength setting that drivers
+    /// enable for this mode.
+    kFastPlus,
+    /// High speed mode, up to 3.4MHz. Each transfer starts with
+    /// I2c::kHighSpeedMasterCode sent in fast mode, after which the bus
+    /// switches to high speed until the next stop condition.
+    kHighSpeed,
+  };
+
   /// Operating frequency
   units::frequency::hertz_t frequency = 100'000_Hz;
   /// Clock duty cycle
   float duty_cycle = 0.5;
+  /// Total capacitance of each bus line, the devices' pins and the traces.
+  /// Along with `pull_up`, sets how long the lines take to rise, which limits
+  /// how fast the bus can run.
+  units::capacitance::picofarad_t bus_capacitance = 100_pF;
+  /// Resistance of the pull up resistor on each bus line.
+  units::impedance::ohm_t pull_up = 2'200_Ohm;
+
+  /// @return Mode - the slowest mode that allows `frequency`. Frequencies
+  ///         above 3.4MHz are reported as Mode::kHighSpeed.
+  Mode GetMode() const
+  {
+    if (frequency <= 100_kHz)
+    {
+      return Mode::kStandard;
+    }
+    if (frequency <= 400_kHz)
+    {
+      return Mode::kFast;
+    }
+    if (frequency <= 1_MHz)
+    {
+      return Mode::kFastPlus;
+    }
+    return Mode::kHighSpeed;
+  }
+
+  /// @return std::chrono::nanoseconds - estimated time for a bus line to rise
+  ///         from 30% to 70% of the supply once released, 0.8473 RC.
+  std::chrono::nanoseconds RiseTime() const
+  {
+    const float kSeconds = 0.8473f * pull_up.to<float>() *
+                           units::capacitance::farad_t(bus_capacitance)
+                               .to<float>();
+    return std::chrono::nanoseconds(
+        static_cast<int64_t>(std::ceil(kSeconds * 1e9f)));
+  }
 };
 
 /// An abstract interface for hardware that implements the Inter-integrated
@@ -41,6 +103,27 @@ class I2c : public Module<I2cSettings_t>
   /// time.
   static constexpr std::chrono::milliseconds kI2cTimeout = 100ms;
 
+  /// First byte of every high speed mode transfer, sent in fast mode and
+  /// never acknowledged. The lower 3 bits tell apart the controllers of a
+  /// multi-controller bus.
+  static constexpr uint8_t kHighSpeedMasterCode = 0b0000'1000;
+
+  /// Number of peripheral clock cycles for each half of the SCL clock, as
+  /// calculated by CalculateClockTiming().
+  struct ClockTiming_t
+  {
+    /// Cycles SCL is held LOW, including its fall.
+    uint32_t low_cycles;
+    /// Cycles SCL is HIGH, counted from when it is seen HIGH, which is how
+    /// most controllers let slow rising lines and clock stretching lengthen
+    /// the clock.
+    uint32_t high_cycles;
+    /// Estimated rise time of the bus lines, see I2cSettings_t::RiseTime().
+    std::chrono::nanoseconds rise_time;
+    /// Resulting SCL frequency, including the rise time.
+    units::frequency::hertz_t frequency;
+  };
+
   /// Namespace of common I2C transaction errors
   class CommonErrors
   {
@@ -91,6 +174,28 @@ class I2c : public Module<I2cSettings_t>
       return address_8bit;
     }
 
+    /// @return size_t - total number of bytes in the write phase, including
+    ///         both `data_out` and `data_out_tail`.
+    constexpr size_t TotalOutLength() const
+    {
+      return out_length + out_tail_length;
+    }
+
+    /// Get a byte of the write phase as if `data_out` and `data_out_tail` were
+    /// one contiguous buffer.
+    ///
+    /// @param index - position within the write phase. Must be less than
+    ///        TotalOutLength().
+    /// @return uint8_t - the byte to write at that position.
+    constexpr uint8_t GetOutByte(size_t index) const
+    {
+      if (index < out_length)
+      {
+        return data_out[index];
+      }
+      return data_out_tail[index - out_length];
+    }
+
     /// Defines the starting operation of this transaction. The use of the word
     /// "starting", refers to the fact that, the operation can change from Read
     /// -> Write if a WriteThenRead() function was called on this structure. In
@@ -109,13 +214,26 @@ class I2c : public Module<I2cSettings_t>
     /// The number of bytes to write to the device.
     size_t out_length = 0;
 
+    /// Optional pointer to a second buffer of bytes to write to the device
+    /// immediately after `data_out`, within the same write phase, as set by
+    /// WriteGather(). Every driver must send it, which they can do by using
+    /// GetOutByte() and TotalOutLength() in place of `data_out` and
+    /// `out_length`.
+    const uint8_t * data_out_tail = nullptr;
+
+    /// The number of bytes in `data_out_tail` to write to the device.
+    size_t out_tail_length = 0;
+
     /// Pointer to a buffer to store retrieved bytes into.
     uint8_t * data_in = nullptr;
 
     /// The number of bytes to read from the device.
     size_t in_length = 0;
 
-    /// The current position in the out or in buffer.
+    /// The current position in the out or in buffer. Interrupt or DMA driven
+    /// implementations advance this as bytes move across the bus, so it can be
+    /// read while `busy` is true to monitor progress. Once the transaction has
+    /// completed it holds the number of bytes transferred in the final phase.
     size_t position = 0;
 
     /// This flag determins if a "repeat start" condition should be emitted on
@@ -126,7 +244,10 @@ class I2c : public Module<I2cSettings_t>
 
     /// This flag indicates to the driver whether or not the I2C transaction is
     /// still occuring. Use this to break out of a while loop if your I2C
-    /// implementation is interrupt based.
+    /// implementation is interrupt based. When a transaction is part of a batch
+    /// passed to Transactions(), the driver clears this flag on the caller's
+    /// copy once that transaction has finished, so the caller can observe each
+    /// transaction of the batch completing.
     bool busy = false;
 
     /// How long should the calling code wait before timing out and moving on
@@ -146,10 +267,346 @@ class I2c : public Module<I2cSettings_t>
   /// the circumstances of the error that occurred during the transaction.
   virtual void Transaction(Transaction_t transaction) = 0;
 
+  /// Perform a batch of I2C transactions back-to-back.
+  ///
+  /// Implementations with interrupt or DMA support should override this method
+  /// to chain the transactions with repeated start conditions and only
+  /// interrupt the CPU once the whole batch has completed. Unlike
+  /// Transaction(), this method does not throw. A failure in one transaction is
+  /// written into that transaction's `status` field and the remaining
+  /// transactions are still attempted, allowing a sweep across many devices to
+  /// continue past one unresponsive device.
+  ///
+  /// The default implementation calls Transaction() for each element in order.
+  ///
+  /// @param transactions - list of transactions to perform. On return, each
+  ///        element's `status` holds the result of that transaction and `busy`
+  ///        is false.
+  /// @return size_t - the number of transactions that completed successfully.
+  virtual size_t Transactions(std::span<Transaction_t> transactions)
+  {
+    size_t successful = 0;
+
+    for (auto & transaction : transactions)
+    {
+      if (TryTransaction(transaction) == static_cast<std::errc>(0))
+      {
+        successful++;
+      }
+    }
+
+    return successful;
+  }
+
+  /// Start an I2C transaction and return without waiting for it to finish.
+  ///
+  /// Interrupt or DMA driven implementations should override this method. The
+  /// driver keeps a reference to `transaction` and, from interrupt context,
+  /// advances `position`, writes the result to `status` and finally clears
+  /// `busy`. Errors must be reported through `status`, never thrown. The
+  /// transaction object must therefore stay alive until `busy` is false,
+  /// which is what AsyncTransaction guarantees. In turn, the driver must
+  /// always clear `busy` eventually, reporting std::errc::timed_out through
+  /// `status` if the transaction does not finish within its `timeout`.
+  ///
+  /// The default implementation performs the transaction synchronously using
+  /// TryTransaction(), so `busy` is already false when this returns.
+  ///
+  /// @param transaction - transaction to start. `busy` is set to true before
+  ///        any bytes are transferred.
+  virtual void TransactionAsync(Transaction_t & transaction)
+  {
+    TryTransaction(transaction);
+  }
+
+  /// Write `header` followed by `payload` to a device as one continuous
+  /// write, such as a register address followed by the register's contents.
+  ///
+  /// The default implementation performs a single write transaction with
+  /// `header` as its `data_out` and `payload` as its `data_out_tail`, so
+  /// neither buffer is copied and their size is not limited. Drivers that
+  /// have a faster way to send two buffers back to back, such as a
+  /// scatter/gather DMA, can override it.
+  ///
+  /// @param address - device address
+  /// @param header - bytes to send first, such as a register address
+  /// @param payload - bytes to send immediately after the header
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  /// @throw sjsu::Exception - any error of Transaction().
+  virtual void WriteGather(uint8_t address,
+                           std::span<const uint8_t> header,
+                           std::span<const uint8_t> payload,
+                           std::chrono::milliseconds timeout)
+  {
+    TracedTransaction({
+        .operation       = Operation::kWrite,
+        .address         = address,
+        .data_out        = header.data(),
+        .out_length      = header.size(),
+        .data_out_tail   = payload.data(),
+        .out_tail_length = payload.size(),
+        .busy            = true,
+        .timeout         = timeout,
+    });
+  }
+
+  /// Completion handle for a transaction started by one of the *Async()
+  /// helpers, such as ReadAsync().
+  ///
+  /// The handle owns the Transaction_t that the driver is working on, which is
+  /// why it can neither be copied nor moved. The *Async() helpers rely on
+  /// guaranteed copy elision to construct it directly in the caller's storage:
+  ///
+  ///    auto handle = i2c.WriteThenReadAsync(address, register, buffer);
+  ///    // ... do other work ...
+  ///    std::errc status = handle.Wait();
+  ///
+  /// If the handle is destroyed while the transaction is still in progress,
+  /// the destructor blocks until the driver clears `busy`, with no timeout,
+  /// so the driver never writes into freed memory. Use Wait() beforehand to
+  /// bound how long the caller waits for the result.
+  class AsyncTransaction
+  {
+   public:
+    /// Start the transaction on the i2c bus.
+    ///
+    /// @param i2c - the bus to perform the transaction on.
+    /// @param transaction - the transaction to perform.
+    AsyncTransaction(I2c & i2c, const Transaction_t & transaction)
+        : transaction_(transaction)
+    {
+      i2c.TransactionAsync(transaction_);
+    }
+
+    AsyncTransaction(const AsyncTransaction &) = delete;
+    AsyncTransaction & operator=(const AsyncTransaction &) = delete;
+
+    ~AsyncTransaction()
+    {
+      sjsu::Wait(std::chrono::nanoseconds::max(), [this] { return !IsBusy(); });
+    }
+
+    /// @return true - if the transaction is still in progress.
+    bool IsBusy() const
+    {
+      // The busy flag is cleared from interrupt context, so it must be
+      // re-read from memory on every call.
+      return *static_cast<const volatile bool *>(&transaction_.busy);
+    }
+
+    /// @return std::errc - result of the transaction. Only meaningful once
+    ///         IsBusy() returns false.
+    std::errc Status() const
+    {
+      return transaction_.status;
+    }
+
+    /// @return size_t - number of bytes transferred so far in the current
+    ///         phase of the transaction.
+    size_t Position() const
+    {
+      return *static_cast<const volatile size_t *>(&transaction_.position);
+    }
+
+    /// Block until the transaction completes.
+    ///
+    /// @param timeout - the maximum amount of time to wait. Defaults to the
+    ///        timeout of the transaction itself.
+    /// @return std::errc - the status of the transaction, or
+    ///         std::errc::timed_out if it did not finish in time.
+    std::errc Wait(std::chrono::nanoseconds timeout)
+    {
+      if (IsBusy() && !sjsu::Wait(timeout, [this] { return !IsBusy(); }))
+      {
+        return std::errc::timed_out;
+      }
+      return Status();
+    }
+
+    /// Block until the transaction completes or its own timeout elapses.
+    ///
+    /// @return std::errc - see Wait(std::chrono::nanoseconds).
+    std::errc Wait()
+    {
+      return Wait(transaction_.timeout);
+    }
+
+    /// Block until the transaction completes and throw the corresponding
+    /// I2c::CommonErrors exception if it failed. This is how errors that
+    /// occurred in interrupt context are rethrown in the caller's context.
+    ///
+    /// @throw sjsu::Exception - with a std::errc matching the failure.
+    void WaitOrThrow()
+    {
+      ThrowIfError(Wait());
+    }
+
+   private:
+    Transaction_t transaction_;
+  };
+
+  /// @return I2cSettings_t::Mode - fastest mode this controller supports.
+  ///         Drivers throw std::errc::invalid_argument from ModuleInitialize()
+  ///         for frequencies beyond it, and override this if they support fast
+  ///         mode plus or high speed mode.
+  virtual I2cSettings_t::Mode MaximumMode() const
+  {
+    return I2cSettings_t::Mode::kFast;
+  }
+
   // ===========================================================================
   // Helper Functions
   // ===========================================================================
 
+  /// Calculate how many peripheral clock cycles each half of the SCL clock
+  /// should last for the settings, meeting the minimum LOW and HIGH times of
+  /// the settings' mode from the I2C specification. The time the lines take
+  /// to rise is taken out of the clock period, so the bus runs at the
+  /// requested frequency rather than slower by the rise time. Drivers call
+  /// this in ModuleInitialize() to program their clock registers.
+  ///
+  /// Where the minimum times and rise time do not fit in the period, the
+  /// minimum times are used and the bus runs slower than requested.
+  ///
+  /// @param peripheral_clock - frequency of the clock the controller counts.
+  /// @param settings - settings of the bus.
+  /// @return ClockTiming_t - the length of each half of the SCL clock.
+  /// @throw std::errc::invalid_argument - if the frequency is above 3.4MHz or
+  ///        the lines rise slower than the settings' mode allows. The rise
+  ///        time is reduced with a smaller pull up resistor.
+  static ClockTiming_t CalculateClockTiming(
+      units::frequency::hertz_t peripheral_clock,
+      const I2cSettings_t & settings)
+  {
+    struct ModeLimits_t
+    {
+      float minimum_low;
+      float minimum_high;
+      std::chrono::nanoseconds maximum_rise;
+    };
+
+    // Nanoseconds, from table 10 and table 12 of the I2C specification,
+    // UM10204. The high speed rise time is its limit for a 400pF bus.
+    constexpr std::array<ModeLimits_t, 4> kLimits = { {
+        { .minimum_low = 4700, .minimum_high = 4000, .maximum_rise = 1000ns },
+        { .minimum_low = 1300, .minimum_high = 600, .maximum_rise = 300ns },
+        { .minimum_low = 500, .minimum_high = 260, .maximum_rise = 120ns },
+        { .minimum_low = 160, .minimum_high = 60, .maximum_rise = 80ns },
+    } };
+
+    if (settings.frequency > 3.4_MHz)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "I2C frequency is above the 3.4MHz of high speed mode.");
+    }
+
+    const auto & kMode = kLimits[Value(settings.GetMode())];
+    const auto kRise   = settings.RiseTime();
+    if (kRise > kMode.maximum_rise)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "I2C lines rise too slowly for the frequency. Use a "
+                      "smaller pull up resistor or a lower frequency.");
+    }
+
+    const float kRiseNs  = static_cast<float>(kRise.count());
+    const float kCounted = 1e9f / settings.frequency.to<float>() - kRiseNs;
+    const float kDuty    = std::clamp(settings.duty_cycle, 0.0f, 1.0f);
+    float high           = kCounted * kDuty;
+    float low            = kCounted - high;
+    if (low < kMode.minimum_low)
+    {
+      low  = kMode.minimum_low;
+      high = kCounted - low;
+    }
+    if (high < kMode.minimum_high)
+    {
+      high = kMode.minimum_high;
+      low  = std::max(kCounted - high, kMode.minimum_low);
+    }
+
+    const float kCyclesPerNs = peripheral_clock.to<float>() / 1e9f;
+    const auto kLowCycles =
+        static_cast<uint32_t>(std::ceil(low * kCyclesPerNs));
+    const auto kHighCycles =
+        static_cast<uint32_t>(std::ceil(high * kCyclesPerNs));
+    const float kPeriodNs =
+        static_cast<float>(kLowCycles + kHighCycles) / kCyclesPerNs + kRiseNs;
+
+    return ClockTiming_t{
+      .low_cycles  = kLowCycles,
+      .high_cycles = kHighCycles,
+      .rise_time   = kRise,
+      .frequency   = units::frequency::hertz_t(1e9f / kPeriodNs),
+    };
+  }
+
+  /// Calculate the SCL timing from the rate of a clock of the platform's
+  /// SystemController, see CalculateClockTiming(hertz_t, const I2cSettings_t&).
+  ///
+  /// @param peripheral - resource ID of the controller's clock.
+  /// @param settings - settings of the bus.
+  /// @return ClockTiming_t - the length of each half of the SCL clock.
+  static ClockTiming_t CalculateClockTiming(ResourceID peripheral,
+                                            const I2cSettings_t & settings)
+  {
+    return CalculateClockTiming(
+        SystemController::GetPlatformController().GetClockRate(peripheral),
+        settings);
+  }
+
+  /// Convert a transaction status into its matching I2c::CommonErrors
+  /// exception and throw it. Does nothing if the status indicates success.
+  ///
+  /// @param status - status of a completed transaction.
+  /// @throw sjsu::Exception - with the error code in status.
+  static void ThrowIfError(std::errc status)
+  {
+    if (status == static_cast<std::errc>(0))
+    {
+      return;
+    }
+
+    switch (status)
+    {
+      case std::errc::timed_out: throw CommonErrors::kTimeout;
+      case std::errc::io_error: throw CommonErrors::kBusError;
+      case std::errc::no_such_device_or_address:
+        throw CommonErrors::kDeviceNotFound;
+      default: throw Exception(status, "I2C transaction failed.");
+    }
+  }
+
+  /// Perform a transaction using Transaction() and record any thrown error in
+  /// the transaction's `status` field rather than propagating it.
+  ///
+  /// This is the non-throwing counterpart of Transaction() that Transactions(),
+  /// TransactionAsync() and the Try*() helpers are built on. Drivers for builds
+  /// without exceptions should override it to report errors through `status`
+  /// directly.
+  ///
+  /// @param transaction - transaction to perform. `busy` is set while the
+  ///        transaction is running and cleared afterwards.
+  /// @return std::errc - the final status of the transaction.
+  virtual std::errc TryTransaction(Transaction_t & transaction)
+  {
+    transaction.busy = true;
+
+    try
+    {
+      TracedTransaction(transaction);
+      transaction.status = static_cast<std::errc>(0);
+    }
+    catch (const sjsu::Exception & e)
+    {
+      transaction.status = e.GetCode();
+    }
+
+    transaction.busy = false;
+    return transaction.status;
+  }
+
   /// Read from a device on the I2C bus
   ///
   /// @param address - device address
@@ -163,7 +620,7 @@ class I2c : public Module<I2cSettings_t>
             size_t receive_buffer_length,
             std::chrono::milliseconds timeout = kI2cTimeout)
   {
-    return Transaction({
+    return TracedTransaction({
         .operation  = Operation::kRead,
         .address    = address,
         .data_out   = nullptr,
@@ -203,7 +660,7 @@ class I2c : public Module<I2cSettings_t>
              size_t transmit_buffer_length,
              std::chrono::milliseconds timeout = kI2cTimeout)
   {
-    return Transaction({
+    return TracedTransaction({
         .operation  = Operation::kWrite,
         .address    = address,
         .data_out   = transmit_buffer,
@@ -252,6 +709,28 @@ class I2c : public Module<I2cSettings_t>
     return Write(address, transmit.data(), transmit.size(), timeout);
   }
 
+  /// Write two separate buffers to a device on the I2C bus as one continuous
+  /// write, see WriteGather(). This is most commonly used to write a register
+  /// address followed by the register's contents.
+  ///
+  /// Usage:
+  ///
+  ///     const std::array<uint8_t, 1> kRegister = { 0x10 };
+  ///     i2c.Write(0x29, kRegister, large_payload);
+  ///
+  /// @param address - device address
+  /// @param header - bytes to send first, such as a register address
+  /// @param payload - bytes to send immediately after the header
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  void Write(uint8_t address,
+             std::span<const uint8_t> header,
+             std::span<const uint8_t> payload,
+             std::chrono::milliseconds timeout = kI2cTimeout)
+  {
+    WriteGather(address, header, payload, timeout);
+  }
+
   /// Write to a device on the I2C bus, then read from that device.
   ///
   /// This is very common for most I2C devices, where the microcontroller must
@@ -274,7 +753,7 @@ class I2c : public Module<I2cSettings_t>
                      size_t receive_buffer_length,
                      std::chrono::milliseconds timeout = kI2cTimeout)
   {
-    return Transaction({
+    return TracedTransaction({
         .operation  = Operation::kWrite,
         .address    = address,
         .data_out   = transmit_buffer,
@@ -339,6 +818,206 @@ class I2c : public Module<I2cSettings_t>
                          receive.size(),
                          timeout);
   }
+
+  /// Read from a device on the I2C bus without throwing. See Read().
+  ///
+  /// @param address - device address
+  /// @param receive - byte span to read information into
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  /// @param location - location recorded in the error if the read fails.
+  /// @return Result<void> - the error code of the failure, such as
+  ///         std::errc::no_such_device_or_address.
+  Result<void> TryRead(uint8_t address,
+                       std::span<uint8_t> receive,
+                       std::chrono::milliseconds timeout = kI2cTimeout,
+                       const std::experimental::source_location & location =
+                           std::experimental::source_location::current())
+  {
+    Transaction_t transaction = {
+      .operation = Operation::kRead,
+      .address   = address,
+      .data_in   = receive.data(),
+      .in_length = receive.size(),
+      .busy      = true,
+      .timeout   = timeout,
+    };
+    return ToResult(TryTransaction(transaction), location);
+  }
+
+  /// Write to a device on the I2C bus without throwing. See Write().
+  ///
+  /// @param address - device address
+  /// @param transmit - bytes to send to device
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  /// @param location - location recorded in the error if the write fails.
+  /// @return Result<void> - the error code of the failure.
+  Result<void> TryWrite(uint8_t address,
+                        std::span<const uint8_t> transmit,
+                        std::chrono::milliseconds timeout = kI2cTimeout,
+                        const std::experimental::source_location & location =
+                            std::experimental::source_location::current())
+  {
+    Transaction_t transaction = {
+      .operation  = Operation::kWrite,
+      .address    = address,
+      .data_out   = transmit.data(),
+      .out_length = transmit.size(),
+      .busy       = true,
+      .timeout    = timeout,
+    };
+    return ToResult(TryTransaction(transaction), location);
+  }
+
+  /// Write two separate buffers to a device on the I2C bus as one continuous
+  /// write without throwing. See Write(uint8_t, std::span<const uint8_t>,
+  /// std::span<const uint8_t>, std::chrono::milliseconds).
+  ///
+  /// @param address - device address
+  /// @param header - bytes to send first, such as a register address
+  /// @param payload - bytes to send immediately after the header
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  /// @param location - location recorded in the error if the write fails.
+  /// @return Result<void> - the error code of the failure.
+  Result<void> TryWrite(uint8_t address,
+                        std::span<const uint8_t> header,
+                        std::span<const uint8_t> payload,
+                        std::chrono::milliseconds timeout = kI2cTimeout,
+                        const std::experimental::source_location & location =
+                            std::experimental::source_location::current())
+  {
+    try
+    {
+      WriteGather(address, header, payload, timeout);
+    }
+    catch (const sjsu::Exception & e)
+    {
+      return ToResult(e.GetCode(), location);
+    }
+    return {};
+  }
+
+  /// Write to a device on the I2C bus, then read from that device, without
+  /// throwing. See WriteThenRead().
+  ///
+  /// @param address - device address
+  /// @param transmit - span referencing bytes to transmit to device
+  /// @param receive - span to byte buffer to received data from device
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  /// @param location - location recorded in the error if the transaction
+  ///        fails.
+  /// @return Result<void> - the error code of the failure.
+  Result<void> TryWriteThenRead(
+      uint8_t address,
+      std::span<const uint8_t> transmit,
+      std::span<uint8_t> receive,
+      std::chrono::milliseconds timeout = kI2cTimeout,
+      const std::experimental::source_location & location =
+          std::experimental::source_location::current())
+  {
+    Transaction_t transaction = {
+      .operation  = Operation::kWrite,
+      .address    = address,
+      .data_out   = transmit.data(),
+      .out_length = transmit.size(),
+      .data_in    = receive.data(),
+      .in_length  = receive.size(),
+      .repeated   = true,
+      .busy       = true,
+      .timeout    = timeout,
+    };
+    return ToResult(TryTransaction(transaction), location);
+  }
+
+  /// Start reading from a device on the I2C bus without waiting for it to
+  /// complete.
+  ///
+  /// @param address - device address
+  /// @param receive - byte span to read information into. Must remain valid
+  ///        until the returned handle reports that the transaction is done.
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  /// @return AsyncTransaction - handle used to poll or wait for the result.
+  AsyncTransaction ReadAsync(uint8_t address,
+                             std::span<uint8_t> receive,
+                             std::chrono::milliseconds timeout = kI2cTimeout)
+  {
+    return AsyncTransaction(*this,
+                            {
+                                .operation = Operation::kRead,
+                                .address   = address,
+                                .data_in   = receive.data(),
+                                .in_length = receive.size(),
+                                .busy      = true,
+                                .timeout   = timeout,
+                            });
+  }
+
+  /// Start writing to a device on the I2C bus without waiting for it to
+  /// complete.
+  ///
+  /// @param address - device address
+  /// @param transmit - bytes to send to device. Must remain valid until the
+  ///        returned handle reports that the transaction is done.
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  /// @return AsyncTransaction - handle used to poll or wait for the result.
+  AsyncTransaction WriteAsync(uint8_t address,
+                              std::span<const uint8_t> transmit,
+                              std::chrono::milliseconds timeout = kI2cTimeout)
+  {
+    return AsyncTransaction(*this,
+                            {
+                                .operation  = Operation::kWrite,
+                                .address    = address,
+                                .data_out   = transmit.data(),
+                                .out_length = transmit.size(),
+                                .busy       = true,
+                                .timeout    = timeout,
+                            });
+  }
+
+  /// Start a write then read transaction with a device on the I2C bus without
+  /// waiting for it to complete.
+  ///
+  /// @param address - device address
+  /// @param transmit - bytes to send to device. Must remain valid until the
+  ///        returned handle reports that the transaction is done.
+  /// @param receive - byte span to read information into. Must remain valid
+  ///        until the returned handle reports that the transaction is done.
+  /// @param timeout - Amount of time to wait for a response by device before
+  ///        bailing out.
+  /// @return AsyncTransaction - handle used to poll or wait for the result.
+  AsyncTransaction WriteThenReadAsync(
+      uint8_t address,
+      std::span<const uint8_t> transmit,
+      std::span<uint8_t> receive,
+      std::chrono::milliseconds timeout = kI2cTimeout)
+  {
+    return AsyncTransaction(*this,
+                            {
+                                .operation  = Operation::kWrite,
+                                .address    = address,
+                                .data_out   = transmit.data(),
+                                .out_length = transmit.size(),
+                                .data_in    = receive.data(),
+                                .in_length  = receive.size(),
+                                .repeated   = true,
+                                .busy       = true,
+                                .timeout    = timeout,
+                            });
+  }
+
+ private:
+  /// Call Transaction(), recorded as a span when SJ2_EVENT_TRACING is 1.
+  void TracedTransaction(Transaction_t transaction)
+  {
+    SJ2_TRACE_SCOPE("I2c::Transaction", transaction.address);
+    Transaction(transaction);
+  }
 };
 
 /// Template specialization that generates an inactive sjsu::I2c.
@@ -352,7 +1031,6 @@ inline sjsu::I2c & GetInactive<sjsu::I2c>()
     void Transaction(Transaction_t) override {}
   };
 
-  static InactiveI2c inactive;
-  return inactive;
+  return inactive_instance<InactiveI2c>;
 }
 }  // namespace sjsu
@@ -1,6 +1,10 @@
 #include <libcore/testing/testing_frameworks.hpp>
 #include <libcore/peripherals/i2c.hpp>
 
+#include <array>
+#include <string_view>
+#include <vector>
+
 namespace sjsu
 {
 TEST_CASE("Testing L1 i2c")
@@ -11,9 +15,23 @@ TEST_CASE("Testing L1 i2c")
   Mock<I2c> mock_i2c;
   sjsu::I2c::Transaction_t actual_transaction;
 
+  std::vector<uint8_t> written;
+
   When(Method(mock_i2c, Transaction))
-      .AlwaysDo([&actual_transaction](I2c::Transaction_t transaction) {
+      .AlwaysDo([&](I2c::Transaction_t transaction) {
         actual_transaction = transaction;
+        written.clear();
+        for (size_t i = 0; i < transaction.TotalOutLength(); i++)
+        {
+          written.push_back(transaction.GetOutByte(i));
+        }
+      });
+  When(Method(mock_i2c, WriteGather))
+      .AlwaysDo([&mock_i2c](uint8_t address,
+                            std::span<const uint8_t> header,
+                            std::span<const uint8_t> payload,
+                            std::chrono::milliseconds timeout) {
+        mock_i2c.get().I2c::WriteGather(address, header, payload, timeout);
       });
 
   I2c & test_subject = mock_i2c.get();
@@ -70,6 +88,38 @@ TEST_CASE("Testing L1 i2c")
     CHECK(actual_transaction.timeout == I2c::kI2cTimeout);
   }
 
+  SECTION("Gather Write Setup")
+  {
+    const std::array<uint8_t, 2> kHeader  = { 0x10, 0x20 };
+    const std::array<uint8_t, 3> kPayload = { 0xAA, 0xBB, 0xCC };
+
+    test_subject.Write(kAddress, kHeader, kPayload);
+
+    Verify(Method(mock_i2c, Transaction)).Once();
+    CHECK(actual_transaction.address == kAddress);
+    CHECK(actual_transaction.data_out == kHeader.data());
+    CHECK(actual_transaction.out_length == kHeader.size());
+    CHECK(actual_transaction.data_out_tail == kPayload.data());
+    CHECK(actual_transaction.out_tail_length == kPayload.size());
+    CHECK(actual_transaction.data_in == nullptr);
+    CHECK(actual_transaction.repeated == false);
+    CHECK(actual_transaction.operation == I2c::Operation::kWrite);
+    CHECK(actual_transaction.timeout == I2c::kI2cTimeout);
+    CHECK(written == std::vector<uint8_t>{ 0x10, 0x20, 0xAA, 0xBB, 0xCC });
+  }
+
+  SECTION("Gather writes of any length are sent in one transaction")
+  {
+    const std::array<uint8_t, 1> kHeader = { 0x10 };
+    const std::array<uint8_t, 1024> kPayload{};
+
+    CHECK(test_subject.TryWrite(kAddress, kHeader, kPayload));
+
+    Verify(Method(mock_i2c, Transaction)).Once();
+    CHECK(actual_transaction.data_out_tail == kPayload.data());
+    CHECK(written.size() == kHeader.size() + kPayload.size());
+  }
+
   SECTION("Write and Read Setup")
   {
     uint8_t read_buffer[10];
@@ -91,4 +141,311 @@ TEST_CASE("Testing L1 i2c")
     CHECK(actual_transaction.timeout == I2c::kI2cTimeout);
   }
 }
+
+/// I2c that fails any transaction sent to kMissingAddress and counts how
+/// many transactions it has performed.
+class SweepI2c : public I2c
+{
+ public:
+  static constexpr uint8_t kMissingAddress = 0x50;
+
+  void ModuleInitialize() override {}
+  void Transaction(Transaction_t transaction) override
+  {
+    CHECK(transaction.busy);
+    transaction_count++;
+    if (transaction.address == kMissingAddress)
+    {
+      throw CommonErrors::kDeviceNotFound;
+    }
+  }
+
+  int transaction_count = 0;
+};
+
+TEST_CASE("Testing L1 i2c default Transactions()")
+{
+  // Setup
+  SweepI2c i2c;
+  std::array<I2c::Transaction_t, 3> batch = {
+    I2c::Transaction_t{ .address = 0x10 },
+    I2c::Transaction_t{ .address = SweepI2c::kMissingAddress },
+    I2c::Transaction_t{ .address = 0x20 },
+  };
+
+  // Exercise
+  size_t successful = i2c.Transactions(batch);
+
+  // Verify
+  CHECK(2 == successful);
+  CHECK(3 == i2c.transaction_count);
+  CHECK(static_cast<int>(batch[0].status) == 0);
+  CHECK(batch[1].status == std::errc::no_such_device_or_address);
+  CHECK(static_cast<int>(batch[2].status) == 0);
+  CHECK(!batch[0].busy);
+  CHECK(!batch[1].busy);
+  CHECK(!batch[2].busy);
+}
+
+TEST_CASE("Testing L1 i2c asynchronous transactions")
+{
+  constexpr uint8_t kAddress = 0x33;
+
+  Mock<I2c> mock_i2c;
+  I2c::Transaction_t * in_flight = nullptr;
+
+  When(Method(mock_i2c, TransactionAsync))
+      .AlwaysDo([&in_flight](I2c::Transaction_t & transaction) {
+        in_flight = &transaction;
+      });
+
+  I2c & test_subject = mock_i2c.get();
+
+  SECTION("WriteThenReadAsync() completes from interrupt")
+  {
+    // Setup
+    std::array<uint8_t, 1> write_buffer = { 0x0F };
+    std::array<uint8_t, 6> read_buffer;
+
+    // Exercise
+    auto handle =
+        test_subject.WriteThenReadAsync(kAddress, write_buffer, read_buffer);
+
+    // Verify
+    REQUIRE(in_flight != nullptr);
+    CHECK(in_flight->address == kAddress);
+    CHECK(in_flight->data_out == write_buffer.data());
+    CHECK(in_flight->out_length == write_buffer.size());
+    CHECK(in_flight->data_in == read_buffer.data());
+    CHECK(in_flight->in_length == read_buffer.size());
+    CHECK(in_flight->repeated == true);
+    CHECK(handle.IsBusy());
+
+    // Exercise
+    // Simulate the driver's interrupt completing the transaction.
+    in_flight->position = read_buffer.size();
+    in_flight->busy     = false;
+
+    // Verify
+    CHECK(!handle.IsBusy());
+    CHECK(read_buffer.size() == handle.Position());
+    CHECK(static_cast<int>(handle.Wait()) == 0);
+  }
+
+  SECTION("Wait() times out")
+  {
+    // Setup
+    std::array<uint8_t, 2> read_buffer;
+    auto handle = test_subject.ReadAsync(kAddress, read_buffer, 1ms);
+
+    // Exercise
+    std::errc status = handle.Wait(10us);
+
+    // Verify
+    CHECK(status == std::errc::timed_out);
+
+    // Finish the transaction so the handle's destructor does not wait.
+    in_flight->busy = false;
+  }
+
+  SECTION("Destroying the handle waits for the driver past the timeout")
+  {
+    // Setup
+    std::array<uint8_t, 2> read_buffer;
+    int sleeps = 0;
+    // Each sleep stands for an interrupt. The driver gives up on the
+    // transaction well after its 1ms timeout.
+    SetSleepFunction([&sleeps, &in_flight](std::chrono::nanoseconds) {
+      if (++sleeps == 100)
+      {
+        in_flight->busy = false;
+      }
+    });
+
+    // Exercise
+    {
+      auto handle = test_subject.ReadAsync(kAddress, read_buffer, 1ms);
+    }
+
+    // Verify
+    CHECK(100 == sleeps);
+
+    // Cleanup
+    SetSleepFunction(nullptr);
+  }
+
+  SECTION("WaitOrThrow() rethrows errors from the driver")
+  {
+    // Setup
+    std::array<uint8_t, 2> write_buffer = { 0x01, 0x02 };
+    auto handle = test_subject.WriteAsync(kAddress, write_buffer);
+    in_flight->status = std::errc::no_such_device_or_address;
+    in_flight->busy   = false;
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(handle.WaitOrThrow(),
+                        std::errc::no_such_device_or_address);
+  }
+}
+
+TEST_CASE("Testing L1 i2c default TransactionAsync()")
+{
+  // Setup
+  SweepI2c i2c;
+  std::array<uint8_t, 2> read_buffer;
+
+  // Exercise
+  auto found   = i2c.ReadAsync(0x10, read_buffer);
+  auto missing = i2c.ReadAsync(SweepI2c::kMissingAddress, read_buffer);
+
+  // Verify
+  CHECK(!found.IsBusy());
+  CHECK(static_cast<int>(found.Status()) == 0);
+  CHECK(!missing.IsBusy());
+  CHECK(missing.Status() == std::errc::no_such_device_or_address);
+}
+TEST_CASE("Testing L1 i2c non-throwing transactions")
+{
+  // Setup
+  SweepI2c i2c;
+  const std::array<uint8_t, 1> kRegister = { 0x0F };
+  std::array<uint8_t, 2> read_buffer;
+
+  // Exercise
+  auto found   = i2c.TryWriteThenRead(0x10, kRegister, read_buffer);
+  auto missing = i2c.TryRead(SweepI2c::kMissingAddress, read_buffer);
+  auto written = i2c.TryWrite(0x20, kRegister);
+
+  // Verify
+  CHECK(found);
+  CHECK(written);
+  CHECK(!missing);
+  CHECK(missing.GetCode() == std::errc::no_such_device_or_address);
+  // The error records where the failed operation was called.
+  CHECK(std::string_view(missing.Error().file).ends_with("i2c.test.cpp"));
+  CHECK(3 == i2c.transaction_count);
+}
+
+TEST_CASE("Testing L1 i2c speed modes and clock timing")
+{
+  I2cSettings_t settings;
+  constexpr auto kPeripheralClock = 48_MHz;
+
+  SECTION("GetMode() picks the slowest mode for the frequency")
+  {
+    // Exercise & Verify
+    settings.frequency = 100_kHz;
+    CHECK(I2cSettings_t::Mode::kStandard == settings.GetMode());
+    settings.frequency = 400_kHz;
+    CHECK(I2cSettings_t::Mode::kFast == settings.GetMode());
+    settings.frequency = 1_MHz;
+    CHECK(I2cSettings_t::Mode::kFastPlus == settings.GetMode());
+    settings.frequency = 3.4_MHz;
+    CHECK(I2cSettings_t::Mode::kHighSpeed == settings.GetMode());
+  }
+
+  SECTION("RiseTime() follows the pull up and bus capacitance")
+  {
+    // Setup
+    settings.pull_up         = 10'000_Ohm;
+    settings.bus_capacitance = 100_pF;
+
+    // Exercise & Verify
+    CHECK(848ns == settings.RiseTime());
+  }
+
+  SECTION("Standard mode splits the period by the duty cycle")
+  {
+    // Exercise
+    auto timing = I2c::CalculateClockTiming(kPeripheralClock, settings);
+
+    // Verify
+    CHECK(187ns == timing.rise_time);
+    CHECK(timing.low_cycles == timing.high_cycles);
+    CHECK(100'000 == doctest::Approx(timing.frequency.to<float>())
+                         .epsilon(0.005));
+  }
+
+  SECTION("Fast mode lengthens LOW to its minimum")
+  {
+    // Setup
+    settings.frequency = 400_kHz;
+
+    // Exercise
+    auto timing = I2c::CalculateClockTiming(kPeripheralClock, settings);
+
+    // Verify
+    // 1300ns and the rest of the 2500ns period, less the rise time.
+    CHECK(63 == timing.low_cycles);
+    CHECK(49 == timing.high_cycles);
+    // Rounding the cycles up never makes the clock faster than requested.
+    CHECK(timing.frequency <= 400_kHz);
+    CHECK(400'000 == doctest::Approx(timing.frequency.to<float>())
+                         .epsilon(0.01));
+  }
+
+  SECTION("Fast mode plus needs stiffer pull ups")
+  {
+    // Setup
+    settings.frequency = 1_MHz;
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(I2c::CalculateClockTiming(kPeripheralClock, settings),
+                        std::errc::invalid_argument);
+
+    // Setup
+    settings.pull_up = 1'000_Ohm;
+
+    // Exercise
+    auto timing = I2c::CalculateClockTiming(100_MHz, settings);
+
+    // Verify
+    CHECK(85ns == timing.rise_time);
+    CHECK(50 == timing.low_cycles);
+    CHECK(42 == timing.high_cycles);
+  }
+
+  SECTION("High speed mode")
+  {
+    // Setup
+    settings.frequency       = 3.4_MHz;
+    settings.pull_up         = 1'000_Ohm;
+    settings.bus_capacitance = 50_pF;
+
+    // Exercise
+    auto timing = I2c::CalculateClockTiming(200_MHz, settings);
+
+    // Verify
+    CHECK(32 == timing.low_cycles);
+    CHECK(19 == timing.high_cycles);
+    CHECK(3.4e6f == doctest::Approx(timing.frequency.to<float>())
+                        .epsilon(0.02));
+  }
+
+  SECTION("Runs slower when the minimum times do not fit")
+  {
+    // Setup
+    settings.frequency       = 3.4_MHz;
+    settings.pull_up         = 1'000_Ohm;
+    settings.bus_capacitance = 94_pF;
+
+    // Exercise
+    auto timing = I2c::CalculateClockTiming(200_MHz, settings);
+
+    // Verify
+    CHECK(32 == timing.low_cycles);
+    CHECK(12 == timing.high_cycles);
+    CHECK(timing.frequency < 3.4_MHz);
+  }
+
+  SECTION("Frequencies above high speed mode are rejected")
+  {
+    // Setup
+    settings.frequency = 4_MHz;
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(I2c::CalculateClockTiming(kPeripheralClock, settings),
+                        std::errc::invalid_argument);
+  }
+}
 }  // namespace sjsu
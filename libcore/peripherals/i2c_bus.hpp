@@ -0,0 +1,347 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include <libcore/peripherals/i2c.hpp>
+#include <libcore/peripherals/interrupt.hpp>
+#include <libcore/utility/critical_section.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Arbitrates access to a single sjsu::I2c shared by multiple drivers, each
+/// with its own bus settings and priority.
+///
+/// Drivers queue requests, each a batch of transactions, with Enqueue(), from
+/// any task or interrupt. ProcessQueue(), called from the one context that
+/// owns the bus, performs the waiting requests highest priority first, and in
+/// the order they were queued within a priority, back to back with
+/// I2c::Transactions(). The queue is checked again after every request, so a
+/// high priority request, such as an IMU read, waits for at most the one
+/// request already on the bus, however many lower priority requests are
+/// queued.
+///
+/// As with SpiBus, the bus keeps track of the settings that were last applied
+/// to the I2c peripheral and only re-initializes it when the next request
+/// needs different settings, such as a different frequency.
+///
+/// Devices should use the I2cDevice class rather than using this class
+/// directly.
+class I2cBus
+{
+ public:
+  /// Maximum number of requests that can be waiting in the queue.
+  static constexpr size_t kQueueDepth = 8;
+
+  /// Information needed to perform a request for a device on the bus.
+  struct Request_t
+  {
+    /// Transactions to perform back to back. The transactions and the
+    /// buffers they reference must remain valid until the request has
+    /// completed. On completion each transaction's `status` holds its result.
+    std::span<I2c::Transaction_t> transactions = {};
+
+    /// Settings the I2c peripheral must have to talk to the device.
+    const I2cSettings_t * settings = nullptr;
+
+    /// Requests with a higher priority are performed first.
+    uint8_t priority = 0;
+
+    /// Called once every transaction of the request has completed.
+    InterruptCallback on_complete = nullptr;
+  };
+
+  /// Counts of what the bus has done.
+  struct Statistics_t
+  {
+    /// Requests performed.
+    uint32_t requests = 0;
+    /// Times the I2c peripheral was re-initialized with new settings.
+    uint32_t reconfigurations = 0;
+    /// Largest number of requests waiting in the queue at once.
+    size_t max_pending = 0;
+    /// Longest time a request with the highest priority seen so far waited in
+    /// the queue, the latency that matters for time critical reads.
+    std::chrono::nanoseconds max_wait = 0ns;
+    /// Priority that max_wait was measured for.
+    uint8_t max_wait_priority = 0;
+  };
+
+  /// @param i2c - the I2c peripheral that all devices on this bus share. Must
+  ///        not be used directly while it is managed by this bus.
+  explicit I2cBus(I2c & i2c) : i2c_(i2c) {}
+
+  I2cBus(const I2cBus &) = delete;
+  I2cBus & operator=(const I2cBus &) = delete;
+
+  /// Perform a request immediately, blocking until it has completed. Only
+  /// call this from the context that calls ProcessQueue().
+  ///
+  /// Requests already waiting in the queue are not affected and performed the
+  /// next time ProcessQueue() is called.
+  ///
+  /// @param request - the request to perform.
+  /// @return size_t - number of transactions that completed successfully.
+  size_t Perform(const Request_t & request)
+  {
+    ApplySettings(*request.settings);
+
+    const size_t kSuccessful = i2c_.Transactions(request.transactions);
+    statistics_.requests++;
+
+    if (request.on_complete)
+    {
+      request.on_complete();
+    }
+
+    return kSuccessful;
+  }
+
+  /// Add a request to the queue. May be called from any task or interrupt.
+  ///
+  /// @param request - the request to perform.
+  /// @return true - if the request was added to the queue.
+  /// @return false - if the queue is full and the request was dropped.
+  bool Enqueue(const Request_t & request)
+  {
+    const auto kNow = Uptime();
+
+    CriticalSection lock;
+    if (count_ >= kQueueDepth)
+    {
+      return false;
+    }
+
+    // Higher priorities get smaller keys, and requests of the same priority
+    // keep the order they were queued in.
+    const uint64_t kKey =
+        (static_cast<uint64_t>(UINT8_MAX - request.priority) << 32) |
+        sequence_++;
+    queue_[count_++] = Entry_t{
+      .key     = kKey,
+      .queued  = kNow,
+      .request = request,
+    };
+    std::push_heap(queue_.begin(), queue_.begin() + count_, LowerPriority);
+    statistics_.max_pending = std::max(statistics_.max_pending, count_);
+    return true;
+  }
+
+  /// Perform every request waiting in the queue, highest priority first,
+  /// including requests queued while this runs. Call this from the context
+  /// that owns the bus, such as the main loop or a dedicated task.
+  ///
+  /// @return size_t - number of requests performed.
+  size_t ProcessQueue()
+  {
+    size_t processed = 0;
+
+    while (auto entry = Pop())
+    {
+      RecordWait(entry->request.priority, Uptime() - entry->queued);
+      Perform(entry->request);
+      processed++;
+    }
+
+    return processed;
+  }
+
+  /// @return size_t - number of requests waiting in the queue.
+  size_t Pending() const
+  {
+    CriticalSection lock;
+    return count_;
+  }
+
+  /// @return const Statistics_t & - counts of what the bus has done.
+  const Statistics_t & GetStatistics() const
+  {
+    return statistics_;
+  }
+
+  /// @return I2c& - the I2c peripheral managed by this bus.
+  I2c & GetI2c()
+  {
+    return i2c_;
+  }
+
+ private:
+  struct Entry_t
+  {
+    /// Priority in the upper bits, order of queueing in the lower bits. Lower
+    /// is performed first.
+    uint64_t key;
+    /// Uptime when the request was queued.
+    std::chrono::nanoseconds queued;
+    Request_t request;
+  };
+
+  /// Greater key is lower priority, making the heap a min-heap.
+  static bool LowerPriority(const Entry_t & left, const Entry_t & right)
+  {
+    return left.key > right.key;
+  }
+
+  std::optional<Entry_t> Pop()
+  {
+    CriticalSection lock;
+    if (count_ == 0)
+    {
+      return std::nullopt;
+    }
+    std::pop_heap(queue_.begin(), queue_.begin() + count_, LowerPriority);
+    return std::move(queue_[--count_]);
+  }
+
+  void RecordWait(uint8_t priority, std::chrono::nanoseconds wait)
+  {
+    if (priority > statistics_.max_wait_priority)
+    {
+      statistics_.max_wait_priority = priority;
+      statistics_.max_wait          = wait;
+    }
+    else if (priority == statistics_.max_wait_priority)
+    {
+      statistics_.max_wait = std::max(statistics_.max_wait, wait);
+    }
+  }
+
+  /// Re-initialize the I2c peripheral, but only if its current settings
+  /// differ from the requested settings.
+  ///
+  /// @param settings - the settings required for the next request.
+  void ApplySettings(const I2cSettings_t & settings)
+  {
+    if (i2c_.GetState() == State::kInitialized &&
+        i2c_.CurrentSettings() == settings)
+    {
+      return;
+    }
+
+    i2c_.settings = settings;
+    i2c_.Initialize();
+    statistics_.reconfigurations++;
+  }
+
+  I2c & i2c_;
+  std::array<Entry_t, kQueueDepth> queue_;
+  size_t count_      = 0;
+  uint32_t sequence_ = 0;
+  Statistics_t statistics_;
+};
+
+/// A device attached to a shared I2cBus with its own address, bus settings and
+/// priority.
+///
+/// Usage:
+///
+///    I2cBus bus(i2c);
+///    I2cDevice imu(bus, 0x68, 200);
+///    imu.settings.frequency = 400_kHz;
+///
+///    const std::array<uint8_t, 1> kAccelerationRegister = { 0x3B };
+///    std::array<uint8_t, 6> acceleration;
+///    std::array<I2c::Transaction_t, 1> read = {
+///      imu.WriteThenRead(kAccelerationRegister, acceleration),
+///    };
+///    imu.TransactionsAsync(read, [] { sample_ready = true; });
+///
+///    // In the task that owns the bus:
+///    bus.ProcessQueue();
+class I2cDevice
+{
+ public:
+  /// @param bus - the bus that this device is attached to.
+  /// @param address - the 7-bit address of the device.
+  /// @param priority - priority of this device's requests. Higher priorities
+  ///        are performed first.
+  I2cDevice(I2cBus & bus, uint8_t address, uint8_t priority = 0)
+      : bus_(bus), address_(address), priority_(priority)
+  {
+  }
+
+  /// Build a transaction that writes to this device then reads from it with
+  /// a repeated start, the usual way to read a register.
+  ///
+  /// @param transmit - bytes to write, such as a register address.
+  /// @param receive - buffer for the bytes read from the device.
+  /// @return I2c::Transaction_t - the transaction.
+  I2c::Transaction_t WriteThenRead(std::span<const uint8_t> transmit,
+                                   std::span<uint8_t> receive) const
+  {
+    return I2c::Transaction_t{
+      .operation  = I2c::Operation::kWrite,
+      .address    = address_,
+      .data_out   = transmit.data(),
+      .out_length = transmit.size(),
+      .data_in    = receive.data(),
+      .in_length  = receive.size(),
+      .repeated   = true,
+    };
+  }
+
+  /// Build a transaction that writes to this device.
+  ///
+  /// @param transmit - bytes to write.
+  /// @return I2c::Transaction_t - the transaction.
+  I2c::Transaction_t Write(std::span<const uint8_t> transmit) const
+  {
+    return I2c::Transaction_t{
+      .operation  = I2c::Operation::kWrite,
+      .address    = address_,
+      .data_out   = transmit.data(),
+      .out_length = transmit.size(),
+    };
+  }
+
+  /// Perform transactions back to back immediately, blocking until they have
+  /// completed. See I2cBus::Perform().
+  ///
+  /// @param transactions - transactions to perform.
+  /// @return size_t - number of transactions that completed successfully.
+  size_t Transactions(std::span<I2c::Transaction_t> transactions)
+  {
+    return bus_.Perform(MakeRequest(transactions, nullptr));
+  }
+
+  /// Queue transactions to be performed back to back by
+  /// I2cBus::ProcessQueue().
+  ///
+  /// @param transactions - transactions to perform. They and the buffers they
+  ///        reference must remain valid until `on_complete` is called.
+  /// @param on_complete - called once the transactions have completed.
+  /// @return true - if the request was queued.
+  /// @return false - if the bus queue is full.
+  bool TransactionsAsync(std::span<I2c::Transaction_t> transactions,
+                         InterruptCallback on_complete = nullptr)
+  {
+    return bus_.Enqueue(MakeRequest(transactions, on_complete));
+  }
+
+  /// Settings that the I2c peripheral must have when talking to this device.
+  I2cSettings_t settings;
+
+ private:
+  I2cBus::Request_t MakeRequest(std::span<I2c::Transaction_t> transactions,
+                                InterruptCallback on_complete)
+  {
+    return I2cBus::Request_t{
+      .transactions = transactions,
+      .settings     = &settings,
+      .priority     = priority_,
+      .on_complete  = on_complete,
+    };
+  }
+
+  I2cBus & bus_;
+  uint8_t address_;
+  uint8_t priority_;
+};
+}  // namespace sjsu
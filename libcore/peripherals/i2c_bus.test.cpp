@@ -0,0 +1,147 @@
+#include <libcore/peripherals/i2c_bus.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// I2c that records the address of every transaction and how many times it
+/// has been initialized.
+class RecordingI2c : public I2c
+{
+ public:
+  void ModuleInitialize() override
+  {
+    initializations++;
+  }
+
+  void Transaction(Transaction_t transaction) override
+  {
+    CHECK(transaction.busy);
+    addresses.push_back(transaction.address);
+  }
+
+  int initializations = 0;
+  std::vector<uint8_t> addresses;
+};
+}  // namespace
+
+TEST_CASE("Testing I2cBus and I2cDevice")
+{
+  RecordingI2c i2c;
+  I2cBus bus(i2c);
+  I2cDevice imu(bus, 0x68, 200);
+  I2cDevice sensor(bus, 0x40);
+  I2cDevice display(bus, 0x3C);
+  imu.settings.frequency     = 400_kHz;
+  sensor.settings.frequency  = 400_kHz;
+  display.settings.frequency = 100_kHz;
+
+  const std::array<uint8_t, 1> kRegister = { 0x3B };
+  std::array<uint8_t, 6> imu_data        = {};
+  std::array<uint8_t, 2> sensor_data     = {};
+  std::array<I2c::Transaction_t, 2> imu_read = {
+    imu.WriteThenRead(kRegister, imu_data),
+    imu.WriteThenRead(kRegister, imu_data),
+  };
+  std::array<I2c::Transaction_t, 1> sensor_read = {
+    sensor.WriteThenRead(kRegister, sensor_data),
+  };
+  std::array<I2c::Transaction_t, 1> display_write = {
+    display.Write(kRegister),
+  };
+
+  SECTION("WriteThenRead() builds a repeated start transaction")
+  {
+    // Verify
+    CHECK(0x68 == imu_read[0].address);
+    CHECK(imu_read[0].repeated);
+    CHECK(kRegister.data() == imu_read[0].data_out);
+    CHECK(imu_data.data() == imu_read[0].data_in);
+    CHECK(imu_data.size() == imu_read[0].in_length);
+  }
+
+  SECTION("Transactions() runs immediately and back to back")
+  {
+    // Exercise
+    size_t successful = imu.Transactions(imu_read);
+
+    // Verify
+    CHECK(2 == successful);
+    CHECK(std::vector<uint8_t>{ 0x68, 0x68 } == i2c.addresses);
+    CHECK(0 == bus.Pending());
+  }
+
+  SECTION("Queued requests run highest priority first")
+  {
+    // Setup
+    std::vector<int> completed;
+    sensor.TransactionsAsync(sensor_read, [&] { completed.push_back(1); });
+    display.TransactionsAsync(display_write, [&] { completed.push_back(2); });
+    imu.TransactionsAsync(imu_read, [&] { completed.push_back(3); });
+
+    // Exercise
+    size_t processed = bus.ProcessQueue();
+
+    // Verify
+    CHECK(3 == processed);
+    CHECK(std::vector<int>{ 3, 1, 2 } == completed);
+    CHECK(std::vector<uint8_t>{ 0x68, 0x68, 0x40, 0x3C } == i2c.addresses);
+    CHECK(3 == bus.GetStatistics().max_pending);
+    CHECK(200 == bus.GetStatistics().max_wait_priority);
+  }
+
+  SECTION("A request queued while processing overtakes lower priorities")
+  {
+    // Setup
+    sensor.TransactionsAsync(sensor_read, [&] {
+      imu.TransactionsAsync(imu_read);
+    });
+    sensor.TransactionsAsync(sensor_read);
+    display.TransactionsAsync(display_write);
+
+    // Exercise
+    bus.ProcessQueue();
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x40, 0x68, 0x68, 0x40, 0x3C } ==
+          i2c.addresses);
+  }
+
+  SECTION("Settings are only applied when they change")
+  {
+    // Setup
+    imu.TransactionsAsync(imu_read);
+    sensor.TransactionsAsync(sensor_read);
+    display.TransactionsAsync(display_write);
+    imu.TransactionsAsync(imu_read);
+
+    // Exercise
+    bus.ProcessQueue();
+
+    // Verify
+    // The IMU and sensor share settings, and the two IMU requests run first.
+    CHECK(2 == i2c.initializations);
+    CHECK(2 == bus.GetStatistics().reconfigurations);
+    CHECK(i2c.CurrentSettings() == display.settings);
+  }
+
+  SECTION("Enqueue() fails when the queue is full")
+  {
+    // Setup
+    for (size_t i = 0; i < I2cBus::kQueueDepth; i++)
+    {
+      REQUIRE(sensor.TransactionsAsync(sensor_read));
+    }
+
+    // Exercise & Verify
+    CHECK(!imu.TransactionsAsync(imu_read));
+    CHECK(I2cBus::kQueueDepth == bus.Pending());
+  }
+}
+}  // namespace sjsu
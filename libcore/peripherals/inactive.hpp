@@ -20,6 +20,16 @@ struct UnsupportedInactivePeripheral_t : std::false_type
 {
 };
 
+/// The object returned by a GetInactive() specialization. Inactive
+/// peripherals are constexpr constructible, so it is constant initialized:
+/// unlike a function local static, returning it does not check a guard
+/// variable on every call, and it adds no code to startup beyond registering
+/// its destructor.
+///
+/// @tparam Inactive - the inactive implementation of the peripheral.
+template <typename Inactive>
+inline constinit Inactive inactive_instance{};
+
 /// Default template behaviour for an attempt to create an inactive sjsu L1
 /// interface for an interface that is not yet supported. Will generate a custom
 /// compile time error message.
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <libcore/peripherals/interrupt.hpp>
+#include <libcore/utility/event_trace.hpp>
+#include <libcore/utility/stack_usage.hpp>
+#include <libcore/utility/time/cycle_counter.hpp>
+
+namespace sjsu
+{
+/// An interrupt controller that wraps another and measures every interrupt
+/// handler registered through it.
+///
+/// Each handler passed to Enable() is replaced by one that counts the calls
+/// and measures the handler's execution time with the CycleCounter, along
+/// with how deeply nested in other instrumented interrupts it ran. The
+/// statistics are kept per interrupt request number in a fixed table, so
+/// nothing is allocated, and can be read while the system runs to find which
+/// interrupt is taking up the CPU.
+///
+/// Instrumentation is opt-in: install it in place of the platform's
+/// controller at startup, before any interrupt is enabled. When
+/// SJ2_EVENT_TRACING is 1, each handler run is also recorded as an
+/// "Interrupt" span, see event_trace.hpp.
+///
+/// USAGE:
+///
+///    sjsu::CycleCounter::Enable();
+///    static sjsu::InstrumentedInterruptController<16> instrumented(
+///        sjsu::InterruptController::GetPlatformController());
+///    sjsu::InterruptController::SetPlatformController(&instrumented);
+///
+///    // Later
+///    instrumented.ForEach([](const auto & irq) {
+///      sjsu::log::Print("IRQ {}: {} calls, max {}\n",
+///                       irq.interrupt_request_number, irq.count, irq.maximum);
+///    });
+///
+/// Durations are in CycleCounter counts: CPU cycles, or nanoseconds on
+/// platforms without a cycle counter. A handler's duration includes any
+/// interrupts that preempted it.
+///
+/// With kSampleStackPointer, the stack pointer is also sampled as each handler
+/// is entered, and the lowest is kept, to show how deep the stack already was
+/// when the handler ran. See debug::PrintInterruptStackDepths().
+///
+/// @tparam kCapacity - maximum number of distinct interrupt request numbers.
+/// @tparam kSampleStackPointer - whether to sample the stack pointer on entry.
+template <size_t kCapacity, bool kSampleStackPointer = false>
+class InstrumentedInterruptController : public InterruptController
+{
+ public:
+  /// Statistics of a single interrupt request number.
+  struct Statistics_t
+  {
+    /// The interrupt request number, only valid while `in_use` is true.
+    int interrupt_request_number = 0;
+    /// Whether this entry has been assigned to an interrupt.
+    bool in_use = false;
+    /// Number of times the handler has run.
+    uint32_t count = 0;
+    /// Total counts spent in the handler.
+    uint64_t total = 0;
+    /// Longest single run of the handler.
+    uint32_t maximum = 0;
+    /// Deepest nesting observed, 1 when the handler only ever interrupted
+    /// non-interrupt code.
+    uint32_t maximum_nesting = 0;
+    /// Lowest stack pointer any run of the handler was entered with, 0 until
+    /// sampled. Only sampled when kSampleStackPointer is true.
+    uintptr_t lowest_stack_pointer = 0;
+    /// The handler being measured.
+    InterruptHandler handler = nullptr;
+  };
+
+  /// @param controller - the platform's interrupt controller, which performs
+  ///        the actual enabling and disabling.
+  explicit InstrumentedInterruptController(InterruptController & controller)
+      : controller_(controller)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    controller_.Initialize();
+  }
+
+  /// Register the interrupt with the wrapped controller, with a handler that
+  /// measures `register_info.interrupt_handler`. When the table is full, the
+  /// interrupt is registered without being measured.
+  ///
+  /// @param register_info - the needed information to setup the interrupt.
+  void Enable(RegistrationInfo_t register_info) override
+  {
+    Statistics_t * entry = Find(register_info.interrupt_request_number);
+    if (entry == nullptr)
+    {
+      entry = Find(std::nullopt);
+    }
+
+    if (entry != nullptr && register_info.interrupt_handler)
+    {
+      entry->interrupt_request_number = register_info.interrupt_request_number;
+      entry->in_use                   = true;
+      entry->handler                  = register_info.interrupt_handler;
+      register_info.interrupt_handler = [entry]() { Measure(*entry); };
+    }
+
+    controller_.Enable(register_info);
+  }
+
+  /// @param interrupt_request_number - the interrupt request number to be
+  ///        disabled.
+  void Disable(int interrupt_request_number) override
+  {
+    controller_.Disable(interrupt_request_number);
+  }
+
+  /// @param interrupt_request_number - the interrupt to look up.
+  /// @return const Statistics_t* - statistics of the interrupt, or nullptr if
+  ///         it has not been enabled through this controller.
+  const Statistics_t * GetStatistics(int interrupt_request_number) const
+  {
+    for (const auto & entry : table_)
+    {
+      if (entry.in_use &&
+          entry.interrupt_request_number == interrupt_request_number)
+      {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Call `callback` with the statistics of every measured interrupt.
+  ///
+  /// @param callback - callable with the signature
+  ///        `void(const Statistics_t &)`.
+  template <typename Callback>
+  void ForEach(Callback && callback) const
+  {
+    for (const auto & entry : table_)
+    {
+      if (entry.in_use)
+      {
+        callback(entry);
+      }
+    }
+  }
+
+  /// Clear the statistics of every interrupt. The handlers remain measured.
+  void Reset()
+  {
+    for (auto & entry : table_)
+    {
+      entry.count                = 0;
+      entry.total                = 0;
+      entry.maximum              = 0;
+      entry.maximum_nesting      = 0;
+      entry.lowest_stack_pointer = 0;
+    }
+  }
+
+ private:
+  static void Measure(Statistics_t & entry)
+  {
+    SJ2_TRACE_SCOPE("Interrupt", entry.interrupt_request_number);
+
+    if constexpr (kSampleStackPointer)
+    {
+      const uintptr_t kStackPointer = stack::CurrentStackPointer();
+      if (entry.lowest_stack_pointer == 0 ||
+          kStackPointer < entry.lowest_stack_pointer)
+      {
+        entry.lowest_stack_pointer = kStackPointer;
+      }
+    }
+
+    const uint32_t kNesting = nesting.fetch_add(1) + 1;
+    const uint32_t kStart   = CycleCounter::Read();
+
+    entry.handler();
+
+    const uint32_t kElapsed =
+        CycleCounter::Elapsed(kStart, CycleCounter::Read());
+    nesting.fetch_sub(1);
+
+    entry.count++;
+    entry.total += kElapsed;
+    entry.maximum         = std::max(entry.maximum, kElapsed);
+    entry.maximum_nesting = std::max(entry.maximum_nesting, kNesting);
+  }
+
+  /// @param interrupt_request_number - interrupt to find, or std::nullopt for
+  ///        an unused entry.
+  Statistics_t * Find(std::optional<int> interrupt_request_number)
+  {
+    for (auto & entry : table_)
+    {
+      if (interrupt_request_number.has_value()
+              ? (entry.in_use && entry.interrupt_request_number ==
+                                     *interrupt_request_number)
+              : !entry.in_use)
+      {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Number of instrumented handlers currently running, shared by every
+  /// instance of the same template arguments.
+  static inline std::atomic<uint32_t> nesting = 0;
+
+  InterruptController & controller_;
+  std::array<Statistics_t, kCapacity> table_{};
+};
+}  // namespace sjsu
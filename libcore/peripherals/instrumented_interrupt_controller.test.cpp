@@ -0,0 +1,131 @@
+#include <libcore/peripherals/instrumented_interrupt_controller.hpp>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing InstrumentedInterruptController")
+{
+  Mock<InterruptController> mock_controller;
+  InterruptController::RegistrationInfo_t registered;
+  When(Method(mock_controller, InterruptController::Enable))
+      .AlwaysDo([&registered](InterruptController::RegistrationInfo_t info)
+                { registered = info; });
+  Fake(Method(mock_controller, InterruptController::Disable));
+
+  InstrumentedInterruptController<2> test_subject(mock_controller.get());
+
+  SECTION("Enable() measures the handler")
+  {
+    // Setup
+    int calls = 0;
+
+    // Exercise
+    test_subject.Enable({
+        .interrupt_request_number = 5,
+        .interrupt_handler        = [&calls]() { calls++; },
+        .priority                 = 3,
+    });
+    registered.interrupt_handler();
+    registered.interrupt_handler();
+
+    // Verify
+    Verify(Method(mock_controller, InterruptController::Enable)).Once();
+    CHECK(5 == registered.interrupt_request_number);
+    CHECK(3 == registered.priority);
+    CHECK(2 == calls);
+
+    const auto * statistics = test_subject.GetStatistics(5);
+    REQUIRE(statistics != nullptr);
+    CHECK(2 == statistics->count);
+    CHECK(statistics->maximum <= statistics->total);
+    CHECK(1 == statistics->maximum_nesting);
+    CHECK(nullptr == test_subject.GetStatistics(6));
+  }
+
+  SECTION("Nested interrupts record their depth")
+  {
+    // Setup
+    InterruptController::RegistrationInfo_t inner;
+    test_subject.Enable({
+        .interrupt_request_number = 1,
+        .interrupt_handler        = []() {},
+    });
+    inner = registered;
+    test_subject.Enable({
+        .interrupt_request_number = 2,
+        .interrupt_handler        = [&inner]() { inner.interrupt_handler(); },
+    });
+
+    // Exercise
+    registered.interrupt_handler();
+
+    // Verify
+    CHECK(2 == test_subject.GetStatistics(1)->maximum_nesting);
+    CHECK(1 == test_subject.GetStatistics(2)->maximum_nesting);
+  }
+
+  SECTION("Interrupts beyond the capacity are not measured")
+  {
+    // Setup
+    int calls = 0;
+    test_subject.Enable({ .interrupt_request_number = 1 });
+    test_subject.Enable({ .interrupt_request_number = 2 });
+
+    // Exercise
+    test_subject.Enable({
+        .interrupt_request_number = 3,
+        .interrupt_handler        = [&calls]() { calls++; },
+    });
+    registered.interrupt_handler();
+
+    // Verify
+    CHECK(1 == calls);
+    CHECK(nullptr == test_subject.GetStatistics(3));
+
+    size_t measured = 0;
+    test_subject.ForEach([&measured](const auto &) { measured++; });
+    CHECK(2 == measured);
+  }
+
+  SECTION("Reset() clears the statistics")
+  {
+    // Setup
+    test_subject.Enable({ .interrupt_request_number = 4 });
+    registered.interrupt_handler();
+
+    // Exercise
+    test_subject.Reset();
+
+    // Verify
+    CHECK(0 == test_subject.GetStatistics(4)->count);
+  }
+
+  SECTION("Stack pointer is sampled only when enabled")
+  {
+    // Setup
+    InstrumentedInterruptController<1, true> sampling(mock_controller.get());
+    const uintptr_t kStackPointer = stack::CurrentStackPointer();
+
+    // Exercise
+    test_subject.Enable({ .interrupt_request_number = 1 });
+    registered.interrupt_handler();
+    sampling.Enable({ .interrupt_request_number = 1 });
+    registered.interrupt_handler();
+
+    // Verify
+    CHECK(0 == test_subject.GetStatistics(1)->lowest_stack_pointer);
+    CHECK(0 != sampling.GetStatistics(1)->lowest_stack_pointer);
+    CHECK(kStackPointer >= sampling.GetStatistics(1)->lowest_stack_pointer);
+  }
+
+  SECTION("Disable() is forwarded")
+  {
+    // Exercise
+    test_subject.Disable(7);
+
+    // Verify
+    Verify(Method(mock_controller, InterruptController::Disable).Using(7));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,334 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <libcore/peripherals/adc.hpp>
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/i2c.hpp>
+#include <libcore/peripherals/pwm.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu
+{
+/// @defgroup interface_concepts Interface Concepts
+///
+/// Compile time versions of the peripheral interfaces. A driver written as a
+/// template over one of these concepts calls the methods of the concrete type
+/// it is given directly, so one-line operations such as setting a pin are
+/// inlined instead of going through the virtual table:
+///
+///    template <sjsu::GpioInterface Pin>
+///    void Pulse(Pin & pin)
+///    {
+///      pin.Set(sjsu::Gpio::kHigh);
+///      pin.Set(sjsu::Gpio::kLow);
+///    }
+///
+/// The virtual interfaces satisfy their concepts, so the same driver also
+/// works with a `sjsu::Gpio &` chosen at runtime. Platform drivers should be
+/// declared `final` so the compiler can devirtualize calls through their
+/// concrete type. The adapters below wrap a type that only satisfies a concept
+/// so it can be passed to code that takes the virtual interface.
+/// @{
+
+/// A type usable as a sjsu::Gpio.
+template <class T>
+concept GpioInterface =
+    requires(T & pin, Gpio::Direction direction, Gpio::State state)
+{
+  pin.Initialize();
+  pin.SetDirection(direction);
+  pin.Set(state);
+  pin.Toggle();
+  { pin.Read() } -> std::convertible_to<bool>;
+};
+
+/// A type usable as a sjsu::Spi.
+template <class T>
+concept SpiInterface = requires(T & spi,
+                                std::span<uint8_t> bytes,
+                                std::span<uint16_t> words)
+{
+  spi.Initialize();
+  spi.Transfer(bytes);
+  spi.Transfer(words);
+};
+
+/// A type usable as a sjsu::I2c.
+template <class T>
+concept I2cInterface = requires(T & i2c, I2c::Transaction_t transaction)
+{
+  i2c.Initialize();
+  i2c.Transaction(transaction);
+};
+
+/// A type usable as a sjsu::Uart.
+template <class T>
+concept UartInterface = requires(T & uart,
+                                 std::span<const uint8_t> transmit,
+                                 std::span<uint8_t> receive)
+{
+  uart.Initialize();
+  { uart.HasData() } -> std::convertible_to<bool>;
+  uart.Write(transmit);
+  { uart.Read(receive) } -> std::convertible_to<size_t>;
+};
+
+/// A type usable as a sjsu::Pwm.
+template <class T>
+concept PwmInterface = requires(T & pwm, float duty_cycle)
+{
+  pwm.Initialize();
+  pwm.SetDutyCycle(duty_cycle);
+  { pwm.GetDutyCycle() } -> std::convertible_to<float>;
+};
+
+/// A type usable as a sjsu::Adc.
+template <class T>
+concept AdcInterface = requires(T & adc)
+{
+  adc.Initialize();
+  { adc.Read() } -> std::convertible_to<uint32_t>;
+  { adc.GetActiveBits() } -> std::convertible_to<uint8_t>;
+};
+
+static_assert(GpioInterface<Gpio>);
+static_assert(SpiInterface<Spi>);
+static_assert(I2cInterface<I2c>);
+static_assert(UartInterface<Uart>);
+static_assert(PwmInterface<Pwm>);
+static_assert(AdcInterface<Adc>);
+
+namespace detail
+{
+/// Give the settings of an adapter to the adapted object, if it has the same
+/// settings, then initialize it.
+template <class Adapted, class Settings_t>
+void InitializeAdapted(Adapted & adapted, const Settings_t & settings)
+{
+  if constexpr (requires { adapted.settings = settings; })
+  {
+    adapted.settings = settings;
+  }
+  adapted.Initialize();
+}
+}  // namespace detail
+
+/// Use an object that satisfies GpioInterface as a sjsu::Gpio.
+///
+/// @tparam T - type of the adapted pin.
+template <GpioInterface T>
+class GpioAdapter final : public Gpio
+{
+ public:
+  /// @param pin - the pin to adapt. Must outlive the adapter.
+  explicit GpioAdapter(T & pin) : pin_(pin) {}
+
+  void ModuleInitialize() override
+  {
+    detail::InitializeAdapted(pin_, settings);
+  }
+
+  void SetDirection(Direction direction) override
+  {
+    pin_.SetDirection(direction);
+  }
+
+  void Set(State output) override
+  {
+    pin_.Set(output);
+  }
+
+  void Toggle() override
+  {
+    pin_.Toggle();
+  }
+
+  bool Read() override
+  {
+    return pin_.Read();
+  }
+
+  /// @throw sjsu::Exception - std::errc::operation_not_supported if the pin
+  ///        does not support interrupts.
+  void AttachInterrupt(InterruptCallback callback, Edge edge) override
+  {
+    if constexpr (requires { pin_.AttachInterrupt(callback, edge); })
+    {
+      pin_.AttachInterrupt(callback, edge);
+    }
+    else
+    {
+      throw Exception(std::errc::operation_not_supported,
+                      "Adapted pin does not support interrupts.");
+    }
+  }
+
+  void DetachInterrupt() override
+  {
+    if constexpr (requires { pin_.DetachInterrupt(); })
+    {
+      pin_.DetachInterrupt();
+    }
+  }
+
+ private:
+  T & pin_;
+};
+
+/// Use an object that satisfies SpiInterface as a sjsu::Spi.
+///
+/// @tparam T - type of the adapted SPI.
+template <SpiInterface T>
+class SpiAdapter final : public Spi
+{
+ public:
+  /// @param spi - the SPI to adapt. Must outlive the adapter.
+  explicit SpiAdapter(T & spi) : spi_(spi) {}
+
+  void ModuleInitialize() override
+  {
+    detail::InitializeAdapted(spi_, settings);
+  }
+
+  void Transfer(std::span<uint8_t> buffer) override
+  {
+    spi_.Transfer(buffer);
+  }
+
+  void Transfer(std::span<uint16_t> buffer) override
+  {
+    spi_.Transfer(buffer);
+  }
+
+  using Spi::Transfer;
+
+ private:
+  T & spi_;
+};
+
+/// Use an object that satisfies I2cInterface as a sjsu::I2c.
+///
+/// @tparam T - type of the adapted I2C.
+template <I2cInterface T>
+class I2cAdapter final : public I2c
+{
+ public:
+  /// @param i2c - the I2C to adapt. Must outlive the adapter.
+  explicit I2cAdapter(T & i2c) : i2c_(i2c) {}
+
+  void ModuleInitialize() override
+  {
+    detail::InitializeAdapted(i2c_, settings);
+  }
+
+  void Transaction(Transaction_t transaction) override
+  {
+    i2c_.Transaction(transaction);
+  }
+
+ private:
+  T & i2c_;
+};
+
+/// Use an object that satisfies UartInterface as a sjsu::Uart.
+///
+/// @tparam T - type of the adapted UART.
+template <UartInterface T>
+class UartAdapter final : public Uart
+{
+ public:
+  /// @param uart - the UART to adapt. Must outlive the adapter.
+  explicit UartAdapter(T & uart) : uart_(uart) {}
+
+  void ModuleInitialize() override
+  {
+    detail::InitializeAdapted(uart_, settings);
+  }
+
+  bool HasData() override
+  {
+    return uart_.HasData();
+  }
+
+  void Write(std::span<const uint8_t> data) override
+  {
+    uart_.Write(data);
+  }
+
+  size_t Read(std::span<uint8_t> data) override
+  {
+    return uart_.Read(data);
+  }
+
+  using Uart::Read;
+  using Uart::Write;
+
+ private:
+  T & uart_;
+};
+
+/// Use an object that satisfies PwmInterface as a sjsu::Pwm.
+///
+/// @tparam T - type of the adapted PWM.
+template <PwmInterface T>
+class PwmAdapter final : public Pwm
+{
+ public:
+  /// @param pwm - the PWM to adapt. Must outlive the adapter.
+  explicit PwmAdapter(T & pwm) : pwm_(pwm) {}
+
+  void ModuleInitialize() override
+  {
+    detail::InitializeAdapted(pwm_, settings);
+  }
+
+  void SetDutyCycle(float duty_cycle) override
+  {
+    pwm_.SetDutyCycle(duty_cycle);
+  }
+
+  float GetDutyCycle() override
+  {
+    return pwm_.GetDutyCycle();
+  }
+
+ private:
+  T & pwm_;
+};
+
+/// Use an object that satisfies AdcInterface as a sjsu::Adc.
+///
+/// @tparam T - type of the adapted ADC.
+template <AdcInterface T>
+class AdcAdapter final : public Adc
+{
+ public:
+  /// @param adc - the ADC to adapt. Must outlive the adapter.
+  explicit AdcAdapter(T & adc) : adc_(adc) {}
+
+  void ModuleInitialize() override
+  {
+    detail::InitializeAdapted(adc_, settings);
+  }
+
+  uint32_t Read() override
+  {
+    return adc_.Read();
+  }
+
+  uint8_t GetActiveBits() override
+  {
+    return adc_.GetActiveBits();
+  }
+
+ private:
+  T & adc_;
+};
+/// @}
+}  // namespace sjsu
@@ -0,0 +1,128 @@
+#include <libcore/peripherals/interface_concepts.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// A pin without virtual methods, such as a platform's register level pin.
+struct InlinePin
+{
+  void Initialize()
+  {
+    initialized = true;
+  }
+  void SetDirection(Gpio::Direction new_direction)
+  {
+    direction = new_direction;
+  }
+  void Set(Gpio::State state)
+  {
+    level = (state == Gpio::kHigh);
+    levels.push_back(level);
+  }
+  void Toggle()
+  {
+    Set(level ? Gpio::kLow : Gpio::kHigh);
+  }
+  bool Read()
+  {
+    return level;
+  }
+
+  PinSettings_t settings;
+  bool initialized          = false;
+  bool level                = false;
+  Gpio::Direction direction = Gpio::kInput;
+  std::vector<bool> levels;
+};
+
+/// An ADC without settings.
+struct InlineAdc
+{
+  void Initialize() {}
+  uint32_t Read()
+  {
+    return 512;
+  }
+  uint8_t GetActiveBits()
+  {
+    return 10;
+  }
+};
+
+/// Driver written against the concept, usable with either kind of pin.
+template <GpioInterface Pin>
+void Pulse(Pin & pin)
+{
+  pin.Set(Gpio::kHigh);
+  pin.Set(Gpio::kLow);
+}
+}  // namespace
+
+TEST_CASE("Testing interface concepts")
+{
+  SECTION("Types that do not provide the interface are rejected")
+  {
+    // Verify
+    CHECK(GpioInterface<InlinePin>);
+    CHECK(AdcInterface<InlineAdc>);
+    CHECK(!GpioInterface<InlineAdc>);
+    CHECK(!SpiInterface<InlinePin>);
+    CHECK(!UartInterface<Pwm>);
+  }
+
+  SECTION("Generic drivers accept concrete pins and the virtual interface")
+  {
+    // Setup
+    InlinePin pin;
+    GpioAdapter adapter(pin);
+    Gpio & virtual_pin = adapter;
+
+    // Exercise
+    Pulse(pin);
+    Pulse(virtual_pin);
+
+    // Verify
+    CHECK(std::vector<bool>{ true, false, true, false } == pin.levels);
+  }
+
+  SECTION("GpioAdapter forwards settings and methods")
+  {
+    // Setup
+    InlinePin pin;
+    GpioAdapter test_subject(pin);
+    test_subject.settings.PullDown();
+
+    // Exercise
+    test_subject.Initialize();
+    test_subject.SetAsOutput();
+    test_subject.Toggle();
+
+    // Verify
+    CHECK(pin.initialized);
+    CHECK(PinSettings_t::Resistor::kPullDown == pin.settings.resistor);
+    CHECK(Gpio::kOutput == pin.direction);
+    CHECK(test_subject.Read());
+    CHECK_THROWS_AS(test_subject.AttachInterrupt([]() {}, Gpio::Edge::kBoth),
+                    sjsu::Exception);
+  }
+
+  SECTION("AdcAdapter works with types without settings")
+  {
+    // Setup
+    InlineAdc adc;
+    AdcAdapter test_subject(adc);
+
+    // Exercise
+    test_subject.Initialize();
+
+    // Verify
+    CHECK(512 == test_subject.Read());
+    CHECK(1023 == test_subject.GetMaximumValue());
+  }
+}
+}  // namespace sjsu
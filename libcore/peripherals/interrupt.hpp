@@ -4,6 +4,7 @@
 #include <functional>
 #include <libcore/module.hpp>
 #include <libcore/peripherals/inactive.hpp>
+#include <libcore/utility/inplace_function.hpp>
 
 namespace sjsu
 {
@@ -11,10 +12,10 @@ namespace sjsu
 using InterruptVectorAddress = void (*)(void);
 
 /// Define an alias for an interrupt service routine callable object.
-using InterruptHandler = std::function<void(void)>;
+using InterruptHandler = InplaceFunction<void(void)>;
 
 /// Standard callback that should be executed when interrupts fire.
-using InterruptCallback = std::function<void(void)>;
+using InterruptCallback = InplaceFunction<void(void)>;
 
 /// Definition of an interrupt callback that does... well... nothing really.
 inline static InterruptCallback do_nothing = []() {};
@@ -115,7 +116,6 @@ inline sjsu::InterruptController & GetInactive<sjsu::InterruptController>()
     void Disable(int) override {}
   };
 
-  static InactiveInterruptController inactive;
-  return inactive;
+  return inactive_instance<InactiveInterruptController>;
 }
 }  // namespace sjsu
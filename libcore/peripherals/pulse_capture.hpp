@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 #include <libcore/peripherals/interrupt.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
 
 namespace sjsu
@@ -26,6 +30,12 @@ class PulseCapture
   /// Interrupt callback that passes capture status information
   using CaptureCallback = std::function<void(PulseCapture::CaptureStatus_t)>;
 
+  /// Called with the half of the stream buffer that was just filled with
+  /// timestamps, usually from the DMA interrupt. The other half is being
+  /// filled meanwhile.
+  using TimestampCallback =
+      InplaceFunction<void(std::span<const uint32_t> timestamps)>;
+
   /// Define which edges to capture input on
   enum class CaptureEdgeMode : uint8_t
   {
@@ -44,5 +54,130 @@ class PulseCapture
 
   /// Enable or disable capture interrupts
   virtual void EnableCaptureInterrupt(bool enabled) const = 0;
+
+  /// Capture the timer count of every edge selected by ConfigureCapture()
+  /// into the circular `buffer`, with DMA rather than an interrupt per edge,
+  /// for edge rates an interrupt per edge cannot keep up with, such as
+  /// infrared receivers and frequency measurement. Once each half of the
+  /// buffer has been filled, `on_half` is called with it. Continues until
+  /// StopCaptureStream(). The capture interrupt should be disabled meanwhile.
+  ///
+  /// The default implementation does not support streaming. Use
+  /// CaptureStream to read the timestamps in batches outside of the
+  /// interrupt.
+  ///
+  /// @param buffer - circular buffer of timestamps, with an even number of
+  ///        timestamps. The contents are NOT copied and it must remain valid
+  ///        until StopCaptureStream().
+  /// @param on_half - called with each half of the buffer once filled.
+  /// @return true - if the stream started.
+  virtual bool StartCaptureStream(
+      [[maybe_unused]] std::span<uint32_t> buffer,
+      [[maybe_unused]] TimestampCallback on_half) const
+  {
+    return false;
+  }
+
+  /// Stop the stream started by StartCaptureStream().
+  virtual void StopCaptureStream() const {}
+};
+
+/// Reads the timestamps streamed by PulseCapture::StartCaptureStream() in
+/// batches, from the main loop or a task, rather than from the interrupt that
+/// signals each half of the buffer.
+///
+/// Each call of Read() returns the oldest half of the buffer that has been
+/// filled and not yet read. The returned timestamps remain valid until the
+/// capture fills the next half after it, so each batch should be processed
+/// within the time it takes to capture half the buffer. When the reader falls
+/// further behind, the halves being overwritten are skipped and counted in
+/// Overruns().
+///
+/// USAGE:
+///
+///    std::array<uint32_t, 256> timestamps;
+///    sjsu::CaptureStream stream(capture, timestamps);
+///    capture.ConfigureCapture(sjsu::PulseCapture::CaptureEdgeMode::kBoth);
+///    stream.Start();
+///
+///    // In the main loop:
+///    for (auto batch = stream.Read(); !batch.empty(); batch = stream.Read())
+///    {
+///      decoder.Process(batch);
+///    }
+class CaptureStream
+{
+ public:
+  /// @param capture - the capture timer that streams the timestamps.
+  /// @param buffer - circular buffer of timestamps, with an even number of
+  ///        timestamps. Must outlive this object.
+  CaptureStream(const PulseCapture & capture, std::span<uint32_t> buffer)
+      : capture_(capture), buffer_(buffer)
+  {
+  }
+
+  CaptureStream(const CaptureStream &) = delete;
+  CaptureStream & operator=(const CaptureStream &) = delete;
+
+  /// Start streaming timestamps into the buffer, discarding any that have
+  /// not been read.
+  ///
+  /// @return true - if the stream started.
+  /// @return false - if the capture timer cannot stream timestamps.
+  bool Start()
+  {
+    filled_.store(0, std::memory_order_relaxed);
+    read_ = 0;
+    return capture_.StartCaptureStream(
+        buffer_, [this](std::span<const uint32_t>) {
+          filled_.fetch_add(1, std::memory_order_release);
+        });
+  }
+
+  /// Stop streaming. Halves already filled can still be read.
+  void Stop()
+  {
+    capture_.StopCaptureStream();
+  }
+
+  /// @return std::span<const uint32_t> - the oldest half of the buffer that
+  ///         has been filled and not yet read, or an empty span if there is
+  ///         none.
+  std::span<const uint32_t> Read()
+  {
+    const uint32_t kFilled = filled_.load(std::memory_order_acquire);
+    if (kFilled == read_)
+    {
+      return {};
+    }
+
+    // Two or more halves behind: the oldest unread halves have been, or are
+    // being, overwritten, so only the most recently filled half is intact.
+    if (kFilled - read_ > 1)
+    {
+      overruns_ += kFilled - read_ - 1;
+      read_ = kFilled - 1;
+    }
+
+    const size_t kHalf = buffer_.size() / 2;
+    return std::span<const uint32_t>(buffer_).subspan(
+        (read_++ % 2) * kHalf, kHalf);
+  }
+
+  /// @return uint32_t - number of halves that were overwritten before they
+  ///         were read.
+  uint32_t Overruns() const
+  {
+    return overruns_;
+  }
+
+ private:
+  const PulseCapture & capture_;
+  std::span<uint32_t> buffer_;
+  /// Number of halves filled, only written by the capture interrupt.
+  std::atomic<uint32_t> filled_ = 0;
+  /// Number of halves read or skipped.
+  uint32_t read_     = 0;
+  uint32_t overruns_ = 0;
 };
 }  // namespace sjsu
@@ -0,0 +1,163 @@
+#include <libcore/peripherals/pulse_capture.hpp>
+
+#include <array>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Capture timer that streams the timestamps given by the test, as its DMA
+/// would.
+class StreamingCapture : public PulseCapture
+{
+ public:
+  void Initialize(CaptureCallback, int32_t) const override {}
+  void ConfigureCapture(CaptureEdgeMode) const override {}
+  void EnableCaptureInterrupt(bool) const override {}
+
+  bool StartCaptureStream(std::span<uint32_t> new_buffer,
+                          TimestampCallback new_on_half) const override
+  {
+    buffer    = new_buffer;
+    on_half   = new_on_half;
+    position  = 0;
+    streaming = true;
+    return true;
+  }
+
+  void StopCaptureStream() const override
+  {
+    streaming = false;
+  }
+
+  void Edge(uint32_t count) const
+  {
+    if (!streaming)
+    {
+      return;
+    }
+
+    buffer[position++] = count;
+    const size_t kHalf = buffer.size() / 2;
+    if (position % kHalf == 0)
+    {
+      on_half(std::span<const uint32_t>(buffer).subspan(position - kHalf,
+                                                        kHalf));
+      position %= buffer.size();
+    }
+  }
+
+  mutable std::span<uint32_t> buffer;
+  mutable TimestampCallback on_half;
+  mutable size_t position = 0;
+  mutable bool streaming  = false;
+};
+
+/// Capture timer without a streaming mode.
+class InterruptOnlyCapture : public PulseCapture
+{
+ public:
+  void Initialize(CaptureCallback, int32_t) const override {}
+  void ConfigureCapture(CaptureEdgeMode) const override {}
+  void EnableCaptureInterrupt(bool) const override {}
+};
+
+std::vector<uint32_t> ToVector(std::span<const uint32_t> timestamps)
+{
+  return std::vector<uint32_t>(timestamps.begin(), timestamps.end());
+}
+}  // namespace
+
+TEST_CASE("Testing CaptureStream")
+{
+  // Setup
+  StreamingCapture capture;
+  std::array<uint32_t, 8> buffer = {};
+  CaptureStream stream(capture, buffer);
+
+  SECTION("Start() fails without a streaming mode")
+  {
+    // Setup
+    InterruptOnlyCapture interrupt_only;
+    CaptureStream unsupported(interrupt_only, buffer);
+
+    // Exercise & Verify
+    CHECK(!unsupported.Start());
+    CHECK(unsupported.Read().empty());
+  }
+
+  SECTION("Read() returns each half once filled, in order")
+  {
+    // Setup
+    REQUIRE(stream.Start());
+
+    // Exercise & Verify
+    for (uint32_t count : { 10, 20, 30 })
+    {
+      capture.Edge(count);
+    }
+    CHECK(stream.Read().empty());
+
+    capture.Edge(40);
+    CHECK(std::vector<uint32_t>{ 10, 20, 30, 40 } == ToVector(stream.Read()));
+    CHECK(stream.Read().empty());
+
+    for (uint32_t count : { 50, 60, 70, 80 })
+    {
+      capture.Edge(count);
+    }
+    CHECK(std::vector<uint32_t>{ 50, 60, 70, 80 } == ToVector(stream.Read()));
+
+    // Wraps around to the first half.
+    for (uint32_t count : { 90, 100, 110, 120 })
+    {
+      capture.Edge(count);
+    }
+    CHECK(std::vector<uint32_t>{ 90, 100, 110, 120 } ==
+          ToVector(stream.Read()));
+    CHECK(stream.Read().empty());
+    CHECK(0 == stream.Overruns());
+  }
+
+  SECTION("Halves overwritten before they are read are skipped")
+  {
+    // Setup
+    REQUIRE(stream.Start());
+
+    // Exercise
+    // Three halves filled: the first was overwritten by the third, and the
+    // second is being overwritten by the capture.
+    for (uint32_t count = 1; count <= 12; count++)
+    {
+      capture.Edge(count);
+    }
+
+    // Verify
+    CHECK(std::vector<uint32_t>{ 9, 10, 11, 12 } == ToVector(stream.Read()));
+    CHECK(stream.Read().empty());
+    CHECK(2 == stream.Overruns());
+  }
+
+  SECTION("Halves filled before Stop() can still be read")
+  {
+    // Setup
+    REQUIRE(stream.Start());
+    for (uint32_t count = 1; count <= 4; count++)
+    {
+      capture.Edge(count);
+    }
+
+    // Exercise
+    stream.Stop();
+    capture.Edge(5);
+
+    // Verify
+    CHECK(!capture.streaming);
+    CHECK(std::vector<uint32_t>{ 1, 2, 3, 4 } == ToVector(stream.Read()));
+    CHECK(stream.Read().empty());
+  }
+}
+}  // namespace sjsu
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 #include <libcore/peripherals/inactive.hpp>
 #include <libcore/module.hpp>
+#include <libcore/utility/error_handling.hpp>
 #include <libcore/utility/math/units.hpp>
 
 namespace sjsu
@@ -36,6 +41,108 @@ class Pwm : public Module<PwmSettings_t>
   virtual float GetDutyCycle() = 0;
 };
 
+/// A set of PWM channels, typically of the same timer, whose duty cycles are
+/// updated together, such as the three phases of a motor drive.
+///
+/// Duty cycles are given in ticks of the timer that generates the waveform,
+/// where GetPeriodTicks() ticks is a 100% duty cycle, so updates need no
+/// floating point math.
+///
+/// The default implementation sets the duty cycle of each channel in turn, so
+/// a period may start between two channels being updated. Platforms with
+/// shadowed compare registers should derive from this class and override
+/// SetDutyTicks(), GetPeriodTicks() and IsSynchronized(), writing every
+/// channel's compare register before the shadow registers are latched at the
+/// next period boundary.
+///
+/// USAGE:
+///
+///    std::array<sjsu::Pwm *, 3> phases = { &phase_a, &phase_b, &phase_c };
+///    sjsu::PwmGroup group(phases);
+///
+///    const uint32_t kPeriod = group.GetPeriodTicks();
+///    group.SetDutyTicks(std::array{ kPeriod / 2, kPeriod / 4, 0u });
+class PwmGroup
+{
+ public:
+  /// Maximum number of channels that SetDutyCycles() can update at once.
+  static constexpr size_t kMaxChannels = 24;
+
+  /// Number of ticks per period used by the default implementation.
+  static constexpr uint32_t kDefaultPeriodTicks = 65535;
+
+  /// @param channels - the channels of the group, in order. Must outlive this
+  ///        object. Each channel must already be initialized.
+  explicit PwmGroup(std::span<Pwm * const> channels) : channels_(channels) {}
+
+  virtual ~PwmGroup() = default;
+
+  /// @return uint32_t - the number of timer ticks in a PWM period, which is
+  ///         the duty cycle in ticks of an always high output.
+  virtual uint32_t GetPeriodTicks()
+  {
+    return kDefaultPeriodTicks;
+  }
+
+  /// Set the duty cycle of every channel of the group at once.
+  ///
+  /// @param ticks - the high time of each channel, in order, in timer ticks.
+  ///        Values above GetPeriodTicks() are clamped. Channels past the end
+  ///        of `ticks` are left unchanged.
+  virtual void SetDutyTicks(std::span<const uint32_t> ticks)
+  {
+    const float kPeriod = static_cast<float>(GetPeriodTicks());
+    const size_t kCount = std::min(ticks.size(), channels_.size());
+    for (size_t i = 0; i < kCount; i++)
+    {
+      channels_[i]->SetDutyCycle(static_cast<float>(ticks[i]) / kPeriod);
+    }
+  }
+
+  /// @return true - if SetDutyTicks() applies every duty cycle in the same
+  ///         PWM period.
+  virtual bool IsSynchronized()
+  {
+    return false;
+  }
+
+  /// Set the duty cycle of every channel of the group at once from duty
+  /// cycles of 0.0 to 1.0, converted to ticks.
+  ///
+  /// @param duty_cycles - the duty cycle of each channel, in order. Values
+  ///        outside 0.0 and 1.0 are clamped.
+  /// @throw sjsu::Exception - std::errc::argument_list_too_long if more than
+  ///        kMaxChannels duty cycles are given.
+  void SetDutyCycles(std::span<const float> duty_cycles)
+  {
+    if (duty_cycles.size() > kMaxChannels)
+    {
+      throw Exception(std::errc::argument_list_too_long,
+                      "Too many duty cycles for a PWM group update.");
+    }
+
+    const float kPeriod = static_cast<float>(GetPeriodTicks());
+    std::array<uint32_t, kMaxChannels> ticks;
+    for (size_t i = 0; i < duty_cycles.size(); i++)
+    {
+      const float kDutyCycle = std::clamp(duty_cycles[i], 0.0f, 1.0f);
+      ticks[i] = static_cast<uint32_t>((kDutyCycle * kPeriod) + 0.5f);
+    }
+
+    SetDutyTicks(std::span<const uint32_t>(ticks.data(), duty_cycles.size()));
+  }
+
+  /// @return std::span<Pwm * const> - the channels of the group.
+  std::span<Pwm * const> Channels() const
+  {
+    return channels_;
+  }
+
+ protected:
+  /// The channels of the group, in order.
+  std::span<Pwm * const> channels_;
+};
+
 /// Template specialization that generates an inactive sjsu::Pwm.
 template <>
 inline sjsu::Pwm & GetInactive<sjsu::Pwm>()
@@ -51,7 +158,6 @@ inline sjsu::Pwm & GetInactive<sjsu::Pwm>()
     }
   };
 
-  static InactivePwm inactive;
-  return inactive;
+  return inactive_instance<InactivePwm>;
 }
 }  // namespace sjsu
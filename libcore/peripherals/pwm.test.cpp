@@ -1,10 +1,75 @@
 #include <libcore/testing/testing_frameworks.hpp>
 #include <libcore/peripherals/pwm.hpp>
 
+#include <array>
+#include <cstdint>
+#include <vector>
+
 namespace sjsu
 {
 TEST_CASE("Testing L1 pwm")
 {
   // L1 pwm is purely virtual thus test case is empty
 }
+
+TEST_CASE("Testing PwmGroup")
+{
+  Mock<Pwm> mock_phase_a;
+  Mock<Pwm> mock_phase_b;
+  Fake(Method(mock_phase_a, SetDutyCycle));
+  Fake(Method(mock_phase_b, SetDutyCycle));
+  std::array<Pwm *, 2> channels = { &mock_phase_a.get(), &mock_phase_b.get() };
+  PwmGroup group(channels);
+
+  SECTION("SetDutyTicks() sets each channel")
+  {
+    // Setup
+    constexpr uint32_t kPeriod = PwmGroup::kDefaultPeriodTicks;
+
+    // Exercise
+    group.SetDutyTicks(std::array<uint32_t, 2>{ kPeriod, kPeriod / 4 });
+
+    // Verify
+    CHECK(!group.IsSynchronized());
+    Verify(Method(mock_phase_a, SetDutyCycle).Using(1.0f));
+    Verify(Method(mock_phase_b, SetDutyCycle)
+               .Matching([](float duty_cycle) {
+                 return 0.25f == doctest::Approx(duty_cycle).epsilon(0.0001);
+               }));
+  }
+
+  SECTION("SetDutyCycles() clamps and converts to ticks")
+  {
+    // Setup
+    class TickGroup : public PwmGroup
+    {
+     public:
+      using PwmGroup::PwmGroup;
+      uint32_t GetPeriodTicks() override
+      {
+        return 1000;
+      }
+      void SetDutyTicks(std::span<const uint32_t> new_ticks) override
+      {
+        ticks.assign(new_ticks.begin(), new_ticks.end());
+      }
+      std::vector<uint32_t> ticks;
+    } tick_group(channels);
+
+    // Exercise
+    tick_group.SetDutyCycles(std::array{ 0.3333f, 1.5f, -1.0f });
+
+    // Verify
+    CHECK(tick_group.ticks == std::vector<uint32_t>{ 333, 1000, 0 });
+  }
+
+  SECTION("SetDutyCycles() rejects too many channels")
+  {
+    // Setup
+    std::array<float, PwmGroup::kMaxChannels + 1> duty_cycles = {};
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(group.SetDutyCycles(duty_cycles), Exception);
+  }
+}
 }  // namespace sjsu
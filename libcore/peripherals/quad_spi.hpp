@@ -0,0 +1,282 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include <libcore/module.hpp>
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/inactive.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/utility/enum.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/math/units.hpp>
+
+namespace sjsu
+{
+/// Generic settings for a standard Quad SPI peripheral
+struct QuadSpiSettings_t : public MemoryEqualOperator_t<QuadSpiSettings_t>
+{
+  /// Serial clock frequency
+  units::frequency::hertz_t clock_rate = 1_MHz;
+  /// The polarity of the clock when the bus is idle. Quad SPI memories
+  /// support SPI modes 0 and 3, which both sample on the leading edge.
+  SpiSettings_t::Polarity polarity = SpiSettings_t::Polarity::kIdleLow;
+};
+
+/// An abstract interface for hardware that implements Dual and Quad SPI, the
+/// command based protocol of serial NOR flash, PSRAM and some displays, which
+/// can move the address and data over 2 or 4 data lines rather than 1.
+///
+/// Every transfer is a command made of up to four phases, each optional
+/// except the instruction: an instruction byte, an address, a number of dummy
+/// cycles that give the memory time to fetch the data, and the data. Each
+/// phase has its own number of lanes, so commands are named by the lanes of
+/// each phase, such as 1-1-4 for Quad Output Fast Read (0x6B), where only the
+/// data uses four lanes.
+///
+/// USAGE:
+///
+///    // Quad Output Fast Read, 1-1-4 with 8 dummy cycles.
+///    constexpr sjsu::QuadSpi::Command_t kQuadRead = {
+///      .instruction   = 0x6B,
+///      .address_bytes = 3,
+///      .dummy_cycles  = 8,
+///      .data_lanes    = sjsu::QuadSpi::Lanes::kQuad,
+///    };
+///
+///    std::array<uint8_t, 256> page;
+///    qspi.Read(kQuadRead.At(0x1000), page);
+///
+/// @ingroup l1_peripheral
+class QuadSpi : public Module<QuadSpiSettings_t>
+{
+ public:
+  // ===========================================================================
+  // Interface Defintions
+  // ===========================================================================
+
+  /// Number of data lines a phase of a command is transferred over. The value
+  /// is the number of bits transferred per clock cycle.
+  enum class Lanes : uint8_t
+  {
+    /// One bit per cycle, on the MOSI and MISO pins of standard SPI.
+    kSingle = 1,
+    /// Two bits per cycle, on IO0 and IO1.
+    kDual = 2,
+    /// Four bits per cycle, on IO0 to IO3.
+    kQuad = 4,
+  };
+
+  /// The phases of a single command.
+  struct Command_t
+  {
+    /// @param new_address - address to access.
+    /// @return Command_t - a copy of this command, accessing `new_address`.
+    constexpr Command_t At(uint32_t new_address) const
+    {
+      Command_t command = *this;
+      command.address   = new_address;
+      return command;
+    }
+
+    /// @param data_length - number of bytes in the data phase.
+    /// @return constexpr size_t - number of clock cycles the command takes,
+    ///         for comparing the throughput of commands.
+    constexpr size_t Cycles(size_t data_length) const
+    {
+      return (8 / Value(instruction_lanes)) +
+             (address_bytes * 8 / Value(address_lanes)) + dummy_cycles +
+             (data_length * 8 / Value(data_lanes));
+    }
+
+    /// Instruction byte, such as 0x03 for Read or 0x06 for Write Enable.
+    uint8_t instruction = 0;
+    /// Lanes the instruction is sent over. Usually kSingle, except for
+    /// memories in their Quad Peripheral Interface (QPI) mode.
+    Lanes instruction_lanes = Lanes::kSingle;
+    /// Number of address bytes, 0 for commands without an address, otherwise
+    /// 3, or 4 for memories larger than 16MiB.
+    uint8_t address_bytes = 0;
+    /// Lanes the address is sent over.
+    Lanes address_lanes = Lanes::kSingle;
+    /// Address to access, sent most significant byte first.
+    uint32_t address = 0;
+    /// Clock cycles between the address and data, during which the data lines
+    /// are not driven. Includes the cycles of any mode bits, which are sent as
+    /// 0, such as the 2 mode cycles of the 6 cycles of a Quad I/O Fast Read.
+    uint8_t dummy_cycles = 0;
+    /// Lanes the data is transferred over.
+    Lanes data_lanes = Lanes::kSingle;
+  };
+
+  // ===========================================================================
+  // Interface Methods
+  // ===========================================================================
+
+  /// Perform a command that reads data from the device.
+  ///
+  /// @param command - phases of the command.
+  /// @param data - buffer to fill with the bytes read.
+  virtual void Read(const Command_t & command, std::span<uint8_t> data) = 0;
+
+  /// Perform a command that writes data to the device, or a command without
+  /// data, such as Write Enable, when `data` is empty.
+  ///
+  /// @param command - phases of the command.
+  /// @param data - bytes to write.
+  virtual void Write(const Command_t & command,
+                     std::span<const uint8_t> data) = 0;
+
+  /// Switch the peripheral into memory mapped mode, where the CPU and DMA read
+  /// the device through a region of the address space, such as for executing
+  /// code in place or drawing from a font stored in flash. The peripheral
+  /// issues `read_command` on its own for every cache line or burst that is
+  /// read, with the address set from the offset into the region.
+  ///
+  /// Read() and Write() must not be called until ExitMemoryMapped().
+  ///
+  /// The default implementation throws, for peripherals without memory
+  /// mapped mode.
+  ///
+  /// @param read_command - command used for reads, its address is ignored.
+  /// @return std::span<const uint8_t> - the memory mapped region.
+  /// @throw std::errc::operation_not_supported - if the peripheral does not
+  ///        have a memory mapped mode.
+  virtual std::span<const uint8_t> EnterMemoryMapped(
+      [[maybe_unused]] const Command_t & read_command)
+  {
+    throw Exception(std::errc::operation_not_supported,
+                    "This Quad SPI peripheral cannot memory map the device.");
+  }
+
+  /// Leave memory mapped mode, so that Read() and Write() can be used again.
+  /// Does nothing if the peripheral is not in memory mapped mode.
+  virtual void ExitMemoryMapped() {}
+
+  // ===========================================================================
+  // Helper Functions
+  // ===========================================================================
+
+  /// Send a command made of only an instruction, such as Write Enable.
+  ///
+  /// @param instruction - instruction byte.
+  void Command(uint8_t instruction)
+  {
+    Write({ .instruction = instruction }, {});
+  }
+
+  /// Read a single byte register, such as a status register.
+  ///
+  /// @param instruction - instruction byte that reads the register.
+  /// @return uint8_t - contents of the register.
+  uint8_t ReadRegister(uint8_t instruction)
+  {
+    std::array<uint8_t, 1> value = {};
+    Read({ .instruction = instruction }, value);
+    return value[0];
+  }
+};
+
+/// Performs single lane QuadSpi commands over a standard Spi peripheral and a
+/// chip select pin, so that drivers for serial memories can be written once
+/// against QuadSpi and still be used on boards that only wire up SPI.
+///
+/// Dummy cycles are sent as filler bytes, so they must be a multiple of 8.
+class SingleLaneQuadSpi : public QuadSpi
+{
+ public:
+  /// @param spi - SPI peripheral the device is attached to.
+  /// @param chip_select - chip select pin of the device. It is active LOW.
+  SingleLaneQuadSpi(Spi & spi, Gpio & chip_select)
+      : spi_(spi), chip_select_(chip_select)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    spi_.settings.clock_rate = settings.clock_rate;
+    spi_.settings.polarity   = settings.polarity;
+    spi_.settings.phase      = SpiSettings_t::Phase::kSampleLeading;
+    spi_.settings.frame_size = SpiSettings_t::FrameSize::kEightBits;
+    spi_.Initialize();
+
+    chip_select_.Initialize();
+    chip_select_.SetAsOutput();
+    chip_select_.SetHigh();
+  }
+
+  void Read(const Command_t & command, std::span<uint8_t> data) override
+  {
+    Perform(command, Spi::Segment_t{ .receive = data });
+  }
+
+  void Write(const Command_t & command,
+             std::span<const uint8_t> data) override
+  {
+    Perform(command, Spi::Segment_t{ .transmit = data });
+  }
+
+ private:
+  /// Longest header: the instruction, 4 address bytes and 255 dummy cycles.
+  static constexpr size_t kMaximumHeader = 1 + 4 + (255 / 8);
+
+  void Perform(const Command_t & command, const Spi::Segment_t & data)
+  {
+    if (command.instruction_lanes != Lanes::kSingle ||
+        command.address_lanes != Lanes::kSingle ||
+        command.data_lanes != Lanes::kSingle)
+    {
+      throw Exception(std::errc::operation_not_supported,
+                      "SPI can only perform single lane commands.");
+    }
+    if (command.dummy_cycles % 8 != 0 || command.address_bytes > 4)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Dummy cycles must be whole bytes on SPI, and addresses "
+                      "at most 4 bytes.");
+    }
+
+    std::array<uint8_t, kMaximumHeader> header;
+    size_t length    = 0;
+    header[length++] = command.instruction;
+    for (size_t i = command.address_bytes; i > 0; i--)
+    {
+      header[length++] = static_cast<uint8_t>(command.address >> ((i - 1) * 8));
+    }
+    for (size_t i = 0; i < command.dummy_cycles / 8u; i++)
+    {
+      header[length++] = Spi::kFillerByte;
+    }
+
+    const std::array<Spi::Segment_t, 2> kSegments = {
+      Spi::Segment_t{ .transmit = std::span(header.data(), length) },
+      data,
+    };
+
+    chip_select_.SetLow();
+    spi_.Transfer(kSegments);
+    chip_select_.SetHigh();
+  }
+
+  Spi & spi_;
+  Gpio & chip_select_;
+};
+
+/// Template specialization that generates an inactive sjsu::QuadSpi.
+template <>
+inline sjsu::QuadSpi & GetInactive<sjsu::QuadSpi>()
+{
+  class InactiveQuadSpi : public sjsu::QuadSpi
+  {
+   public:
+    void ModuleInitialize() override {}
+    void Read(const Command_t &, std::span<uint8_t>) override {}
+    void Write(const Command_t &, std::span<const uint8_t>) override {}
+  };
+
+  return inactive_instance<InactiveQuadSpi>;
+}
+}  // namespace sjsu
@@ -0,0 +1,167 @@
+#include <libcore/peripherals/quad_spi.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing QuadSpi::Command_t")
+{
+  constexpr QuadSpi::Command_t kRead = {
+    .instruction   = 0x03,
+    .address_bytes = 3,
+  };
+  constexpr QuadSpi::Command_t kQuadOutputRead = {
+    .instruction   = 0x6B,
+    .address_bytes = 3,
+    .dummy_cycles  = 8,
+    .data_lanes    = QuadSpi::Lanes::kQuad,
+  };
+  constexpr QuadSpi::Command_t kQuadIoRead = {
+    .instruction   = 0xEB,
+    .address_bytes = 3,
+    .address_lanes = QuadSpi::Lanes::kQuad,
+    .dummy_cycles  = 6,
+    .data_lanes    = QuadSpi::Lanes::kQuad,
+  };
+
+  SECTION("Cycles() counts every phase")
+  {
+    // Exercise & Verify
+    CHECK(8 + 24 + 2048 == kRead.Cycles(256));
+    CHECK(8 + 24 + 8 + 512 == kQuadOutputRead.Cycles(256));
+    CHECK(8 + 6 + 6 + 512 == kQuadIoRead.Cycles(256));
+  }
+
+  SECTION("Quad reads of a page take about a quarter of the cycles")
+  {
+    // Exercise & Verify
+    CHECK(kQuadIoRead.Cycles(256) * 3.5 < kRead.Cycles(256));
+  }
+
+  SECTION("At() only changes the address")
+  {
+    // Exercise
+    constexpr auto kCommand = kQuadIoRead.At(0x12'3456);
+
+    // Verify
+    CHECK(0x12'3456 == kCommand.address);
+    CHECK(0xEB == kCommand.instruction);
+    CHECK(QuadSpi::Lanes::kQuad == kCommand.address_lanes);
+  }
+}
+
+TEST_CASE("Testing SingleLaneQuadSpi")
+{
+  Mock<Spi> mock_spi;
+  std::vector<uint8_t> header;
+  std::span<uint8_t> data_receive;
+  std::span<const uint8_t> data_transmit;
+  Fake(Method(mock_spi, ModuleInitialize));
+  When(OverloadedMethod(
+           mock_spi, Transfer, void(std::span<const Spi::Segment_t>)))
+      .AlwaysDo([&](std::span<const Spi::Segment_t> segments) {
+        REQUIRE(2 == segments.size());
+        header.assign(segments[0].transmit.begin(),
+                      segments[0].transmit.end());
+        data_transmit = segments[1].transmit;
+        data_receive  = segments[1].receive;
+      });
+
+  Mock<Gpio> mock_cs;
+  Fake(Method(mock_cs, ModuleInitialize));
+  Fake(Method(mock_cs, SetDirection));
+  Fake(Method(mock_cs, Set));
+
+  SingleLaneQuadSpi qspi(mock_spi.get(), mock_cs.get());
+  qspi.settings.clock_rate = 24_MHz;
+  qspi.Initialize();
+
+  SECTION("Initialize() configures the Spi and releases chip select")
+  {
+    // Verify
+    CHECK(24_MHz == mock_spi.get().CurrentSettings().clock_rate);
+    Verify(Method(mock_cs, Set).Using(Gpio::State::kHigh));
+  }
+
+  SECTION("Read() sends the instruction, address and dummy bytes")
+  {
+    // Setup
+    std::array<uint8_t, 16> buffer;
+    mock_cs.ClearInvocationHistory();
+
+    // Exercise
+    qspi.Read({ .instruction   = 0x0B,
+                .address_bytes = 3,
+                .address       = 0x01'0203,
+                .dummy_cycles  = 8 },
+              buffer);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x0B, 0x01, 0x02, 0x03, 0xFF } == header);
+    CHECK(buffer.data() == data_receive.data());
+    CHECK(buffer.size() == data_receive.size());
+    Verify(Method(mock_cs, Set).Using(Gpio::State::kLow),
+           Method(mock_cs, Set).Using(Gpio::State::kHigh));
+  }
+
+  SECTION("Write() with 4 address bytes")
+  {
+    // Setup
+    const std::array<uint8_t, 2> kPayload = { 0xAA, 0x55 };
+
+    // Exercise
+    qspi.Write({ .instruction   = 0x12,
+                 .address_bytes = 4,
+                 .address       = 0x0102'0304 },
+               kPayload);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x12, 0x01, 0x02, 0x03, 0x04 } == header);
+    CHECK(kPayload.data() == data_transmit.data());
+  }
+
+  SECTION("Command() and ReadRegister() send only the instruction")
+  {
+    // Exercise
+    qspi.Command(0x06);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x06 } == header);
+    CHECK(data_transmit.empty());
+
+    // Exercise
+    qspi.ReadRegister(0x05);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x05 } == header);
+    CHECK(1 == data_receive.size());
+  }
+
+  SECTION("Multiple lane commands are not supported")
+  {
+    // Setup
+    std::array<uint8_t, 4> buffer;
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(
+        qspi.Read({ .instruction = 0x6B,
+                    .data_lanes  = QuadSpi::Lanes::kQuad },
+                  buffer),
+        std::errc::operation_not_supported);
+    SJ2_CHECK_EXCEPTION(
+        qspi.Read({ .instruction = 0x0B, .dummy_cycles = 6 }, buffer),
+        std::errc::invalid_argument);
+  }
+
+  SECTION("Memory mapped mode is not supported")
+  {
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(qspi.EnterMemoryMapped({ .instruction = 0x03 }),
+                        std::errc::operation_not_supported);
+  }
+}
+}  // namespace sjsu
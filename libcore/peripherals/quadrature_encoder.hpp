@@ -0,0 +1,245 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/hardware_counter.hpp>
+
+namespace sjsu
+{
+/// Extends the count of a hardware counter of up to 32 bits to 64 bits, by
+/// accumulating the signed difference between successive readings. The
+/// counter must be read at least once every half of its range, for example
+/// from the counter's overflow interrupt, or from a periodic task.
+class CountExtender
+{
+ public:
+  /// @param bits - width of the hardware counter, from 1 to 32 bits.
+  constexpr explicit CountExtender(uint8_t bits = 32)
+      : mask_((bits >= 32) ? UINT32_MAX : (uint32_t{ 1 } << bits) - 1),
+        sign_(uint32_t{ 1 } << (((bits >= 32) ? 32 : bits) - 1))
+  {
+  }
+
+  /// @param raw - the current reading of the hardware counter.
+  /// @return int64_t - the count extended to 64 bits.
+  constexpr int64_t Update(uint32_t raw)
+  {
+    // Sign extend the difference from the width of the counter.
+    const uint32_t kDifference = (raw - previous_) & mask_;
+    const int64_t kDelta       = (kDifference & sign_)
+                                     ? int64_t{ kDifference } - mask_ - 1
+                                     : int64_t{ kDifference };
+    previous_ = raw;
+    count_ += kDelta;
+    return count_;
+  }
+
+  /// @param count - the extended count to continue from.
+  /// @param raw - the current reading of the hardware counter.
+  constexpr void Reset(int64_t count, uint32_t raw)
+  {
+    count_    = count;
+    previous_ = raw;
+  }
+
+ private:
+  uint32_t mask_;
+  uint32_t sign_;
+  uint32_t previous_ = 0;
+  int64_t count_     = 0;
+};
+
+/// An abstract interface for quadrature encoders, which count up or down
+/// depending on which of their A and B signals leads the other. As the
+/// direction comes from the signals, SetDirection(CountDirection::kDown)
+/// reverses the sense of the count instead.
+///
+/// Platforms with a timer encoder mode should implement this interface so
+/// that counting happens in hardware, returning the width of their counter
+/// from GetCounterBits(). GpioQuadratureEncoder is the fallback for any pair
+/// of pins with interrupts.
+///
+/// @ingroup l1_peripheral
+class QuadratureEncoder : public HardwareCounter
+{
+ public:
+  /// @return uint8_t - width of the counter behind GetCount(), which wraps
+  ///         within this many bits.
+  virtual uint8_t GetCounterBits()
+  {
+    return 32;
+  }
+
+  /// @return std::optional<int32_t> - the count at the last index pulse, or
+  ///         std::nullopt if there is no index signal or none has been seen.
+  virtual std::optional<int32_t> GetIndexCount()
+  {
+    return std::nullopt;
+  }
+
+  /// Get the count extended to 64 bits, so that it never wraps. Must be
+  /// called at least once every half of the range of the counter, such as
+  /// every 32767 counts of a 16 bit timer. Set() changes the extended count
+  /// by as much as it changes the count.
+  ///
+  /// @return int64_t - the extended count.
+  int64_t GetExtendedCount()
+  {
+    if (!extender_)
+    {
+      extender_.emplace(GetCounterBits());
+    }
+    return extender_->Update(static_cast<uint32_t>(GetCount()));
+  }
+
+ private:
+  std::optional<CountExtender> extender_;
+};
+
+/// A QuadratureEncoder that decodes its A and B signals in software, with an
+/// interrupt on each edge of either signal, and an optional index signal.
+///
+/// Every edge is decoded with a table of the transitions between the states
+/// of the two signals, so each is counted (x4 decoding) and contact bounce
+/// cancels out. Transitions where both signals changed at once mean an edge
+/// was missed, are not counted, and are reported by GetMissedTransitions().
+///
+/// @ingroup l1_peripheral
+class GpioQuadratureEncoder : public QuadratureEncoder
+{
+ public:
+  /// @param a - the A signal.
+  /// @param b - the B signal, which lags A when counting up.
+  /// @param index - optional index signal, pulsed once per revolution.
+  /// @param pull - the pull resistor for the pins.
+  GpioQuadratureEncoder(sjsu::Gpio & a,
+                        sjsu::Gpio & b,
+                        sjsu::Gpio * index                 = nullptr,
+                        sjsu::PinSettings_t::Resistor pull =
+                            sjsu::PinSettings_t::Resistor::kPullUp)
+      : a_(a), b_(b), index_(index), pull_(pull)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    for (sjsu::Gpio * gpio : { &a_, &b_, index_ })
+    {
+      if (gpio != nullptr)
+      {
+        gpio->settings.resistor = pull_;
+        gpio->Initialize();
+        gpio->SetAsInput();
+      }
+    }
+
+    state_ = ReadState();
+    a_.AttachInterrupt([this] { Decode(); }, Gpio::Edge::kBoth);
+    b_.AttachInterrupt([this] { Decode(); }, Gpio::Edge::kBoth);
+    if (index_ != nullptr)
+    {
+      index_->AttachInterrupt(
+          [this] {
+            index_count_ = count_.load();
+            index_seen_  = true;
+          },
+          Gpio::Edge::kRising);
+    }
+  }
+
+  void ModulePowerDown() override
+  {
+    DetachInterrupts();
+  }
+
+  void Set(int32_t new_count_value) override
+  {
+    count_ = new_count_value;
+  }
+
+  void SetDirection(CountDirection direction) override
+  {
+    direction_ = direction;
+  }
+
+  int32_t GetCount() override
+  {
+    return count_;
+  }
+
+  std::optional<int32_t> GetIndexCount() override
+  {
+    if (!index_seen_)
+    {
+      return std::nullopt;
+    }
+    return index_count_.load();
+  }
+
+  /// @return uint32_t - the number of transitions where both signals changed
+  ///         at once, because an edge was missed.
+  uint32_t GetMissedTransitions() const
+  {
+    return missed_transitions_;
+  }
+
+  ~GpioQuadratureEncoder()
+  {
+    DetachInterrupts();
+  }
+
+ private:
+  /// Count change for each transition, indexed by the previous state of A and
+  /// B in bits 3 and 2 and the new state in bits 1 and 0. Counting up goes
+  /// through the states AB = 00, 10, 11, 01.
+  static constexpr std::array<int8_t, 16> kTransitions = {
+    0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0,
+  };
+
+  uint8_t ReadState()
+  {
+    return static_cast<uint8_t>((a_.Read() << 1) | b_.Read());
+  }
+
+  void Decode()
+  {
+    const uint8_t kState = ReadState();
+    const uint8_t kIndex = static_cast<uint8_t>((state_ << 2) | kState);
+
+    // Both signals changed, so the direction is unknown.
+    if ((state_ ^ kState) == 0b11)
+    {
+      missed_transitions_++;
+    }
+
+    count_ += kTransitions[kIndex] * Value(direction_.load());
+    state_ = kState;
+  }
+
+  void DetachInterrupts()
+  {
+    for (sjsu::Gpio * gpio : { &a_, &b_, index_ })
+    {
+      if (gpio != nullptr)
+      {
+        gpio->DetachInterrupt();
+      }
+    }
+  }
+
+  sjsu::Gpio & a_;
+  sjsu::Gpio & b_;
+  sjsu::Gpio * index_;
+  sjsu::PinSettings_t::Resistor pull_;
+  std::atomic<int32_t> count_               = 0;
+  std::atomic<int32_t> index_count_         = 0;
+  std::atomic<bool> index_seen_             = false;
+  std::atomic<uint32_t> missed_transitions_ = 0;
+  std::atomic<CountDirection> direction_    = CountDirection::kUp;
+  uint8_t state_                            = 0;
+};
+}  // namespace sjsu
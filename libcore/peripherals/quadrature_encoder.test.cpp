@@ -0,0 +1,132 @@
+#include <libcore/peripherals/quadrature_encoder.hpp>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing CountExtender")
+{
+  SECTION("Extends a 16 bit counter through overflow and underflow")
+  {
+    // Setup
+    CountExtender extender(16);
+
+    // Exercise & Verify
+    CHECK(30'000 == extender.Update(30'000));
+    CHECK(60'000 == extender.Update(60'000));
+    CHECK(65'536 + 10'000 == extender.Update(10'000));
+    CHECK(65'000 == extender.Update(65'000));
+    extender.Reset(0, 0);
+    CHECK(-5 == extender.Update(65'531));
+  }
+
+  SECTION("Extends a 32 bit counter")
+  {
+    // Setup
+    CountExtender extender;
+    extender.Reset(int64_t{ INT32_MAX }, INT32_MAX);
+
+    // Exercise
+    int64_t count = extender.Update(static_cast<uint32_t>(INT32_MAX) + 10);
+
+    // Verify
+    CHECK(int64_t{ INT32_MAX } + 10 == count);
+  }
+}
+
+TEST_CASE("Testing GpioQuadratureEncoder")
+{
+  // Setup
+  Mock<Gpio> mock_a;
+  Mock<Gpio> mock_b;
+  InterruptCallback a_isr;
+  InterruptCallback b_isr;
+  bool a = false;
+  bool b = false;
+  for (auto * mock : { &mock_a, &mock_b })
+  {
+    Fake(Method(*mock, Gpio::ModuleInitialize));
+    Fake(Method(*mock, Gpio::SetDirection));
+    Fake(Method(*mock, Gpio::DetachInterrupt));
+  }
+  When(Method(mock_a, Read)).AlwaysDo([&a]() { return a; });
+  When(Method(mock_b, Read)).AlwaysDo([&b]() { return b; });
+  When(Method(mock_a, AttachInterrupt))
+      .AlwaysDo([&a_isr](InterruptCallback callback, Gpio::Edge) {
+        a_isr = callback;
+      });
+  When(Method(mock_b, AttachInterrupt))
+      .AlwaysDo([&b_isr](InterruptCallback callback, Gpio::Edge) {
+        b_isr = callback;
+      });
+
+  GpioQuadratureEncoder encoder(mock_a.get(), mock_b.get());
+  encoder.Initialize();
+
+  // Turn forward through AB = 00, 10, 11, 01, 00.
+  auto forward = [&]() {
+    a = true;
+    a_isr();
+    b = true;
+    b_isr();
+    a = false;
+    a_isr();
+    b = false;
+    b_isr();
+  };
+
+  SECTION("Counts every edge in the direction of the signals")
+  {
+    // Exercise
+    forward();
+    forward();
+    // Then back by one edge, AB = 00 to 01.
+    b = true;
+    b_isr();
+
+    // Verify
+    CHECK(7 == encoder.GetCount());
+    CHECK(7 == encoder.GetExtendedCount());
+    CHECK(0 == encoder.GetMissedTransitions());
+    CHECK(!encoder.GetIndexCount());
+  }
+
+  SECTION("Bounce cancels out")
+  {
+    // Exercise
+    a = true;
+    a_isr();
+    a = false;
+    a_isr();
+    a = true;
+    a_isr();
+
+    // Verify
+    CHECK(1 == encoder.GetCount());
+  }
+
+  SECTION("SetDirection(kDown) reverses the count")
+  {
+    // Setup
+    encoder.SetDirection(HardwareCounter::CountDirection::kDown);
+
+    // Exercise
+    forward();
+
+    // Verify
+    CHECK(-4 == encoder.GetCount());
+  }
+
+  SECTION("Missed edges are not counted")
+  {
+    // Exercise
+    a = true;
+    b = true;
+    a_isr();
+
+    // Verify
+    CHECK(0 == encoder.GetCount());
+    CHECK(1 == encoder.GetMissedTransitions());
+  }
+}
+}  // namespace sjsu
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
 #include <span>
 
 #include <libcore/peripherals/inactive.hpp>
+#include <libcore/peripherals/interrupt.hpp>
 #include <libcore/module.hpp>
 #include <libcore/utility/math/units.hpp>
+#include <libcore/utility/result.hpp>
 
 namespace sjsu
 {
@@ -80,6 +84,105 @@ class Spi : public Module<SpiSettings_t>
   /// the buffer will be modified to the results of the response.
   virtual void Transfer(std::span<uint16_t> buffer) = 0;
 
+  /// Byte written to the bus when the receive buffer of a full-duplex transfer
+  /// is longer than the transmit buffer.
+  static constexpr uint8_t kFillerByte = 0xFF;
+
+  /// A single piece of a scatter/gather transfer. See
+  /// Transfer(std::span<const Segment_t>).
+  struct Segment_t
+  {
+    /// Bytes to write to the bus. May be empty, in which case kFillerByte is
+    /// sent for the length of `receive`.
+    std::span<const uint8_t> transmit = {};
+    /// Buffer to fill with the bytes read from the bus. May be empty, in which
+    /// case the bytes received are discarded.
+    std::span<uint8_t> receive = {};
+  };
+
+  /// Write 8-bit data to the SPI bus while reading the response into a
+  /// separate buffer.
+  ///
+  /// Unlike Transfer(std::span<uint8_t>), the transmit data can be const and
+  /// does not need to be copied into a scratch buffer beforehand. The number
+  /// of bytes clocked across the bus is the larger of the two buffer sizes.
+  /// Implementations with DMA should override this method to point the TX and
+  /// RX channels directly at the two buffers. On processors with a data
+  /// cache they also clean `transmit` and invalidate `receive`, see
+  /// DataCache, so callers should receive into a DmaBuffer.
+  ///
+  /// The default implementation moves the data through a small stack buffer
+  /// and the in-place Transfer(std::span<uint8_t>).
+  ///
+  /// @param transmit - bytes to write to the bus. If shorter than `receive`,
+  ///        kFillerByte is sent for the remaining bytes.
+  /// @param receive - buffer for the bytes read from the bus. Pass an empty
+  ///        span to discard the response. If shorter than `transmit`, the
+  ///        remaining response bytes are discarded.
+  virtual void Transfer(std::span<const uint8_t> transmit,
+                        std::span<uint8_t> receive)
+  {
+    std::array<uint8_t, 32> scratch;
+    const size_t length = std::max(transmit.size(), receive.size());
+
+    for (size_t position = 0; position < length; position += scratch.size())
+    {
+      const size_t chunk = std::min(scratch.size(), length - position);
+
+      for (size_t i = 0; i < chunk; i++)
+      {
+        const size_t index = position + i;
+        scratch[i] = (index < transmit.size()) ? transmit[index] : kFillerByte;
+      }
+
+      Transfer(std::span<uint8_t>(scratch.data(), chunk));
+
+      if (position < receive.size())
+      {
+        const size_t received = std::min(chunk, receive.size() - position);
+        std::copy_n(scratch.begin(), received, receive.begin() + position);
+      }
+    }
+  }
+
+  /// Perform a list of full-duplex transfers back-to-back, as a single SPI
+  /// transaction, such as a command header followed by a large payload,
+  /// without concatenating them into one buffer first. Implementations with
+  /// DMA should override this method to chain the segments with linked
+  /// descriptors.
+  ///
+  /// The default implementation calls Transfer(transmit, receive) for each
+  /// segment in order.
+  ///
+  /// @param segments - the list of segments to transfer.
+  virtual void Transfer(std::span<const Segment_t> segments)
+  {
+    for (const auto & segment : segments)
+    {
+      Transfer(segment.transmit, segment.receive);
+    }
+  }
+
+  /// Start a list of segments, as Transfer(std::span<const Segment_t>), and
+  /// return without waiting for them to finish.
+  ///
+  /// Interrupt or DMA driven implementations should override this method and
+  /// call `on_complete` from their transfer complete interrupt. The segments
+  /// and the buffers they reference must stay valid until then.
+  ///
+  /// The default implementation performs the transfer with
+  /// Transfer(std::span<const Segment_t>) and calls `on_complete` before
+  /// returning.
+  ///
+  /// @param segments - the list of segments to transfer.
+  /// @param on_complete - called once the last segment has been transferred.
+  virtual void TransferAsync(std::span<const Segment_t> segments,
+                             InterruptCallback on_complete)
+  {
+    Transfer(segments);
+    on_complete();
+  }
+
   // ===========================================================================
   // Helper Functions
   // ===========================================================================
@@ -106,11 +209,57 @@ class Spi : public Module<SpiSettings_t>
     return buffer[0];
   }
 
+  /// Transfer 8-bit data in place without throwing. See
+  /// Transfer(std::span<uint8_t>).
+  ///
+  /// @param buffer - buffer of data to write to the spi bus, replaced with the
+  ///        response.
+  /// @return Result<void> - the error thrown by the driver, if any.
+  Result<void> TryTransfer(std::span<uint8_t> buffer)
+  {
+    return Capture([this, buffer]() { Transfer(buffer); });
+  }
+
+  /// Transfer 16-bit data in place without throwing. See
+  /// Transfer(std::span<uint16_t>).
+  ///
+  /// @param buffer - buffer of data to write to the spi bus, replaced with the
+  ///        response.
+  /// @return Result<void> - the error thrown by the driver, if any.
+  Result<void> TryTransfer(std::span<uint16_t> buffer)
+  {
+    return Capture([this, buffer]() { Transfer(buffer); });
+  }
+
+  /// Full duplex transfer without throwing. See
+  /// Transfer(std::span<const uint8_t>, std::span<uint8_t>).
+  ///
+  /// @param transmit - bytes to write to the bus.
+  /// @param receive - buffer for the bytes read from the bus.
+  /// @return Result<void> - the error thrown by the driver, if any.
+  Result<void> TryTransfer(std::span<const uint8_t> transmit,
+                           std::span<uint8_t> receive)
+  {
+    return Capture(
+        [this, transmit, receive]() { Transfer(transmit, receive); });
+  }
+
+  /// Transfer a list of segments without throwing. See
+  /// Transfer(std::span<const Segment_t>).
+  ///
+  /// @param segments - the list of segments to transfer.
+  /// @return Result<void> - the error thrown by the driver, if any.
+  Result<void> TryTransfer(std::span<const Segment_t> segments)
+  {
+    return Capture([this, segments]() { Transfer(segments); });
+  }
+
   /// Transfer a const array of data and receive an array back.
   /// This function should be used only in cases where the array to be
   /// transferred is const. This method must perform a copy of the data into a
   /// mutable array before performing the transfer. This is typically optimized
-  /// away if the output of the method is not stored in a variable.
+  /// away if the output of the method is not stored in a variable. For 8-bit
+  /// data, Transfer(transmit, receive) avoids the copy entirely.
   ///
   /// Usage:
   ///
@@ -158,7 +307,6 @@ inline sjsu::Spi & GetInactive<sjsu::Spi>()
     void Transfer(std::span<uint16_t>) override {}
   };
 
-  static InactiveSpi inactive;
-  return inactive;
+  return inactive_instance<InactiveSpi>;
 }
 }  // namespace sjsu
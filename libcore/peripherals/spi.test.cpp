@@ -0,0 +1,117 @@
+#include <libcore/peripherals/spi.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+/// Spi that records every byte written to the bus and responds with the
+/// bitwise inverse of that byte.
+class InvertingSpi : public Spi
+{
+ public:
+  void ModuleInitialize() override {}
+  void Transfer(std::span<uint8_t> buffer) override
+  {
+    transfer_count++;
+    for (auto & byte : buffer)
+    {
+      sent.push_back(byte);
+      byte = static_cast<uint8_t>(~byte);
+    }
+  }
+  void Transfer(std::span<uint16_t>) override {}
+
+  using Spi::Transfer;
+
+  std::vector<uint8_t> sent;
+  int transfer_count = 0;
+};
+
+TEST_CASE("Testing L1 spi full-duplex Transfer()")
+{
+  InvertingSpi spi;
+
+  SECTION("Equal length transmit and receive")
+  {
+    // Setup
+    const std::array<uint8_t, 3> kTransmit = { 0x01, 0x02, 0x03 };
+    std::array<uint8_t, 3> receive         = {};
+
+    // Exercise
+    spi.Transfer(kTransmit, receive);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x01, 0x02, 0x03 } == spi.sent);
+    CHECK(0xFE == receive[0]);
+    CHECK(0xFD == receive[1]);
+    CHECK(0xFC == receive[2]);
+  }
+
+  SECTION("Receive longer than transmit sends filler bytes")
+  {
+    // Setup
+    const std::array<uint8_t, 1> kTransmit = { 0xA5 };
+    std::array<uint8_t, 3> receive         = {};
+
+    // Exercise
+    spi.Transfer(kTransmit, receive);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0xA5, Spi::kFillerByte, Spi::kFillerByte } ==
+          spi.sent);
+    CHECK(0x5A == receive[0]);
+    CHECK(0x00 == receive[1]);
+    CHECK(0x00 == receive[2]);
+  }
+
+  SECTION("Empty receive discards the response")
+  {
+    // Setup
+    std::array<uint8_t, 100> transmit;
+    for (size_t i = 0; i < transmit.size(); i++)
+    {
+      transmit[i] = static_cast<uint8_t>(i);
+    }
+
+    // Exercise
+    spi.Transfer(transmit, {});
+
+    // Verify
+    REQUIRE(transmit.size() == spi.sent.size());
+    CHECK(std::equal(transmit.begin(), transmit.end(), spi.sent.begin()));
+    // 100 bytes are moved through the 32 byte scratch buffer in 4 chunks.
+    CHECK(4 == spi.transfer_count);
+  }
+
+  SECTION("Scatter/gather segments")
+  {
+    // Setup
+    const std::array<uint8_t, 2> kHeader   = { 0x03, 0x10 };
+    const std::array<uint8_t, 3> kPayload  = { 0xAA, 0xBB, 0xCC };
+    std::array<uint8_t, 2> response        = {};
+    std::array<Spi::Segment_t, 3> segments = {
+      Spi::Segment_t{ .transmit = kHeader },
+      Spi::Segment_t{ .transmit = kPayload },
+      Spi::Segment_t{ .receive = response },
+    };
+
+    // Exercise
+    spi.Transfer(std::span<const Spi::Segment_t>(segments));
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0x03,
+                                0x10,
+                                0xAA,
+                                0xBB,
+                                0xCC,
+                                Spi::kFillerByte,
+                                Spi::kFillerByte } == spi.sent);
+    CHECK(0x00 == response[0]);
+    CHECK(0x00 == response[1]);
+  }
+}
+}  // namespace sjsu
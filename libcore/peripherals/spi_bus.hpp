@@ -0,0 +1,358 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <span>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/interrupt.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/utility/critical_section.hpp>
+#include <libcore/utility/ring_buffer.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Arbitrates access to a single sjsu::Spi shared by multiple devices, each
+/// with its own chip select and bus settings.
+///
+/// The bus keeps track of the settings that were last applied to the Spi
+/// peripheral and only re-initializes it when the next device needs different
+/// settings, which avoids reconfiguring the peripheral on every transfer when
+/// the same device is accessed repeatedly.
+///
+/// Transfers can either be performed immediately with Transfer() or queued
+/// with Enqueue(), from any task or interrupt, and performed in order. Queued
+/// transfers are started with Spi::TransferAsync(), and each one's completion
+/// releases its chip select, calls its `on_complete` and starts the next, so
+/// with an interrupt or DMA driven Spi the queue drains from the driver's
+/// transfer complete interrupt without being polled. With a Spi that only has
+/// the synchronous default TransferAsync(), the transfers are performed by
+/// the Enqueue() call that finds the bus idle, before it returns.
+///
+/// Devices should use the SpiDevice class rather than using this class
+/// directly.
+class SpiBus
+{
+ public:
+  /// Maximum number of transfers that can be waiting in the queue.
+  static constexpr size_t kQueueDepth = 8;
+
+  /// Information needed to perform a transfer with a device on the bus.
+  struct Request_t
+  {
+    /// Chip select pin of the device. Driven LOW for the duration of the
+    /// transfer.
+    Gpio * chip_select = nullptr;
+
+    /// Settings the Spi peripheral must have to talk to the device.
+    const SpiSettings_t * settings = nullptr;
+
+    /// List of segments to transfer while the chip select is asserted. The
+    /// segments and the buffers they reference must remain valid until the
+    /// transfer has completed.
+    std::span<const Spi::Segment_t> segments = {};
+
+    /// Called once the transfer has completed and the chip select has been
+    /// released.
+    InterruptCallback on_complete = nullptr;
+  };
+
+  /// @param spi - the Spi peripheral that all devices on this bus share. Must
+  ///        not be used directly while it is managed by this bus.
+  explicit SpiBus(Spi & spi) : spi_(spi) {}
+
+  SpiBus(const SpiBus &) = delete;
+  SpiBus & operator=(const SpiBus &) = delete;
+
+  /// Perform a transfer, blocking until it has completed.
+  ///
+  /// Waits for the transfer in flight, if any, to complete first. Queued
+  /// transfers that have not started yet are started after this one. Must not
+  /// be called from an interrupt or an `on_complete` callback, which could
+  /// wait forever for the transfer in flight.
+  ///
+  /// @param request - the transfer to perform.
+  void Transfer(const Request_t & request)
+  {
+    sjsu::Wait(std::chrono::nanoseconds::max(), [this] { return Claim(); });
+
+    try
+    {
+      ApplySettings(*request.settings);
+      request.chip_select->SetLow();
+      spi_.Transfer(request.segments);
+      request.chip_select->SetHigh();
+    }
+    catch (...)
+    {
+      request.chip_select->SetHigh();
+      StartQueued();
+      throw;
+    }
+
+    if (request.on_complete)
+    {
+      request.on_complete();
+    }
+
+    StartQueued();
+  }
+
+  /// Add a transfer to the end of the queue and start it if the bus is idle.
+  /// May be called from any task or interrupt.
+  ///
+  /// @param request - the transfer to perform.
+  /// @return true - if the transfer was added to the queue.
+  /// @return false - if the queue is full and the transfer was dropped.
+  /// @throw sjsu::Exception - any error of the Spi when it starts the
+  ///        transfer. The transfer is dropped and the bus released.
+  bool Enqueue(const Request_t & request)
+  {
+    {
+      CriticalSection lock;
+      if (!queue_.Push(request))
+      {
+        return false;
+      }
+      if (busy_)
+      {
+        // Started by the completion of the transfer in flight.
+        return true;
+      }
+      busy_ = true;
+    }
+
+    StartQueued();
+    return true;
+  }
+
+  /// @return size_t - number of transfers waiting in the queue, not counting
+  ///         the one in flight.
+  size_t Pending() const
+  {
+    CriticalSection lock;
+    return queue_.Size();
+  }
+
+  /// @return true - if a transfer is in flight.
+  bool IsBusy() const
+  {
+    CriticalSection lock;
+    return busy_;
+  }
+
+  /// @return Spi& - the Spi peripheral managed by this bus.
+  Spi & GetSpi()
+  {
+    return spi_;
+  }
+
+ private:
+  /// Take the bus for a transfer if it is idle.
+  ///
+  /// @return true - if the bus was idle and is now busy.
+  bool Claim()
+  {
+    CriticalSection lock;
+    if (busy_)
+    {
+      return false;
+    }
+    busy_ = true;
+    return true;
+  }
+
+  /// Start queued transfers until one is in flight or the queue is empty, in
+  /// which case the bus is released. Only called by the holder of the bus.
+  ///
+  /// A transfer that completes before TransferAsync() returns, as with the
+  /// default synchronous implementation, is followed by the next one in this
+  /// loop rather than from Complete(), so the stack does not grow with the
+  /// length of the queue.
+  void StartQueued()
+  {
+    while (true)
+    {
+      {
+        CriticalSection lock;
+        std::optional<Request_t> request = queue_.Pop();
+        if (!request)
+        {
+          busy_ = false;
+          return;
+        }
+        current_  = *request;
+        starting_ = true;
+        finished_ = false;
+      }
+
+      try
+      {
+        ApplySettings(*current_.settings);
+        current_.chip_select->SetLow();
+        spi_.TransferAsync(current_.segments, [this]() { Complete(); });
+      }
+      catch (...)
+      {
+        current_.chip_select->SetHigh();
+        CriticalSection lock;
+        starting_ = false;
+        busy_     = false;
+        throw;
+      }
+
+      CriticalSection lock;
+      starting_ = false;
+      if (!finished_)
+      {
+        // Complete() continues with the next transfer.
+        return;
+      }
+    }
+  }
+
+  /// Called by the Spi once the transfer in flight has completed.
+  void Complete()
+  {
+    current_.chip_select->SetHigh();
+    if (current_.on_complete)
+    {
+      current_.on_complete();
+    }
+
+    {
+      CriticalSection lock;
+      if (starting_)
+      {
+        finished_ = true;
+        return;
+      }
+    }
+
+    StartQueued();
+  }
+
+  /// Re-initialize the Spi peripheral, but only if its current settings differ
+  /// from the requested settings.
+  ///
+  /// @param settings - the settings required for the next transfer.
+  void ApplySettings(const SpiSettings_t & settings)
+  {
+    if (spi_.GetState() == State::kInitialized &&
+        spi_.CurrentSettings() == settings)
+    {
+      return;
+    }
+
+    spi_.settings = settings;
+    spi_.Initialize();
+  }
+
+  Spi & spi_;
+  RingBuffer<Request_t, kQueueDepth> queue_;
+  Request_t current_;
+  bool busy_     = false;
+  bool starting_ = false;
+  bool finished_ = false;
+};
+
+/// A device attached to a shared SpiBus that owns its own chip select pin and
+/// bus settings.
+///
+/// Usage:
+///
+///    SpiBus bus(spi);
+///    SpiDevice flash(bus, flash_cs);
+///    flash.settings.clock_rate = 4_MHz;
+///    flash.Initialize();
+///
+///    const std::array<uint8_t, 4> kReadCommand = { 0x03, 0x00, 0x10, 0x00 };
+///    std::array<uint8_t, 256> page;
+///    flash.Transfer({
+///        Spi::Segment_t{ .transmit = kReadCommand },
+///        Spi::Segment_t{ .receive = page },
+///    });
+class SpiDevice
+{
+ public:
+  /// @param bus - the bus that this device is attached to.
+  /// @param chip_select - the chip select pin of this device. It is active LOW.
+  explicit SpiDevice(SpiBus & bus, Gpio & chip_select)
+      : bus_(bus), chip_select_(chip_select)
+  {
+  }
+
+  /// Initialize the chip select pin and release it. Must be called before any
+  /// transfers. The bus settings are applied lazily on the first transfer.
+  void Initialize()
+  {
+    chip_select_.Initialize();
+    chip_select_.SetAsOutput();
+    chip_select_.SetHigh();
+  }
+
+  /// Perform a list of segments back-to-back with the chip select asserted,
+  /// blocking until complete.
+  ///
+  /// @param segments - list of segments to transfer.
+  void Transfer(std::span<const Spi::Segment_t> segments)
+  {
+    bus_.Transfer(MakeRequest(segments, nullptr));
+  }
+
+  /// Perform a list of segments back-to-back with the chip select asserted,
+  /// blocking until complete.
+  ///
+  /// @param segments - list of segments to transfer.
+  void Transfer(std::initializer_list<Spi::Segment_t> segments)
+  {
+    Transfer(std::span<const Spi::Segment_t>(segments.begin(), segments.end()));
+  }
+
+  /// Full duplex transfer with the chip select asserted. See
+  /// Spi::Transfer(std::span<const uint8_t>, std::span<uint8_t>).
+  ///
+  /// @param transmit - bytes to write to the device.
+  /// @param receive - buffer for the bytes read from the device.
+  void Transfer(std::span<const uint8_t> transmit, std::span<uint8_t> receive)
+  {
+    Transfer({ Spi::Segment_t{ .transmit = transmit, .receive = receive } });
+  }
+
+  /// Queue a list of segments to be transferred as soon as the bus is free,
+  /// see SpiBus::Enqueue().
+  ///
+  /// @param segments - list of segments to transfer. The list and the buffers
+  ///        it references must remain valid until `on_complete` is called.
+  /// @param on_complete - called once the transfer has completed, from the
+  ///        Spi's transfer complete interrupt if it has one.
+  /// @return true - if the transfer was queued.
+  /// @return false - if the bus queue is full.
+  bool TransferAsync(std::span<const Spi::Segment_t> segments,
+                     InterruptCallback on_complete = nullptr)
+  {
+    return bus_.Enqueue(MakeRequest(segments, on_complete));
+  }
+
+  /// Settings that the Spi peripheral must have when talking to this device.
+  SpiSettings_t settings;
+
+ private:
+  SpiBus::Request_t MakeRequest(std::span<const Spi::Segment_t> segments,
+                                InterruptCallback on_complete)
+  {
+    return SpiBus::Request_t{
+      .chip_select = &chip_select_,
+      .settings    = &settings,
+      .segments    = segments,
+      .on_complete = on_complete,
+    };
+  }
+
+  SpiBus & bus_;
+  Gpio & chip_select_;
+};
+}  // namespace sjsu
@@ -0,0 +1,203 @@
+#include <libcore/peripherals/spi_bus.hpp>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing SpiBus and SpiDevice")
+{
+  Mock<Spi> mock_spi;
+  Fake(Method(mock_spi, ModuleInitialize));
+  Fake(OverloadedMethod(
+      mock_spi, Transfer, void(std::span<const Spi::Segment_t>)));
+  // Runs the synchronous default unless a section simulates an interrupt
+  // driven Spi.
+  When(Method(mock_spi, TransferAsync))
+      .AlwaysDo([&mock_spi](std::span<const Spi::Segment_t> segments,
+                            InterruptCallback on_complete) {
+        mock_spi.get().Spi::TransferAsync(segments, on_complete);
+      });
+
+  Mock<Gpio> mock_cs0;
+  Fake(Method(mock_cs0, ModuleInitialize));
+  Fake(Method(mock_cs0, SetDirection));
+  Fake(Method(mock_cs0, Set));
+
+  Mock<Gpio> mock_cs1;
+  Fake(Method(mock_cs1, ModuleInitialize));
+  Fake(Method(mock_cs1, SetDirection));
+  Fake(Method(mock_cs1, Set));
+
+  SpiBus bus(mock_spi.get());
+  SpiDevice device0(bus, mock_cs0.get());
+  SpiDevice device1(bus, mock_cs1.get());
+  device1.settings.clock_rate = 1_MHz;
+
+  device0.Initialize();
+  device1.Initialize();
+
+  const std::array<uint8_t, 2> kCommand  = { 0x9F, 0x00 };
+  std::array<uint8_t, 3> response        = {};
+  std::array<Spi::Segment_t, 2> segments = {
+    Spi::Segment_t{ .transmit = kCommand },
+    Spi::Segment_t{ .receive = response },
+  };
+
+  SECTION("Initialize() releases chip select")
+  {
+    // Verify
+    Verify(Method(mock_cs0, SetDirection).Using(Gpio::Direction::kOutput),
+           Method(mock_cs0, Set).Using(Gpio::State::kHigh));
+    Verify(Method(mock_spi, ModuleInitialize)).Never();
+  }
+
+  SECTION("Transfer() asserts chip select around the transfer")
+  {
+    // Setup
+    mock_cs0.ClearInvocationHistory();
+
+    // Exercise
+    device0.Transfer(segments);
+
+    // Verify
+    Verify(Method(mock_cs0, Set).Using(Gpio::State::kLow),
+           OverloadedMethod(
+               mock_spi, Transfer, void(std::span<const Spi::Segment_t>)),
+           Method(mock_cs0, Set).Using(Gpio::State::kHigh));
+    Verify(Method(mock_cs1, Set).Using(Gpio::State::kLow)).Never();
+  }
+
+  SECTION("Settings are only applied when they change")
+  {
+    // Exercise
+    device0.Transfer(segments);
+    device0.Transfer(segments);
+    device1.Transfer(segments);
+    device1.Transfer(segments);
+    device0.Transfer(segments);
+
+    // Verify
+    Verify(Method(mock_spi, ModuleInitialize)).Exactly(3);
+    CHECK(mock_spi.get().CurrentSettings() == device0.settings);
+  }
+
+  SECTION("TransferAsync() completes before returning on a synchronous Spi")
+  {
+    // Setup
+    std::vector<int> completion_order;
+
+    // Exercise
+    CHECK(device1.TransferAsync(segments,
+                                [&]() { completion_order.push_back(1); }));
+    CHECK(device0.TransferAsync(segments,
+                                [&]() { completion_order.push_back(0); }));
+
+    // Verify
+    CHECK(0 == bus.Pending());
+    CHECK(!bus.IsBusy());
+    CHECK(std::vector<int>{ 1, 0 } == completion_order);
+    Verify(OverloadedMethod(
+               mock_spi, Transfer, void(std::span<const Spi::Segment_t>)))
+        .Twice();
+  }
+
+  SECTION("Queued transfers are started by the completion interrupt")
+  {
+    // Setup
+    std::vector<InterruptCallback> in_flight;
+    When(Method(mock_spi, TransferAsync))
+        .AlwaysDo([&in_flight](std::span<const Spi::Segment_t>,
+                               InterruptCallback on_complete) {
+          in_flight.push_back(on_complete);
+        });
+    std::vector<int> completion_order;
+    mock_cs0.ClearInvocationHistory();
+    mock_cs1.ClearInvocationHistory();
+
+    // Exercise
+    CHECK(device1.TransferAsync(segments,
+                                [&]() { completion_order.push_back(1); }));
+    CHECK(device0.TransferAsync(segments,
+                                [&]() { completion_order.push_back(0); }));
+
+    // Verify
+    REQUIRE(1 == in_flight.size());
+    CHECK(1 == bus.Pending());
+    CHECK(bus.IsBusy());
+    Verify(Method(mock_cs1, Set).Using(Gpio::State::kLow)).Once();
+    Verify(Method(mock_cs0, Set).Using(Gpio::State::kLow)).Never();
+
+    // Exercise
+    // Simulate the transfer complete interrupt of the first transfer.
+    in_flight[0]();
+
+    // Verify
+    REQUIRE(2 == in_flight.size());
+    CHECK(0 == bus.Pending());
+    CHECK(std::vector<int>{ 1 } == completion_order);
+    Verify(Method(mock_cs1, Set).Using(Gpio::State::kHigh)).Once();
+    Verify(Method(mock_cs0, Set).Using(Gpio::State::kLow)).Once();
+
+    // Exercise
+    in_flight[1]();
+
+    // Verify
+    CHECK(!bus.IsBusy());
+    CHECK(std::vector<int>{ 1, 0 } == completion_order);
+    Verify(Method(mock_cs0, Set).Using(Gpio::State::kHigh)).Once();
+  }
+
+  SECTION("Transfer() waits for the transfer in flight")
+  {
+    // Setup
+    InterruptCallback in_flight;
+    When(Method(mock_spi, TransferAsync))
+        .AlwaysDo([&in_flight](std::span<const Spi::Segment_t>,
+                               InterruptCallback on_complete) {
+          in_flight = on_complete;
+        });
+    std::vector<int> completion_order;
+    CHECK(device1.TransferAsync(segments,
+                                [&]() { completion_order.push_back(1); }));
+    // The interrupt completes the transfer in flight while Transfer() sleeps.
+    SetSleepFunction([&in_flight](std::chrono::nanoseconds) {
+      if (in_flight)
+      {
+        std::exchange(in_flight, nullptr)();
+      }
+    });
+
+    // Exercise
+    device0.Transfer(segments);
+    completion_order.push_back(0);
+
+    // Verify
+    CHECK(std::vector<int>{ 1, 0 } == completion_order);
+    CHECK(!bus.IsBusy());
+
+    // Cleanup
+    SetSleepFunction(nullptr);
+  }
+
+  SECTION("TransferAsync() fails when the queue is full")
+  {
+    // Setup
+    // Nothing completes, so the first transfer stays in flight.
+    Fake(Method(mock_spi, TransferAsync));
+    CHECK(device0.TransferAsync(segments));
+    for (size_t i = 0; i < SpiBus::kQueueDepth; i++)
+    {
+      CHECK(device0.TransferAsync(segments));
+    }
+
+    // Exercise & Verify
+    CHECK(!device0.TransferAsync(segments));
+    CHECK(SpiBus::kQueueDepth == bus.Pending());
+  }
+}
+}  // namespace sjsu
@@ -1,13 +1,19 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <span>
 #include <string>
+#include <system_error>
 
 #include <libcore/peripherals/inactive.hpp>
 #include <libcore/module.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
+#include <libcore/utility/result.hpp>
+#include <libcore/utility/time/time.hpp>
 
 namespace sjsu
 {
@@ -38,6 +44,25 @@ class Storage : public Module<>
     kFRam,
   };
 
+  /// Properties of the transfers the driver performs best, see
+  /// GetTransferHints().
+  struct TransferHints_t
+  {
+    /// Number of blocks per transfer needed to reach the full throughput of
+    /// the media, such as the blocks of a multi-block command of an SD card.
+    size_t optimal_blocks = 1;
+    /// Alignment of buffer addresses, in bytes, that the driver can transfer
+    /// directly, such as with DMA. Other buffers may be slower. DMA drivers
+    /// on processors with a data cache report kCacheLineSize, which a
+    /// DmaBuffer always meets.
+    size_t alignment = 1;
+  };
+
+  /// Called when an asynchronous operation finishes. `status` is
+  /// std::errc{} if the operation succeeded, otherwise the reason it
+  /// failed. May be called from an interrupt.
+  using CompletionHandler = InplaceFunction<void(std::errc status)>;
+
   /// @return the type of memory this driver controls. Can be called without
   ///         calling Initialize() first.
   virtual Type GetMemoryType() = 0;
@@ -89,10 +114,194 @@ class Storage : public Module<>
   /// @param data - buffer to hold the data stored in the location address.
   virtual void Read(uint32_t block_address, std::span<uint8_t> data) = 0;
 
+  /// @return TransferHints_t - the size and alignment of the transfers that
+  ///         perform best. Can be used to size buffers and caches. The
+  ///         default is one block with any alignment.
+  virtual TransferHints_t GetTransferHints()
+  {
+    return {};
+  }
+
+  /// Write several buffers to consecutive blocks as a single operation, such
+  /// as a header and a payload, without copying them into one buffer first.
+  /// Implementations with multi-block commands or DMA should override this
+  /// method to transfer the list in one command.
+  ///
+  /// Every buffer except the last must be a whole number of blocks long. The
+  /// default implementation calls Write() for each buffer in order.
+  ///
+  /// @param block_address - block to write the first buffer to.
+  /// @param buffers - the buffers, written one after the other.
+  /// @throw sjsu::Exception - std::errc::invalid_argument if a buffer before
+  ///        the last is not a whole number of blocks long.
+  virtual void Write(uint32_t block_address,
+                     std::span<const std::span<const uint8_t>> buffers)
+  {
+    ForEachBuffer(block_address, buffers, [this](uint32_t block, auto buffer) {
+      Write(block, buffer);
+    });
+  }
+
+  /// Read consecutive blocks into several buffers as a single operation. See
+  /// Write(uint32_t, std::span<const std::span<const uint8_t>>).
+  ///
+  /// @param block_address - block to read the first buffer from.
+  /// @param buffers - the buffers, filled one after the other.
+  /// @throw sjsu::Exception - std::errc::invalid_argument if a buffer before
+  ///        the last is not a whole number of blocks long.
+  virtual void Read(uint32_t block_address,
+                    std::span<const std::span<uint8_t>> buffers)
+  {
+    ForEachBuffer(block_address, buffers, [this](uint32_t block, auto buffer) {
+      Read(block, buffer);
+    });
+  }
+
+  /// Start writing several buffers to consecutive blocks, without waiting for
+  /// the write to finish. Implementations with DMA should override this
+  /// method and IsBusy().
+  ///
+  /// Neither the list nor the buffers are copied, so they must stay valid and
+  /// unmodified until `on_complete` is called or IsBusy() returns false.
+  ///
+  /// The default implementation performs the blocking Write() and calls
+  /// `on_complete` before returning, with the code of the exception it threw,
+  /// if any.
+  ///
+  /// @param block_address - block to write the first buffer to.
+  /// @param buffers - the buffers, written one after the other.
+  /// @param on_complete - called when the write has finished or failed.
+  virtual void WriteAsync(uint32_t block_address,
+                          std::span<const std::span<const uint8_t>> buffers,
+                          CompletionHandler on_complete = nullptr)
+  {
+    Complete(on_complete, [this, block_address, buffers]() {
+      Write(block_address, buffers);
+    });
+  }
+
+  /// Start reading consecutive blocks into several buffers, without waiting
+  /// for the read to finish. See WriteAsync().
+  ///
+  /// @param block_address - block to read the first buffer from.
+  /// @param buffers - the buffers, filled one after the other.
+  /// @param on_complete - called when the read has finished or failed.
+  virtual void ReadAsync(uint32_t block_address,
+                         std::span<const std::span<uint8_t>> buffers,
+                         CompletionHandler on_complete = nullptr)
+  {
+    Complete(on_complete, [this, block_address, buffers]() {
+      Read(block_address, buffers);
+    });
+  }
+
+  /// @return true - if an operation started by ReadAsync() or WriteAsync()
+  ///         has not finished yet.
+  virtual bool IsBusy()
+  {
+    return false;
+  }
+
+  /// Get a read-only view directly over the memory of a range of blocks, so
+  /// data such as fonts, images and tables can be used in place without
+  /// copying. Drivers of memory-mapped storage, such as RAM, NVRAM or NOR
+  /// flash in execute-in-place mode, should override this method.
+  ///
+  /// The view is only valid until the blocks are next erased or written, or
+  /// the storage is powered down.
+  ///
+  /// @param block_address - first block of the range.
+  /// @param blocks_count - number of blocks in the range.
+  /// @return std::span<const uint8_t> - the bytes of the range, or an empty
+  ///         span if the storage is not memory-mapped. The default
+  ///         implementation returns an empty span.
+  virtual std::span<const uint8_t> Map(
+      [[maybe_unused]] uint32_t block_address,
+      [[maybe_unused]] size_t blocks_count)
+  {
+    return {};
+  }
+
   // ===========================================================================
   // Helper Functions
   // ===========================================================================
 
+  /// Block until the operation started by ReadAsync() or WriteAsync() has
+  /// finished or the timeout has elapsed.
+  ///
+  /// @param timeout - maximum amount of time to wait.
+  /// @return true - if the operation finished before the timeout.
+  bool WaitForCompletion(
+      std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max())
+  {
+    if (!IsBusy())
+    {
+      return true;
+    }
+    return Wait(timeout, [this]() -> bool { return !IsBusy(); });
+  }
+
+  /// Get a view of data starting at a block, directly over the memory of the
+  /// storage if it is memory-mapped, otherwise by reading it into `buffer`.
+  ///
+  /// @param block_address - first block of the data.
+  /// @param buffer - where to read the data if the storage is not
+  ///        memory-mapped. Its size is the size of the data.
+  /// @return std::span<const uint8_t> - a view of the data, of the size of
+  ///         `buffer`.
+  std::span<const uint8_t> View(uint32_t block_address,
+                                std::span<uint8_t> buffer)
+  {
+    const size_t kBlockSize = GetBlockSize().to<size_t>();
+    const size_t kBlocks =
+        (kBlockSize == 0) ? 0 : (buffer.size() + kBlockSize - 1) / kBlockSize;
+
+    auto mapped = Map(block_address, kBlocks);
+    if (mapped.size() >= buffer.size())
+    {
+      return mapped.first(buffer.size());
+    }
+
+    Read(block_address, buffer);
+    return buffer;
+  }
+
+  /// Erase blocks without throwing. See Erase().
+  ///
+  /// @param block_address - starting block to erase.
+  /// @param blocks_count - the number of blocks to erase.
+  /// @return Result<void> - the error thrown by the driver, if any.
+  Result<void> TryErase(uint32_t block_address, size_t blocks_count)
+  {
+    return Capture([this, block_address, blocks_count]() {
+      Erase(block_address, blocks_count);
+    });
+  }
+
+  /// Write data without throwing. See Write().
+  ///
+  /// @param block_address - starting block to write to.
+  /// @param data - buffer of data to be stored in the location addressed.
+  /// @return Result<void> - the error thrown by the driver, if any.
+  Result<void> TryWrite(uint32_t block_address, std::span<const uint8_t> data)
+  {
+    return Capture([this, block_address, data]() {
+      Write(block_address, data);
+    });
+  }
+
+  /// Read data without throwing. See Read().
+  ///
+  /// @param block_address - starting block to read from.
+  /// @param data - buffer to hold the data stored in the location address.
+  /// @return Result<void> - the error thrown by the driver, if any.
+  Result<void> TryRead(uint32_t block_address, std::span<uint8_t> data)
+  {
+    return Capture([this, block_address, data]() {
+      Read(block_address, data);
+    });
+  }
+
   /// Helper function that overloads the Write function to allow usage of the
   /// std::string_view container.
   ///
@@ -104,6 +313,41 @@ class Storage : public Module<>
 
     Write(block_address, std::span(pointer, data.size()));
   }
+
+ private:
+  template <typename Buffer, typename Operation>
+  void ForEachBuffer(uint32_t block_address,
+                     std::span<const Buffer> buffers,
+                     Operation operation)
+  {
+    const size_t kBlockSize = GetBlockSize().to<size_t>();
+
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+      const bool kLast = (i + 1 == buffers.size());
+      if (!kLast && kBlockSize != 0 && buffers[i].size() % kBlockSize != 0)
+      {
+        throw Exception(std::errc::invalid_argument,
+                        "Only the last buffer can end part way into a block.");
+      }
+
+      operation(block_address, buffers[i]);
+      if (kBlockSize != 0)
+      {
+        block_address += static_cast<uint32_t>(buffers[i].size() / kBlockSize);
+      }
+    }
+  }
+
+  template <typename Operation>
+  void Complete(CompletionHandler & on_complete, Operation operation)
+  {
+    const std::errc kStatus = Capture(operation).GetCode();
+    if (on_complete)
+    {
+      on_complete(kStatus);
+    }
+  }
 };
 
 /// Template specialization that generates an inactive sjsu::Uart.
@@ -141,7 +385,6 @@ inline sjsu::Storage & GetInactive<sjsu::Storage>()
     void Read(uint32_t, std::span<uint8_t>) override {}
   };
 
-  static InactiveStorage inactive;
-  return inactive;
+  return inactive_instance<InactiveStorage>;
 }
 }  // namespace sjsu
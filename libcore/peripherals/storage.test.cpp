@@ -0,0 +1,115 @@
+#include <libcore/peripherals/storage.hpp>
+
+#include <array>
+#include <vector>
+
+#include <libcore/testing/ram_storage.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing Storage Interface")
+{
+  testing::RamStorage test_subject(
+      { .block_size = 2, .blocks = 4, .record = true });
+  using Access_t = testing::RamStorage::Access_t;
+  const std::array<uint8_t, 2> kHeader = { 1, 2 };
+  const std::array<uint8_t, 3> kPayload = { 3, 4, 5 };
+  const std::span<const uint8_t> kBuffers[] = { kHeader, kPayload };
+
+  SECTION("Writing a list of buffers writes them to consecutive blocks")
+  {
+    // Exercise
+    test_subject.Write(1, kBuffers);
+
+    // Verify
+    CHECK(test_subject.accesses ==
+          std::vector<Access_t>{ { 'w', 1, 1 }, { 'w', 2, 2 } });
+    CHECK(test_subject.memory ==
+          std::vector<uint8_t>{ 0, 0, 1, 2, 3, 4, 5, 0 });
+  }
+
+  SECTION("Reading into a list of buffers fills them in order")
+  {
+    // Setup
+    test_subject.memory = { 0, 0, 9, 8, 7, 6, 5, 0 };
+    std::array<uint8_t, 2> header;
+    std::array<uint8_t, 3> payload;
+    const std::span<uint8_t> kReadBuffers[] = { header, payload };
+
+    // Exercise
+    test_subject.Read(1, kReadBuffers);
+
+    // Verify
+    CHECK(header == std::array<uint8_t, 2>{ 9, 8 });
+    CHECK(payload == std::array<uint8_t, 3>{ 7, 6, 5 });
+  }
+
+  SECTION("Only the last buffer may end part way into a block")
+  {
+    // Setup
+    const std::span<const uint8_t> kUneven[] = { kPayload, kHeader };
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.Write(0, kUneven), sjsu::Exception);
+  }
+
+  SECTION("WriteAsync() reports the result to the completion handler")
+  {
+    // Setup
+    std::vector<std::errc> results;
+    auto handler = [&results](std::errc status) { results.push_back(status); };
+
+    // Exercise
+    test_subject.WriteAsync(0, kBuffers, handler);
+    test_subject.WriteAsync(3, kBuffers, handler);
+
+    // Verify
+    CHECK(!test_subject.IsBusy());
+    CHECK(test_subject.WaitForCompletion());
+    CHECK(results == std::vector<std::errc>{
+                         std::errc{}, std::errc::result_out_of_range });
+  }
+
+  SECTION("View() reads into the buffer if the storage is not mapped")
+  {
+    // Setup
+    test_subject.memory = { 0, 0, 9, 8, 7, 6, 5, 0 };
+    std::array<uint8_t, 3> buffer;
+
+    // Exercise
+    auto view = test_subject.View(1, buffer);
+
+    // Verify
+    CHECK(test_subject.Map(1, 2).empty());
+    CHECK(view.data() == buffer.data());
+    CHECK(buffer == std::array<uint8_t, 3>{ 9, 8, 7 });
+  }
+
+  SECTION("View() points into the memory of a mapped storage")
+  {
+    // Setup
+    testing::RamStorage mapped(
+        { .block_size = 2, .blocks = 4, .mappable = true, .record = true });
+    std::array<uint8_t, 3> buffer{};
+
+    // Exercise
+    auto view = mapped.View(1, buffer);
+
+    // Verify
+    CHECK(view.data() == &mapped.memory[2]);
+    CHECK(3 == view.size());
+    CHECK(mapped.accesses.empty());
+  }
+
+  SECTION("The default transfer hints are a block at any alignment")
+  {
+    // Exercise
+    auto hints = test_subject.GetTransferHints();
+
+    // Verify
+    CHECK(1 == hints.optimal_blocks);
+    CHECK(1 == hints.alignment);
+  }
+}
+}  // namespace sjsu
@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <libcore/peripherals/inactive.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
 #include <libcore/platform/constants.hpp>
 
@@ -137,6 +138,69 @@ class SystemController
   {
     return *reinterpret_cast<ClockConfiguration *>(GetClockConfiguration());
   }
+
+  // ===========================================================================
+  // Clock Change Notifications
+  // ===========================================================================
+
+  /// Calls a function each time the system's clocks change, for as long as
+  /// the listener exists. Modules whose timing is derived from a clock rate
+  /// use it to derive their dividers again, so that baud rates and
+  /// frequencies stay the same while the clocks are scaled:
+  ///
+  ///    sjsu::SystemController::ClockChangeListener uart_retiming(
+  ///        [&uart]() { uart.Reinitialize(); });
+  class ClockChangeListener
+  {
+   public:
+    /// Function called after the clocks change.
+    using Callback = InplaceFunction<void()>;
+
+    /// @param callback - function to call after each clock change.
+    explicit ClockChangeListener(Callback callback)
+        : callback_(callback), next_(clock_change_listeners)
+    {
+      clock_change_listeners = this;
+    }
+
+    ClockChangeListener(const ClockChangeListener &) = delete;
+    ClockChangeListener & operator=(const ClockChangeListener &) = delete;
+
+    ~ClockChangeListener()
+    {
+      for (ClockChangeListener ** listener = &clock_change_listeners;
+           *listener != nullptr;
+           listener = &(*listener)->next_)
+      {
+        if (*listener == this)
+        {
+          *listener = next_;
+          break;
+        }
+      }
+    }
+
+   private:
+    friend class SystemController;
+
+    Callback callback_;
+    ClockChangeListener * next_;
+  };
+
+  /// Call every ClockChangeListener. Must be called whenever the system's
+  /// clocks have changed, once GetClockRate() reports the new rates.
+  static void NotifyClockChange()
+  {
+    for (auto * listener = clock_change_listeners; listener != nullptr;
+         listener        = listener->next_)
+    {
+      listener->callback_();
+    }
+  }
+
+ private:
+  /// Listeners called by NotifyClockChange(), most recently created first.
+  static inline ClockChangeListener * clock_change_listeners = nullptr;
 };
 
 /// Template specialization that generates an inactive sjsu::SystemController.
@@ -163,7 +227,6 @@ inline sjsu::SystemController & GetInactive<sjsu::SystemController>()
     void PowerDownPeripheral(ResourceID) const override {}
   };
 
-  static InactiveSystemController inactive;
-  return inactive;
+  return inactive_instance<InactiveSystemController>;
 }
 }  // namespace sjsu
@@ -2,6 +2,7 @@
 // up the SystemTimer.
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <libcore/module.hpp>
 #include <libcore/peripherals/inactive.hpp>
@@ -31,6 +32,27 @@ struct SystemTimerSettings_t
 /// @ingroup l1_peripheral
 class SystemTimer : public Module<SystemTimerSettings_t>
 {
+ public:
+  // ===========================================================================
+  // Interface Methods
+  // ===========================================================================
+
+  /// Program a one shot interrupt at `deadline`, to wake the processor from
+  /// sleep, in addition to the periodic callback. Used by tickless waits, see
+  /// EnableTicklessWait().
+  ///
+  /// Implementations that can should override this method. Each call replaces
+  /// the previous wake up.
+  ///
+  /// @param deadline - uptime at which to interrupt.
+  /// @return true - if the wake up was scheduled.
+  /// @return false - if the system timer does not support one shot wake ups.
+  ///         The processor will still be woken by the periodic callback.
+  virtual bool ScheduleWakeUp(
+      [[maybe_unused]] std::chrono::nanoseconds deadline)
+  {
+    return false;
+  }
 };
 
 /// Template specialization that generates an inactive sjsu::SystemTimer.
@@ -43,6 +65,8 @@ inline sjsu::SystemTimer & GetInactive<sjsu::SystemTimer>()
     void ModuleInitialize() override {}
   };
 
+  // Not constant initialized, as the default callback of its settings is a
+  // lambda, which InplaceFunction cannot store in a constant expression.
   static InactiveSystemTimer inactive;
   return inactive;
 }
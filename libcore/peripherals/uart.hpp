@@ -1,13 +1,17 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <initializer_list>
 #include <libcore/module.hpp>
 #include <libcore/peripherals/inactive.hpp>
+#include <libcore/peripherals/interrupt.hpp>
+#include <libcore/utility/error_handling.hpp>
 #include <libcore/utility/time/time.hpp>
 #include <limits>
 #include <span>
 #include <string_view>
+#include <system_error>
 
 namespace sjsu
 {
@@ -42,6 +46,29 @@ struct UartSettings_t : public MemoryEqualOperator_t<UartSettings_t>
     kEven,
   };
 
+  /// Multidrop addressing of a shared bus such as RS-485, where 9-bit frames
+  /// with the 9th bit set carry the address of the node the following data
+  /// frames are for. Requires FrameSize::kNineBits.
+  enum class AddressMatch : uint8_t
+  {
+    /// Every frame is received.
+    kDisabled = 0,
+    /// The receiver stays muted, without storing frames or raising
+    /// interrupts, until an address frame for this node arrives, see
+    /// IsAddressedToNode(). It then receives the data frames that follow,
+    /// until the next address frame for another node mutes it again. The
+    /// address frame itself is not returned by Read().
+    kNodeAddress,
+  };
+
+  /// @param address - address carried by an address frame.
+  /// @return true - if the bits of `address` selected by `address_mask`
+  ///         match those of `node_address`.
+  constexpr bool IsAddressedToNode(uint8_t address) const
+  {
+    return ((address ^ node_address) & address_mask) == 0;
+  }
+
   /// The operating baud rate (speed) of the UART signals.
   uint32_t baud_rate = 9600;
 
@@ -53,6 +80,17 @@ struct UartSettings_t : public MemoryEqualOperator_t<UartSettings_t>
 
   /// The parity bit settings for UART.
   Parity parity = Parity::kNone;
+
+  /// Multidrop addressing mode of the receiver.
+  AddressMatch address_match = AddressMatch::kDisabled;
+
+  /// Address of this node on a multidrop bus.
+  uint8_t node_address = 0;
+
+  /// Bits of the address compared with `node_address`. Clearing low bits
+  /// lets a node also answer to a group or broadcast address. Controllers
+  /// that only compare some of the bits, such as 4 or 7, use the low bits.
+  uint8_t address_mask = 0xFF;
 };
 
 /// An abstract interface for hardware that implements the Universal
@@ -85,12 +123,95 @@ class Uart : public Module<UartSettings_t>
   ///
   /// The default implementation reads out all of the bytes by checking
   /// HasData() repeatedly and use Read() to read each. Some implementations may
-  /// have more efficient methods of clearing their buffers.
+  /// have more efficient methods of clearing their buffers, such as a driver
+  /// backed by a RingBuffer calling RingBuffer::Clear().
   virtual void Flush()
   {
     PollingFlush();
   }
 
+  /// Access received bytes in place without copying them out of the driver.
+  ///
+  /// Drivers that buffer received bytes in memory, for example an ISR filling
+  /// a sjsu::RingBuffer, should override this method to return the largest
+  /// contiguous region of unread bytes. Bytes remain valid and are returned by
+  /// subsequent calls until released with ConsumeReceived().
+  ///
+  /// The default implementation returns an empty span, meaning the driver does
+  /// not support zero-copy access and Read() must be used instead.
+  ///
+  /// @return std::span<const uint8_t> - contiguous region of unread bytes.
+  virtual std::span<const uint8_t> PeekReceived()
+  {
+    return {};
+  }
+
+  /// Release bytes returned by PeekReceived() back to the driver.
+  ///
+  /// @param count - number of bytes from the front of the receive buffer to
+  ///        discard.
+  virtual void ConsumeReceived([[maybe_unused]] size_t count) {}
+
+  /// Start transmitting bytes via the UART port TX line and return
+  /// immediately, without waiting for the bytes to leave the peripheral.
+  /// Implementations that have DMA or a transmit interrupt should override
+  /// this method and IsWriteInProgress().
+  ///
+  /// The contents of `data` are NOT copied. The buffer must remain valid and
+  /// unmodified until the `on_complete` callback has been called or
+  /// IsWriteInProgress() returns false. DMA based drivers clean `data` from
+  /// the data cache with DataCache::Clean() before starting.
+  ///
+  /// The default implementation performs a blocking Write() and then calls
+  /// `on_complete` before returning, which allows code written against the
+  /// asynchronous API to work on drivers that can only poll.
+  ///
+  /// @param data - buffer of bytes to write to the uart serial port.
+  /// @param on_complete - callback executed when the last byte of `data` has
+  ///        been handed to the hardware. For DMA/interrupt based drivers, this
+  ///        is called from interrupt context.
+  virtual void WriteAsync(std::span<const uint8_t> data,
+                          InterruptCallback on_complete = nullptr)
+  {
+    Write(data);
+    if (on_complete)
+    {
+      on_complete();
+    }
+  }
+
+  /// @return true - if a transfer started by WriteAsync() has not finished
+  ///         yet.
+  /// @return false - if the port is ready to accept another WriteAsync().
+  virtual bool IsWriteInProgress()
+  {
+    return false;
+  }
+
+  /// Send an address frame, a 9-bit frame with the 9th bit set, selecting
+  /// which node of a multidrop bus receives the data frames written after
+  /// it. Data written with Write() is sent with the 9th bit clear.
+  ///
+  /// Drivers that support 9-bit frames override this, along with muting the
+  /// receiver when `settings.address_match` is enabled. They throw
+  /// std::errc::invalid_argument from ModuleInitialize() if address matching
+  /// is enabled without FrameSize::kNineBits.
+  ///
+  /// @param address - address of the node to select.
+  /// @throw std::errc::operation_not_supported - if the driver does not
+  ///        support 9-bit multidrop addressing.
+  virtual void WriteAddress([[maybe_unused]] uint8_t address)
+  {
+    throw Exception(std::errc::operation_not_supported,
+                    "This UART does not support multidrop addressing.");
+  }
+
+  /// Mute the receiver until the next address frame for this node, skipping
+  /// the rest of the current message, such as once a node has read the part
+  /// of a message it needs. Does nothing when `settings.address_match` is
+  /// kDisabled or the driver does not support multidrop addressing.
+  virtual void Mute() {}
+
   // ===========================================================================
   // Helper Functions
   // ===========================================================================
@@ -132,6 +253,44 @@ class Uart : public Module<UartSettings_t>
     Write(std::span(start, data.size()));
   }
 
+  /// Start transmitting the characters of a string_view without blocking. See
+  /// WriteAsync(std::span<const uint8_t>, InterruptCallback).
+  ///
+  /// @param str - characters to send. Must outlive the transfer.
+  /// @param on_complete - callback executed when the transfer completes.
+  void WriteAsync(std::string_view str, InterruptCallback on_complete = nullptr)
+  {
+    std::span span(reinterpret_cast<const uint8_t *>(str.data()), str.size());
+    WriteAsync(span, on_complete);
+  }
+
+  /// Start transmitting std::bytes without blocking. See
+  /// WriteAsync(std::span<const uint8_t>, InterruptCallback).
+  ///
+  /// @param data - bytes to send. Must outlive the transfer.
+  /// @param on_complete - callback executed when the transfer completes.
+  void WriteAsync(std::span<const std::byte> data,
+                  InterruptCallback on_complete = nullptr)
+  {
+    auto start = reinterpret_cast<const uint8_t *>(data.data());
+    WriteAsync(std::span(start, data.size()), on_complete);
+  }
+
+  /// Block until the transfer started by WriteAsync() has completed or the
+  /// timeout has elapsed.
+  ///
+  /// @param timeout - maximum amount of time to wait for the transfer.
+  /// @return true - if the transfer finished before the timeout.
+  bool WaitForWrite(
+      std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max())
+  {
+    if (!IsWriteInProgress())
+    {
+      return true;
+    }
+    return Wait(timeout, [this]() -> bool { return !IsWriteInProgress(); });
+  }
+
   /// @return Retrieves a single byte from UART RX line. Users must ensure that
   /// HasData() is true before reading using this method. Otherwise contents of
   /// read data will not be correct and the returned byte will be 0xFF.
@@ -159,24 +318,31 @@ class Uart : public Module<UartSettings_t>
 
   /// Will flush all bytes currently head with the UART peripherals buffers.
   ///
-  /// by checking HasData() repeatedly and use Read() to read each. Some
+  /// Reads out all of the bytes by checking HasData() repeatedly and using
+  /// Read() to drain as many buffered bytes as possible with each call. Some
   /// implementations may have more efficient methods of clearing their buffers.
   void PollingFlush()
   {
+    std::array<uint8_t, 32> discard;
     while (HasData())
     {
-      Read();
+      Read(discard);
     }
   }
 
   /// This method will handle waiting for bytes to be received via UART for the
   /// duration of the timeout.
   ///
+  /// The default implementation polls Read() until the buffer is full or the
+  /// timeout elapses. Implementations that can sleep until data arrives, such
+  /// as one running on an operating system, should override this method.
+  ///
   /// @param data - buffer to read bytes into.
   /// @param timeout - duration to wait for incoming data before timeout.
   /// @return std::errc::timed_out if bytes could not be read before before
   ///         timeout.
-  size_t Read(std::span<uint8_t> data, std::chrono::nanoseconds timeout)
+  virtual size_t Read(std::span<uint8_t> data,
+                      std::chrono::nanoseconds timeout)
   {
     size_t position = 0;
 
@@ -212,7 +378,6 @@ inline sjsu::Uart & GetInactive<sjsu::Uart>()
     }
   };
 
-  static InactiveUart inactive;
-  return inactive;
+  return inactive_instance<InactiveUart>;
 }
 }  // namespace sjsu
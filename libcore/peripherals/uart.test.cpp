@@ -2,11 +2,34 @@
 
 #include <algorithm>
 #include <array>
+#include <vector>
 
 #include <libcore/testing/testing_frameworks.hpp>
 
 namespace sjsu
 {
+/// Minimal Uart that leaves WriteAsync() and IsWriteInProgress() to their
+/// default implementations.
+class PollingOnlyUart : public Uart
+{
+ public:
+  void ModuleInitialize() override {}
+  bool HasData() override
+  {
+    return false;
+  }
+  void Write(std::span<const uint8_t> data) override
+  {
+    written.insert(written.end(), data.begin(), data.end());
+  }
+  size_t Read(std::span<uint8_t>) override
+  {
+    return 0;
+  }
+
+  std::vector<uint8_t> written;
+};
+
 TEST_CASE("Testing L1 uart")
 {
   Mock<Uart> mock_uart;
@@ -14,6 +37,15 @@ TEST_CASE("Testing L1 uart")
   Fake(OverloadedMethod(mock_uart, Read, size_t(std::span<uint8_t>)));
   Fake(Method(mock_uart, HasData));
   Uart & uart = mock_uart.get();
+  // Read() with a timeout runs the default implementation, which polls the
+  // faked Read().
+  When(OverloadedMethod(mock_uart,
+                        Read,
+                        size_t(std::span<uint8_t>, std::chrono::nanoseconds)))
+      .AlwaysDo([&uart](std::span<uint8_t> data,
+                        std::chrono::nanoseconds timeout) -> size_t {
+        return uart.Uart::Read(data, timeout);
+      });
 
   SECTION("Write() Byte")
   {
@@ -177,5 +209,110 @@ TEST_CASE("Testing L1 uart")
     CHECK(0xCC == bytes[2]);
     CHECK(0x00 == bytes[3]);
   }
+
+  SECTION("WriteAsync() string_view")
+  {
+    // Setup
+    std::string_view expected_payload = "Hello";
+    const uint8_t * actual_address    = nullptr;
+    size_t actual_length              = 0;
+    When(OverloadedMethod(mock_uart,
+                          WriteAsync,
+                          void(std::span<const uint8_t>, InterruptCallback)))
+        .Do([&](std::span<const uint8_t> data, InterruptCallback) -> void {
+          actual_address = data.data();
+          actual_length  = data.size();
+        });
+
+    // Exercise
+    uart.WriteAsync(expected_payload);
+
+    // Verify
+    CHECK(reinterpret_cast<const uint8_t *>(expected_payload.data()) ==
+          actual_address);
+    CHECK(expected_payload.size() == actual_length);
+  }
+
+  SECTION("WaitForWrite()")
+  {
+    // Setup
+    int poll_count = 0;
+    When(Method(mock_uart, IsWriteInProgress))
+        .AlwaysDo([&poll_count]() -> bool { return poll_count++ < 3; });
+
+    // Exercise
+    bool completed = uart.WaitForWrite(1s);
+
+    // Verify
+    CHECK(completed);
+    CHECK(4 == poll_count);
+  }
+
+  SECTION("WaitForWrite() timeout")
+  {
+    // Setup
+    When(Method(mock_uart, IsWriteInProgress)).AlwaysReturn(true);
+
+    // Exercise
+    bool completed = uart.WaitForWrite(10us);
+
+    // Verify
+    CHECK(!completed);
+  }
+}
+
+TEST_CASE("Testing L1 uart default WriteAsync()")
+{
+  // Setup
+  PollingOnlyUart uart;
+  std::array<uint8_t, 3> payload = { 0x11, 0x22, 0x33 };
+  bool callback_called           = false;
+
+  // Exercise
+  uart.WriteAsync(payload, [&callback_called]() { callback_called = true; });
+
+  // Verify
+  CHECK(callback_called);
+  CHECK(!uart.IsWriteInProgress());
+  CHECK(uart.WaitForWrite());
+  CHECK(std::vector<uint8_t>(payload.begin(), payload.end()) == uart.written);
+}
+
+TEST_CASE("Testing L1 uart multidrop addressing")
+{
+  UartSettings_t settings;
+  settings.node_address = 0x23;
+
+  SECTION("IsAddressedToNode() compares the whole address by default")
+  {
+    // Exercise & Verify
+    CHECK(settings.IsAddressedToNode(0x23));
+    CHECK(!settings.IsAddressedToNode(0x22));
+    CHECK(!settings.IsAddressedToNode(0xA3));
+  }
+
+  SECTION("IsAddressedToNode() ignores bits cleared in the mask")
+  {
+    // Setup
+    // Answer to every address of the group 0x20 to 0x2F.
+    settings.address_mask = 0xF0;
+
+    // Exercise & Verify
+    CHECK(settings.IsAddressedToNode(0x20));
+    CHECK(settings.IsAddressedToNode(0x2F));
+    CHECK(!settings.IsAddressedToNode(0x33));
+  }
+
+  SECTION("Drivers without 9-bit frames cannot send addresses")
+  {
+    // Setup
+    PollingOnlyUart uart;
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(uart.WriteAddress(0x23),
+                        std::errc::operation_not_supported);
+    uart.Mute();
+    CHECK(uart.written.empty());
+  }
 }
 }  // namespace sjsu
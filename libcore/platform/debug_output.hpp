@@ -0,0 +1,301 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+
+namespace sjsu
+{
+/// Output through a stimulus port of the ARM Instrumentation Trace Macrocell
+/// (ITM), which the debug probe receives over the Serial Wire Output (SWO)
+/// pin.
+///
+/// Unlike semihosting, which halts the core until the debugger has serviced
+/// each call, writing to a stimulus port costs a few cycles per word and the
+/// CPU keeps running. Bytes are written a word at a time where possible, which
+/// SWO viewers split back into bytes.
+///
+/// When the ITM or the stimulus port is disabled, for example because no
+/// debugger has configured SWO, writes are dropped rather than blocking. The
+/// ITM is only available on Cortex-M3 and above.
+///
+/// USAGE:
+///
+///    sjsu::Itm itm;
+///    sjsu::SysCallManager::Get().AddWriter(itm.Writer());
+class Itm
+{
+ public:
+  /// Memory map of the ITM registers.
+  struct Registers_t
+  {
+    /// Stimulus ports. Reading a port returns 1 when it can accept a write.
+    volatile uint32_t port[32];
+    uint32_t reserved0[864];
+    /// Trace Enable Register, one enable bit per stimulus port.
+    volatile uint32_t ter;
+    uint32_t reserved1[15];
+    /// Trace Privilege Register.
+    volatile uint32_t tpr;
+    uint32_t reserved2[15];
+    /// Trace Control Register.
+    volatile uint32_t tcr;
+  };
+
+  /// Address of the ITM on every Cortex-M that has one.
+  static constexpr uintptr_t kAddress = 0xE000'0000;
+
+  /// Bit of the Trace Control Register that enables the ITM.
+  static constexpr uint32_t kItmEnable = 1 << 0;
+
+  /// Stimulus port used for text output by convention.
+  static constexpr uint8_t kTextPort = 0;
+
+  /// @param port - stimulus port to write to, 0 to 31.
+  /// @param registers - the ITM registers. Only tests need to change this.
+  explicit Itm(uint8_t port = kTextPort, Registers_t * registers = Hardware())
+      : port_(port & 0x1F), registers_(registers)
+  {
+  }
+
+  /// @return true - if the debugger has enabled the ITM and this port.
+  bool IsEnabled() const
+  {
+    return (registers_->tcr & kItmEnable) &&
+           (registers_->ter & (uint32_t{ 1 } << port_));
+  }
+
+  /// Write bytes to the stimulus port, waiting only for the port's FIFO.
+  ///
+  /// @param data - bytes to write.
+  /// @return size_t - number of bytes written, which is 0 if the port is not
+  ///         enabled.
+  size_t Write(std::span<const uint8_t> data)
+  {
+    if (!IsEnabled())
+    {
+      return 0;
+    }
+
+    volatile uint32_t & port = registers_->port[port_];
+    size_t i                 = 0;
+
+    for (; i + sizeof(uint32_t) <= data.size(); i += sizeof(uint32_t))
+    {
+      uint32_t word;
+      memcpy(&word, &data[i], sizeof(word));
+      WaitUntilReady(port);
+      port = word;
+    }
+
+    for (; i < data.size(); i++)
+    {
+      WaitUntilReady(port);
+      *reinterpret_cast<volatile uint8_t *>(&port) = data[i];
+    }
+
+    return data.size();
+  }
+
+  /// @return a writer for SysCall::AddWriter() that writes to this port.
+  auto Writer()
+  {
+    return [this](FILE *, const char * buffer, int length) -> int {
+      Write(std::span(reinterpret_cast<const uint8_t *>(buffer),
+                      static_cast<size_t>(length)));
+      return length;
+    };
+  }
+
+ private:
+  static Registers_t * Hardware()
+  {
+    return reinterpret_cast<Registers_t *>(kAddress);
+  }
+
+  static void WaitUntilReady(volatile uint32_t & port)
+  {
+    while (port == 0)
+    {
+      continue;
+    }
+  }
+
+  uint8_t port_;
+  Registers_t * registers_;
+};
+
+/// Real time transfer (RTT) channel: a pair of ring buffers in RAM that the
+/// debug probe reads and writes through the debug port while the CPU runs.
+///
+/// The control block has the same layout as SEGGER RTT with one up (target
+/// to host) and one down (host to target) buffer, so J-Link RTT Viewer,
+/// OpenOCD `rtt` and pyOCD find it by its "SEGGER RTT" ID and use it as
+/// channel 0. Writing costs a copy into RAM. When the up buffer is full, the
+/// bytes that do not fit are dropped and counted rather than waiting for the
+/// probe, so output never stalls the program, even when no probe is attached.
+///
+/// The channel must have static storage duration so that the probe can find
+/// it, and there must be only one per program.
+///
+/// USAGE:
+///
+///    sjsu::Rtt<1024, 16> rtt;
+///    sjsu::SysCallManager::Get().AddWriter(rtt.Writer());
+///    sjsu::SysCallManager::Get().AddReader(rtt.Reader());
+///
+/// @tparam kUpSize - size of the buffer from the target to the host.
+/// @tparam kDownSize - size of the buffer from the host to the target.
+template <size_t kUpSize, size_t kDownSize = 16>
+class Rtt
+{
+ public:
+  static_assert(kUpSize >= 2 && kDownSize >= 2,
+                "An RTT buffer holds one byte less than its size.");
+
+  /// A ring buffer of the control block, laid out as a SEGGER_RTT_BUFFER.
+  /// The writer of a buffer only moves `write`, its reader only moves
+  /// `read`. One byte is always left free, so `read == write` means empty.
+  struct Buffer_t
+  {
+    const char * name;
+    uint8_t * data;
+    uint32_t size;
+    volatile uint32_t write;
+    volatile uint32_t read;
+    uint32_t flags;
+  };
+
+  /// The control block, laid out as a SEGGER_RTT_CB.
+  struct ControlBlock_t
+  {
+    char id[16];
+    int32_t max_up_buffers;
+    int32_t max_down_buffers;
+    Buffer_t up;
+    Buffer_t down;
+  };
+
+  /// ID the probe searches RAM for.
+  static constexpr char kId[] = "SEGGER RTT";
+
+  Rtt()
+  {
+    control_.max_up_buffers   = 1;
+    control_.max_down_buffers = 1;
+    control_.up               = {
+      "Terminal", up_data_.data(), kUpSize, 0, 0, 0
+    };
+    control_.down = {
+      "Terminal", down_data_.data(), kDownSize, 0, 0, 0
+    };
+
+    // Write the ID last, so that the probe cannot find a control block that
+    // is not complete.
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    for (size_t i = 0; i < sizeof(kId); i++)
+    {
+      control_.id[i] = kId[i];
+    }
+  }
+
+  Rtt(const Rtt &) = delete;
+  Rtt & operator=(const Rtt &) = delete;
+
+  /// Copy bytes into the up buffer for the probe to read. Never blocks.
+  ///
+  /// @param data - bytes to write.
+  /// @return size_t - number of bytes stored. The rest were dropped.
+  size_t Write(std::span<const uint8_t> data)
+  {
+    Buffer_t & up     = control_.up;
+    uint32_t write    = up.write;
+    const size_t kFit = std::min(data.size(), Free(write, up.read));
+
+    // Copy in at most two pieces, up to the end of the buffer and then from
+    // its start.
+    const size_t kFirst = std::min<size_t>(kFit, kUpSize - write);
+    memcpy(&up_data_[write], data.data(), kFirst);
+    memcpy(up_data_.data(), data.data() + kFirst, kFit - kFirst);
+
+    write = static_cast<uint32_t>((write + kFit) % kUpSize);
+
+    // The bytes must be in the buffer before the probe sees the new offset.
+    std::atomic_thread_fence(std::memory_order_release);
+    up.write = write;
+
+    dropped_ += static_cast<uint32_t>(data.size() - kFit);
+    return kFit;
+  }
+
+  /// Take bytes the host has written into the down buffer.
+  ///
+  /// @param data - buffer for the bytes.
+  /// @return size_t - number of bytes read, 0 if there were none.
+  size_t Read(std::span<uint8_t> data)
+  {
+    Buffer_t & down       = control_.down;
+    const uint32_t kWrite = down.write;
+    uint32_t read         = down.read;
+    size_t count          = 0;
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    while (read != kWrite && count < data.size())
+    {
+      data[count++] = down_data_[read];
+      read          = static_cast<uint32_t>((read + 1) % kDownSize);
+    }
+
+    down.read = read;
+    return count;
+  }
+
+  /// @return uint32_t - number of bytes dropped because the up buffer was
+  ///         full.
+  uint32_t Dropped() const
+  {
+    return dropped_;
+  }
+
+  /// @return const ControlBlock_t & - the control block the probe reads.
+  const ControlBlock_t & Control() const
+  {
+    return control_;
+  }
+
+  /// @return a writer for SysCall::AddWriter() that writes to this channel.
+  auto Writer()
+  {
+    return [this](FILE *, const char * buffer, int length) -> int {
+      Write(std::span(reinterpret_cast<const uint8_t *>(buffer),
+                      static_cast<size_t>(length)));
+      return length;
+    };
+  }
+
+  /// @return a reader for SysCall::AddReader() that reads from this channel.
+  auto Reader()
+  {
+    return [this](FILE *, char * buffer, int length) -> int {
+      return static_cast<int>(Read(std::span(
+          reinterpret_cast<uint8_t *>(buffer), static_cast<size_t>(length))));
+    };
+  }
+
+ private:
+  static constexpr size_t Free(uint32_t write, uint32_t read)
+  {
+    return (read + kUpSize - write - 1) % kUpSize;
+  }
+
+  ControlBlock_t control_{};
+  std::array<uint8_t, kUpSize> up_data_{};
+  std::array<uint8_t, kDownSize> down_data_{};
+  uint32_t dropped_ = 0;
+};
+}  // namespace sjsu
@@ -0,0 +1,117 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/platform/debug_output.hpp>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace sjsu
+{
+TEST_CASE("Testing Itm")
+{
+  auto registers = std::make_unique<Itm::Registers_t>();
+  memset(registers.get(), 0, sizeof(Itm::Registers_t));
+  registers->port[1] = 1;
+  Itm itm(1, registers.get());
+  constexpr std::array<uint8_t, 6> kData = { 'a', 'b', 'c', 'd', 'e', 'f' };
+
+  SECTION("Writes are dropped while the ITM is disabled")
+  {
+    // Setup
+    registers->ter = 1 << 1;
+
+    // Exercise & Verify
+    CHECK(!itm.IsEnabled());
+    CHECK(0 == itm.Write(kData));
+  }
+
+  SECTION("Writes are dropped while the port is disabled")
+  {
+    // Setup
+    registers->tcr = Itm::kItmEnable;
+    registers->ter = 1 << 0;
+
+    // Exercise & Verify
+    CHECK(!itm.IsEnabled());
+    CHECK(0 == itm.Write(kData));
+  }
+
+  SECTION("Write() ends with the last byte on the port")
+  {
+    // Setup
+    registers->tcr = Itm::kItmEnable;
+    registers->ter = 1 << 1;
+
+    // Exercise
+    size_t written = itm.Write(kData);
+
+    // Verify
+    CHECK(kData.size() == written);
+    CHECK('f' == (registers->port[1] & 0xFF));
+    CHECK(0 == registers->port[0]);
+  }
+}
+
+TEST_CASE("Testing Rtt")
+{
+  static Rtt<8, 4> rtt;
+  const auto & control = rtt.Control();
+
+  SECTION("Control block can be found by the probe")
+  {
+    // Verify
+    CHECK(std::string("SEGGER RTT") == control.id);
+    CHECK(1 == control.max_up_buffers);
+    CHECK(8 == control.up.size);
+    CHECK(4 == control.down.size);
+  }
+
+  SECTION("Write() stores what fits and drops the rest")
+  {
+    // Setup
+    constexpr std::array<uint8_t, 10> kData = { '0', '1', '2', '3', '4',
+                                                '5', '6', '7', '8', '9' };
+    const uint32_t kDroppedBefore = rtt.Dropped();
+
+    // Exercise
+    size_t stored = rtt.Write(kData);
+
+    // Verify
+    CHECK(7 == stored);
+    CHECK(3 == rtt.Dropped() - kDroppedBefore);
+    CHECK(0 == memcmp(control.up.data, "0123456", 7));
+
+    // Exercise - the probe reads 5 bytes, making room for a wrapped write.
+    const_cast<Rtt<8, 4>::Buffer_t &>(control.up).read = 5;
+    stored = rtt.Write(std::span(kData).first(5));
+
+    // Verify
+    CHECK(5 == stored);
+    CHECK(4 == control.up.write);
+    CHECK(0 == memcmp(&control.up.data[7], "0", 1));
+    CHECK(0 == memcmp(control.up.data, "1234", 4));
+  }
+
+  SECTION("Read() takes what the host wrote")
+  {
+    // Setup
+    auto & down   = const_cast<Rtt<8, 4>::Buffer_t &>(control.down);
+    down.data[3]  = 'x';
+    down.data[0]  = 'y';
+    down.read     = 3;
+    down.write    = 1;
+    std::array<uint8_t, 4> buffer = {};
+
+    // Exercise
+    size_t count = rtt.Read(buffer);
+
+    // Verify
+    CHECK(2 == count);
+    CHECK('x' == buffer[0]);
+    CHECK('y' == buffer[1]);
+    CHECK(1 == control.down.read);
+    CHECK(0 == rtt.Read(buffer));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,566 @@
+#pragma once
+
+#include <linux/can.h>
+#include <linux/can/error.h>
+#include <linux/can/raw.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include <libcore/peripherals/can.hpp>
+#include <libcore/platform/host/errno.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu::host
+{
+/// sjsu::Can for Linux, backed by a SocketCAN raw socket bound to an interface
+/// such as `can0`, so a gateway can run the same CanNetwork code as the
+/// microcontrollers.
+///
+/// Frames are received in batches of up to kBatchSize with one recvmmsg()
+/// call, and Send(std::span<const Message_t>) sends a list with as few
+/// sendmmsg() calls as the transmit queue allows. Acceptance filters are
+/// installed in the socket with CAN_RAW_FILTER, so frames with IDs that a
+/// CanNetwork has not captured are dropped by the kernel.
+///
+/// Message_t::uptime holds the kernel's receive timestamp: the hardware
+/// timestamp when the controller provides one, otherwise the time the kernel
+/// received the frame. These are read from the kernel's clocks, not
+/// sjsu::Uptime().
+///
+/// The bit rates are set with `ip link` when the interface is brought up, so
+/// CanSettings_t::baud_rate is not used. A non-zero data_baud_rate enables
+/// sending CAN-FD frames.
+///
+/// USAGE:
+///
+///    sjsu::host::Can can("can0");
+///    sjsu::CanNetwork network(can, &memory_resource);
+///    auto * node = network.CaptureMessage(0x140);
+///    network.Initialize();
+///    while (true)
+///    {
+///      can.Poll(std::chrono::milliseconds(100));
+///    }
+class Can : public sjsu::Can
+{
+ public:
+  /// Most frames received with one recvmmsg() or sent with one sendmmsg().
+  static constexpr size_t kBatchSize = 32;
+
+  /// @param interface_name - name of the SocketCAN interface. Must outlive
+  ///        this object.
+  explicit Can(const char * interface_name) : interface_name_(interface_name)
+  {
+  }
+
+  Can(const Can &) = delete;
+  Can & operator=(const Can &) = delete;
+
+  ~Can()
+  {
+    if (fd_ >= 0)
+    {
+      close(fd_);
+    }
+  }
+
+  /// @throw sjsu::Exception - std::errc::no_such_device if the interface does
+  ///        not exist, otherwise with the error code of the system call that
+  ///        failed.
+  void ModuleInitialize() override
+  {
+    if (fd_ >= 0)
+    {
+      return;
+    }
+
+    const unsigned kIndex = if_nametoindex(interface_name_);
+    if (kIndex == 0)
+    {
+      throw Exception(std::errc::no_such_device, "CAN interface not found.");
+    }
+
+    fd_ = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, CAN_RAW);
+    if (fd_ < 0)
+    {
+      ThrowErrno("Could not open CAN socket.");
+    }
+
+    // Timestamping is best effort. Without it, received messages have an
+    // uptime of 0.
+    const int kTimestamping =
+        SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE |
+        SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+    setsockopt(fd_,
+               SOL_SOCKET,
+               SO_TIMESTAMPING,
+               &kTimestamping,
+               sizeof(kTimestamping));
+
+    can_err_mask_t kErrors = CAN_ERR_BUSOFF | CAN_ERR_RESTARTED |
+                             CAN_ERR_LOSTARB | CAN_ERR_CRTL;
+#if defined(CAN_ERR_CNT)
+    kErrors |= CAN_ERR_CNT;
+#endif
+    SetOption(CAN_RAW_ERR_FILTER, &kErrors, sizeof(kErrors));
+
+    if (settings.data_baud_rate != 0_Hz)
+    {
+      const int kEnable = 1;
+      SetOption(CAN_RAW_FD_FRAMES, &kEnable, sizeof(kEnable));
+    }
+
+    InstallFilters();
+
+    sockaddr_can address = {};
+    address.can_family   = AF_CAN;
+    address.can_ifindex  = static_cast<int>(kIndex);
+    if (bind(fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+    {
+      ThrowErrno("Could not bind CAN socket.");
+    }
+  }
+
+  void Send(const Message_t & message) override
+  {
+    Send(std::span(&message, 1));
+  }
+
+  /// Sends the messages with sendmmsg(), kBatchSize at a time, waiting for
+  /// room in the transmit queue when it is full.
+  ///
+  /// @throw sjsu::Exception - with the error code of sendmmsg() if it failed.
+  void Send(std::span<const Message_t> messages) override
+  {
+    std::array<can_frame, kBatchSize> frames;
+    while (!messages.empty())
+    {
+      const size_t kCount = std::min(messages.size(), kBatchSize);
+      for (size_t i = 0; i < kCount; i++)
+      {
+        frames[i] = ToFrame(messages[i]);
+      }
+      SendFrames(frames.data(), sizeof(can_frame), kCount);
+
+      for (size_t i = 0; i < kCount; i++)
+      {
+        counters_.bits_transmitted += FrameBits(messages[i]);
+      }
+      counters_.frames_transmitted += static_cast<uint32_t>(kCount);
+      messages = messages.subspan(kCount);
+    }
+  }
+
+  /// @throw sjsu::Exception - std::errc::operation_not_supported if the
+  ///        peripheral was initialized without a data_baud_rate.
+  void Send(const FdMessage_t & message) override
+  {
+    Send(std::span(&message, 1));
+  }
+
+  /// See Send(std::span<const Message_t>).
+  void Send(std::span<const FdMessage_t> messages) override
+  {
+    if (settings.data_baud_rate == 0_Hz)
+    {
+      throw Exception(std::errc::operation_not_supported,
+                      "CAN-FD needs a non-zero data_baud_rate.");
+    }
+
+    std::array<canfd_frame, kBatchSize> frames;
+    while (!messages.empty())
+    {
+      const size_t kCount = std::min(messages.size(), kBatchSize);
+      for (size_t i = 0; i < kCount; i++)
+      {
+        frames[i] = ToFrame(messages[i]);
+      }
+      SendFrames(frames.data(), sizeof(canfd_frame), kCount);
+      messages = messages.subspan(kCount);
+    }
+  }
+
+  /// @return Message_t - the next message of the last batch received. Call
+  ///         HasData() first, otherwise an empty message is returned when
+  ///         there is none.
+  Message_t Receive() override
+  {
+    if (!HasData())
+    {
+      return {};
+    }
+    return received_[next_++];
+  }
+
+  /// Only calls recvmmsg() once every message of the last batch has been
+  /// returned by Receive().
+  bool HasData() override
+  {
+    if (next_ >= received_count_)
+    {
+      ReceiveBatch();
+    }
+    return next_ < received_count_;
+  }
+
+  /// @return true - if the interface is up and running.
+  bool SelfTest([[maybe_unused]] uint32_t id) override
+  {
+    if (fd_ < 0)
+    {
+      return false;
+    }
+
+    ifreq request = {};
+    std::strncpy(request.ifr_name, interface_name_, IFNAMSIZ - 1);
+    if (ioctl(fd_, SIOCGIFFLAGS, &request) < 0)
+    {
+      return false;
+    }
+    return (request.ifr_flags & IFF_RUNNING) != 0;
+  }
+
+  /// Bus off and restart are reported to the socket as error frames, which
+  /// are read along with received messages.
+  bool IsBusOff() override
+  {
+    HasData();
+    return bus_off_;
+  }
+
+  /// Arbitration losses, controller overflows and error counters are
+  /// reported to the socket as error frames, which are read along with
+  /// received messages. Which of them are reported depends on the interface's
+  /// driver.
+  Counters_t GetCounters() override
+  {
+    HasData();
+    return counters_;
+  }
+
+  /// Filters added before Initialize() are installed when the socket is
+  /// opened.
+  ///
+  /// @return false - if the kernel's limit of CAN_RAW_FILTER_MAX filters has
+  ///         been reached.
+  bool AddAcceptanceFilter(const AcceptanceFilter_t & filter) override
+  {
+    if (filters_.size() >= CAN_RAW_FILTER_MAX)
+    {
+      return false;
+    }
+
+    filters_.push_back(ToFilter(filter));
+    if (fd_ >= 0)
+    {
+      InstallFilters();
+    }
+    return true;
+  }
+
+  void ClearAcceptanceFilters() override
+  {
+    filters_.clear();
+    if (fd_ >= 0)
+    {
+      InstallFilters();
+    }
+  }
+
+  /// Wait for frames to arrive, then run settings.handler until the received
+  /// batch has been consumed. Meant to be called in a loop from the thread
+  /// that owns the CanNetwork.
+  ///
+  /// @param timeout - longest time to wait for a frame.
+  void Poll(std::chrono::milliseconds timeout)
+  {
+    if (!HasData())
+    {
+      pollfd readable = { .fd = fd_, .events = POLLIN, .revents = 0 };
+      poll(&readable, 1, static_cast<int>(timeout.count()));
+    }
+
+    while (settings.handler && HasData())
+    {
+      settings.handler(*this);
+    }
+  }
+
+  /// @return int - socket descriptor that becomes readable when frames
+  ///         arrive, or -1 before Initialize().
+  int EventFd() const
+  {
+    return fd_;
+  }
+
+  /// @param filter - the acceptance filter to convert.
+  /// @return can_filter - the filter in the form CAN_RAW_FILTER takes, which
+  ///         also matches the ID format.
+  static can_filter ToFilter(const AcceptanceFilter_t & filter)
+  {
+    const bool kExtended = (filter.format == Message_t::Format::kExtended);
+    const canid_t kIdMask = kExtended ? CAN_EFF_MASK : CAN_SFF_MASK;
+
+    return can_filter{
+      .can_id   = (filter.id & kIdMask) | (kExtended ? CAN_EFF_FLAG : 0),
+      .can_mask = (filter.mask & kIdMask) | CAN_EFF_FLAG,
+    };
+  }
+
+  /// @param message - the message to convert.
+  /// @return can_frame - the message as a SocketCAN frame.
+  static can_frame ToFrame(const Message_t & message)
+  {
+    can_frame frame = {};
+    frame.can_id    = message.id;
+    if (message.format == Message_t::Format::kExtended)
+    {
+      frame.can_id = (message.id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    }
+    if (message.is_remote_request)
+    {
+      frame.can_id |= CAN_RTR_FLAG;
+    }
+    frame.len = std::min<uint8_t>(message.length, CAN_MAX_DLEN);
+    std::copy_n(message.payload.begin(), frame.len, frame.data);
+    return frame;
+  }
+
+  /// @param message - the message to convert.
+  /// @return canfd_frame - the message as a SocketCAN CAN-FD frame.
+  static canfd_frame ToFrame(const FdMessage_t & message)
+  {
+    canfd_frame frame = {};
+    frame.can_id      = message.id;
+    if (message.format == Message_t::Format::kExtended)
+    {
+      frame.can_id = (message.id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    }
+    frame.flags = message.bit_rate_switch ? CANFD_BRS : 0;
+    frame.len   = std::min<uint8_t>(message.length, CANFD_MAX_DLEN);
+    std::copy_n(message.payload.begin(), frame.len, frame.data);
+    return frame;
+  }
+
+  /// @param frame - the SocketCAN frame to convert. Must not be an error
+  ///        frame.
+  /// @return Message_t - the frame as a message, without an uptime.
+  static Message_t FromFrame(const can_frame & frame)
+  {
+    Message_t message = {};
+    if (frame.can_id & CAN_EFF_FLAG)
+    {
+      message.id     = frame.can_id & CAN_EFF_MASK;
+      message.format = Message_t::Format::kExtended;
+    }
+    else
+    {
+      message.id = frame.can_id & CAN_SFF_MASK;
+    }
+    message.is_remote_request = (frame.can_id & CAN_RTR_FLAG) != 0;
+    message.length = std::min<uint8_t>(frame.len, CAN_MAX_DLEN);
+    std::copy_n(frame.data, message.length, message.payload.begin());
+    return message;
+  }
+
+ private:
+  /// Room for the SO_TIMESTAMPING control message of one frame.
+  static constexpr size_t kControlSize =
+      CMSG_SPACE(sizeof(scm_timestamping));
+
+  void SetOption(int option, const void * value, socklen_t length)
+  {
+    if (setsockopt(fd_, SOL_CAN_RAW, option, value, length) < 0)
+    {
+      ThrowErrno("Could not configure CAN socket.");
+    }
+  }
+
+  void InstallFilters()
+  {
+    // An empty filter list would receive nothing, so accept everything with
+    // a filter that has no mask bits instead.
+    static constexpr can_filter kAcceptAll = { .can_id = 0, .can_mask = 0 };
+    if (filters_.empty())
+    {
+      SetOption(CAN_RAW_FILTER, &kAcceptAll, sizeof(kAcceptAll));
+    }
+    else
+    {
+      SetOption(CAN_RAW_FILTER,
+                filters_.data(),
+                static_cast<socklen_t>(filters_.size() * sizeof(can_filter)));
+    }
+  }
+
+  /// @return std::chrono::nanoseconds - the hardware receive timestamp of a
+  ///         frame if it has one, otherwise the software timestamp, otherwise
+  ///         0.
+  static std::chrono::nanoseconds ReadTimestamp(msghdr & header)
+  {
+    for (cmsghdr * control = CMSG_FIRSTHDR(&header); control != nullptr;
+         control           = CMSG_NXTHDR(&header, control))
+    {
+      if (control->cmsg_level != SOL_SOCKET ||
+          control->cmsg_type != SO_TIMESTAMPING)
+      {
+        continue;
+      }
+
+      scm_timestamping stamps;
+      std::memcpy(&stamps, CMSG_DATA(control), sizeof(stamps));
+      const timespec & stamp =
+          (stamps.ts[2].tv_sec || stamps.ts[2].tv_nsec) ? stamps.ts[2]
+                                                        : stamps.ts[0];
+      return std::chrono::seconds(stamp.tv_sec) +
+             std::chrono::nanoseconds(stamp.tv_nsec);
+    }
+    return std::chrono::nanoseconds(0);
+  }
+
+  /// Receive up to kBatchSize frames with one recvmmsg() call. Error frames
+  /// update the bus off state and counters, and are not returned by Receive().
+  void ReceiveBatch()
+  {
+    next_           = 0;
+    received_count_ = 0;
+    if (fd_ < 0)
+    {
+      return;
+    }
+
+    std::array<canfd_frame, kBatchSize> frames;
+    std::array<iovec, kBatchSize> vectors;
+    std::array<mmsghdr, kBatchSize> headers;
+    std::array<std::array<uint8_t, kControlSize>, kBatchSize> controls;
+
+    for (size_t i = 0; i < kBatchSize; i++)
+    {
+      vectors[i] = { .iov_base = &frames[i], .iov_len = sizeof(canfd_frame) };
+      headers[i] = {};
+      headers[i].msg_hdr.msg_iov        = &vectors[i];
+      headers[i].msg_hdr.msg_iovlen     = 1;
+      headers[i].msg_hdr.msg_control    = controls[i].data();
+      headers[i].msg_hdr.msg_controllen = controls[i].size();
+    }
+
+    const int kCount =
+        recvmmsg(fd_, headers.data(), kBatchSize, MSG_DONTWAIT, nullptr);
+
+    for (int i = 0; i < kCount; i++)
+    {
+      // Message_t cannot hold a CAN-FD payload, so those frames are dropped.
+      if (headers[i].msg_len != sizeof(can_frame))
+      {
+        continue;
+      }
+
+      const auto & frame = reinterpret_cast<const can_frame &>(frames[i]);
+      if (frame.can_id & CAN_ERR_FLAG)
+      {
+        if (frame.can_id & CAN_ERR_BUSOFF)
+        {
+          bus_off_ = true;
+        }
+        else if (frame.can_id & CAN_ERR_RESTARTED)
+        {
+          bus_off_ = false;
+        }
+        CountError(frame);
+        continue;
+      }
+
+      Message_t & message = received_[received_count_++];
+      message             = FromFrame(frame);
+      message.uptime      = ReadTimestamp(headers[i].msg_hdr);
+    }
+  }
+
+  /// Update the counters from an error frame.
+  void CountError(const can_frame & frame)
+  {
+    if (frame.can_id & CAN_ERR_LOSTARB)
+    {
+      counters_.arbitration_lost++;
+    }
+
+    if ((frame.can_id & CAN_ERR_CRTL) &&
+        (frame.data[1] & CAN_ERR_CRTL_RX_OVERFLOW))
+    {
+      counters_.receive_overruns++;
+    }
+
+#if defined(CAN_ERR_CNT)
+    if (frame.can_id & CAN_ERR_CNT)
+    {
+      counters_.transmit_error_counter = frame.data[6];
+      counters_.receive_error_counter  = frame.data[7];
+    }
+#endif
+  }
+
+  /// Send `count` frames of `frame_size` bytes each, starting at `frames`,
+  /// retrying the ones the kernel did not accept once the transmit queue has
+  /// room.
+  void SendFrames(void * frames, size_t frame_size, size_t count)
+  {
+    std::array<iovec, kBatchSize> vectors;
+    std::array<mmsghdr, kBatchSize> headers;
+    auto * bytes = static_cast<uint8_t *>(frames);
+
+    for (size_t i = 0; i < count; i++)
+    {
+      vectors[i] = { .iov_base = bytes + (i * frame_size),
+                     .iov_len  = frame_size };
+      headers[i] = {};
+      headers[i].msg_hdr.msg_iov    = &vectors[i];
+      headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    size_t sent = 0;
+    while (sent < count)
+    {
+      const int kResult = sendmmsg(
+          fd_, &headers[sent], static_cast<unsigned>(count - sent), 0);
+      if (kResult > 0)
+      {
+        sent += static_cast<size_t>(kResult);
+      }
+      else if (errno == EAGAIN || errno == ENOBUFS)
+      {
+        pollfd writable = { .fd = fd_, .events = POLLOUT, .revents = 0 };
+        poll(&writable, 1, -1);
+      }
+      else if (errno != EINTR)
+      {
+        ThrowErrno("Could not send CAN frames.");
+      }
+    }
+  }
+
+  const char * interface_name_;
+  int fd_                = -1;
+  bool bus_off_          = false;
+  Counters_t counters_;
+  size_t next_           = 0;
+  size_t received_count_ = 0;
+  std::array<Message_t, kBatchSize> received_;
+  std::vector<can_filter> filters_;
+};
+}  // namespace sjsu::host
@@ -0,0 +1,82 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/platform/host/can.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing host can")
+{
+  SECTION("Standard message to frame and back")
+  {
+    // Setup
+    const Can::Message_t kMessage = {
+      .id      = 0x140,
+      .length  = 3,
+      .payload = { 0xAA, 0xBB, 0xCC },
+    };
+
+    // Exercise
+    can_frame frame         = host::Can::ToFrame(kMessage);
+    Can::Message_t returned = host::Can::FromFrame(frame);
+
+    // Verify
+    CHECK(0x140 == frame.can_id);
+    CHECK(3 == frame.len);
+    CHECK(0xCC == frame.data[2]);
+    CHECK(0x140 == returned.id);
+    CHECK(Can::Message_t::Format::kStandard == returned.format);
+    CHECK(!returned.is_remote_request);
+    CHECK(3 == returned.length);
+    CHECK(0xBB == returned.payload[1]);
+  }
+
+  SECTION("Extended remote request to frame and back")
+  {
+    // Setup
+    const Can::Message_t kMessage = {
+      .id                = 0x1234'5678,
+      .is_remote_request = true,
+      .length            = 8,
+      .format            = Can::Message_t::Format::kExtended,
+      .payload           = {},
+    };
+
+    // Exercise
+    can_frame frame         = host::Can::ToFrame(kMessage);
+    Can::Message_t returned = host::Can::FromFrame(frame);
+
+    // Verify
+    CHECK((0x1234'5678 | CAN_EFF_FLAG | CAN_RTR_FLAG) == frame.can_id);
+    CHECK(0x1234'5678 == returned.id);
+    CHECK(Can::Message_t::Format::kExtended == returned.format);
+    CHECK(returned.is_remote_request);
+  }
+
+  SECTION("ToFilter() matches the ID format")
+  {
+    // Exercise
+    can_filter standard = host::Can::ToFilter({ .id = 0x7AA });
+    can_filter extended = host::Can::ToFilter({
+        .id     = 0x1000,
+        .mask   = 0xFF00,
+        .format = Can::Message_t::Format::kExtended,
+    });
+
+    // Verify
+    CHECK(0x7AA == standard.can_id);
+    CHECK((CAN_SFF_MASK | CAN_EFF_FLAG) == standard.can_mask);
+    CHECK((0x1000 | CAN_EFF_FLAG) == extended.can_id);
+    CHECK((0xFF00 | CAN_EFF_FLAG) == extended.can_mask);
+  }
+
+  SECTION("AddAcceptanceFilter() before Initialize()")
+  {
+    // Setup
+    host::Can can("can-does-not-exist");
+
+    // Exercise & Verify
+    CHECK(can.AddAcceptanceFilter({ .id = 0x140 }));
+    CHECK(!can.HasData());
+    CHECK(!can.SelfTest(0x140));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cerrno>
+#include <system_error>
+
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu::host
+{
+/// Throw the error of the last failed system call, such as open() or
+/// ioctl(), for the Linux drivers to report failures with.
+///
+/// @param message - description of the operation that failed.
+/// @throw sjsu::Exception - with `errno` as its error code.
+[[noreturn]] inline void ThrowErrno(const char * message)
+{
+  throw Exception(static_cast<std::errc>(errno), message);
+}
+}  // namespace sjsu::host
@@ -0,0 +1,36 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/platform/host/can.hpp>
+#include <libcore/platform/host/errno.hpp>
+#include <libcore/platform/host/i2c.hpp>
+#include <libcore/platform/host/spi.hpp>
+#include <libcore/platform/host/uart.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing host errno")
+{
+  SECTION("ThrowErrno() throws the code in errno")
+  {
+    // Setup
+    errno = ENOENT;
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(host::ThrowErrno("Missing."),
+                        std::errc::no_such_file_or_directory);
+  }
+
+  SECTION("Initialize throws when the device does not exist")
+  {
+    // Setup
+    auto initialize_throws = [](auto && peripheral) {
+      CHECK_THROWS_AS(peripheral.Initialize(), sjsu::Exception);
+    };
+
+    // Exercise & Verify
+    initialize_throws(host::Can("can-does-not-exist"));
+    initialize_throws(host::I2c("/dev/i2c-does-not-exist"));
+    initialize_throws(host::Spi("/dev/spidev-does-not-exist"));
+    initialize_throws(host::Uart("/dev/tty-does-not-exist"));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,509 @@
+#pragma once
+
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/gpio_interrupt_table.hpp>
+#include <libcore/peripherals/gpio_port.hpp>
+#include <libcore/platform/host/errno.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu::host
+{
+/// sjsu::GpioPort for Linux, backed by the GPIO character device uAPI (v2) of
+/// a chip such as `/dev/gpiochip0`.
+///
+/// Every line of the port is requested with a single GPIO_V2_GET_LINE_IOCTL,
+/// so the lines are set and read together with one ioctl, each line being
+/// the bit of the masks at its position in `offsets`. Edge events of every
+/// line are read from the one request descriptor in batches by
+/// ProcessEvents(), which calls the callbacks attached with
+/// host::Gpio::AttachInterrupt() from the thread that calls it, rather than
+/// needing a thread or poll per pin.
+///
+/// USAGE:
+///
+///    constexpr std::array<uint32_t, 2> kOffsets = { 17, 27 };
+///    sjsu::host::GpioChip chip("/dev/gpiochip0", kOffsets);
+///    sjsu::host::Gpio led(chip, 0);
+///    sjsu::host::Gpio button(chip, 1);
+///    chip.Initialize();
+///    led.SetAsOutput();
+///    button.OnFallingEdge([&led]() { led.Toggle(); });
+///    while (true)
+///    {
+///      chip.ProcessEvents(std::chrono::milliseconds(100));
+///    }
+class GpioChip : public sjsu::GpioPort
+{
+ public:
+  /// Most lines a port can hold, one for each bit of the GpioPort masks.
+  static constexpr size_t kMaximumLines = 32;
+
+  /// Most edge events read from the kernel with one read().
+  static constexpr size_t kEventBatchSize = 16;
+
+  /// @param device_path - path of the GPIO chip device. Must outlive this
+  ///        object.
+  /// @param offsets - offsets of the lines of the chip that make up this port.
+  ///        At most kMaximumLines.
+  GpioChip(const char * device_path, std::span<const uint32_t> offsets)
+      : device_path_(device_path), offsets_(offsets.begin(), offsets.end())
+  {
+    flags_.fill(GPIO_V2_LINE_FLAG_INPUT);
+  }
+
+  GpioChip(const GpioChip &) = delete;
+  GpioChip & operator=(const GpioChip &) = delete;
+
+  ~GpioChip()
+  {
+    if (line_fd_ >= 0)
+    {
+      close(line_fd_);
+    }
+  }
+
+  /// Requests every line at once, with the configuration each line was given
+  /// before this call.
+  ///
+  /// @throw sjsu::Exception - std::errc::invalid_argument if there are more
+  ///        than kMaximumLines offsets, otherwise with the error code of the
+  ///        system call that failed.
+  void ModuleInitialize() override
+  {
+    if (line_fd_ >= 0)
+    {
+      return;
+    }
+
+    if (offsets_.size() > kMaximumLines)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "A GPIO port holds at most 32 lines.");
+    }
+
+    int chip_fd = open(device_path_, O_RDWR | O_CLOEXEC);
+    if (chip_fd < 0)
+    {
+      ThrowErrno("Could not open GPIO chip.");
+    }
+
+    gpio_v2_line_request request = {};
+    std::copy(offsets_.begin(), offsets_.end(), request.offsets);
+    std::strncpy(request.consumer, "libcore", GPIO_MAX_NAME_SIZE - 1);
+    request.num_lines         = static_cast<uint32_t>(offsets_.size());
+    request.event_buffer_size = kEventBatchSize * 4;
+    BuildConfig(Flags(), output_values_, request.config);
+
+    const int kResult = ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &request);
+    const int kError  = errno;
+    close(chip_fd);
+    if (kResult < 0)
+    {
+      errno = kError;
+      ThrowErrno("Could not request GPIO lines.");
+    }
+
+    line_fd_ = request.fd;
+    fcntl(line_fd_, F_SETFL, fcntl(line_fd_, F_GETFL) | O_NONBLOCK);
+  }
+
+  void SetDirection(uint32_t mask, Gpio::Direction direction) override
+  {
+    const uint64_t kDirection = (direction == Gpio::Direction::kOutput)
+                                    ? GPIO_V2_LINE_FLAG_OUTPUT
+                                    : GPIO_V2_LINE_FLAG_INPUT;
+    ForEachLine(mask, [this, kDirection](size_t line) {
+      flags_[line] &= ~(GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_OUTPUT |
+                        kEdgeFlags);
+      flags_[line] |= kDirection;
+    });
+    Reconfigure();
+  }
+
+  void Set(uint32_t mask) override
+  {
+    Write(mask, mask);
+  }
+
+  void Clear(uint32_t mask) override
+  {
+    Write(mask, 0);
+  }
+
+  /// Sets and clears the lines of `mask` with one ioctl.
+  void Write(uint32_t mask, uint32_t value) override
+  {
+    output_values_ = (output_values_ & ~mask) | (value & mask);
+    if (line_fd_ < 0)
+    {
+      return;
+    }
+
+    gpio_v2_line_values values = { .bits = value, .mask = mask };
+    if (ioctl(line_fd_, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) < 0)
+    {
+      ThrowErrno("Could not set GPIO lines.");
+    }
+  }
+
+  /// Reads every line with one ioctl.
+  uint32_t Read() override
+  {
+    if (line_fd_ < 0)
+    {
+      return 0;
+    }
+
+    gpio_v2_line_values values = { .bits = 0, .mask = AllLines() };
+    if (ioctl(line_fd_, GPIO_V2_LINE_GET_VALUES_IOCTL, &values) < 0)
+    {
+      ThrowErrno("Could not read GPIO lines.");
+    }
+    return static_cast<uint32_t>(values.bits);
+  }
+
+  /// Apply the pin settings of one line.
+  ///
+  /// @param line - position of the line in `offsets`.
+  /// @param settings - bias and drive of the line. `function` and `as_analog`
+  ///        have no equivalent and are ignored.
+  void ConfigureLine(size_t line, const PinSettings_t & settings)
+  {
+    constexpr uint64_t kBiasFlags =
+        GPIO_V2_LINE_FLAG_BIAS_PULL_UP | GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN |
+        GPIO_V2_LINE_FLAG_BIAS_DISABLED | GPIO_V2_LINE_FLAG_OPEN_DRAIN;
+
+    uint64_t & flags = flags_.at(line);
+    flags &= ~kBiasFlags;
+    switch (settings.resistor)
+    {
+      case PinSettings_t::Resistor::kNone:
+        flags |= GPIO_V2_LINE_FLAG_BIAS_DISABLED;
+        break;
+      case PinSettings_t::Resistor::kPullDown:
+        flags |= GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN;
+        break;
+      case PinSettings_t::Resistor::kPullUp:
+        flags |= GPIO_V2_LINE_FLAG_BIAS_PULL_UP;
+        break;
+    }
+    if (settings.open_drain)
+    {
+      flags |= GPIO_V2_LINE_FLAG_OPEN_DRAIN;
+    }
+    Reconfigure();
+  }
+
+  /// Make a line an input that calls `callback` from ProcessEvents() on the
+  /// given edges.
+  ///
+  /// @param line - position of the line in `offsets`.
+  /// @param callback - function to call for each edge event of the line.
+  /// @param edge - the edges that generate events.
+  void AttachInterrupt(size_t line, InterruptCallback callback, Gpio::Edge edge)
+  {
+    interrupts_.Attach(static_cast<uint8_t>(Line(line)), callback, edge);
+
+    uint64_t & flags = flags_[line];
+    flags &= ~(GPIO_V2_LINE_FLAG_OUTPUT | kEdgeFlags);
+    flags |= GPIO_V2_LINE_FLAG_INPUT;
+    if (Value(edge) & Value(Gpio::Edge::kRising))
+    {
+      flags |= GPIO_V2_LINE_FLAG_EDGE_RISING;
+    }
+    if (Value(edge) & Value(Gpio::Edge::kFalling))
+    {
+      flags |= GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    }
+    Reconfigure();
+  }
+
+  /// Stop generating events for a line.
+  ///
+  /// @param line - position of the line in `offsets`.
+  void DetachInterrupt(size_t line)
+  {
+    interrupts_.Detach(static_cast<uint8_t>(Line(line)));
+    flags_[line] &= ~kEdgeFlags;
+    Reconfigure();
+  }
+
+  /// Wait for edge events, then read them in batches and call the callback
+  /// of the line of each one, until none are left.
+  ///
+  /// @param timeout - longest time to wait for the first event.
+  /// @return size_t - number of events handled.
+  size_t ProcessEvents(std::chrono::milliseconds timeout)
+  {
+    if (line_fd_ < 0)
+    {
+      return 0;
+    }
+
+    pollfd readable = { .fd = line_fd_, .events = POLLIN, .revents = 0 };
+    if (poll(&readable, 1, static_cast<int>(timeout.count())) <= 0)
+    {
+      return 0;
+    }
+
+    std::array<gpio_v2_line_event, kEventBatchSize> events;
+    size_t handled = 0;
+    while (true)
+    {
+      const ssize_t kBytes = read(line_fd_, events.data(), sizeof(events));
+      if (kBytes <= 0)
+      {
+        break;
+      }
+
+      const size_t kCount = static_cast<size_t>(kBytes) / sizeof(events[0]);
+      for (size_t i = 0; i < kCount; i++)
+      {
+        Dispatch(events[i]);
+      }
+      handled += kCount;
+
+      if (kCount < events.size())
+      {
+        break;
+      }
+    }
+    return handled;
+  }
+
+  /// @param line - position of the line in `offsets`.
+  /// @return std::chrono::nanoseconds - the kernel's CLOCK_MONOTONIC timestamp
+  ///         of the last edge event of the line, 0 if there has been none.
+  std::chrono::nanoseconds EdgeTime(size_t line) const
+  {
+    return edge_times_.at(line);
+  }
+
+  /// @return int - descriptor that becomes readable when edge events arrive,
+  ///         or -1 before Initialize().
+  int EventFd() const
+  {
+    return line_fd_;
+  }
+
+  /// Convert the flags of each line into a line configuration. Lines with the
+  /// same flags share an attribute, so the number of distinct flag values,
+  /// not lines, is limited by the kernel.
+  ///
+  /// @param flags - GPIO_V2_LINE_FLAG_* of each line.
+  /// @param output_values - the value of each output line.
+  /// @param config - configuration to write.
+  /// @throw sjsu::Exception - std::errc::argument_list_too_long if the lines
+  ///        need more attributes than the kernel accepts.
+  static void BuildConfig(std::span<const uint64_t> flags,
+                          uint64_t output_values,
+                          gpio_v2_line_config & config)
+  {
+    config = {};
+    if (flags.empty())
+    {
+      return;
+    }
+
+    config.flags     = flags[0];
+    uint64_t outputs = 0;
+    for (size_t line = 0; line < flags.size(); line++)
+    {
+      if (flags[line] & GPIO_V2_LINE_FLAG_OUTPUT)
+      {
+        outputs |= (uint64_t{ 1 } << line);
+      }
+      if (flags[line] == config.flags)
+      {
+        continue;
+      }
+
+      auto * end       = config.attrs + config.num_attrs;
+      auto * attribute = std::find_if(
+          config.attrs, end, [&flags, line](const auto & existing) {
+            return existing.attr.flags == flags[line];
+          });
+
+      if (attribute == end)
+      {
+        // Keep one attribute free for the output values.
+        if (config.num_attrs + 1 >= GPIO_V2_LINE_NUM_ATTRS_MAX)
+        {
+          throw Exception(std::errc::argument_list_too_long,
+                          "Too many different GPIO line configurations.");
+        }
+        attribute             = &config.attrs[config.num_attrs++];
+        attribute->attr.id    = GPIO_V2_LINE_ATTR_ID_FLAGS;
+        attribute->attr.flags = flags[line];
+      }
+      attribute->mask |= (uint64_t{ 1 } << line);
+    }
+
+    if (outputs != 0)
+    {
+      auto & attribute      = config.attrs[config.num_attrs++];
+      attribute.attr.id     = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+      attribute.attr.values = output_values & outputs;
+      attribute.mask        = outputs;
+    }
+  }
+
+ private:
+  static constexpr uint64_t kEdgeFlags =
+      GPIO_V2_LINE_FLAG_EDGE_RISING | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+
+  static uint8_t Value(Gpio::Edge edge)
+  {
+    return static_cast<uint8_t>(edge);
+  }
+
+  static size_t Line(size_t line)
+  {
+    if (line >= kMaximumLines)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "A GPIO port holds at most 32 lines.");
+    }
+    return line;
+  }
+
+  template <typename Function>
+  void ForEachLine(uint32_t mask, Function function)
+  {
+    for (mask &= AllLines(); mask != 0; mask &= mask - 1)
+    {
+      function(static_cast<size_t>(std::countr_zero(mask)));
+    }
+  }
+
+  uint32_t AllLines() const
+  {
+    return static_cast<uint32_t>((uint64_t{ 1 } << offsets_.size()) - 1);
+  }
+
+  std::span<const uint64_t> Flags() const
+  {
+    return std::span(flags_).first(std::min(offsets_.size(), kMaximumLines));
+  }
+
+  /// Send the configuration of every line to the kernel. Lines are only
+  /// configured when requested in Initialize() until then.
+  void Reconfigure()
+  {
+    if (line_fd_ < 0)
+    {
+      return;
+    }
+
+    gpio_v2_line_config config;
+    BuildConfig(Flags(), output_values_, config);
+    if (ioctl(line_fd_, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config) < 0)
+    {
+      ThrowErrno("Could not configure GPIO lines.");
+    }
+  }
+
+  void Dispatch(const gpio_v2_line_event & event)
+  {
+    auto offset = std::find(offsets_.begin(), offsets_.end(), event.offset);
+    if (offset == offsets_.end())
+    {
+      return;
+    }
+
+    const size_t kLine = static_cast<size_t>(offset - offsets_.begin());
+    edge_times_[kLine] = std::chrono::nanoseconds(event.timestamp_ns);
+    interrupts_.Dispatch(uint32_t{ 1 } << kLine);
+  }
+
+  const char * device_path_;
+  std::vector<uint32_t> offsets_;
+  int line_fd_            = -1;
+  uint32_t output_values_ = 0;
+  std::array<uint64_t, kMaximumLines> flags_;
+  GpioInterruptTable interrupts_;
+  std::array<std::chrono::nanoseconds, kMaximumLines> edge_times_ = {};
+};
+
+/// sjsu::Gpio for Linux, a single line of a host::GpioChip. See
+/// host::GpioChip for usage.
+class Gpio : public sjsu::Gpio
+{
+ public:
+  /// @param chip - the port the line belongs to.
+  /// @param line - position of the line in the offsets of the port.
+  Gpio(GpioChip & chip, uint8_t line) : chip_(chip), line_(line) {}
+
+  /// Applies the resistor and open drain settings to the line. The chip is
+  /// initialized separately, as it is shared by its lines.
+  void ModuleInitialize() override
+  {
+    chip_.ConfigureLine(line_, settings);
+  }
+
+  void SetDirection(Direction direction) override
+  {
+    chip_.SetDirection(Mask(), direction);
+  }
+
+  void Set(State output) override
+  {
+    chip_.Write(Mask(), (output == State::kHigh) ? Mask() : 0);
+  }
+
+  void Toggle() override
+  {
+    chip_.Toggle(Mask());
+  }
+
+  bool Read() override
+  {
+    return (chip_.Read() & Mask()) != 0;
+  }
+
+  /// The callback is called from GpioChip::ProcessEvents().
+  void AttachInterrupt(InterruptCallback callback, Edge edge) override
+  {
+    chip_.AttachInterrupt(line_, callback, edge);
+  }
+
+  void DetachInterrupt() override
+  {
+    chip_.DetachInterrupt(line_);
+  }
+
+  /// @return std::chrono::nanoseconds - kernel timestamp of the last edge
+  ///         event, for use within an interrupt callback.
+  std::chrono::nanoseconds EdgeTime() const
+  {
+    return chip_.EdgeTime(line_);
+  }
+
+ private:
+  uint32_t Mask() const
+  {
+    return uint32_t{ 1 } << line_;
+  }
+
+  GpioChip & chip_;
+  uint8_t line_;
+};
+}  // namespace sjsu::host
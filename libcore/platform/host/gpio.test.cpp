@@ -0,0 +1,86 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/platform/host/gpio.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+TEST_CASE("Testing host gpio")
+{
+  gpio_v2_line_config config;
+
+  SECTION("BuildConfig() with every line the same")
+  {
+    // Setup
+    const std::array<uint64_t, 3> kFlags = {
+      GPIO_V2_LINE_FLAG_INPUT,
+      GPIO_V2_LINE_FLAG_INPUT,
+      GPIO_V2_LINE_FLAG_INPUT,
+    };
+
+    // Exercise
+    host::GpioChip::BuildConfig(kFlags, 0, config);
+
+    // Verify
+    CHECK(GPIO_V2_LINE_FLAG_INPUT == config.flags);
+    CHECK(0 == config.num_attrs);
+  }
+
+  SECTION("BuildConfig() groups lines with the same flags")
+  {
+    // Setup
+    const std::array<uint64_t, 4> kFlags = {
+      GPIO_V2_LINE_FLAG_INPUT,
+      GPIO_V2_LINE_FLAG_OUTPUT,
+      GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING,
+      GPIO_V2_LINE_FLAG_OUTPUT,
+    };
+
+    // Exercise
+    host::GpioChip::BuildConfig(kFlags, 0b1111, config);
+
+    // Verify
+    REQUIRE(3 == config.num_attrs);
+    CHECK(GPIO_V2_LINE_ATTR_ID_FLAGS == config.attrs[0].attr.id);
+    CHECK(GPIO_V2_LINE_FLAG_OUTPUT == config.attrs[0].attr.flags);
+    CHECK(0b1010 == config.attrs[0].mask);
+    CHECK(0b0100 == config.attrs[1].mask);
+    CHECK(GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES == config.attrs[2].attr.id);
+    CHECK(0b1010 == config.attrs[2].attr.values);
+    CHECK(0b1010 == config.attrs[2].mask);
+  }
+
+  SECTION("BuildConfig() throws with too many configurations")
+  {
+    // Setup
+    std::array<uint64_t, GPIO_V2_LINE_NUM_ATTRS_MAX + 1> flags;
+    for (size_t i = 0; i < flags.size(); i++)
+    {
+      flags[i] = GPIO_V2_LINE_FLAG_INPUT | (uint64_t{ 1 } << (i + 16));
+    }
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(host::GpioChip::BuildConfig(flags, 0, config),
+                    sjsu::Exception);
+  }
+
+  SECTION("Lines can be configured before the chip is initialized")
+  {
+    // Setup
+    const std::array<uint32_t, 2> kOffsets = { 17, 27 };
+    host::GpioChip chip("/dev/gpiochip-does-not-exist", kOffsets);
+    host::Gpio led(chip, 0);
+    host::Gpio button(chip, 1);
+
+    // Exercise
+    led.Initialize();
+    led.SetAsOutput();
+    led.SetHigh();
+    button.OnFallingEdge([]() {});
+
+    // Verify
+    CHECK(0 == chip.ProcessEvents(std::chrono::milliseconds(0)));
+    CHECK_THROWS_AS(chip.Initialize(), sjsu::Exception);
+  }
+}
+}  // namespace sjsu
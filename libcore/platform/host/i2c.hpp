@@ -0,0 +1,278 @@
+#pragma once
+
+#include <fcntl.h>
+#include <linux/i2c-dev.h>
+#include <linux/i2c.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include <libcore/peripherals/i2c.hpp>
+#include <libcore/platform/host/errno.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu::host
+{
+/// sjsu::I2c for Linux, backed by an i2c-dev character device such as
+/// `/dev/i2c-1`, so the same device drivers that run on the microcontrollers
+/// can run on an embedded Linux board.
+///
+/// Each transaction, including the repeated start of a WriteThenRead(), is
+/// sent to the kernel as a single I2C_RDWR ioctl, and Transactions() sends a
+/// whole batch in as few ioctls as the kernel allows, with repeated starts
+/// between the transactions. The two buffers of a WriteGather() are sent in
+/// place when the adapter supports I2C_M_NOSTART. The bus frequency is set by
+/// the device tree, so `settings` is not used.
+///
+/// USAGE:
+///
+///    sjsu::host::I2c i2c("/dev/i2c-1");
+///    i2c.Initialize();
+///    i2c.WriteThenRead(kAddress, { kWhoAmI }, response);
+class I2c : public sjsu::I2c
+{
+ public:
+  /// Most messages one transaction is sent as, a write phase of up to two
+  /// buffers followed by a read phase.
+  static constexpr size_t kMessagesPerTransaction = 3;
+
+  /// @param device_path - path of the i2c-dev device of the bus. Must outlive
+  ///        this object.
+  explicit I2c(const char * device_path) : device_path_(device_path) {}
+
+  I2c(const I2c &) = delete;
+  I2c & operator=(const I2c &) = delete;
+
+  ~I2c()
+  {
+    if (fd_ >= 0)
+    {
+      close(fd_);
+    }
+  }
+
+  /// @throw sjsu::Exception - with the error code of open() if the device
+  ///        could not be opened.
+  void ModuleInitialize() override
+  {
+    if (fd_ < 0)
+    {
+      fd_ = open(device_path_, O_RDWR | O_CLOEXEC);
+      if (fd_ < 0)
+      {
+        ThrowErrno("Could not open I2C device.");
+      }
+    }
+
+    unsigned long functionality = 0;  // NOLINT(google-runtime-int)
+    if (ioctl(fd_, I2C_FUNCS, &functionality) == 0)
+    {
+      can_skip_start_ = (functionality & I2C_FUNC_NOSTART) != 0;
+    }
+  }
+
+  /// @throw sjsu::Exception - std::errc::no_such_device_or_address if the
+  ///        device did not acknowledge, std::errc::timed_out if the adapter
+  ///        timed out, otherwise std::errc::io_error.
+  void Transaction(Transaction_t transaction) override
+  {
+    ThrowIfError(Submit(std::span(&transaction, 1)));
+  }
+
+  /// Send the whole batch to the kernel in one I2C_RDWR ioctl, or as few as
+  /// its message limit allows. The kernel does not report which transaction
+  /// of an ioctl failed, so when one does, that ioctl's transactions are sent
+  /// again one at a time to find the status of each. Transactions before the
+  /// failure are therefore repeated, so only batch transactions that are safe
+  /// to repeat, such as register reads, when a device may be missing.
+  size_t Transactions(std::span<Transaction_t> transactions) override
+  {
+    size_t successful = 0;
+
+    while (!transactions.empty())
+    {
+      const size_t kCount = std::min(transactions.size(), kTransactionsPerCall);
+      auto batch          = transactions.first(kCount);
+      transactions        = transactions.subspan(kCount);
+
+      std::errc status = Submit(batch);
+      for (auto & transaction : batch)
+      {
+        if (status != std::errc{} && batch.size() > 1)
+        {
+          transaction.status = Submit(std::span(&transaction, 1));
+        }
+        else
+        {
+          transaction.status = status;
+        }
+        transaction.busy = false;
+        successful += (transaction.status == std::errc{});
+      }
+    }
+
+    return successful;
+  }
+
+  /// Convert a transaction into the i2c_msg list of an I2C_RDWR ioctl.
+  ///
+  /// The `data_out_tail` of a gather write is sent in place as a message
+  /// without a start condition when the adapter supports I2C_M_NOSTART.
+  /// Otherwise both write buffers are joined in `gather`.
+  ///
+  /// @param transaction - the transaction to convert.
+  /// @param can_skip_start - if the adapter supports I2C_M_NOSTART.
+  /// @param messages - where the messages are written.
+  /// @param gather - buffer of transaction.TotalOutLength() bytes used to join
+  ///        the write buffers of a gather write when the adapter cannot skip
+  ///        the start. Can be empty otherwise.
+  /// @return size_t - number of messages written.
+  static size_t BuildMessages(
+      const Transaction_t & transaction,
+      bool can_skip_start,
+      std::span<i2c_msg, kMessagesPerTransaction> messages,
+      std::span<uint8_t> gather)
+  {
+    size_t count = 0;
+    auto add     = [&messages, &count, &transaction](
+                   uint16_t flags, const uint8_t * data, size_t length) {
+      messages[count++] = i2c_msg{
+        .addr  = transaction.address,
+        .flags = flags,
+        .len   = static_cast<uint16_t>(length),
+        .buf   = const_cast<uint8_t *>(data),
+      };
+    };
+
+    if (transaction.operation == Operation::kWrite)
+    {
+      if (transaction.out_tail_length == 0)
+      {
+        add(0, transaction.data_out, transaction.out_length);
+      }
+      else if (can_skip_start)
+      {
+        add(0, transaction.data_out, transaction.out_length);
+        add(I2C_M_NOSTART,
+            transaction.data_out_tail,
+            transaction.out_tail_length);
+      }
+      else
+      {
+        for (size_t i = 0; i < transaction.TotalOutLength(); i++)
+        {
+          gather[i] = transaction.GetOutByte(i);
+        }
+        add(0, gather.data(), transaction.TotalOutLength());
+      }
+    }
+
+    if (transaction.operation == Operation::kRead || transaction.repeated)
+    {
+      add(I2C_M_RD, transaction.data_in, transaction.in_length);
+    }
+
+    return count;
+  }
+
+ private:
+  static constexpr size_t kTransactionsPerCall =
+      I2C_RDWR_IOCTL_MAX_MSGS / kMessagesPerTransaction;
+
+  /// @return std::errc - the status of sending the transactions in one ioctl.
+  std::errc Submit(std::span<Transaction_t> transactions)
+  {
+    std::array<i2c_msg, I2C_RDWR_IOCTL_MAX_MSGS> messages;
+    size_t count = 0;
+
+    // Gather writes the adapter cannot send in place are joined one after
+    // the other in `gather_`, which is sized up front so it is not moved
+    // while the messages point into it.
+    size_t gather_length = 0;
+    for (const auto & transaction : transactions)
+    {
+      if (!can_skip_start_ && transaction.out_tail_length != 0)
+      {
+        gather_length += transaction.TotalOutLength();
+      }
+    }
+    gather_.resize(gather_length);
+    std::span<uint8_t> gather(gather_);
+
+    std::chrono::milliseconds timeout(0);
+    for (auto & transaction : transactions)
+    {
+      transaction.busy = true;
+      timeout          = std::max(timeout, transaction.timeout);
+      count += BuildMessages(
+          transaction,
+          can_skip_start_,
+          std::span(messages).subspan(count).first<kMessagesPerTransaction>(),
+          gather);
+      if (!can_skip_start_ && transaction.out_tail_length != 0)
+      {
+        gather = gather.subspan(transaction.TotalOutLength());
+      }
+    }
+
+    SetTimeout(timeout);
+
+    i2c_rdwr_ioctl_data request = {
+      .msgs  = messages.data(),
+      .nmsgs = static_cast<uint32_t>(count),
+    };
+
+    std::errc status = std::errc{};
+    if (ioctl(fd_, I2C_RDWR, &request) < 0)
+    {
+      status = ToStatus(errno);
+    }
+
+    for (auto & transaction : transactions)
+    {
+      transaction.busy = false;
+    }
+    return status;
+  }
+
+  /// Only change the adapter timeout when it differs from the last one set,
+  /// to save a syscall per transaction.
+  void SetTimeout(std::chrono::milliseconds timeout)
+  {
+    // The kernel counts the timeout in units of 10ms.
+    const auto kTicks = static_cast<unsigned long>(  // NOLINT
+        (timeout.count() + 9) / 10);
+    if (kTicks != timeout_ticks_)
+    {
+      ioctl(fd_, I2C_TIMEOUT, kTicks);
+      timeout_ticks_ = kTicks;
+    }
+  }
+
+  static std::errc ToStatus(int error)
+  {
+    switch (error)
+    {
+      case ENXIO:
+      case EREMOTEIO: return std::errc::no_such_device_or_address;
+      case ETIMEDOUT: return std::errc::timed_out;
+      default: return std::errc::io_error;
+    }
+  }
+
+  const char * device_path_;
+  int fd_                      = -1;
+  bool can_skip_start_         = false;
+  unsigned long timeout_ticks_ = 0;  // NOLINT(google-runtime-int)
+  std::vector<uint8_t> gather_;
+};
+}  // namespace sjsu::host
@@ -0,0 +1,102 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/platform/host/i2c.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+TEST_CASE("Testing host i2c")
+{
+  constexpr uint8_t kAddress = 0x1D;
+  std::array<i2c_msg, host::I2c::kMessagesPerTransaction> messages;
+  const std::array<uint8_t, 1> kRegister = { 0x0F };
+  const std::array<uint8_t, 3> kPayload  = { 1, 2, 3 };
+  std::array<uint8_t, 2> receive;
+
+  SECTION("WriteThenRead is a write and a read message")
+  {
+    // Setup
+    I2c::Transaction_t transaction = {
+      .operation  = I2c::Operation::kWrite,
+      .address    = kAddress,
+      .data_out   = kRegister.data(),
+      .out_length = kRegister.size(),
+      .data_in    = receive.data(),
+      .in_length  = receive.size(),
+      .repeated   = true,
+    };
+
+    // Exercise
+    size_t count = host::I2c::BuildMessages(transaction, false, messages, {});
+
+    // Verify
+    REQUIRE(2 == count);
+    CHECK(kAddress == messages[0].addr);
+    CHECK(0 == messages[0].flags);
+    CHECK(kRegister.data() == messages[0].buf);
+    CHECK(1 == messages[0].len);
+    CHECK(I2C_M_RD == messages[1].flags);
+    CHECK(receive.data() == messages[1].buf);
+    CHECK(2 == messages[1].len);
+  }
+
+  SECTION("Read is a single read message")
+  {
+    // Setup
+    I2c::Transaction_t transaction = {
+      .operation = I2c::Operation::kRead,
+      .address   = kAddress,
+      .data_in   = receive.data(),
+      .in_length = receive.size(),
+    };
+
+    // Exercise
+    size_t count = host::I2c::BuildMessages(transaction, false, messages, {});
+
+    // Verify
+    REQUIRE(1 == count);
+    CHECK(I2C_M_RD == messages[0].flags);
+  }
+
+  SECTION("Gather write")
+  {
+    // Setup
+    I2c::Transaction_t transaction = {
+      .operation       = I2c::Operation::kWrite,
+      .address         = kAddress,
+      .data_out        = kRegister.data(),
+      .out_length      = kRegister.size(),
+      .data_out_tail   = kPayload.data(),
+      .out_tail_length = kPayload.size(),
+    };
+    std::array<uint8_t, 4> gather;
+
+    SECTION("is joined when the adapter cannot skip the start")
+    {
+      // Exercise
+      size_t count =
+          host::I2c::BuildMessages(transaction, false, messages, gather);
+
+      // Verify
+      REQUIRE(1 == count);
+      CHECK(kAddress == messages[0].addr);
+      CHECK(gather.data() == messages[0].buf);
+      CHECK(4 == messages[0].len);
+      CHECK(std::array<uint8_t, 4>{ 0x0F, 1, 2, 3 } == gather);
+    }
+
+    SECTION("is sent in place when the adapter can skip the start")
+    {
+      // Exercise
+      size_t count = host::I2c::BuildMessages(transaction, true, messages, {});
+
+      // Verify
+      REQUIRE(2 == count);
+      CHECK(kRegister.data() == messages[0].buf);
+      CHECK(I2C_M_NOSTART == messages[1].flags);
+      CHECK(kPayload.data() == messages[1].buf);
+      CHECK(3 == messages[1].len);
+    }
+  }
+}
+}  // namespace sjsu
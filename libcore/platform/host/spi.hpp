@@ -0,0 +1,257 @@
+#pragma once
+
+#include <fcntl.h>
+#include <linux/spi/spidev.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/platform/host/errno.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu::host
+{
+/// sjsu::Spi for Linux, backed by a spidev character device such as
+/// `/dev/spidev0.0`. The chip select of the spidev device is asserted for the
+/// length of each Transfer().
+///
+/// Every Transfer() is a single SPI_IOC_MESSAGE ioctl. A list of segments
+/// becomes one spi_ioc_transfer per segment in that ioctl, so a command and
+/// its payload, or a whole display refresh, cost one syscall rather than one
+/// per buffer. Initialize() only changes the mode, frame size and clock rate
+/// of the device when they differ from the ones last applied.
+///
+/// USAGE:
+///
+///    sjsu::host::Spi spi("/dev/spidev0.0");
+///    spi.settings.clock_rate = 8_MHz;
+///    spi.Initialize();
+///    spi.Transfer({
+///        Spi::Segment_t{ .transmit = kCommand },
+///        Spi::Segment_t{ .transmit = framebuffer },
+///    });
+class Spi : public sjsu::Spi
+{
+ public:
+  /// Most transfers the kernel accepts in one SPI_IOC_MESSAGE ioctl.
+  static constexpr size_t kMaximumTransfers =
+      ((1 << _IOC_SIZEBITS) - 1) / sizeof(spi_ioc_transfer);
+
+  /// @param device_path - path of the spidev device. Must outlive this
+  ///        object.
+  explicit Spi(const char * device_path) : device_path_(device_path) {}
+
+  Spi(const Spi &) = delete;
+  Spi & operator=(const Spi &) = delete;
+
+  ~Spi()
+  {
+    if (fd_ >= 0)
+    {
+      close(fd_);
+    }
+  }
+
+  /// @throw sjsu::Exception - with the error code of the system call that
+  ///        failed, if the device could not be opened or configured.
+  void ModuleInitialize() override
+  {
+    if (fd_ < 0)
+    {
+      fd_ = open(device_path_, O_RDWR | O_CLOEXEC);
+      if (fd_ < 0)
+      {
+        ThrowErrno("Could not open SPI device.");
+      }
+    }
+
+    uint8_t mode = SPI_MODE_0;
+    if (settings.polarity == SpiSettings_t::Polarity::kIdleHigh)
+    {
+      mode |= SPI_CPOL;
+    }
+    if (settings.phase == SpiSettings_t::Phase::kSampleTrailing)
+    {
+      mode |= SPI_CPHA;
+    }
+    const uint8_t kBits   = static_cast<uint8_t>(settings.frame_size) + 4;
+    const uint32_t kSpeed = settings.clock_rate.to<uint32_t>();
+
+    Apply(SPI_IOC_WR_MODE, mode, applied_mode_);
+    Apply(SPI_IOC_WR_BITS_PER_WORD, kBits, applied_bits_);
+    Apply(SPI_IOC_WR_MAX_SPEED_HZ, kSpeed, applied_speed_);
+  }
+
+  void Transfer(std::span<uint8_t> buffer) override
+  {
+    Transfer(buffer, buffer);
+  }
+
+  /// @throw sjsu::Exception - std::errc::invalid_argument if the frame size
+  ///        is 8 bits or less, as spidev only packs frames of more than 8 bits
+  ///        into 16-bit words.
+  void Transfer(std::span<uint16_t> buffer) override
+  {
+    if (applied_bits_ <= 8)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "16-bit transfers need a frame size above 8 bits.");
+    }
+
+    spi_ioc_transfer transfer{};
+    transfer.tx_buf        = ToAddress(buffer.data());
+    transfer.rx_buf        = ToAddress(buffer.data());
+    transfer.len           = static_cast<uint32_t>(buffer.size_bytes());
+    transfer.bits_per_word = applied_bits_;
+
+    transfers_.assign(1, transfer);
+    Submit();
+  }
+
+  void Transfer(std::span<const uint8_t> transmit,
+                std::span<uint8_t> receive) override
+  {
+    const Segment_t kSegment{ .transmit = transmit, .receive = receive };
+    Transfer(std::span(&kSegment, 1));
+  }
+
+  /// @throw sjsu::Exception - std::errc::argument_list_too_long if the
+  ///        segments need more than kMaximumTransfers transfers.
+  void Transfer(std::span<const Segment_t> segments) override
+  {
+    size_t filler_length = 0;
+    for (const auto & segment : segments)
+    {
+      if (segment.receive.size() > segment.transmit.size())
+      {
+        filler_length = std::max(
+            filler_length, segment.receive.size() - segment.transmit.size());
+      }
+    }
+    filler_.resize(filler_length, kFillerByte);
+
+    transfers_.clear();
+    BuildTransfers(segments, filler_, transfers_);
+    Submit();
+  }
+
+  using sjsu::Spi::Transfer;
+
+  /// Convert a list of segments into the spi_ioc_transfer list of an
+  /// SPI_IOC_MESSAGE ioctl. The kernel needs both buffers of a transfer to be
+  /// the same length, so a segment with buffers of different lengths is split
+  /// in two: one where both are used, and one for the rest of the longer
+  /// buffer, which sends `filler` or discards the bytes received.
+  ///
+  /// @param segments - the segments to convert.
+  /// @param filler - kFillerByte bytes, at least as many as the longest part
+  ///        of a receive buffer that is longer than its transmit buffer.
+  /// @param transfers - list the transfers are appended to.
+  static void BuildTransfers(std::span<const Segment_t> segments,
+                             std::span<const uint8_t> filler,
+                             std::vector<spi_ioc_transfer> & transfers)
+  {
+    for (const auto & segment : segments)
+    {
+      const size_t kBoth =
+          std::min(segment.transmit.size(), segment.receive.size());
+
+      if (kBoth > 0)
+      {
+        Append(transfers,
+               segment.transmit.data(),
+               segment.receive.data(),
+               kBoth);
+      }
+
+      if (segment.transmit.size() > kBoth)
+      {
+        Append(transfers,
+               segment.transmit.data() + kBoth,
+               nullptr,
+               segment.transmit.size() - kBoth);
+      }
+      else if (segment.receive.size() > kBoth)
+      {
+        Append(transfers,
+               filler.data(),
+               segment.receive.data() + kBoth,
+               segment.receive.size() - kBoth);
+      }
+    }
+  }
+
+ private:
+  static uint64_t ToAddress(const void * pointer)
+  {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer));
+  }
+
+  static void Append(std::vector<spi_ioc_transfer> & transfers,
+                     const uint8_t * transmit,
+                     uint8_t * receive,
+                     size_t length)
+  {
+    // The kernel asks for the unused fields to be zeroed.
+    spi_ioc_transfer transfer{};
+    transfer.tx_buf = ToAddress(transmit);
+    transfer.rx_buf = ToAddress(receive);
+    transfer.len    = static_cast<uint32_t>(length);
+    transfers.push_back(transfer);
+  }
+
+  /// Write a setting to the device, only if it is different from the one
+  /// last applied.
+  template <typename T>
+  void Apply(unsigned long request, T value, T & applied)  // NOLINT
+  {
+    if (value == applied)
+    {
+      return;
+    }
+
+    if (ioctl(fd_, request, &value) < 0)
+    {
+      ThrowErrno("Could not configure SPI device.");
+    }
+    applied = value;
+  }
+
+  void Submit()
+  {
+    if (transfers_.empty())
+    {
+      return;
+    }
+
+    if (transfers_.size() > kMaximumTransfers)
+    {
+      throw Exception(std::errc::argument_list_too_long,
+                      "Too many segments for one SPI transfer.");
+    }
+
+    // The same request as SPI_IOC_MESSAGE(N), for a list sized at runtime.
+    const auto kSize    = transfers_.size() * sizeof(spi_ioc_transfer);
+    const auto kRequest = _IOC(_IOC_WRITE, SPI_IOC_MAGIC, 0, kSize);
+    if (ioctl(fd_, kRequest, transfers_.data()) < 0)
+    {
+      ThrowErrno("SPI transfer failed.");
+    }
+  }
+
+  const char * device_path_;
+  int fd_                 = -1;
+  uint8_t applied_mode_   = 0xFF;
+  uint8_t applied_bits_   = 0;
+  uint32_t applied_speed_ = 0;
+  std::vector<spi_ioc_transfer> transfers_;
+  std::vector<uint8_t> filler_;
+};
+}  // namespace sjsu::host
@@ -0,0 +1,65 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/platform/host/spi.hpp>
+
+#include <array>
+#include <vector>
+
+namespace sjsu
+{
+namespace
+{
+uint64_t AddressOf(const void * pointer)
+{
+  return reinterpret_cast<uintptr_t>(pointer);
+}
+}  // namespace
+
+TEST_CASE("Testing host spi")
+{
+  const std::array<uint8_t, 2> kCommand = { 0x9F, 0x00 };
+  const std::array<uint8_t, 4> kFiller  = { 0xFF, 0xFF, 0xFF, 0xFF };
+  std::array<uint8_t, 5> receive;
+  std::vector<spi_ioc_transfer> transfers;
+
+  SECTION("A segment per transfer")
+  {
+    // Setup
+    const std::array<Spi::Segment_t, 2> kSegments = {
+      Spi::Segment_t{ .transmit = kCommand },
+      Spi::Segment_t{ .receive = std::span(receive).first(2) },
+    };
+
+    // Exercise
+    host::Spi::BuildTransfers(kSegments, kFiller, transfers);
+
+    // Verify
+    REQUIRE(2 == transfers.size());
+    CHECK(AddressOf(kCommand.data()) == transfers[0].tx_buf);
+    CHECK(0 == transfers[0].rx_buf);
+    CHECK(2 == transfers[0].len);
+    CHECK(AddressOf(kFiller.data()) == transfers[1].tx_buf);
+    CHECK(AddressOf(receive.data()) == transfers[1].rx_buf);
+    CHECK(2 == transfers[1].len);
+  }
+
+  SECTION("Buffers of different lengths are split")
+  {
+    // Setup
+    const std::array<Spi::Segment_t, 1> kSegments = {
+      Spi::Segment_t{ .transmit = kCommand, .receive = receive },
+    };
+
+    // Exercise
+    host::Spi::BuildTransfers(kSegments, kFiller, transfers);
+
+    // Verify
+    REQUIRE(2 == transfers.size());
+    CHECK(AddressOf(kCommand.data()) == transfers[0].tx_buf);
+    CHECK(AddressOf(receive.data()) == transfers[0].rx_buf);
+    CHECK(2 == transfers[0].len);
+    CHECK(AddressOf(kFiller.data()) == transfers[1].tx_buf);
+    CHECK(AddressOf(&receive[2]) == transfers[1].rx_buf);
+    CHECK(3 == transfers[1].len);
+  }
+}
+}  // namespace sjsu
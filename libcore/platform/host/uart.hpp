@@ -0,0 +1,310 @@
+#pragma once
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/platform/host/errno.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu::host
+{
+/// sjsu::Uart for Linux, backed by a serial tty such as `/dev/ttyUSB0`.
+///
+/// The port is kept nonblocking and registered with its own epoll instance.
+/// HasData() answers from a cached readable state that is only refreshed after
+/// a Read(), and Read() with a timeout sleeps in epoll_wait() rather than
+/// spinning in sjsu::Wait(), so a process bridging many ports does not burn a
+/// core polling them. EventFd() can be added to a
+/// gateway's own epoll loop to wait on several ports at once.
+///
+/// USAGE:
+///
+///    sjsu::host::Uart uart("/dev/ttyUSB0");
+///    uart.settings.baud_rate = 115200;
+///    uart.Initialize();
+///    size_t count = uart.Read(buffer, 100ms);
+class Uart : public sjsu::Uart
+{
+ public:
+  /// @param device_path - path of the tty device. Must outlive this object.
+  explicit Uart(const char * device_path) : device_path_(device_path) {}
+
+  Uart(const Uart &) = delete;
+  Uart & operator=(const Uart &) = delete;
+
+  ~Uart()
+  {
+    if (epoll_fd_ >= 0)
+    {
+      close(epoll_fd_);
+    }
+    if (fd_ >= 0)
+    {
+      close(fd_);
+    }
+  }
+
+  /// @throw sjsu::Exception - std::errc::invalid_argument if the baud rate,
+  ///        frame size or address matching is not supported by termios,
+  ///        otherwise with the error code of the system call that failed.
+  void ModuleInitialize() override
+  {
+    if (fd_ < 0)
+    {
+      fd_ = open(device_path_, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+      if (fd_ < 0)
+      {
+        ThrowErrno("Could not open serial device.");
+      }
+
+      epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+      if (epoll_fd_ < 0)
+      {
+        ThrowErrno("Could not create epoll instance.");
+      }
+
+      epoll_event event = { .events = EPOLLIN, .data = { .fd = fd_ } };
+      if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd_, &event) < 0)
+      {
+        ThrowErrno("Could not watch serial device.");
+      }
+    }
+
+    termios options;
+    if (tcgetattr(fd_, &options) < 0)
+    {
+      ThrowErrno("Could not read serial device settings.");
+    }
+
+    BuildTermios(settings, options);
+
+    if (tcsetattr(fd_, TCSANOW, &options) < 0)
+    {
+      ThrowErrno("Could not configure serial device.");
+    }
+  }
+
+  /// @return true - if the port is readable. Readiness is taken from the
+  ///         epoll wait of Read() with a timeout and from the last Read(),
+  ///         which leaves the port readable when it filled its buffer, so
+  ///         draining the port costs no syscalls beyond the reads. Only when
+  ///         the port was last seen drained is the kernel asked again. May
+  ///         return true once after a Read() that exactly filled its buffer,
+  ///         in which case the next Read() returns 0.
+  bool HasData() override
+  {
+    if (!readable_)
+    {
+      WaitReadable(0);
+    }
+    return readable_;
+  }
+
+  /// Blocks until every byte has been handed to the kernel. The kernel
+  /// transmits them in the background.
+  ///
+  /// @throw sjsu::Exception - with the error code of write() if it failed.
+  void Write(std::span<const uint8_t> data) override
+  {
+    while (!data.empty())
+    {
+      ssize_t written = write(fd_, data.data(), data.size());
+      if (written >= 0)
+      {
+        data = data.subspan(static_cast<size_t>(written));
+      }
+      else if (errno == EAGAIN)
+      {
+        pollfd writable = { .fd = fd_, .events = POLLOUT, .revents = 0 };
+        poll(&writable, 1, -1);
+      }
+      else if (errno != EINTR)
+      {
+        ThrowErrno("Could not write to serial device.");
+      }
+    }
+  }
+
+  size_t Read(std::span<uint8_t> data) override
+  {
+    if (data.empty())
+    {
+      return 0;
+    }
+
+    ssize_t received = read(fd_, data.data(), data.size());
+    if (received <= 0)
+    {
+      readable_ = false;
+      return 0;
+    }
+    // A read that came up short drained the kernel's buffer. One that filled
+    // `data` may have left bytes behind.
+    readable_ = (static_cast<size_t>(received) == data.size());
+    return static_cast<size_t>(received);
+  }
+
+  /// Sleeps in epoll_wait() until bytes arrive, rather than polling. Returns
+  /// once `data` is full or the timeout elapses.
+  size_t Read(std::span<uint8_t> data,
+              std::chrono::nanoseconds timeout) override
+  {
+    using std::chrono::steady_clock;
+    const bool kForever = (timeout == std::chrono::nanoseconds::max());
+    const auto kDeadline = kForever ? steady_clock::time_point::max()
+                                    : steady_clock::now() + timeout;
+
+    size_t position = Read(data);
+    while (position < data.size())
+    {
+      int milliseconds = -1;
+      if (!kForever)
+      {
+        const auto kRemaining = kDeadline - steady_clock::now();
+        if (kRemaining <= std::chrono::nanoseconds(0))
+        {
+          break;
+        }
+        // Round up, so a wait shorter than a millisecond still sleeps.
+        milliseconds = static_cast<int>(
+            std::chrono::ceil<std::chrono::milliseconds>(kRemaining).count());
+      }
+
+      if (WaitReadable(milliseconds))
+      {
+        position += Read(data.subspan(position));
+      }
+    }
+
+    return position;
+  }
+
+  using sjsu::Uart::Read;
+
+  /// Discard received bytes still in the kernel's buffer.
+  void Flush() override
+  {
+    tcflush(fd_, TCIFLUSH);
+    readable_ = false;
+  }
+
+  /// @return int - epoll file descriptor that becomes readable when this port
+  ///         has data, or -1 before Initialize().
+  int EventFd() const
+  {
+    return epoll_fd_;
+  }
+
+  /// Convert sjsu::UartSettings_t into a raw mode termios structure.
+  ///
+  /// @param settings - the settings to convert.
+  /// @param options - termios structure to modify. Fields that settings do
+  ///        not cover are left as they are.
+  /// @throw sjsu::Exception - std::errc::invalid_argument if the baud rate,
+  ///        frame size or address matching has no termios equivalent.
+  static void BuildTermios(const UartSettings_t & settings, termios & options)
+  {
+    if (settings.address_match != UartSettings_t::AddressMatch::kDisabled)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Multidrop addressing is not supported by termios.");
+    }
+
+    cfmakeraw(&options);
+    options.c_cflag |= CLOCAL | CREAD;
+    options.c_cflag &= ~(CSIZE | CSTOPB | PARENB | PARODD | CRTSCTS);
+
+    switch (settings.frame_size)
+    {
+      case UartSettings_t::FrameSize::kFiveBits: options.c_cflag |= CS5; break;
+      case UartSettings_t::FrameSize::kSixBits: options.c_cflag |= CS6; break;
+      case UartSettings_t::FrameSize::kSevenBits: options.c_cflag |= CS7; break;
+      case UartSettings_t::FrameSize::kEightBits: options.c_cflag |= CS8; break;
+      default:
+        throw Exception(std::errc::invalid_argument,
+                        "Frame size is not supported by termios.");
+    }
+
+    if (settings.stop == UartSettings_t::StopBits::kDouble)
+    {
+      options.c_cflag |= CSTOPB;
+    }
+
+    if (settings.parity == UartSettings_t::Parity::kOdd)
+    {
+      options.c_cflag |= PARENB | PARODD;
+    }
+    else if (settings.parity == UartSettings_t::Parity::kEven)
+    {
+      options.c_cflag |= PARENB;
+    }
+
+    // Reads return whatever is available without waiting.
+    options.c_cc[VMIN]  = 0;
+    options.c_cc[VTIME] = 0;
+
+    const speed_t kSpeed = ToSpeed(settings.baud_rate);
+    cfsetispeed(&options, kSpeed);
+    cfsetospeed(&options, kSpeed);
+  }
+
+ private:
+  struct BaudRate_t
+  {
+    uint32_t rate;
+    speed_t speed;
+  };
+
+  static constexpr std::array kBaudRates = {
+    BaudRate_t{ 1200, B1200 },       BaudRate_t{ 2400, B2400 },
+    BaudRate_t{ 4800, B4800 },       BaudRate_t{ 9600, B9600 },
+    BaudRate_t{ 19200, B19200 },     BaudRate_t{ 38400, B38400 },
+    BaudRate_t{ 57600, B57600 },     BaudRate_t{ 115200, B115200 },
+    BaudRate_t{ 230400, B230400 },   BaudRate_t{ 460800, B460800 },
+    BaudRate_t{ 921600, B921600 },   BaudRate_t{ 1000000, B1000000 },
+    BaudRate_t{ 2000000, B2000000 }, BaudRate_t{ 3000000, B3000000 },
+  };
+
+  static speed_t ToSpeed(uint32_t baud_rate)
+  {
+    for (const auto & entry : kBaudRates)
+    {
+      if (entry.rate == baud_rate)
+      {
+        return entry.speed;
+      }
+    }
+    throw Exception(std::errc::invalid_argument,
+                    "Baud rate is not supported by termios.");
+  }
+
+  /// Wait for the port to become readable and update the cached state.
+  ///
+  /// @param milliseconds - how long to wait, 0 to return immediately or -1 to
+  ///        wait forever.
+  /// @return true - if the port is readable.
+  bool WaitReadable(int milliseconds)
+  {
+    epoll_event event;
+    readable_ = (epoll_wait(epoll_fd_, &event, 1, milliseconds) > 0);
+    return readable_;
+  }
+
+  const char * device_path_;
+  int fd_        = -1;
+  int epoll_fd_  = -1;
+  bool readable_ = false;
+};
+}  // namespace sjsu::host
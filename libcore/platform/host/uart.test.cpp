@@ -0,0 +1,91 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/platform/host/uart.hpp>
+
+#include <stdlib.h>
+
+#include <array>
+
+namespace sjsu
+{
+TEST_CASE("Testing host uart")
+{
+  termios options{};
+  UartSettings_t settings;
+
+  SECTION("BuildTermios() 8N1")
+  {
+    // Setup
+    settings.baud_rate = 115200;
+
+    // Exercise
+    host::Uart::BuildTermios(settings, options);
+
+    // Verify
+    CHECK(CS8 == (options.c_cflag & CSIZE));
+    CHECK(0 == (options.c_cflag & (CSTOPB | PARENB)));
+    CHECK(B115200 == cfgetospeed(&options));
+    CHECK(0 == options.c_cc[VMIN]);
+  }
+
+  SECTION("BuildTermios() 7O2")
+  {
+    // Setup
+    settings.frame_size = UartSettings_t::FrameSize::kSevenBits;
+    settings.stop       = UartSettings_t::StopBits::kDouble;
+    settings.parity     = UartSettings_t::Parity::kOdd;
+
+    // Exercise
+    host::Uart::BuildTermios(settings, options);
+
+    // Verify
+    CHECK(CS7 == (options.c_cflag & CSIZE));
+    CHECK(CSTOPB == (options.c_cflag & CSTOPB));
+    CHECK((PARENB | PARODD) == (options.c_cflag & (PARENB | PARODD)));
+  }
+
+  SECTION("BuildTermios() rejects unsupported settings")
+  {
+    settings.baud_rate = 12345;
+    CHECK_THROWS_AS(host::Uart::BuildTermios(settings, options),
+                    sjsu::Exception);
+
+    settings.baud_rate  = 9600;
+    settings.frame_size = UartSettings_t::FrameSize::kNineBits;
+    CHECK_THROWS_AS(host::Uart::BuildTermios(settings, options),
+                    sjsu::Exception);
+
+    settings.frame_size    = UartSettings_t::FrameSize::kEightBits;
+    settings.address_match = UartSettings_t::AddressMatch::kNodeAddress;
+    CHECK_THROWS_AS(host::Uart::BuildTermios(settings, options),
+                    sjsu::Exception);
+  }
+
+  SECTION("Read and write through a pseudo terminal")
+  {
+    // Setup
+    int controller = posix_openpt(O_RDWR | O_NOCTTY);
+    REQUIRE(controller >= 0);
+    REQUIRE(0 == grantpt(controller));
+    REQUIRE(0 == unlockpt(controller));
+
+    host::Uart uart(ptsname(controller));
+    uart.Initialize();
+    std::array<uint8_t, 3> received = {};
+    const std::array<uint8_t, 3> kExpected = { 'a', 'b', 'c' };
+
+    // Exercise & Verify
+    CHECK(!uart.HasData());
+    CHECK(0 == uart.Read(received, std::chrono::milliseconds(1)));
+
+    REQUIRE(3 == write(controller, kExpected.data(), kExpected.size()));
+    CHECK(3 == uart.Read(received, std::chrono::milliseconds(500)));
+    CHECK(kExpected == received);
+    // The read filled its buffer, so whether bytes remain is only known once
+    // the next read comes up short.
+    CHECK(0 == uart.Read(received));
+    CHECK(!uart.HasData());
+
+    close(controller);
+  }
+}
+}  // namespace sjsu
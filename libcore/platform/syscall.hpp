@@ -4,8 +4,12 @@
 #include <functional>
 #include <libcore/peripherals/uart.hpp>
 #include <libcore/utility/ansi_terminal_codes.hpp>
+#include <libcore/utility/buffered_writer.hpp>
 #include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/error_ring.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/log.hpp>
+#include <libcore/utility/log_ring.hpp>
 #include <libcore/utility/memory_resource.hpp>
 #include <span>
 #include <vector>
@@ -15,8 +19,8 @@ namespace sjsu
 class SysCall
 {
  public:
-  using write_function = std::function<int(FILE *, const char *, int)>;
-  using read_function  = std::function<int(FILE *, char *, int)>;
+  using write_function = InplaceFunction<int(FILE *, const char *, int)>;
+  using read_function  = InplaceFunction<int(FILE *, char *, int)>;
 
   /// Write to a resource
   virtual const std::span<write_function> GetWriter() = 0;
@@ -39,27 +43,36 @@ class SysCall
   /// @param serial_port
   void AddSerial(sjsu::Uart & serial_port)
   {
-    // Create a routine for writing to the UART port
-    AddWriter(
-        [&serial_port](FILE *, const char * buffer, int length) -> int
-        {
-          serial_port.Write(std::span<const std::byte>(
-              reinterpret_cast<const std::byte *>(buffer), length));
-          return length;
-        });
+    AddWriter(SerialWriter(serial_port));
+    AddReader(SerialReader(serial_port));
+  }
 
-    // Create a routine for reading to the UART port
-    AddReader(
-        [&serial_port](FILE *, char * buffer, int length) -> int
-        {
-          if (serial_port.HasData())
-          {
-            int bytes_read = serial_port.Read(std::span<std::byte>(
-                reinterpret_cast<std::byte *>(buffer), length));
-            return bytes_read;
-          }
-          return 0;
-        });
+  /// @param serial_port - port to write to.
+  /// @return write_function - a writer that writes to the port.
+  static write_function SerialWriter(sjsu::Uart & serial_port)
+  {
+    return [&serial_port](FILE *, const char * buffer, int length) -> int
+    {
+      serial_port.Write(std::span<const std::byte>(
+          reinterpret_cast<const std::byte *>(buffer), length));
+      return length;
+    };
+  }
+
+  /// @param serial_port - port to read from.
+  /// @return read_function - a reader that reads from the port.
+  static read_function SerialReader(sjsu::Uart & serial_port)
+  {
+    return [&serial_port](FILE *, char * buffer, int length) -> int
+    {
+      if (serial_port.HasData())
+      {
+        int bytes_read = serial_port.Read(std::span<std::byte>(
+            reinterpret_cast<std::byte *>(buffer), length));
+        return bytes_read;
+      }
+      return 0;
+    };
   }
 };
 
@@ -130,6 +143,67 @@ class SysCallManager
     return *platform_newlib;
   }
 
+  /// Buffer everything written to stdio in `ring` rather than passing it to
+  /// the writers straight away. Printing then only costs a copy into the
+  /// ring, and the writers are only called by DrainLogs(), which should be
+  /// called regularly from a context that can afford to wait on them, such
+  /// as the idle loop.
+  ///
+  /// @param ring - buffer for stdio output. Pass nullptr to go back to
+  ///        calling the writers directly. Must outlive its use here.
+  static void SetLogRing(LogRing * ring)
+  {
+    log_ring = ring;
+  }
+
+  /// Pass everything buffered in the log ring to the writers. Does nothing if
+  /// no log ring is set. Must only be called from one context at a time.
+  ///
+  /// @return size_t - the number of bytes passed to the writers.
+  static size_t DrainLogs()
+  {
+    if (log_ring == nullptr)
+    {
+      return 0;
+    }
+
+    const size_t kDrained = log_ring->Drain(
+        [](std::span<const uint8_t> chunk)
+        {
+          WriteToWriters(&stdio,
+                         reinterpret_cast<const char *>(chunk.data()),
+                         chunk.size());
+        });
+    FlushWriters();
+    return kDrained;
+  }
+
+  /// Ask every writer to pass on what it has buffered, such as a
+  /// BufferedWriter, by giving each a write of length 0. Writers without a
+  /// buffer write nothing. Called whenever stdio is flushed, and before the
+  /// program halts.
+  static void FlushWriters()
+  {
+    WriteToWriters(&stdio, nullptr, 0);
+  }
+
+  /// Record uncaught sjsu::Exception errors in `ring` before they are
+  /// printed, so they can be inspected after the reset that follows. See
+  /// ErrorRing.
+  ///
+  /// @param ring - ring to record errors in, typically declared SJ2_NO_INIT.
+  ///        Pass nullptr to stop recording. Must outlive its use here.
+  static void SetErrorRing(ErrorRing * ring)
+  {
+    error_ring = ring;
+  }
+
+  /// @return ErrorRing* - the ring set by SetErrorRing(), or nullptr.
+  static ErrorRing * GetErrorRing()
+  {
+    return error_ring;
+  }
+
   static void HandleExceptionPointer(std::exception_ptr exception_pointer)
   {
     sjsu::log::Critical("Uncaught exception: ");
@@ -142,10 +216,14 @@ class SysCallManager
     }
     catch (const std::exception & e)
     {
-      sjsu::log::Critical("std::exception(%s)\n", e.what());
+      sjsu::log::Critical("std::exception({})\n", e.what());
     }
     catch (sjsu::Exception & e)
     {
+      if (error_ring != nullptr)
+      {
+        error_ring->Record(e);
+      }
       e.Print();
     }
     catch (...)
@@ -156,6 +234,18 @@ class SysCallManager
 
  protected:
   static int Write(FILE * file, const char * source_buffer, size_t length)
+  {
+    if (log_ring != nullptr)
+    {
+      log_ring->Write(source_buffer, length);
+      return length;
+    }
+    return WriteToWriters(file, source_buffer, length);
+  }
+
+  static int WriteToWriters(FILE * file,
+                            const char * source_buffer,
+                            size_t length)
   {
     for (auto writer : Get().GetWriter())
     {
@@ -182,6 +272,10 @@ class SysCallManager
   {
     Write(file, buffer.data(), buffer.size());
     buffer.clear();
+    if (log_ring == nullptr)
+    {
+      FlushWriters();
+    }
     return 0;
   }
 
@@ -211,6 +305,8 @@ class SysCallManager
 
   inline static StaticSysCall<2> default_newlib;
   inline static SysCall * platform_newlib = &default_newlib;
+  inline static LogRing * log_ring        = nullptr;
+  inline static ErrorRing * error_ring    = nullptr;
   inline static sjsu::StaticMemoryResource<BUFSIZ> memory_resource;
   inline static std::pmr::vector<char> buffer;
 
@@ -240,6 +336,8 @@ extern "C"
     }
 
     sjsu::SysCallManager::HandleExceptionPointer(std::current_exception());
+    sjsu::SysCallManager::DrainLogs();
+    sjsu::SysCallManager::FlushWriters();
 
     while (1)
     {
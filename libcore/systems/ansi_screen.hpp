@@ -0,0 +1,381 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu
+{
+/// Text user interface for a serial console, such as a live dashboard shown
+/// by a terminal emulator connected to a Uart.
+///
+/// The screen is held in RAM as a grid of character cells. Drawing methods
+/// only change the cells, and Refresh() sends the terminal the ANSI escape
+/// sequences needed to bring it up to date: a cursor move to each run of
+/// changed cells, a change of style when it differs from the last one sent,
+/// and the changed characters. Unchanged parts of the screen are never sent
+/// again, so a dashboard updating a few numbers costs a few dozen bytes per
+/// refresh rather than a whole screen, which takes 170 ms at 115200 baud for
+/// 80 x 24 characters.
+///
+/// The screen keeps two copies of the grid, the wanted cells and the cells
+/// the terminal shows, so it uses 8 bytes of RAM per character.
+///
+/// USAGE:
+///
+///    using Screen = sjsu::AnsiScreen<80, 24>;
+///    Screen screen(uart);
+///
+///    screen.Print(0, 0, "Motor controller", { .bold = true });
+///    while (true)
+///    {
+///      screen.Print(0, 2, FormatRpm(rpm),
+///                   { .foreground = Screen::Color::kGreen });
+///      screen.Refresh();
+///    }
+///
+/// @tparam kColumns - number of columns of the screen.
+/// @tparam kRows - number of rows of the screen.
+template <size_t kColumns, size_t kRows>
+class AnsiScreen
+{
+ public:
+  static_assert(kColumns > 0 && kRows > 0, "Screen must not be empty.");
+
+  /// The 8 standard ANSI colors, and the terminal's own color.
+  enum class Color : uint8_t
+  {
+    kDefault,
+    kBlack,
+    kRed,
+    kGreen,
+    kYellow,
+    kBlue,
+    kPurple,
+    kCyan,
+    kWhite,
+  };
+
+  /// How the characters of a cell are drawn.
+  struct Style_t
+  {
+    /// Color of the character.
+    Color foreground = Color::kDefault;
+    /// Color behind the character.
+    Color background = Color::kDefault;
+    /// Draw the character in bold.
+    bool bold = false;
+
+    /// @return true - if both styles draw the same.
+    constexpr bool operator==(const Style_t &) const = default;
+  };
+
+  /// A character of the screen.
+  struct Cell_t
+  {
+    /// Character shown, a printable ASCII character.
+    char character = ' ';
+    /// How the character is drawn.
+    Style_t style = {};
+
+    /// @return true - if both cells draw the same.
+    constexpr bool operator==(const Cell_t &) const = default;
+  };
+
+  /// @param uart - serial port connected to the terminal.
+  explicit AnsiScreen(Uart & uart) : uart_(uart)
+  {
+    Redraw();
+  }
+
+  /// Set a single cell.
+  ///
+  /// @param column - column of the cell, from the left.
+  /// @param row - row of the cell, from the top.
+  /// @param character - printable ASCII character to show.
+  /// @param style - how to draw it.
+  /// @throw std::errc::invalid_argument - if the cell is off the screen.
+  void Put(size_t column, size_t row, char character, Style_t style = {})
+  {
+    if (column >= kColumns || row >= kRows)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Cell is outside of the screen.");
+    }
+    Set(column, row, Cell_t{ .character = character, .style = style });
+  }
+
+  /// Write text along a row, starting at a cell. Text that does not fit the
+  /// row is dropped, rather than continuing on the next row.
+  ///
+  /// @param column - column of the first character.
+  /// @param row - row of the text.
+  /// @param text - printable ASCII characters to show.
+  /// @param style - how to draw them.
+  /// @return size_t - number of characters that fit on the row.
+  /// @throw std::errc::invalid_argument - if the first cell is off the screen.
+  size_t Print(size_t column,
+               size_t row,
+               std::string_view text,
+               Style_t style = {})
+  {
+    if (column >= kColumns || row >= kRows)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Text starts outside of the screen.");
+    }
+
+    const size_t kFits = std::min(text.size(), kColumns - column);
+    for (size_t i = 0; i < kFits; i++)
+    {
+      Set(column + i, row, Cell_t{ .character = text[i], .style = style });
+    }
+    return kFits;
+  }
+
+  /// Set every cell to a blank in the given style.
+  ///
+  /// @param style - style of the blank cells, such as a background color.
+  void Clear(Style_t style = {})
+  {
+    for (size_t row = 0; row < kRows; row++)
+    {
+      for (size_t column = 0; column < kColumns; column++)
+      {
+        Set(column, row, Cell_t{ .style = style });
+      }
+    }
+  }
+
+  /// @param column - column of the cell.
+  /// @param row - row of the cell.
+  /// @return const Cell_t& - the cell as it will be shown after Refresh().
+  const Cell_t & GetCell(size_t column, size_t row) const
+  {
+    return cells_[(row * kColumns) + column];
+  }
+
+  /// Forget what the terminal shows, so the next Refresh() clears it and
+  /// sends the whole screen. Call this when a terminal is attached or may
+  /// have been disturbed, for example by other output on the port.
+  void Redraw()
+  {
+    cleared_ = false;
+    dirty_rows_.set();
+  }
+
+  /// Send the terminal the changes made since the last refresh.
+  ///
+  /// @return size_t - number of bytes written to the Uart.
+  size_t Refresh()
+  {
+    written_ = 0;
+
+    if (!cleared_)
+    {
+      // Reset the style, erase the display and home the cursor.
+      Emit("\e[0m\e[2J\e[H");
+      shown_.fill(Cell_t{});
+      style_   = {};
+      cursor_  = 0;
+      cleared_ = true;
+    }
+
+    for (size_t row = 0; row < kRows; row++)
+    {
+      if (!dirty_rows_[row])
+      {
+        continue;
+      }
+      dirty_rows_[row] = false;
+
+      for (size_t column = 0; column < kColumns; column++)
+      {
+        const size_t kIndex = (row * kColumns) + column;
+        if (cells_[kIndex] == shown_[kIndex])
+        {
+          continue;
+        }
+
+        MoveTo(kIndex);
+        SetStyle(cells_[kIndex].style);
+        Emit(std::string_view(&cells_[kIndex].character, 1));
+        shown_[kIndex] = cells_[kIndex];
+        Advance();
+      }
+    }
+
+    Flush();
+    return written_;
+  }
+
+ private:
+  /// Cursor position when it is not known, such as after a character is
+  /// written to the last column, where terminals differ on where it is left.
+  static constexpr size_t kUnknown = kColumns * kRows;
+
+  void Set(size_t column, size_t row, const Cell_t & cell)
+  {
+    Cell_t & current = cells_[(row * kColumns) + column];
+    if (current != cell)
+    {
+      current          = cell;
+      dirty_rows_[row] = true;
+    }
+  }
+
+  /// Move the cursor to the cell at `index` with the fewest bytes: nothing if
+  /// it is already there, the skipped characters again if they are shorter
+  /// than an escape sequence and drawn in the current style, a move forward
+  /// on the same row, or an absolute move.
+  void MoveTo(size_t index)
+  {
+    if (cursor_ == index)
+    {
+      return;
+    }
+
+    if (cursor_ != kUnknown && cursor_ < index &&
+        cursor_ / kColumns == index / kColumns)
+    {
+      const size_t kGap = index - cursor_;
+      // "\e[" + digits + "C"
+      const size_t kForwardSize = 3 + Digits(kGap);
+
+      if (kGap <= kForwardSize &&
+          std::all_of(&shown_[cursor_], &shown_[index], [this](auto & cell) {
+            return cell.style == style_;
+          }))
+      {
+        for (size_t i = cursor_; i < index; i++)
+        {
+          Emit(std::string_view(&shown_[i].character, 1));
+        }
+      }
+      else
+      {
+        Emit("\e[");
+        EmitNumber(kGap);
+        Emit("C");
+      }
+      cursor_ = index;
+      return;
+    }
+
+    Emit("\e[");
+    EmitNumber((index / kColumns) + 1);
+    Emit(";");
+    EmitNumber((index % kColumns) + 1);
+    Emit("H");
+    cursor_ = index;
+  }
+
+  /// Select the style of the characters that follow, if it is not the one
+  /// selected already.
+  void SetStyle(Style_t style)
+  {
+    if (style == style_)
+    {
+      return;
+    }
+
+    // Start from the default style, so only the attributes in use are sent.
+    Emit("\e[0");
+    if (style.bold)
+    {
+      Emit(";1");
+    }
+    if (style.foreground != Color::kDefault)
+    {
+      Emit(";3");
+      EmitNumber(static_cast<size_t>(style.foreground) - 1);
+    }
+    if (style.background != Color::kDefault)
+    {
+      Emit(";4");
+      EmitNumber(static_cast<size_t>(style.background) - 1);
+    }
+    Emit("m");
+    style_ = style;
+  }
+
+  /// Move the cursor past a character just written.
+  void Advance()
+  {
+    if (cursor_ % kColumns == kColumns - 1)
+    {
+      cursor_ = kUnknown;
+    }
+    else
+    {
+      cursor_++;
+    }
+  }
+
+  static constexpr size_t Digits(size_t number)
+  {
+    size_t digits = 1;
+    while (number >= 10)
+    {
+      number /= 10;
+      digits++;
+    }
+    return digits;
+  }
+
+  void EmitNumber(size_t number)
+  {
+    std::array<char, 20> digits;
+    size_t position = digits.size();
+    do
+    {
+      digits[--position] = static_cast<char>('0' + (number % 10));
+      number /= 10;
+    } while (number != 0);
+    Emit(std::string_view(&digits[position], digits.size() - position));
+  }
+
+  /// Queue bytes to be written, writing the staging buffer to the Uart
+  /// whenever it fills up.
+  void Emit(std::string_view text)
+  {
+    for (char character : text)
+    {
+      if (staged_ == staging_.size())
+      {
+        Flush();
+      }
+      staging_[staged_++] = static_cast<uint8_t>(character);
+    }
+  }
+
+  void Flush()
+  {
+    if (staged_ != 0)
+    {
+      uart_.Write(std::span<const uint8_t>(staging_.data(), staged_));
+      written_ += staged_;
+      staged_ = 0;
+    }
+  }
+
+  Uart & uart_;
+  std::array<Cell_t, kColumns * kRows> cells_ = {};
+  std::array<Cell_t, kColumns * kRows> shown_ = {};
+  std::bitset<kRows> dirty_rows_;
+  std::array<uint8_t, 64> staging_;
+  size_t staged_  = 0;
+  size_t written_ = 0;
+  size_t cursor_  = kUnknown;
+  Style_t style_  = {};
+  bool cleared_   = false;
+};
+}  // namespace sjsu
@@ -0,0 +1,312 @@
+#include <libcore/systems/ansi_screen.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+using Screen = AnsiScreen<8, 3>;
+
+/// Uart recording the bytes written to it.
+class RecordingUart : public Uart
+{
+ public:
+  void ModuleInitialize() override {}
+  bool HasData() override
+  {
+    return false;
+  }
+  void Write(std::span<const uint8_t> data) override
+  {
+    writes++;
+    sent.append(data.begin(), data.end());
+  }
+  size_t Read(std::span<uint8_t>) override
+  {
+    return 0;
+  }
+
+  using Uart::Read;
+  using Uart::Write;
+
+  size_t writes = 0;
+  std::string sent;
+};
+
+/// The escape sequences used by AnsiScreen, applied to a grid of cells the
+/// way a VT100 compatible terminal would.
+class TerminalModel
+{
+ public:
+  void Apply(const std::string & output)
+  {
+    size_t i = 0;
+    while (i < output.size())
+    {
+      if (output[i] != '\e')
+      {
+        Write(output[i++]);
+        continue;
+      }
+
+      REQUIRE(output[i + 1] == '[');
+      const size_t kEnd = output.find_first_of("HJCm", i);
+      REQUIRE(kEnd != std::string::npos);
+      const std::string kParameters = output.substr(i + 2, kEnd - i - 2);
+      Execute(output[kEnd], kParameters);
+      i = kEnd + 1;
+    }
+  }
+
+  std::array<Screen::Cell_t, 8 * 3> cells = {};
+
+ private:
+  void Write(char character)
+  {
+    if (column_ == 8)
+    {
+      // Pending wrap of a character written to the last column.
+      column_ = 0;
+      row_    = std::min<size_t>(row_ + 1, 2);
+    }
+    cells[(row_ * 8) + column_] = { .character = character, .style = style_ };
+    column_++;
+  }
+
+  void Execute(char command, const std::string & parameters)
+  {
+    std::vector<int> numbers;
+    for (size_t start = 0; start <= parameters.size();)
+    {
+      const size_t kEnd = std::min(parameters.find(';', start),
+                                   parameters.size());
+      const std::string kNumber = parameters.substr(start, kEnd - start);
+      numbers.push_back(std::atoi(kNumber.c_str()));
+      start = kEnd + 1;
+    }
+
+    switch (command)
+    {
+      case 'H':
+        row_    = (parameters.empty()) ? 0 : numbers[0] - 1;
+        column_ = (parameters.empty()) ? 0 : numbers[1] - 1;
+        break;
+      case 'J':
+        REQUIRE(2 == numbers[0]);
+        cells.fill(Screen::Cell_t{ .style = style_ });
+        break;
+      case 'C':
+        column_ += numbers[0];
+        break;
+      case 'm':
+        style_ = {};
+        for (int number : numbers)
+        {
+          if (number == 1)
+          {
+            style_.bold = true;
+          }
+          else if (30 <= number && number <= 37)
+          {
+            style_.foreground = static_cast<Screen::Color>(number - 29);
+          }
+          else if (40 <= number && number <= 47)
+          {
+            style_.background = static_cast<Screen::Color>(number - 39);
+          }
+        }
+        break;
+    }
+  }
+
+  size_t row_            = 0;
+  size_t column_         = 0;
+  Screen::Style_t style_ = {};
+};
+}  // namespace
+
+TEST_CASE("Testing AnsiScreen")
+{
+  RecordingUart uart;
+  Screen screen(uart);
+  TerminalModel terminal;
+
+  auto check_terminal = [&]() {
+    int mismatches = 0;
+    for (size_t row = 0; row < 3; row++)
+    {
+      for (size_t column = 0; column < 8; column++)
+      {
+        mismatches +=
+            terminal.cells[(row * 8) + column] != screen.GetCell(column, row);
+      }
+    }
+    return mismatches;
+  };
+
+  SECTION("The first refresh clears the terminal and draws the text")
+  {
+    // Setup
+    screen.Print(1, 1, "Hi");
+
+    // Exercise
+    const size_t kWritten = screen.Refresh();
+
+    // Verify
+    CHECK("\e[0m\e[2J\e[H\e[2;2HHi" == uart.sent);
+    CHECK(uart.sent.size() == kWritten);
+  }
+
+  SECTION("Nothing is sent when nothing changed")
+  {
+    // Setup
+    screen.Print(0, 0, "Speed");
+    screen.Refresh();
+    uart.sent.clear();
+
+    // Exercise
+    screen.Print(0, 0, "Speed");
+    const size_t kWritten = screen.Refresh();
+
+    // Verify
+    CHECK(0 == kWritten);
+    CHECK(uart.sent.empty());
+  }
+
+  SECTION("Only changed characters are sent")
+  {
+    // Setup
+    screen.Print(0, 2, "rpm 1200");
+    screen.Refresh();
+    uart.sent.clear();
+
+    // Exercise
+    screen.Print(4, 2, "1300");
+    screen.Refresh();
+
+    // Verify
+    CHECK("\e[3;6H3" == uart.sent);
+  }
+
+  SECTION("Cursor moves take the fewest bytes")
+  {
+    // Setup
+    screen.Print(0, 0, "abcdefgh");
+    screen.Refresh();
+    uart.sent.clear();
+
+    // Exercise
+    screen.Put(0, 0, 'A');
+    screen.Put(2, 0, 'C');
+    screen.Put(1, 1, 'x');
+    screen.Put(7, 1, 'y');
+    screen.Refresh();
+
+    // Verify
+    // The "b" is sent again, as it is shorter than a move, and the gap
+    // between "x" and "y" is skipped with a move forward.
+    CHECK("\e[1;1HAbC\e[2;2Hx\e[5Cy" == uart.sent);
+  }
+
+  SECTION("Styles are sent only when they change")
+  {
+    // Setup
+    const Screen::Style_t kAlarm = { .foreground = Screen::Color::kRed,
+                                     .background = Screen::Color::kWhite,
+                                     .bold       = true };
+
+    // Exercise
+    screen.Print(0, 0, "AB", kAlarm);
+    screen.Print(2, 0, "C");
+    screen.Refresh();
+
+    // Verify
+    CHECK("\e[0m\e[2J\e[H\e[0;1;31;47mAB\e[0mC" == uart.sent);
+  }
+
+  SECTION("The terminal matches the screen after any changes")
+  {
+    // Setup
+    const std::array<Screen::Style_t, 3> kStyles = {
+      Screen::Style_t{},
+      Screen::Style_t{ .foreground = Screen::Color::kGreen },
+      Screen::Style_t{ .background = Screen::Color::kBlue, .bold = true },
+    };
+    uint32_t seed = 12345;
+    auto random   = [&seed](uint32_t limit) {
+      seed = (seed * 1103515245) + 12345;
+      return (seed >> 16) % limit;
+    };
+
+    int mismatches = 0;
+    for (int refresh = 0; refresh < 200; refresh++)
+    {
+      // Exercise
+      for (uint32_t change = random(6); change > 0; change--)
+      {
+        screen.Put(random(8),
+                   random(3),
+                   static_cast<char>('a' + random(3)),
+                   kStyles[random(3)]);
+      }
+      if (refresh % 50 == 49)
+      {
+        screen.Clear(kStyles[random(3)]);
+      }
+      screen.Refresh();
+      terminal.Apply(uart.sent);
+      uart.sent.clear();
+
+      // Verify
+      mismatches += check_terminal();
+    }
+    CHECK(0 == mismatches);
+  }
+
+  SECTION("Redraw() sends the whole screen again")
+  {
+    // Setup
+    screen.Print(0, 0, "ABCDEFGH");
+    screen.Print(0, 2, "xyz");
+    screen.Refresh();
+    terminal.Apply(uart.sent);
+    uart.sent.clear();
+    terminal.cells.fill({ .character = '?' });
+
+    // Exercise
+    screen.Redraw();
+    screen.Refresh();
+    terminal.Apply(uart.sent);
+
+    // Verify
+    CHECK(0 == check_terminal());
+  }
+
+  SECTION("Output is written a staging buffer at a time")
+  {
+    // Setup
+    screen.Clear({ .background = Screen::Color::kCyan });
+
+    // Exercise
+    const size_t kWritten = screen.Refresh();
+
+    // Verify
+    CHECK(uart.sent.size() == kWritten);
+    CHECK((kWritten + 63) / 64 == uart.writes);
+  }
+
+  SECTION("Cells off the screen are rejected")
+  {
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(screen.Put(8, 0, 'A'), std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(screen.Print(0, 3, "A"), std::errc::invalid_argument);
+    CHECK(3 == screen.Print(5, 0, "ABCDEF"));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <system_error>
+#include <utility>
+
+#include <libcore/utility/coroutine.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/inplace_function.hpp>
+#include <libcore/utility/memory_pool.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Initializes a system's modules in dependency order, overlapping their
+/// waits, and records how long each one took.
+///
+/// Each step of the boot is a coroutine::Task. A step starts once every step
+/// it depends on has finished, and steps that are ready run cooperatively:
+/// while one step co_awaits coroutine::Sleep() for a device's power-up or
+/// reset time, the others keep initializing. Steps for modules that
+/// initialize without waiting can be added with AddModule().
+///
+/// USAGE:
+///
+///    sjsu::coroutine::Task ResetRadio(sjsu::Gpio * reset, Radio * radio)
+///    {
+///      reset->SetLow();
+///      co_await sjsu::coroutine::Sleep(10ms);
+///      reset->SetHigh();
+///      co_await sjsu::coroutine::Sleep(100ms);  // Power-up time
+///      radio->Initialize();
+///    }
+///
+///    sjsu::BootSequence<8> boot;
+///    auto i2c   = boot.AddModule("i2c", i2c_bus);
+///    auto gpio  = boot.AddModule("reset pin", reset_pin);
+///    boot.AddModule("imu", imu, { i2c });
+///    boot.Add("radio", [&]() { return ResetRadio(&reset_pin, &radio); },
+///             { gpio });
+///    boot.Run();
+///
+///    boot.ForEach([](const auto & step) {
+///      sjsu::log::Print("{}: {}\n", step.name, step.Duration());
+///    });
+///
+/// @tparam kSteps - maximum number of steps, at most 32.
+/// @tparam kFrameSize - maximum size in bytes of a step's coroutine frame.
+template <size_t kSteps, size_t kFrameSize = 256>
+class BootSequence
+{
+ public:
+  static_assert(0 < kSteps && kSteps <= 32,
+                "Dependencies are tracked in a 32-bit mask.");
+
+  /// Function that creates the coroutine of a step.
+  using Start = InplaceFunction<coroutine::Task()>;
+
+  /// A single step of the boot, with its timing.
+  struct Step_t
+  {
+    /// Name of the step, with static storage duration.
+    const char * name = nullptr;
+    /// Creates the step's coroutine.
+    Start start;
+    /// Bit `i` is set when the step depends on step `i`.
+    uint32_t dependencies = 0;
+    /// Uptime when the step started.
+    std::chrono::nanoseconds started = 0ns;
+    /// Uptime when the step finished.
+    std::chrono::nanoseconds finished = 0ns;
+
+    /// @return std::chrono::nanoseconds - time from the step starting to it
+    ///         finishing, including time spent running other steps.
+    std::chrono::nanoseconds Duration() const
+    {
+      return finished - started;
+    }
+  };
+
+  BootSequence() = default;
+  BootSequence(const BootSequence &) = delete;
+  BootSequence & operator=(const BootSequence &) = delete;
+
+  ~BootSequence()
+  {
+    for (auto & task : tasks_)
+    {
+      if (task)
+      {
+        task.destroy();
+      }
+    }
+  }
+
+  /// Add a step.
+  ///
+  /// @param name - name of the step, with static storage duration.
+  /// @param start - creates the step's coroutine, such as a lambda calling a
+  ///        function returning coroutine::Task. As with coroutine::Executor,
+  ///        the coroutine itself should not be a lambda with captures.
+  /// @param after - steps, returned by Add(), that must finish before this
+  ///        one starts.
+  /// @throw std::errc::no_buffer_space - if kSteps steps have been added.
+  /// @return size_t - the step, for other steps to depend on.
+  size_t Add(const char * name,
+             Start start,
+             std::initializer_list<size_t> after = {})
+  {
+    if (count_ >= kSteps)
+    {
+      throw Exception(std::errc::no_buffer_space,
+                      "Boot sequence has no room for another step.");
+    }
+
+    Step_t & step = steps_[count_];
+    step.name     = name;
+    step.start    = start;
+    for (size_t dependency : after)
+    {
+      step.dependencies |= uint32_t{ 1 } << dependency;
+    }
+
+    return count_++;
+  }
+
+  /// Add a step that calls `module.Initialize()`.
+  ///
+  /// @param name - name of the step, with static storage duration.
+  /// @param module - module to initialize.
+  /// @param after - steps that must finish before this one starts.
+  /// @return size_t - the step, for other steps to depend on.
+  template <class ModuleType>
+  size_t AddModule(const char * name,
+                   ModuleType & module,
+                   std::initializer_list<size_t> after = {})
+  {
+    return Add(
+        name, [&module]() { return InitializeModule(&module); }, after);
+  }
+
+  /// Start the steps whose dependencies have finished and resume each running
+  /// step that is ready, once.
+  ///
+  /// @throw std::errc::invalid_argument - if the remaining steps can never
+  ///        start, because their dependencies form a cycle or name a step that
+  ///        does not exist.
+  /// @throw std::errc::not_enough_memory - if a step's coroutine frame is
+  ///        larger than kFrameSize.
+  /// @throw - exceptions escaping a step are rethrown.
+  /// @return true - while steps remain.
+  bool RunOnce()
+  {
+    StartReadySteps();
+
+    for (size_t i = 0; i < count_; i++)
+    {
+      Handle & task = tasks_[i];
+      if (!task || !IsReady(task))
+      {
+        continue;
+      }
+
+      task.promise().is_ready = nullptr;
+      task.promise().awaiter  = nullptr;
+      task.resume();
+
+      if (task.done())
+      {
+        std::exception_ptr exception = task.promise().exception;
+        task.destroy();
+        task = nullptr;
+        steps_[i].finished = Uptime();
+        finished_ |= uint32_t{ 1 } << i;
+
+        if (exception)
+        {
+          std::rethrow_exception(exception);
+        }
+      }
+    }
+
+    return !IsFinished();
+  }
+
+  /// Run every step to completion.
+  void Run()
+  {
+    while (RunOnce())
+    {
+      continue;
+    }
+  }
+
+  /// @return true - once every step has finished.
+  bool IsFinished() const
+  {
+    return finished_ == AllSteps();
+  }
+
+  /// Call `callback` with each step, in the order they were added.
+  ///
+  /// @param callback - callable with the signature `void(const Step_t &)`.
+  template <typename Callback>
+  void ForEach(Callback && callback) const
+  {
+    for (size_t i = 0; i < count_; i++)
+    {
+      callback(steps_[i]);
+    }
+  }
+
+ private:
+  using Handle = std::coroutine_handle<coroutine::Task::promise_type>;
+
+  template <class ModuleType>
+  static coroutine::Task InitializeModule(ModuleType * module)
+  {
+    module->Initialize();
+    co_return;
+  }
+
+  static bool IsReady(Handle task)
+  {
+    const auto & promise = task.promise();
+    return promise.is_ready == nullptr || promise.is_ready(promise.awaiter);
+  }
+
+  uint32_t AllSteps() const
+  {
+    return (count_ == 32) ? UINT32_MAX : (uint32_t{ 1 } << count_) - 1;
+  }
+
+  void StartReadySteps()
+  {
+    bool running = false;
+
+    for (size_t i = 0; i < count_; i++)
+    {
+      const uint32_t kBit = uint32_t{ 1 } << i;
+      Step_t & step       = steps_[i];
+
+      if ((started_ & kBit) == 0 &&
+          (step.dependencies & ~finished_) == 0)
+      {
+        coroutine::detail::frame_resource = &frames_;
+        coroutine::Task task              = step.start();
+        coroutine::detail::frame_resource = nullptr;
+
+        if (!task.IsValid())
+        {
+          throw Exception(std::errc::not_enough_memory,
+                          "Boot step coroutine frame exceeds kFrameSize.");
+        }
+
+        tasks_[i]    = task.Release();
+        step.started = Uptime();
+        started_ |= kBit;
+      }
+
+      running = running || static_cast<bool>(tasks_[i]);
+    }
+
+    if (!running && !IsFinished())
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Boot steps depend on steps that can never finish.");
+    }
+  }
+
+  StaticBlockPool<kFrameSize + sizeof(coroutine::detail::FrameHeader_t),
+                  kSteps>
+      frames_;
+  std::array<Step_t, kSteps> steps_{};
+  std::array<Handle, kSteps> tasks_{};
+  size_t count_      = 0;
+  uint32_t started_  = 0;
+  uint32_t finished_ = 0;
+};
+}  // namespace sjsu
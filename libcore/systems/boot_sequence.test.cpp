@@ -0,0 +1,117 @@
+#include <libcore/systems/boot_sequence.hpp>
+
+#include <string>
+#include <vector>
+
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+namespace sjsu
+{
+namespace
+{
+coroutine::Task PowerUp(std::chrono::nanoseconds duration,
+                        std::vector<std::string> * log,
+                        const char * name)
+{
+  co_await coroutine::Sleep(duration);
+  log->push_back(name);
+}
+
+coroutine::Task Fail()
+{
+  co_await coroutine::Yield();
+  throw Exception(std::errc::io_error, "Device did not respond");
+}
+}  // namespace
+
+TEST_CASE("Testing BootSequence")
+{
+  VirtualClock clock;
+  clock.Start();
+  BootSequence<4> boot;
+  std::vector<std::string> log;
+
+  auto run = [&]() {
+    while (boot.RunOnce())
+    {
+      clock.Advance(1ms);
+    }
+  };
+
+  SECTION("Independent steps overlap their waits")
+  {
+    // Setup
+    auto radio = boot.Add("radio", [&log]() {
+      return PowerUp(10ms, &log, "radio");
+    });
+    auto imu = boot.Add("imu", [&log]() {
+      return PowerUp(5ms, &log, "imu");
+    });
+    boot.Add(
+        "app", [&log]() { return PowerUp(0ms, &log, "app"); }, { radio, imu });
+
+    // Exercise
+    run();
+
+    // Verify
+    CHECK(std::vector<std::string>{ "imu", "radio", "app" } == log);
+    CHECK(clock.Now() < 15ms);
+
+    std::vector<std::chrono::nanoseconds> durations;
+    boot.ForEach([&durations](const auto & step) {
+      durations.push_back(step.Duration());
+    });
+    CHECK(std::vector<std::chrono::nanoseconds>{ 10ms, 5ms, 0ms } ==
+          durations);
+  }
+
+  SECTION("AddModule() initializes the module")
+  {
+    // Setup
+    Mock<Uart> mock_uart;
+    Fake(Method(mock_uart, ModuleInitialize));
+    boot.AddModule("uart", mock_uart.get());
+
+    // Exercise
+    run();
+
+    // Verify
+    Verify(Method(mock_uart, ModuleInitialize)).Once();
+    CHECK(boot.IsFinished());
+  }
+
+  SECTION("Circular dependencies throw")
+  {
+    // Setup
+    boot.Add("a", []() { return Fail(); }, { 1 });
+    boot.Add("b", []() { return Fail(); }, { 0 });
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(boot.Run(), std::errc::invalid_argument);
+  }
+
+  SECTION("Exceptions escaping a step are rethrown")
+  {
+    // Setup
+    boot.Add("a", []() { return Fail(); });
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(run(), std::errc::io_error);
+  }
+
+  SECTION("Add() throws when full")
+  {
+    // Setup
+    for (int i = 0; i < 4; i++)
+    {
+      boot.Add("step", []() { return Fail(); });
+    }
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(boot.Add("step", []() { return Fail(); }),
+                        std::errc::no_buffer_space);
+  }
+}
+}  // namespace sjsu
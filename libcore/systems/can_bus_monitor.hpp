@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <libcore/peripherals/can.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Turns the counters kept by a Can peripheral and a CanNetwork into rates:
+/// bus load, frames per second overall and per captured ID, and the errors
+/// since the previous sample.
+///
+/// The counters are kept by the driver and the receive handler as they go, so
+/// monitoring costs nothing until Sample() is called, for example once a
+/// second from a low priority task.
+///
+/// The bus load adds the frames received by the CanNetwork, without stuff
+/// bits, to the bits the peripheral reports sending. It is lower than the
+/// true load when hardware filtering drops frames for IDs that were not
+/// captured, or when the driver does not count the frames it sends.
+///
+/// USAGE:
+///
+///    sjsu::CanBusMonitor monitor(network);
+///
+///    // Every second:
+///    const auto & report = monitor.Sample();
+///    sjsu::log::Print("load: {:.1f}%, motor: {:.0f} fps, TEC: {}\n",
+///                     report.bus_load,
+///                     monitor.FramesPerSecond(0x140),
+///                     report.transmit_error_counter);
+///
+/// @tparam kIds - number of captured IDs whose rates are tracked. IDs beyond
+///         the first kIds in the network's index report 0.
+template <size_t kIds = 32>
+class CanBusMonitor
+{
+ public:
+  /// Bus health over the interval between the last two samples.
+  struct Report_t
+  {
+    /// Percentage of the interval the bus carried frames, 0 to 100.
+    float bus_load = 0;
+    /// Frames received by the network per second.
+    float frames_received_per_second = 0;
+    /// Frames sent by the peripheral per second.
+    float frames_transmitted_per_second = 0;
+    /// Frames lost to receive FIFO overruns during the interval.
+    uint32_t receive_overruns = 0;
+    /// Arbitration losses during the interval.
+    uint32_t arbitration_lost = 0;
+    /// Receive handler calls during the interval that left frames behind.
+    uint32_t receive_limit_reached = 0;
+    /// Transmit error counter (TEC) at the end of the interval.
+    uint16_t transmit_error_counter = 0;
+    /// Receive error counter (REC) at the end of the interval.
+    uint16_t receive_error_counter = 0;
+    /// The peripheral was bus off at the end of the interval.
+    bool bus_off = false;
+  };
+
+  /// Starts the first interval.
+  ///
+  /// @param network - network to monitor. IDs should all be captured before
+  ///        the monitor is constructed.
+  explicit CanBusMonitor(CanNetwork & network) : network_(network)
+  {
+    Snapshot();
+  }
+
+  /// End the current interval, compute its report and start the next one.
+  ///
+  /// @return const Report_t & - the report of the interval that ended.
+  const Report_t & Sample()
+  {
+    const Can::Counters_t kLastCounters           = counters_;
+    const CanNetwork::Statistics_t kLastStatistics = statistics_;
+    const std::array<uint32_t, kIds> kLastReceived = received_;
+    const std::chrono::nanoseconds kLastTime       = time_;
+
+    Snapshot();
+
+    const float kSeconds =
+        std::chrono::duration<float>(time_ - kLastTime).count();
+    if (kSeconds <= 0)
+    {
+      return report_;
+    }
+
+    const uint32_t kBits =
+        (statistics_.bits_received - kLastStatistics.bits_received) +
+        (counters_.bits_transmitted - kLastCounters.bits_transmitted);
+    const float kBaudRate =
+        network_.CanBus().settings.baud_rate.to<float>();
+
+    report_.bus_load =
+        (kBaudRate > 0)
+            ? std::min(100.0f, 100.0f * static_cast<float>(kBits) /
+                                   (kBaudRate * kSeconds))
+            : 0.0f;
+    report_.frames_received_per_second =
+        static_cast<float>(statistics_.frames_received -
+                           kLastStatistics.frames_received) /
+        kSeconds;
+    report_.frames_transmitted_per_second =
+        static_cast<float>(counters_.frames_transmitted -
+                           kLastCounters.frames_transmitted) /
+        kSeconds;
+    report_.receive_overruns =
+        counters_.receive_overruns - kLastCounters.receive_overruns;
+    report_.arbitration_lost =
+        counters_.arbitration_lost - kLastCounters.arbitration_lost;
+    report_.receive_limit_reached = statistics_.receive_limit_reached -
+                                    kLastStatistics.receive_limit_reached;
+    report_.transmit_error_counter = counters_.transmit_error_counter;
+    report_.receive_error_counter  = counters_.receive_error_counter;
+    report_.bus_off                = network_.CanBus().IsBusOff();
+
+    for (size_t i = 0; i < kIds; i++)
+    {
+      rates_[i] = static_cast<float>(received_[i] - kLastReceived[i]) /
+                  kSeconds;
+    }
+
+    return report_;
+  }
+
+  /// @return const Report_t & - the report returned by the last Sample().
+  const Report_t & GetReport() const
+  {
+    return report_;
+  }
+
+  /// @param id - a captured ID.
+  /// @return float - frames received per second with this ID in the interval
+  ///         reported by the last Sample(), or 0 if the ID is not tracked.
+  float FramesPerSecond(uint32_t id) const
+  {
+    const auto & index = network_.GetIndex();
+    const size_t kTracked = std::min(index.size(), kIds);
+
+    for (size_t i = 0; i < kTracked; i++)
+    {
+      if (index[i].id == id)
+      {
+        return rates_[i];
+      }
+    }
+
+    return 0;
+  }
+
+ private:
+  void Snapshot()
+  {
+    time_       = Uptime();
+    counters_   = network_.CanBus().GetCounters();
+    statistics_ = network_.GetStatistics();
+
+    const auto & index = network_.GetIndex();
+    for (size_t i = 0; i < std::min(index.size(), kIds); i++)
+    {
+      received_[i] = index[i].node->Received();
+    }
+  }
+
+  CanNetwork & network_;
+  Report_t report_;
+  std::chrono::nanoseconds time_ = std::chrono::nanoseconds(0);
+  Can::Counters_t counters_;
+  CanNetwork::Statistics_t statistics_;
+  std::array<uint32_t, kIds> received_{};
+  std::array<float, kIds> rates_{};
+};
+}  // namespace sjsu
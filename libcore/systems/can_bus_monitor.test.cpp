@@ -0,0 +1,105 @@
+#include <libcore/systems/can_bus_monitor.hpp>
+
+#include <libcore/testing/simulated_peripherals.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing CanBusMonitor")
+{
+  VirtualClock clock;
+  clock.Start();
+
+  const auto kFrame = [](uint32_t id) {
+    return Can::Message_t{ .id = id, .length = 8, .payload = {} };
+  };
+  // 8 byte standard frames, without and with worst case stuff bits.
+  constexpr uint32_t kFrameBits        = 111;
+  constexpr uint32_t kStuffedFrameBits = 135;
+
+  StaticMemoryResource<1024> memory_resource;
+
+  SECTION("Rates and bus load")
+  {
+    // Setup
+    simulation::Can can(clock);
+    can.settings.baud_rate = 500_kHz;
+    CanNetwork network(can, &memory_resource);
+    [[maybe_unused]] auto * motor = network.CaptureMessage(0x100);
+    [[maybe_unused]] auto * brake = network.CaptureMessage(0x300);
+    network.Initialize();
+    CanBusMonitor monitor(network);
+
+    // Exercise
+    for (int i = 0; i < 10; i++)
+    {
+      can.Inject(kFrame(0x100));
+      clock.Advance(1ms);
+    }
+    for (int i = 0; i < 5; i++)
+    {
+      can.Inject(kFrame(0x200));
+      can.Send(kFrame(0x400));
+      clock.Advance(1ms);
+    }
+    clock.Advance(985ms);
+    const auto kReport = monitor.Sample();
+
+    // Verify
+    const float kBits = 15 * kFrameBits + 5 * kStuffedFrameBits;
+    CHECK(kReport.bus_load ==
+          doctest::Approx(100.0f * kBits / 500'000.0f).epsilon(0.001));
+    CHECK(kReport.frames_received_per_second == doctest::Approx(15.0f));
+    CHECK(kReport.frames_transmitted_per_second == doctest::Approx(5.0f));
+    CHECK(monitor.FramesPerSecond(0x100) == doctest::Approx(10.0f));
+    CHECK(0.0f == monitor.FramesPerSecond(0x300));
+    CHECK(0.0f == monitor.FramesPerSecond(0x200));
+    CHECK(5 == network.GetStatistics().frames_ignored);
+    CHECK(10 == motor->Received());
+    CHECK(0 == kReport.receive_overruns);
+    CHECK(0 == kReport.arbitration_lost);
+    CHECK(!kReport.bus_off);
+
+    // Exercise: The next interval only counts what happened during it.
+    clock.Advance(1s);
+    const auto kIdle = monitor.Sample();
+
+    // Verify
+    CHECK(0.0f == kIdle.bus_load);
+    CHECK(0.0f == kIdle.frames_received_per_second);
+    CHECK(0.0f == monitor.FramesPerSecond(0x100));
+  }
+
+  SECTION("Errors")
+  {
+    // Setup
+    simulation::Can can(clock,
+                        { .rx_fifo_depth = 1, .interrupt_latency = 1ms });
+    can.settings.baud_rate = 500_kHz;
+    CanNetwork network(can, &memory_resource);
+    network.Initialize();
+    CanBusMonitor monitor(network);
+
+    // Exercise
+    // Another node holds the bus while this node and a third one queue
+    // frames. The third node's frame wins arbitration.
+    can.Inject(kFrame(0x050));
+    can.Send(kFrame(0x300));
+    can.Inject(kFrame(0x010));
+    clock.Advance(1ms);
+    // Frames arrive faster than the receive handler runs.
+    can.Inject(kFrame(0x020));
+    can.Inject(kFrame(0x030));
+    can.Inject(kFrame(0x040));
+    clock.Advance(10ms);
+    const auto kReport = monitor.Sample();
+
+    // Verify
+    CHECK(1 == kReport.arbitration_lost);
+    CHECK(0 < kReport.receive_overruns);
+    CHECK(can.statistics.overruns == kReport.receive_overruns);
+  }
+
+  clock.Stop();
+}
+}  // namespace sjsu
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include <libcore/peripherals/can.hpp>
+#include <libcore/utility/math/bit.hpp>
+#include <libcore/utility/seqlock.hpp>
+
+namespace sjsu
+{
+/// A signal packed into the payload of a CAN message, as listed in a CAN
+/// database (DBC) file.
+///
+/// The physical value of the signal is `raw * scale + offset`, where `raw` is
+/// the signal's bits read as an integer.
+struct CanSignal_t
+{
+  /// Position of the signal's least significant bit, numbered as in
+  /// bit::StreamExtract().
+  uint32_t position = 0;
+  /// Number of bits of the signal, 1 to 64.
+  uint32_t width = 1;
+  /// Byte order of the payload, as in bit::StreamExtract(). Endian::kBig
+  /// places the least significant byte in `payload[0]`, which is the "Intel"
+  /// byte order of DBC files.
+  Endian endian = Endian::kBig;
+  /// The raw value is two's complement.
+  bool is_signed = false;
+  /// Size of one raw step in physical units.
+  float scale = 1.0f;
+  /// Physical value of a raw value of 0.
+  float offset = 0.0f;
+
+  /// @return constexpr bit::Mask - the bits of the signal.
+  constexpr bit::Mask Mask() const
+  {
+    return { .position = position, .width = width };
+  }
+
+  /// @param window - the whole payload loaded by bit::detail::StreamLoad()
+  ///        with the signal's byte order.
+  /// @return constexpr float - the physical value of the signal.
+  constexpr float Extract(uint64_t window) const
+  {
+    const uint64_t kWidthMask = bit::detail::StreamWidthMask(width);
+    uint64_t raw              = (window >> position) & kWidthMask;
+
+    if (is_signed && width < 64 && ((raw >> (width - 1)) & 1) != 0)
+    {
+      raw |= ~kWidthMask;
+    }
+
+    const float kRaw = is_signed ? static_cast<float>(static_cast<int64_t>(raw))
+                                 : static_cast<float>(raw);
+    return (kRaw * scale) + offset;
+  }
+
+  /// @param value - physical value of the signal.
+  /// @return constexpr uint64_t - the raw value closest to `value`. Only the
+  ///         lower `width` bits are meaningful.
+  constexpr uint64_t Raw(float value) const
+  {
+    const float kSteps = (value - offset) / scale;
+    const float kRound = (kSteps < 0.0f) ? -0.5f : 0.5f;
+    return static_cast<uint64_t>(static_cast<int64_t>(kSteps + kRound));
+  }
+};
+
+/// The signals of one CAN message. Declared constexpr, it acts as the
+/// message's entry in a compile time CAN database, from which decoding and
+/// encoding of every signal is inlined into shifts, masks and a multiply-add
+/// per signal.
+///
+/// Decode() reads all of a message's signals in one pass: the payload is
+/// loaded into a single 64-bit word per byte order used, from which each
+/// signal is shifted out, rather than extracting each signal from the payload
+/// separately.
+///
+/// USAGE:
+///
+///    constexpr sjsu::CanFrame_t<3> kMotorStatus = {
+///      .id      = 0x140,
+///      .signals = { {
+///        { .position = 0, .width = 16, .scale = 0.25f },   // rpm
+///        { .position = 16, .width = 8, .is_signed = true,  // temperature
+///          .offset = -40.0f },
+///        { .position = 24, .width = 1 },                   // fault
+///      } },
+///    };
+///    static_assert(kMotorStatus.IsValid());
+///
+///    auto [rpm, temperature, fault] = kMotorStatus.Decode(message);
+///
+/// @tparam kSignals - number of signals in the message.
+template <size_t kSignals>
+struct CanFrame_t
+{
+  /// ID of the message.
+  uint32_t id = 0;
+  /// ID format of the message.
+  Can::Message_t::Format format = Can::Message_t::Format::kStandard;
+  /// Length of the message's payload.
+  uint8_t length = 8;
+  /// The message's signals.
+  std::array<CanSignal_t, kSignals> signals = {};
+
+  /// @return true - if every signal fits within the payload and no two
+  ///         signals of the same byte order overlap.
+  constexpr bool IsValid() const
+  {
+    if (length > 8)
+    {
+      return false;
+    }
+
+    for (size_t i = 0; i < kSignals; i++)
+    {
+      const CanSignal_t & kSignal = signals[i];
+      if (kSignal.width == 0 || kSignal.width > 64 ||
+          kSignal.position + kSignal.width > length * 8u)
+      {
+        return false;
+      }
+
+      for (size_t j = 0; j < i; j++)
+      {
+        const CanSignal_t & kOther = signals[j];
+        if (kOther.endian == kSignal.endian &&
+            kOther.position < kSignal.position + kSignal.width &&
+            kSignal.position < kOther.position + kOther.width)
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /// @param message - received message. Its ID is not checked.
+  /// @return constexpr std::array<float, kSignals> - the physical value of
+  ///         each signal, in the order of `signals`.
+  constexpr std::array<float, kSignals> Decode(
+      const Can::Message_t & message) const
+  {
+    const auto kPayload = Payload(message.payload);
+    const uint64_t kLittle =
+        Uses(Endian::kLittle)
+            ? bit::detail::StreamLoad(kPayload, 0, Endian::kLittle)
+            : 0;
+    const uint64_t kBig =
+        Uses(Endian::kBig) ? bit::detail::StreamLoad(kPayload, 0, Endian::kBig)
+                           : 0;
+
+    std::array<float, kSignals> values = {};
+    for (size_t i = 0; i < kSignals; i++)
+    {
+      values[i] = signals[i].Extract(
+          (signals[i].endian == Endian::kBig) ? kBig : kLittle);
+    }
+    return values;
+  }
+
+  /// Insert the raw value of each signal into a message's payload, leaving
+  /// the bits outside of the signals untouched.
+  ///
+  /// @param message - message to encode into.
+  /// @param values - physical value of each signal, in the order of
+  ///        `signals`.
+  constexpr void Encode(Can::Message_t & message,
+                        const std::array<float, kSignals> & values) const
+  {
+    const std::span<uint8_t> kPayload =
+        std::span(message.payload).first(length);
+
+    for (size_t i = 0; i < kSignals; i++)
+    {
+      bit::StreamInsert(kPayload,
+                        signals[i].Mask(),
+                        signals[i].Raw(values[i]),
+                        signals[i].endian);
+    }
+  }
+
+  /// @param values - physical value of each signal, in the order of
+  ///        `signals`.
+  /// @return constexpr Can::Message_t - message with this ID, format and
+  ///         length, carrying the signals.
+  constexpr Can::Message_t Encode(
+      const std::array<float, kSignals> & values) const
+  {
+    Can::Message_t message{};
+    message.id      = id;
+    message.format  = format;
+    message.length  = length;
+    message.payload = {};
+    Encode(message, values);
+    return message;
+  }
+
+ private:
+  constexpr std::span<const uint8_t> Payload(
+      const std::array<uint8_t, 8> & payload) const
+  {
+    return std::span(payload).first(length);
+  }
+
+  constexpr bool Uses(Endian endian) const
+  {
+    for (const auto & signal : signals)
+    {
+      if (signal.endian == endian)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+/// Keeps the decoded signals of a message captured by a CanNetwork up to
+/// date. Each message received with the frame's ID is decoded in the
+/// network's receive handler, right after its Node_t is updated, and the
+/// values are stored behind a SeqLock, just as the message is in the node.
+///
+/// USAGE:
+///
+///    sjsu::CanSignalDecoder motor_status(network, kMotorStatus);
+///    network.Initialize();
+///
+///    auto [rpm, temperature, fault] = motor_status.Get();
+///
+/// @tparam kSignals - number of signals in the message.
+template <size_t kSignals>
+class CanSignalDecoder
+{
+ public:
+  /// @param network - network receiving the message.
+  /// @param frame - the message's signals.
+  /// @throw std::bad_alloc if the message's ID must be captured and the
+  ///        network's memory resource is full.
+  CanSignalDecoder(CanNetwork & network, const CanFrame_t<kSignals> & frame)
+      : frame_(frame),
+        listener_(network,
+                  frame.id,
+                  [this](const Can::Message_t & message) {
+                    values_.Write(frame_.Decode(message));
+                  },
+                  frame.format)
+  {
+  }
+
+  /// @return std::array<float, kSignals> - the signals of the latest message,
+  ///         or zeros if none has been received.
+  std::array<float, kSignals> Get() const
+  {
+    return values_.Read();
+  }
+
+  /// @param last_sequence - sequence number of the last values returned.
+  ///        Initialize to 0 to receive the first values.
+  /// @return std::optional<std::array<float, kSignals>> - the signals of the
+  ///         latest message, or std::nullopt if no message has been received
+  ///         since `last_sequence`.
+  std::optional<std::array<float, kSignals>> GetIfChanged(
+      uint32_t & last_sequence) const
+  {
+    return values_.ReadIfChanged(last_sequence);
+  }
+
+  /// @return const CanFrame_t<kSignals> & - the message's signals.
+  const CanFrame_t<kSignals> & GetFrame() const
+  {
+    return frame_;
+  }
+
+ private:
+  CanFrame_t<kSignals> frame_;
+  SeqLock<std::array<float, kSignals>> values_{ {} };
+  CanNetwork::Listener listener_;
+};
+}  // namespace sjsu
@@ -0,0 +1,196 @@
+#include <libcore/systems/can_signals.hpp>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+constexpr CanFrame_t<4> kMotorStatus = {
+  .id      = 0x140,
+  .signals = { {
+      { .position = 0, .width = 16, .scale = 0.25f },
+      { .position = 16, .width = 8, .is_signed = true, .offset = -40.0f },
+      { .position = 24, .width = 1 },
+      { .position = 0, .width = 12, .endian = Endian::kLittle },
+  } },
+};
+
+static_assert(kMotorStatus.IsValid());
+static_assert(
+    !CanFrame_t<1>{ .signals = { { { .position = 60, .width = 8 } } } }
+         .IsValid());
+static_assert(!CanFrame_t<2>{ .signals = { {
+                                  { .position = 0, .width = 8 },
+                                  { .position = 7, .width = 8 },
+                              } } }
+                   .IsValid());
+static_assert(CanFrame_t<2>{ .signals = { {
+                                 { .position = 0, .width = 8 },
+                                 { .position = 0,
+                                   .width  = 8,
+                                   .endian = Endian::kLittle },
+                             } } }
+                  .IsValid());
+
+// Decoding is usable in constant expressions, such as for tables of test
+// vectors checked at compile time.
+static_assert(kMotorStatus.Decode(Can::Message_t{
+                  .id      = 0x140,
+                  .length  = 8,
+                  .payload = { 0x10, 0x27, 0xFF, 0x01, 0, 0, 0, 0 } })[1] ==
+              -41.0f);
+}  // namespace
+
+TEST_CASE("Testing CAN signals")
+{
+  SECTION("Decode()")
+  {
+    // Setup
+    const Can::Message_t kMessage = {
+      .id      = 0x140,
+      .length  = 8,
+      .payload = { 0x10, 0x27, 0x05, 0x01, 0x00, 0x00, 0x0A, 0xBC },
+    };
+
+    // Exercise
+    auto [rpm, temperature, fault, counter] = kMotorStatus.Decode(kMessage);
+
+    // Verify
+    CHECK(2500.0f == rpm);
+    CHECK(-35.0f == temperature);
+    CHECK(1.0f == fault);
+    CHECK(0xABC == counter);
+  }
+
+  SECTION("Decode() matches StreamExtract()")
+  {
+    // Setup
+    const Can::Message_t kMessage = {
+      .id      = 0x140,
+      .length  = 8,
+      .payload = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0 },
+    };
+
+    // Exercise
+    auto values = kMotorStatus.Decode(kMessage);
+
+    // Verify
+    for (size_t i = 0; i < kMotorStatus.signals.size(); i++)
+    {
+      const CanSignal_t & kSignal = kMotorStatus.signals[i];
+      uint64_t raw                = bit::StreamExtract<uint64_t>(
+          kMessage.payload, kSignal.Mask(), kSignal.endian);
+      if (kSignal.is_signed && (raw >> (kSignal.width - 1)) & 1)
+      {
+        raw |= ~bit::detail::StreamWidthMask(kSignal.width);
+      }
+      const float kRaw = kSignal.is_signed
+                             ? static_cast<float>(static_cast<int64_t>(raw))
+                             : static_cast<float>(raw);
+      CHECK((kRaw * kSignal.scale) + kSignal.offset == values[i]);
+    }
+  }
+
+  SECTION("Encode() is the inverse of Decode()")
+  {
+    // Setup
+    const std::array<float, 4> kValues = { 1234.5f, -12.0f, 1.0f, 42.0f };
+
+    // Exercise
+    Can::Message_t message = kMotorStatus.Encode(kValues);
+
+    // Verify
+    CHECK(0x140 == message.id);
+    CHECK(8 == message.length);
+    CHECK(Can::Message_t::Format::kStandard == message.format);
+    CHECK(0x4A == message.payload[0]);
+    CHECK(0x13 == message.payload[1]);
+    CHECK(28 == message.payload[2]);
+    CHECK(0x01 == message.payload[3]);
+    CHECK(0x00 == message.payload[6]);
+    CHECK(0x2A == message.payload[7]);
+    CHECK(kValues == kMotorStatus.Decode(message));
+  }
+
+  SECTION("Encode() leaves other bits untouched")
+  {
+    // Setup
+    Can::Message_t message = {
+      .id      = 0x140,
+      .length  = 8,
+      .payload = { 0, 0, 0, 0xFE, 0x55, 0xAA, 0, 0 },
+    };
+
+    // Exercise
+    kMotorStatus.Encode(message, { 0.0f, -40.0f, 0.0f, 0.0f });
+
+    // Verify
+    CHECK(0xFE == message.payload[3]);
+    CHECK(0x55 == message.payload[4]);
+    CHECK(0xAA == message.payload[5]);
+  }
+
+  SECTION("Short payloads")
+  {
+    // Setup
+    constexpr CanFrame_t<1> kShort = {
+      .id      = 0x10,
+      .length  = 2,
+      .signals = { { { .position = 4,
+                       .width    = 8,
+                       .endian   = Endian::kLittle } } },
+    };
+    static_assert(kShort.IsValid());
+
+    // Exercise
+    Can::Message_t message = kShort.Encode({ 0xAB });
+
+    // Verify
+    CHECK(2 == message.length);
+    CHECK(0x0A == message.payload[0]);
+    CHECK(0xB0 == message.payload[1]);
+    CHECK(0xAB == kShort.Decode(message)[0]);
+  }
+}
+
+TEST_CASE("Testing CanSignalDecoder")
+{
+  Mock<Can> mock_can;
+  Fake(Method(mock_can, Can::ModuleInitialize));
+  When(Method(mock_can, Can::AddAcceptanceFilter)).AlwaysReturn(true);
+
+  StaticMemoryResource<1024> memory_resource;
+  CanNetwork network(mock_can.get(), &memory_resource);
+
+  // Setup
+  When(Method(mock_can, Can::HasData))
+      .Return(true)
+      .Return(true)
+      .Return(false)
+      .AlwaysReturn(false);
+  When(Method(mock_can, Can::Receive))
+      .Return(kMotorStatus.Encode({ 100.0f, 20.0f, 0.0f, 7.0f }))
+      .Return(Can::Message_t{ .id = 0x200, .length = 8, .payload = {} });
+
+  CanSignalDecoder motor_status(network, kMotorStatus);
+  uint32_t last_sequence = 0;
+
+  // Exercise
+  const auto kBefore = motor_status.Get();
+  network.ManuallyCallReceiveHandler();
+  const auto kChanged = motor_status.GetIfChanged(last_sequence);
+  network.ManuallyCallReceiveHandler();
+  const auto kUnchanged = motor_status.GetIfChanged(last_sequence);
+
+  // Verify
+  CHECK(std::array<float, 4>{} == kBefore);
+  REQUIRE(kChanged.has_value());
+  CHECK(std::array<float, 4>{ 100.0f, 20.0f, 0.0f, 7.0f } == *kChanged);
+  CHECK(!kUnchanged.has_value());
+  CHECK(*kChanged == motor_status.Get());
+  CHECK(network.Find(0x140) != nullptr);
+  CHECK(network.Find(0x140)->SecureGet().payload[0] ==
+        kMotorStatus.Encode({ 100.0f, 20.0f, 0.0f, 7.0f }).payload[0]);
+}
+}  // namespace sjsu
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <system_error>
+
+#include <libcore/peripherals/can.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu
+{
+/// Schedules the transmission of CAN messages by priority, so that urgent
+/// messages are not held up behind a bulk transfer queued by software.
+///
+/// Messages wait in a priority queue ordered as they would arbitrate on the
+/// bus: lowest ID first, and a standard ID before an extended ID with the
+/// same base. Messages with the same ID keep the order they were sent in.
+///
+/// On peripherals with individually controlled transmit mailboxes, see
+/// Can::TransmitMailboxes(), the mailboxes are kept loaded with the highest
+/// priority messages. When a message arrives that outranks a message in a
+/// full set of mailboxes, the lowest priority mailbox is aborted and its
+/// message returned to the queue. On other peripherals, messages are handed
+/// to Can::Send() one at a time in priority order.
+///
+/// Update() must be called when a mailbox empties, usually from the CAN
+/// transmit interrupt, or otherwise regularly from the main loop. Send() and
+/// Update() must not run at the same time as each other, for example from the
+/// main loop and an interrupt, without a lock. As Can::AbortMailbox() waits
+/// for a message already on the bus, this includes a transmit interrupt
+/// arriving while Send() preempts a mailbox.
+///
+/// USAGE:
+///
+///    sjsu::CanTransmitQueue<32> transmit_queue(can);
+///
+///    for (const auto & chunk : firmware_image)
+///    {
+///      transmit_queue.Send(chunk);  // ID 0x700, sent when the bus allows
+///    }
+///    transmit_queue.Send(motor_command);  // ID 0x100, sent next
+///
+/// @tparam kCapacity - number of messages the queue can hold.
+/// @tparam kMaximumMailboxes - number of mailboxes used, at most.
+template <size_t kCapacity, size_t kMaximumMailboxes = 8>
+class CanTransmitQueue
+{
+ public:
+  /// Counts of what the queue has done.
+  struct Statistics_t
+  {
+    /// Messages loaded into mailboxes or handed to Can::Send().
+    size_t loaded = 0;
+    /// Messages aborted in a mailbox and returned to the queue to make room
+    /// for a higher priority message.
+    size_t preempted = 0;
+    /// Largest number of messages waiting in the queue at once.
+    size_t max_pending = 0;
+  };
+
+  /// @param can - initialized CAN peripheral.
+  explicit CanTransmitQueue(Can & can) : can_(can) {}
+
+  CanTransmitQueue(const CanTransmitQueue &) = delete;
+  CanTransmitQueue & operator=(const CanTransmitQueue &) = delete;
+
+  /// Queue a message and start sending the highest priority messages.
+  ///
+  /// @param message - message to send.
+  /// @throw std::errc::no_buffer_space - if kCapacity messages are waiting.
+  void Send(const Can::Message_t & message)
+  {
+    if (count_ >= kCapacity)
+    {
+      throw Exception(std::errc::no_buffer_space,
+                      "CAN transmit queue is full.");
+    }
+
+    Push({ .key = Key(message), .message = message });
+    statistics_.max_pending = std::max(statistics_.max_pending, count_);
+    Update();
+  }
+
+  /// Refill empty mailboxes with the highest priority messages, and abort
+  /// lower priority messages in mailboxes to make room for higher priority
+  /// ones.
+  void Update()
+  {
+    const size_t kMailboxes =
+        std::min(can_.TransmitMailboxes(), kMaximumMailboxes);
+
+    if (kMailboxes == 0)
+    {
+      while (count_ > 0)
+      {
+        can_.Send(Pop().message);
+        statistics_.loaded++;
+      }
+      return;
+    }
+
+    for (size_t i = 0; i < kMailboxes; i++)
+    {
+      if (mailboxes_[i] && !can_.IsMailboxPending(i))
+      {
+        mailboxes_[i].reset();
+      }
+    }
+
+    while (count_ > 0 && !IsInMailbox(queue_[0].message))
+    {
+      std::optional<size_t> target = FreeMailbox(kMailboxes);
+
+      if (!target)
+      {
+        target = LowestMailbox(kMailboxes);
+        if (mailboxes_[*target]->key < queue_[0].key)
+        {
+          return;
+        }
+
+        if (can_.AbortMailbox(*target))
+        {
+          Entry_t preempted = *mailboxes_[*target];
+          mailboxes_[*target].reset();
+          Push(preempted);
+          statistics_.preempted++;
+          continue;
+        }
+      }
+
+      mailboxes_[*target] = Pop();
+      can_.LoadMailbox(*target, mailboxes_[*target]->message);
+      statistics_.loaded++;
+    }
+  }
+
+  /// @return size_t - number of messages waiting in the queue, not counting
+  ///         those in mailboxes.
+  size_t Pending() const
+  {
+    return count_;
+  }
+
+  /// @return const Statistics_t & - counts of what the queue has done.
+  const Statistics_t & GetStatistics() const
+  {
+    return statistics_;
+  }
+
+ private:
+  struct Entry_t
+  {
+    /// Arbitration priority in the upper bits, order of sending in the lower
+    /// bits. Lower is sent first.
+    uint64_t key;
+    Can::Message_t message;
+  };
+
+  /// Greater key is lower priority, making the heap a min-heap.
+  static bool LowerPriority(const Entry_t & left, const Entry_t & right)
+  {
+    return left.key > right.key;
+  }
+
+  /// @return uint64_t - the message's arbitration field as bits on the bus,
+  ///         followed by its order of sending.
+  uint64_t Key(const Can::Message_t & message)
+  {
+    const uint64_t kArbitration =
+        (message.format == Can::Message_t::Format::kExtended)
+            ? ((uint64_t{ message.id } << 1) | 1)
+            : (uint64_t{ message.id } << 19);
+    return (kArbitration << 32) | sequence_++;
+  }
+
+  void Push(const Entry_t & entry)
+  {
+    queue_[count_++] = entry;
+    std::push_heap(queue_.begin(), queue_.begin() + count_, LowerPriority);
+  }
+
+  Entry_t Pop()
+  {
+    std::pop_heap(queue_.begin(), queue_.begin() + count_, LowerPriority);
+    return queue_[--count_];
+  }
+
+  /// Mailboxes holding messages with the same ID may be sent in either
+  /// order, so a message waits while another with its ID is in a mailbox.
+  bool IsInMailbox(const Can::Message_t & message) const
+  {
+    return std::any_of(mailboxes_.begin(),
+                       mailboxes_.end(),
+                       [&message](const std::optional<Entry_t> & entry) {
+                         return entry && entry->message.id == message.id &&
+                                entry->message.format == message.format;
+                       });
+  }
+
+  std::optional<size_t> FreeMailbox(size_t mailboxes) const
+  {
+    for (size_t i = 0; i < mailboxes; i++)
+    {
+      if (!mailboxes_[i])
+      {
+        return i;
+      }
+    }
+    return std::nullopt;
+  }
+
+  size_t LowestMailbox(size_t mailboxes) const
+  {
+    size_t lowest = 0;
+    for (size_t i = 1; i < mailboxes; i++)
+    {
+      if (mailboxes_[i]->key > mailboxes_[lowest]->key)
+      {
+        lowest = i;
+      }
+    }
+    return lowest;
+  }
+
+  Can & can_;
+  std::array<Entry_t, kCapacity + kMaximumMailboxes> queue_;
+  std::array<std::optional<Entry_t>, kMaximumMailboxes> mailboxes_{};
+  size_t count_      = 0;
+  uint32_t sequence_ = 0;
+  Statistics_t statistics_;
+};
+}  // namespace sjsu
@@ -0,0 +1,180 @@
+#include <libcore/systems/can_transmit_queue.hpp>
+
+#include <vector>
+
+#include <libcore/testing/simulated_peripherals.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing CanTransmitQueue")
+{
+  VirtualClock clock;
+  clock.Start();
+
+  const auto kFrame = [](uint32_t id, uint8_t data = 0) {
+    return Can::Message_t{ .id = id, .length = 8, .payload = { data } };
+  };
+
+  std::vector<Can::Message_t> sent;
+
+  SECTION("Higher priority messages preempt mailboxes")
+  {
+    // Setup
+    simulation::Can can(clock, { .tx_mailboxes = 3 });
+    can.settings.baud_rate = 500_kHz;
+    can.Initialize();
+    CanTransmitQueue<16> queue(can);
+    can.on_transmit = [&](const Can::Message_t & message) {
+      sent.push_back(message);
+      queue.Update();
+    };
+
+    // Exercise
+    for (uint32_t id = 0x700; id < 0x705; id++)
+    {
+      queue.Send(kFrame(id));
+    }
+    const size_t kPendingBefore = queue.Pending();
+    queue.Send(kFrame(0x100));
+    clock.Advance(5ms);
+
+    // Verify
+    CHECK(2 == kPendingBefore);
+    REQUIRE(6 == sent.size());
+    CHECK(0x700 == sent[0].id);
+    CHECK(0x100 == sent[1].id);
+    CHECK(0x701 == sent[2].id);
+    CHECK(0x702 == sent[3].id);
+    CHECK(0x703 == sent[4].id);
+    CHECK(0x704 == sent[5].id);
+    CHECK(0 == queue.Pending());
+    CHECK(1 == queue.GetStatistics().preempted);
+    CHECK(7 == queue.GetStatistics().loaded);
+    CHECK(3 == queue.GetStatistics().max_pending);
+  }
+
+  SECTION("Messages with the same ID keep their order")
+  {
+    // Setup
+    simulation::Can can(clock, { .tx_mailboxes = 3 });
+    can.settings.baud_rate = 500_kHz;
+    can.Initialize();
+    CanTransmitQueue<16> queue(can);
+    can.on_transmit = [&](const Can::Message_t & message) {
+      sent.push_back(message);
+      queue.Update();
+    };
+
+    // Exercise
+    queue.Send(kFrame(0x300, 1));
+    queue.Send(kFrame(0x300, 2));
+    queue.Send(kFrame(0x300, 3));
+    queue.Send(kFrame(0x200, 4));
+    clock.Advance(5ms);
+
+    // Verify
+    REQUIRE(4 == sent.size());
+    CHECK(1 == sent[0].payload[0]);
+    CHECK(4 == sent[1].payload[0]);
+    CHECK(2 == sent[2].payload[0]);
+    CHECK(3 == sent[3].payload[0]);
+  }
+
+  SECTION("Standard IDs outrank extended IDs with the same base")
+  {
+    // Setup
+    simulation::Can can(clock, { .tx_mailboxes = 1 });
+    can.settings.baud_rate = 500_kHz;
+    can.Initialize();
+    CanTransmitQueue<16> queue(can);
+    can.on_transmit = [&](const Can::Message_t & message) {
+      sent.push_back(message);
+    };
+    Can::Message_t extended = kFrame(0x100 << 18);
+    extended.format         = Can::Message_t::Format::kExtended;
+
+    // Exercise
+    // Another node holds the bus while the queue fills.
+    can.Inject(kFrame(0x001));
+    queue.Send(kFrame(0x7FF));
+    queue.Send(extended);
+    queue.Send(kFrame(0x100));
+    for (int i = 0; i < 10; i++)
+    {
+      clock.Advance(500us);
+      queue.Update();
+    }
+
+    // Verify
+    REQUIRE(3 == sent.size());
+    CHECK(0x100 == sent[0].id);
+    CHECK(Can::Message_t::Format::kExtended == sent[1].format);
+    CHECK(0x7FF == sent[2].id);
+    CHECK(2 == queue.GetStatistics().preempted);
+  }
+
+  SECTION("A message already on the bus is not preempted")
+  {
+    // Setup
+    simulation::Can can(clock, { .tx_mailboxes = 1 });
+    can.settings.baud_rate = 500_kHz;
+    can.Initialize();
+    CanTransmitQueue<16> queue(can);
+    can.on_transmit = [&](const Can::Message_t & message) {
+      sent.push_back(message);
+    };
+
+    // Exercise
+    queue.Send(kFrame(0x700));
+    queue.Send(kFrame(0x100));
+    clock.Advance(5ms);
+
+    // Verify
+    REQUIRE(2 == sent.size());
+    CHECK(0x700 == sent[0].id);
+    CHECK(0x100 == sent[1].id);
+    CHECK(0 == queue.GetStatistics().preempted);
+  }
+
+  SECTION("Peripherals without mailboxes use Send()")
+  {
+    // Setup
+    Mock<Can> mock_can;
+    When(Method(mock_can, Can::TransmitMailboxes)).AlwaysReturn(0);
+    When(OverloadedMethod(mock_can, Can::Send, void(const Can::Message_t &)))
+        .AlwaysDo([&sent](const Can::Message_t & message) {
+          sent.push_back(message);
+        });
+    CanTransmitQueue<16> queue(mock_can.get());
+
+    // Exercise
+    queue.Send(kFrame(0x200));
+    queue.Send(kFrame(0x100));
+
+    // Verify
+    REQUIRE(2 == sent.size());
+    CHECK(0x200 == sent[0].id);
+    CHECK(0x100 == sent[1].id);
+  }
+
+  SECTION("Send() throws when full")
+  {
+    // Setup
+    simulation::Can can(clock, { .tx_mailboxes = 1 });
+    can.settings.baud_rate = 500_kHz;
+    can.Initialize();
+    CanTransmitQueue<2> queue(can);
+
+    // Exercise
+    queue.Send(kFrame(0x10));
+    queue.Send(kFrame(0x20));
+    queue.Send(kFrame(0x30));
+
+    // Verify
+    SJ2_CHECK_EXCEPTION(queue.Send(kFrame(0x40)), std::errc::no_buffer_space);
+  }
+
+  clock.Stop();
+}
+}  // namespace sjsu
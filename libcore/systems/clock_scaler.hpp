@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <libcore/peripherals/system_controller.hpp>
+#include <libcore/utility/inplace_function.hpp>
+
+namespace sjsu
+{
+/// When ClockScaler::Update() changes the performance level.
+struct ClockScalingPolicy_t
+{
+  /// Utilization, in percent, at or above which the fastest level is
+  /// selected.
+  uint8_t boost_at = 80;
+  /// Utilization, in percent, at or below which the level is lowered by one.
+  uint8_t throttle_at = 30;
+};
+
+/// Scales the system's clocks at runtime between a number of performance
+/// levels: boosting to the fastest as soon as the processor is busy, and
+/// stepping down one level at a time while it is idle.
+///
+/// After every change, SystemController::NotifyClockChange() is called, so
+/// that modules registered with a SystemController::ClockChangeListener, such
+/// as a Uart, Spi, I2c, Pwm or SystemTimer, derive their dividers again from
+/// their CurrentSettings() and keep their baud rates and frequencies.
+///
+/// USAGE:
+///
+///    sjsu::ClockScaler scaler(3, [&](size_t level) {
+///      config.cpu.divider = kDividers[level];
+///      system_controller.Initialize();
+///    });
+///    sjsu::SystemController::ClockChangeListener uart_retiming(
+///        [&uart]() { uart.Reinitialize(); });
+///
+///    // Every 100ms, with the share of time the processor was not asleep:
+///    scaler.Update(utilization);
+class ClockScaler
+{
+ public:
+  /// Switches the system's clocks to a performance level, 0 being the
+  /// slowest. Usually changes the SystemController's ClockConfiguration and
+  /// calls its Initialize().
+  using ApplyLevel = InplaceFunction<void(size_t level)>;
+
+  /// The system is assumed to start at the fastest level.
+  ///
+  /// @param levels - number of performance levels, at least 1.
+  /// @param apply - switches the clocks to a level.
+  /// @param policy - when Update() changes the level.
+  ClockScaler(size_t levels,
+              ApplyLevel apply,
+              const ClockScalingPolicy_t & policy = {})
+      : levels_(std::max<size_t>(levels, 1)),
+        level_(levels_ - 1),
+        apply_(apply),
+        policy_(policy)
+  {
+  }
+
+  /// Switch to a performance level and notify the clock change listeners.
+  /// Does nothing if already at that level.
+  ///
+  /// @param level - performance level, limited to the fastest.
+  void SetLevel(size_t level)
+  {
+    level = std::min(level, levels_ - 1);
+    if (level == level_)
+    {
+      return;
+    }
+
+    apply_(level);
+    level_ = level;
+    SystemController::NotifyClockChange();
+  }
+
+  /// Boost or throttle the clocks according to how busy the processor has
+  /// been.
+  ///
+  /// @param utilization - percentage of the recent past the processor was
+  ///        busy, 0 to 100.
+  void Update(uint8_t utilization)
+  {
+    if (utilization >= policy_.boost_at)
+    {
+      SetLevel(levels_ - 1);
+    }
+    else if (utilization <= policy_.throttle_at && level_ > 0)
+    {
+      SetLevel(level_ - 1);
+    }
+  }
+
+  /// @return size_t - the current performance level.
+  size_t Level() const
+  {
+    return level_;
+  }
+
+  /// @return size_t - the number of performance levels.
+  size_t Levels() const
+  {
+    return levels_;
+  }
+
+ private:
+  size_t levels_;
+  size_t level_;
+  ApplyLevel apply_;
+  ClockScalingPolicy_t policy_;
+};
+}  // namespace sjsu
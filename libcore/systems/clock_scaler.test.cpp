@@ -0,0 +1,70 @@
+#include <libcore/systems/clock_scaler.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing ClockScaler")
+{
+  std::vector<size_t> applied;
+  int notifications = 0;
+  SystemController::ClockChangeListener listener(
+      [&notifications]() { notifications++; });
+  ClockScaler test_subject(
+      3, [&applied](size_t level) { applied.push_back(level); });
+
+  SECTION("Starts at the fastest level")
+  {
+    // Verify
+    CHECK(2 == test_subject.Level());
+    CHECK(3 == test_subject.Levels());
+    CHECK(applied.empty());
+  }
+
+  SECTION("SetLevel() applies the level and notifies listeners")
+  {
+    // Exercise
+    test_subject.SetLevel(0);
+    test_subject.SetLevel(0);
+    test_subject.SetLevel(10);
+
+    // Verify
+    CHECK(std::vector<size_t>{ 0, 2 } == applied);
+    CHECK(2 == notifications);
+    CHECK(2 == test_subject.Level());
+  }
+
+  SECTION("Update() throttles one level at a time and boosts to the top")
+  {
+    // Exercise
+    test_subject.Update(10);
+    test_subject.Update(50);
+    test_subject.Update(30);
+    test_subject.Update(0);
+    test_subject.Update(90);
+
+    // Verify
+    CHECK(std::vector<size_t>{ 1, 0, 2 } == applied);
+  }
+
+  SECTION("Destroyed listeners are not notified")
+  {
+    // Setup
+    int other_notifications = 0;
+    {
+      SystemController::ClockChangeListener other(
+          [&other_notifications]() { other_notifications++; });
+      test_subject.SetLevel(1);
+    }
+
+    // Exercise
+    test_subject.SetLevel(0);
+
+    // Verify
+    CHECK(1 == other_notifications);
+    CHECK(2 == notifications);
+  }
+}
+}  // namespace sjsu
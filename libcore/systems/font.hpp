@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <libcore/external/font8x8/font8x8_basic.h>
+#include <libcore/external/font8x8/font8x8_block.h>
+#include <libcore/external/font8x8/font8x8_box.h>
+#include <libcore/external/font8x8/font8x8_control.h>
+#include <libcore/external/font8x8/font8x8_ext_latin.h>
+#include <libcore/external/font8x8/font8x8_greek.h>
+#include <libcore/external/font8x8/font8x8_hiragana.h>
+#include <libcore/external/font8x8/font8x8_sga.h>
+
+namespace sjsu
+{
+/// A font of 8 by 8 pixel glyphs, looked up by unicode code point.
+///
+/// A font is a list of blocks, each a contiguous range of code points. Its
+/// glyphs are stored in one of two layouts: the row by row layout of the
+/// font8x8 tables, or transposed, column by column, to match the page major
+/// memory of monochrome displays such as the SSD1306, where they can be
+/// copied a byte per column. The fonts in sjsu::font are built at compile
+/// time, so only the fonts used take up space in the program.
+///
+/// USAGE:
+///
+///    graphics.SetFont(sjsu::font::kUnicodeColumns);
+///    graphics.DrawCharacter(0, 0, U'Ω');
+class Font8x8
+{
+ public:
+  /// The 8 bytes of a glyph.
+  using Glyph_t = std::array<uint8_t, 8>;
+
+  /// Layouts of the bytes of a glyph.
+  enum class Layout : uint8_t
+  {
+    /// A byte per row, top row first. The least significant bit of each byte
+    /// is the left most pixel.
+    kRows,
+    /// A byte per column, left column first. The least significant bit of
+    /// each byte is the top most pixel.
+    kColumns,
+  };
+
+  /// A contiguous range of code points, starting at `first`.
+  struct Block_t
+  {
+    /// Code point of the first glyph.
+    char32_t first;
+    /// The glyphs of the block, one per code point.
+    std::span<const Glyph_t> glyphs;
+  };
+
+  /// @param layout - layout of every glyph in `blocks`.
+  /// @param blocks - the blocks of the font. Must outlive the font.
+  constexpr Font8x8(Layout layout, std::span<const Block_t> blocks)
+      : layout_(layout), blocks_(blocks)
+  {
+  }
+
+  /// @param code_point - unicode code point to look up.
+  /// @return const Glyph_t* - the glyph of the code point, or nullptr if the
+  ///         font does not have one.
+  constexpr const Glyph_t * Find(char32_t code_point) const
+  {
+    for (const auto & block : blocks_)
+    {
+      if (block.first <= code_point &&
+          code_point - block.first < block.glyphs.size())
+      {
+        return &block.glyphs[code_point - block.first];
+      }
+    }
+    return nullptr;
+  }
+
+  /// @return constexpr Layout - the layout of the glyphs of this font.
+  constexpr Layout GetLayout() const
+  {
+    return layout_;
+  }
+
+  /// Convert a glyph from one layout to the other.
+  ///
+  /// @param glyph - the glyph to convert.
+  /// @return constexpr Glyph_t - the glyph with its rows and columns swapped.
+  static constexpr Glyph_t Transpose(const Glyph_t & glyph)
+  {
+    Glyph_t transposed = {};
+    for (size_t row = 0; row < 8; row++)
+    {
+      for (size_t column = 0; column < 8; column++)
+      {
+        if ((glyph[row] >> column) & 1)
+        {
+          transposed[column] =
+              static_cast<uint8_t>(transposed[column] | (1 << row));
+        }
+      }
+    }
+    return transposed;
+  }
+
+  /// Build the glyphs of a block from a font8x8 table.
+  ///
+  /// @param table - a font8x8 table, such as font8x8_basic.
+  /// @param layout - layout to store the glyphs in.
+  /// @return constexpr auto - the glyphs, for use as Block_t::glyphs.
+  template <size_t kCount>
+  static constexpr std::array<Glyph_t, kCount> FromTable(
+      const uint8_t (&table)[kCount][8],
+      Layout layout)
+  {
+    std::array<Glyph_t, kCount> glyphs = {};
+    for (size_t i = 0; i < kCount; i++)
+    {
+      for (size_t row = 0; row < 8; row++)
+      {
+        glyphs[i][row] = table[i][row];
+      }
+      if (layout == Layout::kColumns)
+      {
+        glyphs[i] = Transpose(glyphs[i]);
+      }
+    }
+    return glyphs;
+  }
+
+ private:
+  Layout layout_;
+  std::span<const Block_t> blocks_;
+};
+
+/// Fonts built from the font8x8 tables.
+namespace font
+{
+namespace detail
+{
+/// Glyphs of every font8x8 table in one layout, and the blocks they form.
+template <Font8x8::Layout kLayout>
+struct Tables
+{
+  static constexpr auto kBasic =
+      Font8x8::FromTable(font8x8_basic, kLayout);  // U+0000 - U+007F
+  static constexpr auto kControl =
+      Font8x8::FromTable(font8x8_control, kLayout);  // U+0080 - U+009F
+  static constexpr auto kExtendedLatin =
+      Font8x8::FromTable(font8x8_ext_latin, kLayout);  // U+00A0 - U+00FF
+  static constexpr auto kGreek =
+      Font8x8::FromTable(font8x8_greek, kLayout);  // U+0390 - U+03C9
+  static constexpr auto kBox =
+      Font8x8::FromTable(font8x8_box, kLayout);  // U+2500 - U+257F
+  static constexpr auto kBlock =
+      Font8x8::FromTable(font8x8_block, kLayout);  // U+2580 - U+259F
+  static constexpr auto kHiragana =
+      Font8x8::FromTable(font8x8_hiragana, kLayout);  // U+3040 - U+309F
+  static constexpr auto kSga =
+      Font8x8::FromTable(font8x8_sga, kLayout);  // U+E541 - U+E55A
+
+  static constexpr std::array<Font8x8::Block_t, 1> kBasicBlocks = { {
+      { .first = 0x0000, .glyphs = kBasic },
+  } };
+
+  static constexpr std::array<Font8x8::Block_t, 8> kUnicodeBlocks = { {
+      { .first = 0x0000, .glyphs = kBasic },
+      { .first = 0x0080, .glyphs = kControl },
+      { .first = 0x00A0, .glyphs = kExtendedLatin },
+      { .first = 0x0390, .glyphs = kGreek },
+      { .first = 0x2500, .glyphs = kBox },
+      { .first = 0x2580, .glyphs = kBlock },
+      { .first = 0x3040, .glyphs = kHiragana },
+      { .first = 0xE541, .glyphs = kSga },
+  } };
+};
+}  // namespace detail
+
+/// Basic latin, U+0000 to U+007F, in the row layout.
+inline constexpr Font8x8 kBasic(
+    Font8x8::Layout::kRows,
+    detail::Tables<Font8x8::Layout::kRows>::kBasicBlocks);
+
+/// Basic latin, U+0000 to U+007F, in the column layout.
+inline constexpr Font8x8 kBasicColumns(
+    Font8x8::Layout::kColumns,
+    detail::Tables<Font8x8::Layout::kColumns>::kBasicBlocks);
+
+/// Every font8x8 block with contiguous code points: latin, greek, box
+/// drawing, block elements, hiragana and SGA, in the row layout.
+inline constexpr Font8x8 kUnicode(
+    Font8x8::Layout::kRows,
+    detail::Tables<Font8x8::Layout::kRows>::kUnicodeBlocks);
+
+/// The blocks of kUnicode, in the column layout.
+inline constexpr Font8x8 kUnicodeColumns(
+    Font8x8::Layout::kColumns,
+    detail::Tables<Font8x8::Layout::kColumns>::kUnicodeBlocks);
+}  // namespace font
+}  // namespace sjsu
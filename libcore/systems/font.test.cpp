@@ -0,0 +1,47 @@
+#include <libcore/systems/font.hpp>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing Font8x8")
+{
+  SECTION("Find() looks up code points across every block")
+  {
+    // Exercise & Verify
+    CHECK(*font::kUnicode.Find(U'A') ==
+          Font8x8::Glyph_t{ 0x0C, 0x1E, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x00 });
+    CHECK(font::kUnicode.Find(U'é') != nullptr);
+    CHECK(font::kUnicode.Find(U'Ω') != nullptr);
+    CHECK(font::kUnicode.Find(U'─') != nullptr);
+    CHECK(font::kUnicode.Find(U'▟') != nullptr);
+    CHECK(font::kUnicode.Find(U'あ') != nullptr);
+    CHECK(font::kUnicode.Find(U'ϊ') == nullptr);
+    CHECK(font::kUnicode.Find(U'☀') == nullptr);
+    CHECK(font::kBasic.Find(U'é') == nullptr);
+  }
+
+  SECTION("Transpose() swaps rows and columns")
+  {
+    // Setup
+    // The top row, and the pixel in the bottom right corner.
+    constexpr Font8x8::Glyph_t kGlyph = { 0xFF, 0, 0, 0, 0, 0, 0, 0x80 };
+
+    // Exercise
+    constexpr auto kTransposed = Font8x8::Transpose(kGlyph);
+
+    // Verify
+    static_assert(kTransposed ==
+                  Font8x8::Glyph_t{ 1, 1, 1, 1, 1, 1, 1, 0x81 });
+    static_assert(Font8x8::Transpose(kTransposed) == kGlyph);
+  }
+
+  SECTION("Column fonts hold the transposed glyphs")
+  {
+    // Exercise & Verify
+    CHECK(font::kUnicodeColumns.GetLayout() == Font8x8::Layout::kColumns);
+    CHECK(*font::kUnicodeColumns.Find(U'Ω') ==
+          Font8x8::Transpose(*font::kUnicode.Find(U'Ω')));
+  }
+}
+}  // namespace sjsu
@@ -1,22 +0,0 @@
-/**
- * 8x8 monochrome bitmap fonts for rendering
- * Author: Daniel Hepper <daniel@hepper.net>
- *
- * License: Public Domain
- *
- * Based on:
- * http://dimensionalrift.homelinux.net/combuster/mos3/?p=viewsource&file=/modules/gfx/font8_8.asm
- **/
-
-// SJSU-Dev2: Adding pragma once
-#pragma once
-
-#include "font8x8_basic.h"
-#include "font8x8_control.h"
-#include "font8x8_ext_latin.h"
-#include "font8x8_greek.h"
-#include "font8x8_misc.h"
-#include "font8x8_box.h"
-#include "font8x8_block.h"
-#include "font8x8_hiragana.h"
-#include "font8x8_sga.h"
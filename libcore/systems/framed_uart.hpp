@@ -0,0 +1,476 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/utility/math/crc.hpp>
+
+namespace sjsu
+{
+/// Byte stuffing used by FramedUart to mark the boundaries of frames.
+enum class Framing : uint8_t
+{
+  /// Consistent Overhead Byte Stuffing. Frames end with a 0x00 byte, which
+  /// never appears within a frame, at a cost of 1 byte per 254.
+  kCobs,
+  /// Serial Line Internet Protocol (RFC 1055). Frames begin and end with
+  /// 0xC0, and 0xC0 and 0xDB within a frame are escaped as two bytes.
+  kSlip,
+};
+
+/// Sends and receives frames of binary data over a Uart, such as telemetry
+/// packets, with each frame checked by a CRC.
+///
+/// Frames are encoded as they are written: runs of bytes that need no
+/// stuffing are passed to Uart::Write() straight from the caller's buffer,
+/// and only the stuffing bytes, short runs and the CRC are gathered in a
+/// small staging buffer, so no escaped copy of the frame is made.
+///
+/// Received bytes are decoded as they are read, in place from the driver's
+/// receive buffer when it supports Uart::PeekReceived(), straight into the
+/// receive buffer given to the constructor. Bytes following a complete frame
+/// are left in the driver for the next call to Receive().
+///
+/// USAGE:
+///
+///    std::array<uint8_t, 128> buffer;
+///    sjsu::FramedUart<sjsu::Framing::kCobs> link(uart, buffer);
+///
+///    link.Send(telemetry);
+///
+///    while (auto frame = link.Receive())
+///    {
+///      Handle(*frame);
+///    }
+///
+/// @tparam kFraming - byte stuffing of the frames.
+/// @tparam kCrc - CRC appended to each frame, least significant byte first.
+template <Framing kFraming, crc::Definition_t kCrc = crc::kCrc16Ccitt>
+class FramedUart
+{
+ public:
+  /// Number of bytes of CRC appended to each frame.
+  static constexpr size_t kCrcBytes = (kCrc.width + 7) / 8;
+
+  /// Counts of what the framer has done.
+  struct Statistics_t
+  {
+    /// Frames passed to Send().
+    uint32_t frames_sent = 0;
+    /// Frames received with a valid CRC.
+    uint32_t frames_received = 0;
+    /// Frames received with an invalid CRC.
+    uint32_t crc_errors = 0;
+    /// Frames dropped because they did not fit the receive buffer.
+    uint32_t oversized = 0;
+    /// Frames dropped because their stuffing was invalid or they were too
+    /// short to hold a CRC.
+    uint32_t malformed = 0;
+  };
+
+  /// @param length - bytes of payload.
+  /// @return constexpr size_t - the most bytes Send() writes to the Uart for
+  ///         a payload of this length.
+  static constexpr size_t MaximumEncodedSize(size_t length)
+  {
+    const size_t kLength = length + kCrcBytes;
+    if constexpr (kFraming == Framing::kCobs)
+    {
+      return kLength + (kLength / kCobsMaximumRun) + 2;
+    }
+    else
+    {
+      return (2 * kLength) + 2;
+    }
+  }
+
+  /// @param uart - initialized UART port.
+  /// @param receive_buffer - holds received frames, including their CRC.
+  ///        Frames longer than it are dropped.
+  FramedUart(Uart & uart, std::span<uint8_t> receive_buffer)
+      : uart_(uart), buffer_(receive_buffer)
+  {
+  }
+
+  FramedUart(const FramedUart &) = delete;
+  FramedUart & operator=(const FramedUart &) = delete;
+
+  /// Encode a frame and write it to the Uart.
+  ///
+  /// @param payload - bytes of the frame, not including the CRC.
+  void Send(std::span<const uint8_t> payload)
+  {
+    const uint64_t kChecksum = crc::Engine<kCrc>::Calculate(payload);
+    std::array<uint8_t, kCrcBytes> checksum;
+    for (size_t i = 0; i < kCrcBytes; i++)
+    {
+      checksum[i] = static_cast<uint8_t>(kChecksum >> (i * 8));
+    }
+
+    if constexpr (kFraming == Framing::kCobs)
+    {
+      EncodeCobs(payload, checksum);
+    }
+    else
+    {
+      EncodeSlip(payload, checksum);
+    }
+
+    Flush();
+    statistics_.frames_sent++;
+  }
+
+  /// Decode received bytes until a frame is complete.
+  ///
+  /// @return std::optional<std::span<const uint8_t>> - the payload of the
+  ///         next frame with a valid CRC, which stays valid until the next
+  ///         call, or std::nullopt if no frame has been completely received.
+  std::optional<std::span<const uint8_t>> Receive()
+  {
+    auto bytes = uart_.PeekReceived();
+    while (!bytes.empty())
+    {
+      for (size_t i = 0; i < bytes.size(); i++)
+      {
+        if (auto frame = Decode(bytes[i]))
+        {
+          uart_.ConsumeReceived(i + 1);
+          return frame;
+        }
+      }
+      uart_.ConsumeReceived(bytes.size());
+      bytes = uart_.PeekReceived();
+    }
+
+    // Drivers without in place access are read in chunks, and the bytes of a
+    // chunk after a frame are kept for the next call.
+    while (true)
+    {
+      while (chunk_position_ < chunk_length_)
+      {
+        if (auto frame = Decode(chunk_[chunk_position_++]))
+        {
+          return frame;
+        }
+      }
+
+      if (!uart_.HasData())
+      {
+        return std::nullopt;
+      }
+
+      chunk_position_ = 0;
+      chunk_length_   = uart_.Read(chunk_);
+      if (chunk_length_ == 0)
+      {
+        return std::nullopt;
+      }
+    }
+  }
+
+  /// @return const Statistics_t & - counts of what the framer has done.
+  const Statistics_t & GetStatistics() const
+  {
+    return statistics_;
+  }
+
+ private:
+  static constexpr uint8_t kCobsDelimiter  = 0x00;
+  static constexpr size_t kCobsMaximumRun  = 254;
+  static constexpr uint8_t kSlipEnd        = 0xC0;
+  static constexpr uint8_t kSlipEscape     = 0xDB;
+  static constexpr uint8_t kSlipEscapedEnd = 0xDC;
+  static constexpr uint8_t kSlipEscapedEsc = 0xDD;
+
+  /// Runs at least this long are written from the caller's buffer rather
+  /// than copied into the staging buffer.
+  static constexpr size_t kDirectWrite = 16;
+
+  // ===========================================================================
+  // Encoding
+  // ===========================================================================
+
+  /// The payload and CRC, encoded as one sequence of bytes.
+  struct Frame_t
+  {
+    std::span<const uint8_t> payload;
+    std::span<const uint8_t> checksum;
+
+    size_t size() const
+    {
+      return payload.size() + checksum.size();
+    }
+
+    uint8_t operator[](size_t index) const
+    {
+      return (index < payload.size()) ? payload[index]
+                                      : checksum[index - payload.size()];
+    }
+  };
+
+  void EncodeCobs(std::span<const uint8_t> payload,
+                  std::span<const uint8_t> checksum)
+  {
+    const Frame_t kFrame = { .payload = payload, .checksum = checksum };
+    size_t start         = 0;
+
+    // Each block is a code byte, one more than the length of the run of
+    // non-zero bytes that follows it, standing in for the zero that ends the
+    // run. A code of 0xFF marks a run of 254 bytes that is not followed by a
+    // zero.
+    while (true)
+    {
+      size_t end = start;
+      while (end < kFrame.size() && end - start < kCobsMaximumRun &&
+             kFrame[end] != 0)
+      {
+        end++;
+      }
+
+      Put(static_cast<uint8_t>(end - start + 1));
+      PutRange(kFrame, start, end);
+
+      if (end >= kFrame.size())
+      {
+        break;
+      }
+      start = (kFrame[end] == 0) ? end + 1 : end;
+    }
+
+    Put(kCobsDelimiter);
+  }
+
+  void EncodeSlip(std::span<const uint8_t> payload,
+                  std::span<const uint8_t> checksum)
+  {
+    const Frame_t kFrame = { .payload = payload, .checksum = checksum };
+    size_t start         = 0;
+
+    // A leading END ends any line noise received before the frame as a frame
+    // of its own, which the receiver drops.
+    Put(kSlipEnd);
+
+    for (size_t i = 0; i < kFrame.size(); i++)
+    {
+      const uint8_t kByte = kFrame[i];
+      if (kByte == kSlipEnd || kByte == kSlipEscape)
+      {
+        PutRange(kFrame, start, i);
+        Put(kSlipEscape);
+        Put((kByte == kSlipEnd) ? kSlipEscapedEnd : kSlipEscapedEsc);
+        start = i + 1;
+      }
+    }
+
+    PutRange(kFrame, start, kFrame.size());
+    Put(kSlipEnd);
+  }
+
+  /// Write the bytes of the frame from `start` up to `end`.
+  void PutRange(const Frame_t & frame, size_t start, size_t end)
+  {
+    const size_t kPayloadEnd = std::min(end, frame.payload.size());
+    if (start < kPayloadEnd && kPayloadEnd - start >= kDirectWrite)
+    {
+      Flush();
+      uart_.Write(frame.payload.subspan(start, kPayloadEnd - start));
+      start = kPayloadEnd;
+    }
+
+    for (size_t i = start; i < end; i++)
+    {
+      Put(frame[i]);
+    }
+  }
+
+  void Put(uint8_t byte)
+  {
+    staging_[staged_++] = byte;
+    if (staged_ == staging_.size())
+    {
+      Flush();
+    }
+  }
+
+  void Flush()
+  {
+    if (staged_ > 0)
+    {
+      uart_.Write(std::span<const uint8_t>(staging_).first(staged_));
+      staged_ = 0;
+    }
+  }
+
+  // ===========================================================================
+  // Decoding
+  // ===========================================================================
+
+  std::optional<std::span<const uint8_t>> Decode(uint8_t byte)
+  {
+    if constexpr (kFraming == Framing::kCobs)
+    {
+      return DecodeCobs(byte);
+    }
+    else
+    {
+      return DecodeSlip(byte);
+    }
+  }
+
+  std::optional<std::span<const uint8_t>> DecodeCobs(uint8_t byte)
+  {
+    if (byte == kCobsDelimiter)
+    {
+      // A frame that ends part way through a block was cut short.
+      const bool kComplete = (remaining_ == 0);
+      remaining_           = 0;
+      pending_zero_        = false;
+      return EndFrame(kComplete);
+    }
+
+    started_ = true;
+    if (discarding_)
+    {
+      return std::nullopt;
+    }
+
+    if (remaining_ == 0)
+    {
+      // The zero ending the previous block's run belongs to the frame only
+      // if another block follows it.
+      if (pending_zero_)
+      {
+        Append(0);
+      }
+      remaining_    = byte - 1;
+      pending_zero_ = (byte != kCobsMaximumRun + 1);
+    }
+    else
+    {
+      Append(byte);
+      remaining_--;
+    }
+
+    return std::nullopt;
+  }
+
+  std::optional<std::span<const uint8_t>> DecodeSlip(uint8_t byte)
+  {
+    if (byte == kSlipEnd)
+    {
+      const bool kComplete = !escaped_;
+      escaped_             = false;
+      return EndFrame(kComplete);
+    }
+
+    started_ = true;
+    if (discarding_)
+    {
+      return std::nullopt;
+    }
+
+    if (escaped_)
+    {
+      escaped_ = false;
+      if (byte == kSlipEscapedEnd)
+      {
+        Append(kSlipEnd);
+      }
+      else if (byte == kSlipEscapedEsc)
+      {
+        Append(kSlipEscape);
+      }
+      else
+      {
+        statistics_.malformed++;
+        discarding_ = true;
+      }
+    }
+    else if (byte == kSlipEscape)
+    {
+      escaped_ = true;
+    }
+    else
+    {
+      Append(byte);
+    }
+
+    return std::nullopt;
+  }
+
+  void Append(uint8_t byte)
+  {
+    if (length_ >= buffer_.size())
+    {
+      statistics_.oversized++;
+      discarding_ = true;
+      return;
+    }
+    buffer_[length_++] = byte;
+  }
+
+  /// Check the frame ended by a delimiter and start the next one.
+  ///
+  /// @param complete - the frame's stuffing ended on a boundary.
+  std::optional<std::span<const uint8_t>> EndFrame(bool complete)
+  {
+    const bool kStarted    = started_;
+    const bool kDiscarding = discarding_;
+    const size_t kLength   = length_;
+    started_               = false;
+    discarding_            = false;
+    length_                = 0;
+
+    // Empty frames, such as the leading END of SLIP frames, are not errors.
+    if (!kStarted || kDiscarding)
+    {
+      return std::nullopt;
+    }
+
+    if (!complete || kLength < kCrcBytes)
+    {
+      statistics_.malformed++;
+      return std::nullopt;
+    }
+
+    const auto kPayload = std::span<const uint8_t>(buffer_).first(
+        kLength - kCrcBytes);
+    const uint64_t kChecksum = crc::Engine<kCrc>::Calculate(kPayload);
+    for (size_t i = 0; i < kCrcBytes; i++)
+    {
+      if (buffer_[kPayload.size() + i] !=
+          static_cast<uint8_t>(kChecksum >> (i * 8)))
+      {
+        statistics_.crc_errors++;
+        return std::nullopt;
+      }
+    }
+
+    statistics_.frames_received++;
+    return kPayload;
+  }
+
+  Uart & uart_;
+  std::span<uint8_t> buffer_;
+  Statistics_t statistics_;
+
+  std::array<uint8_t, 32> staging_;
+  size_t staged_ = 0;
+
+  std::array<uint8_t, 32> chunk_;
+  size_t chunk_position_ = 0;
+  size_t chunk_length_   = 0;
+
+  size_t length_     = 0;
+  size_t remaining_  = 0;
+  bool pending_zero_ = false;
+  bool escaped_      = false;
+  bool started_      = false;
+  bool discarding_   = false;
+};
+}  // namespace sjsu
@@ -0,0 +1,297 @@
+#include <libcore/systems/framed_uart.hpp>
+
+#include <deque>
+#include <numeric>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/ring_buffer.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Uart whose written bytes are received by itself, optionally through a
+/// RingBuffer read in place.
+class LoopbackUart : public Uart
+{
+ public:
+  void ModuleInitialize() override {}
+  bool HasData() override
+  {
+    return !received.empty();
+  }
+  void Write(std::span<const uint8_t> data) override
+  {
+    writes++;
+    sent.insert(sent.end(), data.begin(), data.end());
+    if (in_place)
+    {
+      ring.Write(data);
+    }
+    else
+    {
+      received.insert(received.end(), data.begin(), data.end());
+    }
+  }
+  size_t Read(std::span<uint8_t> data) override
+  {
+    size_t count = 0;
+    while (count < data.size() && !received.empty())
+    {
+      data[count++] = received.front();
+      received.pop_front();
+    }
+    return count;
+  }
+  std::span<const uint8_t> PeekReceived() override
+  {
+    return ring.Peek();
+  }
+  void ConsumeReceived(size_t count) override
+  {
+    ring.Consume(count);
+  }
+
+  using Uart::Read;
+  using Uart::Write;
+
+  bool in_place = false;
+  size_t writes = 0;
+  std::vector<uint8_t> sent;
+  std::deque<uint8_t> received;
+  RingBuffer<uint8_t, 1024> ring;
+};
+
+/// Textbook COBS encoder to check FramedUart against.
+std::vector<uint8_t> CobsEncode(std::span<const uint8_t> data)
+{
+  std::vector<uint8_t> encoded(1, 0);
+  size_t code_index = 0;
+  uint8_t code      = 1;
+  for (uint8_t byte : data)
+  {
+    if (byte != 0)
+    {
+      encoded.push_back(byte);
+      code++;
+    }
+    if (byte == 0 || code == 0xFF)
+    {
+      encoded[code_index] = code;
+      code                = 1;
+      code_index          = encoded.size();
+      encoded.push_back(0);
+    }
+  }
+  encoded[code_index] = code;
+  encoded.push_back(0);
+  return encoded;
+}
+
+std::vector<uint8_t> WithCrc(std::span<const uint8_t> payload)
+{
+  std::vector<uint8_t> frame(payload.begin(), payload.end());
+  const uint16_t kCrc = crc::Engine<crc::kCrc16Ccitt>::Calculate(payload);
+  frame.push_back(static_cast<uint8_t>(kCrc));
+  frame.push_back(static_cast<uint8_t>(kCrc >> 8));
+  return frame;
+}
+}  // namespace
+
+TEST_CASE("Testing FramedUart")
+{
+  LoopbackUart uart;
+  std::array<uint8_t, 512> buffer{};
+
+  std::vector<uint8_t> long_run(300);
+  std::iota(long_run.begin(), long_run.end(), 1);
+  long_run[100] = 0;
+
+  const std::vector<std::vector<uint8_t>> kPayloads = {
+    { 0x11, 0x22, 0x00, 0x33 },
+    { 0x00 },
+    {},
+    { 0xC0, 0xDB, 0xDC, 0xDD, 0x00, 0xC0 },
+    std::vector<uint8_t>(254, 0x42),
+    long_run,
+  };
+
+  SECTION("COBS encoding")
+  {
+    // Setup
+    FramedUart<Framing::kCobs> link(uart, buffer);
+
+    for (const auto & payload : kPayloads)
+    {
+      uart.sent.clear();
+
+      // Exercise
+      link.Send(payload);
+
+      // Verify
+      CHECK(CobsEncode(WithCrc(payload)) == uart.sent);
+      CHECK(uart.sent.size() <=
+            FramedUart<Framing::kCobs>::MaximumEncodedSize(payload.size()));
+    }
+  }
+
+  SECTION("SLIP encoding")
+  {
+    // Setup
+    FramedUart<Framing::kSlip> link(uart, buffer);
+    const std::vector<uint8_t> kPayload = { 0x01, 0xC0, 0x02, 0xDB, 0x03 };
+    const auto kFrame                   = WithCrc(kPayload);
+
+    std::vector<uint8_t> expected = { 0xC0, 0x01, 0xDB, 0xDC, 0x02,
+                                      0xDB, 0xDD, 0x03 };
+    for (size_t i = kPayload.size(); i < kFrame.size(); i++)
+    {
+      if (kFrame[i] == 0xC0 || kFrame[i] == 0xDB)
+      {
+        expected.push_back(0xDB);
+        expected.push_back(kFrame[i] == 0xC0 ? 0xDC : 0xDD);
+      }
+      else
+      {
+        expected.push_back(kFrame[i]);
+      }
+    }
+    expected.push_back(0xC0);
+
+    // Exercise
+    link.Send(kPayload);
+
+    // Verify
+    CHECK(expected == uart.sent);
+  }
+
+  SECTION("Long runs are written without copying")
+  {
+    // Setup
+    FramedUart<Framing::kCobs> link(uart, buffer);
+
+    // Exercise
+    link.Send(std::vector<uint8_t>(200, 0x42));
+
+    // Verify
+    // The code byte, the run from the caller's buffer, then the CRC.
+    CHECK(3 == uart.writes);
+    CHECK(1 == link.GetStatistics().frames_sent);
+  }
+
+  SECTION("Round trip")
+  {
+    for (bool in_place : { false, true })
+    {
+      // Setup
+      uart.in_place = in_place;
+      FramedUart<Framing::kCobs> cobs(uart, buffer);
+      FramedUart<Framing::kSlip> slip(uart, buffer);
+
+      for (const auto & payload : kPayloads)
+      {
+        // Exercise
+        cobs.Send(payload);
+        const auto kCobsFrame = cobs.Receive();
+        REQUIRE(kCobsFrame.has_value());
+        const std::vector<uint8_t> kCobsReceived(kCobsFrame->begin(),
+                                                 kCobsFrame->end());
+
+        slip.Send(payload);
+        const auto kSlipFrame = slip.Receive();
+        REQUIRE(kSlipFrame.has_value());
+        const std::vector<uint8_t> kSlipReceived(kSlipFrame->begin(),
+                                                 kSlipFrame->end());
+
+        // Verify
+        CHECK(payload == kCobsReceived);
+        CHECK(payload == kSlipReceived);
+        CHECK(kSlipFrame->data() == buffer.data());
+      }
+
+      CHECK(!cobs.Receive().has_value());
+      CHECK(kPayloads.size() == cobs.GetStatistics().frames_received);
+      CHECK(kPayloads.size() == slip.GetStatistics().frames_received);
+    }
+  }
+
+  SECTION("Frames after a complete frame are kept for the next call")
+  {
+    for (bool in_place : { false, true })
+    {
+      // Setup
+      uart.in_place = in_place;
+      FramedUart<Framing::kCobs> link(uart, buffer);
+      link.Send(std::array<uint8_t, 2>{ 1, 2 });
+      link.Send(std::array<uint8_t, 1>{ 3 });
+
+      // Exercise
+      const auto kFirst  = link.Receive();
+      const uint8_t kOne = (*kFirst)[0];
+      const auto kSecond = link.Receive();
+      const auto kNone   = link.Receive();
+
+      // Verify
+      CHECK(2 == kFirst->size());
+      CHECK(1 == kOne);
+      REQUIRE(kSecond.has_value());
+      CHECK(3 == (*kSecond)[0]);
+      CHECK(!kNone.has_value());
+    }
+  }
+
+  SECTION("Corrupted frames are dropped")
+  {
+    // Setup
+    FramedUart<Framing::kCobs> link(uart, buffer);
+    link.Send(std::array<uint8_t, 4>{ 1, 2, 3, 4 });
+    uart.received[2] ^= 0x10;
+    link.Send(std::array<uint8_t, 1>{ 5 });
+
+    // Exercise
+    const auto kFrame = link.Receive();
+
+    // Verify
+    REQUIRE(kFrame.has_value());
+    CHECK(5 == (*kFrame)[0]);
+    CHECK(1 == link.GetStatistics().crc_errors);
+    CHECK(1 == link.GetStatistics().frames_received);
+  }
+
+  SECTION("Frames larger than the buffer are dropped")
+  {
+    // Setup
+    FramedUart<Framing::kSlip> link(uart, std::span(buffer).first(8));
+    link.Send(std::array<uint8_t, 7>{});
+    link.Send(std::array<uint8_t, 6>{ 1, 2, 3, 4, 5, 6 });
+
+    // Exercise
+    const auto kFrame = link.Receive();
+
+    // Verify
+    REQUIRE(kFrame.has_value());
+    CHECK(6 == kFrame->size());
+    CHECK(1 == link.GetStatistics().oversized);
+  }
+
+  SECTION("Malformed frames are dropped")
+  {
+    // Setup
+    FramedUart<Framing::kSlip> slip(uart, buffer);
+    FramedUart<Framing::kCobs> cobs(uart, buffer);
+
+    // Exercise
+    uart.Write({ 0xC0, 0x01, 0xDB, 0x01, 0x02, 0x03, 0xC0, 0x01, 0xC0 });
+    const auto kSlip = slip.Receive();
+    uart.Write({ 0x05, 0x01, 0x02, 0x00, 0x00 });
+    const auto kCobs = cobs.Receive();
+
+    // Verify
+    CHECK(!kSlip.has_value());
+    CHECK(2 == slip.GetStatistics().malformed);
+    CHECK(!kCobs.has_value());
+    CHECK(1 == cobs.GetStatistics().malformed);
+  }
+}
+}  // namespace sjsu
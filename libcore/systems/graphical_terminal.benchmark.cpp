@@ -0,0 +1,47 @@
+#include <libcore/systems/graphical_terminal.hpp>
+#include <libcore/testing/benchmark.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Monochrome display that discards what is drawn, so only the cost of the
+/// terminal and Graphics is measured.
+class NullTerminalDisplay : public PixelDisplay
+{
+ public:
+  void ModuleInitialize() override {}
+  size_t GetWidth() override
+  {
+    return 128;
+  }
+  size_t GetHeight() override
+  {
+    return 64;
+  }
+  Color_t AvailableColors() override
+  {
+    return {};
+  }
+  void Clear() override {}
+  void DrawPixel(int32_t x, int32_t y, Color_t) override
+  {
+    benchmark::DoNotOptimize(x);
+    benchmark::DoNotOptimize(y);
+  }
+};
+}  // namespace
+
+SJ2_BENCHMARK("GraphicalTerminal::printf")
+{
+  NullTerminalDisplay display;
+  Graphics graphics(display);
+  TerminalCache_t<8, 16> cache;
+  GraphicalTerminal terminal(&graphics, &cache);
+  terminal.Initialize();
+  uint32_t count = 0;
+  return benchmark::Run(name, [&terminal, &count]() {
+    terminal.printf("count = %lu\n", static_cast<unsigned long>(count++));
+  });
+}
+}  // namespace sjsu
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <utility>
 
 #include <libcore/peripherals/gpio.hpp>
 #include <libcore/peripherals/spi.hpp>
 #include <libcore/systems/graphics.hpp>
 #include <libcore/module.hpp>
+#include <libcore/utility/log.hpp>
 
 namespace sjsu
 {
@@ -21,10 +27,17 @@ struct TerminalCache_t
 {
   /// Buffer containing the characters to display on the terminal
   char buffer[kMaxRows * kMaxColumns] = { 0 };
+  /// Characters currently drawn on the display, by screen position, so that
+  /// only the cells that changed are redrawn.
+  char screen[kMaxRows * kMaxColumns] = { 0 };
 };
 
 /// Utilizes a pixel display and a terminal character cache to create a
 /// Graphical Terminal on that display.
+///
+/// Update() only redraws the character cells that changed since the last
+/// update. When the terminal scrolls, the display is scrolled with
+/// Graphics::Scroll() rather than redrawn, if the display supports it.
 class GraphicalTerminal : public Module<>
 {
  public:
@@ -48,8 +61,10 @@ class GraphicalTerminal : public Module<>
       : max_rows_(kMaxRows),
         max_columns_(kMaxColumns),
         graphics_(graphics),
-        cache_(cache->buffer)
+        cache_(cache->buffer),
+        screen_(cache->screen)
   {
+    ForgetScreen();
   }
 
   /// Initialize the graphics driver.
@@ -57,6 +72,7 @@ class GraphicalTerminal : public Module<>
   {
     graphics_->Initialize();
     graphics_->Clear();
+    ForgetScreen();
     graphics_->Update();
   }
 
@@ -82,35 +98,38 @@ class GraphicalTerminal : public Module<>
 #pragma GCC diagnostic pop
     va_end(args);
 
-    uint32_t pos = 0;
-    for (; pos < characters; pos++)
+    characters = std::min<uint32_t>(characters, sizeof(buffer) - 1);
+
+    for (uint32_t pos = 0; pos < characters; pos++)
     {
-      char character = buffer[pos];
-      switch (character)
-      {
-        case '\n':
-          column_ = 0;
-          row_++;
-          break;
-        default:
-          GetChar((row_ + row_start_) % max_rows_, column_) = character;
-          column_++;
-          if (column_ >= max_columns_)
-          {
-            column_ = 0;
-            row_++;
-          }
-          break;
-      }
+      Put(buffer[pos]);
     }
     Update();
-    if (row_ >= max_rows_)
-    {
-      row_start_ = (row_start_ + 1) % max_rows_;
-      row_       = max_rows_ - 1;
-      ClearRow((row_ + row_start_) % max_rows_);
-    }
-    return pos;
+    return static_cast<int>(characters);
+  }
+
+  /// Prints to the screen using an fmt format string, which is checked at
+  /// compile time against the arguments. Unlike printf(), the text is written
+  /// to the terminal as it is formatted, so messages of any length are printed
+  /// whole, and nothing larger than a few characters is held on the stack.
+  ///
+  /// Usage:
+  ///
+  ///    terminal.Print("Speed = {} rpm\n", rpm);
+  ///
+  /// @param format - fmt format string.
+  /// @param args - set of variables to write into the format.
+  /// @return size_t - number of characters written to the screen.
+  template <typename... Args>
+  size_t Print(fmt::format_string<Args...> format, Args &&... args)
+  {
+    TerminalWriter writer(*this);
+    fmt::detail::vformat_to<char>(writer,
+                                  fmt::string_view(format),
+                                  fmt::make_format_args(args...));
+    writer.Flush();
+    Update();
+    return writer.Count();
   }
 
   /// Move the position where text will be written from to this x & y location.
@@ -143,17 +162,40 @@ class GraphicalTerminal : public Module<>
   ///        can be chained.
   GraphicalTerminal & Update()
   {
-    graphics_->Clear();
-    for (int32_t i = 0; i < static_cast<int32_t>(max_rows_); i++)
+    ApplyScroll();
+
+    for (uint32_t i = 0; i < max_rows_; i++)
     {
-      for (int32_t j = 0; j < static_cast<int32_t>(max_columns_); j++)
+      for (uint32_t j = 0; j < max_columns_; j++)
       {
-        int32_t x = j * kCharacterWidth;
-        int32_t y = i * kCharacterHeight;
-        graphics_->DrawCharacter(
-            x, y, GetChar(((i + row_start_) % max_rows_), j));
+        const uint32_t kRow   = (i + row_start_) % max_rows_;
+        const char kCharacter = Visible(GetChar(kRow, j));
+        char & shown          = screen_[(i * max_columns_) + j];
+
+        if (kCharacter == shown)
+        {
+          continue;
+        }
+
+        const int32_t kX = static_cast<int32_t>(j * kCharacterWidth);
+        const int32_t kY = static_cast<int32_t>(i * kCharacterHeight);
+
+        if (shown != ' ' && !graphics_->Clear({ .x      = kX,
+                                                .y      = kY,
+                                                .width  = kCharacterWidth,
+                                                .height = kCharacterHeight }))
+        {
+          // The display cannot erase a single cell, so redraw all of them.
+          graphics_->Clear();
+          ForgetScreen();
+          return Update();
+        }
+
+        graphics_->DrawCharacter(kX, kY, kCharacter);
+        shown = kCharacter;
       }
     }
+
     graphics_->Update();
     return *this;
   }
@@ -180,23 +222,144 @@ class GraphicalTerminal : public Module<>
   {
     graphics_->Clear();
     memset(cache_, '\0', max_rows_ * max_columns_);
+    ForgetScreen();
     SetCursor(0, 0);
+    scrolled_rows_ = 0;
     graphics_->Update();
     return *this;
   }
 
  private:
+  /// Characters without a glyph are drawn as spaces.
+  static char Visible(char character)
+  {
+    return (character == '\0') ? ' ' : character;
+  }
+
+  /// fmt output buffer which writes its characters to the terminal whenever
+  /// it fills up, so formatting needs only a few characters of stack.
+  class TerminalWriter : public fmt::detail::buffer<char>
+  {
+   public:
+    explicit TerminalWriter(GraphicalTerminal & terminal)
+        : fmt::detail::buffer<char>(characters_, 0, sizeof(characters_)),
+          terminal_(terminal)
+    {
+    }
+
+    /// Write the buffered characters to the terminal.
+    void Flush()
+    {
+      for (char character : std::span<const char>(data(), size()))
+      {
+        terminal_.Put(character);
+      }
+      count_ += size();
+      clear();
+    }
+
+    /// @return size_t - number of characters written so far.
+    size_t Count() const
+    {
+      return count_ + size();
+    }
+
+   protected:
+    void grow(size_t) override
+    {
+      if (size() == capacity())
+      {
+        Flush();
+      }
+    }
+
+   private:
+    char characters_[16];
+    GraphicalTerminal & terminal_;
+    size_t count_ = 0;
+  };
+
+  /// Write a character at the cursor and advance it, moving to the next row on
+  /// a new line or at the end of a row.
+  void Put(char character)
+  {
+    // Scroll only once there is something to put on the new row, so the
+    // last line printed stays on the display.
+    if (row_ >= max_rows_)
+    {
+      ScrollRow();
+    }
+
+    switch (character)
+    {
+      case '\n':
+        column_ = 0;
+        row_++;
+        break;
+      default:
+        GetChar((row_ + row_start_) % max_rows_, column_) = character;
+        column_++;
+        if (column_ >= max_columns_)
+        {
+          column_ = 0;
+          row_++;
+        }
+        break;
+    }
+  }
+
+  /// Move the first row off of the terminal to make room for a new row.
+  void ScrollRow()
+  {
+    row_start_ = (row_start_ + 1) % max_rows_;
+    row_       = max_rows_ - 1;
+    ClearRow((row_ + row_start_) % max_rows_);
+    scrolled_rows_++;
+  }
+
+  /// Scroll the display by the rows scrolled since the last update, or clear
+  /// it to be redrawn if it cannot be scrolled.
+  void ApplyScroll()
+  {
+    const uint32_t kRows = std::exchange(scrolled_rows_, 0);
+
+    if (kRows == 0)
+    {
+      return;
+    }
+
+    if (kRows < max_rows_ && graphics_->Scroll(kRows * kCharacterHeight))
+    {
+      const uint32_t kMoved = (max_rows_ - kRows) * max_columns_;
+      memmove(screen_, screen_ + (kRows * max_columns_), kMoved);
+      memset(screen_ + kMoved, ' ', kRows * max_columns_);
+    }
+    else
+    {
+      graphics_->Clear();
+      ForgetScreen();
+    }
+  }
+
+  /// Record that the display is blank.
+  void ForgetScreen()
+  {
+    memset(screen_, ' ', max_rows_ * max_columns_);
+  }
+
   char & GetChar(uint32_t row, uint32_t column)
   {
     return cache_[(row * max_columns_) + column];
   }
 
-  uint32_t row_       = 0;
-  uint32_t column_    = 0;
-  uint32_t row_start_ = 0;
+  uint32_t row_           = 0;
+  uint32_t column_        = 0;
+  uint32_t row_start_     = 0;
+  uint32_t scrolled_rows_ = 0;
   uint32_t max_rows_;
   uint32_t max_columns_;
   Graphics * graphics_;
   char * cache_;
+  char * screen_;
 };
 }  // namespace sjsu
@@ -1,10 +1,181 @@
 #include <libcore/systems/graphical_terminal.hpp>
+
+#include <string>
+#include <vector>
+
 #include <libcore/testing/testing_frameworks.hpp>
 
 namespace sjsu
 {
+namespace
+{
+/// Monochrome display that counts the operations performed on it.
+class TerminalDisplay : public PixelDisplay
+{
+ public:
+  void ModuleInitialize() override {}
+  size_t GetWidth() override
+  {
+    return 32;
+  }
+  size_t GetHeight() override
+  {
+    return 16;
+  }
+  Color_t AvailableColors() override
+  {
+    return {};
+  }
+  void Clear() override
+  {
+    clears++;
+  }
+  bool Clear(Region_t region) override
+  {
+    cleared_regions.push_back(region);
+    return clears_regions;
+  }
+  bool Scroll(int32_t rows) override
+  {
+    scrolled_rows.push_back(rows);
+    return scrolls;
+  }
+  void DrawPixel(int32_t, int32_t, Color_t) override
+  {
+    pixels++;
+  }
+
+  bool clears_regions = true;
+  bool scrolls        = true;
+  int clears          = 0;
+  int pixels          = 0;
+  std::vector<Region_t> cleared_regions;
+  std::vector<int32_t> scrolled_rows;
+};
+}  // namespace
+
 TEST_CASE("Graphics Terminal Test")
 {
-  SECTION("Initialize") {}
+  // Setup: 2 rows of 4 characters fits the 32 x 16 display.
+  TerminalDisplay display;
+  Graphics graphics(display);
+  TerminalCache_t<2, 4> cache;
+  GraphicalTerminal terminal(&graphics, &cache);
+  terminal.Initialize();
+  display.clears = 0;
+  display.pixels = 0;
+
+  SECTION("Only newly printed characters are drawn")
+  {
+    // Setup
+    terminal.printf("A");
+    const int kPixelsOfA = display.pixels;
+    display.pixels       = 0;
+
+    // Exercise
+    terminal.printf("A");
+
+    // Verify
+    CHECK(0 < kPixelsOfA);
+    CHECK(kPixelsOfA == display.pixels);
+    CHECK(0 == display.clears);
+    CHECK(display.cleared_regions.empty());
+  }
+
+  SECTION("Overwritten characters clear only their cell")
+  {
+    // Setup
+    terminal.printf("AB");
+    terminal.MoveToLineStart();
+
+    // Exercise
+    terminal.printf("C");
+
+    // Verify
+    REQUIRE(1 == display.cleared_regions.size());
+    CHECK(display.cleared_regions[0] ==
+          PixelDisplay::Region_t{ .x = 0, .y = 0, .width = 8, .height = 8 });
+    CHECK(0 == display.clears);
+  }
+
+  SECTION("Scrolling scrolls the display by a row of characters")
+  {
+    // Setup
+    terminal.printf("AB\nCD\n");
+    display.pixels = 0;
+
+    // Exercise
+    terminal.printf("E");
+
+    // Verify
+    REQUIRE(1 == display.scrolled_rows.size());
+    CHECK(8 == display.scrolled_rows[0]);
+    CHECK(0 == display.clears);
+    // "CD" moved with the display, only the "E" is drawn.
+    display.pixels = 0;
+    terminal.Update();
+    CHECK(0 == display.pixels);
+  }
+
+  SECTION("Displays that cannot scroll are redrawn")
+  {
+    // Setup
+    display.scrolls = false;
+    terminal.printf("A\nB\n");
+
+    // Exercise
+    terminal.printf("C");
+
+    // Verify
+    CHECK(1 == display.clears);
+    CHECK(display.cleared_regions.empty());
+  }
+
+  SECTION("Displays that cannot clear a cell are redrawn")
+  {
+    // Setup
+    display.clears_regions = false;
+    terminal.printf("A");
+    terminal.MoveToLineStart();
+
+    // Exercise
+    terminal.printf("B");
+
+    // Verify
+    CHECK(1 == display.cleared_regions.size());
+    CHECK(1 == display.clears);
+  }
+
+  SECTION("Print() fills the same cells as printf()")
+  {
+    // Setup
+    TerminalCache_t<2, 4> printf_cache;
+    GraphicalTerminal printf_terminal(&graphics, &printf_cache);
+    printf_terminal.printf("%d\n%s%c", 12, "abcde", 'Z');
+
+    // Exercise
+    const size_t kCount = terminal.Print("{}\n{}{}", 12, "abcde", 'Z');
+
+    // Verify
+    CHECK(9 == kCount);
+    CHECK(std::string(cache.buffer, sizeof(cache.buffer)) ==
+          std::string(printf_cache.buffer, sizeof(printf_cache.buffer)));
+  }
+
+  SECTION("Print() is not limited to 256 characters")
+  {
+    // Setup
+    const std::string kMessage = std::string(300, 'x') + "ABCDEFGH";
+
+    // Exercise
+    const size_t kCount = terminal.Print("{}", kMessage);
+
+    // Verify
+    CHECK(kMessage.size() == kCount);
+    // The last two rows printed hold the end of the message.
+    std::string rows(cache.buffer, sizeof(cache.buffer));
+    std::rotate(rows.begin(), rows.begin() + 4, rows.end());
+    CHECK("ABCDEFGH" == rows);
+  }
 }
 }  // namespace sjsu
@@ -0,0 +1,44 @@
+#include <libcore/systems/graphics.hpp>
+#include <libcore/testing/benchmark.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Monochrome display that discards what is drawn, so only the cost of
+/// Graphics is measured.
+class NullDisplay : public PixelDisplay
+{
+ public:
+  void ModuleInitialize() override {}
+  size_t GetWidth() override
+  {
+    return 128;
+  }
+  size_t GetHeight() override
+  {
+    return 64;
+  }
+  Color_t AvailableColors() override
+  {
+    return {};
+  }
+  void Clear() override {}
+  void DrawPixel(int32_t x, int32_t y, Color_t) override
+  {
+    benchmark::DoNotOptimize(x);
+    benchmark::DoNotOptimize(y);
+  }
+};
+}  // namespace
+
+SJ2_BENCHMARK("Graphics::DrawCharacter")
+{
+  NullDisplay display;
+  Graphics graphics(display);
+  graphics.Initialize();
+  return benchmark::Run(name, [&graphics]() {
+    graphics.DrawCharacter(8, 8, 'A');
+  });
+}
+}  // namespace sjsu
@@ -1,17 +1,31 @@
 #pragma once
 
 #include <algorithm>
-#include <cmath>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <span>
+#include <utility>
 
 #include <libcore/module.hpp>
 #include <libcore/devices/pixel_display.hpp>
-#include <libcore/external/font8x8/font8x8_basic.h>
+#include <libcore/peripherals/storage.hpp>
+#include <libcore/systems/font.hpp>
+#include <libcore/systems/rle_image.hpp>
 
 namespace sjsu
 {
 /// Graphics library to draw shapes and characters on a pixel display
+///
+/// Graphics keeps track of the smallest region containing everything drawn
+/// since the last call to Update(), so that only that region is sent to the
+/// display. Pixels are written directly into the display's framebuffer when
+/// the display provides one, see PixelDisplay::GetFramebuffer().
+///
+/// Drawing is limited to a clip rectangle, the whole display by default, see
+/// SetClip(). Every primitive is clipped once before it is drawn, so the parts
+/// of shapes outside of the clip rectangle cost nothing per pixel.
 class Graphics : public Module<>
 {
  public:
@@ -21,9 +35,11 @@ class Graphics : public Module<>
   explicit Graphics(PixelDisplay & display)
       : display_(display), color_(), width_(0), height_(0)
   {
-    width_  = display.GetWidth();
-    height_ = display.GetHeight();
-    color_  = display.AvailableColors();
+    width_       = display.GetWidth();
+    height_      = display.GetHeight();
+    color_       = display.AvailableColors();
+    framebuffer_ = display.GetFramebuffer();
+    clip_        = Screen();
   }
 
   /// Initialize display hardware.
@@ -32,16 +48,104 @@ class Graphics : public Module<>
     display_.Initialize();
   }
 
-  /// Update the display.
+  /// Update the part of the display that has been drawn to since the last
+  /// update. Does nothing if nothing has been drawn.
   void Update()
   {
-    display_.Update();
+    if (!dirty_.IsEmpty())
+    {
+      display_.Update(dirty_);
+      dirty_       = {};
+      framebuffer_ = display_.GetFramebuffer();
+    }
   }
 
   /// Clears the display.
   void Clear()
   {
     display_.Clear();
+    Invalidate();
+  }
+
+  /// Clear part of the display.
+  ///
+  /// @param region - the region to clear. Clipped to the display.
+  /// @return true - if the region was cleared, false if the display can only
+  ///         be cleared as a whole.
+  bool Clear(PixelDisplay::Region_t region)
+  {
+    region = region.Intersection(Screen());
+    if (region.IsEmpty())
+    {
+      return true;
+    }
+    if (!display_.Clear(region))
+    {
+      return false;
+    }
+    Invalidate(region);
+    return true;
+  }
+
+  /// Move the contents of the display up by `rows` rows of pixels, clearing
+  /// the rows uncovered at the bottom.
+  ///
+  /// @param rows - number of rows to scroll by.
+  /// @return true - if the display was scrolled, false if it does not support
+  ///         scrolling and must be redrawn.
+  bool Scroll(int32_t rows)
+  {
+    if (rows <= 0 || rows >= static_cast<int32_t>(height_) ||
+        !display_.Scroll(rows))
+    {
+      return false;
+    }
+    Invalidate();
+    return true;
+  }
+
+  /// Mark a region of the display as changed, so it is sent to the display on
+  /// the next Update(). Used when the framebuffer is modified without going
+  /// through this object.
+  ///
+  /// @param region - the region that changed. Clipped to the display.
+  void Invalidate(PixelDisplay::Region_t region)
+  {
+    dirty_ = dirty_.Union(region.Intersection(Screen()));
+  }
+
+  /// Mark the whole display as changed.
+  void Invalidate()
+  {
+    dirty_ = Screen();
+  }
+
+  /// @return PixelDisplay::Region_t - the region that will be sent to the
+  ///         display on the next Update(). Empty if nothing has changed.
+  PixelDisplay::Region_t GetDirtyRegion() const
+  {
+    return dirty_;
+  }
+
+  /// Limit drawing to a rectangle, such as a widget's area. Pixels outside of
+  /// it are not drawn, until the clip rectangle is changed or reset.
+  ///
+  /// @param region - the rectangle to draw within. Clipped to the display.
+  void SetClip(PixelDisplay::Region_t region)
+  {
+    clip_ = region.Intersection(Screen());
+  }
+
+  /// Allow drawing anywhere on the display again.
+  void ResetClip()
+  {
+    clip_ = Screen();
+  }
+
+  /// @return PixelDisplay::Region_t - the rectangle drawing is limited to.
+  PixelDisplay::Region_t GetClip() const
+  {
+    return clip_;
   }
 
   /// Set the current color of drawn elements.
@@ -69,11 +173,12 @@ class Graphics : public Module<>
   /// @param line_width - length of the line going to the right
   void DrawHorizontalLine(int32_t x, int32_t y, int32_t line_width)
   {
-    line_width = std::clamp(
-        x + line_width, int32_t{ 0 }, static_cast<int32_t>(width_ - x));
-    for (int32_t column = x; column < line_width; column++)
+    const auto kLine =
+        Clip({ .x = x, .y = y, .width = line_width, .height = 1 });
+    if (!kLine.IsEmpty())
     {
-      DrawPixel(column, y);
+      display_.DrawSpan(kLine.x, kLine.y, kLine.width, color_);
+      Invalidate(kLine);
     }
   }
 
@@ -84,15 +189,19 @@ class Graphics : public Module<>
   /// @param line_height - length of the line going down.
   void DrawVerticalLine(int32_t x, int32_t y, int32_t line_height)
   {
-    line_height = std::clamp(
-        y + line_height, int32_t{ 0 }, static_cast<int32_t>(height_ - y));
-    for (int32_t row = y; row < line_height; row++)
+    const auto kLine =
+        Clip({ .x = x, .y = y, .width = 1, .height = line_height });
+    if (!kLine.IsEmpty())
     {
-      DrawPixel(x, row);
+      display_.FillRectangle(kLine, color_);
+      Invalidate(kLine);
     }
   }
 
-  /// Draw a line.
+  /// Draw a line, including both end points, using only integer math.
+  /// Horizontal and vertical lines are drawn as a single span. Other lines are
+  /// first clipped to the clip rectangle, so only their visible pixels are
+  /// stepped through.
   ///
   /// @param x0 - start x position
   /// @param y0 - start y position
@@ -100,21 +209,53 @@ class Graphics : public Module<>
   /// @param y1 - end y position
   void DrawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
   {
-    float dx           = static_cast<float>(x1 - x0);
-    float dy           = static_cast<float>(y1 - y0);
-    float steps        = std::max(std::abs(dx), std::abs(dy));
-    uint32_t int_steps = static_cast<uint32_t>(ceilf(steps));
-    float x_increment  = dx / steps;
-    float y_increment  = dy / steps;
+    if (y0 == y1)
+    {
+      DrawHorizontalLine(std::min(x0, x1), y0, std::abs(x1 - x0) + 1);
+      return;
+    }
+    if (x0 == x1)
+    {
+      DrawVerticalLine(x0, std::min(y0, y1), std::abs(y1 - y0) + 1);
+      return;
+    }
+
+    // Bresenham's line algorithm, for all octants.
+    const int32_t kDx    = std::abs(x1 - x0);
+    const int32_t kDy    = -std::abs(y1 - y0);
+    const int32_t kStepX = (x0 < x1) ? 1 : -1;
+    const int32_t kStepY = (y0 < y1) ? 1 : -1;
+    int32_t error        = kDx + kDy;
 
-    float x = static_cast<float>(x0);
-    float y = static_cast<float>(y0);
-    for (uint32_t v = 0; v < int_steps; v++)
+    if (!ClipLine(x0, y0, x1, y1, error))
     {
-      x = x + x_increment;
-      y = y + y_increment;
-      DrawPixel(static_cast<uint32_t>(std::lround(x)),
-                static_cast<uint32_t>(std::lround(y)));
+      return;
+    }
+
+    Invalidate({ .x      = std::min(x0, x1),
+                 .y      = std::min(y0, y1),
+                 .width  = std::abs(x1 - x0) + 1,
+                 .height = std::abs(y1 - y0) + 1 });
+
+    while (true)
+    {
+      PlotPixel(x0, y0);
+      if (x0 == x1 && y0 == y1)
+      {
+        break;
+      }
+
+      const int32_t kDoubleError = 2 * error;
+      if (kDoubleError >= kDy)
+      {
+        error += kDy;
+        x0 += kStepX;
+      }
+      if (kDoubleError <= kDx)
+      {
+        error += kDx;
+        y0 += kStepY;
+      }
     }
   }
 
@@ -125,6 +266,17 @@ class Graphics : public Module<>
   /// @param radius - the radius of the circle.
   void DrawCircle(int32_t x0, int32_t y0, int32_t radius)
   {
+    const PixelDisplay::Region_t kBounds = {
+      .x      = x0 - radius,
+      .y      = y0 - radius,
+      .width  = (2 * radius) + 1,
+      .height = (2 * radius) + 1,
+    };
+    if (Clip(kBounds).IsEmpty())
+    {
+      return;
+    }
+
     int32_t x   = radius - 1;
     int32_t y   = 0;
     int32_t dx  = 1;
@@ -186,28 +338,350 @@ class Graphics : public Module<>
     DrawVerticalLine(x + width, y, height);
   }
 
-  /// Draw a character on the display.
+  /// Draw a filled circle on the display, as one horizontal span per row.
+  ///
+  /// @param x0 - center x position of the circle.
+  /// @param y0 - center y position of the circle.
+  /// @param radius - the radius of the circle.
+  void FillCircle(int32_t x0, int32_t y0, int32_t radius)
+  {
+    const PixelDisplay::Region_t kBounds = {
+      .x      = x0 - radius,
+      .y      = y0 - radius,
+      .width  = (2 * radius) + 1,
+      .height = (2 * radius) + 1,
+    };
+    if (Clip(kBounds).IsEmpty())
+    {
+      return;
+    }
+
+    // Midpoint circle algorithm, filling between the points mirrored across
+    // the vertical axis.
+    int32_t x     = radius;
+    int32_t y     = 0;
+    int32_t error = 1 - radius;
+
+    while (x >= y)
+    {
+      DrawHorizontalLine(x0 - x, y0 + y, (2 * x) + 1);
+      DrawHorizontalLine(x0 - x, y0 - y, (2 * x) + 1);
+      DrawHorizontalLine(x0 - y, y0 + x, (2 * y) + 1);
+      DrawHorizontalLine(x0 - y, y0 - x, (2 * y) + 1);
+
+      y++;
+      if (error < 0)
+      {
+        error += (2 * y) + 1;
+      }
+      else
+      {
+        x--;
+        error += (2 * (y - x)) + 1;
+      }
+    }
+  }
+
+  /// Draw a filled rectangle on the display.
+  ///
+  /// @param x - x coordinate of the left most column
+  /// @param y - y coordinate of the top most row
+  /// @param width - width of the rectangle
+  /// @param height - height of the rectangle
+  void FillRectangle(int32_t x, int32_t y, int32_t width, int32_t height)
+  {
+    const auto kRegion =
+        Clip({ .x = x, .y = y, .width = width, .height = height });
+    if (!kRegion.IsEmpty())
+    {
+      display_.FillRectangle(kRegion, color_);
+      Invalidate(kRegion);
+    }
+  }
+
+  /// Draw a character on the display, using the current font.
   ///
   /// @param x0 - X coordinate to start printing to the screen
   /// @param y0 - Y coordinate to start printing to the screen
   /// @param letter - The character to write to the screen
   void DrawCharacter(int32_t x0, int32_t y0, char letter)
   {
-    int32_t letter_position = int32_t{ letter };
+    DrawCharacter(x0, y0, static_cast<char32_t>(static_cast<uint8_t>(letter)));
+  }
 
-    PixelDisplay::Color_t foreground = color_;
+  /// Draw the glyph of a unicode code point on the display, using the current
+  /// font. Nothing is drawn if the font has no glyph for the code point.
+  /// Glyphs partly outside of the clip rectangle are trimmed to their visible
+  /// rows and columns and still drawn as a single bitmap.
+  ///
+  /// On displays with a monochrome page framebuffer, such as the SSD1306, the
+  /// glyph is written a column byte at a time, straight into the framebuffer.
+  ///
+  /// @param x0 - X coordinate to start printing to the screen
+  /// @param y0 - Y coordinate to start printing to the screen
+  /// @param code_point - The code point to write to the screen
+  void DrawCharacter(int32_t x0, int32_t y0, char32_t code_point)
+  {
+    const Font8x8::Glyph_t * glyph = font_->Find(code_point);
+    if (glyph == nullptr)
+    {
+      return;
+    }
+
+    const PixelDisplay::Region_t kRegion = {
+      .x = x0, .y = y0, .width = 8, .height = 8
+    };
+
+    if (framebuffer_.IsValid() &&
+        framebuffer_.format == PixelDisplay::PixelFormat::kMonochromePages &&
+        Clip(kRegion) == kRegion)
+    {
+      DrawColumns(x0,
+                  y0,
+                  (font_->GetLayout() == Font8x8::Layout::kColumns)
+                      ? *glyph
+                      : Font8x8::Transpose(*glyph));
+      Invalidate(kRegion);
+      return;
+    }
+
+    const auto kVisible = Clip(kRegion);
+    if (kVisible.IsEmpty())
+    {
+      return;
+    }
+
+    const Font8x8::Glyph_t kRows =
+        (font_->GetLayout() == Font8x8::Layout::kRows)
+            ? *glyph
+            : Font8x8::Transpose(*glyph);
 
-    for (int32_t y = 0; y < 8; y++)
+    // Rows of a glyph are a byte each, so a glyph is trimmed by dropping the
+    // rows above the clip rectangle and shifting out the columns to its left.
+    Font8x8::Glyph_t trimmed{};
+    for (int32_t row = 0; row < kVisible.height; row++)
     {
-      for (int32_t x = 0; x < 8; x++)
+      trimmed[row] = static_cast<uint8_t>(kRows[row + (kVisible.y - y0)] >>
+                                          (kVisible.x - x0));
+    }
+    display_.DrawBitmap(kVisible, trimmed, color_);
+    Invalidate(kVisible);
+  }
+
+  /// Set the font used by DrawCharacter(). Fonts in the column layout are
+  /// fastest on monochrome page framebuffers, and fonts in the row layout on
+  /// every other display. The default font is font::kBasic.
+  ///
+  /// @param font - the font to use. Must outlive this object.
+  void SetFont(const Font8x8 & font)
+  {
+    font_ = &font;
+  }
+
+  /// @return const Font8x8& - the font used by DrawCharacter().
+  const Font8x8 & GetFont() const
+  {
+    return *font_;
+  }
+
+  /// Draw a 1 bit per pixel bitmap in the current color. See
+  /// PixelDisplay::DrawBitmap() for its layout.
+  ///
+  /// @param x - x coordinate of the bitmap's left most column
+  /// @param y - y coordinate of the bitmap's top most row
+  /// @param width - width of the bitmap in pixels
+  /// @param height - height of the bitmap in pixels
+  /// @param bitmap - rows of `(width + 7) / 8` bytes each.
+  void DrawBitmap(int32_t x,
+                  int32_t y,
+                  int32_t width,
+                  int32_t height,
+                  std::span<const uint8_t> bitmap)
+  {
+    const PixelDisplay::Region_t kRegion = {
+      .x = x, .y = y, .width = width, .height = height
+    };
+
+    const auto kVisible = Clip(kRegion);
+    if (kVisible == kRegion)
+    {
+      display_.DrawBitmap(kRegion, bitmap, color_);
+      Invalidate(kRegion);
+      return;
+    }
+    if (kVisible.IsEmpty())
+    {
+      return;
+    }
+
+    // Partly clipped, so only visit the rows and columns that are visible.
+    const size_t kStride = (static_cast<size_t>(width) + 7) / 8;
+    for (int32_t row = kVisible.y - y; row < kVisible.Bottom() - y; row++)
+    {
+      for (int32_t column = kVisible.x - x; column < kVisible.Right() - x;
+           column++)
+      {
+        const size_t kIndex = (row * kStride) + (column / 8);
+        if (kIndex < bitmap.size() && (bitmap[kIndex] >> (column % 8)) & 1)
+        {
+          PlotPixel(x + column, y + row);
+        }
+      }
+    }
+    Invalidate(kVisible);
+  }
+
+  /// Draw a 16 bit per pixel, RGB565, bitmap. See PixelDisplay::DrawBitmap()
+  /// for its layout. Bitmaps partly outside of the clip rectangle are not
+  /// drawn.
+  ///
+  /// @param x - x coordinate of the bitmap's left most column
+  /// @param y - y coordinate of the bitmap's top most row
+  /// @param width - width of the bitmap in pixels
+  /// @param height - height of the bitmap in pixels
+  /// @param pixels - `width * height` pixels, row by row.
+  void DrawBitmap(int32_t x,
+                  int32_t y,
+                  int32_t width,
+                  int32_t height,
+                  std::span<const uint16_t> pixels)
+  {
+    const PixelDisplay::Region_t kRegion = {
+      .x = x, .y = y, .width = width, .height = height
+    };
+
+    if (!kRegion.IsEmpty() && Clip(kRegion) == kRegion)
+    {
+      display_.DrawBitmap(kRegion, pixels);
+      Invalidate(kRegion);
+    }
+  }
+
+  /// Draw a run length encoded RGB565 image, see RleImage. Rows are decoded
+  /// as they are drawn: runs are drawn as a single span, and literal pixels
+  /// are copied straight into an RGB565 framebuffer, or drawn as a one row
+  /// bitmap on other displays. Images partly off of the display are clipped.
+  ///
+  /// @param x - x coordinate of the image's left most column
+  /// @param y - y coordinate of the image's top most row
+  /// @param image - the whole image, such as a constant in flash.
+  /// @throw std::errc::bad_message - if the image is malformed or truncated.
+  void DrawImage(int32_t x, int32_t y, std::span<const uint8_t> image)
+  {
+    RleImage::Reader reader(image);
+    DrawImage(x, y, reader);
+  }
+
+  /// Draw a run length encoded RGB565 image kept in Storage, such as an
+  /// external flash, streaming it through `buffer` so that the image never
+  /// has to fit in RAM. Memory-mapped storage is read in place.
+  ///
+  /// @param x - x coordinate of the image's left most column
+  /// @param y - y coordinate of the image's top most row
+  /// @param storage - storage holding the image.
+  /// @param block_address - block the image starts at.
+  /// @param buffer - at least one block, see RleImage::Reader.
+  /// @throw std::errc::bad_message - if the image is malformed or truncated.
+  void DrawImage(int32_t x,
+                 int32_t y,
+                 Storage & storage,
+                 uint32_t block_address,
+                 std::span<uint8_t> buffer)
+  {
+    RleImage::Reader reader(storage, block_address, buffer);
+    DrawImage(x, y, reader);
+  }
+
+  /// Draw the image read by `reader`. Rows below the display are not read.
+  ///
+  /// @param x - x coordinate of the image's left most column
+  /// @param y - y coordinate of the image's top most row
+  /// @param reader - reader positioned at the image's first packet.
+  /// @throw std::errc::bad_message - if the image is malformed or truncated.
+  void DrawImage(int32_t x, int32_t y, RleImage::Reader & reader)
+  {
+    const PixelDisplay::Region_t kImage = {
+      .x      = x,
+      .y      = y,
+      .width  = reader.GetHeader().width,
+      .height = reader.GetHeader().height,
+    };
+    const auto kVisible = Clip(kImage);
+    if (kVisible.IsEmpty())
+    {
+      return;
+    }
+
+    const bool kDirect =
+        framebuffer_.IsValid() &&
+        framebuffer_.format == PixelDisplay::PixelFormat::kRgb565;
+    std::array<uint8_t, RleImage::kMaximumPacketPixels * 2> staging;
+    std::array<uint16_t, RleImage::kMaximumPacketPixels> pixels;
+
+    for (int32_t row = kImage.y; row < kVisible.Bottom(); row++)
+    {
+      for (int32_t column = kImage.x; column < kImage.Right();)
       {
-        if (font8x8_basic[letter_position][y] & (1 << x))
+        const uint8_t kControl = reader.NextByte();
+        const int32_t kCount   = (kControl & ~RleImage::kRun) + 1;
+        if (column + kCount > kImage.Right())
+        {
+          throw Exception(std::errc::bad_message,
+                          "RLE image packet runs past the end of its row.");
+        }
+
+        // The part of the packet that is on the display, if any.
+        const int32_t kLeft  = std::max(column, kVisible.x);
+        const int32_t kWidth = std::min(column + kCount, kVisible.Right()) -
+                               kLeft;
+        const bool kDrawn    = row >= kVisible.y && kWidth > 0;
+
+        if (kControl & RleImage::kRun)
+        {
+          const auto kPixel = ReadImage(reader, std::span(staging).first(2));
+          if (kDrawn)
+          {
+            display_.DrawSpan(
+                kLeft,
+                row,
+                kWidth,
+                PixelDisplay::Framebuffer_t::FromRgb565(static_cast<uint16_t>(
+                    (kPixel[0] << 8) | kPixel[1])));
+          }
+        }
+        else
         {
-          DrawPixel(x0 + x, y0 + y);
+          const auto kPacket = std::span(staging).first(kCount * 2);
+          const auto kBytes  = ReadImage(reader, kPacket);
+          const auto kShown = kBytes.subspan(
+              static_cast<size_t>(kLeft - column) * 2,
+              static_cast<size_t>(std::max(kWidth, 0)) * 2);
+
+          if (kDrawn && kDirect)
+          {
+            std::copy(kShown.begin(),
+                      kShown.end(),
+                      &framebuffer_.data[(row * framebuffer_.stride) +
+                                         (kLeft * 2)]);
+          }
+          else if (kDrawn)
+          {
+            for (int32_t i = 0; i < kWidth; i++)
+            {
+              pixels[i] = static_cast<uint16_t>((kShown[i * 2] << 8) |
+                                                kShown[(i * 2) + 1]);
+            }
+            display_.DrawBitmap(
+                { .x = kLeft, .y = row, .width = kWidth, .height = 1 },
+                std::span<const uint16_t>(pixels).first(kWidth));
+          }
         }
+
+        column += kCount;
       }
     }
-    color_ = foreground;
+
+    Invalidate(kVisible);
   }
 
   /// Put a pixel on a specific position.
@@ -216,17 +690,187 @@ class Graphics : public Module<>
   /// @param y - y coordinate to place the coordinate.
   void DrawPixel(uint32_t x, uint32_t y)
   {
-    // Pixels outside of the bounds of the screen will not be drawn.
-    if (x <= width_ && y <= height_)
+    // Pixels outside of the clip rectangle will not be drawn. Coordinates
+    // left of or above it wrap around to large unsigned offsets, so a single
+    // comparison per axis rejects both sides.
+    const uint32_t kColumn = x - static_cast<uint32_t>(clip_.x);
+    const uint32_t kRow    = y - static_cast<uint32_t>(clip_.y);
+    if (kColumn < static_cast<uint32_t>(clip_.width) &&
+        kRow < static_cast<uint32_t>(clip_.height))
     {
-      display_.DrawPixel(x, y, color_);
+      const int32_t kX = static_cast<int32_t>(x);
+      const int32_t kY = static_cast<int32_t>(y);
+      PlotPixel(kX, kY);
+      dirty_ = dirty_.Union({ .x = kX, .y = kY, .width = 1, .height = 1 });
     }
   }
 
  private:
+  /// Write a pixel known to be within the clip rectangle, without marking it
+  /// as changed.
+  void PlotPixel(int32_t x, int32_t y)
+  {
+    if (framebuffer_.IsValid())
+    {
+      framebuffer_.DrawPixel(x, y, color_);
+    }
+    else
+    {
+      display_.DrawPixel(x, y, color_);
+    }
+  }
+
+  /// Clip a line drawn by DrawLine() to the clip rectangle. The end points
+  /// are moved to the first and last pixels of the line within it, and
+  /// `error` is set to the error term Bresenham's loop has at the new first
+  /// pixel, so the clipped line has exactly the visible pixels of the whole
+  /// line.
+  ///
+  /// The loop takes one step along the major axis, the axis the line is
+  /// longest in, for every pixel, and after `n` pixels it has taken
+  /// `(2 * minor * n + major) / (2 * major)` steps along the minor axis. So
+  /// the range of pixels within the clip rectangle is found directly, with no
+  /// work for the pixels outside of it.
+  ///
+  /// @return true - if part of the line is within the clip rectangle.
+  bool ClipLine(int32_t & x0,
+                int32_t & y0,
+                int32_t & x1,
+                int32_t & y1,
+                int32_t & error) const
+  {
+    const int64_t kDx         = std::abs(int64_t{ x1 } - x0);
+    const int64_t kDy         = std::abs(int64_t{ y1 } - y0);
+    const bool kXMajor        = kDx >= kDy;
+    const int64_t kMajor      = kXMajor ? kDx : kDy;
+    const int64_t kMinor      = kXMajor ? kDy : kDx;
+    const int64_t kDirectionX = (x0 < x1) ? 1 : -1;
+    const int64_t kDirectionY = (y0 < y1) ? 1 : -1;
+
+    auto minor_steps = [kMajor, kMinor](int64_t pixel) {
+      return ((2 * kMinor * pixel) + kMajor) / (2 * kMajor);
+    };
+    auto ceiling = [](int64_t numerator, int64_t denominator) {
+      return (numerator >= 0) ? (numerator + denominator - 1) / denominator
+                              : -(-numerator / denominator);
+    };
+    // Range of pixels whose coordinate along an axis is within [low, high].
+    auto visible = [&](int64_t start,
+                       int64_t direction,
+                       int64_t low,
+                       int64_t high,
+                       bool major) {
+      // Range of the number of steps taken along the axis.
+      const int64_t kFirst = (direction > 0) ? low - start : start - high;
+      const int64_t kLast  = (direction > 0) ? high - start : start - low;
+      if (major)
+      {
+        return std::pair{ kFirst, kLast };
+      }
+      return std::pair{
+        ceiling((2 * kMajor * kFirst) - kMajor, 2 * kMinor),
+        ceiling((2 * kMajor * (kLast + 1)) - kMajor, 2 * kMinor) - 1,
+      };
+    };
+
+    const auto kVisibleX =
+        visible(x0, kDirectionX, clip_.x, clip_.Right() - 1, kXMajor);
+    const auto kVisibleY =
+        visible(y0, kDirectionY, clip_.y, clip_.Bottom() - 1, !kXMajor);
+    const int64_t kFirst =
+        std::max({ int64_t{ 0 }, kVisibleX.first, kVisibleY.first });
+    const int64_t kLast =
+        std::min({ kMajor, kVisibleX.second, kVisibleY.second });
+    if (clip_.IsEmpty() || kFirst > kLast)
+    {
+      return false;
+    }
+
+    const int64_t kStartX = x0;
+    const int64_t kStartY = y0;
+    // Move to a pixel of the line, returning the steps taken along x and y.
+    auto move_to = [&](int64_t pixel, int32_t & x, int32_t & y) {
+      const int64_t kMinorSteps = minor_steps(pixel);
+      const int64_t kAlongX     = kXMajor ? pixel : kMinorSteps;
+      const int64_t kAlongY     = kXMajor ? kMinorSteps : pixel;
+      x = static_cast<int32_t>(kStartX + (kDirectionX * kAlongX));
+      y = static_cast<int32_t>(kStartY + (kDirectionY * kAlongY));
+      return std::pair{ kAlongX, kAlongY };
+    };
+
+    const auto [kFirstStepsX, kFirstStepsY] = move_to(kFirst, x0, y0);
+    move_to(kLast, x1, y1);
+    error = static_cast<int32_t>(kDx - kDy + (kFirstStepsY * kDx) -
+                                 (kFirstStepsX * kDy));
+    return true;
+  }
+
+  /// @param reader - the image being drawn.
+  /// @param staging - as many bytes as are wanted.
+  /// @return std::span<const uint8_t> - the next `staging.size()` bytes of
+  ///         the image, in place when the reader holds them all, otherwise
+  ///         copied into `staging`.
+  static std::span<const uint8_t> ReadImage(RleImage::Reader & reader,
+                                            std::span<uint8_t> staging)
+  {
+    const auto kBytes = reader.Next(staging.size());
+    if (kBytes.size() == staging.size())
+    {
+      return kBytes;
+    }
+    std::copy(kBytes.begin(), kBytes.end(), staging.begin());
+    reader.Read(staging.subspan(kBytes.size()));
+    return staging;
+  }
+
+  /// Write 8 columns of a glyph into a monochrome page framebuffer. A glyph
+  /// that is not aligned to a page is split across two pages.
+  void DrawColumns(int32_t x0, int32_t y0, const Font8x8::Glyph_t & columns)
+  {
+    const size_t kColumn = static_cast<size_t>(x0);
+    const size_t kPage   = static_cast<size_t>(y0) / 8;
+    const size_t kShift  = static_cast<size_t>(y0) % 8;
+    uint8_t * top        = &framebuffer_.data[kPage * framebuffer_.stride];
+
+    for (size_t i = 0; i < columns.size(); i++)
+    {
+      top[kColumn + i] =
+          static_cast<uint8_t>(top[kColumn + i] | (columns[i] << kShift));
+    }
+
+    if (kShift != 0)
+    {
+      uint8_t * bottom = top + framebuffer_.stride;
+      for (size_t i = 0; i < columns.size(); i++)
+      {
+        bottom[kColumn + i] = static_cast<uint8_t>(
+            bottom[kColumn + i] | (columns[i] >> (8 - kShift)));
+      }
+    }
+  }
+
+  PixelDisplay::Region_t Clip(PixelDisplay::Region_t region) const
+  {
+    return region.Intersection(clip_);
+  }
+
+  PixelDisplay::Region_t Screen() const
+  {
+    return PixelDisplay::Region_t{
+      .x      = 0,
+      .y      = 0,
+      .width  = static_cast<int32_t>(width_),
+      .height = static_cast<int32_t>(height_),
+    };
+  }
+
   PixelDisplay & display_;
   PixelDisplay::Color_t color_;
   size_t width_;
   size_t height_;
+  PixelDisplay::Framebuffer_t framebuffer_ = {};
+  PixelDisplay::Region_t dirty_            = {};
+  PixelDisplay::Region_t clip_             = {};
+  const Font8x8 * font_                    = &font::kBasic;
 };
 }  // namespace sjsu
@@ -1,10 +1,510 @@
 #include <libcore/systems/graphics.hpp>
+
+#include <array>
+#include <bit>
+#include <vector>
+
 #include <libcore/testing/testing_frameworks.hpp>
 
 namespace sjsu
 {
+/// Monochrome display that records the pixels drawn and the regions updated.
+class FakeDisplay : public PixelDisplay
+{
+ public:
+  static constexpr int32_t kWidth  = 32;
+  static constexpr int32_t kHeight = 16;
+
+  void ModuleInitialize() override {}
+  size_t GetWidth() override
+  {
+    return kWidth;
+  }
+  size_t GetHeight() override
+  {
+    return kHeight;
+  }
+  Color_t AvailableColors() override
+  {
+    return {};
+  }
+  void Clear() override
+  {
+    clears++;
+  }
+  void DrawPixel(int32_t x, int32_t y, Color_t color) override
+  {
+    pixels++;
+    last_color = color;
+    REQUIRE(0 <= x);
+    REQUIRE(x < kWidth);
+    REQUIRE(0 <= y);
+    REQUIRE(y < kHeight);
+    lit[y][x] = true;
+  }
+  void DrawSpan(int32_t x, int32_t y, int32_t width, Color_t color) override
+  {
+    spans++;
+    PixelDisplay::DrawSpan(x, y, width, color);
+  }
+  void FillRectangle(Region_t region, Color_t color) override
+  {
+    fills++;
+    PixelDisplay::FillRectangle(region, color);
+  }
+  void DrawBitmap(Region_t region,
+                  std::span<const uint8_t> bitmap,
+                  Color_t color) override
+  {
+    bitmaps++;
+    PixelDisplay::DrawBitmap(region, bitmap, color);
+  }
+  void DrawBitmap(Region_t region, std::span<const uint16_t> bitmap) override
+  {
+    bitmaps++;
+    PixelDisplay::DrawBitmap(region, bitmap);
+  }
+  void Update() override
+  {
+    full_updates++;
+  }
+  void Update(Region_t region) override
+  {
+    updates.push_back(region);
+  }
+
+  int clears       = 0;
+  int pixels       = 0;
+  int full_updates = 0;
+  int spans        = 0;
+  int fills        = 0;
+  int bitmaps      = 0;
+  Color_t last_color;
+  std::array<std::array<bool, kWidth>, kHeight> lit{};
+  std::vector<Region_t> updates;
+
+  /// @return int - number of pixels drawn within `region`.
+  int LitWithin(Region_t region) const
+  {
+    int count = 0;
+    for (int32_t y = region.y; y < region.Bottom(); y++)
+    {
+      for (int32_t x = region.x; x < region.Right(); x++)
+      {
+        count += lit[y][x];
+      }
+    }
+    return count;
+  }
+};
+
 TEST_CASE("Graphics Test")
 {
-  SECTION("Initialize") {}
+  // Setup
+  FakeDisplay display;
+  Graphics graphics(display);
+
+  SECTION("Region_t Union() and Intersection()")
+  {
+    // Setup
+    constexpr PixelDisplay::Region_t kA = { .x = 2, .y = 3, .width = 4 };
+    constexpr PixelDisplay::Region_t kB = {
+      .x = 4, .y = 1, .width = 6, .height = 3
+    };
+    constexpr PixelDisplay::Region_t kC = {
+      .x = 2, .y = 3, .width = 4, .height = 2
+    };
+
+    // Exercise & Verify
+    static_assert(kA.IsEmpty());
+    static_assert(kA.Union(kB) == kB);
+    static_assert(kB.Union(kA) == kB);
+    static_assert(kB.Union(kC) ==
+                  PixelDisplay::Region_t{
+                      .x = 2, .y = 1, .width = 8, .height = 4 });
+    static_assert(kB.Intersection(kC) ==
+                  PixelDisplay::Region_t{
+                      .x = 4, .y = 3, .width = 2, .height = 1 });
+    static_assert(kC.Intersection({ .x = 6, .width = 5, .height = 5 })
+                      .IsEmpty());
+  }
+
+  SECTION("Update() sends only the region drawn to")
+  {
+    // Exercise
+    graphics.DrawPixel(3, 4);
+    graphics.DrawPixel(10, 2);
+    graphics.Update();
+
+    // Verify
+    REQUIRE(1 == display.updates.size());
+    CHECK(display.updates[0] ==
+          PixelDisplay::Region_t{ .x = 3, .y = 2, .width = 8, .height = 3 });
+    CHECK(0 == display.full_updates);
+    CHECK(graphics.GetDirtyRegion().IsEmpty());
+  }
+
+  SECTION("Update() does nothing when nothing was drawn")
+  {
+    // Exercise
+    graphics.Update();
+
+    // Verify
+    CHECK(display.updates.empty());
+    CHECK(0 == display.full_updates);
+  }
+
+  SECTION("Clear() marks the whole display")
+  {
+    // Exercise
+    graphics.Clear();
+    graphics.Update();
+
+    // Verify
+    CHECK(1 == display.clears);
+    REQUIRE(1 == display.updates.size());
+    CHECK(display.updates[0] ==
+          PixelDisplay::Region_t{ .x      = 0,
+                                  .y      = 0,
+                                  .width  = FakeDisplay::kWidth,
+                                  .height = FakeDisplay::kHeight });
+  }
+
+  SECTION("Pixels outside of the display are not drawn or marked")
+  {
+    // Exercise
+    graphics.DrawPixel(FakeDisplay::kWidth, 0);
+    graphics.DrawPixel(0, FakeDisplay::kHeight);
+    graphics.DrawPixel(-1, 0);
+
+    // Verify
+    CHECK(0 == display.pixels);
+    CHECK(graphics.GetDirtyRegion().IsEmpty());
+  }
+
+  SECTION("Invalidate() is clipped to the display")
+  {
+    // Exercise
+    graphics.Invalidate({ .x = 28, .y = -4, .width = 10, .height = 8 });
+
+    // Verify
+    CHECK(graphics.GetDirtyRegion() ==
+          PixelDisplay::Region_t{ .x = 28, .y = 0, .width = 4, .height = 4 });
+  }
+
+  SECTION("Default Update(region) updates the whole display")
+  {
+    // Setup
+    class FullOnlyDisplay : public FakeDisplay
+    {
+     public:
+      using FakeDisplay::Update;
+      void Update(Region_t region) override
+      {
+        PixelDisplay::Update(region);
+      }
+    } full_only;
+    Graphics full_only_graphics(full_only);
+
+    // Exercise
+    full_only_graphics.DrawPixel(1, 1);
+    full_only_graphics.Update();
+
+    // Verify
+    CHECK(1 == full_only.full_updates);
+  }
+
+  SECTION("Lines are drawn with one bulk call and clipped")
+  {
+    // Exercise
+    graphics.DrawHorizontalLine(28, 1, 10);
+    const int kHorizontalSpans = display.spans;
+    graphics.DrawVerticalLine(2, -4, 8);
+
+    // Verify
+    CHECK(1 == kHorizontalSpans);
+    CHECK(1 == display.fills);
+    CHECK(4 == display.LitWithin({ .x = 28, .y = 1, .width = 4, .height = 1 }));
+    CHECK(4 == display.LitWithin({ .x = 2, .y = 0, .width = 1, .height = 4 }));
+    CHECK(8 == display.pixels);
+  }
+
+  SECTION("DrawCharacter() draws the glyph as a bitmap")
+  {
+    // Setup
+    int expected = 0;
+    for (char row : font8x8_basic['A'])
+    {
+      expected += std::popcount(static_cast<uint8_t>(row));
+    }
+
+    // Exercise
+    graphics.DrawCharacter(4, 4, 'A');
+
+    // Verify
+    CHECK(1 == display.bitmaps);
+    CHECK(expected == display.pixels);
+    CHECK(expected ==
+          display.LitWithin({ .x = 4, .y = 4, .width = 8, .height = 8 }));
+    CHECK(graphics.GetDirtyRegion() ==
+          PixelDisplay::Region_t{ .x = 4, .y = 4, .width = 8, .height = 8 });
+  }
+
+  SECTION("Characters partly off of the display are trimmed")
+  {
+    // Setup
+    int expected = 0;
+    for (char row : font8x8_basic['W'])
+    {
+      expected += std::popcount(static_cast<uint8_t>(row & 0x0F));
+    }
+    constexpr PixelDisplay::Region_t kVisible = {
+      .x = FakeDisplay::kWidth - 4, .y = 0, .width = 4, .height = 8
+    };
+
+    // Exercise
+    graphics.DrawCharacter(FakeDisplay::kWidth - 4, 0, 'W');
+    graphics.DrawCharacter(-8, 0, 'W');
+
+    // Verify
+    CHECK(1 == display.bitmaps);
+    CHECK(expected == display.pixels);
+    CHECK(expected == display.LitWithin(kVisible));
+    CHECK(graphics.GetDirtyRegion() == kVisible);
+  }
+
+  SECTION("SetClip() limits every primitive to the clip rectangle")
+  {
+    // Setup
+    constexpr PixelDisplay::Region_t kClip = {
+      .x = 4, .y = 2, .width = 8, .height = 4
+    };
+    graphics.SetClip(kClip);
+
+    // Exercise
+    graphics.FillRectangle(0, 0, FakeDisplay::kWidth, FakeDisplay::kHeight);
+    graphics.DrawLine(0, 0, 31, 15);
+    graphics.DrawCircle(8, 4, 6);
+    graphics.DrawCharacter(10, 0, 'W');
+    graphics.DrawPixel(2, 2);
+    graphics.DrawPixel(12, 2);
+
+    // Verify
+    CHECK(graphics.GetClip() == kClip);
+    CHECK(32 == display.LitWithin(kClip));
+    CHECK(32 == display.LitWithin({ .width = 32, .height = 16 }));
+    CHECK(graphics.GetDirtyRegion() == kClip);
+    graphics.ResetClip();
+    CHECK(graphics.GetClip() ==
+          PixelDisplay::Region_t{ .width = 32, .height = 16 });
+  }
+
+  SECTION("Lines are clipped before they are stepped through")
+  {
+    // Exercise
+    graphics.DrawLine(-1000, -1000, 1000, 1000);
+    const int kDiagonal = display.pixels;
+    graphics.DrawLine(-100, 20, 100, 40);
+    graphics.DrawCircle(100, 100, 10);
+    graphics.FillCircle(-20, 8, 10);
+
+    // Verify
+    CHECK(FakeDisplay::kHeight == kDiagonal);
+    CHECK(FakeDisplay::kHeight == display.pixels);
+    for (int32_t i = 0; i < FakeDisplay::kHeight; i++)
+    {
+      CHECK(display.lit[i][i]);
+    }
+  }
+
+  SECTION("Clipped lines have exactly the visible pixels of the whole line")
+  {
+    // Setup
+    constexpr PixelDisplay::Region_t kClip = {
+      .x = 6, .y = 4, .width = 13, .height = 7
+    };
+    constexpr std::array<int32_t, 5> kColumns = { -7, 0, 9, 20, 31 };
+    constexpr std::array<int32_t, 5> kRows    = { -3, 0, 6, 12, 15 };
+
+    for (int32_t x0 : kColumns)
+    {
+      for (int32_t y0 : kRows)
+      {
+        for (int32_t x1 : kColumns)
+        {
+          for (int32_t y1 : kRows)
+          {
+            FakeDisplay clipped_display;
+            FakeDisplay whole_display;
+            Graphics clipped(clipped_display);
+            Graphics whole(whole_display);
+            clipped.SetClip(kClip);
+
+            // Exercise
+            clipped.DrawLine(x0, y0, x1, y1);
+            whole.DrawLine(x0, y0, x1, y1);
+
+            // Verify
+            int differences = 0;
+            for (int32_t y = kClip.y; y < kClip.Bottom(); y++)
+            {
+              for (int32_t x = kClip.x; x < kClip.Right(); x++)
+              {
+                differences +=
+                    clipped_display.lit[y][x] != whole_display.lit[y][x];
+              }
+            }
+            CHECK(0 == differences);
+            CHECK(clipped_display.pixels == clipped_display.LitWithin(kClip));
+          }
+        }
+      }
+    }
+  }
+
+  SECTION("Clipped lines keep the pixels of the whole line")
+  {
+    // Setup
+    // Pixels of the whole line, from Bresenham's algorithm.
+    std::vector<std::pair<int32_t, int32_t>> expected;
+    for (int32_t x = -10; x <= 50; x++)
+    {
+      // The line (-10, 1) to (50, 21) has a slope of 1/3.
+      const int32_t kY = 1 + ((x + 10 + 1) / 3);
+      if (0 <= x && x < FakeDisplay::kWidth && kY < FakeDisplay::kHeight)
+      {
+        expected.emplace_back(x, kY);
+      }
+    }
+
+    // Exercise
+    graphics.DrawLine(-10, 1, 50, 21);
+
+    // Verify
+    CHECK(expected.size() == static_cast<size_t>(display.pixels));
+    for (auto [x, y] : expected)
+    {
+      CHECK(display.lit[y][x]);
+    }
+  }
+
+  SECTION("Default DrawBitmap() for 1 bit per pixel bitmaps")
+  {
+    // Setup
+    // 10 x 2 pixels, with a stride of 2 bytes.
+    constexpr std::array<uint8_t, 4> kBitmap = { 0b0000'0001,
+                                                 0b0000'0010,
+                                                 0b1000'0000,
+                                                 0b0000'0000 };
+
+    // Exercise
+    graphics.DrawBitmap(0, 0, 10, 2, kBitmap);
+
+    // Verify
+    CHECK(3 == display.pixels);
+    CHECK(display.lit[0][0]);
+    CHECK(display.lit[0][9]);
+    CHECK(display.lit[1][7]);
+  }
+
+  SECTION("Default DrawBitmap() for RGB565 bitmaps")
+  {
+    // Setup
+    constexpr std::array<uint16_t, 2> kBitmap = { 0xF800, 0x07E0 };
+
+    // Exercise
+    graphics.DrawBitmap(0, 0, 2, 1, kBitmap);
+
+    // Verify
+    CHECK(2 == display.pixels);
+    CHECK(0 == display.last_color.red);
+    CHECK(0x3F == display.last_color.green);
+    CHECK(0 == display.last_color.blue);
+  }
+
+  SECTION("DrawImage() draws runs as spans and literal pixels as bitmaps")
+  {
+    // Setup
+    constexpr std::array<uint16_t, 8> kPixels = { 7, 7, 7, 7, 1, 2, 3, 4 };
+    std::array<uint8_t, RleImage::MaximumEncodedSize(4, 2)> image{};
+    RleImage::Encode(4, kPixels, image);
+
+    // Exercise
+    graphics.DrawImage(30, 14, image);
+
+    // Verify
+    CHECK(1 == display.spans);
+    CHECK(1 == display.bitmaps);
+    CHECK(4 == display.pixels);
+    constexpr PixelDisplay::Region_t kVisible = {
+      .x = 30, .y = 14, .width = 2, .height = 2
+    };
+    CHECK(4 == display.LitWithin(kVisible));
+    CHECK(graphics.GetDirtyRegion() == kVisible);
+  }
+
+  SECTION("DrawLine() draws both end points in every direction")
+  {
+    // Exercise
+    graphics.DrawLine(10, 8, 2, 4);
+
+    // Verify
+    CHECK(9 == display.pixels);
+    CHECK(display.lit[8][10]);
+    CHECK(display.lit[4][2]);
+    CHECK(display.lit[6][6]);
+  }
+
+  SECTION("DrawLine() draws straight lines as spans")
+  {
+    // Exercise
+    graphics.DrawLine(7, 3, 1, 3);
+    const int kHorizontalSpans = display.spans;
+    graphics.DrawLine(4, 9, 4, 5);
+
+    // Verify
+    CHECK(1 == kHorizontalSpans);
+    CHECK(1 == display.fills);
+    CHECK(7 == display.LitWithin({ .x = 1, .y = 3, .width = 7, .height = 1 }));
+    CHECK(5 == display.LitWithin({ .x = 4, .y = 5, .width = 1, .height = 5 }));
+  }
+
+  SECTION("FillRectangle() is a single clipped fill")
+  {
+    // Exercise
+    graphics.FillRectangle(-2, 14, 5, 5);
+
+    // Verify
+    CHECK(1 == display.fills);
+    CHECK(6 == display.pixels);
+    CHECK(graphics.GetDirtyRegion() ==
+          PixelDisplay::Region_t{ .x = 0, .y = 14, .width = 3, .height = 2 });
+  }
+
+  SECTION("FillCircle() fills every pixel within the radius")
+  {
+    // Setup
+    constexpr int32_t kRadius = 5;
+
+    // Exercise
+    graphics.FillCircle(8, 8, kRadius);
+
+    // Verify
+    for (int32_t y = 0; y < FakeDisplay::kHeight; y++)
+    {
+      for (int32_t x = 0; x < FakeDisplay::kWidth; x++)
+      {
+        const int32_t kDistance = ((x - 8) * (x - 8)) + ((y - 8) * (y - 8));
+        if (kDistance < kRadius * kRadius)
+        {
+          CHECK(display.lit[y][x]);
+        }
+        if (kDistance > (kRadius + 1) * (kRadius + 1))
+        {
+          CHECK(!display.lit[y][x]);
+        }
+      }
+    }
+  }
 }
 }  // namespace sjsu
@@ -0,0 +1,605 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include <libcore/peripherals/can.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu::isotp
+{
+/// Largest message ISO-TP can carry with a 12-bit first frame length.
+inline constexpr size_t kMaximumLength = 4095;
+
+/// Largest number of consecutive frames handed to Can::Send() at once.
+inline constexpr size_t kPipelineDepth = 3;
+
+/// Type of an ISO-TP frame, the high nibble of its first byte.
+enum class FrameType : uint8_t
+{
+  kSingle      = 0,
+  kFirst       = 1,
+  kConsecutive = 2,
+  kFlowControl = 3,
+};
+
+/// Flow status of a flow control frame.
+enum class FlowStatus : uint8_t
+{
+  kContinueToSend = 0,
+  kWait           = 1,
+  kOverflow       = 2,
+};
+
+/// Progress of a message being sent or received by a Channel.
+enum class Status : uint8_t
+{
+  /// No message is being transferred. For receiving, the channel is waiting
+  /// for a message.
+  kIdle,
+  /// A message is part way through being transferred.
+  kBusy,
+  /// The message has been transferred.
+  kDone,
+  /// The transfer failed, see Channel::SendError() or ReceiveError().
+  kFailed,
+};
+
+/// Decode the separation time (STmin) field of a flow control frame.
+///
+/// @param separation_time - 0x00 to 0x7F for 0 to 127 ms, 0xF1 to 0xF9 for
+///        100 to 900 us. Reserved values are treated as 127 ms.
+/// @return constexpr std::chrono::nanoseconds - minimum time between
+///         consecutive frames.
+constexpr std::chrono::nanoseconds DecodeSeparationTime(uint8_t separation_time)
+{
+  if (separation_time <= 0x7F)
+  {
+    return std::chrono::milliseconds(separation_time);
+  }
+  if (0xF1 <= separation_time && separation_time <= 0xF9)
+  {
+    return std::chrono::microseconds((separation_time - 0xF0) * 100);
+  }
+  return std::chrono::milliseconds(0x7F);
+}
+
+/// Addressing and flow control of a Channel.
+struct ChannelSettings_t
+{
+  /// ID of the frames this channel sends.
+  uint32_t transmit_id = 0;
+  /// ID of the frames the other node sends to this channel.
+  uint32_t receive_id = 0;
+  /// ID format of both IDs.
+  Can::Message_t::Format format = Can::Message_t::Format::kStandard;
+  /// Number of consecutive frames the other node may send before waiting for
+  /// another flow control frame. 0 lets it send the whole message.
+  uint8_t block_size = 0;
+  /// Separation time (STmin) asked of the other node, encoded as in
+  /// DecodeSeparationTime().
+  uint8_t separation_time = 0;
+  /// Time to wait for a flow control frame or the next consecutive frame.
+  std::chrono::nanoseconds timeout = std::chrono::seconds(1);
+  /// Value of the unused bytes of frames shorter than 8 bytes.
+  uint8_t padding = 0xCC;
+};
+
+class Transport;
+
+/// One ISO-TP connection with another node, identified by a pair of CAN IDs.
+/// A channel can send one message and receive another at the same time, and
+/// a Transport runs any number of channels at once.
+///
+/// Messages are never copied: Send() reads the caller's data as frames are
+/// sent, and received frames are copied directly into the buffer given to
+/// Receive().
+///
+/// USAGE:
+///
+///    sjsu::isotp::Transport transport(can);
+///    sjsu::isotp::Channel diagnostics(transport, {
+///      .transmit_id = 0x7E8,
+///      .receive_id  = 0x7E0,
+///    });
+///
+///    std::array<uint8_t, 512> request;
+///    diagnostics.Receive(request);
+///    while (true)
+///    {
+///      transport.Process();
+///      if (diagnostics.ReceiveStatus() == sjsu::isotp::Status::kDone)
+///      {
+///        diagnostics.Send(Handle(diagnostics.Received()));
+///        diagnostics.Receive(request);
+///      }
+///    }
+class Channel
+{
+ public:
+  /// @param transport - transport to run the channel on.
+  /// @param settings - addressing and flow control of the channel.
+  Channel(Transport & transport, const ChannelSettings_t & settings);
+
+  Channel(const Channel &) = delete;
+  Channel & operator=(const Channel &) = delete;
+
+  ~Channel();
+
+  /// Start sending a message. Messages of up to 7 bytes are sent at once;
+  /// longer messages are sent by Transport::Process().
+  ///
+  /// @param data - message to send. Must remain valid until SendStatus() is
+  ///        no longer Status::kBusy.
+  /// @throw std::errc::device_or_resource_busy - if a message is still being
+  ///        sent.
+  /// @throw std::errc::message_size - if the message is empty or longer than
+  ///        kMaximumLength.
+  void Send(std::span<const uint8_t> data);
+
+  /// Provide the buffer for the next received message and wait for it.
+  ///
+  /// @param buffer - buffer to receive into. Must remain valid until
+  ///        ReceiveStatus() is Status::kDone or Status::kFailed. Messages
+  ///        longer than the buffer are refused.
+  void Receive(std::span<uint8_t> buffer)
+  {
+    receive_buffer_ = buffer;
+    received_       = 0;
+    receive_status_ = Status::kIdle;
+  }
+
+  /// @return Status - progress of the message being sent.
+  Status SendStatus() const
+  {
+    return send_status_;
+  }
+
+  /// @return Status - progress of the message being received.
+  Status ReceiveStatus() const
+  {
+    return receive_status_;
+  }
+
+  /// @return std::errc - why sending last failed: std::errc::timed_out
+  ///         without flow control from the other node, or
+  ///         std::errc::message_size if the other node refused the message.
+  std::errc SendError() const
+  {
+    return send_error_;
+  }
+
+  /// @return std::errc - why receiving last failed: std::errc::timed_out if
+  ///         the other node stopped sending, std::errc::message_size if the
+  ///         message did not fit, or std::errc::protocol_error if a frame was
+  ///         out of sequence.
+  std::errc ReceiveError() const
+  {
+    return receive_error_;
+  }
+
+  /// @return std::span<uint8_t> - the received message, within the buffer
+  ///         given to Receive(), once ReceiveStatus() is Status::kDone.
+  std::span<uint8_t> Received() const
+  {
+    return receive_buffer_.first(received_);
+  }
+
+  /// @return const ChannelSettings_t & - addressing and flow control.
+  const ChannelSettings_t & GetSettings() const
+  {
+    return settings_;
+  }
+
+ private:
+  friend class Transport;
+
+  enum class SendState : uint8_t
+  {
+    kWaitForFlowControl,
+    kSending,
+  };
+
+  Can::Message_t Frame() const
+  {
+    Can::Message_t message{};
+    message.id     = settings_.transmit_id;
+    message.format = settings_.format;
+    message.length = 8;
+    message.payload.fill(settings_.padding);
+    return message;
+  }
+
+  void SendFlowControl(FlowStatus status);
+  void HandleFrame(const Can::Message_t & message);
+  void HandleFlowControl(const Can::Message_t & message);
+  void HandleSingle(const Can::Message_t & message);
+  void HandleFirst(const Can::Message_t & message);
+  void HandleConsecutive(const Can::Message_t & message);
+  void Poll();
+
+  void FailSend(std::errc error)
+  {
+    send_status_ = Status::kFailed;
+    send_error_  = error;
+  }
+
+  void FailReceive(std::errc error)
+  {
+    receive_status_ = Status::kFailed;
+    receive_error_  = error;
+  }
+
+  Transport & transport_;
+  ChannelSettings_t settings_;
+  Channel * next_ = nullptr;
+
+  std::span<const uint8_t> send_data_;
+  size_t sent_                            = 0;
+  Status send_status_                     = Status::kIdle;
+  std::errc send_error_                   = std::errc{};
+  SendState send_state_                   = SendState::kWaitForFlowControl;
+  uint8_t send_sequence_                  = 0;
+  uint8_t block_remaining_                = 0;
+  bool block_limited_                     = false;
+  std::chrono::nanoseconds separation_    = std::chrono::nanoseconds(0);
+  std::chrono::nanoseconds send_after_    = std::chrono::nanoseconds(0);
+  std::chrono::nanoseconds send_deadline_ = std::chrono::nanoseconds(0);
+
+  std::span<uint8_t> receive_buffer_;
+  size_t received_                           = 0;
+  size_t receive_length_                     = 0;
+  Status receive_status_                     = Status::kIdle;
+  std::errc receive_error_                   = std::errc{};
+  uint8_t receive_sequence_                  = 0;
+  uint8_t block_received_                    = 0;
+  std::chrono::nanoseconds receive_deadline_ = std::chrono::nanoseconds(0);
+};
+
+/// Runs ISO-TP (ISO 15765-2) Channels over a CAN peripheral, with normal
+/// addressing and classic 8 byte frames.
+///
+/// Process() must be called regularly, such as from the main loop. It reads
+/// every received frame, hands each one to the channel it is addressed to,
+/// and sends the consecutive frames of messages being sent. When the other
+/// node's separation time is 0, up to kPipelineDepth frames are passed to
+/// Can::Send() at once, so that drivers with several transmit mailboxes keep
+/// them all loaded.
+class Transport
+{
+ public:
+  /// @param can - initialized CAN peripheral.
+  explicit Transport(Can & can) : can_(can) {}
+
+  Transport(const Transport &) = delete;
+  Transport & operator=(const Transport &) = delete;
+
+  /// Receive every waiting frame, then advance every channel.
+  ///
+  /// Frames not addressed to a channel are discarded. Applications sharing
+  /// the bus with other protocols should read frames themselves and pass them
+  /// to Handle() instead, then call Poll().
+  void Process()
+  {
+    while (can_.HasData())
+    {
+      Handle(can_.Receive());
+    }
+    Poll();
+  }
+
+  /// Hand a received frame to the channel it is addressed to.
+  ///
+  /// @param message - received frame.
+  /// @return true - if the frame was addressed to a channel.
+  bool Handle(const Can::Message_t & message)
+  {
+    for (Channel * channel = channels_; channel != nullptr;
+         channel           = channel->next_)
+    {
+      if (channel->settings_.receive_id == message.id &&
+          channel->settings_.format == message.format)
+      {
+        channel->HandleFrame(message);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Send the frames that are due and check for timeouts, on every channel.
+  void Poll()
+  {
+    for (Channel * channel = channels_; channel != nullptr;
+         channel           = channel->next_)
+    {
+      channel->Poll();
+    }
+  }
+
+ private:
+  friend class Channel;
+
+  Can & can_;
+  Channel * channels_ = nullptr;
+};
+
+inline Channel::Channel(Transport & transport,
+                        const ChannelSettings_t & settings)
+    : transport_(transport), settings_(settings), next_(transport.channels_)
+{
+  transport_.channels_ = this;
+}
+
+inline Channel::~Channel()
+{
+  for (Channel ** channel = &transport_.channels_; *channel != nullptr;
+       channel            = &(*channel)->next_)
+  {
+    if (*channel == this)
+    {
+      *channel = next_;
+      break;
+    }
+  }
+}
+
+inline void Channel::Send(std::span<const uint8_t> data)
+{
+  if (send_status_ == Status::kBusy)
+  {
+    throw Exception(std::errc::device_or_resource_busy,
+                    "ISO-TP channel is still sending a message.");
+  }
+
+  if (data.empty() || data.size() > kMaximumLength)
+  {
+    throw Exception(std::errc::message_size,
+                    "ISO-TP messages must be 1 to 4095 bytes long.");
+  }
+
+  Can::Message_t message = Frame();
+
+  if (data.size() <= 7)
+  {
+    message.payload[0] = static_cast<uint8_t>(data.size());
+    std::copy(data.begin(), data.end(), &message.payload[1]);
+    transport_.can_.Send(message);
+    send_status_ = Status::kDone;
+    return;
+  }
+
+  message.payload[0] = static_cast<uint8_t>(
+      (static_cast<uint8_t>(FrameType::kFirst) << 4) | (data.size() >> 8));
+  message.payload[1] = static_cast<uint8_t>(data.size());
+  std::copy_n(data.begin(), 6, &message.payload[2]);
+
+  send_data_     = data;
+  sent_          = 6;
+  send_sequence_ = 1;
+  send_state_    = SendState::kWaitForFlowControl;
+  send_deadline_ = Uptime() + settings_.timeout;
+  send_status_   = Status::kBusy;
+
+  transport_.can_.Send(message);
+}
+
+inline void Channel::SendFlowControl(FlowStatus status)
+{
+  Can::Message_t message = Frame();
+  message.payload[0]     = static_cast<uint8_t>(
+      (static_cast<uint8_t>(FrameType::kFlowControl) << 4) |
+      static_cast<uint8_t>(status));
+  message.payload[1] = settings_.block_size;
+  message.payload[2] = settings_.separation_time;
+  transport_.can_.Send(message);
+}
+
+inline void Channel::HandleFrame(const Can::Message_t & message)
+{
+  if (message.length == 0)
+  {
+    return;
+  }
+
+  switch (static_cast<FrameType>(message.payload[0] >> 4))
+  {
+    case FrameType::kSingle: HandleSingle(message); break;
+    case FrameType::kFirst: HandleFirst(message); break;
+    case FrameType::kConsecutive: HandleConsecutive(message); break;
+    case FrameType::kFlowControl: HandleFlowControl(message); break;
+  }
+}
+
+inline void Channel::HandleFlowControl(const Can::Message_t & message)
+{
+  if (send_status_ != Status::kBusy ||
+      send_state_ != SendState::kWaitForFlowControl || message.length < 3)
+  {
+    return;
+  }
+
+  switch (static_cast<FlowStatus>(message.payload[0] & 0xF))
+  {
+    case FlowStatus::kContinueToSend:
+      block_remaining_ = message.payload[1];
+      block_limited_   = message.payload[1] != 0;
+      separation_      = DecodeSeparationTime(message.payload[2]);
+      send_after_      = Uptime();
+      send_state_      = SendState::kSending;
+      break;
+    case FlowStatus::kWait:
+      send_deadline_ = Uptime() + settings_.timeout;
+      break;
+    case FlowStatus::kOverflow: FailSend(std::errc::message_size); break;
+  }
+}
+
+inline void Channel::HandleSingle(const Can::Message_t & message)
+{
+  if (receive_status_ == Status::kDone || receive_status_ == Status::kFailed)
+  {
+    return;
+  }
+
+  const size_t kLength = message.payload[0] & 0xF;
+  if (kLength == 0 || kLength > 7 || kLength + 1u > message.length)
+  {
+    return;
+  }
+
+  if (kLength > receive_buffer_.size())
+  {
+    FailReceive(std::errc::message_size);
+    return;
+  }
+
+  std::copy_n(&message.payload[1], kLength, receive_buffer_.begin());
+  received_       = kLength;
+  receive_status_ = Status::kDone;
+}
+
+inline void Channel::HandleFirst(const Can::Message_t & message)
+{
+  if (receive_status_ == Status::kDone || receive_status_ == Status::kFailed ||
+      message.length < 8)
+  {
+    return;
+  }
+
+  const size_t kLength = ((message.payload[0] & 0xF) << 8) | message.payload[1];
+  // Messages of up to 7 bytes are sent as single frames, so ISO 15765-2
+  // requires first frames with a shorter length to be ignored.
+  if (kLength < 8)
+  {
+    return;
+  }
+  if (kLength > receive_buffer_.size())
+  {
+    SendFlowControl(FlowStatus::kOverflow);
+    FailReceive(std::errc::message_size);
+    return;
+  }
+
+  const size_t kCount = std::min<size_t>(6, kLength);
+  std::copy_n(&message.payload[2], kCount, receive_buffer_.begin());
+  received_         = kCount;
+  receive_length_   = kLength;
+  receive_sequence_ = 1;
+  block_received_   = 0;
+  receive_deadline_ = Uptime() + settings_.timeout;
+  receive_status_   = Status::kBusy;
+
+  SendFlowControl(FlowStatus::kContinueToSend);
+}
+
+inline void Channel::HandleConsecutive(const Can::Message_t & message)
+{
+  if (receive_status_ != Status::kBusy)
+  {
+    return;
+  }
+
+  if ((message.payload[0] & 0xF) != receive_sequence_)
+  {
+    FailReceive(std::errc::protocol_error);
+    return;
+  }
+
+  const size_t kCount =
+      std::min<size_t>({ 7, receive_length_ - received_, message.length - 1u });
+  std::copy_n(&message.payload[1], kCount, &receive_buffer_[received_]);
+  received_ += kCount;
+  receive_sequence_ = (receive_sequence_ + 1) & 0xF;
+
+  if (received_ == receive_length_)
+  {
+    receive_status_ = Status::kDone;
+    return;
+  }
+
+  receive_deadline_ = Uptime() + settings_.timeout;
+  if (settings_.block_size != 0 && ++block_received_ == settings_.block_size)
+  {
+    block_received_ = 0;
+    SendFlowControl(FlowStatus::kContinueToSend);
+  }
+}
+
+inline void Channel::Poll()
+{
+  const auto kNow = Uptime();
+
+  if (receive_status_ == Status::kBusy && kNow > receive_deadline_)
+  {
+    FailReceive(std::errc::timed_out);
+  }
+
+  if (send_status_ != Status::kBusy)
+  {
+    return;
+  }
+
+  if (send_state_ == SendState::kWaitForFlowControl)
+  {
+    if (kNow > send_deadline_)
+    {
+      FailSend(std::errc::timed_out);
+    }
+    return;
+  }
+
+  if (kNow < send_after_)
+  {
+    return;
+  }
+
+  // Without a separation time, consecutive frames are handed to the driver
+  // together, so every transmit mailbox can be loaded at once.
+  size_t batch = (separation_.count() == 0) ? kPipelineDepth : 1;
+  if (block_limited_)
+  {
+    batch = std::min<size_t>(batch, block_remaining_);
+  }
+
+  std::array<Can::Message_t, kPipelineDepth> frames;
+  size_t count = 0;
+  for (; count < batch && sent_ < send_data_.size(); count++)
+  {
+    const size_t kLength = std::min<size_t>(7, send_data_.size() - sent_);
+
+    frames[count]            = Frame();
+    frames[count].payload[0] = static_cast<uint8_t>(
+        (static_cast<uint8_t>(FrameType::kConsecutive) << 4) | send_sequence_);
+    std::copy_n(&send_data_[sent_], kLength, &frames[count].payload[1]);
+
+    sent_ += kLength;
+    send_sequence_ = (send_sequence_ + 1) & 0xF;
+  }
+
+  transport_.can_.Send(std::span<const Can::Message_t>(frames.data(), count));
+  send_after_ = kNow + separation_;
+
+  if (sent_ == send_data_.size())
+  {
+    send_status_ = Status::kDone;
+    return;
+  }
+
+  if (block_limited_)
+  {
+    block_remaining_ = static_cast<uint8_t>(block_remaining_ - count);
+    if (block_remaining_ == 0)
+    {
+      send_state_    = SendState::kWaitForFlowControl;
+      send_deadline_ = kNow + settings_.timeout;
+    }
+  }
+}
+}  // namespace sjsu::isotp
@@ -0,0 +1,374 @@
+#include <libcore/systems/iso_tp.hpp>
+
+#include <array>
+#include <deque>
+#include <numeric>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+namespace sjsu::isotp
+{
+namespace
+{
+/// Classic CAN controller whose sent frames are received by a peer.
+class LoopbackCan : public Can
+{
+ public:
+  void ModuleInitialize() override {}
+  void Send(const Message_t & message) override
+  {
+    sent.push_back(message);
+    if (peer != nullptr)
+    {
+      peer->received.push_back(message);
+    }
+  }
+  void Send(std::span<const Message_t> messages) override
+  {
+    batches.push_back(messages.size());
+    Can::Send(messages);
+  }
+  Message_t Receive() override
+  {
+    Message_t message = received.front();
+    received.pop_front();
+    return message;
+  }
+  bool HasData() override
+  {
+    return !received.empty();
+  }
+  bool SelfTest(uint32_t) override
+  {
+    return true;
+  }
+  bool IsBusOff() override
+  {
+    return false;
+  }
+
+  using Can::Send;
+
+  LoopbackCan * peer = nullptr;
+  std::deque<Message_t> received;
+  std::vector<Message_t> sent;
+  std::vector<size_t> batches;
+};
+}  // namespace
+
+TEST_CASE("Testing ISO-TP")
+{
+  VirtualClock clock;
+  clock.Start();
+
+  LoopbackCan tester_can;
+  LoopbackCan ecu_can;
+  tester_can.peer = &ecu_can;
+  ecu_can.peer    = &tester_can;
+
+  Transport tester(tester_can);
+  Transport ecu(ecu_can);
+
+  std::array<uint8_t, 256> message;
+  std::iota(message.begin(), message.end(), 0);
+  std::array<uint8_t, 256> buffer{};
+
+  auto run = [&](Channel & sender) {
+    for (int i = 0; i < 1000 && sender.SendStatus() == Status::kBusy; i++)
+    {
+      ecu.Process();
+      tester.Process();
+      clock.Advance(1ms);
+    }
+    ecu.Process();
+  };
+
+  SECTION("DecodeSeparationTime()")
+  {
+    CHECK(0ms == DecodeSeparationTime(0x00));
+    CHECK(10ms == DecodeSeparationTime(0x0A));
+    CHECK(127ms == DecodeSeparationTime(0x7F));
+    CHECK(100us == DecodeSeparationTime(0xF1));
+    CHECK(900us == DecodeSeparationTime(0xF9));
+    CHECK(127ms == DecodeSeparationTime(0x80));
+    CHECK(127ms == DecodeSeparationTime(0xFA));
+  }
+
+  SECTION("Single frame")
+  {
+    // Setup
+    Channel request(tester, { .transmit_id = 0x7E0, .receive_id = 0x7E8 });
+    Channel response(ecu, { .transmit_id = 0x7E8, .receive_id = 0x7E0 });
+    response.Receive(buffer);
+
+    // Exercise
+    request.Send(std::span(message).first(5));
+    ecu.Process();
+
+    // Verify
+    CHECK(Status::kDone == request.SendStatus());
+    REQUIRE(1 == tester_can.sent.size());
+    CHECK(0x7E0 == tester_can.sent[0].id);
+    CHECK(8 == tester_can.sent[0].length);
+    CHECK(0x05 == tester_can.sent[0].payload[0]);
+    CHECK(0xCC == tester_can.sent[0].payload[7]);
+    REQUIRE(Status::kDone == response.ReceiveStatus());
+    CHECK(5 == response.Received().size());
+    CHECK(buffer.data() == response.Received().data());
+    CHECK(std::equal(response.Received().begin(),
+                     response.Received().end(),
+                     message.begin()));
+  }
+
+  SECTION("Multiple frames are pipelined within each block")
+  {
+    // Setup
+    Channel request(tester, { .transmit_id = 0x7E0, .receive_id = 0x7E8 });
+    Channel response(
+        ecu, { .transmit_id = 0x7E8, .receive_id = 0x7E0, .block_size = 4 });
+    response.Receive(buffer);
+
+    // Exercise
+    request.Send(std::span(message).first(100));
+    run(request);
+
+    // Verify
+    CHECK(Status::kDone == request.SendStatus());
+    REQUIRE(Status::kDone == response.ReceiveStatus());
+    CHECK(100 == response.Received().size());
+    CHECK(std::equal(response.Received().begin(),
+                     response.Received().end(),
+                     message.begin()));
+
+    // 1 first frame and 14 consecutive frames, in blocks of 4.
+    CHECK(15 == tester_can.sent.size());
+    CHECK(0x10 == tester_can.sent[0].payload[0]);
+    CHECK(100 == tester_can.sent[0].payload[1]);
+    CHECK(0x21 == tester_can.sent[1].payload[0]);
+    CHECK(0x2E == tester_can.sent[14].payload[0]);
+    CHECK(std::vector<size_t>{ 3, 1, 3, 1, 3, 1, 2 } == tester_can.batches);
+
+    // One flow control frame for the first frame and one after each full
+    // block.
+    REQUIRE(4 == ecu_can.sent.size());
+    CHECK(0x30 == ecu_can.sent[0].payload[0]);
+    CHECK(4 == ecu_can.sent[0].payload[1]);
+    CHECK(0 == ecu_can.sent[0].payload[2]);
+  }
+
+  SECTION("Sequence numbers wrap around")
+  {
+    // Setup
+    Channel request(tester, { .transmit_id = 0x7E0, .receive_id = 0x7E8 });
+    Channel response(ecu, { .transmit_id = 0x7E8, .receive_id = 0x7E0 });
+    response.Receive(buffer);
+
+    // Exercise
+    request.Send(message);
+    run(request);
+
+    // Verify
+    REQUIRE(Status::kDone == response.ReceiveStatus());
+    CHECK(256 == response.Received().size());
+    CHECK(std::equal(response.Received().begin(),
+                     response.Received().end(),
+                     message.begin()));
+    CHECK(0x20 == tester_can.sent[16].payload[0]);
+  }
+
+  SECTION("Separation time paces consecutive frames")
+  {
+    // Setup
+    Channel request(tester, { .transmit_id = 0x7E0, .receive_id = 0x7E8 });
+    Channel response(ecu,
+                     { .transmit_id     = 0x7E8,
+                       .receive_id      = 0x7E0,
+                       .separation_time = 10 });
+    response.Receive(buffer);
+    request.Send(std::span(message).first(20));
+    ecu.Process();
+
+    // Exercise
+    tester.Process();
+    tester.Process();
+    const size_t kSentAtOnce = tester_can.sent.size();
+    clock.Advance(9ms);
+    tester.Process();
+    const size_t kSentBefore = tester_can.sent.size();
+    clock.Advance(1ms);
+    tester.Process();
+    ecu.Process();
+
+    // Verify
+    CHECK(2 == kSentAtOnce);
+    CHECK(2 == kSentBefore);
+    CHECK(3 == tester_can.sent.size());
+    CHECK(Status::kDone == request.SendStatus());
+    CHECK(Status::kDone == response.ReceiveStatus());
+    CHECK(std::vector<size_t>{ 1, 1 } == tester_can.batches);
+  }
+
+  SECTION("Messages larger than the buffer are refused")
+  {
+    // Setup
+    Channel request(tester, { .transmit_id = 0x7E0, .receive_id = 0x7E8 });
+    Channel response(ecu, { .transmit_id = 0x7E8, .receive_id = 0x7E0 });
+    response.Receive(std::span(buffer).first(10));
+
+    // Exercise
+    request.Send(std::span(message).first(20));
+    run(request);
+
+    // Verify
+    CHECK(Status::kFailed == request.SendStatus());
+    CHECK(std::errc::message_size == request.SendError());
+    CHECK(Status::kFailed == response.ReceiveStatus());
+    CHECK(std::errc::message_size == response.ReceiveError());
+    REQUIRE(1 == ecu_can.sent.size());
+    CHECK(0x32 == ecu_can.sent[0].payload[0]);
+  }
+
+  SECTION("Sending times out without flow control")
+  {
+    // Setup
+    Channel request(tester,
+                    { .transmit_id = 0x7E0,
+                      .receive_id  = 0x7E8,
+                      .timeout     = 100ms });
+
+    // Exercise
+    request.Send(std::span(message).first(20));
+    clock.Advance(100ms);
+    tester.Process();
+    const Status kBeforeTimeout = request.SendStatus();
+    clock.Advance(1ms);
+    tester.Process();
+
+    // Verify
+    CHECK(Status::kBusy == kBeforeTimeout);
+    CHECK(Status::kFailed == request.SendStatus());
+    CHECK(std::errc::timed_out == request.SendError());
+  }
+
+  SECTION("Receiving times out when frames stop")
+  {
+    // Setup
+    Channel response(ecu,
+                     { .transmit_id = 0x7E8,
+                       .receive_id  = 0x7E0,
+                       .timeout     = 100ms });
+    response.Receive(buffer);
+    tester_can.Send(Can::Message_t{
+        .id = 0x7E0, .length = 8, .payload = { 0x10, 20, 0, 1, 2, 3, 4, 5 } });
+
+    // Exercise
+    ecu.Process();
+    clock.Advance(101ms);
+    ecu.Process();
+
+    // Verify
+    CHECK(Status::kFailed == response.ReceiveStatus());
+    CHECK(std::errc::timed_out == response.ReceiveError());
+  }
+
+  SECTION("Out of sequence frames fail the message")
+  {
+    // Setup
+    Channel response(ecu, { .transmit_id = 0x7E8, .receive_id = 0x7E0 });
+    response.Receive(buffer);
+    tester_can.Send(Can::Message_t{
+        .id = 0x7E0, .length = 8, .payload = { 0x10, 20, 0, 1, 2, 3, 4, 5 } });
+    tester_can.Send(Can::Message_t{
+        .id = 0x7E0, .length = 8, .payload = { 0x22, 6, 7, 8, 9, 10, 11, 0 } });
+
+    // Exercise
+    ecu.Process();
+
+    // Verify
+    CHECK(Status::kFailed == response.ReceiveStatus());
+    CHECK(std::errc::protocol_error == response.ReceiveError());
+  }
+
+  SECTION("First frames shorter than 8 bytes are ignored")
+  {
+    // Setup
+    std::array<uint8_t, 4> small_buffer{};
+    Channel response(ecu, { .transmit_id = 0x7E8, .receive_id = 0x7E0 });
+    response.Receive(small_buffer);
+    tester_can.Send(Can::Message_t{
+        .id = 0x7E0, .length = 8, .payload = { 0x10, 3, 0, 1, 2, 3, 4, 5 } });
+
+    // Exercise
+    ecu.Process();
+
+    // Verify
+    CHECK(Status::kIdle == response.ReceiveStatus());
+    CHECK(ecu_can.sent.empty());
+    CHECK(std::array<uint8_t, 4>{} == small_buffer);
+  }
+
+  SECTION("Channels transfer concurrently")
+  {
+    // Setup
+    std::array<uint8_t, 64> other_buffer{};
+    Channel request_a(tester, { .transmit_id = 0x7E0, .receive_id = 0x7E8 });
+    Channel request_b(tester, { .transmit_id = 0x7E1, .receive_id = 0x7E9 });
+    Channel response_a(ecu, { .transmit_id = 0x7E8, .receive_id = 0x7E0 });
+    Channel response_b(
+        ecu, { .transmit_id = 0x7E9, .receive_id = 0x7E1, .block_size = 2 });
+    response_a.Receive(buffer);
+    response_b.Receive(other_buffer);
+
+    // Exercise
+    request_a.Send(std::span(message).first(50));
+    request_b.Send(std::span(message).subspan(100, 40));
+    run(request_a);
+    run(request_b);
+
+    // Verify
+    REQUIRE(Status::kDone == response_a.ReceiveStatus());
+    REQUIRE(Status::kDone == response_b.ReceiveStatus());
+    CHECK(std::equal(response_a.Received().begin(),
+                     response_a.Received().end(),
+                     message.begin()));
+    CHECK(40 == response_b.Received().size());
+    CHECK(std::equal(response_b.Received().begin(),
+                     response_b.Received().end(),
+                     message.begin() + 100));
+  }
+
+  SECTION("Send() rejects invalid messages")
+  {
+    // Setup
+    std::array<uint8_t, kMaximumLength + 1> too_long{};
+    Channel request(tester, { .transmit_id = 0x7E0, .receive_id = 0x7E8 });
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(request.Send(too_long), std::errc::message_size);
+    SJ2_CHECK_EXCEPTION(request.Send(std::span<const uint8_t>()),
+                        std::errc::message_size);
+    request.Send(std::span(message).first(20));
+    SJ2_CHECK_EXCEPTION(request.Send(std::span(message).first(20)),
+                        std::errc::device_or_resource_busy);
+  }
+
+  SECTION("Frames for other IDs are not handled")
+  {
+    // Setup
+    Channel response(ecu, { .transmit_id = 0x7E8, .receive_id = 0x7E0 });
+
+    // Exercise & Verify
+    CHECK(!ecu.Handle(
+        Can::Message_t{ .id = 0x123, .length = 1, .payload = {} }));
+    CHECK(!ecu.Handle(Can::Message_t{
+        .id      = 0x7E0,
+        .length  = 1,
+        .format  = Can::Message_t::Format::kExtended,
+        .payload = {} }));
+    CHECK(ecu.Handle(
+        Can::Message_t{ .id = 0x7E0, .length = 1, .payload = {} }));
+  }
+}
+}  // namespace sjsu::isotp
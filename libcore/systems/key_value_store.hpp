@@ -0,0 +1,543 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include <libcore/module.hpp>
+#include <libcore/peripherals/storage.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/math/crc.hpp>
+
+namespace sjsu
+{
+/// Settings for the KeyValueStore.
+struct KeyValueStoreSettings_t
+{
+  /// First block of the storage used by the store.
+  uint32_t first_block = 0;
+
+  /// Number of blocks used by the store. Use 0 for every block after
+  /// `first_block`. At least 2 are needed, and more blocks spread the wear
+  /// over more of the storage.
+  uint32_t block_count = 0;
+};
+
+/// A small key/value store for configuration and counters on EEPROM, FRAM or
+/// NOR flash, which spreads writes evenly over its blocks.
+///
+/// Values are identified by a 16 bit key. Changes are collected in a block in
+/// RAM and only written by Sync(), or when that block is full, so a counter
+/// updated many times between syncs costs one entry in one block write.
+/// Writing a value that is already stored does nothing.
+///
+/// Each Sync() writes the next block of the store's area, as a ring, so every
+/// block is written equally often. The values still current in the block
+/// after the one being written are carried forward into it, so no block is
+/// overwritten while it holds current values. Each block carries a sequence
+/// number and a CRC-32C, so a block torn by a loss of power is ignored and
+/// the values it replaced are used instead.
+///
+/// Initialize() reads every block once to build an index in RAM of where the
+/// current value of each key is, so reads never scan the storage.
+///
+/// Every block is erased right before it is written, for media that need it.
+///
+/// USAGE:
+///
+///    sjsu::KeyValueStore<64> config(eeprom);
+///    config.Initialize();
+///
+///    config.Set<uint32_t>(kBootCount, config.Get<uint32_t>(kBootCount)
+///                                         .value_or(0) + 1);
+///    config.Sync();
+///
+/// @tparam kBlockSize - block size of the storage, in bytes.
+/// @tparam kMaxKeys - largest number of keys that can be stored.
+template <size_t kBlockSize = 64, size_t kMaxKeys = 32>
+class KeyValueStore : public Module<KeyValueStoreSettings_t>
+{
+ public:
+  /// Marks the blocks written by the store.
+  static constexpr uint16_t kMagic = 0x4B56;
+  /// Bytes at the start of each block.
+  static constexpr size_t kBlockHeaderSize = 12;
+  /// Bytes of each entry in addition to its value.
+  static constexpr size_t kEntryOverhead = 3;
+  /// Largest value that can be stored.
+  static constexpr size_t kMaximumValueSize =
+      std::min<size_t>(kBlockSize - kBlockHeaderSize - kEntryOverhead, 254);
+
+  static_assert(kBlockSize > kBlockHeaderSize + kEntryOverhead,
+                "KeyValueStore blocks must be larger than 15 bytes.");
+  static_assert(kBlockSize <= UINT16_MAX,
+                "KeyValueStore blocks must be smaller than 64kB.");
+
+  /// @param storage - the storage to keep the values in.
+  explicit KeyValueStore(Storage & storage) : storage_(storage) {}
+
+  /// Build the index of the values found on the storage.
+  ///
+  /// @throw sjsu::Exception - std::errc::invalid_argument if the block size
+  ///        of the storage is not kBlockSize or there are fewer than 2
+  ///        blocks.
+  void ModuleInitialize() override
+  {
+    storage_.Initialize();
+
+    if (storage_.GetBlockSize().to<size_t>() != kBlockSize)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Block size of the storage does not match the store.");
+    }
+
+    const auto kCapacity = static_cast<uint32_t>(
+        storage_.GetCapacity().to<size_t>() / kBlockSize);
+    first_block_ = settings.first_block;
+    block_count_ = settings.block_count;
+    if (block_count_ == 0 && kCapacity > first_block_)
+    {
+      block_count_ = std::min<uint32_t>(kCapacity - first_block_, UINT16_MAX);
+    }
+
+    if (block_count_ < 2)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "A KeyValueStore needs at least 2 blocks.");
+    }
+
+    Mount();
+  }
+
+  /// Store a value. The value is kept in RAM until Sync().
+  ///
+  /// @param key - the key of the value, any but 0xFFFF.
+  /// @param value - the new value.
+  /// @throw sjsu::Exception - std::errc::message_size if `value` is longer
+  ///        than kMaximumValueSize, or std::errc::not_enough_memory if
+  ///        kMaxKeys keys are already stored.
+  void Write(uint16_t key, std::span<const uint8_t> value)
+  {
+    if (value.size() > kMaximumValueSize)
+    {
+      throw Exception(std::errc::message_size,
+                      "Value is too large to fit within a block.");
+    }
+    Update(key, value, static_cast<uint8_t>(value.size()));
+  }
+
+  /// Read a value.
+  ///
+  /// @param key - the key of the value.
+  /// @param value - buffer to copy the value into, up to its size.
+  /// @return std::optional<size_t> - the length of the value, or std::nullopt
+  ///         if the key has no value.
+  std::optional<size_t> Read(uint16_t key, std::span<uint8_t> value)
+  {
+    const Index_t * entry = Find(key);
+    if (entry == nullptr || entry->length == kRemoved)
+    {
+      return std::nullopt;
+    }
+
+    const auto kStored = Load(*entry);
+    std::copy_n(kStored.begin(), std::min(kStored.size(), value.size()),
+                value.begin());
+    return kStored.size();
+  }
+
+  /// Remove the value of a key.
+  ///
+  /// @param key - the key of the value.
+  void Remove(uint16_t key)
+  {
+    if (Find(key) != nullptr)
+    {
+      Update(key, {}, kRemoved);
+    }
+  }
+
+  /// Write all changes since the last sync to the storage.
+  ///
+  /// @throw sjsu::Exception - std::errc::no_space_on_device if the current
+  ///        values no longer fit in the store.
+  void Sync()
+  {
+    uint32_t blocks_without_progress = 0;
+    while (pending_size_ != 0)
+    {
+      if (!WriteNextBlock())
+      {
+        blocks_without_progress++;
+        if (blocks_without_progress > block_count_)
+        {
+          throw Exception(std::errc::no_space_on_device,
+                          "The values do not fit in the KeyValueStore.");
+        }
+      }
+    }
+  }
+
+  /// @return true - if there are changes that have not been synced.
+  bool IsDirty() const
+  {
+    return pending_size_ != 0;
+  }
+
+  /// Store a trivially copyable object. See Write().
+  ///
+  /// @tparam T - type of the object.
+  /// @param key - the key of the value.
+  /// @param value - the object to store.
+  template <typename T>
+  void Set(uint16_t key, const T & value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable objects can be stored.");
+    Write(key,
+          std::span(reinterpret_cast<const uint8_t *>(&value), sizeof(T)));
+  }
+
+  /// Read a trivially copyable object. See Read().
+  ///
+  /// @tparam T - type of the object.
+  /// @param key - the key of the value.
+  /// @return std::optional<T> - the object, or std::nullopt if the key has no
+  ///         value of the size of T.
+  template <typename T>
+  std::optional<T> Get(uint16_t key)
+  {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable objects can be stored.");
+    T value;
+    auto length =
+        Read(key, std::span(reinterpret_cast<uint8_t *>(&value), sizeof(T)));
+    if (length != sizeof(T))
+    {
+      return std::nullopt;
+    }
+    return value;
+  }
+
+  /// @return uint32_t - number of blocks written since Initialize().
+  uint32_t GetBlockWrites() const
+  {
+    return block_writes_;
+  }
+
+ private:
+  static constexpr uint16_t kPending = UINT16_MAX;
+  static constexpr uint16_t kNoKey   = UINT16_MAX;
+  static constexpr uint8_t kRemoved  = UINT8_MAX;
+  static constexpr size_t kCapacity  = kBlockSize - kBlockHeaderSize;
+
+  /// Where the current value of a key is.
+  struct Index_t
+  {
+    uint16_t key    = kNoKey;
+    uint16_t block  = 0;
+    uint16_t offset = 0;
+    uint8_t length  = 0;
+  };
+
+  static size_t EntrySize(uint8_t length)
+  {
+    return kEntryOverhead + ((length == kRemoved) ? 0 : length);
+  }
+
+  static uint32_t Crc(std::span<const uint8_t> data)
+  {
+    return static_cast<uint32_t>(
+        crc::Engine<crc::kCrc32c>::Calculate(data));
+  }
+
+  template <typename T>
+  static T LoadField(const uint8_t * source)
+  {
+    T value;
+    std::memcpy(&value, source, sizeof(value));
+    return value;
+  }
+
+  template <typename T>
+  static void StoreField(uint8_t * destination, T value)
+  {
+    std::memcpy(destination, &value, sizeof(value));
+  }
+
+  uint32_t BlockAddress(uint16_t block) const
+  {
+    return first_block_ + block;
+  }
+
+  Index_t * Find(uint16_t key)
+  {
+    for (Index_t & entry : index_)
+    {
+      if (entry.key == key)
+      {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  Index_t & FindOrAdd(uint16_t key)
+  {
+    if (Index_t * entry = Find(key))
+    {
+      return *entry;
+    }
+    if (Index_t * entry = Find(kNoKey))
+    {
+      *entry = Index_t{ .key = key, .length = kRemoved };
+      return *entry;
+    }
+    throw Exception(std::errc::not_enough_memory,
+                    "The KeyValueStore holds the maximum number of keys.");
+  }
+
+  /// @return std::span<const uint8_t> - the stored value of an entry.
+  std::span<const uint8_t> Load(const Index_t & entry)
+  {
+    if (entry.block == kPending)
+    {
+      return std::span<const uint8_t>(
+          &pending_[entry.offset + kEntryOverhead], entry.length);
+    }
+
+    const size_t kStart = kBlockHeaderSize + entry.offset + kEntryOverhead;
+    storage_.Read(BlockAddress(entry.block),
+                  std::span<uint8_t>(scratch_.data(), kStart + entry.length));
+    return std::span<const uint8_t>(&scratch_[kStart], entry.length);
+  }
+
+  void Update(uint16_t key, std::span<const uint8_t> value, uint8_t length)
+  {
+    Index_t & entry = FindOrAdd(key);
+    if (entry.length == length && entry.block != kPending &&
+        (length == kRemoved || std::ranges::equal(Load(entry), value)))
+    {
+      return;
+    }
+
+    // Coalesce with the change already waiting for this key.
+    if (entry.block == kPending)
+    {
+      RemovePending(entry);
+    }
+
+    const size_t kSize = EntrySize(length);
+    if (kCapacity - pending_size_ < kSize)
+    {
+      Sync();
+    }
+
+    uint8_t * destination = &pending_[pending_size_];
+    StoreField<uint16_t>(destination, key);
+    destination[2] = length;
+    std::copy(value.begin(), value.end(), destination + kEntryOverhead);
+
+    entry.block  = kPending;
+    entry.offset = static_cast<uint16_t>(pending_size_);
+    entry.length = length;
+    pending_size_ += kSize;
+  }
+
+  /// Remove an entry from the pending block, moving the entries after it down.
+  void RemovePending(const Index_t & removed)
+  {
+    const size_t kSize = EntrySize(removed.length);
+    const size_t kEnd  = removed.offset + kSize;
+    std::copy(&pending_[kEnd], &pending_[pending_size_],
+              &pending_[removed.offset]);
+    pending_size_ -= kSize;
+
+    for (Index_t & entry : index_)
+    {
+      if (entry.key != kNoKey && entry.block == kPending &&
+          entry.offset > removed.offset)
+      {
+        entry.offset = static_cast<uint16_t>(entry.offset - kSize);
+      }
+    }
+  }
+
+  /// Write the next block of the ring, with as many pending entries as fit.
+  ///
+  /// The current values of the block after it are carried forward into it
+  /// first, so that when that block is overwritten by the following write,
+  /// it no longer holds any current values. A write torn by a loss of power
+  /// therefore only loses the pending entries.
+  ///
+  /// @return true - if any pending entries were written.
+  bool WriteNextBlock()
+  {
+    const auto kTarget = static_cast<uint16_t>((head_ + 1) % block_count_);
+    const auto kNext   = static_cast<uint16_t>((head_ + 2) % block_count_);
+    std::array<uint8_t, kBlockSize> block;
+    block.fill(0xFF);
+    size_t size = 0;
+
+    // The target only holds current values before the ring has been filled
+    // once in this way.
+    for (uint16_t source : { kTarget, kNext })
+    {
+      if (!ReadBlock(source))
+      {
+        continue;
+      }
+
+      ForEachEntry(scratch_, [&](uint16_t key, uint16_t offset, uint8_t) {
+        const Index_t * entry = Find(key);
+        const size_t kSize    = scratch_[kBlockHeaderSize + offset + 2];
+        const size_t kBytes   = EntrySize(static_cast<uint8_t>(kSize));
+        if (entry != nullptr && entry->block == source &&
+            entry->offset == offset && size + kBytes <= kCapacity)
+        {
+          std::copy_n(&scratch_[kBlockHeaderSize + offset],
+                      kBytes,
+                      &block[kBlockHeaderSize + size]);
+          size += kBytes;
+        }
+      });
+    }
+
+    size_t moved = 0;
+    while (moved < pending_size_)
+    {
+      const size_t kBytes = EntrySize(pending_[moved + 2]);
+      if (size + kBytes > kCapacity)
+      {
+        break;
+      }
+      std::copy_n(&pending_[moved], kBytes, &block[kBlockHeaderSize + size]);
+      size += kBytes;
+      moved += kBytes;
+    }
+
+    sequence_++;
+    StoreField<uint16_t>(&block[0], kMagic);
+    StoreField<uint16_t>(&block[2], static_cast<uint16_t>(size));
+    StoreField<uint32_t>(&block[4], sequence_);
+    StoreField<uint32_t>(&block[8], 0);
+    StoreField<uint32_t>(&block[8],
+                         Crc(std::span<const uint8_t>(
+                             block.data(), kBlockHeaderSize + size)));
+
+    storage_.Erase(BlockAddress(kTarget), 1);
+    storage_.Write(BlockAddress(kTarget), block);
+    block_writes_++;
+    head_ = kTarget;
+
+    // Every entry of the block is current, so the index points to them all.
+    ForEachEntry(block, [&](uint16_t key, uint16_t offset, uint8_t) {
+      Index_t * entry = Find(key);
+      entry->block    = kTarget;
+      entry->offset   = offset;
+    });
+
+    std::copy(&pending_[moved], &pending_[pending_size_], &pending_[0]);
+    pending_size_ -= moved;
+    for (Index_t & entry : index_)
+    {
+      if (entry.key != kNoKey && entry.block == kPending)
+      {
+        entry.offset = static_cast<uint16_t>(entry.offset - moved);
+      }
+    }
+    return moved != 0;
+  }
+
+  /// Read a block into the scratch buffer.
+  ///
+  /// @return true - if the block holds intact entries.
+  bool ReadBlock(uint16_t block)
+  {
+    storage_.Read(BlockAddress(block), scratch_);
+
+    const auto kSize = LoadField<uint16_t>(&scratch_[2]);
+    if (LoadField<uint16_t>(&scratch_[0]) != kMagic || kSize > kCapacity)
+    {
+      return false;
+    }
+
+    const auto kCrc = LoadField<uint32_t>(&scratch_[8]);
+    StoreField<uint32_t>(&scratch_[8], 0);
+    return kCrc == Crc(std::span<const uint8_t>(scratch_.data(),
+                                                kBlockHeaderSize + kSize));
+  }
+
+  /// Call `callback` with the key, offset and length of each entry of an
+  /// intact block.
+  template <typename Callback>
+  static void ForEachEntry(std::span<const uint8_t, kBlockSize> block,
+                           Callback callback)
+  {
+    const auto kSize = LoadField<uint16_t>(&block[2]);
+    size_t offset    = 0;
+    while (offset + kEntryOverhead <= kSize)
+    {
+      const uint8_t * entry = &block[kBlockHeaderSize + offset];
+      const uint8_t kLength = entry[2];
+      if (offset + EntrySize(kLength) > kSize)
+      {
+        return;
+      }
+      callback(
+          LoadField<uint16_t>(entry), static_cast<uint16_t>(offset), kLength);
+      offset += EntrySize(kLength);
+    }
+  }
+
+  void Mount()
+  {
+    index_.fill(Index_t{});
+    pending_size_ = 0;
+    sequence_     = 0;
+    head_         = static_cast<uint16_t>(block_count_ - 1);
+
+    // Find the block written last, then replay every block from the oldest.
+    for (uint16_t block = 0; block < block_count_; block++)
+    {
+      if (ReadBlock(block) && LoadField<uint32_t>(&scratch_[4]) >= sequence_)
+      {
+        sequence_ = LoadField<uint32_t>(&scratch_[4]);
+        head_     = block;
+      }
+    }
+
+    for (uint32_t i = 1; i <= block_count_; i++)
+    {
+      const auto kBlock = static_cast<uint16_t>((head_ + i) % block_count_);
+      if (!ReadBlock(kBlock))
+      {
+        continue;
+      }
+
+      ForEachEntry(scratch_, [&](uint16_t key, uint16_t offset, uint8_t size) {
+        Index_t & entry = FindOrAdd(key);
+        entry.block     = kBlock;
+        entry.offset    = offset;
+        entry.length    = size;
+      });
+    }
+  }
+
+  Storage & storage_;
+  std::array<uint8_t, kBlockSize> scratch_{};
+  std::array<uint8_t, kCapacity> pending_{};
+  std::array<Index_t, kMaxKeys> index_{};
+  size_t pending_size_   = 0;
+  uint32_t first_block_  = 0;
+  uint32_t block_count_  = 0;
+  uint32_t sequence_     = 0;
+  uint32_t block_writes_ = 0;
+  uint16_t head_         = 0;
+};
+}  // namespace sjsu
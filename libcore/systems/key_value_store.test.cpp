@@ -0,0 +1,134 @@
+#include <libcore/systems/key_value_store.hpp>
+
+#include <array>
+#include <vector>
+
+#include <libcore/testing/ram_storage.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+constexpr size_t kEepromBlockSize = 32;
+
+using TestKeyValueStore = KeyValueStore<kEepromBlockSize, 8>;
+}  // namespace
+
+TEST_CASE("Testing KeyValueStore")
+{
+  testing::RamStorage eeprom({ .type       = Storage::Type::kEeprom,
+                               .block_size = kEepromBlockSize,
+                               .blocks     = 4,
+                               .record     = true });
+  TestKeyValueStore test_subject(eeprom);
+  test_subject.Initialize();
+
+  SECTION("Values read back, before and after Sync()")
+  {
+    // Exercise
+    test_subject.Set<uint32_t>(1, 0x1234'5678);
+    auto before_sync = test_subject.Get<uint32_t>(1);
+    test_subject.Sync();
+
+    // Verify
+    CHECK(0x1234'5678 == before_sync);
+    CHECK(0x1234'5678 == test_subject.Get<uint32_t>(1));
+    CHECK(!test_subject.Get<uint32_t>(2));
+    CHECK(!test_subject.Get<uint16_t>(1));
+  }
+
+  SECTION("Changes between syncs are coalesced into one block write")
+  {
+    // Exercise
+    for (uint32_t count = 0; count < 100; count++)
+    {
+      test_subject.Set<uint32_t>(7, count);
+    }
+    test_subject.Set<uint8_t>(8, 1);
+    test_subject.Sync();
+    test_subject.Set<uint8_t>(8, 1);
+    test_subject.Sync();
+
+    // Verify
+    CHECK(1 == test_subject.GetBlockWrites());
+    CHECK(!test_subject.IsDirty());
+    CHECK(99 == test_subject.Get<uint32_t>(7));
+  }
+
+  SECTION("Syncs rotate through the blocks and keep every value")
+  {
+    // Setup
+    test_subject.Set<uint16_t>(1, 0xAAAA);
+    test_subject.Set<uint16_t>(2, 0xBBBB);
+
+    // Exercise
+    for (uint16_t count = 0; count < 40; count++)
+    {
+      test_subject.Set<uint16_t>(3, count);
+      test_subject.Sync();
+    }
+    TestKeyValueStore remounted(eeprom);
+    remounted.Initialize();
+
+    // Verify
+    for (uint32_t block = 0; block < 4; block++)
+    {
+      CHECK(10 == eeprom.Count('w', block));
+    }
+    CHECK(0xAAAA == remounted.Get<uint16_t>(1));
+    CHECK(0xBBBB == remounted.Get<uint16_t>(2));
+    CHECK(39 == remounted.Get<uint16_t>(3));
+  }
+
+  SECTION("A torn block write falls back to the previous values")
+  {
+    // Setup
+    test_subject.Set<uint16_t>(1, 100);
+    test_subject.Sync();
+    test_subject.Set<uint16_t>(1, 200);
+    test_subject.Sync();
+    // Damage the block written last.
+    constexpr size_t kLastBlock = 1 * kEepromBlockSize;
+    eeprom.memory[kLastBlock + TestKeyValueStore::kBlockHeaderSize] ^= 0xFF;
+
+    // Exercise
+    TestKeyValueStore remounted(eeprom);
+    remounted.Initialize();
+
+    // Verify
+    CHECK(100 == remounted.Get<uint16_t>(1));
+  }
+
+  SECTION("Removed values stay removed after remounting")
+  {
+    // Setup
+    test_subject.Set<uint16_t>(1, 100);
+    test_subject.Sync();
+
+    // Exercise
+    test_subject.Remove(1);
+    test_subject.Sync();
+    TestKeyValueStore remounted(eeprom);
+    remounted.Initialize();
+
+    // Verify
+    CHECK(!test_subject.Get<uint16_t>(1));
+    CHECK(!remounted.Get<uint16_t>(1));
+  }
+
+  SECTION("Values larger than a block and too many keys throw")
+  {
+    // Setup
+    std::array<uint8_t, TestKeyValueStore::kMaximumValueSize + 1> value{};
+    for (uint16_t key = 0; key < 8; key++)
+    {
+      test_subject.Set<uint8_t>(key, 0);
+    }
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.Write(100, value), sjsu::Exception);
+    CHECK_THROWS_AS(test_subject.Set<uint8_t>(100, 0), sjsu::Exception);
+  }
+}
+}  // namespace sjsu
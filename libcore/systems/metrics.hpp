@@ -0,0 +1,379 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include <libcore/devices/internet_socket.hpp>
+#include <libcore/peripherals/uart.hpp>
+
+namespace sjsu::metrics
+{
+/// Kind of a metric, as written by Serialize().
+enum class Kind : uint8_t
+{
+  kCounter   = 1,
+  kGauge     = 2,
+  kHistogram = 3,
+};
+
+/// A count that only goes up, such as the number of CAN frames dropped.
+///
+/// Every metric is updated with relaxed atomics, so it can be updated from any
+/// context, including interrupts, for the cost of a single atomic operation.
+/// Metrics have constexpr constructors, so they can be declared constinit and
+/// need no initialization at startup. Requires lock-free 32-bit atomics, which
+/// excludes ARMv6-M (Cortex-M0/M0+) targets.
+class Counter
+{
+ public:
+  constexpr Counter() = default;
+
+  Counter(const Counter &) = delete;
+  Counter & operator=(const Counter &) = delete;
+
+  /// @param amount - amount to add to the count.
+  void Add(uint32_t amount = 1)
+  {
+    value_.fetch_add(amount, std::memory_order_relaxed);
+  }
+
+  /// @return uint32_t - the count, which wraps around at 2^32.
+  uint32_t Value() const
+  {
+    return value_.load(std::memory_order_relaxed);
+  }
+
+  /// Set the count back to 0.
+  void Reset()
+  {
+    value_.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<uint32_t> value_ = 0;
+};
+
+/// A value that goes up and down, such as the depth of a queue. See Counter.
+class Gauge
+{
+ public:
+  constexpr Gauge() = default;
+
+  Gauge(const Gauge &) = delete;
+  Gauge & operator=(const Gauge &) = delete;
+
+  /// @param value - new value of the gauge.
+  void Set(int32_t value)
+  {
+    value_.store(value, std::memory_order_relaxed);
+  }
+
+  /// @param amount - amount to add to the gauge, negative to subtract.
+  void Add(int32_t amount)
+  {
+    value_.fetch_add(amount, std::memory_order_relaxed);
+  }
+
+  /// @return int32_t - the value of the gauge.
+  int32_t Value() const
+  {
+    return value_.load(std::memory_order_relaxed);
+  }
+
+  /// Set the gauge back to 0.
+  void Reset()
+  {
+    Set(0);
+  }
+
+ private:
+  std::atomic<int32_t> value_ = 0;
+};
+
+/// Counts of values, such as transaction latencies, in fixed buckets. See
+/// Counter.
+///
+/// Bucket `i` counts the values that are at most `upper_bounds[i]` and above
+/// the previous bound. One more bucket, after the last bound, counts the
+/// values above every bound.
+///
+/// @tparam kBounds - number of upper bounds.
+template <size_t kBounds>
+class Histogram
+{
+ public:
+  /// Number of buckets, including the one for values above every bound.
+  static constexpr size_t kBuckets = kBounds + 1;
+
+  /// @param upper_bounds - upper bound of each bucket, in increasing order.
+  constexpr explicit Histogram(
+      const std::array<uint32_t, kBounds> & upper_bounds)
+      : upper_bounds_(upper_bounds)
+  {
+  }
+
+  Histogram(const Histogram &) = delete;
+  Histogram & operator=(const Histogram &) = delete;
+
+  /// @param value - value to count in its bucket.
+  void Record(uint32_t value)
+  {
+    const auto kBucket =
+        std::lower_bound(upper_bounds_.begin(), upper_bounds_.end(), value) -
+        upper_bounds_.begin();
+    counts_[kBucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// @return const std::array<uint32_t, kBounds>& - the bucket bounds.
+  constexpr const std::array<uint32_t, kBounds> & UpperBounds() const
+  {
+    return upper_bounds_;
+  }
+
+  /// @return std::span<std::atomic<uint32_t>> - the count of each bucket.
+  constexpr std::span<std::atomic<uint32_t>, kBuckets> Counts()
+  {
+    return counts_;
+  }
+
+  /// Set every count back to 0.
+  void Reset()
+  {
+    for (auto & count : counts_)
+    {
+      count.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::array<uint32_t, kBounds> upper_bounds_;
+  std::array<std::atomic<uint32_t>, kBuckets> counts_{};
+};
+
+/// Entry of a metrics table, naming a metric.
+///
+/// A program lists all of its metrics in a single constexpr array of
+/// Metric_t, which the compiler lays out in flash as a contiguous table, so
+/// nothing is registered at runtime:
+///
+///    constinit sjsu::metrics::Counter can_frames_dropped;
+///    constinit sjsu::metrics::Gauge tx_queue_depth;
+///    constinit sjsu::metrics::Histogram<4> i2c_latency_us({
+///        10, 100, 1000, 10000 });
+///
+///    constexpr std::array kMetrics = {
+///      sjsu::metrics::Metric_t("can.frames_dropped", can_frames_dropped),
+///      sjsu::metrics::Metric_t("can.tx_queue_depth", tx_queue_depth),
+///      sjsu::metrics::Metric_t("i2c.latency_us", i2c_latency_us),
+///    };
+///
+///    // On request from the dashboard:
+///    sjsu::metrics::Send(kMetrics, uart);
+struct Metric_t
+{
+  /// @param metric_name - name of the metric.
+  /// @param counter - the metric, with static storage duration.
+  constexpr Metric_t(std::string_view metric_name, Counter & counter)
+      : name(metric_name), id(Hash(metric_name)), kind(Kind::kCounter),
+        counter(&counter)
+  {
+  }
+
+  /// @param metric_name - name of the metric.
+  /// @param gauge - the metric, with static storage duration.
+  constexpr Metric_t(std::string_view metric_name, Gauge & gauge)
+      : name(metric_name), id(Hash(metric_name)), kind(Kind::kGauge),
+        gauge(&gauge)
+  {
+  }
+
+  /// @param metric_name - name of the metric.
+  /// @param histogram - the metric, with static storage duration.
+  template <size_t kBounds>
+  constexpr Metric_t(std::string_view metric_name,
+                     Histogram<kBounds> & histogram)
+      : name(metric_name), id(Hash(metric_name)), kind(Kind::kHistogram),
+        buckets(histogram.Counts())
+  {
+  }
+
+  /// 32-bit FNV-1a hash of a metric name, the same hash as
+  /// log::BinaryFormat_t uses for format strings.
+  ///
+  /// @param metric_name - name to hash.
+  /// @return constexpr uint32_t - the ID of the metric.
+  static constexpr uint32_t Hash(std::string_view metric_name)
+  {
+    uint32_t hash = 0x811C'9DC5;
+    for (char character : metric_name)
+    {
+      hash = (hash ^ static_cast<uint8_t>(character)) * 0x0100'0193;
+    }
+    return hash;
+  }
+
+  /// Set the metric back to 0.
+  void Reset() const
+  {
+    switch (kind)
+    {
+      case Kind::kCounter: counter->Reset(); break;
+      case Kind::kGauge: gauge->Reset(); break;
+      case Kind::kHistogram:
+        for (auto & count : buckets)
+        {
+          count.store(0, std::memory_order_relaxed);
+        }
+        break;
+    }
+  }
+
+  /// Name of the metric.
+  std::string_view name;
+  /// ID that identifies the metric in serialized form, the hash of its name.
+  uint32_t id;
+  /// Kind of the metric.
+  Kind kind;
+  /// The metric when `kind` is Kind::kCounter.
+  Counter * counter = nullptr;
+  /// The metric when `kind` is Kind::kGauge.
+  Gauge * gauge = nullptr;
+  /// The bucket counts of the metric when `kind` is Kind::kHistogram.
+  std::span<std::atomic<uint32_t>> buckets = {};
+};
+
+/// First bytes of the serialized form.
+inline constexpr std::array<uint8_t, 4> kMagic = { 'S', 'J', 'M', 1 };
+
+/// Write the value of every metric in a compact binary form, made of
+/// unsigned LEB128 variable length integers ("varints"), so that small values
+/// take a single byte:
+///
+///    kMagic, varint number of metrics, then for each metric:
+///      uint8_t kind, uint32_t id (little endian), then its value:
+///        Counter:   varint count
+///        Gauge:     varint of the zigzag encoded value
+///        Histogram: varint number of buckets, then a varint count for each
+///
+/// Names and bucket bounds are not sent; the reader looks them up by ID from
+/// the program's metrics table.
+///
+/// @param metrics - the program's metrics table.
+/// @param writer - callable with the signature
+///        `void(std::span<const uint8_t> chunk)`, called with chunks of up to
+///        64 bytes.
+/// @return size_t - number of bytes passed to the writer.
+template <typename Writer>
+size_t Serialize(std::span<const Metric_t> metrics, Writer && writer)
+{
+  std::array<uint8_t, 64> chunk;
+  size_t length = 0;
+  size_t total  = 0;
+
+  // Every field is at most 5 bytes, so flush when a field might not fit.
+  auto put = [&](auto && encode) {
+    if (length + 5 > chunk.size())
+    {
+      writer(std::span<const uint8_t>(chunk.data(), length));
+      total += length;
+      length = 0;
+    }
+    encode();
+  };
+
+  auto varint = [&](uint32_t value) {
+    put([&]() {
+      do
+      {
+        const uint8_t kLow = value & 0x7F;
+        value >>= 7;
+        chunk[length++] = static_cast<uint8_t>(kLow | (value ? 0x80 : 0x00));
+      } while (value != 0);
+    });
+  };
+
+  put([&]() {
+    std::copy(kMagic.begin(), kMagic.end(), &chunk[length]);
+    length += kMagic.size();
+  });
+  varint(static_cast<uint32_t>(metrics.size()));
+
+  for (const auto & metric : metrics)
+  {
+    put([&]() { chunk[length++] = static_cast<uint8_t>(metric.kind); });
+    put([&]() {
+      for (size_t i = 0; i < sizeof(metric.id); i++)
+      {
+        chunk[length++] = static_cast<uint8_t>(metric.id >> (i * 8));
+      }
+    });
+
+    switch (metric.kind)
+    {
+      case Kind::kCounter: varint(metric.counter->Value()); break;
+      case Kind::kGauge:
+      {
+        const int32_t kValue = metric.gauge->Value();
+        varint((static_cast<uint32_t>(kValue) << 1) ^
+               static_cast<uint32_t>(kValue >> 31));
+        break;
+      }
+      case Kind::kHistogram:
+        varint(static_cast<uint32_t>(metric.buckets.size()));
+        for (const auto & count : metric.buckets)
+        {
+          varint(count.load(std::memory_order_relaxed));
+        }
+        break;
+    }
+  }
+
+  writer(std::span<const uint8_t>(chunk.data(), length));
+  return total + length;
+}
+
+/// Serialize the metrics over a UART.
+///
+/// @param metrics - the program's metrics table.
+/// @param uart - port to write to.
+/// @return size_t - number of bytes written.
+inline size_t Send(std::span<const Metric_t> metrics, Uart & uart)
+{
+  return Serialize(metrics, [&uart](std::span<const uint8_t> chunk) {
+    uart.Write(chunk);
+  });
+}
+
+/// Serialize the metrics over a connected socket.
+///
+/// @param metrics - the program's metrics table.
+/// @param socket - connected socket to write to.
+/// @param timeout - time allowed for each chunk to be written.
+/// @return size_t - number of bytes written.
+inline size_t Send(std::span<const Metric_t> metrics,
+                   InternetSocket & socket,
+                   std::chrono::nanoseconds timeout)
+{
+  return Serialize(metrics,
+                   [&socket, timeout](std::span<const uint8_t> chunk) {
+                     socket.Write(chunk, timeout);
+                   });
+}
+
+/// Set every metric in the table back to 0.
+///
+/// @param metrics - the program's metrics table.
+inline void Reset(std::span<const Metric_t> metrics)
+{
+  for (const auto & metric : metrics)
+  {
+    metric.Reset();
+  }
+}
+}  // namespace sjsu::metrics
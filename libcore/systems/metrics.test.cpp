@@ -0,0 +1,115 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/systems/metrics.hpp>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace sjsu
+{
+namespace
+{
+constinit metrics::Counter frames_dropped;
+constinit metrics::Gauge queue_depth;
+constinit metrics::Histogram<3> latency({ 10, 100, 1000 });
+
+constexpr std::array kMetrics = {
+  metrics::Metric_t("can.frames_dropped", frames_dropped),
+  metrics::Metric_t("can.queue_depth", queue_depth),
+  metrics::Metric_t("i2c.latency_us", latency),
+};
+}  // namespace
+
+TEST_CASE("Testing metrics")
+{
+  metrics::Reset(kMetrics);
+
+  SECTION("Metrics are updated in place")
+  {
+    // Exercise
+    frames_dropped.Add();
+    frames_dropped.Add(2);
+    queue_depth.Set(5);
+    queue_depth.Add(-7);
+    latency.Record(0);
+    latency.Record(10);
+    latency.Record(11);
+    latency.Record(5000);
+
+    // Verify
+    CHECK(3 == frames_dropped.Value());
+    CHECK(-2 == queue_depth.Value());
+    CHECK(2 == latency.Counts()[0]);
+    CHECK(1 == latency.Counts()[1]);
+    CHECK(0 == latency.Counts()[2]);
+    CHECK(1 == latency.Counts()[3]);
+  }
+
+  SECTION("Table entries identify their metric")
+  {
+    // Verify
+    static_assert(kMetrics[0].id ==
+                  metrics::Metric_t::Hash("can.frames_dropped"));
+    CHECK(metrics::Kind::kHistogram == kMetrics[2].kind);
+    CHECK(4 == kMetrics[2].buckets.size());
+  }
+
+  SECTION("Serialize() writes varints")
+  {
+    // Setup
+    frames_dropped.Add(300);
+    queue_depth.Set(-2);
+    latency.Record(50);
+    std::vector<uint8_t> bytes;
+
+    // Exercise
+    size_t length = metrics::Serialize(
+        kMetrics, [&bytes](std::span<const uint8_t> chunk) {
+          bytes.insert(bytes.end(), chunk.begin(), chunk.end());
+        });
+
+    // Verify
+    const uint32_t kId = kMetrics[0].id;
+    const std::vector<uint8_t> kCounter = {
+      1,
+      static_cast<uint8_t>(kId),
+      static_cast<uint8_t>(kId >> 8),
+      static_cast<uint8_t>(kId >> 16),
+      static_cast<uint8_t>(kId >> 24),
+      0xAC,
+      0x02,
+    };
+
+    REQUIRE(bytes.size() == length);
+    // Magic, count, counter, gauge (kind, ID, 1 byte), histogram (kind, ID,
+    // bucket count and 4 counts).
+    CHECK(4 + 1 + 7 + 6 + 10 == length);
+    CHECK(std::vector<uint8_t>{ 'S', 'J', 'M', 1, 3 } ==
+          std::vector<uint8_t>(bytes.begin(), bytes.begin() + 5));
+    CHECK(kCounter == std::vector<uint8_t>(bytes.begin() + 5,
+                                           bytes.begin() + 12));
+    CHECK(3 == bytes[17]);
+    CHECK(3 == bytes[18]);
+    CHECK(std::vector<uint8_t>{ 4, 0, 1, 0, 0 } ==
+          std::vector<uint8_t>(bytes.begin() + 23, bytes.end()));
+  }
+
+  SECTION("Serialize() splits output into chunks")
+  {
+    // Setup
+    std::vector<metrics::Metric_t> many(20, kMetrics[0]);
+    std::vector<size_t> chunks;
+
+    // Exercise
+    size_t length = metrics::Serialize(
+        many, [&chunks](std::span<const uint8_t> chunk) {
+          chunks.push_back(chunk.size());
+        });
+
+    // Verify
+    CHECK(4 + 1 + 20 * 6 == length);
+    CHECK(1 < chunks.size());
+    CHECK(64 >= *std::max_element(chunks.begin(), chunks.end()));
+  }
+}
+}  // namespace sjsu
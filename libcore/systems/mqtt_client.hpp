@@ -0,0 +1,769 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+#include <libcore/devices/internet_socket.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu::mqtt
+{
+/// Type of an MQTT control packet, the high nibble of its first byte.
+enum class PacketType : uint8_t
+{
+  kConnect      = 1,
+  kConnAck      = 2,
+  kPublish      = 3,
+  kPubAck       = 4,
+  kPingRequest  = 12,
+  kPingResponse = 13,
+  kDisconnect   = 14,
+};
+
+/// Delivery guarantee of a published message.
+enum class QoS : uint8_t
+{
+  /// Sent once, and lost if the connection is lost.
+  kAtMostOnce = 0,
+  /// Kept and sent again until the broker acknowledges it.
+  kAtLeastOnce = 1,
+};
+
+/// Most bytes the remaining length field of a packet takes.
+inline constexpr size_t kMaximumLengthBytes = 4;
+
+/// Longest remaining length of a packet.
+inline constexpr uint32_t kMaximumLength = 268'435'455;
+
+/// Encode the remaining length field of a packet, 7 bits per byte with the
+/// low bits first.
+///
+/// @param length - remaining length, at most kMaximumLength.
+/// @param output - where to write the field.
+/// @return constexpr size_t - number of bytes written.
+constexpr size_t EncodeLength(uint32_t length,
+                              std::span<uint8_t, kMaximumLengthBytes> output)
+{
+  size_t count = 0;
+  do
+  {
+    uint8_t digit = static_cast<uint8_t>(length & 0x7F);
+    length >>= 7;
+    if (length != 0)
+    {
+      digit |= 0x80;
+    }
+    output[count++] = digit;
+  } while (length != 0 && count < kMaximumLengthBytes);
+  return count;
+}
+
+/// Broker and session of a Client.
+struct ClientSettings_t
+{
+  /// Address of the broker.
+  std::string_view host = "";
+  /// TCP port of the broker.
+  uint16_t port = 1883;
+  /// Identifies the session with the broker.
+  std::string_view client_id = "";
+  /// User name, empty for none.
+  std::string_view username = "";
+  /// Password, only sent with a user name.
+  std::string_view password = "";
+  /// Longest time between packets, after which a ping is sent. Also the
+  /// longest time to wait for the broker's answer to a ping. 0 disables
+  /// pings.
+  std::chrono::seconds keep_alive = std::chrono::seconds(60);
+  /// Ask the broker to discard the session of a previous connection.
+  bool clean_session = false;
+  /// Time to connect, to wait for CONNACK, and for each write.
+  std::chrono::nanoseconds timeout = std::chrono::seconds(5);
+};
+
+/// An MQTT 3.1.1 client that publishes over an InternetSocket without
+/// waiting for each acknowledgment, using only static memory.
+///
+/// QoS 1 messages are pipelined. Up to kWindow messages are sent without
+/// waiting for their PUBACK. Each one is copied once into the retry ring,
+/// and the packet is written from there. The fixed header goes in a small
+/// array, and the ring entry is passed to the socket's vectored Write(), so
+/// no packet is assembled in a separate buffer. A message stays in the ring
+/// until it is acknowledged. If the connection is lost, the next Connect()
+/// sends the unacknowledged messages again with the DUP flag, in order.
+///
+/// QoS 0 messages are not kept. Their topic and payload are written
+/// straight from the caller's buffers.
+///
+/// The client only publishes. Packets from the broker other than CONNACK,
+/// PUBACK and PINGRESP are skipped. All methods must be called from one
+/// context.
+///
+/// USAGE:
+///
+///    sjsu::mqtt::Client<8, 1024> client(socket, {
+///      .host      = "broker.local",
+///      .client_id = "sensor-17",
+///    });
+///    client.Connect();
+///
+///    while (true)
+///    {
+///      if (!client.IsConnected())
+///      {
+///        client.Connect();
+///      }
+///      client.Publish("sensor-17/temperature", Encode(temperature));
+///      client.Process();
+///      Delay(100ms);
+///    }
+///
+/// @tparam kWindow - most QoS 1 messages kept until acknowledged.
+/// @tparam kRetryBytes - size of the retry ring. Each message takes 4 bytes
+///         plus its topic and payload.
+template <size_t kWindow, size_t kRetryBytes>
+class Client
+{
+ public:
+  static_assert(kWindow > 0, "The window must hold at least one message.");
+  static_assert(kRetryBytes <= kMaximumLength,
+                "The retry ring must not be longer than a packet.");
+
+  /// @param socket - socket to the broker.
+  /// @param settings - broker and session. The strings must outlive the
+  ///        client.
+  Client(InternetSocket & socket, const ClientSettings_t & settings)
+      : socket_(socket), settings_(settings)
+  {
+  }
+
+  Client(const Client &) = delete;
+  Client & operator=(const Client &) = delete;
+
+  /// Connect to the broker, wait for it to accept the connection, then send
+  /// the messages that have not been acknowledged. Does nothing if already
+  /// connected.
+  ///
+  /// @throw sjsu::Exception - std::errc::connection_refused if the socket
+  ///        could not connect or the broker refused the connection,
+  ///        std::errc::timed_out if the broker did not answer, or
+  ///        std::errc::invalid_argument if a string is longer than 65535
+  ///        bytes.
+  void Connect()
+  {
+    if (connected_)
+    {
+      return;
+    }
+
+    parser_          = {};
+    connack_         = std::nullopt;
+    ping_sent_       = false;
+    const bool kOpen = socket_.Connect(InternetSocket::Protocol::kTCP,
+                                       settings_.host,
+                                       settings_.port,
+                                       settings_.timeout);
+    if (!kOpen)
+    {
+      throw Exception(std::errc::connection_refused,
+                      "Could not connect to the MQTT broker.");
+    }
+
+    connected_ = true;
+    SendConnect();
+
+    const auto kDeadline = Uptime() + settings_.timeout;
+    while (connected_ && !connack_)
+    {
+      const auto kNow = Uptime();
+      if (kNow >= kDeadline)
+      {
+        Lost();
+        throw Exception(std::errc::timed_out,
+                        "The MQTT broker did not answer CONNECT.");
+      }
+      std::array<uint8_t, kReceiveChunk> buffer;
+      const size_t kCount = socket_.Read(buffer, kDeadline - kNow);
+      Parse(std::span(buffer).first(kCount));
+    }
+
+    if (!connack_ || *connack_ != 0)
+    {
+      Lost();
+      throw Exception(std::errc::connection_refused,
+                      "The MQTT broker refused the connection.");
+    }
+
+    Flush();
+  }
+
+  /// @return true - if connected to the broker, as of the last call.
+  bool IsConnected() const
+  {
+    return connected_;
+  }
+
+  /// Publish a message.
+  ///
+  /// A QoS 1 message is copied into the retry ring, then sent at once if
+  /// connected. Otherwise it is sent by the next Connect().
+  ///
+  /// @param topic - topic to publish to.
+  /// @param payload - content of the message.
+  /// @param qos - delivery guarantee.
+  /// @return true - if the message was sent or, for QoS 1, kept to send.
+  /// @return false - if a QoS 0 message was dropped because the client is
+  ///         not connected, or a QoS 1 message was dropped because the
+  ///         window or the retry ring is full. Call Process() to handle
+  ///         acknowledgments, then try again.
+  /// @throw sjsu::Exception - std::errc::message_size if the message could
+  ///        never fit, std::errc::invalid_argument if the topic is longer
+  ///        than 65535 bytes, or the error of the socket if writing failed,
+  ///        in which case the client is disconnected and a QoS 1 message is
+  ///        kept.
+  bool Publish(std::string_view topic,
+               std::span<const uint8_t> payload,
+               QoS qos = QoS::kAtLeastOnce)
+  {
+    const auto kTopicLength = Encode16(topic.size());
+    if (qos == QoS::kAtMostOnce)
+    {
+      return PublishAtMostOnce(kTopicLength, topic, payload);
+    }
+
+    const size_t kLength = 2 + topic.size() + 2 + payload.size();
+    if (kLength > kRetryBytes)
+    {
+      throw Exception(std::errc::message_size,
+                      "MQTT message is longer than the retry ring.");
+    }
+    if (count_ == kWindow)
+    {
+      return false;
+    }
+    const std::optional<size_t> kOffset = Allocate(kLength);
+    if (!kOffset)
+    {
+      return false;
+    }
+
+    const auto kPacketId = Encode16(NextPacketId());
+    uint8_t * entry      = retry_.data() + *kOffset;
+    entry = std::copy(kTopicLength.begin(), kTopicLength.end(), entry);
+    entry = std::copy(topic.begin(), topic.end(), entry);
+    entry = std::copy(kPacketId.begin(), kPacketId.end(), entry);
+    std::copy(payload.begin(), payload.end(), entry);
+
+    entries_[(head_ + count_) % kWindow] = {
+      .packet_id    = packet_id_,
+      .offset       = *kOffset,
+      .length       = kLength,
+      .sent         = false,
+      .duplicate    = false,
+      .acknowledged = false,
+    };
+    count_++;
+
+    Flush();
+    return true;
+  }
+
+  /// Publish a message with a text payload. See Publish().
+  bool Publish(std::string_view topic,
+               std::string_view payload,
+               QoS qos = QoS::kAtLeastOnce)
+  {
+    return Publish(topic, AsBytes(payload), qos);
+  }
+
+  /// Handle what the broker has sent, send messages that have not been
+  /// sent, and keep the connection alive. Call this often, without waiting
+  /// for anything in particular.
+  ///
+  /// @throw sjsu::Exception - the error of the socket if writing failed, in
+  ///        which case the client is disconnected.
+  void Process()
+  {
+    if (!connected_)
+    {
+      return;
+    }
+    if (!socket_.IsConnected())
+    {
+      Lost();
+      return;
+    }
+
+    Receive();
+    Flush();
+    KeepAlive();
+  }
+
+  /// Tell the broker the client is leaving, then close the socket. Messages
+  /// that have not been acknowledged are kept for the next Connect().
+  void Disconnect()
+  {
+    if (!connected_)
+    {
+      return;
+    }
+    static constexpr std::array<uint8_t, 2> kDisconnect = {
+      Header(PacketType::kDisconnect),
+      0,
+    };
+    const std::span<const uint8_t> kBuffers[] = { kDisconnect };
+    WriteBuffers(kBuffers);
+    Lost();
+  }
+
+  /// @return size_t - number of QoS 1 messages that have not been
+  ///         acknowledged, including those not yet sent.
+  size_t Unacknowledged() const
+  {
+    size_t unacknowledged = 0;
+    ForEachEntry([&unacknowledged](const Entry_t & entry) {
+      unacknowledged += !entry.acknowledged;
+    });
+    return unacknowledged;
+  }
+
+  /// @return size_t - number of QoS 1 messages sent on this connection and
+  ///         waiting for their PUBACK.
+  size_t InFlight() const
+  {
+    size_t in_flight = 0;
+    ForEachEntry([&in_flight](const Entry_t & entry) {
+      in_flight += entry.sent && !entry.acknowledged;
+    });
+    return in_flight;
+  }
+
+ private:
+  static constexpr size_t kReceiveChunk = 32;
+
+  /// A QoS 1 message in the retry ring. Its bytes are the variable header
+  /// and payload of its PUBLISH packet.
+  struct Entry_t
+  {
+    uint16_t packet_id;
+    size_t offset;
+    size_t length;
+    /// Sent on the current connection.
+    bool sent;
+    /// Sent on an earlier connection, so sent again with the DUP flag.
+    bool duplicate;
+    bool acknowledged;
+  };
+
+  /// Incoming packet being parsed. Only the first two bytes after the fixed
+  /// header are kept, which is all of the packets the client handles.
+  struct Parser_t
+  {
+    enum class State : uint8_t
+    {
+      kType,
+      kLength,
+      kBody,
+    };
+
+    State state         = State::kType;
+    uint8_t type        = 0;
+    uint32_t remaining  = 0;
+    uint8_t length_size = 0;
+    std::array<uint8_t, 2> body{};
+    uint8_t body_size = 0;
+  };
+
+  static constexpr uint8_t Header(PacketType type, uint8_t flags = 0)
+  {
+    return static_cast<uint8_t>((static_cast<uint8_t>(type) << 4) | flags);
+  }
+
+  /// Write the first byte and remaining length of a fixed header.
+  ///
+  /// @return size_t - length of the fixed header.
+  static size_t FixedHeader(uint8_t first,
+                            size_t length,
+                            std::span<uint8_t> header)
+  {
+    header[0] = first;
+    return 1 + EncodeLength(static_cast<uint32_t>(length),
+                            header.subspan<1, kMaximumLengthBytes>());
+  }
+
+  static std::array<uint8_t, 2> Encode16(size_t value)
+  {
+    if (value > 0xFFFF)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "MQTT strings are at most 65535 bytes.");
+    }
+    return { static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value) };
+  }
+
+  static std::span<const uint8_t> AsBytes(std::string_view text)
+  {
+    return { reinterpret_cast<const uint8_t *>(text.data()), text.size() };
+  }
+
+  template <typename Function>
+  void ForEachEntry(Function function) const
+  {
+    for (size_t i = 0; i < count_; i++)
+    {
+      function(entries_[(head_ + i) % kWindow]);
+    }
+  }
+
+  uint16_t NextPacketId()
+  {
+    // Packet ID 0 is not allowed.
+    if (++packet_id_ == 0)
+    {
+      packet_id_ = 1;
+    }
+    return packet_id_;
+  }
+
+  /// Find a contiguous region of the retry ring after the newest entry.
+  std::optional<size_t> Allocate(size_t length) const
+  {
+    if (count_ == 0)
+    {
+      return 0;
+    }
+
+    const Entry_t & oldest = entries_[head_];
+    const Entry_t & newest = entries_[(head_ + count_ - 1) % kWindow];
+    const size_t kEnd      = newest.offset + newest.length;
+    if (newest.offset >= oldest.offset)
+    {
+      if (kRetryBytes - kEnd >= length)
+      {
+        return kEnd;
+      }
+      if (oldest.offset >= length)
+      {
+        return 0;
+      }
+      return std::nullopt;
+    }
+    if (oldest.offset - kEnd >= length)
+    {
+      return kEnd;
+    }
+    return std::nullopt;
+  }
+
+  void WriteBuffers(std::span<const std::span<const uint8_t>> buffers)
+  {
+    try
+    {
+      socket_.Write(buffers, settings_.timeout);
+    }
+    catch (...)
+    {
+      Lost();
+      throw;
+    }
+    last_sent_ = Uptime();
+  }
+
+  bool PublishAtMostOnce(const std::array<uint8_t, 2> & topic_length,
+                         std::string_view topic,
+                         std::span<const uint8_t> payload)
+  {
+    const size_t kLength = 2 + topic.size() + payload.size();
+    if (kLength > kMaximumLength)
+    {
+      throw Exception(std::errc::message_size,
+                      "MQTT message is longer than a packet.");
+    }
+    if (!connected_)
+    {
+      return false;
+    }
+
+    std::array<uint8_t, 1 + kMaximumLengthBytes + 2> header;
+    size_t size = FixedHeader(Header(PacketType::kPublish), kLength, header);
+    header[size++] = topic_length[0];
+    header[size++] = topic_length[1];
+
+    const std::span<const uint8_t> kBuffers[] = {
+      std::span(header).first(size),
+      AsBytes(topic),
+      payload,
+    };
+    WriteBuffers(kBuffers);
+    return true;
+  }
+
+  void SendConnect()
+  {
+    const bool kHasUsername = !settings_.username.empty();
+    const bool kHasPassword = kHasUsername && !settings_.password.empty();
+
+    const auto kClientIdLength = Encode16(settings_.client_id.size());
+    const auto kUsernameLength = Encode16(settings_.username.size());
+    const auto kPasswordLength = Encode16(settings_.password.size());
+    const auto kKeepAlive      = Encode16(
+        static_cast<size_t>(settings_.keep_alive.count()));
+
+    size_t length = 10 + 2 + settings_.client_id.size();
+    if (kHasUsername)
+    {
+      length += 2 + settings_.username.size();
+    }
+    if (kHasPassword)
+    {
+      length += 2 + settings_.password.size();
+    }
+
+    uint8_t flags = settings_.clean_session ? 0x02 : 0x00;
+    flags |= kHasUsername ? 0x80 : 0x00;
+    flags |= kHasPassword ? 0x40 : 0x00;
+
+    std::array<uint8_t, 1 + kMaximumLengthBytes + 12> header;
+    size_t size = FixedHeader(Header(PacketType::kConnect), length, header);
+    for (uint8_t byte : { uint8_t{ 0 },
+                          uint8_t{ 4 },
+                          uint8_t{ 'M' },
+                          uint8_t{ 'Q' },
+                          uint8_t{ 'T' },
+                          uint8_t{ 'T' },
+                          uint8_t{ 4 },
+                          flags,
+                          kKeepAlive[0],
+                          kKeepAlive[1],
+                          kClientIdLength[0],
+                          kClientIdLength[1] })
+    {
+      header[size++] = byte;
+    }
+
+    std::array<std::span<const uint8_t>, 6> buffers = {
+      std::span<const uint8_t>(header).first(size),
+      AsBytes(settings_.client_id),
+    };
+    size_t count = 2;
+    if (kHasUsername)
+    {
+      buffers[count++] = kUsernameLength;
+      buffers[count++] = AsBytes(settings_.username);
+    }
+    if (kHasPassword)
+    {
+      buffers[count++] = kPasswordLength;
+      buffers[count++] = AsBytes(settings_.password);
+    }
+    WriteBuffers(std::span(buffers).first(count));
+  }
+
+  void SendEntry(Entry_t & entry)
+  {
+    // QoS 1, with the DUP flag for messages sent on an earlier connection.
+    const uint8_t kFlags = 0x02 | (entry.duplicate ? 0x08 : 0x00);
+
+    std::array<uint8_t, 1 + kMaximumLengthBytes> header;
+    const size_t kSize =
+        FixedHeader(Header(PacketType::kPublish, kFlags), entry.length, header);
+
+    const std::span<const uint8_t> kBuffers[] = {
+      std::span(header).first(kSize),
+      std::span<const uint8_t>(retry_).subspan(entry.offset, entry.length),
+    };
+    WriteBuffers(kBuffers);
+    entry.sent = true;
+  }
+
+  /// Send every entry that has not been sent on this connection, in order.
+  void Flush()
+  {
+    for (size_t i = 0; i < count_ && connected_; i++)
+    {
+      Entry_t & entry = entries_[(head_ + i) % kWindow];
+      if (!entry.sent && !entry.acknowledged)
+      {
+        SendEntry(entry);
+      }
+    }
+  }
+
+  void Receive()
+  {
+    while (connected_)
+    {
+      std::span<const uint8_t> received = socket_.PeekReceived();
+      if (!received.empty())
+      {
+        Parse(received);
+        socket_.ConsumeReceived(received.size());
+        continue;
+      }
+
+      std::array<uint8_t, kReceiveChunk> buffer;
+      const size_t kCount = socket_.Receive(buffer);
+      if (kCount == 0)
+      {
+        break;
+      }
+      Parse(std::span(buffer).first(kCount));
+    }
+  }
+
+  void Parse(std::span<const uint8_t> data)
+  {
+    using State = typename Parser_t::State;
+    for (uint8_t byte : data)
+    {
+      switch (parser_.state)
+      {
+        case State::kType:
+          parser_ = { .state = State::kLength, .type = byte };
+          break;
+        case State::kLength:
+          parser_.remaining |= static_cast<uint32_t>(byte & 0x7F)
+                               << (7 * parser_.length_size++);
+          if (byte & 0x80)
+          {
+            if (parser_.length_size == kMaximumLengthBytes)
+            {
+              Lost();
+              throw Exception(std::errc::bad_message,
+                              "Malformed MQTT packet length.");
+            }
+          }
+          else if (parser_.remaining == 0)
+          {
+            Handle();
+          }
+          else
+          {
+            parser_.state = State::kBody;
+          }
+          break;
+        case State::kBody:
+          if (parser_.body_size < parser_.body.size())
+          {
+            parser_.body[parser_.body_size++] = byte;
+          }
+          if (--parser_.remaining == 0)
+          {
+            Handle();
+          }
+          break;
+      }
+    }
+  }
+
+  /// Handle a whole packet from the broker.
+  void Handle()
+  {
+    const auto kType  = static_cast<PacketType>(parser_.type >> 4);
+    const auto & body = parser_.body;
+    switch (kType)
+    {
+      case PacketType::kConnAck:
+        connack_ = body[1];
+        break;
+      case PacketType::kPubAck:
+        Acknowledge(static_cast<uint16_t>((body[0] << 8) | body[1]));
+        break;
+      case PacketType::kPingResponse:
+        ping_sent_ = false;
+        break;
+      default:
+        break;
+    }
+    parser_ = {};
+  }
+
+  void Acknowledge(uint16_t packet_id)
+  {
+    for (size_t i = 0; i < count_; i++)
+    {
+      Entry_t & entry = entries_[(head_ + i) % kWindow];
+      if (entry.packet_id == packet_id && entry.sent)
+      {
+        entry.acknowledged = true;
+        break;
+      }
+    }
+
+    // Free the ring from the oldest entry, which brokers acknowledge first.
+    while (count_ > 0 && entries_[head_].acknowledged)
+    {
+      head_ = (head_ + 1) % kWindow;
+      count_--;
+    }
+  }
+
+  void KeepAlive()
+  {
+    if (!connected_ || settings_.keep_alive.count() == 0)
+    {
+      return;
+    }
+
+    const auto kNow = Uptime();
+    if (ping_sent_)
+    {
+      if (kNow - ping_time_ >= settings_.keep_alive)
+      {
+        Lost();
+      }
+      return;
+    }
+    if (kNow - last_sent_ >= settings_.keep_alive)
+    {
+      static constexpr std::array<uint8_t, 2> kPingRequest = {
+        Header(PacketType::kPingRequest),
+        0,
+      };
+      const std::span<const uint8_t> kBuffers[] = { kPingRequest };
+      WriteBuffers(kBuffers);
+      ping_sent_ = true;
+      ping_time_ = kNow;
+    }
+  }
+
+  /// Close the socket. Messages sent on this connection that have not been
+  /// acknowledged are sent again on the next.
+  void Lost()
+  {
+    connected_ = false;
+    socket_.Close();
+    for (size_t i = 0; i < count_; i++)
+    {
+      Entry_t & entry = entries_[(head_ + i) % kWindow];
+      if (entry.sent)
+      {
+        entry.sent      = false;
+        entry.duplicate = true;
+      }
+    }
+  }
+
+  InternetSocket & socket_;
+  ClientSettings_t settings_;
+  bool connected_ = false;
+  std::optional<uint8_t> connack_;
+  Parser_t parser_;
+  std::chrono::nanoseconds last_sent_ = std::chrono::nanoseconds(0);
+  std::chrono::nanoseconds ping_time_ = std::chrono::nanoseconds(0);
+  bool ping_sent_                     = false;
+  uint16_t packet_id_                 = 0;
+  std::array<Entry_t, kWindow> entries_{};
+  size_t head_  = 0;
+  size_t count_ = 0;
+  std::array<uint8_t, kRetryBytes> retry_{};
+};
+}  // namespace sjsu::mqtt
@@ -0,0 +1,382 @@
+#include <libcore/systems/mqtt_client.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::mqtt
+{
+namespace
+{
+std::chrono::nanoseconds mqtt_test_uptime = 0ns;
+
+/// Socket to a simulated broker. Records the bytes written and the buffers
+/// of the last vectored write, and returns the bytes queued by the test.
+class BrokerSocket : public InternetSocket
+{
+ public:
+  void ModuleInitialize() override {}
+
+  bool Connect(Protocol, std::string_view, uint16_t,
+               std::chrono::nanoseconds) override
+  {
+    open = true;
+    if (answer_connect)
+    {
+      Queue({ 0x20, 0x02, 0x00, connack_code });
+    }
+    return true;
+  }
+
+  void Write(std::span<const uint8_t> data, std::chrono::nanoseconds) override
+  {
+    sent.insert(sent.end(), data.begin(), data.end());
+  }
+
+  void Write(std::span<const std::span<const uint8_t>> buffers,
+             std::chrono::nanoseconds timeout) override
+  {
+    buffer_counts.push_back(buffers.size());
+    last_buffers.assign(buffers.begin(), buffers.end());
+    InternetSocket::Write(buffers, timeout);
+  }
+
+  /// Waits for the whole timeout if nothing has been received.
+  size_t Read(std::span<uint8_t> buffer,
+              std::chrono::nanoseconds timeout) override
+  {
+    if (received.empty())
+    {
+      mqtt_test_uptime += timeout;
+      return 0;
+    }
+    return Receive(buffer);
+  }
+
+  size_t Receive(std::span<uint8_t> buffer) override
+  {
+    const size_t kCount = std::min(buffer.size(), received.size());
+    std::copy_n(received.begin(), kCount, buffer.begin());
+    received.erase(received.begin(), received.begin() + kCount);
+    return kCount;
+  }
+
+  void Close() override
+  {
+    open = false;
+  }
+
+  bool IsConnected() override
+  {
+    return open;
+  }
+
+  void Queue(std::initializer_list<uint8_t> bytes)
+  {
+    received.insert(received.end(), bytes);
+  }
+
+  std::vector<uint8_t> TakeSent()
+  {
+    std::vector<uint8_t> taken;
+    taken.swap(sent);
+    buffer_counts.clear();
+    return taken;
+  }
+
+  bool open            = false;
+  bool answer_connect  = true;
+  uint8_t connack_code = 0;
+  std::vector<uint8_t> sent;
+  std::vector<uint8_t> received;
+  std::vector<size_t> buffer_counts;
+  std::vector<std::span<const uint8_t>> last_buffers;
+};
+
+/// Bytes of a short PUBLISH packet.
+std::vector<uint8_t> PublishPacket(uint8_t first,
+                                   std::string_view topic,
+                                   uint16_t packet_id,
+                                   std::string_view payload)
+{
+  const bool kHasId = (first & 0x06) != 0;
+  std::vector<uint8_t> packet = {
+    first,
+    static_cast<uint8_t>(2 + topic.size() + (kHasId ? 2 : 0) +
+                         payload.size()),
+    0,
+    static_cast<uint8_t>(topic.size()),
+  };
+  packet.insert(packet.end(), topic.begin(), topic.end());
+  if (kHasId)
+  {
+    packet.push_back(static_cast<uint8_t>(packet_id >> 8));
+    packet.push_back(static_cast<uint8_t>(packet_id));
+  }
+  packet.insert(packet.end(), payload.begin(), payload.end());
+  return packet;
+}
+
+std::vector<uint8_t> Concatenate(
+    std::initializer_list<std::vector<uint8_t>> packets)
+{
+  std::vector<uint8_t> bytes;
+  for (const auto & packet : packets)
+  {
+    bytes.insert(bytes.end(), packet.begin(), packet.end());
+  }
+  return bytes;
+}
+}  // namespace
+
+TEST_CASE("Testing mqtt::EncodeLength()")
+{
+  auto encode = [](uint32_t length) {
+    std::array<uint8_t, kMaximumLengthBytes> field{};
+    const size_t kSize = EncodeLength(length, field);
+    return std::vector<uint8_t>(field.begin(), field.begin() + kSize);
+  };
+
+  // Exercise & Verify
+  CHECK(std::vector<uint8_t>{ 0x00 } == encode(0));
+  CHECK(std::vector<uint8_t>{ 0x7F } == encode(127));
+  CHECK(std::vector<uint8_t>{ 0x80, 0x01 } == encode(128));
+  CHECK(std::vector<uint8_t>{ 0xFF, 0x7F } == encode(16'383));
+  CHECK(std::vector<uint8_t>{ 0x80, 0x80, 0x01 } == encode(16'384));
+  CHECK(std::vector<uint8_t>{ 0xFF, 0xFF, 0xFF, 0x7F } ==
+        encode(kMaximumLength));
+}
+
+TEST_CASE("Testing mqtt::Client")
+{
+  SetUptimeFunction([]() { return mqtt_test_uptime; });
+  mqtt_test_uptime = 0ns;
+  BrokerSocket socket;
+  ClientSettings_t settings = {
+    .host       = "broker.local",
+    .client_id  = "dev",
+    .keep_alive = std::chrono::seconds(0),
+  };
+
+  SECTION("Connect() sends CONNECT and waits for CONNACK")
+  {
+    // Setup
+    settings.username      = "u";
+    settings.password      = "p";
+    settings.keep_alive    = std::chrono::seconds(30);
+    settings.clean_session = true;
+    Client<4, 64> client(socket, settings);
+
+    // Exercise
+    client.Connect();
+
+    // Verify
+    CHECK(client.IsConnected());
+    CHECK(std::vector<uint8_t>{ 0x10, 21,  0,   4,   'M', 'Q', 'T', 'T',
+                                4,    0xC2, 0,  30,  0,   3,   'd', 'e',
+                                'v',  0,    1,  'u', 0,   1,   'p' } ==
+          socket.sent);
+    CHECK(std::vector<size_t>{ 6 } == socket.buffer_counts);
+  }
+
+  SECTION("Connect() throws if the broker refuses or does not answer")
+  {
+    // Setup
+    Client<4, 64> client(socket, settings);
+
+    // Exercise & Verify
+    socket.connack_code = 5;
+    SJ2_CHECK_EXCEPTION(client.Connect(), std::errc::connection_refused);
+    CHECK(!client.IsConnected());
+    CHECK(!socket.open);
+
+    socket.answer_connect = false;
+    SJ2_CHECK_EXCEPTION(client.Connect(), std::errc::timed_out);
+    CHECK(!client.IsConnected());
+    CHECK(settings.timeout <= mqtt_test_uptime);
+  }
+
+  SECTION("QoS 1 messages are pipelined up to the window")
+  {
+    // Setup
+    Client<3, 64> client(socket, settings);
+    client.Connect();
+    socket.TakeSent();
+
+    // Exercise
+    const bool kFirst  = client.Publish("t", "a");
+    const bool kSecond = client.Publish("t", "b");
+    const bool kThird  = client.Publish("t", "c");
+    const bool kFourth = client.Publish("t", "d");
+
+    // Verify
+    CHECK(kFirst);
+    CHECK(kSecond);
+    CHECK(kThird);
+    CHECK(!kFourth);
+    CHECK(3 == client.InFlight());
+    CHECK(Concatenate({
+              PublishPacket(0x32, "t", 1, "a"),
+              PublishPacket(0x32, "t", 2, "b"),
+              PublishPacket(0x32, "t", 3, "c"),
+          }) == socket.sent);
+    // Each packet is a fixed header and a retry ring entry.
+    CHECK(std::vector<size_t>{ 2, 2, 2 } == socket.buffer_counts);
+
+    // Exercise
+    socket.TakeSent();
+    socket.Queue({ 0x40, 0x02, 0x00, 0x02 });
+    client.Process();
+
+    // Verify
+    CHECK(2 == client.Unacknowledged());
+    CHECK(!client.Publish("t", "d"));
+
+    // Exercise
+    socket.Queue({ 0x40, 0x02, 0x00, 0x01 });
+    client.Process();
+
+    // Verify
+    CHECK(1 == client.Unacknowledged());
+    CHECK(1 == client.InFlight());
+    CHECK(client.Publish("t", "d"));
+    CHECK(PublishPacket(0x32, "t", 4, "d") == socket.sent);
+  }
+
+  SECTION("QoS 0 messages are written from the caller's buffers")
+  {
+    // Setup
+    Client<2, 32> client(socket, settings);
+    constexpr std::string_view kTopic     = "sensor/t";
+    const std::array<uint8_t, 2> kPayload = { 'o', 'k' };
+
+    // Exercise
+    const bool kDisconnected =
+        client.Publish(kTopic, kPayload, QoS::kAtMostOnce);
+    client.Connect();
+    socket.TakeSent();
+    const bool kConnected = client.Publish(kTopic, kPayload, QoS::kAtMostOnce);
+
+    // Verify
+    CHECK(!kDisconnected);
+    CHECK(kConnected);
+    CHECK(0 == client.Unacknowledged());
+    CHECK(PublishPacket(0x30, kTopic, 0, "ok") == socket.sent);
+    REQUIRE(3 == socket.last_buffers.size());
+    CHECK(reinterpret_cast<const uint8_t *>(kTopic.data()) ==
+          socket.last_buffers[1].data());
+    CHECK(kPayload.data() == socket.last_buffers[2].data());
+  }
+
+  SECTION("Unacknowledged messages are sent again after reconnecting")
+  {
+    // Setup
+    Client<4, 64> client(socket, settings);
+    client.Connect();
+    client.Publish("t", "a");
+    client.Publish("t", "b");
+    socket.Queue({ 0x40, 0x02, 0x00, 0x01 });
+    client.Process();
+
+    // Exercise
+    socket.open = false;
+    client.Process();
+    const bool kConnectedAfterLoss = client.IsConnected();
+    client.Publish("t", "c");
+    socket.TakeSent();
+    client.Connect();
+
+    // Verify
+    CHECK(!kConnectedAfterLoss);
+    const std::vector<uint8_t> kExpected = Concatenate({
+      PublishPacket(0x3A, "t", 2, "b"),
+      PublishPacket(0x32, "t", 3, "c"),
+    });
+    const std::vector<uint8_t> kSent = socket.TakeSent();
+    REQUIRE(kExpected.size() <= kSent.size());
+    // The messages follow CONNECT.
+    CHECK(kExpected == std::vector<uint8_t>(
+                           kSent.end() - kExpected.size(), kSent.end()));
+    CHECK(2 == client.InFlight());
+  }
+
+  SECTION("Disconnect() keeps unacknowledged messages")
+  {
+    // Setup
+    Client<4, 64> client(socket, settings);
+    client.Connect();
+    client.Publish("t", "a");
+    socket.TakeSent();
+
+    // Exercise
+    client.Disconnect();
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0xE0, 0x00 } == socket.sent);
+    CHECK(!client.IsConnected());
+    CHECK(!socket.open);
+    CHECK(1 == client.Unacknowledged());
+    CHECK(0 == client.InFlight());
+  }
+
+  SECTION("The retry ring bounds the messages kept")
+  {
+    // Setup
+    Client<4, 16> client(socket, settings);
+    const std::array<uint8_t, 4> kPayload   = {};
+    const std::array<uint8_t, 13> kTooLarge = {};
+
+    // Exercise & Verify
+    CHECK(client.Publish("t", kPayload));
+    CHECK(!client.Publish("t", kPayload));
+    SJ2_CHECK_EXCEPTION(client.Publish("t", kTooLarge),
+                        std::errc::message_size);
+
+    // Exercise
+    client.Connect();
+    socket.Queue({ 0x40, 0x02, 0x00, 0x01 });
+    client.Process();
+
+    // Verify
+    CHECK(0 == client.Unacknowledged());
+    CHECK(client.Publish("t", kPayload));
+  }
+
+  SECTION("Process() pings the broker and drops a silent connection")
+  {
+    // Setup
+    settings.keep_alive = std::chrono::seconds(1);
+    Client<2, 32> client(socket, settings);
+    client.Connect();
+    socket.TakeSent();
+
+    // Exercise
+    mqtt_test_uptime += 1s;
+    client.Process();
+    const std::vector<uint8_t> kFirstPing = socket.TakeSent();
+    socket.Queue({ 0xD0, 0x00 });
+    mqtt_test_uptime += 500ms;
+    client.Process();
+    const bool kAnswered = client.IsConnected();
+    mqtt_test_uptime += 1s;
+    client.Process();
+    const std::vector<uint8_t> kSecondPing = socket.TakeSent();
+    mqtt_test_uptime += 1s;
+    client.Process();
+
+    // Verify
+    CHECK(std::vector<uint8_t>{ 0xC0, 0x00 } == kFirstPing);
+    CHECK(kAnswered);
+    CHECK(std::vector<uint8_t>{ 0xC0, 0x00 } == kSecondPing);
+    CHECK(!client.IsConnected());
+  }
+
+  SetUptimeFunction(DefaultUptime);
+}
+}  // namespace sjsu::mqtt
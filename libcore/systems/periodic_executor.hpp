@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <utility>
+
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/inplace_function.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Runs fixed rate tasks, such as a 1kHz control loop, 100Hz sensor reads and
+/// 10Hz telemetry, from a single dispatch point, in place of hand written
+/// tick counters.
+///
+/// Tasks are ordered rate monotonically: the task with the shortest period
+/// runs first whenever several are due, and tasks with the same period run in
+/// order of their priority. Dispatch() runs every task that is due, in that
+/// order, and can be called from the SystemTimer callback or from the main
+/// loop. Tasks run to completion; a task is never preempted by another task of
+/// the same executor, and a Dispatch() that interrupts a running Dispatch()
+/// returns without doing anything.
+///
+/// Each task keeps timing statistics, measured with Uptime() as StopWatch
+/// does:
+///
+///  - jitter, the delay from when the task was due to when it started,
+///  - execution time, from when it started to when it returned,
+///  - overruns, the number of times a task finished after its next release,
+///    its deadline, plus the number of releases skipped because of it.
+///
+/// USAGE:
+///
+///    sjsu::PeriodicExecutor<4> executor;
+///    auto control   = executor.AddTask("control", 1ms, [] { Control(); });
+///    auto sensors   = executor.AddTask("sensors", 10ms, [] { Sample(); });
+///    auto telemetry = executor.AddTask("telemetry", 100ms, [] { Send(); });
+///
+///    system_timer.settings.callback = [&executor]() { executor.Dispatch(); };
+///    system_timer.Initialize();
+///
+///    // Later, in a diagnostics command:
+///    auto stats = executor.GetStatistics(control);
+///
+/// @tparam kCapacity - maximum number of tasks.
+template <size_t kCapacity>
+class PeriodicExecutor
+{
+ public:
+  /// Function run by a task.
+  using TaskFunction = InplaceFunction<void(void)>;
+
+  /// Identifies a task of the executor, returned by AddTask().
+  struct TaskId_t
+  {
+    /// Index of the task in the order it was added.
+    size_t index;
+  };
+
+  /// Timing statistics of a task.
+  struct Statistics_t
+  {
+    /// Number of times the task has run.
+    uint32_t runs = 0;
+    /// Number of deadlines missed, see PeriodicExecutor.
+    uint32_t overruns = 0;
+    /// Longest delay from when the task was due to when it started.
+    std::chrono::nanoseconds max_jitter = 0ns;
+    /// Duration of the latest run.
+    std::chrono::nanoseconds last_execution = 0ns;
+    /// Longest duration of a run.
+    std::chrono::nanoseconds max_execution = 0ns;
+  };
+
+  PeriodicExecutor() = default;
+  PeriodicExecutor(const PeriodicExecutor &) = delete;
+  PeriodicExecutor & operator=(const PeriodicExecutor &) = delete;
+
+  /// Add a task. Its first release is the next Dispatch().
+  ///
+  /// @param name - name of the task, with static storage duration.
+  /// @param period - time between releases of the task.
+  /// @param function - function to run.
+  /// @param priority - breaks ties between tasks with the same period, the
+  ///        higher priority running first.
+  /// @return TaskId_t - identifier of the task.
+  /// @throw std::errc::invalid_argument - if the period is not positive.
+  /// @throw std::errc::not_enough_memory - if there are already kCapacity
+  ///        tasks.
+  TaskId_t AddTask(const char * name,
+                   std::chrono::nanoseconds period,
+                   TaskFunction function,
+                   int priority = 0)
+  {
+    if (period <= 0ns)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Task period must be positive.");
+    }
+    if (count_ == kCapacity)
+    {
+      throw Exception(std::errc::not_enough_memory,
+                      "PeriodicExecutor has no room for another task.");
+    }
+
+    const size_t kIndex = count_++;
+    tasks_[kIndex]      = Task_t{
+      .name         = name,
+      .period       = period,
+      .priority     = priority,
+      .next_release = Uptime(),
+      .function     = std::move(function),
+    };
+
+    // Keep the dispatch order sorted by period, then by priority. Tasks are
+    // added at startup, so a simple insertion is enough.
+    size_t position = kIndex;
+    while (position > 0 && RunsBefore(kIndex, order_[position - 1]))
+    {
+      order_[position] = order_[position - 1];
+      position--;
+    }
+    order_[position] = kIndex;
+
+    return TaskId_t{ .index = kIndex };
+  }
+
+  /// Run every task that is due, shortest period first.
+  ///
+  /// @return size_t - number of tasks run.
+  size_t Dispatch()
+  {
+    if (dispatching_.exchange(true, std::memory_order_acquire))
+    {
+      return 0;
+    }
+
+    size_t runs = 0;
+    for (size_t i = 0; i < count_; i++)
+    {
+      Task_t & task   = tasks_[order_[i]];
+      const auto kNow = Uptime();
+      if (kNow < task.next_release)
+      {
+        continue;
+      }
+
+      const auto kRelease = task.next_release;
+      task.function();
+      const auto kEnd = Uptime();
+      runs++;
+
+      auto & statistics = task.statistics;
+      statistics.runs++;
+      statistics.max_jitter     = std::max(statistics.max_jitter,
+                                       kNow - kRelease);
+      statistics.last_execution = kEnd - kNow;
+      statistics.max_execution  = std::max(statistics.max_execution,
+                                          statistics.last_execution);
+
+      // The deadline is the next release. Releases that have already passed
+      // are skipped rather than run back to back, and count as overruns.
+      task.next_release = kRelease + task.period;
+      if (kEnd > task.next_release)
+      {
+        const auto kLate = (kEnd - task.next_release) / task.period;
+        statistics.overruns += static_cast<uint32_t>(1 + kLate);
+        task.next_release += (kLate + 1) * task.period;
+      }
+    }
+
+    dispatching_.store(false, std::memory_order_release);
+    return runs;
+  }
+
+  /// @return std::chrono::nanoseconds - uptime of the next release of any
+  ///         task, for a main loop that sleeps between dispatches, or the
+  ///         maximum duration if there are no tasks.
+  std::chrono::nanoseconds NextRelease() const
+  {
+    auto next = std::chrono::nanoseconds::max();
+    for (size_t i = 0; i < count_; i++)
+    {
+      next = std::min(next, tasks_[i].next_release);
+    }
+    return next;
+  }
+
+  /// @param task - task returned by AddTask().
+  /// @return const Statistics_t& - timing statistics of the task.
+  const Statistics_t & GetStatistics(TaskId_t task) const
+  {
+    return tasks_[task.index].statistics;
+  }
+
+  /// @param task - task returned by AddTask().
+  /// @return const char* - name of the task.
+  const char * GetName(TaskId_t task) const
+  {
+    return tasks_[task.index].name;
+  }
+
+  /// Forget the statistics of every task, for example after startup.
+  void ResetStatistics()
+  {
+    for (size_t i = 0; i < count_; i++)
+    {
+      tasks_[i].statistics = {};
+    }
+  }
+
+  /// @return float - fraction of the processor used by the tasks when each
+  ///         one takes its longest measured execution time. Above about 0.69
+  ///         for many tasks, rate monotonic ordering can no longer guarantee
+  ///         every deadline.
+  float Utilization() const
+  {
+    float utilization = 0;
+    for (size_t i = 0; i < count_; i++)
+    {
+      utilization +=
+          static_cast<float>(tasks_[i].statistics.max_execution.count()) /
+          static_cast<float>(tasks_[i].period.count());
+    }
+    return utilization;
+  }
+
+  /// @return size_t - number of tasks added.
+  size_t Size() const
+  {
+    return count_;
+  }
+
+ private:
+  struct Task_t
+  {
+    const char * name                     = "";
+    std::chrono::nanoseconds period       = 0ns;
+    int priority                          = 0;
+    std::chrono::nanoseconds next_release = 0ns;
+    TaskFunction function                 = nullptr;
+    Statistics_t statistics               = {};
+  };
+
+  /// @return true - if task `a` runs before task `b` when both are due.
+  bool RunsBefore(size_t a, size_t b) const
+  {
+    if (tasks_[a].period != tasks_[b].period)
+    {
+      return tasks_[a].period < tasks_[b].period;
+    }
+    return tasks_[a].priority > tasks_[b].priority;
+  }
+
+  std::array<Task_t, kCapacity> tasks_;
+  std::array<size_t, kCapacity> order_ = {};
+  size_t count_                        = 0;
+  std::atomic<bool> dispatching_       = false;
+};
+}  // namespace sjsu
@@ -0,0 +1,134 @@
+#include <libcore/systems/periodic_executor.hpp>
+
+#include <algorithm>
+#include <string>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing PeriodicExecutor")
+{
+  VirtualClock clock;
+  clock.Start();
+  PeriodicExecutor<4> executor;
+  std::string runs;
+
+  /// Task that records its name and takes `duration` to run.
+  auto task = [&runs, &clock](char name, std::chrono::nanoseconds duration) {
+    return [&runs, &clock, name, duration]() {
+      runs += name;
+      clock.Advance(duration);
+    };
+  };
+
+  SECTION("Tasks run at their own rates")
+  {
+    // Setup
+    executor.AddTask("fast", 1ms, task('f', 0ns));
+    executor.AddTask("slow", 10ms, task('s', 0ns));
+
+    // Exercise
+    for (int tick = 0; tick < 20; tick++)
+    {
+      executor.Dispatch();
+      clock.Advance(1ms);
+    }
+
+    // Verify
+    CHECK(20 == std::count(runs.begin(), runs.end(), 'f'));
+    CHECK(2 == std::count(runs.begin(), runs.end(), 's'));
+  }
+
+  SECTION("Due tasks run shortest period first, then by priority")
+  {
+    // Setup
+    executor.AddTask("telemetry", 100ms, task('t', 0ns));
+    executor.AddTask("low", 10ms, task('l', 0ns), 1);
+    executor.AddTask("control", 1ms, task('c', 0ns));
+    executor.AddTask("high", 10ms, task('h', 0ns), 2);
+
+    // Exercise
+    const size_t kRuns = executor.Dispatch();
+
+    // Verify
+    CHECK(4 == kRuns);
+    CHECK("chlt" == runs);
+  }
+
+  SECTION("Jitter and execution time are recorded")
+  {
+    // Setup
+    auto first  = executor.AddTask("first", 5ms, task('a', 300us));
+    auto second = executor.AddTask("second", 10ms, task('b', 1ms));
+
+    // Exercise
+    executor.Dispatch();
+    clock.Advance(4ms);
+    executor.Dispatch();
+
+    // Verify
+    const auto & kFirst  = executor.GetStatistics(first);
+    const auto & kSecond = executor.GetStatistics(second);
+    CHECK(2 == kFirst.runs);
+    CHECK(300us == kFirst.last_execution);
+    CHECK(300us == kFirst.max_jitter);
+    CHECK(1 == kSecond.runs);
+    CHECK(1ms == kSecond.max_execution);
+    CHECK(300us == kSecond.max_jitter);
+    CHECK(0 == kFirst.overruns + kSecond.overruns);
+    CHECK(doctest::Approx(0.16f) == executor.Utilization());
+  }
+
+  SECTION("Overruns are counted and missed releases skipped")
+  {
+    // Setup
+    auto slow = executor.AddTask("slow", 2ms, task('s', 0ns));
+    executor.Dispatch();
+    auto stuck = executor.AddTask("stuck", 2ms, task('x', 5'500us));
+
+    // Exercise
+    clock.Advance(2ms);
+    executor.Dispatch();
+
+    // Verify
+    // "stuck" was released at 0ms and ran from 2ms to 7.5ms, missing its
+    // deadline at 2ms and the releases at 4ms and 6ms.
+    CHECK("ssx" == runs);
+    CHECK(3 == executor.GetStatistics(stuck).overruns);
+    CHECK(2ms == executor.GetStatistics(stuck).max_jitter);
+    CHECK(0 == executor.GetStatistics(slow).overruns);
+    CHECK(4ms == executor.NextRelease());
+  }
+
+  SECTION("A dispatch from within a task does nothing")
+  {
+    // Setup
+    size_t nested = 1;
+    executor.AddTask("outer", 1ms, [&executor, &nested]() {
+      nested = executor.Dispatch();
+    });
+
+    // Exercise & Verify
+    CHECK(1 == executor.Dispatch());
+    CHECK(0 == nested);
+  }
+
+  SECTION("Invalid tasks are rejected")
+  {
+    // Setup
+    for (int i = 0; i < 4; i++)
+    {
+      executor.AddTask("task", 1ms, task('t', 0ns));
+    }
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(executor.AddTask("task", 1ms, task('t', 0ns)),
+                        std::errc::not_enough_memory);
+    SJ2_CHECK_EXCEPTION(PeriodicExecutor<1>().AddTask("zero", 0ns, nullptr),
+                        std::errc::invalid_argument);
+    CHECK(4 == executor.Size());
+  }
+}
+}  // namespace sjsu
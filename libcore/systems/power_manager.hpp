@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include <libcore/module.hpp>
+#include <libcore/peripherals/system_controller.hpp>
+#include <libcore/platform/constants.hpp>
+#include <libcore/utility/inplace_function.hpp>
+#include <libcore/utility/time/tickless.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Powers down modules that have been idle for a while and puts the processor
+/// into the deepest sleep mode the modules still powered up allow.
+///
+/// Each managed module is wrapped in a PowerManager::Managed, through which
+/// the application reaches the module with Use(). Update(), usually called by
+/// Sleep() from the main loop, powers down every module that has not been
+/// used for its idle timeout, along with its peripheral in the
+/// SystemController. The next Use() powers the peripheral up and initializes
+/// the module again with its CurrentSettings().
+///
+/// USAGE:
+///
+///    sjsu::PowerManager power([](sjsu::PowerManager::SleepMode mode) {
+///      // Set the platform's sleep depth from `mode`, then:
+///      sjsu::WaitForInterrupt();
+///    });
+///
+///    sjsu::PowerManager::Managed managed_uart(power, uart, {
+///      .idle_timeout  = 50ms,
+///      .deepest_sleep = sjsu::PowerManager::SleepMode::kSleep,
+///      .peripheral    = kUart3,  // ResourceID of the UART's peripheral
+///    });
+///
+///    while (true)
+///    {
+///      if (button.Read())
+///      {
+///        managed_uart.Use().Write(message);
+///      }
+///      power.Sleep();
+///    }
+class PowerManager
+{
+ public:
+  /// Processor sleep modes, from lightest to deepest. Deeper modes save more
+  /// power but stop more of the chip, and take longer to wake from.
+  enum class SleepMode : uint8_t
+  {
+    /// The processor must not sleep.
+    kNone = 0,
+    /// The CPU clock stops. Peripherals keep running and any interrupt wakes
+    /// the processor.
+    kSleep,
+    /// Peripheral clocks stop as well. RAM and register contents are
+    /// retained, and only a few wake up sources remain.
+    kDeepSleep,
+    /// Most of the chip is powered off. Only wake up pins and the real time
+    /// clock can wake the processor.
+    kPowerDown,
+  };
+
+  /// Function that puts the processor into a sleep mode until it is woken.
+  using EnterSleep = InplaceFunction<void(SleepMode)>;
+
+  /// How a managed module is powered.
+  struct Requirements_t
+  {
+    /// Time without a call to Use() after which the module is powered down.
+    std::chrono::nanoseconds idle_timeout = std::chrono::milliseconds(10);
+    /// Deepest sleep mode the module can work through while powered up.
+    SleepMode deepest_sleep = SleepMode::kSleep;
+    /// Peripheral to power down in the SystemController along with the
+    /// module, if any.
+    std::optional<ResourceID> peripheral = std::nullopt;
+  };
+
+  /// Module registered with a PowerManager. See Managed.
+  class Client
+  {
+   public:
+    Client(const Client &) = delete;
+    Client & operator=(const Client &) = delete;
+
+    /// @return const Requirements_t & - how the module is powered.
+    const Requirements_t & GetRequirements() const
+    {
+      return requirements_;
+    }
+
+   protected:
+    /// @param manager - manager to register with.
+    /// @param requirements - how the module is powered.
+    Client(PowerManager & manager, const Requirements_t & requirements)
+        : manager_(manager), requirements_(requirements)
+    {
+      next_             = manager_.clients_;
+      manager_.clients_ = this;
+    }
+
+    virtual ~Client()
+    {
+      for (Client ** client = &manager_.clients_; *client != nullptr;
+           client           = &(*client)->next_)
+      {
+        if (*client == this)
+        {
+          *client = next_;
+          break;
+        }
+      }
+    }
+
+    /// @return true - if the module is initialized.
+    virtual bool IsPoweredUp() const = 0;
+    /// Power down the module.
+    virtual void PowerDownModule() = 0;
+
+    /// Record that the module is being used now.
+    void Touch()
+    {
+      last_used_ = Uptime();
+    }
+
+    /// @return SystemController & - the controller gating peripherals.
+    SystemController & GetSystemController()
+    {
+      return manager_.system_controller_
+                 ? *manager_.system_controller_
+                 : SystemController::GetPlatformController();
+    }
+
+   private:
+    friend class PowerManager;
+
+    PowerManager & manager_;
+    Requirements_t requirements_;
+    std::chrono::nanoseconds last_used_ = std::chrono::nanoseconds(0);
+    Client * next_                      = nullptr;
+  };
+
+  /// A module whose power is managed by a PowerManager.
+  ///
+  /// @tparam ModuleType - a class deriving from Module.
+  template <class ModuleType>
+  class Managed : public Client
+  {
+   public:
+    /// @param manager - manager to register with.
+    /// @param module - module to manage. Must outlive this object.
+    /// @param requirements - how the module is powered.
+    Managed(PowerManager & manager,
+            ModuleType & module,
+            const Requirements_t & requirements)
+        : Client(manager, requirements), module_(module)
+    {
+    }
+
+    /// Manage `module` with the default Requirements_t.
+    ///
+    /// @param manager - manager to register with.
+    /// @param module - module to manage. Must outlive this object.
+    Managed(PowerManager & manager, ModuleType & module)
+        : Managed(manager, module, Requirements_t{})
+    {
+    }
+
+    /// Power up and initialize the module if it was powered down, and restart
+    /// its idle timeout.
+    ///
+    /// A module that was powered down is initialized with the settings of its
+    /// last Initialize(), its CurrentSettings(). A module that has never been
+    /// initialized is initialized with its `settings`.
+    ///
+    /// @return ModuleType & - the module, ready to use.
+    ModuleType & Use()
+    {
+      if (module_.GetState() != State::kInitialized)
+      {
+        if (GetRequirements().peripheral)
+        {
+          GetSystemController().PowerUpPeripheral(
+              *GetRequirements().peripheral);
+        }
+
+        if constexpr (requires { module_.CurrentSettings(); })
+        {
+          if (module_.GetState() == State::kPowerDown)
+          {
+            module_.settings = module_.CurrentSettings();
+          }
+        }
+
+        module_.Initialize();
+      }
+
+      Touch();
+      return module_;
+    }
+
+   protected:
+    bool IsPoweredUp() const override
+    {
+      return module_.GetState() == State::kInitialized;
+    }
+
+    void PowerDownModule() override
+    {
+      module_.PowerDown();
+
+      if (GetRequirements().peripheral)
+      {
+        GetSystemController().PowerDownPeripheral(
+            *GetRequirements().peripheral);
+      }
+    }
+
+   private:
+    ModuleType & module_;
+  };
+
+  /// @param enter_sleep - puts the processor into a sleep mode. Defaults to
+  ///        waiting for an interrupt in the processor's default sleep mode.
+  /// @param system_controller - controller that gates peripherals. Defaults
+  ///        to the platform's controller.
+  explicit PowerManager(
+      EnterSleep enter_sleep = [](SleepMode) { WaitForInterrupt(); },
+      SystemController * system_controller = nullptr)
+      : enter_sleep_(enter_sleep), system_controller_(system_controller)
+  {
+  }
+
+  PowerManager(const PowerManager &) = delete;
+  PowerManager & operator=(const PowerManager &) = delete;
+
+  /// Power down every module that has been idle for its idle timeout.
+  ///
+  /// @return size_t - number of modules powered down.
+  size_t Update()
+  {
+    const auto kNow     = Uptime();
+    size_t powered_down = 0;
+
+    for (Client * client = clients_; client != nullptr; client = client->next_)
+    {
+      if (client->IsPoweredUp() &&
+          kNow - client->last_used_ >= client->requirements_.idle_timeout)
+      {
+        client->PowerDownModule();
+        powered_down++;
+      }
+    }
+
+    return powered_down;
+  }
+
+  /// @return SleepMode - the deepest sleep mode allowed by every module that
+  ///         is powered up, SleepMode::kPowerDown if none are.
+  SleepMode DeepestSleep() const
+  {
+    SleepMode deepest = SleepMode::kPowerDown;
+
+    for (Client * client = clients_; client != nullptr; client = client->next_)
+    {
+      if (client->IsPoweredUp())
+      {
+        deepest = std::min(deepest, client->requirements_.deepest_sleep);
+      }
+    }
+
+    return deepest;
+  }
+
+  /// Power down idle modules, then sleep in the deepest mode allowed, unless
+  /// a module requires SleepMode::kNone.
+  void Sleep()
+  {
+    Update();
+
+    const SleepMode kMode = DeepestSleep();
+    if (kMode != SleepMode::kNone)
+    {
+      enter_sleep_(kMode);
+    }
+  }
+
+ private:
+  EnterSleep enter_sleep_;
+  SystemController * system_controller_;
+  Client * clients_ = nullptr;
+};
+}  // namespace sjsu
@@ -0,0 +1,104 @@
+#include <libcore/systems/power_manager.hpp>
+
+#include <vector>
+
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing PowerManager")
+{
+  using SleepMode = PowerManager::SleepMode;
+
+  VirtualClock clock;
+  clock.Start();
+
+  constexpr auto kPeripheral = ResourceID::Define<3>();
+  Mock<SystemController> mock_system_controller;
+  Fake(Method(mock_system_controller, PowerUpPeripheral));
+  Fake(Method(mock_system_controller, PowerDownPeripheral));
+
+  Mock<Uart> mock_uart;
+  Fake(Method(mock_uart, ModuleInitialize));
+  Fake(Method(mock_uart, ModulePowerDown));
+  Uart & uart = mock_uart.get();
+
+  std::vector<SleepMode> sleeps;
+  PowerManager power([&sleeps](SleepMode mode) { sleeps.push_back(mode); },
+                     &mock_system_controller.get());
+
+  PowerManager::Managed managed_uart(power,
+                                     uart,
+                                     {
+                                         .idle_timeout  = 10ms,
+                                         .deepest_sleep = SleepMode::kSleep,
+                                         .peripheral    = kPeripheral,
+                                     });
+
+  SECTION("Use() initializes the module")
+  {
+    // Setup
+    uart.settings.baud_rate = 9600;
+
+    // Exercise
+    Uart & used = managed_uart.Use();
+
+    // Verify
+    CHECK(&uart == &used);
+    CHECK(State::kInitialized == uart.GetState());
+    CHECK(9600 == uart.CurrentSettings().baud_rate);
+    Verify(Method(mock_system_controller, PowerUpPeripheral)).Once();
+  }
+
+  SECTION("Idle modules are powered down and restored on use")
+  {
+    // Setup
+    uart.settings.baud_rate = 9600;
+    managed_uart.Use();
+
+    // Exercise
+    clock.Advance(9ms);
+    const size_t kBeforeTimeout = power.Update();
+    clock.Advance(1ms);
+    const size_t kAfterTimeout = power.Update();
+    uart.settings.baud_rate = 115200;
+    managed_uart.Use();
+
+    // Verify
+    CHECK(0 == kBeforeTimeout);
+    CHECK(1 == kAfterTimeout);
+    Verify(Method(mock_uart, ModulePowerDown)).Once();
+    Verify(Method(mock_system_controller, PowerDownPeripheral)).Once();
+    CHECK(State::kInitialized == uart.GetState());
+    CHECK(9600 == uart.CurrentSettings().baud_rate);
+  }
+
+  SECTION("Sleep() enters the deepest mode powered up modules allow")
+  {
+    // Setup
+    Mock<Uart> mock_other;
+    Fake(Method(mock_other, ModuleInitialize));
+    PowerManager::Managed managed_other(power,
+                                        mock_other.get(),
+                                        {
+                                            .idle_timeout = 100ms,
+                                            .deepest_sleep =
+                                                SleepMode::kDeepSleep,
+                                        });
+
+    // Exercise
+    power.Sleep();
+    managed_other.Use();
+    power.Sleep();
+    managed_uart.Use();
+    power.Sleep();
+
+    // Verify
+    CHECK(std::vector<SleepMode>{ SleepMode::kPowerDown,
+                                  SleepMode::kDeepSleep,
+                                  SleepMode::kSleep } == sleeps);
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,522 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include <libcore/module.hpp>
+#include <libcore/peripherals/storage.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/math/crc.hpp>
+
+namespace sjsu
+{
+/// Settings for the RecordStore.
+struct RecordStoreSettings_t
+{
+  /// First block of the storage used by the store.
+  uint32_t first_block = 0;
+
+  /// Number of blocks in each segment. Segments are the unit of erasure, so
+  /// must be a whole number of the erase sectors of the media.
+  uint32_t segment_blocks = 16;
+
+  /// Number of segments. Use 0 for as many as fit after `first_block`. At
+  /// least 2 are needed.
+  uint32_t segment_count = 0;
+
+  /// Number of segments kept erased, or waiting to be erased by Service(),
+  /// ahead of the one being written. The oldest records are retired to keep
+  /// this many, so Append() rarely has to wait for an erase.
+  uint32_t reserved_segments = 1;
+};
+
+/// An append-only, log-structured store of records on NOR or NAND flash,
+/// which never rewrites a block in place, spreading wear across the whole of
+/// its area.
+///
+/// The area is split into segments which are written in turn, as a ring.
+/// Records are packed into a block in RAM, which is written once it is full
+/// or flushed, so every block is only written once between erases. Each
+/// record carries its length and a CRC-32C, so records torn by a loss of
+/// power are detected and skipped.
+///
+/// When the ring is full, the segment with the oldest records is retired and
+/// its records are dropped. Retired segments are erased by Service(), called
+/// when the application is idle, rather than when the space is needed.
+///
+/// Mounting, in Initialize(), reads the header of each segment and a few
+/// blocks of the newest segment, found with a binary search, rather than the
+/// whole log.
+///
+/// The storage must read erased bytes as 0xFF, like NOR and NAND flash.
+///
+/// Layout of a segment:
+///
+///    block 0:  [ segment header ] [ record ] [ record ] ... [ 0xFF ... ]
+///    block 1:  [ record ] [ record ] ... [ 0xFF ... ]
+///
+///    segment header: magic (4) | sequence (4) | CRC-32C of both (4)
+///    record:         length (2) | ~length (2) | data | CRC-32C (4)
+///
+/// USAGE:
+///
+///    sjsu::RecordStore<256> log(nor_flash);
+///    log.settings.segment_blocks = 16;  // 4096 byte erase sectors
+///    log.Initialize();
+///
+///    log.Append(telemetry_bytes);
+///    log.Flush();
+///
+///    // From the idle loop
+///    log.Service();
+///
+///    log.ForEach([](std::span<const uint8_t> record) { Send(record); });
+///
+/// @tparam kBlockSize - block size of the storage, in bytes.
+/// @tparam kMaxSegments - largest number of segments.
+template <size_t kBlockSize = 256, size_t kMaxSegments = 64>
+class RecordStore : public Module<RecordStoreSettings_t>
+{
+ public:
+  /// Marks the start of every segment in use.
+  static constexpr uint32_t kMagic = 0x5352'4A53;
+  /// Bytes at the start of the first block of each segment.
+  static constexpr size_t kSegmentHeaderSize = 12;
+  /// Bytes of each record in addition to its data.
+  static constexpr size_t kRecordOverhead = 8;
+  /// Largest record that can be appended, as records do not span blocks.
+  static constexpr size_t kMaximumRecordSize =
+      kBlockSize - kSegmentHeaderSize - kRecordOverhead;
+
+  static_assert(kBlockSize > kSegmentHeaderSize + kRecordOverhead,
+                "RecordStore blocks must be larger than 20 bytes.");
+
+  /// @param storage - the flash to store the records in.
+  explicit RecordStore(Storage & storage) : storage_(storage) {}
+
+  /// Mount the store, continuing the log found on the storage, if any.
+  ///
+  /// @throw sjsu::Exception - std::errc::invalid_argument if the block size
+  ///        of the storage is not kBlockSize, there is not enough room for
+  ///        2 segments, or there are more than kMaxSegments.
+  void ModuleInitialize() override
+  {
+    storage_.Initialize();
+
+    if (storage_.GetBlockSize().to<size_t>() != kBlockSize)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Block size of the storage does not match the store.");
+    }
+
+    const auto kCapacity = static_cast<uint32_t>(
+        storage_.GetCapacity().to<size_t>() / kBlockSize);
+    first_block_    = settings.first_block;
+    segment_blocks_ = std::max(settings.segment_blocks, uint32_t{ 1 });
+    segment_count_  = settings.segment_count;
+    reserved_       = settings.reserved_segments;
+    if (segment_count_ == 0 && kCapacity > first_block_)
+    {
+      segment_count_ = std::min<uint32_t>(
+          (kCapacity - first_block_) / segment_blocks_, kMaxSegments);
+    }
+
+    if (segment_count_ < 2 || segment_count_ > kMaxSegments)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "A RecordStore needs between 2 and kMaxSegments "
+                      "segments.");
+    }
+
+    Mount();
+  }
+
+  /// Add a record to the end of the log. The record is kept in RAM until its
+  /// block is full or Flush() is called.
+  ///
+  /// @param data - contents of the record.
+  /// @throw sjsu::Exception - std::errc::message_size if `data` is longer
+  ///        than kMaximumRecordSize.
+  void Append(std::span<const uint8_t> data)
+  {
+    if (data.size() > kMaximumRecordSize)
+    {
+      throw Exception(std::errc::message_size,
+                      "Record is too large to fit within a block.");
+    }
+
+    const size_t kSize = data.size() + kRecordOverhead;
+    if (!head_open_ || kBlockSize - position_ < kSize)
+    {
+      WriteBlock();
+      OpenBlock();
+    }
+
+    const auto kLength = static_cast<uint16_t>(data.size());
+    uint8_t * record   = &block_[position_];
+    Store<uint16_t>(record, kLength);
+    Store<uint16_t>(record + 2, static_cast<uint16_t>(~kLength));
+    std::copy(data.begin(), data.end(), record + 4);
+    Store<uint32_t>(record + 4 + kLength, Crc(record, 4 + kLength));
+    position_ += kSize;
+  }
+
+  /// Write the records appended since the last write to the storage. The
+  /// rest of their block is left unused, so flush only as often as records
+  /// must survive a loss of power.
+  void Flush()
+  {
+    WriteBlock();
+  }
+
+  /// Erase one retired segment, if there is one. Call when the application
+  /// is idle, so that Append() does not have to wait for an erase.
+  ///
+  /// @return true - if a segment was erased.
+  bool Service()
+  {
+    for (uint32_t i = 1; i <= segment_count_; i++)
+    {
+      const uint32_t kSegment = (head_ + i) % segment_count_;
+      if (states_[kSegment] == State::kRetired)
+      {
+        EraseSegment(kSegment);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Erase the whole store, dropping every record.
+  void Format()
+  {
+    Reset();
+    for (uint32_t segment = 0; segment < segment_count_; segment++)
+    {
+      EraseSegment(segment);
+    }
+  }
+
+  /// Call `callback` with each intact record, from oldest to newest,
+  /// including those not yet flushed.
+  ///
+  /// @param callback - callable taking a std::span<const uint8_t>, which is
+  ///        only valid during the call.
+  /// @return size_t - number of records passed to the callback.
+  template <typename Callback>
+  size_t ForEach(Callback callback)
+  {
+    size_t count = 0;
+    for (uint32_t i = 0; i < segment_count_; i++)
+    {
+      const uint32_t kSegment = (tail_ + i) % segment_count_;
+      if (states_[kSegment] != State::kLive)
+      {
+        continue;
+      }
+
+      for (uint32_t block = 0; block < segment_blocks_; block++)
+      {
+        std::span<const uint8_t> contents;
+        if (kSegment == head_ && block == head_block_ && head_open_)
+        {
+          contents = block_;
+        }
+        else if (kSegment == head_ && block >= head_block_)
+        {
+          break;
+        }
+        else
+        {
+          storage_.Read(BlockAddress(kSegment, block), scratch_);
+          contents = scratch_;
+        }
+
+        const size_t kStart = (block == 0) ? kSegmentHeaderSize : 0;
+        if (!ParseBlock(contents.subspan(kStart), callback, count))
+        {
+          break;
+        }
+      }
+
+      if (kSegment == head_)
+      {
+        break;
+      }
+    }
+    return count;
+  }
+
+  /// @return uint32_t - number of corrupt records skipped by ForEach().
+  uint32_t GetCorruptRecords() const
+  {
+    return corrupt_records_;
+  }
+
+  /// @return uint32_t - sequence number of the segment being written, which
+  ///         increases by one for each new segment.
+  uint32_t GetSequence() const
+  {
+    return sequence_;
+  }
+
+ private:
+  enum class State : uint8_t
+  {
+    /// Holds records.
+    kLive,
+    /// Erased and ready to be written.
+    kErased,
+    /// May hold old data, must be erased before it is written.
+    kRetired,
+  };
+
+  template <typename T>
+  static void Store(uint8_t * destination, T value)
+  {
+    std::memcpy(destination, &value, sizeof(value));
+  }
+
+  template <typename T>
+  static T Load(const uint8_t * source)
+  {
+    T value;
+    std::memcpy(&value, source, sizeof(value));
+    return value;
+  }
+
+  static uint32_t Crc(const uint8_t * data, size_t size)
+  {
+    return static_cast<uint32_t>(crc::Engine<crc::kCrc32c>::Calculate(
+        std::span<const uint8_t>(data, size)));
+  }
+
+  uint32_t BlockAddress(uint32_t segment, uint32_t block) const
+  {
+    return first_block_ + segment * segment_blocks_ + block;
+  }
+
+  /// Pass each intact record of `contents` to `callback`.
+  ///
+  /// @return false - if the block is erased, which ends the segment.
+  template <typename Callback>
+  bool ParseBlock(std::span<const uint8_t> contents,
+                  Callback & callback,
+                  size_t & count)
+  {
+    size_t offset = 0;
+    while (offset + kRecordOverhead <= contents.size())
+    {
+      const uint8_t * record = &contents[offset];
+      const auto kLength     = Load<uint16_t>(record);
+      const auto kCheck      = Load<uint16_t>(record + 2);
+
+      if (kLength == 0xFFFF && kCheck == 0xFFFF)
+      {
+        return offset != 0;
+      }
+
+      // A damaged length means the records after it cannot be found.
+      if (static_cast<uint16_t>(~kLength) != kCheck ||
+          offset + kRecordOverhead + kLength > contents.size())
+      {
+        corrupt_records_++;
+        return true;
+      }
+
+      if (Load<uint32_t>(record + 4 + kLength) == Crc(record, 4 + kLength))
+      {
+        callback(std::span<const uint8_t>(record + 4, kLength));
+        count++;
+      }
+      else
+      {
+        corrupt_records_++;
+      }
+      offset += kRecordOverhead + kLength;
+    }
+    return true;
+  }
+
+  void Mount()
+  {
+    states_.fill(State::kRetired);
+
+    bool found          = false;
+    uint32_t newest     = 0;
+    uint32_t oldest     = 0;
+    uint32_t newest_seq = 0;
+    uint32_t oldest_seq = 0;
+    for (uint32_t segment = 0; segment < segment_count_; segment++)
+    {
+      std::array<uint8_t, kSegmentHeaderSize> header;
+      storage_.Read(BlockAddress(segment, 0), header);
+      if (Load<uint32_t>(&header[0]) != kMagic ||
+          Load<uint32_t>(&header[8]) != Crc(header.data(), 8))
+      {
+        continue;
+      }
+
+      const auto kSequence = Load<uint32_t>(&header[4]);
+      states_[segment]     = State::kLive;
+      if (!found || kSequence > newest_seq)
+      {
+        newest     = segment;
+        newest_seq = kSequence;
+      }
+      if (!found || kSequence < oldest_seq)
+      {
+        oldest     = segment;
+        oldest_seq = kSequence;
+      }
+      found = true;
+    }
+
+    if (!found)
+    {
+      Reset();
+      return;
+    }
+
+    head_      = newest;
+    tail_      = oldest;
+    sequence_  = newest_seq;
+    head_open_ = false;
+
+    // Blocks of a segment are written in order, so find the first unwritten
+    // block with a binary search of the first record of each block.
+    uint32_t low  = 1;
+    uint32_t high = segment_blocks_;
+    while (low < high)
+    {
+      const uint32_t kMiddle = low + (high - low) / 2;
+      std::array<uint8_t, 4> first;
+      storage_.Read(BlockAddress(head_, kMiddle), first);
+      if (Load<uint32_t>(first.data()) == UINT32_MAX)
+      {
+        high = kMiddle;
+      }
+      else
+      {
+        low = kMiddle + 1;
+      }
+    }
+    head_block_ = low;
+  }
+
+  /// Start from an empty log, with every segment needing an erase.
+  void Reset()
+  {
+    states_.fill(State::kRetired);
+    head_       = segment_count_ - 1;
+    tail_       = 0;
+    head_block_ = segment_blocks_;
+    head_open_  = false;
+    sequence_   = 0;
+  }
+
+  /// Start filling the next block in RAM, moving to a new segment when the
+  /// current one is full.
+  void OpenBlock()
+  {
+    block_.fill(0xFF);
+    position_  = 0;
+    head_open_ = true;
+
+    if (head_block_ < segment_blocks_ && states_[head_] == State::kLive)
+    {
+      return;
+    }
+
+    const uint32_t kNext = (head_ + 1) % segment_count_;
+    if (states_[kNext] == State::kLive)
+    {
+      Retire(kNext);
+    }
+    if (states_[kNext] == State::kRetired)
+    {
+      EraseSegment(kNext);
+    }
+
+    // The first segment of an empty log is also its oldest.
+    if (states_[tail_] != State::kLive)
+    {
+      tail_ = kNext;
+    }
+
+    sequence_++;
+    head_          = kNext;
+    head_block_    = 0;
+    states_[kNext] = State::kLive;
+    Store<uint32_t>(&block_[0], kMagic);
+    Store<uint32_t>(&block_[4], sequence_);
+    Store<uint32_t>(&block_[8], Crc(block_.data(), 8));
+    position_ = kSegmentHeaderSize;
+
+    // Keep the reserve of free segments ahead of the head.
+    while (FreeSegments() < reserved_ && tail_ != head_)
+    {
+      Retire(tail_);
+    }
+  }
+
+  /// Write the block in RAM, if it holds any records.
+  void WriteBlock()
+  {
+    const size_t kStart = (head_block_ == 0) ? kSegmentHeaderSize : 0;
+    if (!head_open_ || position_ == kStart)
+    {
+      return;
+    }
+
+    storage_.Write(BlockAddress(head_, head_block_), block_);
+    head_block_++;
+    head_open_ = false;
+  }
+
+  void Retire(uint32_t segment)
+  {
+    states_[segment] = State::kRetired;
+    if (segment == tail_)
+    {
+      tail_ = (tail_ + 1) % segment_count_;
+    }
+  }
+
+  void EraseSegment(uint32_t segment)
+  {
+    storage_.Erase(BlockAddress(segment, 0), segment_blocks_);
+    states_[segment] = State::kErased;
+  }
+
+  uint32_t FreeSegments() const
+  {
+    uint32_t free = 0;
+    for (uint32_t segment = 0; segment < segment_count_; segment++)
+    {
+      free += (states_[segment] != State::kLive);
+    }
+    return free;
+  }
+
+  Storage & storage_;
+  std::array<uint8_t, kBlockSize> block_{};
+  std::array<uint8_t, kBlockSize> scratch_{};
+  std::array<State, kMaxSegments> states_{};
+  uint32_t first_block_     = 0;
+  uint32_t segment_blocks_  = 1;
+  uint32_t segment_count_   = 0;
+  uint32_t reserved_        = 0;
+  uint32_t head_            = 0;
+  uint32_t tail_            = 0;
+  uint32_t head_block_      = 0;
+  uint32_t sequence_        = 0;
+  uint32_t corrupt_records_ = 0;
+  size_t position_          = 0;
+  bool head_open_           = false;
+};
+}  // namespace sjsu
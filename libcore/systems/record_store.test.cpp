@@ -0,0 +1,142 @@
+#include <libcore/systems/record_store.hpp>
+
+#include <array>
+#include <vector>
+
+#include <libcore/testing/ram_storage.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+constexpr size_t kFlashBlockSize = 32;
+
+using TestStore = RecordStore<kFlashBlockSize, 8>;
+
+std::vector<std::vector<uint8_t>> ReadAll(TestStore & store)
+{
+  std::vector<std::vector<uint8_t>> records;
+  store.ForEach([&records](std::span<const uint8_t> record) {
+    records.emplace_back(record.begin(), record.end());
+  });
+  return records;
+}
+
+void Configure(TestStore & store)
+{
+  store.settings.segment_blocks    = 4;
+  store.settings.reserved_segments = 1;
+}
+}  // namespace
+
+TEST_CASE("Testing RecordStore")
+{
+  // NOR flash of 16 blocks, which can only clear bits until it is erased.
+  testing::RamStorage flash({ .type            = Storage::Type::kNor,
+                              .block_size      = kFlashBlockSize,
+                              .only_clear_bits = true,
+                              .record          = true });
+  TestStore test_subject(flash);
+  Configure(test_subject);
+  test_subject.Initialize();
+
+  const std::array<uint8_t, 3> kFirst  = { 1, 2, 3 };
+  const std::array<uint8_t, 5> kSecond = { 4, 5, 6, 7, 8 };
+
+  SECTION("Records read back in order, before and after Flush()")
+  {
+    // Exercise
+    test_subject.Append(kFirst);
+    auto before_flush = ReadAll(test_subject);
+    test_subject.Append(kSecond);
+    test_subject.Flush();
+
+    // Verify
+    CHECK(before_flush == std::vector<std::vector<uint8_t>>{ { 1, 2, 3 } });
+    CHECK(ReadAll(test_subject) == std::vector<std::vector<uint8_t>>{
+                                       { 1, 2, 3 }, { 4, 5, 6, 7, 8 } });
+  }
+
+  SECTION("Mounting continues the log found on the storage")
+  {
+    // Setup
+    for (int i = 0; i < 6; i++)
+    {
+      test_subject.Append(kSecond);
+    }
+    test_subject.Flush();
+    TestStore remounted(flash);
+    Configure(remounted);
+    flash.accesses.clear();
+
+    // Exercise
+    remounted.Initialize();
+    const size_t kMountReads      = flash.Count('r');
+    const uint32_t kMountSequence = remounted.GetSequence();
+    remounted.Append(kFirst);
+
+    // Verify
+    // 4 segment headers and a binary search of 3 blocks.
+    CHECK(kMountReads <= 4 + 2);
+    auto records = ReadAll(remounted);
+    REQUIRE(7 == records.size());
+    CHECK(records.back() == std::vector<uint8_t>{ 1, 2, 3 });
+    CHECK(test_subject.GetSequence() == kMountSequence);
+  }
+
+  SECTION("The oldest segments are retired and erased by Service()")
+  {
+    // Setup
+    std::array<uint8_t, 1> record;
+
+    // Exercise
+    for (uint8_t i = 0; i < 40; i++)
+    {
+      record[0] = i;
+      test_subject.Append(record);
+      test_subject.Flush();
+      while (test_subject.Service())
+      {
+      }
+    }
+
+    // Verify
+    auto records = ReadAll(test_subject);
+    REQUIRE(!records.empty());
+    // With one segment in reserve, 3 segments of 4 blocks hold records.
+    CHECK(records.size() <= 12);
+    CHECK(records.back() == std::vector<uint8_t>{ 39 });
+    for (size_t i = 1; i < records.size(); i++)
+    {
+      CHECK(records[i - 1][0] + 1 == records[i][0]);
+    }
+  }
+
+  SECTION("Corrupt records are skipped")
+  {
+    // Setup
+    test_subject.Append(kFirst);
+    test_subject.Append(kSecond);
+    test_subject.Flush();
+    // Damage the data of the first record, after the segment header.
+    flash.memory[TestStore::kSegmentHeaderSize + 4] ^= 0x01;
+
+    // Exercise
+    auto records = ReadAll(test_subject);
+
+    // Verify
+    CHECK(records == std::vector<std::vector<uint8_t>>{ { 4, 5, 6, 7, 8 } });
+    CHECK(1 == test_subject.GetCorruptRecords());
+  }
+
+  SECTION("Records larger than a block throw")
+  {
+    // Setup
+    std::array<uint8_t, TestStore::kMaximumRecordSize + 1> record{};
+
+    // Exercise & Verify
+    CHECK_THROWS_AS(test_subject.Append(record), sjsu::Exception);
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,341 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include <libcore/peripherals/storage.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/math/byte.hpp>
+
+namespace sjsu
+{
+/// A run length encoded, 16 bit per pixel, RGB565 image, drawn with
+/// Graphics::DrawImage(). Full screen images of an HMI are mostly large areas
+/// of a few colors, so they take a fraction of the flash of a raw bitmap, and
+/// each run is drawn with a single span rather than pixel by pixel.
+///
+/// Layout, all integers little endian except pixels:
+///
+///    offset  size  field
+///    0       2     kMagic, "RL"
+///    2       2     width in pixels
+///    4       2     height in pixels
+///    6       4     number of bytes of packets following the header
+///    10            packets, row by row, top row first
+///
+/// Each row is a sequence of packets that never continue onto the next row.
+/// A packet starts with a control byte holding its number of pixels, minus
+/// one, in its low 7 bits:
+///
+///  - bit 7 set: a run, followed by one pixel repeated that many times.
+///  - bit 7 clear: literal pixels, followed by that many pixels.
+///
+/// Pixels are 2 bytes, most significant byte first, the same as a kRgb565
+/// framebuffer, so literal pixels are copied into it as they are.
+///
+/// Images are made by Encode(), at build time or on a host.
+class RleImage
+{
+ public:
+  /// Identifies the start of an image.
+  static constexpr std::array<uint8_t, 2> kMagic = { 'R', 'L' };
+  /// Number of bytes before the first packet.
+  static constexpr size_t kHeaderSize = 10;
+  /// Largest number of pixels in a packet.
+  static constexpr size_t kMaximumPacketPixels = 128;
+  /// Control byte bit marking a run.
+  static constexpr uint8_t kRun = 0x80;
+
+  /// Dimensions of an image, read from its header.
+  struct Header_t
+  {
+    /// Width in pixels.
+    uint16_t width = 0;
+    /// Height in pixels.
+    uint16_t height = 0;
+    /// Number of bytes of packets following the header.
+    uint32_t packets_size = 0;
+
+    /// @return size_t - number of bytes of the whole image.
+    constexpr size_t Size() const
+    {
+      return kHeaderSize + packets_size;
+    }
+  };
+
+  /// @param header - the first kHeaderSize bytes of an image.
+  /// @return constexpr Header_t - the image's dimensions.
+  /// @throw std::errc::message_size - if `header` is shorter than kHeaderSize.
+  /// @throw std::errc::bad_message - if `header` does not start with kMagic.
+  static constexpr Header_t ParseHeader(std::span<const uint8_t> header)
+  {
+    if (header.size() < kHeaderSize)
+    {
+      throw Exception(std::errc::message_size,
+                      "Too few bytes for an RLE image header.");
+    }
+    if (header[0] != kMagic[0] || header[1] != kMagic[1])
+    {
+      throw Exception(std::errc::bad_message, "Not an RLE image.");
+    }
+
+    return Header_t{
+      .width  = ToInteger<uint16_t>(std::endian::little, header.subspan(2, 2)),
+      .height = ToInteger<uint16_t>(std::endian::little, header.subspan(4, 2)),
+      .packets_size =
+          ToInteger<uint32_t>(std::endian::little, header.subspan(6, 4)),
+    };
+  }
+
+  /// @param width - width of the image in pixels.
+  /// @param height - height of the image in pixels.
+  /// @return constexpr size_t - the most bytes Encode() can produce for an
+  ///         image of this size, when no pixel repeats.
+  static constexpr size_t MaximumEncodedSize(size_t width, size_t height)
+  {
+    const size_t kPacketsPerRow =
+        (width + kMaximumPacketPixels - 1) / kMaximumPacketPixels;
+    return kHeaderSize + (height * (kPacketsPerRow + (width * 2)));
+  }
+
+  /// Encode an RGB565 bitmap. Two or more equal pixels in a row become a run,
+  /// everything else literal pixels.
+  ///
+  /// @param width - width of the bitmap in pixels, at most 65535.
+  /// @param pixels - the bitmap, row by row, top row first, a whole number of
+  ///        rows long.
+  /// @param output - destination of the image, see MaximumEncodedSize().
+  /// @return constexpr size_t - number of bytes of the image.
+  /// @throw std::errc::invalid_argument - if the bitmap is not a whole number
+  ///        of rows or either dimension is larger than 65535.
+  /// @throw std::errc::no_buffer_space - if `output` is too small.
+  static constexpr size_t Encode(size_t width,
+                                 std::span<const uint16_t> pixels,
+                                 std::span<uint8_t> output)
+  {
+    const size_t kHeight = (width == 0) ? 0 : pixels.size() / width;
+    if (width > UINT16_MAX || kHeight > UINT16_MAX ||
+        kHeight * width != pixels.size())
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Bitmap must be a whole number of rows of at most "
+                      "65535 pixels, and at most 65535 rows.");
+    }
+
+    size_t position = kHeaderSize;
+    auto put        = [&output, &position](uint8_t byte) {
+      if (position >= output.size())
+      {
+        throw Exception(std::errc::no_buffer_space,
+                        "Buffer is too small for the encoded image.");
+      }
+      output[position++] = byte;
+    };
+    auto put_pixel = [&put](uint16_t pixel) {
+      put(static_cast<uint8_t>(pixel >> 8));
+      put(static_cast<uint8_t>(pixel));
+    };
+
+    for (size_t row = 0; row < kHeight; row++)
+    {
+      const auto kRow = pixels.subspan(row * width, width);
+      size_t column   = 0;
+      while (column < width)
+      {
+        const size_t kLimit = std::min(width - column, kMaximumPacketPixels);
+        size_t length       = 1;
+        while (length < kLimit && kRow[column + length] == kRow[column])
+        {
+          length++;
+        }
+
+        if (length > 1)
+        {
+          put(static_cast<uint8_t>(kRun | (length - 1)));
+          put_pixel(kRow[column]);
+          column += length;
+          continue;
+        }
+
+        // Gather literal pixels until the next pair of equal pixels.
+        while (length < kLimit &&
+               (column + length + 1 >= width ||
+                kRow[column + length] != kRow[column + length + 1]))
+        {
+          length++;
+        }
+
+        put(static_cast<uint8_t>(length - 1));
+        for (size_t i = 0; i < length; i++)
+        {
+          put_pixel(kRow[column + i]);
+        }
+        column += length;
+      }
+    }
+
+    if (output.size() < kHeaderSize)
+    {
+      throw Exception(std::errc::no_buffer_space,
+                      "Buffer is too small for the encoded image.");
+    }
+
+    const auto kWidth   = static_cast<uint16_t>(width);
+    const auto kRows    = static_cast<uint16_t>(kHeight);
+    const auto kPackets = static_cast<uint32_t>(position - kHeaderSize);
+    output[0]           = kMagic[0];
+    output[1]           = kMagic[1];
+    std::ranges::copy(ToByteArray(std::endian::little, kWidth), &output[2]);
+    std::ranges::copy(ToByteArray(std::endian::little, kRows), &output[4]);
+    std::ranges::copy(ToByteArray(std::endian::little, kPackets), &output[6]);
+    return position;
+  }
+
+  /// Reads the bytes of an image in order, either from memory or streamed
+  /// from Storage a buffer at a time.
+  class Reader
+  {
+   public:
+    /// Read an image held in memory, such as a constant in flash.
+    ///
+    /// @param image - the whole image.
+    /// @throw std::errc::bad_message - if the image is not an RLE image or is
+    ///        shorter than its header says.
+    explicit Reader(std::span<const uint8_t> image)
+        : header_(ParseHeader(image))
+    {
+      if (image.size() < header_.Size())
+      {
+        throw Exception(std::errc::bad_message, "RLE image is truncated.");
+      }
+      available_ = image.subspan(kHeaderSize, header_.packets_size);
+      remaining_ = 0;
+    }
+
+    /// Read an image stored in Storage, starting at the beginning of a block.
+    /// Memory-mapped storage is read in place, see Storage::Map(), otherwise
+    /// the image is read into `buffer` a whole number of blocks at a time.
+    ///
+    /// @param storage - storage holding the image.
+    /// @param block_address - block the image starts at.
+    /// @param buffer - at least one block, and ideally a multiple of the
+    ///        block size. Only used if the storage is not memory-mapped.
+    /// @throw std::errc::invalid_argument - if `buffer` is smaller than a
+    ///        block or than the image header.
+    /// @throw std::errc::bad_message - if the storage does not hold an RLE
+    ///        image at that block.
+    Reader(Storage & storage, uint32_t block_address, std::span<uint8_t> buffer)
+        : storage_(&storage)
+    {
+      block_size_ = storage.GetBlockSize().to<size_t>();
+      if (block_size_ == 0 ||
+          (buffer.size() / block_size_) * block_size_ < kHeaderSize)
+      {
+        throw Exception(std::errc::invalid_argument,
+                        "Image buffer must hold at least one block and the "
+                        "image header.");
+      }
+
+      buffer_ = buffer.first((buffer.size() / block_size_) * block_size_);
+      block_  = block_address;
+
+      Fill(kHeaderSize);
+      header_ = ParseHeader(available_);
+
+      const size_t kBlocks = (header_.Size() + block_size_ - 1) / block_size_;
+      const auto kMapped   = storage.Map(block_address, kBlocks);
+      if (kMapped.size() >= header_.Size())
+      {
+        available_ = kMapped.subspan(kHeaderSize, header_.packets_size);
+        remaining_ = 0;
+        return;
+      }
+
+      const size_t kBuffered = std::min(available_.size(), header_.Size());
+      available_ = available_.first(kBuffered).subspan(kHeaderSize);
+      remaining_ = header_.Size() - kBuffered;
+    }
+
+    /// @return const Header_t& - the dimensions of the image.
+    const Header_t & GetHeader() const
+    {
+      return header_;
+    }
+
+    /// @param count - most bytes wanted.
+    /// @return std::span<const uint8_t> - the next bytes of the image, between
+    ///         1 and `count` bytes, which stay valid until the next call.
+    /// @throw std::errc::bad_message - if the image has no more bytes.
+    std::span<const uint8_t> Next(size_t count)
+    {
+      if (available_.empty())
+      {
+        if (remaining_ == 0)
+        {
+          throw Exception(std::errc::bad_message, "RLE image is truncated.");
+        }
+        Fill(remaining_);
+        if (available_.size() > remaining_)
+        {
+          available_ = available_.first(remaining_);
+        }
+        remaining_ -= available_.size();
+      }
+
+      const auto kBytes = available_.first(std::min(count, available_.size()));
+      available_        = available_.subspan(kBytes.size());
+      return kBytes;
+    }
+
+    /// @return uint8_t - the next byte of the image.
+    /// @throw std::errc::bad_message - if the image has no more bytes.
+    uint8_t NextByte()
+    {
+      return Next(1)[0];
+    }
+
+    /// Read exactly `destination.size()` bytes.
+    ///
+    /// @param destination - where to copy the bytes.
+    /// @throw std::errc::bad_message - if the image has too few bytes left.
+    void Read(std::span<uint8_t> destination)
+    {
+      size_t copied = 0;
+      while (copied < destination.size())
+      {
+        const auto kBytes = Next(destination.size() - copied);
+        std::copy(kBytes.begin(), kBytes.end(), destination.begin() + copied);
+        copied += kBytes.size();
+      }
+    }
+
+   private:
+    /// Read the next blocks of the image into the buffer, but no more blocks
+    /// than hold `wanted` bytes, so nothing past the image is read.
+    ///
+    /// @param wanted - number of bytes of the image still to be read.
+    void Fill(size_t wanted)
+    {
+      const size_t kBlocks =
+          std::min(buffer_.size(), wanted + block_size_ - 1) / block_size_;
+      const auto kBuffer = buffer_.first(kBlocks * block_size_);
+      storage_->Read(block_, kBuffer);
+      block_ += static_cast<uint32_t>(kBlocks);
+      available_ = kBuffer;
+    }
+
+    Header_t header_                    = {};
+    std::span<const uint8_t> available_ = {};
+    size_t remaining_                   = 0;
+    Storage * storage_                  = nullptr;
+    std::span<uint8_t> buffer_          = {};
+    uint32_t block_                     = 0;
+    size_t block_size_                  = 0;
+  };
+};
+}  // namespace sjsu
@@ -0,0 +1,251 @@
+#include <libcore/systems/rle_image.hpp>
+
+#include <array>
+#include <vector>
+
+#include <libcore/devices/framebuffer_display.hpp>
+#include <libcore/systems/graphics.hpp>
+#include <libcore/testing/ram_storage.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+using Format = PixelDisplay::PixelFormat;
+
+/// Read-only storage of 4 byte blocks, which holds an image and records the
+/// blocks read.
+constexpr testing::RamStorage::Settings_t kImageStorage = {
+  .type       = Storage::Type::kNor,
+  .block_size = 4,
+  .blocks     = 0,
+  .read_only  = true,
+  .record     = true,
+};
+
+/// @return size_t - number of blocks read from `storage`.
+size_t BlocksRead(const testing::RamStorage & storage)
+{
+  size_t blocks = 0;
+  for (const auto & access : storage.accesses)
+  {
+    blocks += access.blocks;
+  }
+  return blocks;
+}
+
+/// @return std::vector<uint8_t> - `pixels` encoded as an RleImage.
+std::vector<uint8_t> Encode(size_t width, std::span<const uint16_t> pixels)
+{
+  std::vector<uint8_t> image(
+      RleImage::MaximumEncodedSize(width, pixels.size() / width));
+  image.resize(RleImage::Encode(width, pixels, image));
+  return image;
+}
+
+/// A 20 x 6 test image: a background, a bar of one color and a gradient.
+std::vector<uint16_t> TestPattern()
+{
+  std::vector<uint16_t> pixels(20 * 6, 0x001F);
+  for (size_t x = 2; x < 18; x++)
+  {
+    pixels[(1 * 20) + x] = 0xF800;
+    pixels[(2 * 20) + x] = 0xF800;
+  }
+  for (size_t x = 0; x < 20; x++)
+  {
+    pixels[(4 * 20) + x] = static_cast<uint16_t>(x * 0x0841);
+  }
+  return pixels;
+}
+}  // namespace
+
+TEST_CASE("Testing RleImage")
+{
+  const std::vector<uint16_t> kPattern = TestPattern();
+  const std::vector<uint8_t> kImage    = Encode(20, kPattern);
+
+  SECTION("Encoding")
+  {
+    // Setup
+    constexpr std::array<uint16_t, 8> kPixels = {
+      0x1234, 0x1234, 0x1234, 0xABCD, 0x0001, 0x0002, 0x0002, 0x0003,
+    };
+
+    // Exercise
+    const std::vector<uint8_t> kEncoded = Encode(8, kPixels);
+
+    // Verify
+    CHECK(std::vector<uint8_t>{
+              'R',  'L',  8,    0,    1,    0,    14,   0,    0,    0,
+              0x82, 0x12, 0x34, 0x01, 0xAB, 0xCD, 0x00, 0x01, 0x81, 0x00,
+              0x02, 0x00, 0x00, 0x03 } == kEncoded);
+    CHECK(8 == RleImage::ParseHeader(kEncoded).width);
+    CHECK(1 == RleImage::ParseHeader(kEncoded).height);
+    CHECK(kEncoded.size() == RleImage::ParseHeader(kEncoded).Size());
+  }
+
+  SECTION("Packets never cross rows and hold at most 128 pixels")
+  {
+    // Setup
+    const std::vector<uint16_t> kRuns(300 * 2, 0x5555);
+    std::vector<uint16_t> literals(300);
+    for (size_t i = 0; i < literals.size(); i++)
+    {
+      literals[i] = static_cast<uint16_t>(i);
+    }
+
+    // Exercise
+    const std::vector<uint8_t> kEncodedRuns     = Encode(300, kRuns);
+    const std::vector<uint8_t> kEncodedLiterals = Encode(300, literals);
+
+    // Verify
+    // 128 + 128 + 44 pixels per row.
+    CHECK(RleImage::kHeaderSize + (2 * 3 * 3) == kEncodedRuns.size());
+    CHECK(0xFF == kEncodedRuns[RleImage::kHeaderSize]);
+    CHECK(0x80 + 43 == kEncodedRuns[RleImage::kHeaderSize + 6]);
+    CHECK(RleImage::MaximumEncodedSize(300, 1) == kEncodedLiterals.size());
+  }
+
+  SECTION("Flat images take a fraction of a raw bitmap")
+  {
+    // Exercise & Verify
+    CHECK(kImage.size() * 3 < kPattern.size() * 2);
+  }
+
+  SECTION("Streaming from storage reads only the blocks of the image")
+  {
+    // Setup
+    testing::RamStorage storage(kImageStorage);
+    storage.memory.resize(8 + ((kImage.size() + 3) & ~size_t{ 3 }) + 16, 0);
+    std::copy(kImage.begin(), kImage.end(), storage.memory.begin() + 8);
+    std::array<uint8_t, 14> buffer{};
+    RleImage::Reader reader(storage, 2, buffer);
+
+    // Exercise
+    std::vector<uint8_t> streamed;
+    for (size_t i = RleImage::kHeaderSize; i < kImage.size(); i++)
+    {
+      streamed.push_back(reader.NextByte());
+    }
+
+    // Verify
+    CHECK(std::vector<uint8_t>(kImage.begin() + RleImage::kHeaderSize,
+                               kImage.end()) == streamed);
+    CHECK(2 == storage.accesses.front().block);
+    CHECK(2 + ((kImage.size() + 3) / 4) ==
+          storage.accesses.back().block + storage.accesses.back().blocks);
+    CHECK(BlocksRead(storage) == (kImage.size() + 3) / 4);
+    SJ2_CHECK_EXCEPTION(reader.NextByte(), std::errc::bad_message);
+  }
+
+  SECTION("Memory-mapped storage is read in place")
+  {
+    // Setup
+    testing::RamStorage storage(kImageStorage);
+    storage.settings.mappable = true;
+    storage.memory = kImage;
+    storage.memory.resize((kImage.size() + 3) & ~size_t{ 3 });
+    std::array<uint8_t, 12> buffer{};
+
+    // Exercise
+    RleImage::Reader reader(storage, 0, buffer);
+    const auto kPackets = reader.Next(kImage.size());
+
+    // Verify
+    CHECK(&storage.memory[RleImage::kHeaderSize] == kPackets.data());
+    CHECK(kImage.size() - RleImage::kHeaderSize == kPackets.size());
+    CHECK(3 == BlocksRead(storage));
+  }
+
+  SECTION("Drawing matches the raw bitmap")
+  {
+    // Setup
+    using Display = FramebufferDisplay<24, 8, Format::kRgb565>;
+    Display raw_display;
+    Display image_display;
+    Graphics raw(raw_display);
+    Graphics image(image_display);
+
+    for (int32_t x : { 0, 3, -5, 10 })
+    {
+      raw_display.Clear();
+      image_display.Clear();
+
+      // Exercise
+      for (int32_t y = 0; y < 6; y++)
+      {
+        for (int32_t column = 0; column < 20; column++)
+        {
+          raw.SetColor(PixelDisplay::Framebuffer_t::FromRgb565(
+              kPattern[(y * 20) + column]));
+          raw.DrawPixel(x + column, y + 1);
+        }
+      }
+      image.DrawImage(x, 1, kImage);
+
+      // Verify
+      CHECK(std::vector<uint8_t>(raw_display.Buffer().begin(),
+                                 raw_display.Buffer().end()) ==
+            std::vector<uint8_t>(image_display.Buffer().begin(),
+                                 image_display.Buffer().end()));
+      CHECK(raw.GetDirtyRegion() == image.GetDirtyRegion());
+      raw.Update();
+      image.Update();
+    }
+  }
+
+  SECTION("Drawing streams from storage")
+  {
+    // Setup
+    using Display = FramebufferDisplay<20, 6, Format::kRgb565>;
+    Display display;
+    Graphics graphics(display);
+    testing::RamStorage storage(kImageStorage);
+    storage.memory = kImage;
+    storage.memory.resize((kImage.size() + 3) & ~size_t{ 3 });
+    std::array<uint8_t, 16> buffer{};
+
+    // Exercise
+    graphics.DrawImage(0, 0, storage, 0, buffer);
+
+    // Verify
+    for (size_t i = 0; i < kPattern.size(); i++)
+    {
+      CHECK(kPattern[i] == ToInteger<uint16_t>(
+                               std::endian::big,
+                               display.Buffer().subspan(i * 2, 2)));
+    }
+  }
+
+  SECTION("Malformed images are rejected")
+  {
+    // Setup
+    FramebufferDisplay<20, 6, Format::kRgb565> display;
+    Graphics graphics(display);
+    std::vector<uint8_t> wrong_magic = kImage;
+    wrong_magic[0]                   = 'X';
+    const std::span<const uint8_t> kTruncated =
+        std::span(kImage).first(kImage.size() - 1);
+    std::vector<uint8_t> overlong = Encode(2, std::array<uint16_t, 2>{ 1, 2 });
+    overlong[RleImage::kHeaderSize] = 2;
+    testing::RamStorage storage(kImageStorage);
+    storage.memory = kImage;
+    std::array<uint8_t, 8> small_buffer{};
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(graphics.DrawImage(0, 0, wrong_magic),
+                        std::errc::bad_message);
+    SJ2_CHECK_EXCEPTION(graphics.DrawImage(0, 0, kTruncated),
+                        std::errc::bad_message);
+    SJ2_CHECK_EXCEPTION(graphics.DrawImage(0, 0, overlong),
+                        std::errc::bad_message);
+    SJ2_CHECK_EXCEPTION(graphics.DrawImage(0, 0, storage, 0, small_buffer),
+                        std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(std::ignore = RleImage::ParseHeader(
+                            std::span(kImage).first(4)),
+                        std::errc::message_size);
+  }
+}
+}  // namespace sjsu
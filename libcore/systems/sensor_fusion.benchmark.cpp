@@ -0,0 +1,53 @@
+#include <libcore/systems/sensor_fusion.hpp>
+#include <libcore/testing/benchmark.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+namespace
+{
+/// A FIFO batch of a device tilted slightly and turning slowly.
+struct Batch_t
+{
+  Batch_t()
+  {
+    accelerations.fill({
+        .x = units::acceleration::meters_per_second_squared_t(0.5f),
+        .y = units::acceleration::meters_per_second_squared_t(-1.0f),
+        .z = units::acceleration::meters_per_second_squared_t(9.7f),
+    });
+    rates.fill({
+        .x = units::angular_velocity::radians_per_second_t(0.1f),
+        .y = units::angular_velocity::radians_per_second_t(-0.2f),
+        .z = units::angular_velocity::radians_per_second_t(0.05f),
+    });
+  }
+
+  std::array<Accelerometer::Acceleration_t, 32> accelerations;
+  std::array<Gyroscope::AngularVelocity_t, 32> rates;
+};
+}  // namespace
+
+SJ2_BENCHMARK("fusion::ComplementaryFilter::Update() of 32 samples")
+{
+  fusion::ComplementaryFilter filter(1_kHz, 500ms);
+  Batch_t batch;
+  return benchmark::Run(name, [&filter, &batch]() {
+    benchmark::DoNotOptimize(batch);
+    filter.Update(batch.accelerations, batch.rates);
+    benchmark::DoNotOptimize(filter);
+  });
+}
+
+SJ2_BENCHMARK("fusion::MahonyFilter::Update() of 32 samples")
+{
+  fusion::MahonyFilter filter(1_kHz, { .proportional = 2, .integral = 0.1f });
+  Batch_t batch;
+  return benchmark::Run(name, [&filter, &batch]() {
+    benchmark::DoNotOptimize(batch);
+    filter.Update(batch.accelerations, batch.rates);
+    benchmark::DoNotOptimize(filter);
+  });
+}
+}  // namespace sjsu
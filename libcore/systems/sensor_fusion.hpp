@@ -0,0 +1,549 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include <libcore/devices/accelerometer.hpp>
+#include <libcore/devices/gyroscope.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/math/dsp.hpp>
+#include <libcore/utility/math/units.hpp>
+
+/// Fixed point orientation estimation from accelerometer and gyroscope
+/// samples, for cores without an FPU.
+///
+/// Both filters take a batch of samples at a time, such as the contents of a
+/// device FIFO read with Accelerometer::Read(std::span<Acceleration_t>) and
+/// Gyroscope::Read(std::span<AngularVelocity_t>), and run entirely in 32 bit
+/// fixed point with 64 bit products, apart from converting each sample from
+/// its floating point unit once. Their state uses these formats:
+///
+///  - Angles are radians with 28 fraction bits, from -pi to pi.
+///  - Quaternions are unit quaternions with 30 fraction bits per component.
+///
+/// The axes follow the Accelerometer convention, which reads +1g on the z
+/// axis when the device lies flat and still.
+namespace sjsu::fusion
+{
+/// Fraction bits of the angles of Attitude_t.
+inline constexpr int kAngleBits = 28;
+/// Fraction bits of the components of Quaternion_t.
+inline constexpr int kQuaternionBits = 30;
+
+/// Orientation as rotations about the x (roll), y (pitch) and z (yaw) axes,
+/// in radians with kAngleBits fraction bits.
+struct Attitude_t
+{
+  /// Rotation about the x axis.
+  int32_t roll = 0;
+  /// Rotation about the y axis.
+  int32_t pitch = 0;
+  /// Rotation about the z axis, relative to the heading at the start, as
+  /// there is no magnetometer to correct it.
+  int32_t yaw = 0;
+};
+
+/// Unit quaternion of the rotation from the world frame to the device frame,
+/// with kQuaternionBits fraction bits per component.
+struct Quaternion_t
+{
+  /// Scalar part.
+  int32_t w = int32_t{ 1 } << kQuaternionBits;
+  /// Vector part along the x axis.
+  int32_t x = 0;
+  /// Vector part along the y axis.
+  int32_t y = 0;
+  /// Vector part along the z axis.
+  int32_t z = 0;
+};
+
+/// @param angle - angle with kAngleBits fraction bits.
+/// @return units::angle::radian_t - the angle in floating point.
+constexpr units::angle::radian_t ToRadians(int32_t angle)
+{
+  return units::angle::radian_t(static_cast<float>(angle) /
+                                static_cast<float>(int32_t{ 1 } << kAngleBits));
+}
+
+namespace internal
+{
+/// Fraction bits of unit vectors and of the sample period in seconds.
+inline constexpr int kUnitBits = 30;
+/// Fraction bits of accelerations in m/s^2 and angular velocities in rad/s.
+inline constexpr int kRateBits = 16;
+
+inline constexpr int32_t kOne = int32_t{ 1 } << kUnitBits;
+inline constexpr int32_t kPi  = dsp::internal::Quantize<int32_t, kAngleBits>(
+    dsp::internal::kPi);
+inline constexpr int32_t kHalfPi =
+    dsp::internal::Quantize<int32_t, kAngleBits>(dsp::internal::kPi / 2);
+
+/// @return int32_t - the product of two fixed point numbers, shifted right by
+///         `shift` bits.
+constexpr int32_t Multiply(int32_t a, int32_t b, int shift)
+{
+  return static_cast<int32_t>((int64_t{ a } * b) >> shift);
+}
+
+/// @return uint32_t - floor(sqrt(value)), bit by bit.
+constexpr uint32_t SquareRoot(uint64_t value)
+{
+  uint64_t root = 0;
+  uint64_t bit  = uint64_t{ 1 } << 62;
+  while (bit > value)
+  {
+    bit >>= 2;
+  }
+  while (bit != 0)
+  {
+    if (value >= root + bit)
+    {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return static_cast<uint32_t>(root);
+}
+
+/// @return int32_t - `value`, a unit quantity, converted from floating point
+///         to kRateBits fraction bits.
+inline int32_t ToFixed(float value)
+{
+  return dsp::internal::Saturate<int32_t>(static_cast<int64_t>(
+      value * static_cast<float>(int32_t{ 1 } << kRateBits)));
+}
+
+/// atan(z) for z from 0 to 1 with kUnitBits fraction bits, by the
+/// approximation pi/4 z - z (z - 1) (0.2447 + 0.0663 z), which is within
+/// 0.0015 radians.
+///
+/// @return int32_t - the angle with kAngleBits fraction bits.
+constexpr int32_t Atan(int32_t z)
+{
+  constexpr int32_t kQuarterPi =
+      dsp::internal::Quantize<int32_t, kUnitBits>(dsp::internal::kPi / 4);
+  constexpr int32_t kC1 = dsp::internal::Quantize<int32_t, kUnitBits>(0.2447);
+  constexpr int32_t kC2 = dsp::internal::Quantize<int32_t, kUnitBits>(0.0663);
+
+  const int32_t kTerm  = kC1 + Multiply(kC2, z, kUnitBits);
+  const int32_t kCurve = Multiply(Multiply(z, z - kOne, kUnitBits),
+                                  kTerm,
+                                  kUnitBits);
+  return (Multiply(kQuarterPi, z, kUnitBits) - kCurve) >>
+         (kUnitBits - kAngleBits);
+}
+
+/// @return int32_t - atan2(y, x) with kAngleBits fraction bits. `y` and `x`
+///         may have any common scale.
+constexpr int32_t Atan2(int32_t y, int32_t x)
+{
+  const int64_t kX = (x < 0) ? -int64_t{ x } : int64_t{ x };
+  const int64_t kY = (y < 0) ? -int64_t{ y } : int64_t{ y };
+  if (kX == 0 && kY == 0)
+  {
+    return 0;
+  }
+
+  int32_t angle = 0;
+  if (kX >= kY)
+  {
+    angle = Atan(static_cast<int32_t>((kY << kUnitBits) / kX));
+  }
+  else
+  {
+    angle = kHalfPi - Atan(static_cast<int32_t>((kX << kUnitBits) / kY));
+  }
+
+  if (x < 0)
+  {
+    angle = kPi - angle;
+  }
+  return (y < 0) ? -angle : angle;
+}
+
+/// @return int32_t - `angle` moved into the range -pi to pi.
+constexpr int32_t Wrap(int32_t angle)
+{
+  if (angle > kPi)
+  {
+    return angle - (2 * kPi);
+  }
+  if (angle < -kPi)
+  {
+    return angle + (2 * kPi);
+  }
+  return angle;
+}
+
+/// @return int32_t - the sample period 1 / `sample_rate` in seconds, with
+///         kUnitBits fraction bits.
+/// @throw std::errc::invalid_argument - if the sample rate is not above 0.5Hz.
+inline int32_t SamplePeriod(units::frequency::hertz_t sample_rate)
+{
+  const float kRate = sample_rate.to<float>();
+  if (!(kRate > 0.5f))
+  {
+    throw Exception(std::errc::invalid_argument,
+                    "Sample rate must be above 0.5Hz.");
+  }
+  return static_cast<int32_t>(static_cast<float>(kOne) / kRate);
+}
+
+/// @throw std::errc::invalid_argument - if the batches differ in length.
+inline void CheckBatches(std::span<const Accelerometer::Acceleration_t> a,
+                         std::span<const Gyroscope::AngularVelocity_t> g)
+{
+  if (a.size() != g.size())
+  {
+    throw Exception(std::errc::invalid_argument,
+                    "Accelerometer and gyroscope batches must be the same "
+                    "length.");
+  }
+}
+}  // namespace internal
+
+/// Estimates roll and pitch by integrating the gyroscope, which is precise
+/// over short periods but drifts, and pulling the result towards the tilt
+/// given by the direction of gravity, which is noisy but does not drift.
+///
+/// The time constant sets the balance between the two: disturbances shorter
+/// than it follow the gyroscope, longer ones follow the accelerometer. Yaw is
+/// integrated from the gyroscope alone. Each axis is integrated from its own
+/// gyroscope axis, which holds for the small tilts of a balancing robot.
+///
+/// USAGE:
+///
+///    sjsu::fusion::ComplementaryFilter filter(1_kHz, 500ms);
+///    std::array<sjsu::Accelerometer::Acceleration_t, 32> accelerations;
+///    std::array<sjsu::Gyroscope::AngularVelocity_t, 32> rates;
+///
+///    // On the FIFO watermark interrupt:
+///    accelerometer.Read(accelerations);
+///    gyroscope.Read(rates);
+///    filter.Update(accelerations, rates);
+///    auto pitch = filter.GetAttitude().pitch;
+class ComplementaryFilter
+{
+ public:
+  /// @param sample_rate - rate at which both sensors are sampled.
+  /// @param time_constant - time over which the accelerometer corrects the
+  ///        gyroscope.
+  /// @throw std::errc::invalid_argument - if the sample rate is not above
+  ///        0.5Hz.
+  ComplementaryFilter(units::frequency::hertz_t sample_rate,
+                      std::chrono::nanoseconds time_constant)
+      : period_(internal::SamplePeriod(sample_rate))
+  {
+    // The weight of the accelerometer, dt / (tau + dt).
+    const auto kMicroseconds =
+        std::chrono::duration_cast<std::chrono::microseconds>(time_constant);
+    const int64_t kTau = (kMicroseconds.count() * internal::kOne) / 1'000'000;
+    correction_        = static_cast<int32_t>(
+        (int64_t{ period_ } << internal::kUnitBits) / (kTau + period_));
+  }
+
+  /// Process a batch of samples taken at the same times by both sensors.
+  ///
+  /// @param accelerations - accelerometer samples, oldest first.
+  /// @param rates - gyroscope samples, oldest first.
+  /// @throw std::errc::invalid_argument - if the batches differ in length.
+  void Update(std::span<const Accelerometer::Acceleration_t> accelerations,
+              std::span<const Gyroscope::AngularVelocity_t> rates)
+  {
+    using internal::Atan2;
+    using internal::Multiply;
+    using internal::ToFixed;
+    using internal::Wrap;
+    // Rad/s times seconds, down to the fraction bits of an angle.
+    constexpr int kStep =
+        internal::kRateBits + internal::kUnitBits - kAngleBits;
+    auto integrate = [this](int32_t angle, float rate) {
+      return Wrap(angle + Multiply(ToFixed(rate), period_, kStep));
+    };
+
+    internal::CheckBatches(accelerations, rates);
+
+    for (size_t i = 0; i < accelerations.size(); i++)
+    {
+      const int32_t kAx = ToFixed(accelerations[i].x.to<float>());
+      const int32_t kAy = ToFixed(accelerations[i].y.to<float>());
+      const int32_t kAz = ToFixed(accelerations[i].z.to<float>());
+
+      attitude_.roll  = integrate(attitude_.roll, rates[i].x.to<float>());
+      attitude_.pitch = integrate(attitude_.pitch, rates[i].y.to<float>());
+      attitude_.yaw   = integrate(attitude_.yaw, rates[i].z.to<float>());
+
+      if (kAx == 0 && kAy == 0 && kAz == 0)
+      {
+        continue;
+      }
+
+      const auto kHorizontal =
+          static_cast<int32_t>(internal::SquareRoot(static_cast<uint64_t>(
+              (int64_t{ kAy } * kAy) + (int64_t{ kAz } * kAz))));
+      auto correct = [this](int32_t angle, int32_t measured) {
+        return Wrap(angle + Multiply(Wrap(measured - angle),
+                                     correction_,
+                                     internal::kUnitBits));
+      };
+      attitude_.roll  = correct(attitude_.roll, Atan2(kAy, kAz));
+      attitude_.pitch = correct(attitude_.pitch, Atan2(-kAx, kHorizontal));
+    }
+  }
+
+  /// @return Attitude_t - the estimated orientation.
+  Attitude_t GetAttitude() const
+  {
+    return attitude_;
+  }
+
+  /// Start again from a level orientation.
+  void Reset()
+  {
+    attitude_ = {};
+  }
+
+ private:
+  int32_t period_;
+  int32_t correction_;
+  Attitude_t attitude_;
+};
+
+/// Feedback gains of a MahonyFilter.
+struct MahonyGains_t
+{
+  /// Proportional gain, in rad/s per unit of error. Higher values trust the
+  /// accelerometer more.
+  float proportional = 1.0f;
+  /// Integral gain, in rad/s^2 per unit of error. 0 disables the
+  /// estimation of gyroscope bias.
+  float integral = 0.0f;
+};
+
+/// Mahony's nonlinear complementary filter, which integrates the gyroscope
+/// into a quaternion and corrects it with a proportional and integral
+/// feedback of the error between the measured direction of gravity and the
+/// direction the quaternion predicts. The integral term learns the
+/// gyroscope's bias.
+///
+/// Unlike ComplementaryFilter, the quaternion handles any orientation and the
+/// coupling between the axes during large rotations. Yaw drifts with the
+/// gyroscope, as there is no magnetometer to correct it.
+///
+/// USAGE:
+///
+///    sjsu::fusion::MahonyFilter filter(1_kHz, { .proportional = 2.0f });
+///    accelerometer.Read(accelerations);
+///    gyroscope.Read(rates);
+///    filter.Update(accelerations, rates);
+///    auto attitude = filter.GetAttitude();
+class MahonyFilter
+{
+ public:
+  /// @param sample_rate - rate at which both sensors are sampled.
+  /// @param gains - feedback gains.
+  /// @throw std::errc::invalid_argument - if the sample rate is not above
+  ///        0.5Hz.
+  explicit MahonyFilter(units::frequency::hertz_t sample_rate,
+                        MahonyGains_t gains = {})
+      : period_(internal::SamplePeriod(sample_rate)),
+        proportional_(internal::ToFixed(gains.proportional)),
+        integral_gain_(internal::ToFixed(gains.integral))
+  {
+  }
+
+  /// Process a batch of samples taken at the same times by both sensors.
+  ///
+  /// @param accelerations - accelerometer samples, oldest first.
+  /// @param rates - gyroscope samples, oldest first.
+  /// @throw std::errc::invalid_argument - if the batches differ in length.
+  void Update(std::span<const Accelerometer::Acceleration_t> accelerations,
+              std::span<const Gyroscope::AngularVelocity_t> rates)
+  {
+    internal::CheckBatches(accelerations, rates);
+
+    for (size_t i = 0; i < accelerations.size(); i++)
+    {
+      Step(accelerations[i], rates[i]);
+    }
+  }
+
+  /// @return Quaternion_t - the estimated orientation.
+  Quaternion_t GetQuaternion() const
+  {
+    return quaternion_;
+  }
+
+  /// @return Attitude_t - the estimated orientation as roll, pitch and yaw.
+  Attitude_t GetAttitude() const
+  {
+    using internal::Atan2;
+    using internal::kOne;
+    constexpr int kBits = kQuaternionBits - 1;  // Products doubled.
+    const auto & [w, x, y, z] = quaternion_;
+
+    auto product = [](int32_t a, int32_t b) {
+      return internal::Multiply(a, b, kBits);
+    };
+
+    const int32_t kSinPitch =
+        std::clamp(product(w, y) - product(z, x), -kOne, kOne);
+    const int32_t kCosSquared =
+        kOne - internal::Multiply(kSinPitch, kSinPitch, kQuaternionBits);
+    const auto kCosPitch = static_cast<int32_t>(internal::SquareRoot(
+        static_cast<uint64_t>(kCosSquared) << kQuaternionBits));
+
+    return {
+      .roll  = Atan2(product(w, x) + product(y, z),
+                    kOne - product(x, x) - product(y, y)),
+      .pitch = Atan2(kSinPitch, kCosPitch),
+      .yaw   = Atan2(product(w, z) + product(x, y),
+                   kOne - product(y, y) - product(z, z)),
+    };
+  }
+
+  /// Start again from a level orientation with no learned bias.
+  void Reset()
+  {
+    quaternion_ = {};
+    bias_       = {};
+  }
+
+ private:
+  static constexpr int kBits = internal::kUnitBits;
+
+  void Step(const Accelerometer::Acceleration_t & acceleration,
+            const Gyroscope::AngularVelocity_t & rate)
+  {
+    using internal::Multiply;
+    using internal::ToFixed;
+
+    auto & [w, x, y, z] = quaternion_;
+    int32_t gx          = ToFixed(rate.x.to<float>());
+    int32_t gy          = ToFixed(rate.y.to<float>());
+    int32_t gz          = ToFixed(rate.z.to<float>());
+
+    const int32_t kAx         = ToFixed(acceleration.x.to<float>());
+    const int32_t kAy         = ToFixed(acceleration.y.to<float>());
+    const int32_t kAz         = ToFixed(acceleration.z.to<float>());
+    const uint32_t kMagnitude = internal::SquareRoot(static_cast<uint64_t>(
+        (int64_t{ kAx } * kAx) + (int64_t{ kAy } * kAy) +
+        (int64_t{ kAz } * kAz)));
+
+    if (kMagnitude != 0)
+    {
+      // Measured direction of gravity, as a unit vector.
+      const auto kInverse = static_cast<int32_t>(
+          (int64_t{ 1 } << (kBits + internal::kRateBits)) / kMagnitude);
+      const int32_t kUx = Multiply(kAx, kInverse, internal::kRateBits);
+      const int32_t kUy = Multiply(kAy, kInverse, internal::kRateBits);
+      const int32_t kUz = Multiply(kAz, kInverse, internal::kRateBits);
+
+      // Direction of gravity predicted by the quaternion.
+      const int32_t kVx =
+          Multiply(x, z, kBits - 1) - Multiply(w, y, kBits - 1);
+      const int32_t kVy =
+          Multiply(w, x, kBits - 1) + Multiply(y, z, kBits - 1);
+      const int32_t kVz = Multiply(w, w, kBits) - Multiply(x, x, kBits) -
+                          Multiply(y, y, kBits) + Multiply(z, z, kBits);
+
+      // The error is the rotation between them, their cross product.
+      const int32_t kEx =
+          Multiply(kUy, kVz, kBits) - Multiply(kUz, kVy, kBits);
+      const int32_t kEy =
+          Multiply(kUz, kVx, kBits) - Multiply(kUx, kVz, kBits);
+      const int32_t kEz =
+          Multiply(kUx, kVy, kBits) - Multiply(kUy, kVx, kBits);
+
+      if (integral_gain_ != 0)
+      {
+        // Kept with kUnitBits fraction bits, as the steps are tiny.
+        auto learn = [this](int32_t error) {
+          return Multiply(Multiply(integral_gain_, error, internal::kRateBits),
+                          period_,
+                          kBits);
+        };
+        bias_.x += learn(kEx);
+        bias_.y += learn(kEy);
+        bias_.z += learn(kEz);
+        gx += bias_.x >> (kBits - internal::kRateBits);
+        gy += bias_.y >> (kBits - internal::kRateBits);
+        gz += bias_.z >> (kBits - internal::kRateBits);
+      }
+
+      gx += Multiply(proportional_, kEx, kBits);
+      gy += Multiply(proportional_, kEy, kBits);
+      gz += Multiply(proportional_, kEz, kBits);
+    }
+
+    // Half of the rotation of this sample, in radians.
+    const int32_t kHx = Multiply(gx, period_, internal::kRateBits + 1);
+    const int32_t kHy = Multiply(gy, period_, internal::kRateBits + 1);
+    const int32_t kHz = Multiply(gz, period_, internal::kRateBits + 1);
+
+    const int32_t kW = w;
+    const int32_t kX = x;
+    const int32_t kY = y;
+    const int32_t kZ = z;
+    w += -Multiply(kX, kHx, kBits) - Multiply(kY, kHy, kBits) -
+         Multiply(kZ, kHz, kBits);
+    x += Multiply(kW, kHx, kBits) + Multiply(kY, kHz, kBits) -
+         Multiply(kZ, kHy, kBits);
+    y += Multiply(kW, kHy, kBits) - Multiply(kX, kHz, kBits) +
+         Multiply(kZ, kHx, kBits);
+    z += Multiply(kW, kHz, kBits) + Multiply(kX, kHy, kBits) -
+         Multiply(kY, kHx, kBits);
+
+    Normalize();
+  }
+
+  /// Scale the quaternion back to unit length. It only drifts from it by tiny
+  /// amounts each step, so two Newton iterations of 1 / sqrt(n), starting
+  /// from 1, are enough.
+  void Normalize()
+  {
+    auto & [w, x, y, z] = quaternion_;
+    const int64_t kNorm =
+        ((int64_t{ w } * w) + (int64_t{ x } * x) + (int64_t{ y } * y) +
+         (int64_t{ z } * z)) >>
+        kBits;
+
+    int64_t inverse = internal::kOne;
+    for (int i = 0; i < 2; i++)
+    {
+      const int64_t kSquare = (inverse * inverse) >> kBits;
+      inverse = (inverse * ((3 * int64_t{ internal::kOne }) -
+                            ((kNorm * kSquare) >> kBits))) >>
+                (kBits + 1);
+    }
+
+    const auto kInverse = static_cast<int32_t>(inverse);
+    w                   = internal::Multiply(w, kInverse, kBits);
+    x                   = internal::Multiply(x, kInverse, kBits);
+    y                   = internal::Multiply(y, kInverse, kBits);
+    z                   = internal::Multiply(z, kInverse, kBits);
+  }
+
+  struct Bias_t
+  {
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t z = 0;
+  };
+
+  int32_t period_;
+  int32_t proportional_;
+  int32_t integral_gain_;
+  Quaternion_t quaternion_;
+  Bias_t bias_;
+};
+}  // namespace sjsu::fusion
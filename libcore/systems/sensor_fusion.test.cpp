@@ -0,0 +1,342 @@
+#include <libcore/systems/sensor_fusion.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::fusion
+{
+namespace
+{
+using Acceleration_t    = Accelerometer::Acceleration_t;
+using AngularVelocity_t = Gyroscope::AngularVelocity_t;
+
+constexpr float kGravity = 9.80665f;
+
+/// Accelerometer sample of a device at rest, rolled and then pitched.
+Acceleration_t Tilted(float roll, float pitch)
+{
+  return {
+    .x = units::acceleration::meters_per_second_squared_t(-kGravity *
+                                                          std::sin(pitch)),
+    .y = units::acceleration::meters_per_second_squared_t(
+        kGravity * std::cos(pitch) * std::sin(roll)),
+    .z = units::acceleration::meters_per_second_squared_t(
+        kGravity * std::cos(pitch) * std::cos(roll)),
+  };
+}
+
+AngularVelocity_t Rotating(float x, float y, float z)
+{
+  return {
+    .x = units::angular_velocity::radians_per_second_t(x),
+    .y = units::angular_velocity::radians_per_second_t(y),
+    .z = units::angular_velocity::radians_per_second_t(z),
+  };
+}
+
+/// Reference floating point Mahony filter, with the same conventions.
+struct FloatMahony
+{
+  void Step(const Acceleration_t & a, const AngularVelocity_t & g, float dt)
+  {
+    float gx = g.x.to<float>();
+    float gy = g.y.to<float>();
+    float gz = g.z.to<float>();
+    float ax = a.x.to<float>();
+    float ay = a.y.to<float>();
+    float az = a.z.to<float>();
+
+    const float kNorm = std::sqrt((ax * ax) + (ay * ay) + (az * az));
+    ax /= kNorm;
+    ay /= kNorm;
+    az /= kNorm;
+    const float kVx = 2 * ((x * z) - (w * y));
+    const float kVy = 2 * ((w * x) + (y * z));
+    const float kVz = (w * w) - (x * x) - (y * y) + (z * z);
+    gx += proportional * ((ay * kVz) - (az * kVy));
+    gy += proportional * ((az * kVx) - (ax * kVz));
+    gz += proportional * ((ax * kVy) - (ay * kVx));
+
+    const float kHx = gx * dt / 2;
+    const float kHy = gy * dt / 2;
+    const float kHz = gz * dt / 2;
+    const float kW  = w;
+    const float kX  = x;
+    const float kY  = y;
+    const float kZ  = z;
+    w += (-kX * kHx) - (kY * kHy) - (kZ * kHz);
+    x += (kW * kHx) + (kY * kHz) - (kZ * kHy);
+    y += (kW * kHy) - (kX * kHz) + (kZ * kHx);
+    z += (kW * kHz) + (kX * kHy) - (kY * kHx);
+
+    const float kLength = std::sqrt((w * w) + (x * x) + (y * y) + (z * z));
+    w /= kLength;
+    x /= kLength;
+    y /= kLength;
+    z /= kLength;
+  }
+
+  float proportional = 1;
+  float w            = 1;
+  float x            = 0;
+  float y            = 0;
+  float z            = 0;
+};
+
+float Degrees(int32_t angle)
+{
+  return units::angle::degree_t(ToRadians(angle)).to<float>();
+}
+
+float FromQuaternion(int32_t component)
+{
+  return static_cast<float>(component) / (1 << kQuaternionBits);
+}
+}  // namespace
+
+TEST_CASE("Testing fusion internal::Atan2")
+{
+  SECTION("Matches std::atan2 around the circle")
+  {
+    // Setup
+    float worst = 0;
+
+    // Exercise
+    for (int degrees = -180; degrees <= 180; degrees += 5)
+    {
+      const double kAngle = degrees * dsp::internal::kPi / 180;
+      const auto kY = static_cast<int32_t>(std::lround(1e6 * std::sin(kAngle)));
+      const auto kX = static_cast<int32_t>(std::lround(1e6 * std::cos(kAngle)));
+      const float kError =
+          ToRadians(internal::Atan2(kY, kX)).to<float>() -
+          static_cast<float>(std::atan2(kY, kX));
+      worst = std::max(worst, std::abs(kError));
+    }
+
+    // Verify
+    CHECK(worst < 0.0016f);
+  }
+}
+
+TEST_CASE("Testing fusion::ComplementaryFilter")
+{
+  ComplementaryFilter filter(units::frequency::hertz_t(1000), 100ms);
+  std::vector<Acceleration_t> accelerations(1000);
+  std::vector<AngularVelocity_t> rates(1000, Rotating(0, 0, 0));
+
+  SECTION("Level and still stays level")
+  {
+    // Setup
+    std::fill(accelerations.begin(), accelerations.end(), Tilted(0, 0));
+
+    // Exercise
+    filter.Update(accelerations, rates);
+
+    // Verify
+    CHECK(0 == doctest::Approx(Degrees(filter.GetAttitude().roll)));
+    CHECK(0 == doctest::Approx(Degrees(filter.GetAttitude().pitch)));
+  }
+
+  SECTION("Converges to the tilt of gravity")
+  {
+    // Setup
+    std::fill(accelerations.begin(),
+              accelerations.end(),
+              Tilted(0.5f, -0.25f));
+
+    // Exercise
+    filter.Update(accelerations, rates);
+
+    // Verify
+    // 1s is 10 time constants.
+    CHECK(0.5f == doctest::Approx(
+                      ToRadians(filter.GetAttitude().roll).to<float>())
+                      .epsilon(0.005));
+    CHECK(-0.25f == doctest::Approx(
+                        ToRadians(filter.GetAttitude().pitch).to<float>())
+                        .epsilon(0.005));
+  }
+
+  SECTION("Follows the gyroscope over short periods")
+  {
+    // Setup
+    ComplementaryFilter slow(units::frequency::hertz_t(1000), 1000s);
+    std::fill(accelerations.begin(), accelerations.end(), Tilted(0, 0));
+    std::fill(rates.begin(), rates.end(), Rotating(0.5f, 0, -1));
+
+    // Exercise
+    slow.Update(std::span(accelerations).first(200),
+                std::span(rates).first(200));
+
+    // Verify
+    CHECK(0.1f == doctest::Approx(
+                      ToRadians(slow.GetAttitude().roll).to<float>())
+                      .epsilon(0.001));
+    CHECK(-0.2f == doctest::Approx(
+                       ToRadians(slow.GetAttitude().yaw).to<float>())
+                       .epsilon(0.001));
+  }
+
+  SECTION("Batches give the same result as single samples")
+  {
+    // Setup
+    ComplementaryFilter single(units::frequency::hertz_t(1000), 100ms);
+    for (size_t i = 0; i < accelerations.size(); i++)
+    {
+      const float kTime = static_cast<float>(i) / 1000;
+      accelerations[i]  = Tilted(std::sin(kTime * 5), 0.1f);
+      rates[i]          = Rotating(5 * std::cos(kTime * 5), 0, 0);
+    }
+
+    // Exercise
+    filter.Update(accelerations, rates);
+    for (size_t i = 0; i < accelerations.size(); i++)
+    {
+      single.Update(std::span(accelerations).subspan(i, 1),
+                    std::span(rates).subspan(i, 1));
+    }
+
+    // Verify
+    CHECK(single.GetAttitude().roll == filter.GetAttitude().roll);
+    CHECK(single.GetAttitude().pitch == filter.GetAttitude().pitch);
+  }
+
+  SECTION("Batches must be the same length")
+  {
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(filter.Update(std::span(accelerations).first(4),
+                                      std::span(rates).first(3)),
+                        std::errc::invalid_argument);
+  }
+}
+
+TEST_CASE("Testing fusion::MahonyFilter")
+{
+  MahonyFilter filter(units::frequency::hertz_t(1000),
+                      { .proportional = 1.0f });
+  std::vector<Acceleration_t> accelerations(2000);
+  std::vector<AngularVelocity_t> rates(2000, Rotating(0, 0, 0));
+
+  SECTION("Starts level and stays there when still")
+  {
+    // Setup
+    std::fill(accelerations.begin(), accelerations.end(), Tilted(0, 0));
+
+    // Exercise
+    filter.Update(accelerations, rates);
+
+    // Verify
+    const Quaternion_t kQuaternion = filter.GetQuaternion();
+    CHECK(1.0f == doctest::Approx(FromQuaternion(kQuaternion.w)));
+    CHECK(0.0f == doctest::Approx(FromQuaternion(kQuaternion.x)));
+    CHECK(0.0f == doctest::Approx(FromQuaternion(kQuaternion.y)));
+  }
+
+  SECTION("Converges to the tilt of gravity")
+  {
+    // Setup
+    std::fill(accelerations.begin(),
+              accelerations.end(),
+              Tilted(-0.6f, 0.3f));
+
+    // Exercise
+    for (int second = 0; second < 5; second++)
+    {
+      filter.Update(accelerations, rates);
+    }
+
+    // Verify
+    const Attitude_t kAttitude = filter.GetAttitude();
+    CHECK(-0.6f == doctest::Approx(ToRadians(kAttitude.roll).to<float>())
+                       .epsilon(0.005));
+    CHECK(0.3f == doctest::Approx(ToRadians(kAttitude.pitch).to<float>())
+                      .epsilon(0.005));
+  }
+
+  SECTION("Integrates yaw from the gyroscope")
+  {
+    // Setup
+    std::fill(accelerations.begin(), accelerations.end(), Tilted(0, 0));
+    std::fill(rates.begin(), rates.end(), Rotating(0, 0, 0.75f));
+
+    // Exercise
+    filter.Update(accelerations, rates);
+
+    // Verify
+    CHECK(1.5f == doctest::Approx(
+                      ToRadians(filter.GetAttitude().yaw).to<float>())
+                      .epsilon(0.002));
+  }
+
+  SECTION("Matches a floating point implementation")
+  {
+    // Setup
+    FloatMahony reference;
+    for (size_t i = 0; i < accelerations.size(); i++)
+    {
+      const float kTime = static_cast<float>(i) / 1000;
+      accelerations[i]  = Tilted(0.8f * std::sin(kTime * 3), 0.2f);
+      rates[i]          = Rotating(
+          2.4f * std::cos(kTime * 3), 0.1f, 0.3f * std::sin(kTime));
+    }
+
+    // Exercise
+    filter.Update(accelerations, rates);
+    for (size_t i = 0; i < accelerations.size(); i++)
+    {
+      reference.Step(accelerations[i], rates[i], 0.001f);
+    }
+
+    // Verify
+    const Quaternion_t kQuaternion = filter.GetQuaternion();
+    CHECK(reference.w ==
+          doctest::Approx(FromQuaternion(kQuaternion.w)).epsilon(0.001));
+    CHECK(reference.x ==
+          doctest::Approx(FromQuaternion(kQuaternion.x)).epsilon(0.001));
+    CHECK(reference.y ==
+          doctest::Approx(FromQuaternion(kQuaternion.y)).epsilon(0.001));
+    CHECK(reference.z ==
+          doctest::Approx(FromQuaternion(kQuaternion.z)).epsilon(0.001));
+  }
+
+  SECTION("Integral feedback removes gyroscope bias")
+  {
+    // Setup
+    MahonyFilter learning(units::frequency::hertz_t(1000),
+                          { .proportional = 1.0f, .integral = 0.5f });
+    std::fill(accelerations.begin(), accelerations.end(), Tilted(0, 0));
+    std::fill(rates.begin(), rates.end(), Rotating(0.05f, 0, 0));
+
+    // Exercise
+    for (int second = 0; second < 10; second++)
+    {
+      learning.Update(accelerations, rates);
+      filter.Update(accelerations, rates);
+    }
+
+    // Verify
+    // Proportional feedback alone is left with an error of bias / Kp.
+    CHECK(0.05f == doctest::Approx(
+                       ToRadians(filter.GetAttitude().roll).to<float>())
+                       .epsilon(0.01));
+    CHECK(std::abs(Degrees(learning.GetAttitude().roll)) < 0.05f);
+  }
+
+  SECTION("Reset() returns to level")
+  {
+    // Setup
+    std::fill(accelerations.begin(), accelerations.end(), Tilted(1, 0));
+    filter.Update(accelerations, rates);
+
+    // Exercise
+    filter.Reset();
+
+    // Verify
+    CHECK(0 == filter.GetAttitude().roll);
+  }
+}
+}  // namespace sjsu::fusion
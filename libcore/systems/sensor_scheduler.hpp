@@ -0,0 +1,245 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include <libcore/utility/inplace_function.hpp>
+#include <libcore/utility/result.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Polls sensors at their own rates from a single loop, grouping the reads of
+/// each bus together.
+///
+/// Each sensor is registered with a SensorScheduler::Sensor, which holds the
+/// function that reads it, how often to read it, the bus it is on, and the
+/// latest value read along with when it was read. Readers use the cached value
+/// rather than reading the sensor themselves.
+///
+/// Poll(), called from the loop, reads every sensor that is due. When a sensor
+/// is due, every other sensor on the same bus that would be due within the
+/// scheduler's grouping window is read right after it, so the transfers of a
+/// bus happen back to back rather than spread over many polls, and the loop
+/// can sleep until NextDue() between groups.
+///
+/// A read that fails keeps the previous value, whose timestamp then tells how
+/// stale it is, and counts a failure for the sensor.
+///
+/// USAGE:
+///
+///    sjsu::SensorScheduler scheduler(5ms);
+///    sjsu::SensorScheduler::Sensor<units::temperature::celsius_t> temperature(
+///        scheduler, i2c, 1s, [&tmp102]() { return tmp102.GetTemperature(); });
+///    sjsu::SensorScheduler::Sensor<units::illuminance::lux_t> light(
+///        scheduler, i2c, 100ms, [&tsl]() { return tsl.GetIlluminance(); });
+///
+///    while (true)
+///    {
+///      scheduler.Poll();
+///      Display(temperature.Get(), light.Get());
+///      sjsu::Delay(scheduler.NextDue() - sjsu::Uptime());
+///    }
+class SensorScheduler
+{
+ private:
+  /// Scheduling state of a sensor, independent of the type of its value.
+  class Entry
+  {
+   public:
+    Entry(SensorScheduler & scheduler,
+          const void * bus,
+          std::chrono::nanoseconds period)
+        : scheduler_(scheduler),
+          bus_(bus),
+          period_(period),
+          next_due_(Uptime()),
+          next_(scheduler.entries_)
+    {
+      scheduler_.entries_ = this;
+    }
+
+    Entry(const Entry &) = delete;
+    Entry & operator=(const Entry &) = delete;
+
+    virtual ~Entry()
+    {
+      for (Entry ** entry = &scheduler_.entries_; *entry != nullptr;
+           entry          = &(*entry)->next_)
+      {
+        if (*entry == this)
+        {
+          *entry = next_;
+          break;
+        }
+      }
+    }
+
+   protected:
+    /// Read the sensor and cache its value.
+    virtual void Sample() = 0;
+
+   private:
+    friend class SensorScheduler;
+
+    SensorScheduler & scheduler_;
+    const void * bus_;
+    std::chrono::nanoseconds period_;
+    std::chrono::nanoseconds next_due_;
+    Entry * next_;
+  };
+
+ public:
+  /// A sensor read by a SensorScheduler, for as long as it exists.
+  ///
+  /// @tparam T - type of the value read from the sensor.
+  template <typename T>
+  class Sensor : public Entry
+  {
+   public:
+    /// Function that reads the sensor. It may report errors by throwing
+    /// sjsu::Exception, as drivers do.
+    using ReadFunction = InplaceFunction<T(void)>;
+
+    /// @param scheduler - scheduler to register with. The sensor is first read
+    ///        by the next Poll().
+    /// @param bus - the I2c, SpiBus or other peripheral the sensor is read
+    ///        through. Sensors are grouped by the address of their bus.
+    /// @param period - time between reads.
+    /// @param read - function that reads the sensor.
+    template <typename Bus>
+    Sensor(SensorScheduler & scheduler,
+           Bus & bus,
+           std::chrono::nanoseconds period,
+           ReadFunction read)
+        : Entry(scheduler, &bus, period), read_(std::move(read))
+    {
+    }
+
+    /// @return const T& - the latest value read, or a value initialized T if
+    ///         the sensor has not been read successfully yet.
+    const T & Get() const
+    {
+      return value_;
+    }
+
+    /// @return true - if the sensor has been read successfully at least once.
+    bool HasValue() const
+    {
+      return timestamp_.has_value();
+    }
+
+    /// @return std::chrono::nanoseconds - uptime when the latest value was
+    ///         read, or 0 if the sensor has not been read successfully yet.
+    std::chrono::nanoseconds Timestamp() const
+    {
+      return timestamp_.value_or(0ns);
+    }
+
+    /// @return uint32_t - number of reads that have failed.
+    uint32_t Failures() const
+    {
+      return failures_;
+    }
+
+   protected:
+    void Sample() override
+    {
+      const auto kStart = Uptime();
+      auto result       = Capture([this]() { return read_(); });
+      if (result)
+      {
+        value_     = std::move(result.Value());
+        timestamp_ = kStart;
+      }
+      else
+      {
+        failures_++;
+      }
+    }
+
+   private:
+    ReadFunction read_;
+    T value_ = {};
+    std::optional<std::chrono::nanoseconds> timestamp_;
+    uint32_t failures_ = 0;
+  };
+
+  /// @param grouping_window - how far ahead of being due a sensor is read
+  ///        along with a due sensor on the same bus. 0 only groups sensors
+  ///        that are due at the same time.
+  explicit SensorScheduler(std::chrono::nanoseconds grouping_window = 0ns)
+      : grouping_window_(grouping_window)
+  {
+  }
+
+  SensorScheduler(const SensorScheduler &) = delete;
+  SensorScheduler & operator=(const SensorScheduler &) = delete;
+
+  /// Read every sensor that is due, along with the sensors on the same bus
+  /// that are due within the grouping window.
+  ///
+  /// @return size_t - number of sensors read.
+  size_t Poll()
+  {
+    const auto kNow = Uptime();
+    size_t reads    = 0;
+
+    for (Entry * due = entries_; due != nullptr; due = due->next_)
+    {
+      if (due->next_due_ > kNow)
+      {
+        continue;
+      }
+
+      // Read the whole group of the bus, which moves every sensor of the
+      // group past `kNow`, so the bus is not visited again by this poll.
+      const void * bus = due->bus_;
+      for (Entry * entry = entries_; entry != nullptr; entry = entry->next_)
+      {
+        if (entry->bus_ == bus &&
+            entry->next_due_ <= kNow + grouping_window_)
+        {
+          entry->Sample();
+          reads++;
+          Reschedule(*entry, kNow);
+        }
+      }
+    }
+
+    return reads;
+  }
+
+  /// @return std::chrono::nanoseconds - uptime at which the next sensor is
+  ///         due, or the maximum duration if there are no sensors.
+  std::chrono::nanoseconds NextDue() const
+  {
+    auto next = std::chrono::nanoseconds::max();
+    for (const Entry * entry = entries_; entry != nullptr;
+         entry               = entry->next_)
+    {
+      next = std::min(next, entry->next_due_);
+    }
+    return next;
+  }
+
+ private:
+  /// Move a sensor to its next period, skipping the periods missed while the
+  /// loop was busy rather than reading it repeatedly to catch up.
+  static void Reschedule(Entry & entry, std::chrono::nanoseconds now)
+  {
+    entry.next_due_ += entry.period_;
+    if (entry.next_due_ <= now)
+    {
+      entry.next_due_ = now + entry.period_;
+    }
+  }
+
+  std::chrono::nanoseconds grouping_window_;
+  Entry * entries_ = nullptr;
+};
+}  // namespace sjsu
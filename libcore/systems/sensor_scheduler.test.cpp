@@ -0,0 +1,182 @@
+#include <libcore/systems/sensor_scheduler.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <system_error>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing SensorScheduler")
+{
+  VirtualClock clock;
+  clock.Start();
+
+  // Buses are only told apart by their address.
+  int i2c = 0;
+  int spi = 0;
+
+  std::string reads;
+  auto reader = [&reads](char name) {
+    return [&reads, name]() {
+      reads += name;
+      return static_cast<int>(reads.size());
+    };
+  };
+
+  SECTION("Sensors are read at their own periods")
+  {
+    // Setup
+    SensorScheduler scheduler;
+    SensorScheduler::Sensor<int> fast(scheduler, i2c, 10ms, reader('f'));
+    SensorScheduler::Sensor<int> slow(scheduler, spi, 25ms, reader('s'));
+
+    // Exercise
+    for (int poll = 0; poll <= 50; poll++)
+    {
+      scheduler.Poll();
+      clock.Advance(1ms);
+    }
+
+    // Verify
+    CHECK(6 == std::count(reads.begin(), reads.end(), 'f'));
+    CHECK(3 == std::count(reads.begin(), reads.end(), 's'));
+    CHECK(50ms == slow.Timestamp());
+    CHECK(50ms == fast.Timestamp());
+  }
+
+  SECTION("Latest value and its timestamp are cached")
+  {
+    // Setup
+    SensorScheduler scheduler;
+    SensorScheduler::Sensor<int> sensor(scheduler, i2c, 10ms, reader('a'));
+
+    // Exercise & Verify
+    CHECK(!sensor.HasValue());
+    CHECK(0 == sensor.Get());
+    CHECK(1 == scheduler.Poll());
+    CHECK(sensor.HasValue());
+    CHECK(1 == sensor.Get());
+    CHECK(0ns == sensor.Timestamp());
+
+    clock.Advance(4ms);
+    CHECK(0 == scheduler.Poll());
+    CHECK(1 == sensor.Get());
+
+    clock.Advance(7ms);
+    CHECK(1 == scheduler.Poll());
+    CHECK(2 == sensor.Get());
+    CHECK(11ms == sensor.Timestamp());
+    CHECK(20ms == scheduler.NextDue());
+  }
+
+  SECTION("Sensors on a bus are read back to back within the window")
+  {
+    // Setup
+    SensorScheduler scheduler(5ms);
+    SensorScheduler::Sensor<int> a(scheduler, i2c, 20ms, reader('a'));
+    SensorScheduler::Sensor<int> x(scheduler, spi, 20ms, reader('x'));
+    scheduler.Poll();
+    clock.Advance(3ms);
+    SensorScheduler::Sensor<int> b(scheduler, i2c, 20ms, reader('b'));
+    SensorScheduler::Sensor<int> y(scheduler, spi, 20ms, reader('y'));
+    scheduler.Poll();
+    reads.clear();
+
+    // Exercise
+    // "a" and "x" are due at 20ms, "b" and "y" at 23ms.
+    clock.Advance(17ms);
+    const size_t kCount = scheduler.Poll();
+
+    // Verify
+    CHECK(4 == kCount);
+    CHECK(1 == std::abs(static_cast<int>(reads.find('a') - reads.find('b'))));
+    CHECK(1 == std::abs(static_cast<int>(reads.find('x') - reads.find('y'))));
+    CHECK(40ms == scheduler.NextDue());
+    CHECK(0 == scheduler.Poll());
+  }
+
+  SECTION("Sensors outside of the window wait for their own period")
+  {
+    // Setup
+    SensorScheduler scheduler(2ms);
+    SensorScheduler::Sensor<int> a(scheduler, i2c, 20ms, reader('a'));
+    clock.Advance(3ms);
+    SensorScheduler::Sensor<int> b(scheduler, i2c, 20ms, reader('b'));
+    scheduler.Poll();
+    reads.clear();
+
+    // Exercise
+    clock.Advance(17ms);
+    scheduler.Poll();
+    clock.Advance(3ms);
+    scheduler.Poll();
+
+    // Verify
+    CHECK("ab" == reads);
+  }
+
+  SECTION("Missed periods are skipped rather than caught up")
+  {
+    // Setup
+    SensorScheduler scheduler;
+    SensorScheduler::Sensor<int> sensor(scheduler, i2c, 10ms, reader('a'));
+    scheduler.Poll();
+
+    // Exercise
+    clock.Advance(55ms);
+    scheduler.Poll();
+    scheduler.Poll();
+
+    // Verify
+    CHECK("aa" == reads);
+    CHECK(65ms == scheduler.NextDue());
+  }
+
+  SECTION("Failed reads keep the previous value")
+  {
+    // Setup
+    bool fail = false;
+    SensorScheduler scheduler;
+    SensorScheduler::Sensor<int> sensor(scheduler, i2c, 10ms, [&fail]() {
+      if (fail)
+      {
+        throw Exception(std::errc::io_error, "No acknowledge");
+      }
+      return 42;
+    });
+    scheduler.Poll();
+
+    // Exercise
+    fail = true;
+    clock.Advance(10ms);
+    scheduler.Poll();
+
+    // Verify
+    CHECK(42 == sensor.Get());
+    CHECK(0ns == sensor.Timestamp());
+    CHECK(1 == sensor.Failures());
+  }
+
+  SECTION("Sensors leave the scheduler when destroyed")
+  {
+    // Setup
+    SensorScheduler scheduler;
+    SensorScheduler::Sensor<int> kept(scheduler, i2c, 10ms, reader('k'));
+    {
+      SensorScheduler::Sensor<int> removed(scheduler, i2c, 5ms, reader('r'));
+    }
+
+    // Exercise
+    scheduler.Poll();
+
+    // Verify
+    CHECK("k" == reads);
+    CHECK(10ms == scheduler.NextDue());
+  }
+}
+}  // namespace sjsu
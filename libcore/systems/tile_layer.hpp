@@ -0,0 +1,473 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include <libcore/devices/pixel_display.hpp>
+#include <libcore/systems/graphics.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu
+{
+/// A background of RGB565 tiles with sprites composited on top, drawn through
+/// Graphics. Only the cells of the viewport that changed since the last
+/// Render() are redrawn, such as the tiles under a moving sprite, so animated
+/// screens cost a few tiles per frame rather than a full redraw.
+///
+/// The map is a grid of tile numbers, each an index into a tile set of square
+/// RGB565 bitmaps, which can stay in flash. The viewport shows part of the
+/// map, or all of it, at a scroll position that wraps around the edges of the
+/// map. So a dashboard can scroll forever by writing new tiles into the part
+/// of the map that is about to come into view.
+///
+/// Sprites are RGB565 bitmaps drawn over the tiles, positioned in pixels
+/// relative to the viewport, so they stay in place as the map scrolls. Pixels
+/// equal to kTransparent are not drawn. Sprites added later are drawn on top.
+///
+/// Each cell is composed in a tile sized buffer and drawn with a single
+/// Graphics::DrawBitmap(). Cells of aligned tiles without sprites are drawn
+/// straight from the tile set.
+///
+/// USAGE:
+///
+///    sjsu::TileLayer<8, 32, 8> layer(graphics, kTiles, 0, 0, 16, 8);
+///    layer.Fill(kSky);
+///    const size_t kCar = layer.AddSprite(kCarPixels, 16, 8, 10, 48);
+///
+///    while (true)
+///    {
+///      layer.ScrollTo(offset++, 0);
+///      layer.MoveSprite(kCar, 10, 48 + bounce);
+///      layer.Render();
+///      graphics.Update();
+///    }
+///
+/// @tparam kTileSize - width and height of a tile in pixels.
+/// @tparam kColumns - number of columns of tiles in the map.
+/// @tparam kRows - number of rows of tiles in the map.
+/// @tparam kMaximumSprites - number of sprites that can be added.
+template <size_t kTileSize,
+          size_t kColumns,
+          size_t kRows,
+          size_t kMaximumSprites = 8>
+class TileLayer
+{
+ public:
+  static_assert(kTileSize > 0 && kColumns > 0 && kRows > 0,
+                "The map and its tiles must not be empty.");
+
+  /// Sprite pixels with this value are not drawn, letting the tiles beneath
+  /// show through. Magenta, as in most sprite editors.
+  static constexpr uint16_t kTransparent = 0xF81F;
+  /// Number of pixels of a tile.
+  static constexpr size_t kTilePixels = kTileSize * kTileSize;
+  /// Width of the map in pixels.
+  static constexpr int32_t kMapWidth =
+      static_cast<int32_t>(kColumns * kTileSize);
+  /// Height of the map in pixels.
+  static constexpr int32_t kMapHeight =
+      static_cast<int32_t>(kRows * kTileSize);
+
+  /// @param graphics - graphics to draw with. The viewport must be within its
+  ///        display.
+  /// @param tile_set - the tiles, each kTilePixels RGB565 pixels, row by row.
+  ///        Must outlive this object.
+  /// @param x - x coordinate of the viewport on the display.
+  /// @param y - y coordinate of the viewport on the display.
+  /// @param columns - width of the viewport in tiles, at most kColumns.
+  /// @param rows - height of the viewport in tiles, at most kRows.
+  /// @throw std::errc::invalid_argument - if the viewport is empty or larger
+  ///        than the map, or the tile set holds no tiles.
+  TileLayer(Graphics & graphics,
+            std::span<const uint16_t> tile_set,
+            int32_t x,
+            int32_t y,
+            size_t columns,
+            size_t rows)
+      : graphics_(graphics),
+        tile_set_(tile_set),
+        viewport_{ .x      = x,
+                   .y      = y,
+                   .width  = static_cast<int32_t>(columns * kTileSize),
+                   .height = static_cast<int32_t>(rows * kTileSize) },
+        view_columns_(columns),
+        view_rows_(rows)
+  {
+    if (columns == 0 || rows == 0 || columns > kColumns || rows > kRows ||
+        tile_set.size() < kTilePixels)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Viewport must be between one tile and the size of the "
+                      "map, and the tile set must hold a tile.");
+    }
+    Invalidate();
+  }
+
+  /// Set the tile of a cell of the map. The viewport cells showing it are
+  /// redrawn on the next Render() if the tile changed.
+  ///
+  /// @param column - column of the map, less than kColumns.
+  /// @param row - row of the map, less than kRows.
+  /// @param tile - index of the tile in the tile set.
+  /// @throw std::errc::invalid_argument - if the cell is outside of the map or
+  ///        the tile is not in the tile set.
+  void SetTile(size_t column, size_t row, uint16_t tile)
+  {
+    if (column >= kColumns || row >= kRows || tile >= TileCount())
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Cell is outside of the map or tile is not in the "
+                      "tile set.");
+    }
+    if (map_[row][column] == tile)
+    {
+      return;
+    }
+
+    map_[row][column] = tile;
+
+    // Where the tile appears in the viewport, including its copies one map
+    // to the left and above, for the viewport wrapping around the map.
+    const int32_t kX =
+        Wrap(static_cast<int32_t>(column * kTileSize) - scroll_x_, kMapWidth);
+    const int32_t kY =
+        Wrap(static_cast<int32_t>(row * kTileSize) - scroll_y_, kMapHeight);
+    for (int32_t x : { kX, kX - kMapWidth })
+    {
+      for (int32_t y : { kY, kY - kMapHeight })
+      {
+        Invalidate({ .x      = x,
+                     .y      = y,
+                     .width  = static_cast<int32_t>(kTileSize),
+                     .height = static_cast<int32_t>(kTileSize) });
+      }
+    }
+  }
+
+  /// @param column - column of the map, less than kColumns.
+  /// @param row - row of the map, less than kRows.
+  /// @return uint16_t - the tile of the cell.
+  uint16_t GetTile(size_t column, size_t row) const
+  {
+    return map_[row][column];
+  }
+
+  /// Set every cell of the map to the same tile.
+  ///
+  /// @param tile - index of the tile in the tile set.
+  /// @throw std::errc::invalid_argument - if the tile is not in the tile set.
+  void Fill(uint16_t tile)
+  {
+    if (tile >= TileCount())
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Tile is not in the tile set.");
+    }
+    for (auto & row : map_)
+    {
+      row.fill(tile);
+    }
+    Invalidate();
+  }
+
+  /// Scroll the map so that the pixel of the map at (x, y) is drawn at the
+  /// top left of the viewport. Positions wrap around the map.
+  ///
+  /// @param x - x coordinate within the map, in pixels.
+  /// @param y - y coordinate within the map, in pixels.
+  void ScrollTo(int32_t x, int32_t y)
+  {
+    x = Wrap(x, kMapWidth);
+    y = Wrap(y, kMapHeight);
+    if (x != scroll_x_ || y != scroll_y_)
+    {
+      scroll_x_ = x;
+      scroll_y_ = y;
+      Invalidate();
+    }
+  }
+
+  /// Add a sprite, drawn on top of the tiles and of the sprites added before
+  /// it.
+  ///
+  /// @param pixels - `width * height` RGB565 pixels, row by row. Must outlive
+  ///        the sprite.
+  /// @param width - width of the sprite in pixels.
+  /// @param height - height of the sprite in pixels.
+  /// @param x - x coordinate of the sprite within the viewport.
+  /// @param y - y coordinate of the sprite within the viewport.
+  /// @return size_t - the sprite's handle.
+  /// @throw std::errc::invalid_argument - if `pixels` is too small.
+  /// @throw std::errc::no_buffer_space - if kMaximumSprites sprites have been
+  ///        added.
+  size_t AddSprite(std::span<const uint16_t> pixels,
+                   int32_t width,
+                   int32_t height,
+                   int32_t x,
+                   int32_t y)
+  {
+    if (width < 0 || height < 0 ||
+        pixels.size() < static_cast<size_t>(width) * height)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Sprite pixels are fewer than its width times height.");
+    }
+
+    for (size_t handle = 0; handle < sprites_.size(); handle++)
+    {
+      if (!sprites_[handle].added)
+      {
+        sprites_[handle] = Sprite_t{
+          .pixels  = pixels.first(static_cast<size_t>(width) * height),
+          .area    = { .x = x, .y = y, .width = width, .height = height },
+          .visible = true,
+          .added   = true,
+        };
+        Invalidate(sprites_[handle].area);
+        return handle;
+      }
+    }
+
+    throw Exception(std::errc::no_buffer_space,
+                    "No more sprites can be added to the tile layer.");
+  }
+
+  /// Move a sprite. The cells it leaves and enters are redrawn on the next
+  /// Render().
+  ///
+  /// @param sprite - the sprite's handle, from AddSprite().
+  /// @param x - new x coordinate within the viewport.
+  /// @param y - new y coordinate within the viewport.
+  void MoveSprite(size_t sprite, int32_t x, int32_t y)
+  {
+    Sprite_t & moved = sprites_.at(sprite);
+    if (moved.area.x == x && moved.area.y == y)
+    {
+      return;
+    }
+    if (moved.visible)
+    {
+      Invalidate(moved.area);
+    }
+    moved.area.x = x;
+    moved.area.y = y;
+    if (moved.visible)
+    {
+      Invalidate(moved.area);
+    }
+  }
+
+  /// Show or hide a sprite.
+  ///
+  /// @param sprite - the sprite's handle, from AddSprite().
+  /// @param visible - true to draw the sprite.
+  void ShowSprite(size_t sprite, bool visible)
+  {
+    Sprite_t & shown = sprites_.at(sprite);
+    if (shown.visible != visible)
+    {
+      shown.visible = visible;
+      Invalidate(shown.area);
+    }
+  }
+
+  /// Remove a sprite, freeing its handle for another sprite.
+  ///
+  /// @param sprite - the sprite's handle, from AddSprite().
+  void RemoveSprite(size_t sprite)
+  {
+    ShowSprite(sprite, false);
+    sprites_.at(sprite) = Sprite_t{};
+  }
+
+  /// Redraw the whole viewport on the next Render().
+  void Invalidate()
+  {
+    dirty_.set();
+  }
+
+  /// Draw the cells of the viewport that changed since the last call. Call
+  /// Graphics::Update() afterwards to send them to the display.
+  ///
+  /// @return size_t - number of cells drawn.
+  size_t Render()
+  {
+    const bool kAligned =
+        (scroll_x_ % kTileSize) == 0 && (scroll_y_ % kTileSize) == 0;
+    size_t drawn = 0;
+
+    for (size_t row = 0; row < view_rows_; row++)
+    {
+      for (size_t column = 0; column < view_columns_; column++)
+      {
+        if (!dirty_.test((row * kColumns) + column))
+        {
+          continue;
+        }
+
+        const PixelDisplay::Region_t kCell = {
+          .x      = static_cast<int32_t>(column * kTileSize),
+          .y      = static_cast<int32_t>(row * kTileSize),
+          .width  = static_cast<int32_t>(kTileSize),
+          .height = static_cast<int32_t>(kTileSize),
+        };
+
+        if (kAligned && !HasSprite(kCell))
+        {
+          DrawCell(kCell, Tile(TileAt(kCell.x, kCell.y)));
+        }
+        else
+        {
+          Compose(kCell);
+          DrawCell(kCell, cell_);
+        }
+        drawn++;
+      }
+    }
+
+    dirty_.reset();
+    return drawn;
+  }
+
+ private:
+  struct Sprite_t
+  {
+    std::span<const uint16_t> pixels = {};
+    PixelDisplay::Region_t area      = {};
+    bool visible                     = false;
+    bool added                       = false;
+  };
+
+  /// @return int32_t - `value` wrapped into [0, size).
+  static constexpr int32_t Wrap(int32_t value, int32_t size)
+  {
+    const int32_t kRemainder = value % size;
+    return (kRemainder < 0) ? kRemainder + size : kRemainder;
+  }
+
+  size_t TileCount() const
+  {
+    return tile_set_.size() / kTilePixels;
+  }
+
+  std::span<const uint16_t> Tile(uint16_t tile) const
+  {
+    return tile_set_.subspan(tile * kTilePixels, kTilePixels);
+  }
+
+  /// @return uint16_t - the tile shown at a pixel of the viewport.
+  uint16_t TileAt(int32_t x, int32_t y) const
+  {
+    const int32_t kX = Wrap(x + scroll_x_, kMapWidth);
+    const int32_t kY = Wrap(y + scroll_y_, kMapHeight);
+    return map_[kY / kTileSize][kX / kTileSize];
+  }
+
+  /// Mark the cells of the viewport covering `area`, in viewport pixels.
+  void Invalidate(PixelDisplay::Region_t area)
+  {
+    area = area.Intersection(
+        { .width = viewport_.width, .height = viewport_.height });
+    if (area.IsEmpty())
+    {
+      return;
+    }
+
+    const size_t kLeft   = static_cast<size_t>(area.x) / kTileSize;
+    const size_t kRight  = static_cast<size_t>(area.Right() - 1) / kTileSize;
+    const size_t kTop    = static_cast<size_t>(area.y) / kTileSize;
+    const size_t kBottom = static_cast<size_t>(area.Bottom() - 1) / kTileSize;
+    for (size_t row = kTop; row <= kBottom; row++)
+    {
+      for (size_t column = kLeft; column <= kRight; column++)
+      {
+        dirty_.set((row * kColumns) + column);
+      }
+    }
+  }
+
+  bool HasSprite(PixelDisplay::Region_t cell) const
+  {
+    return std::any_of(
+        sprites_.begin(), sprites_.end(), [cell](const Sprite_t & sprite) {
+          return sprite.visible && !sprite.area.Intersection(cell).IsEmpty();
+        });
+  }
+
+  /// Fill cell_ with the tiles and sprites shown in `cell`.
+  void Compose(PixelDisplay::Region_t cell)
+  {
+    for (size_t row = 0; row < kTileSize; row++)
+    {
+      const int32_t kY =
+          Wrap(cell.y + static_cast<int32_t>(row) + scroll_y_, kMapHeight);
+      const auto & kTiles  = map_[kY / kTileSize];
+      const size_t kTileY  = (kY % kTileSize) * kTileSize;
+      int32_t x            = Wrap(cell.x + scroll_x_, kMapWidth);
+      uint16_t * const kTo = &cell_[row * kTileSize];
+
+      // Copy the row a tile at a time, as a cell that is not aligned to the
+      // map spans two tiles.
+      for (size_t column = 0; column < kTileSize;)
+      {
+        const size_t kTileX = x % kTileSize;
+        const size_t kCount = std::min(kTileSize - kTileX, kTileSize - column);
+        const auto kFrom    = Tile(kTiles[x / kTileSize]).subspan(
+            kTileY + kTileX, kCount);
+        std::copy(kFrom.begin(), kFrom.end(), kTo + column);
+        column += kCount;
+        x = Wrap(x + static_cast<int32_t>(kCount), kMapWidth);
+      }
+    }
+
+    for (const Sprite_t & sprite : sprites_)
+    {
+      const auto kOverlap = sprite.area.Intersection(cell);
+      if (!sprite.visible || kOverlap.IsEmpty())
+      {
+        continue;
+      }
+
+      for (int32_t y = kOverlap.y; y < kOverlap.Bottom(); y++)
+      {
+        for (int32_t x = kOverlap.x; x < kOverlap.Right(); x++)
+        {
+          const uint16_t kPixel =
+              sprite.pixels[((y - sprite.area.y) * sprite.area.width) +
+                            (x - sprite.area.x)];
+          if (kPixel != kTransparent)
+          {
+            cell_[((y - cell.y) * kTileSize) + (x - cell.x)] = kPixel;
+          }
+        }
+      }
+    }
+  }
+
+  void DrawCell(PixelDisplay::Region_t cell, std::span<const uint16_t> pixels)
+  {
+    graphics_.DrawBitmap(viewport_.x + cell.x,
+                         viewport_.y + cell.y,
+                         cell.width,
+                         cell.height,
+                         pixels);
+  }
+
+  Graphics & graphics_;
+  std::span<const uint16_t> tile_set_;
+  PixelDisplay::Region_t viewport_;
+  size_t view_columns_;
+  size_t view_rows_;
+  int32_t scroll_x_                                      = 0;
+  int32_t scroll_y_                                      = 0;
+  std::array<std::array<uint16_t, kColumns>, kRows> map_ = {};
+  std::array<Sprite_t, kMaximumSprites> sprites_         = {};
+  std::bitset<kColumns * kRows> dirty_                   = {};
+  std::array<uint16_t, kTilePixels> cell_                = {};
+};
+}  // namespace sjsu
@@ -0,0 +1,230 @@
+#include <libcore/systems/tile_layer.hpp>
+
+#include <array>
+#include <utility>
+
+#include <libcore/devices/framebuffer_display.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+using TileDisplay =
+    FramebufferDisplay<32, 16, PixelDisplay::PixelFormat::kRgb565>;
+using Layer = TileLayer<4, 8, 4, 2>;
+
+/// 3 tiles of 4 x 4 pixels, each pixel holding its tile and position.
+constexpr auto kTiles = []() {
+  std::array<uint16_t, 3 * Layer::kTilePixels> tiles{};
+  for (size_t i = 0; i < tiles.size(); i++)
+  {
+    tiles[i] = static_cast<uint16_t>(((i / Layer::kTilePixels) << 8) |
+                                     (i % Layer::kTilePixels));
+  }
+  return tiles;
+}();
+
+/// A 3 x 2 sprite with a transparent pixel in its middle.
+constexpr std::array<uint16_t, 6> kSprite = {
+  0xAAAA, Layer::kTransparent, 0xBBBB, 0xCCCC, 0xDDDD, 0xEEEE,
+};
+
+uint16_t PixelAt(const TileDisplay & display, int32_t x, int32_t y)
+{
+  return ToInteger<uint16_t>(
+      std::endian::big,
+      display.Buffer().subspan((y * TileDisplay::kStride) + (x * 2), 2));
+}
+
+/// @return uint16_t - the pixel the layer should show at (x, y), with the
+///         sprite at (sprite_x, sprite_y).
+uint16_t Expected(const Layer & layer,
+                  int32_t scroll_x,
+                  int32_t scroll_y,
+                  int32_t sprite_x,
+                  int32_t sprite_y,
+                  int32_t x,
+                  int32_t y)
+{
+  const int32_t kSpriteX = x - sprite_x;
+  const int32_t kSpriteY = y - sprite_y;
+  if (0 <= kSpriteX && kSpriteX < 3 && 0 <= kSpriteY && kSpriteY < 2 &&
+      kSprite[(kSpriteY * 3) + kSpriteX] != Layer::kTransparent)
+  {
+    return kSprite[(kSpriteY * 3) + kSpriteX];
+  }
+
+  const int32_t kMapX  = (((x + scroll_x) % 32) + 32) % 32;
+  const int32_t kMapY  = (((y + scroll_y) % 16) + 16) % 16;
+  const uint16_t kTile = layer.GetTile(static_cast<size_t>(kMapX / 4),
+                                       static_cast<size_t>(kMapY / 4));
+  return kTiles[(kTile * Layer::kTilePixels) + ((kMapY % 4) * 4) +
+                (kMapX % 4)];
+}
+}  // namespace
+
+TEST_CASE("Testing TileLayer")
+{
+  TileDisplay display;
+  Graphics graphics(display);
+  Layer layer(graphics, kTiles, 0, 0, 8, 4);
+  for (size_t row = 0; row < 4; row++)
+  {
+    for (size_t column = 0; column < 8; column++)
+    {
+      layer.SetTile(column, row, static_cast<uint16_t>((row + column) % 3));
+    }
+  }
+
+  auto check_display = [&](int32_t scroll_x,
+                           int32_t scroll_y,
+                           int32_t sprite_x,
+                           int32_t sprite_y) {
+    int mismatches = 0;
+    for (int32_t y = 0; y < 16; y++)
+    {
+      for (int32_t x = 0; x < 32; x++)
+      {
+        mismatches +=
+            PixelAt(display, x, y) !=
+            Expected(layer, scroll_x, scroll_y, sprite_x, sprite_y, x, y);
+      }
+    }
+    return mismatches;
+  };
+
+  SECTION("Render() draws every cell once, then only what changed")
+  {
+    // Exercise
+    const size_t kFirst  = layer.Render();
+    const size_t kSecond = layer.Render();
+
+    // Verify
+    CHECK(32 == kFirst);
+    CHECK(0 == kSecond);
+    CHECK(0 == check_display(0, 0, -10, -10));
+    CHECK(graphics.GetDirtyRegion() ==
+          PixelDisplay::Region_t{ .width = 32, .height = 16 });
+  }
+
+  SECTION("Moving a sprite redraws only the cells it leaves and enters")
+  {
+    // Setup
+    const size_t kHandle = layer.AddSprite(kSprite, 3, 2, 1, 1);
+    layer.Render();
+    const int kFirstMismatches = check_display(0, 0, 1, 1);
+
+    // Exercise
+    layer.MoveSprite(kHandle, 9, 3);
+    const size_t kDrawn = layer.Render();
+
+    // Verify
+    CHECK(0 == kFirstMismatches);
+    // The cell the sprite left, and the two cells it now overlaps.
+    CHECK(3 == kDrawn);
+    CHECK(0 == check_display(0, 0, 9, 3));
+  }
+
+  SECTION("Hidden and removed sprites are not drawn")
+  {
+    // Setup
+    const size_t kFirst = layer.AddSprite(kSprite, 3, 2, 1, 1);
+    layer.Render();
+
+    // Exercise
+    layer.ShowSprite(kFirst, false);
+    const size_t kHiddenCells = layer.Render();
+    const int kHidden         = check_display(0, 0, -10, -10);
+    layer.ShowSprite(kFirst, true);
+    layer.RemoveSprite(kFirst);
+    const size_t kSecond = layer.AddSprite(kSprite, 3, 2, 30, 14);
+    layer.Render();
+
+    // Verify
+    CHECK(1 == kHiddenCells);
+    CHECK(0 == kHidden);
+    CHECK(kFirst == kSecond);
+    CHECK(0 == check_display(0, 0, 30, 14));
+  }
+
+  SECTION("Scrolling wraps around the map")
+  {
+    for (auto [x, y] : { std::pair{ 2, 0 },
+                         std::pair{ 4, 8 },
+                         std::pair{ -3, 17 },
+                         std::pair{ 31, -1 } })
+    {
+      // Setup
+      layer.AddSprite(kSprite, 3, 2, 6, 5);
+
+      // Exercise
+      layer.ScrollTo(x, y);
+      layer.Render();
+
+      // Verify
+      CHECK(0 == check_display(x, y, 6, 5));
+      layer.RemoveSprite(0);
+    }
+  }
+
+  SECTION("SetTile() redraws only the cells showing the tile")
+  {
+    // Setup
+    layer.ScrollTo(2, 4);
+    layer.Render();
+
+    // Exercise
+    layer.SetTile(3, 1, 2);
+    layer.SetTile(0, 0, 1);
+    const size_t kDrawn = layer.Render();
+
+    // Verify
+    // Map cell (3, 1) straddles two cells of the viewport's top row. Map cell
+    // (0, 0) wraps around to the bottom row, where it straddles the left and
+    // right edges of the viewport.
+    CHECK(2 + 2 == kDrawn);
+    CHECK(0 == check_display(2, 4, -10, -10));
+  }
+
+  SECTION("Viewports smaller than the map")
+  {
+    // Setup
+    display.Clear();
+    Layer small(graphics, kTiles, 8, 4, 3, 2);
+    small.Fill(1);
+
+    // Exercise
+    const size_t kDrawn = small.Render();
+
+    // Verify
+    CHECK(6 == kDrawn);
+    CHECK(kTiles[Layer::kTilePixels] == PixelAt(display, 8, 4));
+    CHECK(kTiles[(2 * Layer::kTilePixels) - 1] == PixelAt(display, 19, 11));
+    CHECK(0 == PixelAt(display, 20, 11));
+    CHECK(0 == PixelAt(display, 19, 12));
+  }
+
+  SECTION("Invalid arguments are rejected")
+  {
+    // Setup
+    std::array<uint16_t, 5> too_few{};
+    const auto kTooFewTiles = std::span(kTiles).first(15);
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION((Layer(graphics, kTiles, 0, 0, 9, 4)),
+                        std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION((Layer(graphics, kTooFewTiles, 0, 0, 1, 1)),
+                        std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(layer.SetTile(0, 0, 3), std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(layer.SetTile(8, 0, 0), std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(layer.Fill(3), std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(layer.AddSprite(too_few, 3, 2, 0, 0),
+                        std::errc::invalid_argument);
+    layer.AddSprite(kSprite, 3, 2, 0, 0);
+    layer.AddSprite(kSprite, 3, 2, 0, 0);
+    SJ2_CHECK_EXCEPTION(layer.AddSprite(kSprite, 3, 2, 0, 0),
+                        std::errc::no_buffer_space);
+  }
+}
+}  // namespace sjsu
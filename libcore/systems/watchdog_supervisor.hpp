@@ -0,0 +1,234 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <libcore/peripherals/watchdog.hpp>
+#include <libcore/utility/error_ring.hpp>
+#include <libcore/utility/log.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Feeds a hardware Watchdog only while every supervised task is healthy, so
+/// that one stuck task resets the system even when the others keep running.
+///
+/// Each task or loop creates a WatchdogSupervisor::Task with its own deadline
+/// and calls CheckIn() each time around, which costs a single atomic store.
+/// Update(), called periodically, such as from the main loop or a timer
+/// interrupt, feeds the watchdog only if every task has checked in within its
+/// deadline. Otherwise it records which task missed its deadline, to a record
+/// that survives the reset when declared SJ2_NO_INIT.
+///
+/// Update() must be called more often than the watchdog's trigger interval,
+/// and task deadlines should be longer than the interval between Update()
+/// calls.
+///
+/// USAGE:
+///
+///    SJ2_NO_INIT sjsu::WatchdogSupervisor::Record_t watchdog_record;
+///    sjsu::WatchdogSupervisor supervisor(watchdog, &watchdog_record);
+///    sjsu::WatchdogSupervisor::Task sensor_loop(supervisor, "sensors", 50ms);
+///
+///    // At startup, before anything else:
+///    watchdog_record.Print();
+///
+///    // In the sensor loop:
+///    sensor_loop.CheckIn();
+///
+///    // Every 10ms:
+///    supervisor.Update();
+class WatchdogSupervisor
+{
+ public:
+  /// Task that missed its deadline, last recorded by Update().
+  ///
+  /// Record_t has no constructor, so one declared with SJ2_NO_INIT is left
+  /// untouched by the startup code and tells which task caused the last
+  /// watchdog reset.
+  struct Record_t
+  {
+    /// Longest task name kept, including its NULL terminator.
+    static constexpr size_t kNameLength = 16;
+    /// Value of `magic` when the record holds a missed deadline.
+    static constexpr uint32_t kMagic = 0x5744'5447;
+
+    /// kMagic if the record holds a missed deadline, anything else after a
+    /// power cycle or Clear().
+    uint32_t magic;
+    /// Uptime of the last check in of the task, in microseconds.
+    uint64_t last_check_in;
+    /// Uptime when the missed deadline was found, in microseconds.
+    uint64_t detected;
+    /// Name of the task, cut short to fit.
+    std::array<char, kNameLength> name;
+
+    /// @return true - if the record holds a missed deadline.
+    bool IsValid() const
+    {
+      return magic == kMagic;
+    }
+
+    /// Forget the recorded task.
+    void Clear()
+    {
+      magic = 0;
+    }
+
+    /// Print the recorded task, if any.
+    void Print() const
+    {
+      if (IsValid())
+      {
+        sjsu::log::Print("Watchdog: task '{}' missed its deadline, last "
+                         "checked in at {} us, found at {} us\n",
+                         name.data(),
+                         last_check_in,
+                         detected);
+      }
+    }
+  };
+
+  /// A task supervised by a WatchdogSupervisor, for as long as it exists.
+  class Task
+  {
+   public:
+    /// @param supervisor - supervisor to register with.
+    /// @param name - name of the task, with static storage duration.
+    /// @param deadline - longest time allowed between check ins.
+    Task(WatchdogSupervisor & supervisor,
+         const char * name,
+         std::chrono::nanoseconds deadline)
+        : supervisor_(supervisor),
+          name_(name),
+          deadline_(deadline),
+          last_check_in_(Uptime()),
+          next_(supervisor.tasks_)
+    {
+      supervisor_.tasks_ = this;
+    }
+
+    Task(const Task &) = delete;
+    Task & operator=(const Task &) = delete;
+
+    ~Task()
+    {
+      for (Task ** task = &supervisor_.tasks_; *task != nullptr;
+           task         = &(*task)->next_)
+      {
+        if (*task == this)
+        {
+          *task = next_;
+          break;
+        }
+      }
+    }
+
+    /// Report that the task is healthy. Safe to call from any context.
+    void CheckIn()
+    {
+      checked_in_.store(true, std::memory_order_relaxed);
+    }
+
+    /// @return const char* - name of the task.
+    const char * GetName() const
+    {
+      return name_;
+    }
+
+   private:
+    friend class WatchdogSupervisor;
+
+    WatchdogSupervisor & supervisor_;
+    const char * name_;
+    std::chrono::nanoseconds deadline_;
+    std::chrono::nanoseconds last_check_in_;
+    std::atomic<bool> checked_in_ = false;
+    Task * next_;
+  };
+
+  /// @param watchdog - initialized hardware watchdog to feed.
+  /// @param record - where to record a missed deadline, or nullptr.
+  explicit WatchdogSupervisor(Watchdog & watchdog, Record_t * record = nullptr)
+      : watchdog_(watchdog), record_(record)
+  {
+  }
+
+  WatchdogSupervisor(const WatchdogSupervisor &) = delete;
+  WatchdogSupervisor & operator=(const WatchdogSupervisor &) = delete;
+
+  /// Collect the check ins of every task and feed the watchdog if they are
+  /// all within their deadlines.
+  ///
+  /// @return true - if the watchdog was fed.
+  bool Update()
+  {
+    const auto kNow = Uptime();
+    Task * late     = nullptr;
+
+    for (Task * task = tasks_; task != nullptr; task = task->next_)
+    {
+      if (task->checked_in_.exchange(false, std::memory_order_relaxed))
+      {
+        task->last_check_in_ = kNow;
+      }
+      else if (late == nullptr &&
+               kNow - task->last_check_in_ > task->deadline_)
+      {
+        late = task;
+      }
+    }
+
+    if (late != nullptr)
+    {
+      missed_ = late;
+      Write(*late, kNow);
+      return false;
+    }
+
+    missed_ = nullptr;
+    watchdog_.FeedSequence();
+    return true;
+  }
+
+  /// @return const Task* - the task that missed its deadline in the last
+  ///         Update(), or nullptr if every task was healthy.
+  const Task * Missed() const
+  {
+    return missed_;
+  }
+
+ private:
+  static uint64_t Microseconds(std::chrono::nanoseconds time)
+  {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+  }
+
+  void Write(const Task & task, std::chrono::nanoseconds now)
+  {
+    if (record_ == nullptr)
+    {
+      return;
+    }
+
+    record_->last_check_in = Microseconds(task.last_check_in_);
+    record_->detected      = Microseconds(now);
+
+    size_t i = 0;
+    for (; i < record_->name.size() - 1 && task.name_[i] != '\0'; i++)
+    {
+      record_->name[i] = task.name_[i];
+    }
+    record_->name[i] = '\0';
+    record_->magic   = Record_t::kMagic;
+  }
+
+  Watchdog & watchdog_;
+  Record_t * record_;
+  Task * tasks_        = nullptr;
+  const Task * missed_ = nullptr;
+};
+}  // namespace sjsu
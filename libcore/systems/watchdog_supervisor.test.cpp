@@ -0,0 +1,96 @@
+#include <libcore/systems/watchdog_supervisor.hpp>
+
+#include <cstring>
+#include <string>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing WatchdogSupervisor")
+{
+  VirtualClock clock;
+  clock.Start();
+
+  Mock<Watchdog> mock_watchdog;
+  Fake(Method(mock_watchdog, FeedSequence));
+
+  WatchdogSupervisor::Record_t record;
+  memset(&record, 0, sizeof(record));
+
+  WatchdogSupervisor supervisor(mock_watchdog.get(), &record);
+  WatchdogSupervisor::Task fast(supervisor, "fast", 10ms);
+  WatchdogSupervisor::Task slow(supervisor, "a_long_task_name_here", 50ms);
+
+  SECTION("Feeds while every task checks in")
+  {
+    // Exercise
+    for (int i = 0; i < 10; i++)
+    {
+      clock.Advance(5ms);
+      fast.CheckIn();
+      if (i % 5 == 0)
+      {
+        slow.CheckIn();
+      }
+      CHECK(supervisor.Update());
+    }
+
+    // Verify
+    Verify(Method(mock_watchdog, FeedSequence)).Exactly(10);
+    CHECK(nullptr == supervisor.Missed());
+    CHECK(!record.IsValid());
+  }
+
+  SECTION("Stops feeding and records the task that missed its deadline")
+  {
+    // Setup
+    slow.CheckIn();
+    clock.Advance(5ms);
+    supervisor.Update();
+
+    // Exercise
+    clock.Advance(11ms);
+    slow.CheckIn();
+    const bool kFed = supervisor.Update();
+
+    // Verify
+    CHECK(!kFed);
+    Verify(Method(mock_watchdog, FeedSequence)).Once();
+    CHECK(&fast == supervisor.Missed());
+    REQUIRE(record.IsValid());
+    CHECK(std::string("fast") == record.name.data());
+    CHECK(0 == record.last_check_in);
+    CHECK(16'000 == record.detected);
+  }
+
+  SECTION("Long task names are cut short")
+  {
+    // Exercise
+    clock.Advance(51ms);
+    fast.CheckIn();
+    supervisor.Update();
+
+    // Verify
+    CHECK(&slow == supervisor.Missed());
+    CHECK(std::string("a_long_task_nam") == record.name.data());
+  }
+
+  SECTION("Destroyed tasks are no longer supervised")
+  {
+    // Setup
+    {
+      WatchdogSupervisor::Task temporary(supervisor, "temporary", 1ms);
+    }
+
+    // Exercise
+    clock.Advance(5ms);
+    fast.CheckIn();
+    slow.CheckIn();
+
+    // Verify
+    CHECK(supervisor.Update());
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <libcore/utility/log.hpp>
+#include <libcore/utility/time/cycle_counter.hpp>
+
+namespace sjsu::benchmark
+{
+/// How a benchmark is measured.
+struct Options_t
+{
+  /// Most repetitions a benchmark can be measured for.
+  static constexpr size_t kMaximumRepetitions = 64;
+
+  /// Calls made before measuring, to fill caches and branch predictors.
+  uint32_t warmup = 16;
+
+  /// Number of measurements taken. The median of these is reported. At most
+  /// kMaximumRepetitions.
+  uint32_t repetitions = 15;
+
+  /// Calls timed together in each measurement, so that functions shorter than
+  /// the resolution of the CycleCounter can still be measured.
+  uint32_t iterations = 100;
+};
+
+/// Statistics of a benchmark, in CycleCounter counts per call: CPU cycles, or
+/// nanoseconds on platforms without a cycle counter. Counts are fractional,
+/// as each measurement is divided by the calls it timed, so functions
+/// shorter than one count still measure above 0.
+struct Result_t
+{
+  /// Name of the benchmark.
+  const char * name = "";
+
+  /// Shortest measurement, the one least disturbed by interrupts or the OS.
+  float minimum = 0;
+
+  /// Median measurement.
+  float median = 0;
+
+  /// Longest measurement.
+  float maximum = 0;
+};
+
+/// Keep the compiler from optimizing away the computation of `value`, as if
+/// it was read by code the compiler cannot see.
+///
+/// @param value - the result to keep.
+template <typename T>
+inline void DoNotOptimize(const T & value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// Keep the compiler from assuming anything about `value`, as if it was read
+/// and then written by code the compiler cannot see. Apply it to the inputs
+/// of the measured code on each call, so their values cannot be constant
+/// folded into the computation, nor the computation hoisted out of the loop.
+///
+/// @param value - the input to hide.
+template <typename T>
+inline void DoNotOptimize(T & value)
+{
+  if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(T *))
+  {
+    asm volatile("" : "+r,m"(value) : : "memory");
+  }
+  else
+  {
+    asm volatile("" : "+m"(value) : : "memory");
+  }
+}
+
+/// Measure a function.
+///
+/// @param name - name of the benchmark.
+/// @param function - function to measure, called with no arguments.
+/// @param options - how to measure it.
+/// @return Result_t - the time each call took.
+template <typename Function>
+Result_t Run(const char * name, Function && function, Options_t options = {})
+{
+  std::array<float, Options_t::kMaximumRepetitions> samples;
+  const size_t kRepetitions = std::clamp<size_t>(
+      options.repetitions, 1, Options_t::kMaximumRepetitions);
+  const uint32_t kIterations = std::max<uint32_t>(options.iterations, 1);
+
+  for (uint32_t i = 0; i < options.warmup; i++)
+  {
+    function();
+  }
+
+  for (size_t sample = 0; sample < kRepetitions; sample++)
+  {
+    const uint32_t kStart = CycleCounter::Read();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+      function();
+    }
+    const uint32_t kEnd     = CycleCounter::Read();
+    const uint32_t kElapsed = CycleCounter::Elapsed(kStart, kEnd);
+    samples[sample] =
+        static_cast<float>(kElapsed) / static_cast<float>(kIterations);
+  }
+
+  auto measured = std::span(samples).first(kRepetitions);
+  std::sort(measured.begin(), measured.end());
+
+  return Result_t{
+    .name    = name,
+    .minimum = measured.front(),
+    .median  = measured[measured.size() / 2],
+    .maximum = measured.back(),
+  };
+}
+
+/// Print a result through log::Print.
+///
+/// @param result - the result to print.
+inline void Print(const Result_t & result)
+{
+  constexpr const char * kUnit = CycleCounter::kCountsCycles ? "cycles" : "ns";
+
+  log::Print("{} min={} median={} max={} {}/call\n",
+             result.name,
+             result.minimum,
+             result.median,
+             result.maximum,
+             kUnit);
+}
+
+/// A benchmark registered with SJ2_BENCHMARK(), run by RunAll().
+class Registration_t
+{
+ public:
+  /// Function that measures a benchmark with Run(), given its name.
+  using Function = Result_t (*)(const char * name);
+
+  /// @param name - name of the benchmark.
+  /// @param function - function that measures the benchmark.
+  Registration_t(const char * name, Function function)
+      : name_(name), function_(function)
+  {
+    *tail = this;
+    tail  = &next_;
+  }
+
+  Registration_t(const Registration_t &) = delete;
+  Registration_t & operator=(const Registration_t &) = delete;
+
+  /// Run and print every registered benchmark, in the order they were
+  /// registered.
+  static void RunAll()
+  {
+    CycleCounter::Enable();
+    for (Registration_t * benchmark = list; benchmark != nullptr;
+         benchmark                  = benchmark->next_)
+    {
+      Print(benchmark->function_(benchmark->name_));
+    }
+  }
+
+ private:
+  static inline Registration_t * list  = nullptr;
+  static inline Registration_t ** tail = &list;
+
+  const char * name_;
+  Function function_;
+  Registration_t * next_ = nullptr;
+};
+
+/// Run and print every benchmark registered with SJ2_BENCHMARK().
+inline void RunAll()
+{
+  Registration_t::RunAll();
+}
+}  // namespace sjsu::benchmark
+
+#define SJ2_BENCHMARK_CONCAT_HELPER(a, b) a##b
+#define SJ2_BENCHMARK_CONCAT(a, b) SJ2_BENCHMARK_CONCAT_HELPER(a, b)
+
+/// Register a benchmark to be run by sjsu::benchmark::RunAll(). The body that
+/// follows sets up the benchmark and returns the result of
+/// sjsu::benchmark::Run(), to which it passes `name`.
+///
+/// Usage:
+///
+///    SJ2_BENCHMARK("crc::Crc7")
+///    {
+///      std::array<uint8_t, 5> command = { 0x40, 0, 0, 0, 0 };
+///      return sjsu::benchmark::Run(name, [&command]() {
+///        sjsu::benchmark::DoNotOptimize(sjsu::crc::Crc7(command));
+///      });
+///    }
+///
+/// @param benchmark_name - string literal name of the benchmark.
+#define SJ2_BENCHMARK(benchmark_name) \
+  SJ2_BENCHMARK_WITH_ID(benchmark_name, __COUNTER__)
+
+/// Implementation of SJ2_BENCHMARK(), with `id` making the names of the
+/// benchmark's function and registration unique, even when the benchmark
+/// files are included into a single translation unit.
+#define SJ2_BENCHMARK_WITH_ID(benchmark_name, id)                            \
+  static ::sjsu::benchmark::Result_t SJ2_BENCHMARK_CONCAT(sj2_benchmark_,    \
+                                                          id)(               \
+      const char * name);                                                    \
+  static ::sjsu::benchmark::Registration_t SJ2_BENCHMARK_CONCAT(             \
+      sj2_benchmark_registration_,                                           \
+      id)(benchmark_name, SJ2_BENCHMARK_CONCAT(sj2_benchmark_, id));         \
+  static ::sjsu::benchmark::Result_t SJ2_BENCHMARK_CONCAT(sj2_benchmark_,    \
+                                                          id)(               \
+      [[maybe_unused]] const char * name)
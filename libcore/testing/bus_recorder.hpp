@@ -0,0 +1,518 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <sstream>
+#include <vector>
+
+#include <libcore/devices/memory_access_protocol.hpp>
+#include <libcore/peripherals/i2c.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/testing/simulated_peripherals.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+
+/// Test doubles that record every operation a driver performs on its bus, for
+/// performance regression tests that catch a driver suddenly doing many more
+/// bus operations, or spending much longer on the bus, than it used to.
+///
+/// Each recording peripheral forwards every call to the peripheral it wraps,
+/// such as a mock or a simulation, so the driver sees the same data as
+/// without it, and records the operation, with its byte counts and the time
+/// it takes on the wire at the configured bus rate, in a BusRecorder. Several
+/// recording peripherals can share one recorder. BusBudget and
+/// MeasureBusUsage() then check the operations recorded for a driver call.
+///
+/// USAGE:
+///
+///    sjsu::testing::BusRecorder recorder;
+///    sjsu::testing::RecordingI2c i2c(recorder, simulated_i2c);
+///    sjsu::I2cProtocol protocol(0x68, i2c);
+///    Imu imu(protocol);
+///
+///    {
+///      sjsu::testing::BusBudget budget(recorder,
+///                                      { .transactions = 1, .time = 1ms });
+///      imu.ReadAcceleration();
+///    }
+namespace sjsu::testing
+{
+/// A single operation on a bus, such as an I2C transaction or a chip select
+/// assertion of SPI.
+struct BusOperation_t
+{
+  /// Kind of bus the operation was performed on.
+  enum class Bus : uint8_t
+  {
+    kI2c,
+    kSpi,
+    kUart,
+    kMemory,
+  };
+
+  /// Bus of the operation.
+  Bus bus = Bus::kI2c;
+
+  /// Address of the I2C device, or register address of a
+  /// MemoryAccessProtocol access. 0 for other buses.
+  uint32_t address = 0;
+
+  /// Bytes sent, including register addresses.
+  size_t bytes_out = 0;
+
+  /// Bytes received.
+  size_t bytes_in = 0;
+
+  /// Time the operation takes on the bus.
+  std::chrono::nanoseconds time = 0ns;
+};
+
+/// Totals of a number of bus operations.
+struct BusUsage_t
+{
+  /// Number of operations.
+  size_t transactions = 0;
+
+  /// Bytes sent and received.
+  size_t bytes = 0;
+
+  /// Time spent on the bus.
+  std::chrono::nanoseconds time = 0ns;
+};
+
+/// Print an operation, for the messages of failed checks.
+///
+/// @param stream - stream to print to.
+/// @param operation - operation to print.
+/// @return std::ostream& - `stream`.
+inline std::ostream & operator<<(std::ostream & stream,
+                                 const BusOperation_t & operation)
+{
+  constexpr std::array<const char *, 4> kBusNames = {
+    "I2C",
+    "SPI",
+    "UART",
+    "Memory",
+  };
+
+  return stream << kBusNames[static_cast<size_t>(operation.bus)] << " 0x"
+                << std::hex << operation.address << std::dec << ": "
+                << operation.bytes_out << " out, " << operation.bytes_in
+                << " in, " << operation.time.count() << "ns";
+}
+
+/// Log of the operations of one or more recording peripherals.
+class BusRecorder
+{
+ public:
+  /// @param operation - operation to add to the log.
+  void Record(const BusOperation_t & operation)
+  {
+    operations_.push_back(operation);
+  }
+
+  /// @return std::span<const BusOperation_t> - every operation recorded, in
+  ///         order.
+  std::span<const BusOperation_t> Operations() const
+  {
+    return operations_;
+  }
+
+  /// @param from - index of the first operation to count, such as the size
+  ///        of Operations() before a driver call.
+  /// @return BusUsage_t - totals of the operations from `from` onwards.
+  BusUsage_t Usage(size_t from = 0) const
+  {
+    BusUsage_t usage;
+    for (size_t i = from; i < operations_.size(); i++)
+    {
+      usage.transactions++;
+      usage.bytes += operations_[i].bytes_out + operations_[i].bytes_in;
+      usage.time += operations_[i].time;
+    }
+    return usage;
+  }
+
+  /// Forget every operation recorded.
+  void Clear()
+  {
+    operations_.clear();
+  }
+
+ private:
+  std::vector<BusOperation_t> operations_;
+};
+
+/// Run `operation` and measure the bus usage recorded while it ran.
+///
+/// Usage:
+///
+///    auto usage = MeasureBusUsage(recorder, [&] { sensor.Read(); });
+///    CHECK(usage.transactions <= 2);
+///
+/// @param recorder - recorder of the buses the operation uses.
+/// @param operation - callable to run.
+/// @return BusUsage_t - totals of the operations recorded.
+template <typename Operation>
+BusUsage_t MeasureBusUsage(const BusRecorder & recorder, Operation operation)
+{
+  const size_t kStart = recorder.Operations().size();
+  operation();
+  return recorder.Usage(kStart);
+}
+
+/// Checks, when it leaves scope, that the bus operations recorded during its
+/// lifetime stay within upper bounds, in the manner of
+/// AutoVerifyPeripheralMemory. Every operation recorded is listed when a
+/// bound is exceeded.
+class BusBudget
+{
+ public:
+  /// Upper bounds of a budget. Bounds left at their default are not checked.
+  struct Limits_t
+  {
+    /// Maximum number of operations.
+    size_t transactions = std::numeric_limits<size_t>::max();
+
+    /// Maximum number of bytes sent and received.
+    size_t bytes = std::numeric_limits<size_t>::max();
+
+    /// Maximum time spent on the bus.
+    std::chrono::nanoseconds time = std::chrono::nanoseconds::max();
+  };
+
+  /// @param recorder - recorder of the buses to check.
+  /// @param limits - upper bounds of the operations recorded from now until
+  ///        this object is destroyed.
+  BusBudget(const BusRecorder & recorder, Limits_t limits)
+      : recorder_(recorder),
+        limits_(limits),
+        start_(recorder.Operations().size())
+  {
+  }
+
+  BusBudget(const BusBudget &) = delete;
+  BusBudget & operator=(const BusBudget &) = delete;
+
+  /// @return BusUsage_t - totals of the operations recorded so far.
+  BusUsage_t Usage() const
+  {
+    return recorder_.Usage(start_);
+  }
+
+  ~BusBudget()
+  {
+    const BusUsage_t kUsage = Usage();
+    const auto kOperations  = recorder_.Operations().subspan(start_);
+
+    // INFO only lasts for its scope, so every operation is listed in one.
+    std::ostringstream listing;
+    for (size_t i = 0; i < kOperations.size(); i++)
+    {
+      listing << "\n  " << i << ": " << kOperations[i];
+    }
+    INFO("Bus operations:" << listing.str());
+
+    CHECK_MESSAGE(kUsage.transactions <= limits_.transactions,
+                  "Too many bus transactions: " << kUsage.transactions
+                                                << " > "
+                                                << limits_.transactions);
+    CHECK_MESSAGE(kUsage.bytes <= limits_.bytes,
+                  "Too many bytes on the bus: " << kUsage.bytes << " > "
+                                                << limits_.bytes);
+    CHECK_MESSAGE(kUsage.time <= limits_.time,
+                  "Too much time on the bus: " << kUsage.time.count()
+                                               << "ns > "
+                                               << limits_.time.count()
+                                               << "ns");
+  }
+
+ private:
+  const BusRecorder & recorder_;
+  Limits_t limits_;
+  size_t start_;
+};
+
+/// I2c that records each transaction, timed at `settings.frequency` with
+/// start and stop conditions and nine clocks per byte, as
+/// simulation::I2c does, assuming every byte is acknowledged.
+class RecordingI2c : public sjsu::I2c
+{
+ public:
+  /// @param recorder - recorder to add the transactions to.
+  /// @param i2c - I2c that performs the transactions.
+  RecordingI2c(BusRecorder & recorder, sjsu::I2c & i2c)
+      : recorder_(recorder), i2c_(i2c)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    i2c_.settings = settings;
+    i2c_.Initialize();
+  }
+
+  void Transaction(Transaction_t transaction) override
+  {
+    constexpr uint64_t kClocksPerByte = 9;
+    constexpr uint64_t kStart         = 1;
+    constexpr uint64_t kStop          = 1;
+
+    uint64_t clocks = kStart + kClocksPerByte +
+                      kClocksPerByte * transaction.TotalOutLength() +
+                      kClocksPerByte * transaction.in_length + kStop;
+    if (transaction.repeated)
+    {
+      clocks += kStart + kClocksPerByte;
+    }
+
+    recorder_.Record({
+        .bus       = BusOperation_t::Bus::kI2c,
+        .address   = transaction.address,
+        .bytes_out = transaction.TotalOutLength(),
+        .bytes_in  = transaction.in_length,
+        .time =
+            simulation::BitTime(clocks, settings.frequency.to<uint64_t>()),
+    });
+
+    i2c_.Transaction(transaction);
+  }
+
+  I2cSettings_t::Mode MaximumMode() const override
+  {
+    return i2c_.MaximumMode();
+  }
+
+ private:
+  BusRecorder & recorder_;
+  sjsu::I2c & i2c_;
+};
+
+/// Spi that records each transfer, timed at `settings.clock_rate`. A
+/// scatter/gather transfer of several segments is one chip select assertion,
+/// so it is recorded as a single operation.
+class RecordingSpi : public sjsu::Spi
+{
+ public:
+  using Spi::Transfer;
+
+  /// @param recorder - recorder to add the transfers to.
+  /// @param spi - Spi that performs the transfers.
+  RecordingSpi(BusRecorder & recorder, sjsu::Spi & spi)
+      : recorder_(recorder), spi_(spi)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    spi_.settings = settings;
+    spi_.Initialize();
+  }
+
+  void Transfer(std::span<uint8_t> buffer) override
+  {
+    Record(buffer.size(), buffer.size(), Time(buffer.size(), 8));
+    spi_.Transfer(buffer);
+  }
+
+  void Transfer(std::span<uint16_t> buffer) override
+  {
+    const uint64_t kBits = static_cast<uint64_t>(settings.frame_size) + 4;
+    Record(buffer.size_bytes(),
+           buffer.size_bytes(),
+           Time(buffer.size(), kBits));
+    spi_.Transfer(buffer);
+  }
+
+  void Transfer(std::span<const uint8_t> transmit,
+                std::span<uint8_t> receive) override
+  {
+    Record(transmit.size(),
+           receive.size(),
+           Time(std::max(transmit.size(), receive.size()), 8));
+    spi_.Transfer(transmit, receive);
+  }
+
+  void Transfer(std::span<const Segment_t> segments) override
+  {
+    size_t bytes_out = 0;
+    size_t bytes_in  = 0;
+    size_t clocked   = 0;
+    for (const auto & segment : segments)
+    {
+      bytes_out += segment.transmit.size();
+      bytes_in += segment.receive.size();
+      clocked += std::max(segment.transmit.size(), segment.receive.size());
+    }
+
+    Record(bytes_out, bytes_in, Time(clocked, 8));
+    spi_.Transfer(segments);
+  }
+
+ private:
+  void Record(size_t bytes_out,
+              size_t bytes_in,
+              std::chrono::nanoseconds time)
+  {
+    recorder_.Record({
+        .bus       = BusOperation_t::Bus::kSpi,
+        .bytes_out = bytes_out,
+        .bytes_in  = bytes_in,
+        .time      = time,
+    });
+  }
+
+  /// @param frames - number of frames clocked.
+  /// @param bits_per_frame - clocks per frame.
+  /// @return std::chrono::nanoseconds - time to clock the frames.
+  std::chrono::nanoseconds Time(size_t frames, uint64_t bits_per_frame) const
+  {
+    return simulation::BitTime(frames * bits_per_frame,
+                               settings.clock_rate.to<uint64_t>());
+  }
+
+  BusRecorder & recorder_;
+  sjsu::Spi & spi_;
+};
+
+/// Uart that records each write, and each read that returns bytes, timed at
+/// `settings.baud_rate` with the start, parity and stop bits of each frame.
+class RecordingUart : public sjsu::Uart
+{
+ public:
+  using Uart::Read;
+  using Uart::Write;
+
+  /// @param recorder - recorder to add the operations to.
+  /// @param uart - Uart that performs the operations.
+  RecordingUart(BusRecorder & recorder, sjsu::Uart & uart)
+      : recorder_(recorder), uart_(uart)
+  {
+  }
+
+  void ModuleInitialize() override
+  {
+    uart_.settings = settings;
+    uart_.Initialize();
+  }
+
+  bool HasData() override
+  {
+    return uart_.HasData();
+  }
+
+  void Write(std::span<const uint8_t> data) override
+  {
+    Record(data.size(), 0);
+    uart_.Write(data);
+  }
+
+  size_t Read(std::span<uint8_t> data) override
+  {
+    const size_t kRead = uart_.Read(data);
+    if (kRead > 0)
+    {
+      Record(0, kRead);
+    }
+    return kRead;
+  }
+
+  void Flush() override
+  {
+    uart_.Flush();
+  }
+
+  void WriteAddress(uint8_t address) override
+  {
+    Record(1, 0);
+    uart_.WriteAddress(address);
+  }
+
+  void Mute() override
+  {
+    uart_.Mute();
+  }
+
+ private:
+  void Record(size_t bytes_out, size_t bytes_in)
+  {
+    const uint64_t kBits =
+        1 + (static_cast<uint64_t>(settings.frame_size) + 5) +
+        ((settings.parity == UartSettings_t::Parity::kNone) ? 0 : 1) +
+        ((settings.stop == UartSettings_t::StopBits::kDouble) ? 2 : 1);
+
+    recorder_.Record({
+        .bus       = BusOperation_t::Bus::kUart,
+        .bytes_out = bytes_out,
+        .bytes_in  = bytes_in,
+        .time      = simulation::BitTime((bytes_out + bytes_in) * kBits,
+                                    settings.baud_rate),
+    });
+  }
+
+  BusRecorder & recorder_;
+  sjsu::Uart & uart_;
+};
+
+/// MemoryAccessProtocol that records each register access, such as one
+/// wrapping a MockProtocol, for drivers tested above their transport. The
+/// protocol has no bus rate of its own, so accesses are timed at
+/// `byte_time` per byte of address and payload.
+class RecordingProtocol : public MemoryAccessProtocol
+{
+ public:
+  /// @param recorder - recorder to add the accesses to.
+  /// @param protocol - protocol that performs the accesses.
+  /// @param byte_time - time each byte of an access takes.
+  RecordingProtocol(BusRecorder & recorder,
+                    MemoryAccessProtocol & protocol,
+                    std::chrono::nanoseconds byte_time = 0ns)
+      : recorder_(recorder), protocol_(protocol), byte_time_(byte_time)
+  {
+  }
+
+  void Write(std::span<const uint8_t> address,
+             std::span<const uint8_t> payload) override
+  {
+    Record(address, address.size() + payload.size(), 0);
+    protocol_.Write(address, payload);
+  }
+
+  void Read(std::span<const uint8_t> address,
+            std::span<uint8_t> payload) override
+  {
+    Record(address, address.size(), payload.size());
+    protocol_.Read(address, payload);
+  }
+
+ private:
+  void Record(std::span<const uint8_t> address,
+              size_t bytes_out,
+              size_t bytes_in)
+  {
+    uint32_t register_address = 0;
+    for (uint8_t byte : address)
+    {
+      register_address = (register_address << 8) | byte;
+    }
+
+    recorder_.Record({
+        .bus       = BusOperation_t::Bus::kMemory,
+        .address   = register_address,
+        .bytes_out = bytes_out,
+        .bytes_in  = bytes_in,
+        .time      = static_cast<int64_t>(bytes_out + bytes_in) * byte_time_,
+    });
+  }
+
+  BusRecorder & recorder_;
+  MemoryAccessProtocol & protocol_;
+  std::chrono::nanoseconds byte_time_;
+};
+}  // namespace sjsu::testing
@@ -0,0 +1,152 @@
+#include <libcore/testing/bus_recorder.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::testing
+{
+TEST_CASE("Testing bus recorders")
+{
+  BusRecorder recorder;
+
+  SECTION("RecordingI2c records each transaction with its bus time")
+  {
+    // Setup
+    RecordingI2c i2c(recorder, GetInactive<sjsu::I2c>());
+    i2c.settings.frequency = 100_kHz;
+    i2c.Initialize();
+    I2cProtocol protocol(0x68, i2c);
+    constexpr std::array<uint8_t, 1> kRegister = { 0x3B };
+    constexpr std::array<uint8_t, 3> kPayload  = { 1, 2, 3 };
+    std::array<uint8_t, 2> value;
+
+    // Exercise
+    protocol.Read(kRegister, value);
+    protocol.Write(kRegister, kPayload);
+
+    // Verify
+    REQUIRE(2 == recorder.Operations().size());
+    const auto & read = recorder.Operations()[0];
+    CHECK(BusOperation_t::Bus::kI2c == read.bus);
+    CHECK(0x68 == read.address);
+    CHECK(1 == read.bytes_out);
+    CHECK(2 == read.bytes_in);
+    // Start, address, register, 2 bytes read, repeated start, address again
+    // and stop: 48 clocks at 10us each.
+    CHECK(480us == read.time);
+
+    const auto & write = recorder.Operations()[1];
+    CHECK(4 == write.bytes_out);
+    CHECK(0 == write.bytes_in);
+    // Start, address, register, 3 bytes and stop: 47 clocks.
+    CHECK(470us == write.time);
+  }
+
+  SECTION("RecordingSpi records a scatter/gather transfer as one operation")
+  {
+    // Setup
+    RecordingSpi spi(recorder, GetInactive<sjsu::Spi>());
+    spi.settings.clock_rate = 1_MHz;
+    spi.Initialize();
+    constexpr std::array<uint8_t, 2> kCommand = { 0x0B, 0x00 };
+    std::array<uint8_t, 4> response;
+    const std::array<Spi::Segment_t, 2> kSegments = {
+      Spi::Segment_t{ .transmit = kCommand },
+      Spi::Segment_t{ .receive = response },
+    };
+
+    // Exercise
+    spi.Transfer(kSegments);
+    spi.Transfer(uint8_t{ 0x9F });
+
+    // Verify
+    REQUIRE(2 == recorder.Operations().size());
+    CHECK(2 == recorder.Operations()[0].bytes_out);
+    CHECK(4 == recorder.Operations()[0].bytes_in);
+    CHECK(48us == recorder.Operations()[0].time);
+    CHECK(8us == recorder.Operations()[1].time);
+  }
+
+  SECTION("RecordingUart records writes and reads that return data")
+  {
+    // Setup
+    RecordingUart uart(recorder, GetInactive<sjsu::Uart>());
+    uart.settings.baud_rate = 100'000;
+    uart.Initialize();
+    constexpr std::array<uint8_t, 3> kData = { 'a', 'b', 'c' };
+    std::array<uint8_t, 4> received;
+
+    // Exercise
+    uart.Write(kData);
+    const size_t kReceived = uart.Read(received);
+
+    // Verify
+    CHECK(0 == kReceived);
+    REQUIRE(1 == recorder.Operations().size());
+    CHECK(BusOperation_t::Bus::kUart == recorder.Operations()[0].bus);
+    CHECK(3 == recorder.Operations()[0].bytes_out);
+    // Start, 8 data and stop bits per byte at 10us each.
+    CHECK(300us == recorder.Operations()[0].time);
+  }
+
+  SECTION("RecordingProtocol forwards accesses and records them")
+  {
+    // Setup
+    MockProtocol<MemoryAccessProtocol::AddressWidth::kByte1> memory;
+    memory.memory_map.fill(0);
+    RecordingProtocol protocol(recorder, memory, 10us);
+    constexpr std::array<uint8_t, 1> kRegister = { 0x20 };
+    constexpr std::array<uint8_t, 2> kPayload  = { 0xAB, 0xCD };
+    std::array<uint8_t, 2> value;
+
+    // Exercise
+    protocol.Write(kRegister, kPayload);
+    protocol.Read(kRegister, value);
+
+    // Verify
+    CHECK(kPayload == value);
+    REQUIRE(2 == recorder.Operations().size());
+    CHECK(BusOperation_t::Bus::kMemory == recorder.Operations()[1].bus);
+    CHECK(0x20 == recorder.Operations()[1].address);
+    CHECK(1 == recorder.Operations()[1].bytes_out);
+    CHECK(2 == recorder.Operations()[1].bytes_in);
+    CHECK(30us == recorder.Operations()[1].time);
+  }
+
+  SECTION("MeasureBusUsage() and BusBudget count only their own operations")
+  {
+    // Setup
+    RecordingSpi spi(recorder, GetInactive<sjsu::Spi>());
+    spi.settings.clock_rate = 1_MHz;
+    spi.Initialize();
+    spi.Transfer(uint8_t{ 0x06 });
+
+    // Exercise
+    const auto kUsage = MeasureBusUsage(recorder, [&spi] {
+      spi.Transfer(uint8_t{ 0x05 });
+      spi.Transfer(uint16_t{ 0x1234 });
+    });
+
+    {
+      BusBudget budget(recorder, { .transactions = 1, .time = 8us });
+      spi.Transfer(uint8_t{ 0x04 });
+      CHECK(1 == budget.Usage().transactions);
+    }
+
+    // Verify
+    CHECK(2 == kUsage.transactions);
+    CHECK(6 == kUsage.bytes);
+    // 8 clocks then one 8 bit frame of the default frame size.
+    CHECK(16us == kUsage.time);
+    CHECK(4 == recorder.Usage().transactions);
+
+    // Exercise
+    recorder.Clear();
+
+    // Verify
+    CHECK(recorder.Operations().empty());
+  }
+}
+}  // namespace sjsu::testing
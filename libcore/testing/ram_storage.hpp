@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include <libcore/peripherals/storage.hpp>
+#include <libcore/utility/error_handling.hpp>
+
+namespace sjsu::testing
+{
+/// Storage held in a vector of bytes, for tests of the drivers, caches and
+/// stores built on top of Storage.
+///
+/// Settings_t selects the memory type, the block size, the value Erase()
+/// fills blocks with, and whether writes can only clear bits as on NOR flash.
+/// With recording enabled, each Read(), Write() and Erase() is appended to
+/// `accesses`, so tests can check which blocks were accessed and how often.
+///
+/// Accesses past the end of `memory` throw std::errc::result_out_of_range.
+/// `memory` starts zeroed and can be filled or resized by the test.
+///
+/// USAGE:
+///
+///    sjsu::testing::RamStorage flash({ .type            = Storage::Type::kNor,
+///                                      .block_size      = 32,
+///                                      .blocks          = 16,
+///                                      .only_clear_bits = true,
+///                                      .record          = true });
+///    RecordStore<32, 8> store(flash);
+///    store.Initialize();
+///    CHECK(1 == flash.Count('e'));
+class RamStorage : public sjsu::Storage
+{
+ public:
+  /// Configuration of the storage.
+  struct Settings_t
+  {
+    /// Memory type returned by GetMemoryType().
+    Type type = Type::kRam;
+
+    /// Block size in bytes. Can be changed after construction, which does
+    /// not resize `memory`.
+    size_t block_size = 4;
+
+    /// Number of blocks `memory` starts with.
+    size_t blocks = 16;
+
+    /// Value Erase() sets each byte of the erased blocks to.
+    uint8_t erase_value = 0xFF;
+
+    /// Writes can only clear bits, as on NOR flash. Setting a bit that is
+    /// not set in `memory` throws std::errc::io_error until the block is
+    /// erased.
+    bool only_clear_bits = false;
+
+    /// Value returned by IsReadOnly(). Writes are still carried out.
+    bool read_only = false;
+
+    /// Map() returns a view of `memory` rather than an empty span.
+    bool mappable = false;
+
+    /// Append each access to `accesses`.
+    bool record = false;
+  };
+
+  /// One call to Read(), Write() or Erase().
+  struct Access_t
+  {
+    /// 'r' for Read(), 'w' for Write() and 'e' for Erase().
+    char type;
+
+    /// First block accessed.
+    uint32_t block;
+
+    /// Number of blocks accessed, counting a partial last block.
+    size_t blocks;
+
+    bool operator==(const Access_t &) const = default;
+  };
+
+  /// Storage of 16 blocks of 4 bytes, without recording.
+  RamStorage() : RamStorage(Settings_t{}) {}
+
+  /// @param storage_settings - configuration of the storage.
+  explicit RamStorage(Settings_t storage_settings)
+      : settings(storage_settings),
+        memory(storage_settings.blocks * storage_settings.block_size, 0)
+  {
+  }
+
+  void ModuleInitialize() override {}
+
+  Type GetMemoryType() override
+  {
+    return settings.type;
+  }
+
+  bool IsMediaPresent() override
+  {
+    return true;
+  }
+
+  bool IsReadOnly() override
+  {
+    return settings.read_only;
+  }
+
+  units::data::byte_t GetCapacity() override
+  {
+    return units::data::byte_t(static_cast<float>(memory.size()));
+  }
+
+  units::data::byte_t GetBlockSize() override
+  {
+    return units::data::byte_t(static_cast<float>(settings.block_size));
+  }
+
+  void Erase(uint32_t block_address, size_t blocks_count) override
+  {
+    auto bytes = Bytes(block_address, blocks_count * settings.block_size);
+    Record('e', block_address, bytes.size());
+    std::fill(bytes.begin(), bytes.end(), settings.erase_value);
+  }
+
+  void Write(uint32_t block_address, std::span<const uint8_t> data) override
+  {
+    auto bytes = Bytes(block_address, data.size());
+    Record('w', block_address, data.size());
+    for (size_t i = 0; i < data.size(); i++)
+    {
+      if (settings.only_clear_bits && (bytes[i] & data[i]) != data[i])
+      {
+        throw Exception(std::errc::io_error, "Block was not erased.");
+      }
+      bytes[i] = data[i];
+    }
+  }
+
+  void Read(uint32_t block_address, std::span<uint8_t> data) override
+  {
+    auto bytes = Bytes(block_address, data.size());
+    Record('r', block_address, data.size());
+    std::copy(bytes.begin(), bytes.end(), data.begin());
+  }
+
+  std::span<const uint8_t> Map(uint32_t block_address,
+                               size_t blocks_count) override
+  {
+    if (!settings.mappable)
+    {
+      return {};
+    }
+    return Bytes(block_address, blocks_count * settings.block_size);
+  }
+
+  using Storage::Read;
+  using Storage::Write;
+
+  /// @param type - 'r', 'w' or 'e', see Access_t::type.
+  /// @return size_t - number of recorded accesses of `type`.
+  size_t Count(char type) const
+  {
+    return static_cast<size_t>(std::count_if(
+        accesses.begin(), accesses.end(), [type](const Access_t & access) {
+          return access.type == type;
+        }));
+  }
+
+  /// @param type - 'r', 'w' or 'e', see Access_t::type.
+  /// @param block - first block of the accesses to count.
+  /// @return size_t - number of recorded accesses of `type` that start at
+  ///         `block`.
+  size_t Count(char type, uint32_t block) const
+  {
+    return static_cast<size_t>(std::count_if(
+        accesses.begin(),
+        accesses.end(),
+        [type, block](const Access_t & access) {
+          return access.type == type && access.block == block;
+        }));
+  }
+
+  Settings_t settings;
+  std::vector<uint8_t> memory;
+  std::vector<Access_t> accesses;
+
+ private:
+  std::span<uint8_t> Bytes(uint32_t block_address, size_t length)
+  {
+    const size_t kOffset = block_address * settings.block_size;
+    if (kOffset > memory.size() || length > memory.size() - kOffset)
+    {
+      throw Exception(std::errc::result_out_of_range,
+                      "Access past the end of the storage.");
+    }
+    return std::span(memory).subspan(kOffset, length);
+  }
+
+  void Record(char type, uint32_t block_address, size_t length)
+  {
+    if (settings.record)
+    {
+      const size_t kBlocks =
+          (length + settings.block_size - 1) / settings.block_size;
+      accesses.push_back({ type, block_address, kBlocks });
+    }
+  }
+};
+}  // namespace sjsu::testing
@@ -0,0 +1,91 @@
+#include <libcore/testing/ram_storage.hpp>
+
+#include <array>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::testing
+{
+TEST_CASE("Testing RamStorage")
+{
+  RamStorage test_subject({ .block_size = 4, .blocks = 4, .record = true });
+  using Access_t = RamStorage::Access_t;
+
+  SECTION("Reports its settings")
+  {
+    // Exercise & Verify
+    CHECK(Storage::Type::kRam == test_subject.GetMemoryType());
+    CHECK(16_B == test_subject.GetCapacity());
+    CHECK(4_B == test_subject.GetBlockSize());
+    CHECK(!test_subject.IsReadOnly());
+    CHECK(test_subject.Map(0, 1).empty());
+  }
+
+  SECTION("Erase(), Write() and Read() are recorded by block")
+  {
+    // Setup
+    const std::array<uint8_t, 5> kData = { 1, 2, 3, 4, 5 };
+    std::array<uint8_t, 4> read{};
+
+    // Exercise
+    test_subject.Erase(1, 2);
+    test_subject.Write(1, kData);
+    test_subject.Read(2, read);
+
+    // Verify
+    CHECK(test_subject.memory == std::vector<uint8_t>{ 0,    0,    0,    0,
+                                                       1,    2,    3,    4,
+                                                       5,    0xFF, 0xFF, 0xFF,
+                                                       0,    0,    0,    0 });
+    CHECK(read == std::array<uint8_t, 4>{ 5, 0xFF, 0xFF, 0xFF });
+    CHECK(test_subject.accesses == std::vector<Access_t>{
+                                       { 'e', 1, 2 },
+                                       { 'w', 1, 2 },
+                                       { 'r', 2, 1 },
+                                   });
+    CHECK(1 == test_subject.Count('w'));
+    CHECK(0 == test_subject.Count('w', 2));
+  }
+
+  SECTION("Accesses past the end throw")
+  {
+    // Setup
+    std::array<uint8_t, 8> data{};
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(test_subject.Read(3, data),
+                        std::errc::result_out_of_range);
+    SJ2_CHECK_EXCEPTION(test_subject.Erase(4, 1),
+                        std::errc::result_out_of_range);
+    CHECK(test_subject.accesses.empty());
+  }
+
+  SECTION("NOR flash writes can only clear bits until erased")
+  {
+    // Setup
+    RamStorage flash({ .type = Storage::Type::kNor, .only_clear_bits = true });
+    const std::array<uint8_t, 1> kData = { 0x5A };
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(flash.Write(0, kData), std::errc::io_error);
+    flash.Erase(0, 1);
+    flash.Write(0, kData);
+    CHECK(0x5A == flash.memory[0]);
+    CHECK(flash.accesses.empty());
+  }
+
+  SECTION("A mappable storage maps its memory")
+  {
+    // Setup
+    test_subject.settings.mappable = true;
+
+    // Exercise
+    auto mapped = test_subject.Map(1, 2);
+
+    // Verify
+    CHECK(&test_subject.memory[4] == mapped.data());
+    CHECK(8 == mapped.size());
+  }
+}
+}  // namespace sjsu::testing
@@ -0,0 +1,874 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <vector>
+
+#include <libcore/peripherals/can.hpp>
+#include <libcore/peripherals/i2c.hpp>
+#include <libcore/peripherals/interrupt.hpp>
+#include <libcore/peripherals/spi.hpp>
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/inplace_function.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+/// Peripherals that take as long as real hardware would, for load testing
+/// firmware logic on the host.
+///
+/// Unlike the mocks, which complete every operation instantly, these model the
+/// time spent on the wire at the configured bit rate, the depth of the
+/// hardware FIFOs and the latency before an interrupt handler runs, all on the
+/// simulated timeline of a VirtualClock. Blocking calls such as Write() and
+/// Transfer() move the clock forward, running any events due on the way, just
+/// as interrupts would fire while the processor waits on a real bus. Each
+/// simulator keeps statistics, such as FIFO overruns and the deepest FIFO
+/// occupancy, to show where buffers overflow under load.
+///
+/// The VirtualClock must be started before any blocking call, otherwise a
+/// blocking call will never see its transfer complete.
+namespace sjsu::simulation
+{
+/// @param bits - number of bits on the wire.
+/// @param bit_rate - bits per second.
+/// @return std::chrono::nanoseconds - time taken to send the bits.
+constexpr std::chrono::nanoseconds BitTime(uint64_t bits, uint64_t bit_rate)
+{
+  constexpr uint64_t kNanosecondsPerSecond = 1'000'000'000;
+  return std::chrono::nanoseconds(bits * kNanosecondsPerSecond / bit_rate);
+}
+
+/// Simulated UART with a receive FIFO, a transmit FIFO and a shift register,
+/// each byte taking a full character time at the configured baud rate.
+///
+/// Bytes sent by the remote device are injected with Inject(), and arrive one
+/// character time apart. A byte that arrives at a full receive FIFO is lost,
+/// which is counted as an overrun. Bytes written by the firmware leave the
+/// wire one character time apart and are passed to `on_transmit`.
+///
+/// With 9-bit frames, address frames are injected with InjectAddress() and
+/// written with WriteAddress(). When `settings.address_match` is enabled, the
+/// receiver is muted, storing nothing and raising no interrupts, until an
+/// address frame for this node arrives, as multidrop hardware does.
+///
+/// USAGE:
+///
+///    sjsu::VirtualClock clock;
+///    clock.Start();
+///    sjsu::simulation::Uart uart(clock, { .rx_fifo_depth = 16 });
+///    uart.settings.baud_rate = 115200;
+///    uart.Initialize();
+///    uart.Inject(gps_sentence);
+///    clock.Advance(10ms);
+///    CHECK(0 == uart.statistics.overruns);
+class Uart : public sjsu::Uart
+{
+ public:
+  /// Hardware properties of the simulated UART.
+  struct Config_t
+  {
+    /// Number of received bytes the hardware holds before overrunning.
+    size_t rx_fifo_depth = 16;
+
+    /// Number of bytes the hardware holds waiting to be transmitted, not
+    /// counting the byte in the shift register.
+    size_t tx_fifo_depth = 16;
+
+    /// Time from a byte arriving to `receive_handler` being called.
+    std::chrono::nanoseconds interrupt_latency = 1us;
+  };
+
+  /// Counts of what happened on the simulated UART.
+  struct Statistics_t
+  {
+    /// Bytes that arrived on the RX line, including those lost to overruns.
+    size_t bytes_received = 0;
+
+    /// Bytes that left on the TX line.
+    size_t bytes_transmitted = 0;
+
+    /// Bytes lost because they arrived at a full receive FIFO.
+    size_t overruns = 0;
+
+    /// Largest number of bytes held by the receive FIFO at once.
+    size_t max_rx_fifo_level = 0;
+
+    /// Frames ignored by address matching, for other nodes of the bus.
+    size_t muted_frames = 0;
+  };
+
+  /// @param clock - virtual clock the UART runs on.
+  /// @param config - hardware properties of the UART.
+  Uart(VirtualClock & clock, Config_t config)
+      : clock_(clock), config_(config)
+  {
+  }
+
+  /// @param clock - virtual clock the UART runs on.
+  explicit Uart(VirtualClock & clock) : Uart(clock, Config_t{}) {}
+
+  void ModuleInitialize() override
+  {
+    if (settings.baud_rate == 0)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Simulated UART baud rate must not be zero.");
+    }
+
+    constexpr uint32_t kStartBit = 1;
+    const uint32_t kDataBits = static_cast<uint32_t>(settings.frame_size) + 5;
+    const uint32_t kParityBits =
+        (settings.parity == UartSettings_t::Parity::kNone) ? 0 : 1;
+    const uint32_t kStopBits =
+        (settings.stop == UartSettings_t::StopBits::kDouble) ? 2 : 1;
+
+    character_time_ = BitTime(kStartBit + kDataBits + kParityBits + kStopBits,
+                              settings.baud_rate);
+
+    const bool kMatching =
+        settings.address_match != UartSettings_t::AddressMatch::kDisabled;
+    if (kMatching &&
+        settings.frame_size != UartSettings_t::FrameSize::kNineBits)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Address matching requires 9-bit frames.");
+    }
+    muted_ = kMatching;
+  }
+
+  bool HasData() override
+  {
+    return !rx_fifo_.empty();
+  }
+
+  /// Blocks while the transmit FIFO is full, as a polling driver would, and
+  /// returns once the last byte is in the FIFO.
+  void Write(std::span<const uint8_t> data) override
+  {
+    for (const uint8_t kByte : data)
+    {
+      Transmit(kByte);
+    }
+  }
+
+  /// Blocks while the transmit FIFO is full, like Write().
+  void WriteAddress(uint8_t address) override
+  {
+    Transmit(kAddressBit | address);
+  }
+
+  void Mute() override
+  {
+    muted_ =
+        (settings.address_match != UartSettings_t::AddressMatch::kDisabled);
+  }
+
+  size_t Read(std::span<uint8_t> data) override
+  {
+    const size_t kCount = std::min(data.size(), rx_fifo_.size());
+    for (size_t i = 0; i < kCount; i++)
+    {
+      data[i] = rx_fifo_.front();
+      rx_fifo_.pop_front();
+    }
+    return kCount;
+  }
+
+  void Flush() override
+  {
+    rx_fifo_.clear();
+  }
+
+  /// Queue bytes sent by the remote device. Each arrives one character time
+  /// after the previous one, or after any bytes injected before it.
+  ///
+  /// @param data - bytes to send to the UART.
+  void Inject(std::span<const uint8_t> data)
+  {
+    for (const uint8_t kByte : data)
+    {
+      Receive(kByte);
+    }
+  }
+
+  /// Queue an address frame sent by the remote device, which arrives one
+  /// character time after any bytes injected before it.
+  ///
+  /// @param address - address of the node the following bytes are for.
+  void InjectAddress(uint8_t address)
+  {
+    Receive(kAddressBit | address);
+  }
+
+  /// Receive an address frame now. See Deliver().
+  ///
+  /// @param address - the address that arrived.
+  void DeliverAddress(uint8_t address)
+  {
+    statistics.bytes_received++;
+
+    if (settings.address_match == UartSettings_t::AddressMatch::kDisabled)
+    {
+      Store(address);
+      return;
+    }
+
+    // The address frame itself is consumed by the matching hardware.
+    muted_ = !settings.IsAddressedToNode(address);
+    if (muted_)
+    {
+      statistics.muted_frames++;
+    }
+  }
+
+  /// Put a byte into the receive FIFO now, for connecting the `on_transmit` of
+  /// another simulated UART, whose bytes have already spent their time on the
+  /// wire. The byte is ignored while the receiver is muted by address
+  /// matching.
+  ///
+  /// @param byte - the byte that arrived.
+  void Deliver(uint8_t byte)
+  {
+    statistics.bytes_received++;
+
+    if (muted_)
+    {
+      statistics.muted_frames++;
+      return;
+    }
+
+    Store(byte);
+  }
+
+  /// @return true if bytes are still waiting in the transmit FIFO or leaving
+  ///         the shift register.
+  bool IsTransmitting() const
+  {
+    return transmitting_;
+  }
+
+  /// @return std::chrono::nanoseconds - time taken by one byte on the wire,
+  ///         including start, parity and stop bits. Valid after Initialize().
+  std::chrono::nanoseconds CharacterTime() const
+  {
+    return character_time_;
+  }
+
+  /// Called, after the interrupt latency, for each byte put in the receive
+  /// FIFO, standing in for the driver's receive interrupt.
+  InterruptCallback receive_handler = nullptr;
+
+  /// Called with each byte as it finishes leaving the TX line.
+  InplaceFunction<void(uint8_t)> on_transmit = nullptr;
+
+  /// Called with each address frame written with WriteAddress() as it
+  /// finishes leaving the TX line.
+  InplaceFunction<void(uint8_t)> on_transmit_address = nullptr;
+
+  /// Counts of what happened on this UART.
+  Statistics_t statistics;
+
+ private:
+  /// 9th bit of a frame, set for address frames.
+  static constexpr uint16_t kAddressBit = 1 << 8;
+
+  void Transmit(uint16_t frame)
+  {
+    Wait(std::chrono::nanoseconds::max(),
+         [this]() { return tx_fifo_.size() < config_.tx_fifo_depth; });
+
+    tx_fifo_.push_back(frame);
+    if (!transmitting_)
+    {
+      TransmitNext();
+    }
+  }
+
+  void Receive(uint16_t frame)
+  {
+    rx_line_free_ = std::max(rx_line_free_, clock_.Now());
+    rx_line_free_ += character_time_;
+    clock_.Schedule(rx_line_free_, [this, frame]() {
+      const auto kByte = static_cast<uint8_t>(frame);
+      if (frame & kAddressBit)
+      {
+        DeliverAddress(kByte);
+      }
+      else
+      {
+        Deliver(kByte);
+      }
+    });
+  }
+
+  void Store(uint8_t byte)
+  {
+    if (rx_fifo_.size() >= config_.rx_fifo_depth)
+    {
+      statistics.overruns++;
+      return;
+    }
+
+    rx_fifo_.push_back(byte);
+    statistics.max_rx_fifo_level =
+        std::max(statistics.max_rx_fifo_level, rx_fifo_.size());
+
+    if (receive_handler)
+    {
+      clock_.ScheduleAfter(config_.interrupt_latency, [this]() {
+        if (receive_handler)
+        {
+          receive_handler();
+        }
+      });
+    }
+  }
+
+  void TransmitNext()
+  {
+    // The byte moves into the shift register, freeing its place in the FIFO
+    // for the whole time it spends on the wire.
+    const uint16_t kFrame = tx_fifo_.front();
+    tx_fifo_.pop_front();
+    transmitting_ = true;
+
+    clock_.ScheduleAfter(character_time_, [this, kFrame]() {
+      statistics.bytes_transmitted++;
+      const auto kByte = static_cast<uint8_t>(kFrame);
+      if ((kFrame & kAddressBit) && on_transmit_address)
+      {
+        on_transmit_address(kByte);
+      }
+      else if (!(kFrame & kAddressBit) && on_transmit)
+      {
+        on_transmit(kByte);
+      }
+
+      if (tx_fifo_.empty())
+      {
+        transmitting_ = false;
+      }
+      else
+      {
+        TransmitNext();
+      }
+    });
+  }
+
+  VirtualClock & clock_;
+  Config_t config_;
+  std::chrono::nanoseconds character_time_ = 0ns;
+  std::chrono::nanoseconds rx_line_free_   = 0ns;
+  std::deque<uint8_t> rx_fifo_;
+  std::deque<uint16_t> tx_fifo_;
+  bool transmitting_ = false;
+  bool muted_        = false;
+};
+
+/// Simulated SPI controller whose transfers block for as long as clocking the
+/// frames out at `settings.clock_rate` takes, on whichever VirtualClock is
+/// running.
+///
+/// The device on the bus is modeled by `device`, which is given each frame
+/// sent and returns the frame sent back. Without a device, every frame reads
+/// back as all ones, as from a floating MISO line with a pull up.
+class Spi : public sjsu::Spi
+{
+ public:
+  /// Timing of the simulated SPI controller beyond the clock rate.
+  struct Config_t
+  {
+    /// Time spent by each Transfer() call outside of clocking frames, such as
+    /// setting up the controller or a DMA channel.
+    std::chrono::nanoseconds transfer_overhead = 1us;
+
+    /// Idle time between consecutive frames.
+    std::chrono::nanoseconds frame_gap = 0ns;
+  };
+
+  /// Counts of what happened on the simulated SPI bus.
+  struct Statistics_t
+  {
+    /// Number of Transfer() calls.
+    size_t transfers = 0;
+
+    /// Number of frames exchanged.
+    size_t frames = 0;
+
+    /// Total time spent in Transfer().
+    std::chrono::nanoseconds busy_time = 0ns;
+  };
+
+  /// Frame read back when there is no device on the bus.
+  static constexpr uint16_t kFillerFrame = 0xFFFF;
+
+  /// @param config - timing of the controller.
+  explicit Spi(Config_t config) : config_(config) {}
+
+  /// Controller with the default Config_t timing.
+  Spi() : Spi(Config_t{}) {}
+
+  void ModuleInitialize() override
+  {
+    if (settings.clock_rate.to<uint32_t>() == 0)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Simulated SPI clock rate must not be zero.");
+    }
+  }
+
+  void Transfer(std::span<uint8_t> buffer) override
+  {
+    Clock(buffer.size());
+    for (auto & frame : buffer)
+    {
+      frame = static_cast<uint8_t>(Exchange(frame));
+    }
+  }
+
+  void Transfer(std::span<uint16_t> buffer) override
+  {
+    Clock(buffer.size());
+    for (auto & frame : buffer)
+    {
+      frame = Exchange(frame);
+    }
+  }
+
+  /// @param frames - number of frames in a transfer.
+  /// @return std::chrono::nanoseconds - time a transfer of that many frames
+  ///         takes with the current settings.
+  std::chrono::nanoseconds TransferTime(size_t frames) const
+  {
+    const uint64_t kBits = static_cast<uint64_t>(settings.frame_size) + 4;
+    return config_.transfer_overhead +
+           frames * (BitTime(kBits, settings.clock_rate.to<uint64_t>()) +
+                     config_.frame_gap);
+  }
+
+  /// Device on the bus, given each frame sent and returning the frame read
+  /// back. Called after the transfer's time on the bus has passed.
+  InplaceFunction<uint16_t(uint16_t)> device = nullptr;
+
+  /// Counts of what happened on this bus.
+  Statistics_t statistics;
+
+ private:
+  void Clock(size_t frames)
+  {
+    const auto kDuration = TransferTime(frames);
+    statistics.transfers++;
+    statistics.frames += frames;
+    statistics.busy_time += kDuration;
+    Delay(kDuration);
+  }
+
+  uint16_t Exchange(uint16_t frame)
+  {
+    return device ? device(frame) : kFillerFrame;
+  }
+
+  Config_t config_;
+};
+
+/// Simulated I2C controller whose transactions block, on whichever
+/// VirtualClock is running, for as long as they take on the bus at
+/// `settings.frequency`: start and stop conditions, and nine clocks per byte
+/// including the acknowledge bit.
+///
+/// The devices on the bus are modeled by `device`, which is given the address,
+/// the bytes written and a buffer for the bytes read, and returns false when
+/// no device acknowledges the address. The transaction then fails with
+/// std::errc::no_such_device_or_address after only the address has been sent.
+class I2c : public sjsu::I2c
+{
+ public:
+  /// Function modeling the devices on the bus.
+  using Device = InplaceFunction<bool(uint8_t address,
+                                      std::span<const uint8_t> written,
+                                      std::span<uint8_t> read)>;
+
+  /// Counts of what happened on the simulated I2C bus.
+  struct Statistics_t
+  {
+    /// Number of transactions, including those not acknowledged.
+    size_t transactions = 0;
+
+    /// Number of transactions no device acknowledged.
+    size_t not_acknowledged = 0;
+
+    /// Total time spent in transactions.
+    std::chrono::nanoseconds busy_time = 0ns;
+  };
+
+  void ModuleInitialize() override
+  {
+    if (settings.frequency.to<uint32_t>() == 0)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Simulated I2C frequency must not be zero.");
+    }
+  }
+
+  void Transaction(Transaction_t transaction) override
+  {
+    constexpr uint64_t kClocksPerByte = 9;
+    constexpr uint64_t kStart         = 1;
+    constexpr uint64_t kStop          = 1;
+
+    const uint64_t kFrequency = settings.frequency.to<uint64_t>();
+    statistics.transactions++;
+
+    written_.assign(transaction.data_out,
+                    transaction.data_out + transaction.out_length);
+    written_.insert(written_.end(),
+                    transaction.data_out_tail,
+                    transaction.data_out_tail + transaction.out_tail_length);
+
+    const std::span<uint8_t> kRead(transaction.data_in, transaction.in_length);
+    const bool kAcknowledged =
+        device && device(transaction.address, written_, kRead);
+
+    if (!kAcknowledged)
+    {
+      statistics.not_acknowledged++;
+      Spend(BitTime(kStart + kClocksPerByte + kStop, kFrequency));
+      throw CommonErrors::kDeviceNotFound;
+    }
+
+    uint64_t clocks = kStart + kClocksPerByte +
+                      kClocksPerByte * written_.size() +
+                      kClocksPerByte * transaction.in_length + kStop;
+    if (transaction.repeated)
+    {
+      // Repeated start followed by the address again, with the read bit set.
+      clocks += kStart + kClocksPerByte;
+    }
+
+    Spend(BitTime(clocks, kFrequency));
+  }
+
+  /// Devices on the bus.
+  Device device = nullptr;
+
+  /// Counts of what happened on this bus.
+  Statistics_t statistics;
+
+ private:
+  void Spend(std::chrono::nanoseconds duration)
+  {
+    statistics.busy_time += duration;
+    Delay(duration);
+  }
+
+  std::vector<uint8_t> written_;
+};
+
+/// Simulated CAN controller on a shared bus, with transmit mailboxes, a
+/// receive FIFO and bitwise arbitration.
+///
+/// Frames from the other nodes on the bus are injected with Inject(). Frames
+/// wait for the bus to be idle, and among the frames waiting, the one with the
+/// lowest identifier wins arbitration, as on a real bus. Each frame occupies
+/// the bus for its length in bits at `settings.baud_rate`, including the
+/// interframe space and, by default, the worst case number of stuff bits. A
+/// received frame that finds the receive FIFO full is lost, which is counted
+/// as an overrun.
+///
+/// After a frame is received, `settings.handler` is called once the interrupt
+/// latency has passed, so a CanNetwork can be attached to the simulator.
+class Can : public sjsu::Can
+{
+ public:
+  /// Hardware properties of the simulated CAN controller.
+  struct Config_t
+  {
+    /// Number of received frames the hardware holds before overrunning.
+    size_t rx_fifo_depth = 3;
+
+    /// Number of frames the hardware can hold waiting for the bus.
+    size_t tx_mailboxes = 3;
+
+    /// Time from a frame being received to `settings.handler` being called.
+    std::chrono::nanoseconds interrupt_latency = 1us;
+
+    /// Count the largest number of stuff bits a frame could need, rather than
+    /// none, for a worst case bus load.
+    bool worst_case_stuffing = true;
+  };
+
+  /// Counts of what happened on the simulated CAN bus.
+  struct Statistics_t
+  {
+    /// Frames received from the bus, including those lost to overruns.
+    size_t frames_received = 0;
+
+    /// Frames sent by this controller.
+    size_t frames_transmitted = 0;
+
+    /// Frames lost because they arrived at a full receive FIFO.
+    size_t overruns = 0;
+
+    /// Largest number of frames held by the receive FIFO at once.
+    size_t max_rx_fifo_level = 0;
+
+    /// Times a frame of this controller lost arbitration to another node.
+    size_t arbitration_lost = 0;
+
+    /// Total time the bus carried frames. Divided by the elapsed time it gives
+    /// the bus load.
+    std::chrono::nanoseconds bus_busy_time = 0ns;
+  };
+
+  /// @param clock - virtual clock the controller runs on.
+  /// @param config - hardware properties of the controller.
+  Can(VirtualClock & clock, Config_t config)
+      : clock_(clock), config_(config), occupied_(config.tx_mailboxes, false)
+  {
+  }
+
+  /// @param clock - virtual clock the controller runs on.
+  explicit Can(VirtualClock & clock) : Can(clock, Config_t{}) {}
+
+  void ModuleInitialize() override
+  {
+    if (settings.baud_rate.to<uint32_t>() == 0)
+    {
+      throw Exception(std::errc::invalid_argument,
+                      "Simulated CAN baud rate must not be zero.");
+    }
+  }
+
+  /// Blocks while every transmit mailbox is full, and returns once the message
+  /// is in a mailbox.
+  void Send(const Message_t & message) override
+  {
+    auto free_mailbox = occupied_.end();
+    Wait(std::chrono::nanoseconds::max(), [this, &free_mailbox]() {
+      free_mailbox = std::find(occupied_.begin(), occupied_.end(), false);
+      return free_mailbox != occupied_.end();
+    });
+
+    LoadMailbox(free_mailbox - occupied_.begin(), message);
+  }
+
+  size_t TransmitMailboxes() override
+  {
+    return config_.tx_mailboxes;
+  }
+
+  bool IsMailboxPending(size_t mailbox) override
+  {
+    return occupied_.at(mailbox);
+  }
+
+  void LoadMailbox(size_t mailbox, const Message_t & message) override
+  {
+    if (occupied_.at(mailbox))
+    {
+      throw Exception(std::errc::device_or_resource_busy,
+                      "Simulated CAN mailbox is not empty.");
+    }
+
+    occupied_[mailbox] = true;
+    waiting_.push_back(
+        { .message = message, .local = true, .mailbox = mailbox });
+    Arbitrate();
+  }
+
+  /// A frame still waiting for the bus is removed at once. A frame on the bus
+  /// is waited for.
+  bool AbortMailbox(size_t mailbox) override
+  {
+    auto waiting = std::find_if(
+        waiting_.begin(), waiting_.end(), [mailbox](const Waiting_t & frame) {
+          return frame.local && frame.mailbox == mailbox;
+        });
+
+    if (waiting != waiting_.end())
+    {
+      waiting_.erase(waiting);
+      occupied_[mailbox] = false;
+      return true;
+    }
+
+    Wait(std::chrono::nanoseconds::max(),
+         [this, mailbox]() { return !occupied_.at(mailbox); });
+    return false;
+  }
+
+  Message_t Receive() override
+  {
+    Message_t message{};
+    if (!rx_fifo_.empty())
+    {
+      message = rx_fifo_.front();
+      rx_fifo_.pop_front();
+    }
+    return message;
+  }
+
+  bool HasData() override
+  {
+    return !rx_fifo_.empty();
+  }
+
+  bool SelfTest([[maybe_unused]] uint32_t id) override
+  {
+    return true;
+  }
+
+  bool IsBusOff() override
+  {
+    return false;
+  }
+
+  /// Have another node on the bus start sending a frame now. It is sent once
+  /// it wins arbitration.
+  ///
+  /// @param message - the frame the other node sends.
+  void Inject(const Message_t & message)
+  {
+    waiting_.push_back({ .message = message, .local = false });
+    Arbitrate();
+  }
+
+  /// @param message - a CAN frame.
+  /// @return uint32_t - number of bits the frame occupies on the bus,
+  ///         including the interframe space.
+  uint32_t FrameBits(const Message_t & message) const
+  {
+    return sjsu::Can::FrameBits(message, config_.worst_case_stuffing);
+  }
+
+  Counters_t GetCounters() override
+  {
+    return {
+      .frames_transmitted = static_cast<uint32_t>(
+          statistics.frames_transmitted),
+      .bits_transmitted = bits_transmitted_,
+      .receive_overruns = static_cast<uint32_t>(statistics.overruns),
+      .arbitration_lost = static_cast<uint32_t>(statistics.arbitration_lost),
+    };
+  }
+
+  /// Called with each frame this controller sends, when it finishes on the bus.
+  InplaceFunction<void(const Message_t &)> on_transmit = nullptr;
+
+  /// Counts of what happened on this bus.
+  Statistics_t statistics;
+
+ private:
+  struct Waiting_t
+  {
+    Message_t message;
+    bool local;
+    size_t mailbox = 0;
+  };
+
+  /// @return uint64_t - the arbitration field as bits on the bus, so that the
+  ///         lowest value wins. A standard frame beats an extended frame with
+  ///         the same base identifier, as its IDE bit is dominant.
+  static uint64_t ArbitrationKey(const Message_t & message)
+  {
+    if (message.format == Message_t::Format::kExtended)
+    {
+      return (uint64_t{ message.id } << 1) | 1;
+    }
+    return uint64_t{ message.id } << 19;
+  }
+
+  void Arbitrate()
+  {
+    if (bus_busy_ || waiting_.empty())
+    {
+      return;
+    }
+
+    auto winner = std::min_element(
+        waiting_.begin(),
+        waiting_.end(),
+        [](const Waiting_t & left, const Waiting_t & right) {
+          return ArbitrationKey(left.message) < ArbitrationKey(right.message);
+        });
+
+    on_bus_ = *winner;
+    waiting_.erase(winner);
+    bus_busy_ = true;
+
+    if (!on_bus_.local &&
+        std::any_of(waiting_.begin(), waiting_.end(), [](const auto & frame) {
+          return frame.local;
+        }))
+    {
+      statistics.arbitration_lost++;
+    }
+
+    const auto kDuration =
+        BitTime(FrameBits(on_bus_.message), settings.baud_rate.to<uint64_t>());
+    statistics.bus_busy_time += kDuration;
+    clock_.ScheduleAfter(kDuration, [this]() { FinishFrame(); });
+  }
+
+  void FinishFrame()
+  {
+    bus_busy_ = false;
+
+    if (on_bus_.local)
+    {
+      occupied_[on_bus_.mailbox] = false;
+      statistics.frames_transmitted++;
+      bits_transmitted_ += FrameBits(on_bus_.message);
+      if (on_transmit)
+      {
+        on_transmit(on_bus_.message);
+      }
+    }
+    else
+    {
+      ReceiveFrame(on_bus_.message);
+    }
+
+    Arbitrate();
+  }
+
+  void ReceiveFrame(Message_t message)
+  {
+    statistics.frames_received++;
+
+    if (rx_fifo_.size() >= config_.rx_fifo_depth)
+    {
+      statistics.overruns++;
+      return;
+    }
+
+    message.uptime = clock_.Now();
+    rx_fifo_.push_back(message);
+    statistics.max_rx_fifo_level =
+        std::max(statistics.max_rx_fifo_level, rx_fifo_.size());
+
+    if (settings.handler)
+    {
+      clock_.ScheduleAfter(config_.interrupt_latency, [this]() {
+        if (settings.handler)
+        {
+          settings.handler(*this);
+        }
+      });
+    }
+  }
+
+  VirtualClock & clock_;
+  Config_t config_;
+  std::vector<Waiting_t> waiting_;
+  Waiting_t on_bus_{};
+  bool bus_busy_              = false;
+  uint32_t bits_transmitted_ = 0;
+  std::vector<bool> occupied_;
+  std::deque<Message_t> rx_fifo_;
+};
+}  // namespace sjsu::simulation
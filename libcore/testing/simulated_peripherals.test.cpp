@@ -0,0 +1,294 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/testing/simulated_peripherals.hpp>
+
+#include <array>
+#include <vector>
+
+namespace sjsu
+{
+TEST_CASE("Testing simulated peripherals")
+{
+  VirtualClock clock;
+  clock.Start();
+
+  SECTION("Uart bytes arrive one character time apart")
+  {
+    // Setup
+    simulation::Uart uart(clock);
+    uart.settings.baud_rate = 100'000;
+    uart.settings.parity    = UartSettings_t::Parity::kEven;
+    uart.Initialize();
+    constexpr std::array<uint8_t, 3> kData = { 'a', 'b', 'c' };
+
+    // Exercise
+    uart.Inject(kData);
+    clock.Advance(219us);
+    const bool kBeforeSecondByte = (uart.statistics.bytes_received == 1);
+    clock.Advance(125us);
+
+    // Verify
+    // Start, 8 data, parity and stop bits at 10us each.
+    CHECK(110us == uart.CharacterTime());
+    CHECK(kBeforeSecondByte);
+    CHECK(3 == uart.statistics.bytes_received);
+    std::array<uint8_t, 4> received = {};
+    CHECK(3 == uart.Read(received));
+    CHECK('c' == received[2]);
+  }
+
+  SECTION("Uart overruns a receive FIFO that is not drained")
+  {
+    // Setup
+    simulation::Uart uart(clock, { .rx_fifo_depth = 4 });
+    uart.settings.baud_rate = 1'000'000;
+    uart.Initialize();
+    int interrupts        = 0;
+    uart.receive_handler  = [&interrupts]() { interrupts++; };
+    const std::vector<uint8_t> kBurst(10, 0x55);
+
+    // Exercise
+    uart.Inject(kBurst);
+    clock.Advance(1ms);
+
+    // Verify
+    CHECK(10 == uart.statistics.bytes_received);
+    CHECK(6 == uart.statistics.overruns);
+    CHECK(4 == uart.statistics.max_rx_fifo_level);
+    CHECK(4 == interrupts);
+  }
+
+  SECTION("Uart Write() blocks once the transmit FIFO is full")
+  {
+    // Setup
+    simulation::Uart uart(clock, { .tx_fifo_depth = 2 });
+    uart.settings.baud_rate = 1'000'000;
+    uart.Initialize();
+    std::vector<uint8_t> sent;
+    uart.on_transmit = [&sent](uint8_t byte) { sent.push_back(byte); };
+    constexpr std::array<uint8_t, 5> kData = { 1, 2, 3, 4, 5 };
+
+    // Exercise
+    uart.Write(kData);
+    const auto kReturnedAt = Uptime();
+    clock.Advance(1ms);
+
+    // Verify
+    // One byte in the shift register and two in the FIFO are accepted without
+    // waiting, the last two wait for a byte each to leave the wire.
+    CHECK(20us == kReturnedAt);
+    CHECK(std::vector<uint8_t>(kData.begin(), kData.end()) == sent);
+    CHECK(!uart.IsTransmitting());
+  }
+
+  SECTION("Uart stays muted until addressed on a multidrop bus")
+  {
+    // Setup
+    simulation::Uart uart(clock);
+    uart.settings.baud_rate     = 1'000'000;
+    uart.settings.frame_size    = UartSettings_t::FrameSize::kNineBits;
+    uart.settings.address_match = UartSettings_t::AddressMatch::kNodeAddress;
+    uart.settings.node_address  = 0x12;
+    uart.Initialize();
+    int interrupts       = 0;
+    uart.receive_handler = [&interrupts]() { interrupts++; };
+    constexpr std::array<uint8_t, 3> kOther = { 1, 2, 3 };
+    constexpr std::array<uint8_t, 2> kOurs  = { 4, 5 };
+
+    // Exercise
+    uart.InjectAddress(0x34);
+    uart.Inject(kOther);
+    uart.InjectAddress(0x12);
+    uart.Inject(kOurs);
+    uart.InjectAddress(0x34);
+    uart.Inject(kOther);
+    clock.Advance(1ms);
+
+    // Verify
+    std::array<uint8_t, 8> received = {};
+    CHECK(2 == uart.Read(received));
+    CHECK(4 == received[0]);
+    CHECK(5 == received[1]);
+    CHECK(2 == interrupts);
+    CHECK(8 == uart.statistics.muted_frames);
+  }
+
+  SECTION("Uart Mute() skips the rest of a message")
+  {
+    // Setup
+    simulation::Uart uart(clock);
+    uart.settings.baud_rate     = 1'000'000;
+    uart.settings.frame_size    = UartSettings_t::FrameSize::kNineBits;
+    uart.settings.address_match = UartSettings_t::AddressMatch::kNodeAddress;
+    uart.settings.node_address  = 0x12;
+    uart.Initialize();
+    constexpr std::array<uint8_t, 3> kData = { 1, 2, 3 };
+    uart.InjectAddress(0x12);
+    uart.Inject(kData);
+    clock.Advance(25us);
+
+    // Exercise
+    uart.Mute();
+    clock.Advance(1ms);
+
+    // Verify
+    // Only the first byte arrived before muting, 11us after the address.
+    std::array<uint8_t, 4> received = {};
+    CHECK(1 == uart.Read(received));
+    CHECK(1 == received[0]);
+  }
+
+  SECTION("Uart address matching requires 9-bit frames")
+  {
+    // Setup
+    simulation::Uart uart(clock);
+    uart.settings.address_match = UartSettings_t::AddressMatch::kNodeAddress;
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(uart.Initialize(), std::errc::invalid_argument);
+  }
+
+  SECTION("Uart WriteAddress() sends an address frame")
+  {
+    // Setup
+    simulation::Uart sender(clock);
+    simulation::Uart receiver(clock);
+    for (simulation::Uart * uart : { &sender, &receiver })
+    {
+      uart->settings.baud_rate  = 1'000'000;
+      uart->settings.frame_size = UartSettings_t::FrameSize::kNineBits;
+    }
+    receiver.settings.address_match =
+        UartSettings_t::AddressMatch::kNodeAddress;
+    receiver.settings.node_address = 0x12;
+    sender.Initialize();
+    receiver.Initialize();
+    sender.on_transmit = [&receiver](uint8_t byte) { receiver.Deliver(byte); };
+    sender.on_transmit_address = [&receiver](uint8_t address) {
+      receiver.DeliverAddress(address);
+    };
+
+    constexpr std::array<uint8_t, 1> kBroadcast = { 0xEE };
+    constexpr std::array<uint8_t, 1> kCommand   = { 0xAB };
+
+    // Exercise
+    sender.Write(kBroadcast);
+    sender.WriteAddress(0x12);
+    sender.Write(kCommand);
+    clock.Advance(1ms);
+
+    // Verify
+    std::array<uint8_t, 4> received = {};
+    CHECK(1 == receiver.Read(received));
+    CHECK(0xAB == received[0]);
+  }
+
+  SECTION("Spi Transfer() takes the time to clock out every frame")
+  {
+    // Setup
+    simulation::Spi spi({ .transfer_overhead = 2us });
+    spi.settings.clock_rate = 1_MHz;
+    spi.Initialize();
+    spi.device = [](uint16_t frame) -> uint16_t { return frame + 1; };
+    std::array<uint8_t, 4> buffer = { 1, 2, 3, 4 };
+
+    // Exercise
+    const auto kStart = Uptime();
+    spi.Transfer(buffer);
+    const auto kDuration = Uptime() - kStart;
+
+    // Verify
+    CHECK(34us <= kDuration);
+    CHECK(kDuration <= 35us);
+    CHECK(std::array<uint8_t, 4>{ 2, 3, 4, 5 } == buffer);
+    CHECK(4 == spi.statistics.frames);
+  }
+
+  SECTION("I2c transactions take nine clocks per byte")
+  {
+    // Setup
+    simulation::I2c i2c;
+    i2c.settings.frequency = 100'000_Hz;
+    i2c.Initialize();
+    i2c.device = [](uint8_t address,
+                    std::span<const uint8_t> written,
+                    std::span<uint8_t> read) {
+      if (address != 0x48)
+      {
+        return false;
+      }
+      std::fill(read.begin(), read.end(), written[0]);
+      return true;
+    };
+    std::array<uint8_t, 2> read = {};
+
+    // Exercise
+    const auto kStart = Uptime();
+    i2c.WriteThenRead(0x48, { 0x0A }, read.data(), read.size());
+    const auto kDuration = Uptime() - kStart;
+
+    // Verify
+    // Start, address, 1 byte written, repeated start, address, 2 bytes read
+    // and stop: 48 clocks of 10us.
+    CHECK(480us <= kDuration);
+    CHECK(kDuration <= 481us);
+    CHECK(std::array<uint8_t, 2>{ 0x0A, 0x0A } == read);
+    CHECK_THROWS_AS(i2c.Write(0x50, { 0x00 }), sjsu::Exception);
+    CHECK(1 == i2c.statistics.not_acknowledged);
+  }
+
+  SECTION("Can frames are sent in order of arbitration")
+  {
+    // Setup
+    simulation::Can can(clock, { .rx_fifo_depth = 2 });
+    can.settings.baud_rate = 500_kHz;
+    can.Initialize();
+    int interrupts       = 0;
+    can.settings.handler = [&interrupts](sjsu::Can &) { interrupts++; };
+    const auto kFrame    = [](uint32_t id) {
+      return Can::Message_t{ .id = id, .length = 8, .payload = {} };
+    };
+
+    // Exercise
+    // The first frame takes the idle bus, the rest arbitrate once it is done.
+    can.Inject(kFrame(0x300));
+    can.Inject(kFrame(0x200));
+    can.Inject(kFrame(0x100));
+    clock.Advance(1ms);
+
+    // Verify
+    // 47 + 64 data bits, 24 stuff bits: 135 bits of 2us each.
+    CHECK(135 == can.FrameBits(kFrame(0x100)));
+    CHECK(3 == can.statistics.frames_received);
+    CHECK(1 == can.statistics.overruns);
+    CHECK(810us == can.statistics.bus_busy_time);
+    CHECK(2 == interrupts);
+    CHECK(0x300 == can.Receive().id);
+    CHECK(0x100 == can.Receive().id);
+  }
+
+  SECTION("Can Send() waits for the bus")
+  {
+    // Setup
+    simulation::Can can(clock, { .tx_mailboxes = 1 });
+    can.settings.baud_rate = 500_kHz;
+    can.Initialize();
+    std::vector<uint32_t> sent;
+    can.on_transmit = [&sent](const Can::Message_t & message) {
+      sent.push_back(message.id);
+    };
+    const Can::Message_t kMessage = { .id = 0x10, .length = 0, .payload = {} };
+
+    // Exercise
+    can.Inject({ .id = 0x01, .length = 8, .payload = {} });
+    can.Send(kMessage);
+    can.Send(kMessage);
+    clock.Advance(1ms);
+
+    // Verify
+    CHECK(std::vector<uint32_t>{ 0x10, 0x10 } == sent);
+    CHECK(2 == can.statistics.frames_transmitted);
+  }
+
+  clock.Stop();
+}
+}  // namespace sjsu
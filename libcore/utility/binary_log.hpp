@@ -0,0 +1,279 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include <libcore/utility/log.hpp>
+#include <libcore/utility/math/byte.hpp>
+#include <libcore/utility/ring_buffer.hpp>
+#include <libcore/utility/time/time.hpp>
+
+#ifndef SJ2_BINARY_LOG_BUFFER_SIZE
+#define SJ2_BINARY_LOG_BUFFER_SIZE 1024
+#endif
+
+namespace sjsu::log
+{
+/// Identifies the format string of a binary log at compile time.
+///
+/// The constructor is consteval, so the format string is hashed by the
+/// compiler and only the resulting 32-bit ID is used at runtime. Since the
+/// string itself is never referenced, it does not need to be stored in flash.
+/// The host side BinaryLogDecoder is given the same format strings and uses
+/// the same hash to match each record back to its format string.
+struct BinaryFormat_t
+{
+  /// @param format - string literal format string, using fmt syntax.
+  template <size_t N>
+  consteval BinaryFormat_t(const char (&format)[N])  // NOLINT
+      : id(Hash(std::string_view(format, N - 1)))
+  {
+  }
+
+  /// 32-bit FNV-1a hash of the format string.
+  ///
+  /// @param format - format string to hash.
+  /// @return constexpr uint32_t - the ID of the format string.
+  static constexpr uint32_t Hash(std::string_view format)
+  {
+    uint32_t hash = 0x811C'9DC5;
+    for (char character : format)
+    {
+      hash = (hash ^ static_cast<uint8_t>(character)) * 0x0100'0193;
+    }
+    return hash;
+  }
+
+  /// ID of the format string.
+  uint32_t id;
+};
+
+/// Type of an argument within a binary log record. Stored in the upper nibble
+/// of each argument's tag byte, with the size of the argument in bytes in the
+/// lower nibble.
+enum class BinaryArgument : uint8_t
+{
+  kUnsigned = 0x00,
+  kSigned   = 0x10,
+  kBool     = 0x20,
+  kChar     = 0x30,
+  kPointer  = 0x40,
+  kString   = 0x50,
+};
+
+/// Binary log state and record layout.
+///
+/// Each record is laid out as follows, with every integer in little endian:
+///
+///    [0]     - total length of the record in bytes, including this byte, in
+///              the lower 7 bits. The upper bit, kTruncated, is set if
+///              arguments were left out because they did not fit.
+///    [1:4]   - BinaryFormat_t::id of the format string
+///    [5:12]  - uptime in nanoseconds when the log was made
+///    [13:]   - arguments, each a tag byte followed by the argument's bytes.
+///              Strings are a tag byte, a length byte and then the characters.
+struct BinaryLog
+{
+  /// Number of bytes in the record header.
+  static constexpr size_t kHeaderSize = 13;
+
+  /// Largest record that can be produced. String arguments are truncated to
+  /// keep records within this size, and arguments that do not fit at all are
+  /// left out and the record marked with kTruncated.
+  static constexpr size_t kMaximumRecordSize = 96;
+
+  /// Flag in the first byte of a record which is set if arguments were left
+  /// out of the record.
+  static constexpr uint8_t kTruncated = 0x80;
+
+  /// Mask of the record length in the first byte of a record.
+  static constexpr uint8_t kLengthMask = 0x7F;
+
+  static_assert(kMaximumRecordSize <= kLengthMask,
+                "The record length must leave room for the kTruncated flag.");
+
+  /// Called with each complete record.
+  ///
+  /// @return true - if the record was accepted.
+  /// @return false - if the record had to be dropped.
+  using Sink = bool (*)(std::span<const uint8_t> record);
+
+  /// Default storage for records until they are read out and sent to the
+  /// host, for example by the idle loop. Only one context may produce records
+  /// when using this buffer, see BufferSink().
+  static inline RingBuffer<uint8_t, SJ2_BINARY_LOG_BUFFER_SIZE> buffer;
+
+  /// Default sink which stores records in `buffer`. A record is only stored
+  /// if it fits completely, so the buffer never holds partial records.
+  ///
+  /// @param record - record to store.
+  /// @return true - if the record was stored.
+  static bool BufferSink(std::span<const uint8_t> record)
+  {
+    if (buffer.Capacity() - buffer.Size() < record.size())
+    {
+      return false;
+    }
+    buffer.Write(record);
+    return true;
+  }
+
+  /// Destination for each record. Replace it to send records somewhere other
+  /// than `buffer`.
+  static inline Sink sink = BufferSink;
+
+  /// Number of records that the sink could not accept.
+  static inline std::atomic<uint32_t> dropped = 0;
+};
+
+namespace detail
+{
+/// Serializes the arguments of a binary log into a record.
+class BinaryRecord
+{
+ public:
+  /// @param id - ID of the format string.
+  /// @param timestamp - uptime at the moment of the log.
+  BinaryRecord(uint32_t id, std::chrono::nanoseconds timestamp)
+  {
+    Append(ToByteArray(std::endian::little, id));
+    Append(ToByteArray(std::endian::little,
+                       static_cast<uint64_t>(timestamp.count())));
+  }
+
+  /// Add an argument to the record.
+  ///
+  /// @param value - the argument.
+  template <typename T>
+  void Add(const T & value)
+  {
+    using Type = std::remove_cvref_t<T>;
+
+    if constexpr (std::is_same_v<Type, bool>)
+    {
+      AddTagged(BinaryArgument::kBool, static_cast<uint8_t>(value));
+    }
+    else if constexpr (std::is_same_v<Type, char>)
+    {
+      AddTagged(BinaryArgument::kChar, static_cast<uint8_t>(value));
+    }
+    else if constexpr (std::is_enum_v<Type>)
+    {
+      Add(static_cast<std::underlying_type_t<Type>>(value));
+    }
+    else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+    {
+      AddTagged(BinaryArgument::kSigned, value);
+    }
+    else if constexpr (std::is_integral_v<Type>)
+    {
+      AddTagged(BinaryArgument::kUnsigned, value);
+    }
+    else if constexpr (std::is_convertible_v<Type, std::string_view>)
+    {
+      AddString(std::string_view(value));
+    }
+    else if constexpr (std::is_pointer_v<Type>)
+    {
+      AddTagged(BinaryArgument::kPointer, reinterpret_cast<uintptr_t>(value));
+    }
+    else
+    {
+      static_assert(std::is_integral_v<Type>,
+                    "Binary logs only support integers, enums, bool, char, "
+                    "strings and pointers as arguments.");
+    }
+  }
+
+  /// Send the record to BinaryLog::sink.
+  void Submit()
+  {
+    bytes_[0] = static_cast<uint8_t>(length_);
+    if (truncated_)
+    {
+      bytes_[0] |= BinaryLog::kTruncated;
+    }
+    if (!BinaryLog::sink(std::span<const uint8_t>(bytes_.data(), length_)))
+    {
+      BinaryLog::dropped++;
+    }
+  }
+
+ private:
+  template <typename T>
+  void AddTagged(BinaryArgument type, T value)
+  {
+    if (length_ + 1 + sizeof(T) > bytes_.size())
+    {
+      truncated_ = true;
+      return;
+    }
+    bytes_[length_++] = static_cast<uint8_t>(Value(type) | sizeof(T));
+    Append(ToByteArray(std::endian::little, value));
+  }
+
+  void AddString(std::string_view string)
+  {
+    if (length_ + 2 > bytes_.size())
+    {
+      truncated_ = true;
+      return;
+    }
+
+    const size_t kLength = std::min(string.size(), bytes_.size() - length_ - 2);
+    bytes_[length_++]    = Value(BinaryArgument::kString);
+    bytes_[length_++]    = static_cast<uint8_t>(kLength);
+    std::copy_n(string.begin(), kLength, bytes_.begin() + length_);
+    length_ += kLength;
+  }
+
+  template <size_t N>
+  void Append(const std::array<uint8_t, N> & data)
+  {
+    std::copy(data.begin(), data.end(), bytes_.begin() + length_);
+    length_ += N;
+  }
+
+  static constexpr uint8_t Value(BinaryArgument type)
+  {
+    return static_cast<uint8_t>(type);
+  }
+
+  std::array<uint8_t, BinaryLog::kMaximumRecordSize> bytes_;
+  size_t length_  = 1;
+  bool truncated_ = false;
+};
+}  // namespace detail
+
+/// Log in binary form. Rather than formatting the text on the device, only the
+/// ID of the format string, a timestamp and the raw arguments are stored in a
+/// record and passed to BinaryLog::sink. The text is reconstructed on the host
+/// by BinaryLogDecoder. This avoids parsing the format string and formatting
+/// numbers at runtime, and keeps the format strings out of flash.
+///
+/// Usage:
+///
+///    sjsu::log::Binary("Motor {} current = {} mA", motor_id, current);
+///
+/// @tparam Args - types of the arguments. Must be integers, enums, bool, char,
+///         strings or pointers.
+/// @param format - fmt style format string literal.
+/// @param args - the arguments for the format string.
+template <typename... Args>
+void Binary(BinaryFormat_t format, const Args &... args)
+{
+  if constexpr (ENABLE_LOGS)
+  {
+    detail::BinaryRecord record(format.id, sjsu::Uptime());
+    (record.Add(args), ...);
+    record.Submit();
+  }
+}
+}  // namespace sjsu::log
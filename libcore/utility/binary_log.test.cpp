@@ -0,0 +1,198 @@
+#include <libcore/utility/binary_log.hpp>
+#include <libcore/utility/binary_log_decoder.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Test enumeration to log.
+enum class MotorState : uint8_t
+{
+  kStopped = 0,
+  kRunning = 2,
+};
+
+/// Read every byte out of the default binary log buffer.
+std::vector<uint8_t> DrainBinaryLog()
+{
+  std::vector<uint8_t> bytes(log::BinaryLog::buffer.Size());
+  log::BinaryLog::buffer.Read(bytes);
+  return bytes;
+}
+}  // namespace
+
+TEST_CASE("Testing binary log")
+{
+  // Setup
+  log::BinaryLog::buffer.Clear();
+  log::BinaryLog::sink    = log::BinaryLog::BufferSink;
+  log::BinaryLog::dropped = 0;
+  SetUptimeFunction([]() -> std::chrono::nanoseconds { return 1500us; });
+
+  log::BinaryLogDecoder decoder({
+      "Motor {} current = {} mA",
+      "{} {} {} {} '{}'",
+      "{} = {:#x}",
+  });
+
+  SECTION("Format string ID is computed at compile time")
+  {
+    constexpr log::BinaryFormat_t kFormat = "Motor {} current = {} mA";
+
+    static_assert(kFormat.id ==
+                  log::BinaryFormat_t::Hash("Motor {} current = {} mA"));
+    static_assert(kFormat.id != log::BinaryFormat_t::Hash("Motor {}"));
+  }
+
+  SECTION("Record holds the ID, timestamp and raw arguments")
+  {
+    // Exercise
+    log::Binary("Motor {} current = {} mA", uint8_t{ 3 }, int16_t{ -250 });
+    auto bytes = DrainBinaryLog();
+
+    // Verify
+    // Header + (tag + 1 byte) + (tag + 2 bytes)
+    REQUIRE(log::BinaryLog::kHeaderSize + 5 == bytes.size());
+    CHECK(bytes.size() == bytes[0]);
+    CHECK(0x01 == bytes[13]);
+    CHECK(3 == bytes[14]);
+    CHECK(0x12 == bytes[15]);
+  }
+
+  SECTION("Decoder reconstructs the text")
+  {
+    // Setup
+    const char * name = "left";
+
+    // Exercise
+    log::Binary("Motor {} current = {} mA", name, -250);
+    log::Binary("{} {} {} {} '{}'",
+                true,
+                MotorState::kRunning,
+                uint64_t{ 0xFFFF'FFFF'FFFF },
+                int8_t{ -1 },
+                'x');
+    auto bytes = DrainBinaryLog();
+
+    std::span<const uint8_t> stream(bytes);
+    auto first  = decoder.Decode(stream);
+    auto second = decoder.Decode(stream);
+
+    // Verify
+    REQUIRE(first.has_value());
+    CHECK("Motor left current = -250 mA" == first->text);
+    CHECK(1500us == first->timestamp);
+    REQUIRE(second.has_value());
+    CHECK("true 2 281474976710655 -1 'x'" == second->text);
+    CHECK(stream.empty());
+    CHECK(!decoder.Decode(stream).has_value());
+  }
+
+  SECTION("Decoder waits for a complete record")
+  {
+    // Setup
+    log::Binary("Motor {} current = {} mA", 1, 2);
+    auto bytes = DrainBinaryLog();
+    std::span<const uint8_t> partial(bytes.data(), bytes.size() - 1);
+
+    // Exercise & Verify
+    CHECK(!decoder.Decode(partial).has_value());
+    CHECK(bytes.size() - 1 == partial.size());
+  }
+
+  SECTION("Decoder skips bytes that cannot start a record")
+  {
+    // Setup
+    log::Binary("Motor {} current = {} mA", 1, 2);
+    auto record = DrainBinaryLog();
+    std::vector<uint8_t> bytes = { 0x00, 0x03 };
+    bytes.insert(bytes.end(), record.begin(), record.end());
+    std::span<const uint8_t> stream(bytes);
+
+    // Exercise
+    auto message = decoder.Decode(stream);
+
+    // Verify
+    REQUIRE(message.has_value());
+    CHECK("Motor 1 current = 2 mA" == message->text);
+    CHECK(stream.empty());
+  }
+
+  SECTION("Unknown format strings list their arguments")
+  {
+    // Setup
+    log::Binary("Not in the dictionary {}", 42);
+    auto bytes = DrainBinaryLog();
+    std::span<const uint8_t> stream(bytes);
+
+    // Exercise
+    auto message = decoder.Decode(stream);
+
+    // Verify
+    REQUIRE(message.has_value());
+    CHECK(message->text.ends_with("> 42"));
+  }
+
+  SECTION("Arguments that do not fit are marked as missing")
+  {
+    // Setup
+    const std::string kName(log::BinaryLog::kMaximumRecordSize, 'a');
+    const std::string kExpectedName(
+        log::BinaryLog::kMaximumRecordSize - log::BinaryLog::kHeaderSize - 2,
+        'a');
+
+    // Exercise
+    log::Binary("{} = {:#x}", kName, 5);
+    log::Binary("Not in the dictionary {} {}", kName, 5);
+    log::Binary("{} = {:#x}", "short", 5);
+    auto bytes = DrainBinaryLog();
+
+    std::span<const uint8_t> stream(bytes);
+    auto truncated = decoder.Decode(stream);
+    auto unknown   = decoder.Decode(stream);
+    auto complete  = decoder.Decode(stream);
+
+    // Verify
+    CHECK(log::BinaryLog::kTruncated ==
+          (bytes[0] & log::BinaryLog::kTruncated));
+    REQUIRE(truncated.has_value());
+    CHECK(kExpectedName + " = <truncated>" == truncated->text);
+    REQUIRE(unknown.has_value());
+    CHECK(unknown->text.ends_with(" <truncated>"));
+    REQUIRE(complete.has_value());
+    CHECK("short = 0x5" == complete->text);
+    CHECK(stream.empty());
+  }
+
+  SECTION("Records that do not fit are dropped and counted")
+  {
+    // Exercise
+    for (size_t i = 0; i < log::BinaryLog::buffer.Capacity(); i++)
+    {
+      log::Binary("Motor {} current = {} mA", 1, 2);
+    }
+
+    // Verify
+    CHECK(log::BinaryLog::dropped > 0);
+    std::vector<uint8_t> bytes = DrainBinaryLog();
+    std::span<const uint8_t> stream(bytes);
+    size_t decoded = 0;
+    while (decoder.Decode(stream))
+    {
+      decoded++;
+    }
+    CHECK(stream.empty());
+    CHECK(decoded + log::BinaryLog::dropped ==
+          log::BinaryLog::buffer.Capacity());
+  }
+
+  SetUptimeFunction(DefaultUptime);
+}
+}  // namespace sjsu
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <libcore/utility/binary_log.hpp>
+#include <libcore/utility/math/byte.hpp>
+
+#include <libcore/external/fmt/include/fmt/args.h>
+#include <libcore/external/fmt/include/fmt/format.h>
+
+namespace sjsu::log
+{
+/// Host side decoder which turns records produced by sjsu::log::Binary() back
+/// into text.
+///
+/// The decoder must be given the same format strings used on the device, for
+/// example by listing them in a header shared between the firmware and the
+/// host tool. Records with an unknown format string are still decoded, with
+/// their arguments listed after the ID. Arguments that were left out of a
+/// record because they did not fit are shown as kMissingArgument.
+///
+/// Usage:
+///
+///    BinaryLogDecoder decoder({ "Motor {} current = {} mA" });
+///    std::span<const uint8_t> stream = ReceivedBytes();
+///    while (auto message = decoder.Decode(stream))
+///    {
+///      std::cout << message->text << "\n";
+///    }
+class BinaryLogDecoder
+{
+ public:
+  /// Shown in place of each argument that was left out of a record.
+  static constexpr std::string_view kMissingArgument = "<truncated>";
+
+  /// A decoded log.
+  struct Message_t
+  {
+    /// ID of the format string.
+    uint32_t id;
+    /// Uptime of the device when the log was made.
+    std::chrono::nanoseconds timestamp;
+    /// The formatted text of the log.
+    std::string text;
+  };
+
+  /// @param formats - list of format strings that may appear in the records.
+  explicit BinaryLogDecoder(std::initializer_list<std::string_view> formats)
+  {
+    for (auto format : formats)
+    {
+      AddFormat(format);
+    }
+  }
+
+  /// @param format - a format string that may appear in the records.
+  void AddFormat(std::string_view format)
+  {
+    formats_[BinaryFormat_t::Hash(format)] = std::string(format);
+  }
+
+  /// Decode the record at the start of `stream`.
+  ///
+  /// A record starts with its length, so a first byte smaller than the header
+  /// means the stream is out of sync, for example after bytes were lost on
+  /// the link. Such bytes are skipped until one could start a record.
+  ///
+  /// @param stream - bytes received from the device. On success, advanced
+  ///        past the decoded record. Always advanced past skipped bytes.
+  /// @return std::optional<Message_t> - the decoded log or std::nullopt if
+  ///         `stream` does not hold a complete record yet.
+  std::optional<Message_t> Decode(std::span<const uint8_t> & stream)
+  {
+    while (!stream.empty() && Length(stream[0]) < BinaryLog::kHeaderSize)
+    {
+      stream = stream.subspan(1);
+    }
+
+    if (stream.empty() || stream.size() < Length(stream[0]))
+    {
+      return std::nullopt;
+    }
+
+    const bool kTruncated = (stream[0] & BinaryLog::kTruncated) != 0;
+    auto record           = stream.first(Length(stream[0]));
+    stream                = stream.subspan(record.size());
+
+    const auto kId        = record.subspan(1, sizeof(uint32_t));
+    const auto kTimestamp = record.subspan(5, sizeof(uint64_t));
+
+    Message_t message;
+    message.id        = ToInteger<uint32_t>(std::endian::little, kId);
+    message.timestamp = std::chrono::nanoseconds(
+        ToInteger<uint64_t>(std::endian::little, kTimestamp));
+
+    fmt::dynamic_format_arg_store<fmt::format_context> arguments;
+    std::string unknown_arguments;
+    const size_t kCount = DecodeArguments(
+        record.subspan(BinaryLog::kHeaderSize), arguments, unknown_arguments);
+
+    if (auto format = formats_.find(message.id); format != formats_.end())
+    {
+      if (kTruncated)
+      {
+        message.text = fmt::vformat(
+            MarkMissingArguments(format->second, kCount), arguments);
+      }
+      else
+      {
+        message.text = fmt::vformat(format->second, arguments);
+      }
+    }
+    else
+    {
+      if (kTruncated)
+      {
+        unknown_arguments += fmt::format(" {}", kMissingArgument);
+      }
+      message.text = fmt::format(
+          "<unknown format {:#010x}>{}", message.id, unknown_arguments);
+    }
+
+    return message;
+  }
+
+ private:
+  static size_t Length(uint8_t first_byte)
+  {
+    return first_byte & BinaryLog::kLengthMask;
+  }
+
+  /// Replace the replacement fields of `format` that refer to arguments past
+  /// the first `count` with kMissingArgument, keeping the others as they are.
+  ///
+  /// @param format - format string of a truncated record.
+  /// @param count - number of arguments the record holds.
+  /// @return std::string - the format string to format the record with.
+  static std::string MarkMissingArguments(std::string_view format,
+                                          size_t count)
+  {
+    std::string result;
+    size_t next_index = 0;
+
+    for (size_t i = 0; i < format.size(); i++)
+    {
+      if (format[i] != '{')
+      {
+        result += format[i];
+        continue;
+      }
+
+      if (format.substr(i, 2) == "{{")
+      {
+        result += "{{";
+        i++;
+        continue;
+      }
+
+      const size_t kEnd = format.find('}', i);
+      if (kEnd == std::string_view::npos)
+      {
+        result += format.substr(i);
+        break;
+      }
+
+      // Fields either all number their arguments or all leave them implied.
+      const std::string_view kField = format.substr(i, kEnd - i + 1);
+      size_t index                  = next_index++;
+      if (std::isdigit(static_cast<unsigned char>(kField[1])))
+      {
+        index = std::stoul(std::string(kField.substr(1)));
+      }
+
+      result += (index < count) ? kField : kMissingArgument;
+      i = kEnd;
+    }
+
+    return result;
+  }
+
+  /// @return size_t - number of arguments decoded.
+  static size_t DecodeArguments(
+      std::span<const uint8_t> data,
+      fmt::dynamic_format_arg_store<fmt::format_context> & arguments,
+      std::string & listing)
+  {
+    size_t count = 0;
+
+    while (!data.empty())
+    {
+      const auto kType = static_cast<BinaryArgument>(data[0] & 0xF0);
+      size_t size      = data[0] & 0x0F;
+      data             = data.subspan(1);
+
+      if (kType == BinaryArgument::kString)
+      {
+        if (data.empty())
+        {
+          return count;
+        }
+        size = data[0];
+        data = data.subspan(1);
+      }
+      else if (size == 0 || size > sizeof(uint64_t))
+      {
+        return count;
+      }
+
+      if (data.size() < size)
+      {
+        return count;
+      }
+
+      const auto kBytes   = data.first(size);
+      const uint64_t kRaw = ToInteger<uint64_t>(std::endian::little, kBytes);
+      data                = data.subspan(size);
+
+      switch (kType)
+      {
+        case BinaryArgument::kSigned:
+        {
+          // Sign extend from the size of the original integer.
+          const size_t kUnusedBits = 64 - (size * 8);
+          const auto kSigned = static_cast<int64_t>(kRaw << kUnusedBits) >>
+                               kUnusedBits;
+          arguments.push_back(kSigned);
+          listing += fmt::format(" {}", kSigned);
+          break;
+        }
+        case BinaryArgument::kBool:
+          arguments.push_back(kRaw != 0);
+          listing += fmt::format(" {}", kRaw != 0);
+          break;
+        case BinaryArgument::kChar:
+          arguments.push_back(static_cast<char>(kRaw));
+          listing += fmt::format(" '{}'", static_cast<char>(kRaw));
+          break;
+        case BinaryArgument::kPointer:
+          arguments.push_back(reinterpret_cast<const void *>(kRaw));
+          listing += fmt::format(" {:#x}", kRaw);
+          break;
+        case BinaryArgument::kString:
+        {
+          std::string string(kBytes.begin(), kBytes.end());
+          listing += fmt::format(" \"{}\"", string);
+          arguments.push_back(std::move(string));
+          break;
+        }
+        case BinaryArgument::kUnsigned:
+        default:
+          arguments.push_back(kRaw);
+          listing += fmt::format(" {}", kRaw);
+          break;
+      }
+
+      count++;
+    }
+
+    return count;
+  }
+
+  std::unordered_map<uint32_t, std::string> formats_;
+};
+}  // namespace sjsu::log
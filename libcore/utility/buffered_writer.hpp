@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+
+#include <libcore/utility/inplace_function.hpp>
+
+namespace sjsu
+{
+/// Collects the small writes made by stdio, often a single character at a
+/// time, into large contiguous writes to one output, such as a UART, so each
+/// call to the output moves a whole line or block and its per-call overhead,
+/// like starting a DMA transfer, is paid once per chunk instead of per
+/// character.
+///
+/// Buffered bytes are passed to the output when the buffer reaches its flush
+/// threshold, in kLine mode at the end of each line, and when Flush() is
+/// called. Writes at least as large as the threshold that arrive with nothing
+/// buffered skip the buffer.
+///
+/// Writer() adapts it to a SysCall writer. SysCallManager flushes every
+/// writer when stdio is flushed, by passing them a write of length 0, which
+/// a BufferedWriter treats as a call to Flush().
+///
+/// Not safe to write from several contexts at once, such as the main loop and
+/// an interrupt.
+///
+/// Use StaticBufferedWriter to allocate the storage statically.
+///
+/// USAGE:
+///
+///    sjsu::StaticBufferedWriter<128> serial_out(
+///        sjsu::SysCall::SerialWriter(uart0));
+///    sjsu::SysCallManager::Get().AddWriter(serial_out.Writer());
+class BufferedWriter
+{
+ public:
+  /// Function the buffered bytes are passed to, with the signature of a
+  /// SysCall writer.
+  using Output = InplaceFunction<int(FILE *, const char *, int)>;
+
+  /// When buffered bytes are passed to the output, besides when the buffer
+  /// reaches its threshold or is flushed.
+  enum class Mode : uint8_t
+  {
+    /// At the end of every line, for human readable output.
+    kLine,
+    /// Only when the threshold is reached or on Flush(), for the largest
+    /// writes, such as binary telemetry.
+    kBlock,
+  };
+
+  /// @param storage - memory for buffered bytes. Must outlive this object.
+  /// @param output - function the buffered bytes are passed to.
+  /// @param mode - whether to also flush at the end of each line.
+  explicit BufferedWriter(std::span<char> storage,
+                          Output output,
+                          Mode mode = Mode::kLine)
+      : storage_(storage),
+        output_(output),
+        mode_(mode),
+        threshold_(storage.size())
+  {
+  }
+
+  BufferedWriter(const BufferedWriter &) = delete;
+  BufferedWriter & operator=(const BufferedWriter &) = delete;
+
+  /// Buffer bytes, passing them to the output as the mode and threshold
+  /// require.
+  ///
+  /// @param file - stream the bytes were written to, passed to the output.
+  /// @param data - bytes to write.
+  /// @param length - number of bytes. 0 flushes the buffer.
+  /// @return int - `length`.
+  int Write(FILE * file, const char * data, int length)
+  {
+    if (length <= 0)
+    {
+      Flush(file);
+      return 0;
+    }
+
+    auto remaining = std::span(data, static_cast<size_t>(length));
+    while (!remaining.empty())
+    {
+      if (used_ == 0 && remaining.size() >= threshold_)
+      {
+        output_(file, remaining.data(), static_cast<int>(remaining.size()));
+        break;
+      }
+
+      const size_t kChunk = std::min(threshold_ - used_, remaining.size());
+      std::memcpy(storage_.data() + used_, remaining.data(), kChunk);
+      used_ += kChunk;
+      remaining = remaining.subspan(kChunk);
+
+      if (used_ == threshold_)
+      {
+        Flush(file);
+      }
+    }
+
+    if (mode_ == Mode::kLine && used_ > 0 &&
+        std::memchr(data, '\n', static_cast<size_t>(length)))
+    {
+      Flush(file);
+    }
+
+    return length;
+  }
+
+  /// Pass the buffered bytes to the output.
+  ///
+  /// @param file - stream passed to the output.
+  void Flush(FILE * file = stdout)
+  {
+    if (used_ == 0)
+    {
+      return;
+    }
+
+    output_(file, storage_.data(), static_cast<int>(used_));
+    used_ = 0;
+  }
+
+  /// Set how many bytes are buffered before they are passed to the output,
+  /// such as the size of a DMA buffer or a USB packet. Flushes any bytes
+  /// already buffered.
+  ///
+  /// @param threshold - number of bytes, clamped to between 1 and the size
+  ///        of the storage.
+  void SetThreshold(size_t threshold)
+  {
+    Flush();
+    threshold_ = std::clamp<size_t>(threshold, 1, storage_.size());
+  }
+
+  /// @return size_t - number of bytes buffered.
+  size_t Buffered() const
+  {
+    return used_;
+  }
+
+  /// @return Output - a SysCall writer that writes through this buffer. The
+  ///         buffer must outlive it.
+  Output Writer()
+  {
+    return [this](FILE * file, const char * data, int length) {
+      return Write(file, data, length);
+    };
+  }
+
+ private:
+  std::span<char> storage_;
+  Output output_;
+  Mode mode_;
+  size_t threshold_;
+  size_t used_ = 0;
+};
+
+/// BufferedWriter with statically allocated storage.
+///
+/// @tparam kSize - size of the buffer in bytes.
+template <size_t kSize>
+class StaticBufferedWriter : public BufferedWriter
+{
+ public:
+  static_assert(kSize > 0, "StaticBufferedWriter size must not be zero.");
+
+  /// @param output - function the buffered bytes are passed to.
+  /// @param mode - whether to also flush at the end of each line.
+  explicit StaticBufferedWriter(Output output, Mode mode = Mode::kLine)
+      : BufferedWriter(storage_, output, mode)
+  {
+  }
+
+ private:
+  std::array<char, kSize> storage_ = {};
+};
+}  // namespace sjsu
@@ -0,0 +1,192 @@
+#include <libcore/utility/buffered_writer.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Collects everything that a BufferedWriter passes to its output.
+struct OutputCollector
+{
+  BufferedWriter::Output Output()
+  {
+    return [this](FILE *, const char * data, int length) {
+      text.append(data, static_cast<size_t>(length));
+      chunk_sizes.push_back(static_cast<size_t>(length));
+      return length;
+    };
+  }
+
+  std::string text;
+  std::vector<size_t> chunk_sizes;
+};
+
+void WriteString(BufferedWriter & writer, const std::string & text)
+{
+  writer.Write(stdout, text.data(), static_cast<int>(text.size()));
+}
+}  // namespace
+
+TEST_CASE("Testing BufferedWriter")
+{
+  OutputCollector collector;
+
+  SECTION("Line mode passes on each complete line")
+  {
+    // Setup
+    StaticBufferedWriter<32> writer(collector.Output());
+
+    // Exercise
+    WriteString(writer, "hello ");
+    WriteString(writer, "world");
+
+    // Verify
+    CHECK(collector.chunk_sizes.empty());
+    CHECK(11 == writer.Buffered());
+
+    // Exercise
+    WriteString(writer, "!\n");
+
+    // Verify
+    CHECK("hello world!\n" == collector.text);
+    CHECK(std::vector<size_t>{ 13 } == collector.chunk_sizes);
+    CHECK(0 == writer.Buffered());
+  }
+
+  SECTION("Characters written one at a time are passed on as one chunk")
+  {
+    // Setup
+    StaticBufferedWriter<32> writer(collector.Output());
+    const std::string kLine = "temperature = 21.5C\n";
+
+    // Exercise
+    for (char character : kLine)
+    {
+      writer.Write(stdout, &character, 1);
+    }
+
+    // Verify
+    CHECK(kLine == collector.text);
+    CHECK(std::vector<size_t>{ kLine.size() } == collector.chunk_sizes);
+  }
+
+  SECTION("Block mode only passes on full buffers")
+  {
+    // Setup
+    StaticBufferedWriter<8> writer(collector.Output(),
+                                   BufferedWriter::Mode::kBlock);
+
+    // Exercise
+    WriteString(writer, "abc\n");
+    WriteString(writer, "def\nghi\n");
+
+    // Verify
+    CHECK("abc\ndef\n" == collector.text);
+    CHECK(std::vector<size_t>{ 8 } == collector.chunk_sizes);
+    CHECK(4 == writer.Buffered());
+  }
+
+  SECTION("Flush() and a write of length 0 pass on buffered bytes")
+  {
+    // Setup
+    StaticBufferedWriter<16> writer(collector.Output(),
+                                    BufferedWriter::Mode::kBlock);
+
+    // Exercise
+    WriteString(writer, "abc");
+    writer.Flush();
+    WriteString(writer, "def");
+    CHECK(0 == writer.Write(stdout, nullptr, 0));
+    writer.Flush();
+
+    // Verify
+    CHECK("abcdef" == collector.text);
+    CHECK(std::vector<size_t>{ 3, 3 } == collector.chunk_sizes);
+  }
+
+  SECTION("Large writes skip an empty buffer")
+  {
+    // Setup
+    StaticBufferedWriter<4> writer(collector.Output(),
+                                   BufferedWriter::Mode::kBlock);
+
+    // Exercise
+    WriteString(writer, "0123456789");
+
+    // Verify
+    CHECK("0123456789" == collector.text);
+    CHECK(std::vector<size_t>{ 10 } == collector.chunk_sizes);
+    CHECK(0 == writer.Buffered());
+  }
+
+  SECTION("Large writes fill a partly used buffer first")
+  {
+    // Setup
+    StaticBufferedWriter<4> writer(collector.Output(),
+                                   BufferedWriter::Mode::kBlock);
+
+    // Exercise
+    WriteString(writer, "ab");
+    WriteString(writer, "cdefghij");
+
+    // Verify
+    CHECK("abcdefghij" == collector.text);
+    CHECK(std::vector<size_t>{ 4, 6 } == collector.chunk_sizes);
+  }
+
+  SECTION("SetThreshold() flushes and limits the size of each chunk")
+  {
+    // Setup
+    StaticBufferedWriter<16> writer(collector.Output(),
+                                    BufferedWriter::Mode::kBlock);
+    WriteString(writer, "ab");
+
+    // Exercise
+    writer.SetThreshold(3);
+    WriteString(writer, "c");
+    WriteString(writer, "de");
+    WriteString(writer, "f");
+
+    // Verify
+    CHECK("abcde" == collector.text);
+    CHECK(std::vector<size_t>{ 2, 3 } == collector.chunk_sizes);
+    CHECK(1 == writer.Buffered());
+  }
+
+  SECTION("SetThreshold() clamps to the size of the storage")
+  {
+    // Setup
+    StaticBufferedWriter<4> writer(collector.Output(),
+                                   BufferedWriter::Mode::kBlock);
+
+    // Exercise
+    writer.SetThreshold(0);
+    WriteString(writer, "a");
+    writer.SetThreshold(100);
+    writer.Write(stdout, "bcd", 3);
+
+    // Verify
+    CHECK("a" == collector.text);
+    CHECK(3 == writer.Buffered());
+  }
+
+  SECTION("Writer() writes through the buffer")
+  {
+    // Setup
+    StaticBufferedWriter<16> writer(collector.Output());
+    auto sys_call_writer = writer.Writer();
+
+    // Exercise
+    sys_call_writer(stdout, "ok", 2);
+    sys_call_writer(stdout, nullptr, 0);
+
+    // Verify
+    CHECK("ok" == collector.text);
+  }
+}
+}  // namespace sjsu
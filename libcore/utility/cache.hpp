@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/// Size of a data cache line, which shared data is aligned and padded to so
+/// that data written by one core never shares a cache line with data written
+/// by the other. 32 bytes matches the Cortex-M7. Define it to match other
+/// processors.
+#if !defined(SJ2_CACHE_LINE_SIZE)
+#define SJ2_CACHE_LINE_SIZE 32
+#endif
+
+/// Define as 1 on processors with a data cache that DMA does not see, such as
+/// the Cortex-M7 with its D-cache enabled, so DataCache maintains the cache.
+/// Otherwise the DataCache operations do nothing.
+#if !defined(SJ2_HAS_DATA_CACHE)
+#define SJ2_HAS_DATA_CACHE 0
+#endif
+
+#if !defined(SJ2_NON_CACHEABLE)
+#if defined(__arm__)
+/// Place a variable in the .noncacheable section, for DMA buffers that need
+/// no cache maintenance at all. The linker script must place the section in
+/// a region that the MPU marks as non-cacheable. The startup code does not
+/// initialize the section unless the linker script and startup code are set
+/// up to, so do not rely on the initial contents of such variables.
+#define SJ2_NON_CACHEABLE __attribute__((section(".noncacheable")))
+#else
+#define SJ2_NON_CACHEABLE
+#endif
+#endif
+
+namespace sjsu
+{
+/// Size of a data cache line, see SJ2_CACHE_LINE_SIZE.
+inline constexpr size_t kCacheLineSize = SJ2_CACHE_LINE_SIZE;
+
+/// Maintenance of the data cache for memory that DMA reads or writes, by
+/// address through the Cortex-M7 System Control Block. All operations do
+/// nothing unless SJ2_HAS_DATA_CACHE is 1.
+///
+/// - Clean() before DMA reads memory the CPU wrote, such as a transmit
+///   buffer, so the DMA sees the CPU's writes rather than stale memory.
+/// - Invalidate() before and after DMA writes memory, such as a receive
+///   buffer, so the CPU reads what the DMA wrote rather than stale cache
+///   lines, and no dirty line is written back over it in between.
+///
+/// Cache lines are the unit of maintenance. Invalidating a buffer that
+/// shares its first or last line with other data would discard writes to
+/// that data, so those lines are cleaned as well as invalidated. That only
+/// protects data the CPU does not write while the DMA runs. Use DmaBuffer
+/// so buffers never share a line.
+class DataCache
+{
+ public:
+  /// Cache line aligned address range.
+  struct Range_t
+  {
+    /// Address of the first line.
+    uintptr_t begin;
+    /// Address past the last line.
+    uintptr_t end;
+  };
+
+  /// @param address - start of the memory.
+  /// @param size - number of bytes.
+  /// @return Range_t - the cache lines that hold the memory.
+  static constexpr Range_t Lines(uintptr_t address, size_t size)
+  {
+    return {
+      .begin = address & ~(kCacheLineSize - 1),
+      .end   = (address + size + kCacheLineSize - 1) & ~(kCacheLineSize - 1),
+    };
+  }
+
+  /// @param address - start of the memory.
+  /// @param size - number of bytes.
+  /// @return true - if the memory covers whole cache lines only.
+  static constexpr bool IsLineAligned(uintptr_t address, size_t size)
+  {
+    return (address % kCacheLineSize) == 0 && (size % kCacheLineSize) == 0;
+  }
+
+  /// Write modified lines of the memory back to memory.
+  ///
+  /// @param address - start of the memory.
+  /// @param size - number of bytes.
+  static void Clean([[maybe_unused]] const volatile void * address,
+                    [[maybe_unused]] size_t size)
+  {
+#if SJ2_HAS_DATA_CACHE
+    Maintain(kCleanAddress, Lines(Address(address), size));
+#endif
+  }
+
+  /// Discard the cached lines of the memory, so that the next reads fetch it
+  /// from memory. Lines only partly covered are cleaned first.
+  ///
+  /// @param address - start of the memory.
+  /// @param size - number of bytes.
+  static void Invalidate([[maybe_unused]] volatile void * address,
+                         [[maybe_unused]] size_t size)
+  {
+#if SJ2_HAS_DATA_CACHE
+    Range_t lines        = Lines(Address(address), size);
+    const uintptr_t kEnd = Address(address) + size;
+    if (lines.begin != Address(address))
+    {
+      Maintain(kCleanInvalidateAddress,
+               { lines.begin, lines.begin + kCacheLineSize });
+      lines.begin += kCacheLineSize;
+    }
+    if (lines.end != kEnd && lines.end > lines.begin)
+    {
+      Maintain(kCleanInvalidateAddress,
+               { lines.end - kCacheLineSize, lines.end });
+      lines.end -= kCacheLineSize;
+    }
+    if (lines.end > lines.begin)
+    {
+      Maintain(kInvalidateAddress, lines);
+    }
+#endif
+  }
+
+  /// Write modified lines of the memory back to memory, then discard them.
+  ///
+  /// @param address - start of the memory.
+  /// @param size - number of bytes.
+  static void CleanAndInvalidate([[maybe_unused]] volatile void * address,
+                                 [[maybe_unused]] size_t size)
+  {
+#if SJ2_HAS_DATA_CACHE
+    Maintain(kCleanInvalidateAddress, Lines(Address(address), size));
+#endif
+  }
+
+  /// Clean() the memory of a span.
+  template <typename T, size_t kExtent>
+  static void Clean(std::span<T, kExtent> data)
+  {
+    Clean(data.data(), data.size_bytes());
+  }
+
+  /// Invalidate() the memory of a span.
+  template <typename T, size_t kExtent>
+  static void Invalidate(std::span<T, kExtent> data)
+  {
+    Invalidate(data.data(), data.size_bytes());
+  }
+
+ private:
+#if SJ2_HAS_DATA_CACHE
+  /// DCIMVAC, DCCMVAC and DCCIMVAC: invalidate, clean, and clean and
+  /// invalidate the line holding the address written to them.
+  static constexpr uintptr_t kInvalidateAddress      = 0xE000'EF5C;
+  static constexpr uintptr_t kCleanAddress           = 0xE000'EF68;
+  static constexpr uintptr_t kCleanInvalidateAddress = 0xE000'EF70;
+
+  static uintptr_t Address(const volatile void * address)
+  {
+    return reinterpret_cast<uintptr_t>(address);
+  }
+
+  static void Maintain(uintptr_t operation, Range_t lines)
+  {
+    auto * operation_register =
+        reinterpret_cast<volatile uint32_t *>(operation);
+    asm volatile("dsb 0xF" ::: "memory");
+    for (uintptr_t line = lines.begin; line < lines.end; line += kCacheLineSize)
+    {
+      *operation_register = static_cast<uint32_t>(line);
+    }
+    asm volatile("dsb 0xF" ::: "memory");
+    asm volatile("isb 0xF" ::: "memory");
+  }
+#endif
+};
+}  // namespace sjsu
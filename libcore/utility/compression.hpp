@@ -0,0 +1,439 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/inplace_function.hpp>
+
+namespace sjsu::compression
+{
+/// Bytes at the start of each compressed block: the length of the compressed
+/// sequences and the number of bytes they decompress to, each 16 bits, least
+/// significant byte first.
+inline constexpr size_t kBlockHeaderSize = 4;
+
+namespace detail
+{
+/// Shortest match worth encoding, as it replaces 4 bytes with 3.
+inline constexpr size_t kMinimumMatch = 4;
+
+/// Largest length held in a token's nibble. Longer lengths continue in
+/// following bytes, each adding up to 255.
+inline constexpr size_t kNibbleMaximum = 15;
+
+/// @param length - length to encode in a token nibble.
+/// @return constexpr size_t - number of bytes following the token to hold
+///         the rest of the length.
+constexpr size_t ExtraLengthBytes(size_t length)
+{
+  return (length < kNibbleMaximum) ? 0
+                                   : ((length - kNibbleMaximum) / 255) + 1;
+}
+
+/// @param literals - number of literal bytes.
+/// @return constexpr size_t - bytes a sequence's token, literal length and
+///         literals occupy.
+constexpr size_t LiteralCost(size_t literals)
+{
+  return 1 + ExtraLengthBytes(literals) + literals;
+}
+}  // namespace detail
+
+/// Compresses a stream of bytes, such as log records or telemetry, into
+/// fixed size blocks that can each be decompressed on their own with
+/// DecompressBlock(), such as blocks of a Storage or packets of an
+/// InternetSocket.
+///
+/// The compression is LZ77 with the byte oriented sequences of the LZ4 block
+/// format: a token holding the number of literal bytes and the length of a
+/// match, the literals, then the match as a 16-bit offset back into the
+/// decompressed block. Matches are found with a hash table of 4-byte
+/// prefixes, and only within the current block, so a damaged or erased block
+/// does not affect the others.
+///
+/// All memory is held in the object: the uncompressed bytes of the current
+/// block, the hash table and the compressed block being built. Write()
+/// compresses as bytes arrive and hands each full block to the sink.
+///
+/// USAGE:
+///
+///    uint32_t address = kLogStart;
+///    sjsu::compression::BlockCompressor<512> compressor(
+///        [&](std::span<const uint8_t> block) {
+///          storage.Write(address++, block);
+///        });
+///
+///    compressor.Write(record);
+///    compressor.Flush();  // Before power down
+///
+///    size_t length = sjsu::compression::DecompressBlock(block, buffer);
+///
+/// @tparam kBlockSize - size of each compressed block, such as
+///         Storage::GetBlockSize().
+/// @tparam kWindowSize - most uncompressed bytes held in one block, which
+///         limits the compression ratio. Buffers given to DecompressBlock()
+///         must be this large.
+/// @tparam kHashBits - log2 of the number of hash table entries, each 2
+///         bytes.
+template <size_t kBlockSize,
+          size_t kWindowSize = std::min<size_t>(4 * kBlockSize, 0xFFFE),
+          size_t kHashBits   = 10>
+class BlockCompressor
+{
+ public:
+  static_assert(kBlockSize >= 16 && kBlockSize <= 0xFFFF,
+                "Compressed blocks must be between 16 and 65535 bytes.");
+  static_assert(kWindowSize >= detail::kMinimumMatch && kWindowSize < 0xFFFF,
+                "The window must be less than 65535 bytes.");
+  static_assert(kHashBits >= 4 && kHashBits <= 16,
+                "The hash table must have between 2^4 and 2^16 entries.");
+
+  /// Called with each complete block, kBlockSize bytes long. The bytes after
+  /// the compressed data are 0xFF, the value of erased flash.
+  using Sink = InplaceFunction<void(std::span<const uint8_t> block)>;
+
+  /// Counts of what the compressor has done.
+  struct Statistics_t
+  {
+    /// Bytes passed to Write().
+    size_t input_bytes = 0;
+    /// Blocks passed to the sink.
+    size_t blocks = 0;
+    /// Bytes of compressed data in the blocks, including headers but not
+    /// padding.
+    size_t compressed_bytes = 0;
+  };
+
+  /// @param sink - called with each complete block.
+  explicit BlockCompressor(Sink sink) : sink_(sink)
+  {
+    Reset();
+  }
+
+  BlockCompressor(const BlockCompressor &) = delete;
+  BlockCompressor & operator=(const BlockCompressor &) = delete;
+
+  /// Compress bytes, passing each block that fills to the sink.
+  ///
+  /// @param data - bytes to compress.
+  void Write(std::span<const uint8_t> data)
+  {
+    statistics_.input_bytes += data.size();
+
+    while (!data.empty())
+    {
+      const size_t kAmount = std::min(data.size(), kWindowSize - length_);
+      std::copy_n(data.begin(), kAmount, window_.begin() + length_);
+      length_ += kAmount;
+      data = data.subspan(kAmount);
+
+      if (length_ == kWindowSize)
+      {
+        // The block ends here, unless a sequence that did not fit in it
+        // already ended it and carried the rest into the next one.
+        Compress(0);
+        if (length_ == kWindowSize)
+        {
+          EndBlock();
+        }
+      }
+      else
+      {
+        // Leave bytes at the end unexamined, so their matches can extend
+        // into the bytes of the next write.
+        Compress(kLookahead);
+      }
+    }
+  }
+
+  /// Pass the block being built to the sink, even if it is not full, so that
+  /// every byte written so far can be decompressed. Does nothing if no bytes
+  /// are waiting.
+  void Flush()
+  {
+    while (length_ > 0)
+    {
+      Compress(0);
+      EndBlock();
+    }
+  }
+
+  /// @return const Statistics_t & - counts of what the compressor has done.
+  const Statistics_t & GetStatistics() const
+  {
+    return statistics_;
+  }
+
+ private:
+  static constexpr size_t kLookahead      = 16;
+  static constexpr uint16_t kEmpty        = 0xFFFF;
+  static constexpr size_t kMaximumPayload = kBlockSize - kBlockHeaderSize;
+
+  static size_t Hash(const uint8_t * bytes)
+  {
+    const uint32_t kPrefix = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+                             (static_cast<uint32_t>(bytes[3]) << 24);
+    return (kPrefix * 2654435761U) >> (32 - kHashBits);
+  }
+
+  /// Find matches for the bytes in the window, emitting a sequence for each.
+  /// Starts a new block when a sequence does not fit.
+  ///
+  /// @param leave - number of bytes at the end of the window to leave
+  ///        unexamined.
+  void Compress(size_t leave)
+  {
+    while (position_ + detail::kMinimumMatch + leave <= length_)
+    {
+      const size_t kHash      = Hash(&window_[position_]);
+      const size_t kCandidate = hash_table_[kHash];
+      hash_table_[kHash]      = static_cast<uint16_t>(position_);
+
+      if (kCandidate == kEmpty ||
+          !std::equal(&window_[kCandidate],
+                      &window_[kCandidate] + detail::kMinimumMatch,
+                      &window_[position_]))
+      {
+        position_++;
+        continue;
+      }
+
+      size_t match = detail::kMinimumMatch;
+      while (position_ + match < length_ &&
+             window_[kCandidate + match] == window_[position_ + match])
+      {
+        match++;
+      }
+
+      if (!EmitSequence(position_ - kCandidate, match))
+      {
+        EndBlock();
+        continue;
+      }
+
+      position_ += match;
+      anchor_ = position_;
+    }
+  }
+
+  /// @return true - if the sequence fit in the block and was emitted.
+  bool EmitSequence(size_t offset, size_t match)
+  {
+    const size_t kLiterals    = position_ - anchor_;
+    const size_t kMatchLength = match - detail::kMinimumMatch;
+    const size_t kCost        = detail::LiteralCost(kLiterals) + 2 +
+                         detail::ExtraLengthBytes(kMatchLength);
+
+    if (used_ + kCost > kMaximumPayload)
+    {
+      return false;
+    }
+
+    EmitLiterals(kLiterals, kMatchLength);
+    Put(static_cast<uint8_t>(offset));
+    Put(static_cast<uint8_t>(offset >> 8));
+    PutExtraLength(kMatchLength);
+    return true;
+  }
+
+  /// Write a token and the literals from the anchor.
+  ///
+  /// @param literals - number of literals.
+  /// @param match_length - match length, less kMinimumMatch, for the token.
+  void EmitLiterals(size_t literals, size_t match_length)
+  {
+    Put(static_cast<uint8_t>(
+        (std::min(literals, detail::kNibbleMaximum) << 4) |
+        std::min(match_length, detail::kNibbleMaximum)));
+    PutExtraLength(literals);
+    std::copy_n(&window_[anchor_], literals, &block_[kBlockHeaderSize + used_]);
+    used_ += literals;
+  }
+
+  void PutExtraLength(size_t length)
+  {
+    if (length < detail::kNibbleMaximum)
+    {
+      return;
+    }
+
+    length -= detail::kNibbleMaximum;
+    while (length >= 255)
+    {
+      Put(255);
+      length -= 255;
+    }
+    Put(static_cast<uint8_t>(length));
+  }
+
+  void Put(uint8_t byte)
+  {
+    block_[kBlockHeaderSize + used_++] = byte;
+  }
+
+  /// Close the block with as many of the waiting literals as fit, pass it to
+  /// the sink, and carry the bytes that did not fit into the next block.
+  void EndBlock()
+  {
+    const size_t kSpace = kMaximumPayload - used_;
+    size_t literals =
+        (kSpace > 0) ? std::min(length_ - anchor_, kSpace - 1) : 0;
+    while (literals > 0 && detail::LiteralCost(literals) > kSpace)
+    {
+      literals--;
+    }
+
+    if (literals > 0)
+    {
+      EmitLiterals(literals, 0);
+    }
+
+    const size_t kConsumed = anchor_ + literals;
+    block_[0]              = static_cast<uint8_t>(used_);
+    block_[1]              = static_cast<uint8_t>(used_ >> 8);
+    block_[2]              = static_cast<uint8_t>(kConsumed);
+    block_[3]              = static_cast<uint8_t>(kConsumed >> 8);
+    std::fill(block_.begin() + kBlockHeaderSize + used_, block_.end(), 0xFF);
+
+    sink_(block_);
+    statistics_.blocks++;
+    statistics_.compressed_bytes += kBlockHeaderSize + used_;
+
+    std::copy(window_.begin() + kConsumed,
+              window_.begin() + length_,
+              window_.begin());
+    length_ -= kConsumed;
+    Reset();
+  }
+
+  void Reset()
+  {
+    hash_table_.fill(kEmpty);
+    position_ = 0;
+    anchor_   = 0;
+    used_     = 0;
+  }
+
+  Sink sink_;
+  Statistics_t statistics_;
+  std::array<uint8_t, kWindowSize> window_;
+  std::array<uint16_t, size_t{ 1 } << kHashBits> hash_table_;
+  std::array<uint8_t, kBlockSize> block_;
+  /// Bytes held in the window.
+  size_t length_ = 0;
+  /// Next byte to find a match for.
+  size_t position_ = 0;
+  /// First byte not yet emitted as a literal or match.
+  size_t anchor_ = 0;
+  /// Bytes of sequences in the block.
+  size_t used_ = 0;
+};
+
+/// Decompress one block made by BlockCompressor.
+///
+/// @param block - the block, including padding.
+/// @param output - destination of the decompressed bytes. Blocks decompress
+///        to at most the compressor's kWindowSize bytes.
+/// @return size_t - number of bytes decompressed into `output`.
+/// @throw std::errc::bad_message - if the block is corrupt or erased.
+/// @throw std::errc::no_buffer_space - if `output` is too small.
+inline size_t DecompressBlock(std::span<const uint8_t> block,
+                              std::span<uint8_t> output)
+{
+  if (block.size() < kBlockHeaderSize)
+  {
+    throw Exception(std::errc::bad_message, "Compressed block is too short.");
+  }
+
+  const size_t kCompressed   = block[0] | (block[1] << 8);
+  const size_t kDecompressed = block[2] | (block[3] << 8);
+
+  if (kCompressed > block.size() - kBlockHeaderSize)
+  {
+    throw Exception(std::errc::bad_message,
+                    "Compressed block length is invalid.");
+  }
+  if (kDecompressed > output.size())
+  {
+    throw Exception(std::errc::no_buffer_space,
+                    "Output is too small for the decompressed block.");
+  }
+
+  const auto kInput = block.subspan(kBlockHeaderSize, kCompressed);
+  size_t in         = 0;
+  size_t out        = 0;
+
+  auto read_length = [&kInput, &in](size_t length) {
+    if (length == detail::kNibbleMaximum)
+    {
+      uint8_t byte;
+      do
+      {
+        if (in >= kInput.size())
+        {
+          throw Exception(std::errc::bad_message,
+                          "Compressed block ends within a length.");
+        }
+        byte = kInput[in++];
+        length += byte;
+      } while (byte == 255);
+    }
+    return length;
+  };
+
+  while (in < kInput.size())
+  {
+    const uint8_t kToken    = kInput[in++];
+    const size_t kLiterals  = read_length(kToken >> 4);
+
+    if (kLiterals > kInput.size() - in || kLiterals > kDecompressed - out)
+    {
+      throw Exception(std::errc::bad_message,
+                      "Compressed block literals overrun the block.");
+    }
+    std::copy_n(&kInput[in], kLiterals, &output[out]);
+    in += kLiterals;
+    out += kLiterals;
+
+    if (in == kInput.size())
+    {
+      break;
+    }
+
+    if (kInput.size() - in < 2)
+    {
+      throw Exception(std::errc::bad_message,
+                      "Compressed block ends within an offset.");
+    }
+    const size_t kOffset = kInput[in] | (kInput[in + 1] << 8);
+    in += 2;
+    const size_t kMatch =
+        read_length(kToken & 0x0F) + detail::kMinimumMatch;
+
+    if (kOffset == 0 || kOffset > out || kMatch > kDecompressed - out)
+    {
+      throw Exception(std::errc::bad_message,
+                      "Compressed block match is out of range.");
+    }
+
+    // Byte by byte, as a match may overlap the bytes it produces.
+    for (size_t i = 0; i < kMatch; i++, out++)
+    {
+      output[out] = output[out - kOffset];
+    }
+  }
+
+  if (out != kDecompressed)
+  {
+    throw Exception(std::errc::bad_message,
+                    "Compressed block length does not match its contents.");
+  }
+
+  return out;
+}
+}  // namespace sjsu::compression
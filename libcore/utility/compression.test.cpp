@@ -0,0 +1,180 @@
+#include <libcore/utility/compression.hpp>
+
+#include <string>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::compression
+{
+namespace
+{
+/// Deterministic bytes that do not compress.
+std::vector<uint8_t> Noise(size_t length)
+{
+  std::vector<uint8_t> bytes(length);
+  uint32_t state = 0x1234'5678;
+  for (auto & byte : bytes)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    byte = static_cast<uint8_t>(state);
+  }
+  return bytes;
+}
+
+std::vector<uint8_t> LogLines(size_t count)
+{
+  std::string log;
+  for (size_t i = 0; i < count; i++)
+  {
+    log += "[" + std::to_string(1000 + i * 10) +
+           "] motor: rpm=1500 temperature=42 state=RUNNING\n";
+  }
+  return std::vector<uint8_t>(log.begin(), log.end());
+}
+}  // namespace
+
+TEST_CASE("Testing compression")
+{
+  constexpr size_t kBlockSize = 128;
+  std::vector<std::vector<uint8_t>> blocks;
+  BlockCompressor<kBlockSize> compressor(
+      [&blocks](std::span<const uint8_t> block) {
+        blocks.emplace_back(block.begin(), block.end());
+      });
+
+  auto decompress_all = [&blocks]() {
+    std::vector<uint8_t> decompressed;
+    std::array<uint8_t, 4 * kBlockSize> buffer;
+    for (const auto & block : blocks)
+    {
+      const size_t kLength = DecompressBlock(block, buffer);
+      decompressed.insert(
+          decompressed.end(), buffer.begin(), buffer.begin() + kLength);
+    }
+    return decompressed;
+  };
+
+  SECTION("Log lines compress and round trip")
+  {
+    // Setup
+    const auto kLog = LogLines(40);
+
+    // Exercise
+    // Written a line at a time, as a logger would.
+    for (size_t i = 0; i < kLog.size(); i += 52)
+    {
+      compressor.Write(
+          std::span(kLog).subspan(i, std::min<size_t>(52, kLog.size() - i)));
+    }
+    compressor.Flush();
+
+    // Verify
+    CHECK(kLog == decompress_all());
+    CHECK(blocks.size() * kBlockSize < kLog.size() / 2);
+    CHECK(kLog.size() == compressor.GetStatistics().input_bytes);
+    CHECK(blocks.size() == compressor.GetStatistics().blocks);
+    for (const auto & block : blocks)
+    {
+      CHECK(kBlockSize == block.size());
+    }
+  }
+
+  SECTION("Incompressible bytes are split across blocks")
+  {
+    // Setup
+    const auto kNoise = Noise(1000);
+
+    // Exercise
+    compressor.Write(kNoise);
+    compressor.Flush();
+
+    // Verify
+    CHECK(kNoise == decompress_all());
+    CHECK(9 == blocks.size());
+  }
+
+  SECTION("Long runs")
+  {
+    // Setup
+    std::vector<uint8_t> run(5000, 'A');
+    run[2500] = 'B';
+
+    // Exercise
+    compressor.Write(run);
+    compressor.Flush();
+
+    // Verify
+    CHECK(run == decompress_all());
+    CHECK(blocks.size() < 25);
+  }
+
+  SECTION("Each block decompresses on its own")
+  {
+    // Setup
+    const auto kLog = LogLines(40);
+    compressor.Write(kLog);
+    compressor.Flush();
+    REQUIRE(blocks.size() > 2);
+    std::array<uint8_t, 4 * kBlockSize> buffer;
+
+    // Exercise
+    const size_t kFirst = DecompressBlock(blocks[0], buffer);
+    const size_t kSecond = DecompressBlock(blocks[1], buffer);
+
+    // Verify
+    CHECK(std::equal(buffer.begin(),
+                     buffer.begin() + kSecond,
+                     kLog.begin() + kFirst));
+  }
+
+  SECTION("Flush() with nothing written")
+  {
+    // Exercise
+    compressor.Flush();
+
+    // Verify
+    CHECK(blocks.empty());
+  }
+
+  SECTION("Block format")
+  {
+    // Setup
+    // One literal 'A', then a match of 4 bytes 1 byte back.
+    const std::array<uint8_t, 8> kBlock = { 4, 0, 5, 0, 0x10, 'A', 1, 0 };
+    std::array<uint8_t, 5> buffer;
+
+    // Exercise
+    const size_t kLength = DecompressBlock(kBlock, buffer);
+
+    // Verify
+    CHECK(5 == kLength);
+    CHECK(std::array<uint8_t, 5>{ 'A', 'A', 'A', 'A', 'A' } == buffer);
+  }
+
+  SECTION("Corrupt blocks are rejected")
+  {
+    // Setup
+    std::array<uint8_t, 8> buffer;
+    const std::vector<uint8_t> kErased(kBlockSize, 0xFF);
+    const std::array<uint8_t, 8> kBadOffset = { 4, 0, 5, 0, 0x10, 'A', 2, 0 };
+    const std::array<uint8_t, 8> kBadLength = { 4, 0, 6, 0, 0x10, 'A', 1, 0 };
+    const std::array<uint8_t, 7> kTruncated = { 3, 0, 5, 0, 0x10, 'A', 1 };
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(DecompressBlock(kErased, buffer),
+                        std::errc::bad_message);
+    SJ2_CHECK_EXCEPTION(DecompressBlock(kBadOffset, buffer),
+                        std::errc::bad_message);
+    SJ2_CHECK_EXCEPTION(DecompressBlock(kBadLength, buffer),
+                        std::errc::bad_message);
+    SJ2_CHECK_EXCEPTION(DecompressBlock(kTruncated, buffer),
+                        std::errc::bad_message);
+    SJ2_CHECK_EXCEPTION(
+        DecompressBlock(kBadOffset, std::span(buffer).first(4)),
+        std::errc::no_buffer_space);
+  }
+}
+}  // namespace sjsu::compression
@@ -0,0 +1,447 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+#include <libcore/utility/memory_pool.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu::coroutine
+{
+namespace detail
+{
+/// Memory resource the next coroutine frame is allocated from. Set by
+/// Executor::Spawn() around the call that creates the coroutine.
+inline std::pmr::memory_resource * frame_resource = nullptr;
+
+/// Stored in front of each coroutine frame, so the frame can be returned to
+/// the memory resource it came from.
+struct alignas(std::max_align_t) FrameHeader_t
+{
+  std::pmr::memory_resource * resource;
+  size_t size;
+};
+}  // namespace detail
+
+/// Return type of a coroutine run by an Executor.
+///
+/// A Task is created suspended and only runs once it has been given to
+/// Executor::Spawn(). Its frame is allocated from the executor's static
+/// storage, never the heap. A Task that could not be allocated is not
+/// valid.
+///
+/// USAGE:
+///
+///    sjsu::coroutine::Task Blink(sjsu::Gpio & led)
+///    {
+///      while (true)
+///      {
+///        led.Toggle();
+///        co_await sjsu::coroutine::Sleep(500ms);
+///      }
+///    }
+class Task
+{
+ public:
+  /// State of the coroutine, which tells the executor when the coroutine can
+  /// be resumed.
+  struct promise_type  // NOLINT
+  {
+    /// Returns true once the awaited event has happened.
+    bool (*is_ready)(const void * awaiter) = nullptr;
+    /// The awaitable the coroutine is suspended on.
+    const void * awaiter = nullptr;
+    /// Exception that escaped the coroutine, rethrown by the executor.
+    std::exception_ptr exception = nullptr;
+
+    /// Allocate the coroutine frame from the executor's storage.
+    ///
+    /// @param size - size of the frame.
+    /// @return void* - the frame, or nullptr if it does not fit.
+    static void * operator new(size_t size) noexcept
+    {
+      std::pmr::memory_resource * resource = detail::frame_resource;
+      constexpr size_t kHeader             = sizeof(detail::FrameHeader_t);
+
+      if (resource == nullptr)
+      {
+        return nullptr;
+      }
+
+      try
+      {
+        void * memory = resource->allocate(kHeader + size);
+        new (memory) detail::FrameHeader_t{ resource, kHeader + size };
+        return static_cast<std::byte *>(memory) + kHeader;
+      }
+      catch (const std::bad_alloc &)
+      {
+        return nullptr;
+      }
+    }
+
+    /// Return the coroutine frame to the executor's storage.
+    ///
+    /// @param frame - the frame returned by operator new.
+    static void operator delete(void * frame) noexcept
+    {
+      auto * header = static_cast<detail::FrameHeader_t *>(frame) - 1;
+      header->resource->deallocate(header, header->size);
+    }
+
+    /// @return Task - an invalid task when the frame could not be allocated.
+    static Task get_return_object_on_allocation_failure()  // NOLINT
+    {
+      return Task(nullptr);
+    }
+
+    Task get_return_object()  // NOLINT
+    {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept  // NOLINT
+    {
+      return {};
+    }
+
+    std::suspend_always final_suspend() noexcept  // NOLINT
+    {
+      return {};
+    }
+
+    void return_void() {}  // NOLINT
+
+    void unhandled_exception()  // NOLINT
+    {
+      exception = std::current_exception();
+    }
+  };
+
+  Task(const Task &) = delete;
+  Task & operator=(const Task &) = delete;
+
+  Task(Task && other) noexcept : handle_(std::exchange(other.handle_, nullptr))
+  {
+  }
+
+  Task & operator=(Task && other) noexcept
+  {
+    if (this != &other)
+    {
+      Destroy();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+
+  ~Task()
+  {
+    Destroy();
+  }
+
+  /// @return true - if the coroutine frame was allocated.
+  bool IsValid() const
+  {
+    return static_cast<bool>(handle_);
+  }
+
+  /// Give up ownership of the coroutine.
+  ///
+  /// @return std::coroutine_handle<promise_type> - the coroutine.
+  std::coroutine_handle<promise_type> Release()
+  {
+    return std::exchange(handle_, nullptr);
+  }
+
+ private:
+  explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle)
+  {
+  }
+
+  void Destroy()
+  {
+    if (handle_)
+    {
+      handle_.destroy();
+      handle_ = nullptr;
+    }
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+/// Base of awaitables that are resumed once a condition is true, checked each
+/// time the executor runs. Checking a condition, rather than resuming from an
+/// interrupt, means interrupts only need to set a flag and never touch the
+/// executor.
+///
+/// Derived classes implement `bool IsReady() const`.
+///
+/// @tparam Derived - the awaitable deriving from this class.
+template <typename Derived>
+class PolledAwaitable
+{
+ public:
+  /// @return true - if the coroutine does not need to suspend.
+  bool await_ready() const  // NOLINT
+  {
+    return Self().IsReady();
+  }
+
+  /// @param handle - the coroutine being suspended.
+  void await_suspend(  // NOLINT
+      std::coroutine_handle<Task::promise_type> handle) const
+  {
+    handle.promise().awaiter  = this;
+    handle.promise().is_ready = [](const void * awaiter)
+    { return static_cast<const PolledAwaitable *>(awaiter)->Self().IsReady(); };
+  }
+
+ private:
+  const Derived & Self() const
+  {
+    return *static_cast<const Derived *>(this);
+  }
+};
+
+/// Suspend the coroutine to let other tasks run, resuming on the executor's
+/// next pass.
+class Yield : public PolledAwaitable<Yield>
+{
+ public:
+  /// @return false - so the coroutine always suspends.
+  bool await_ready() const  // NOLINT
+  {
+    return false;
+  }
+
+  /// @return true - ready as soon as the executor checks.
+  bool IsReady() const
+  {
+    return true;
+  }
+
+  void await_resume() const {}  // NOLINT
+};
+
+/// Suspend the coroutine for a duration of time.
+class Sleep : public PolledAwaitable<Sleep>
+{
+ public:
+  /// @param duration - how long to sleep for.
+  explicit Sleep(std::chrono::nanoseconds duration)
+      : deadline_(Uptime() + duration)
+  {
+  }
+
+  /// @return true - once the duration has elapsed.
+  bool IsReady() const
+  {
+    return Uptime() >= deadline_;
+  }
+
+  void await_resume() const {}  // NOLINT
+
+ private:
+  std::chrono::nanoseconds deadline_;
+};
+
+/// Suspend the coroutine until a condition is true or a timeout elapses.
+///
+/// @tparam Condition - callable returning bool.
+template <typename Condition>
+class Until : public PolledAwaitable<Until<Condition>>
+{
+ public:
+  /// @param condition - callable returning true once the coroutine can
+  ///        continue. Called from the executor each pass.
+  /// @param timeout - maximum time to wait.
+  explicit Until(Condition condition,
+                 std::chrono::nanoseconds timeout =
+                     std::chrono::nanoseconds::max())
+      : condition_(condition),
+        deadline_(timeout == std::chrono::nanoseconds::max()
+                      ? timeout
+                      : Uptime() + timeout)
+  {
+  }
+
+  /// @return true - once the condition is true or the timeout has elapsed.
+  bool IsReady() const
+  {
+    return condition_() || Uptime() >= deadline_;
+  }
+
+  /// @return true - if the condition became true, false if it timed out.
+  bool await_resume() const  // NOLINT
+  {
+    return condition_();
+  }
+
+ private:
+  Condition condition_;
+  std::chrono::nanoseconds deadline_;
+};
+
+/// Runs coroutine Tasks cooperatively on a single core, without an RTOS.
+///
+/// Each task runs until it co_awaits something that is not ready, then the
+/// executor moves on to the next task. Suspended tasks are resumed once the
+/// condition of their awaitable is true. Frames are allocated from a static
+/// pool of kTasks blocks of kFrameSize bytes each.
+///
+/// Run() and RunOnce() must be called from a single context, such as the main
+/// loop. Awaitables only read state that interrupts write, so interrupts
+/// never call into the executor.
+///
+/// USAGE:
+///
+///    sjsu::coroutine::Executor<4> executor;
+///    executor.Spawn(Blink, led);
+///    executor.Spawn(ReadSensor, i2c);
+///    executor.Run();
+///
+/// @tparam kTasks - maximum number of tasks at once.
+/// @tparam kFrameSize - maximum size in bytes of a coroutine's frame.
+template <size_t kTasks, size_t kFrameSize = 256>
+class Executor
+{
+ public:
+  Executor() = default;
+  Executor(const Executor &) = delete;
+  Executor & operator=(const Executor &) = delete;
+
+  ~Executor()
+  {
+    for (auto & task : tasks_)
+    {
+      if (task)
+      {
+        task.destroy();
+      }
+    }
+  }
+
+  /// Create a task by calling `coroutine` with `args` and schedule it.
+  ///
+  /// Arguments are copied into the coroutine's frame when taken by value.
+  /// Avoid lambdas with captures as coroutines, as the captures are not part
+  /// of the frame.
+  ///
+  /// @param coroutine - function returning a Task.
+  /// @param args - arguments to call it with.
+  /// @return true - if the task was created. False if there is no space for
+  ///         another task or its frame is larger than kFrameSize.
+  template <typename Coroutine, typename... Args>
+  bool Spawn(Coroutine && coroutine, Args &&... args)
+  {
+    auto * slot = FreeSlot();
+    if (slot == nullptr)
+    {
+      return false;
+    }
+
+    detail::frame_resource = &frames_;
+    Task task = std::invoke(std::forward<Coroutine>(coroutine),
+                            std::forward<Args>(args)...);
+    detail::frame_resource = nullptr;
+
+    if (!task.IsValid())
+    {
+      return false;
+    }
+
+    *slot = task.Release();
+    return true;
+  }
+
+  /// Resume every task that is ready, once.
+  ///
+  /// @throw - exceptions escaping a task are rethrown after the task has
+  ///          been destroyed.
+  /// @return size_t - number of tasks resumed.
+  size_t RunOnce()
+  {
+    size_t resumed = 0;
+
+    for (auto & task : tasks_)
+    {
+      if (!task || !IsReady(task))
+      {
+        continue;
+      }
+
+      task.promise().is_ready = nullptr;
+      task.promise().awaiter  = nullptr;
+      task.resume();
+      resumed++;
+
+      if (task.done())
+      {
+        std::exception_ptr exception = task.promise().exception;
+        task.destroy();
+        task = nullptr;
+
+        if (exception)
+        {
+          std::rethrow_exception(exception);
+        }
+      }
+    }
+
+    return resumed;
+  }
+
+  /// Run tasks until every task has finished.
+  void Run()
+  {
+    while (Active() > 0)
+    {
+      RunOnce();
+    }
+  }
+
+  /// @return size_t - number of tasks that have not finished.
+  size_t Active() const
+  {
+    size_t active = 0;
+    for (const auto & task : tasks_)
+    {
+      active += static_cast<bool>(task);
+    }
+    return active;
+  }
+
+ private:
+  using Handle = std::coroutine_handle<Task::promise_type>;
+
+  static bool IsReady(Handle task)
+  {
+    const auto & promise = task.promise();
+    return promise.is_ready == nullptr || promise.is_ready(promise.awaiter);
+  }
+
+  Handle * FreeSlot()
+  {
+    for (auto & task : tasks_)
+    {
+      if (!task)
+      {
+        return &task;
+      }
+    }
+    return nullptr;
+  }
+
+  StaticBlockPool<kFrameSize + sizeof(detail::FrameHeader_t), kTasks> frames_;
+  std::array<Handle, kTasks> tasks_{};
+};
+}  // namespace sjsu::coroutine
@@ -0,0 +1,169 @@
+#include <libcore/utility/coroutine.hpp>
+
+#include <array>
+#include <system_error>
+#include <vector>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/coroutine_awaitables.hpp>
+
+namespace sjsu::coroutine
+{
+namespace
+{
+Task Record(std::vector<int> * log, int id, int steps)
+{
+  for (int i = 0; i < steps; i++)
+  {
+    log->push_back(id);
+    co_await Yield();
+  }
+}
+
+Task SleepFor(std::chrono::nanoseconds duration, bool * finished)
+{
+  co_await Sleep(duration);
+  *finished = true;
+}
+
+Task WaitForFlag(const bool * flag, bool * result)
+{
+  *result = co_await Until([flag]() { return *flag; }, 1ms);
+}
+
+Task LargeFrame(int * sum)
+{
+  std::array<int, 256> values{};
+  values[0] = 5;
+  co_await Yield();
+  *sum = values[0];
+}
+
+Task Throw()
+{
+  co_await Yield();
+  throw Exception(std::errc::io_error, "Task failed");
+}
+
+Task WaitForEdge(Gpio * gpio, bool * result)
+{
+  *result = co_await GpioEdge(*gpio, Gpio::Edge::kRising);
+}
+}  // namespace
+
+TEST_CASE("Testing coroutine::Executor")
+{
+  SetUptimeFunction(DefaultUptime);
+  Executor<4> executor;
+
+  SECTION("Tasks take turns at each Yield()")
+  {
+    // Setup
+    std::vector<int> log;
+    REQUIRE(executor.Spawn(Record, &log, 1, 3));
+    REQUIRE(executor.Spawn(Record, &log, 2, 2));
+
+    // Exercise
+    executor.Run();
+
+    // Verify
+    CHECK(std::vector<int>{ 1, 2, 1, 2, 1 } == log);
+    CHECK(0 == executor.Active());
+  }
+
+  SECTION("Sleep() resumes once its duration has elapsed")
+  {
+    // Setup
+    bool finished = false;
+    REQUIRE(executor.Spawn(SleepFor, 100us, &finished));
+
+    // Exercise
+    executor.RunOnce();
+    bool finished_early = finished;
+    executor.Run();
+
+    // Verify
+    CHECK(!finished_early);
+    CHECK(finished);
+  }
+
+  SECTION("Until() returns whether its condition became true")
+  {
+    // Setup
+    bool flag      = false;
+    bool never_set = false;
+    bool result    = false;
+    bool timed_out = true;
+    REQUIRE(executor.Spawn(WaitForFlag, &flag, &result));
+    REQUIRE(executor.Spawn(WaitForFlag, &never_set, &timed_out));
+
+    // Exercise
+    executor.RunOnce();
+    executor.RunOnce();
+    flag = true;
+    executor.Run();
+
+    // Verify
+    CHECK(result);
+    CHECK(!timed_out);
+  }
+
+  SECTION("Spawn() fails when there is no space")
+  {
+    // Setup
+    std::vector<int> log;
+    int sum = 0;
+    for (int i = 0; i < 4; i++)
+    {
+      REQUIRE(executor.Spawn(Record, &log, i, 1));
+    }
+
+    // Exercise + Verify
+    CHECK(!executor.Spawn(Record, &log, 5, 1));
+    executor.Run();
+    CHECK(!executor.Spawn(LargeFrame, &sum));
+    CHECK(0 == sum);
+    CHECK(executor.Spawn(Record, &log, 5, 1));
+  }
+
+  SECTION("Exceptions escaping a task are rethrown")
+  {
+    // Setup
+    REQUIRE(executor.Spawn(Throw));
+
+    // Exercise + Verify
+    executor.RunOnce();
+    CHECK_THROWS_AS(executor.RunOnce(), Exception);
+    CHECK(0 == executor.Active());
+  }
+
+  SECTION("GpioEdge resumes once the interrupt occurs")
+  {
+    // Setup
+    Mock<Gpio> mock_gpio;
+    InterruptCallback callback;
+    When(Method(mock_gpio, Gpio::AttachInterrupt))
+        .AlwaysDo(
+            [&callback](InterruptCallback handler, Gpio::Edge)
+            { callback = handler; });
+    Fake(Method(mock_gpio, Gpio::DetachInterrupt));
+    bool result = false;
+    REQUIRE(executor.Spawn(WaitForEdge, &mock_gpio.get(), &result));
+
+    // Exercise
+    executor.RunOnce();
+    executor.RunOnce();
+    bool result_before_edge = result;
+    callback();
+    executor.Run();
+
+    // Verify
+    CHECK(!result_before_edge);
+    CHECK(result);
+    Verify(Method(mock_gpio, Gpio::AttachInterrupt)
+               .Using(_, Gpio::Edge::kRising),
+           Method(mock_gpio, Gpio::DetachInterrupt));
+  }
+}
+}  // namespace sjsu::coroutine
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <span>
+#include <system_error>
+
+#include <libcore/peripherals/gpio.hpp>
+#include <libcore/peripherals/i2c.hpp>
+#include <libcore/peripherals/spi_bus.hpp>
+#include <libcore/peripherals/uart.hpp>
+#include <libcore/utility/coroutine.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu::coroutine
+{
+/// Suspend the coroutine until an edge occurs on a GPIO pin.
+///
+/// The interrupt is attached when the awaitable is constructed and detached
+/// when it is destroyed, so an edge that occurs between the two still counts.
+///
+/// USAGE:
+///
+///    bool pressed = co_await sjsu::coroutine::GpioEdge(
+///        button, sjsu::Gpio::Edge::kFalling, 5s);
+class GpioEdge : public PolledAwaitable<GpioEdge>
+{
+ public:
+  /// @param gpio - the pin to watch. Must have been initialized as an input.
+  /// @param edge - edge to wait for.
+  /// @param timeout - maximum time to wait.
+  GpioEdge(Gpio & gpio,
+           Gpio::Edge edge,
+           std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max())
+      : gpio_(gpio), deadline_(Deadline(timeout))
+  {
+    gpio_.AttachInterrupt([this]() { triggered_ = true; }, edge);
+  }
+
+  GpioEdge(const GpioEdge &) = delete;
+  GpioEdge & operator=(const GpioEdge &) = delete;
+
+  ~GpioEdge()
+  {
+    gpio_.DetachInterrupt();
+  }
+
+  /// @return true - once the edge has occurred or the timeout has elapsed.
+  bool IsReady() const
+  {
+    return triggered_ || Uptime() >= deadline_;
+  }
+
+  /// @return true - if the edge occurred, false if it timed out.
+  bool await_resume() const  // NOLINT
+  {
+    return triggered_;
+  }
+
+ private:
+  static std::chrono::nanoseconds Deadline(std::chrono::nanoseconds timeout)
+  {
+    return (timeout == std::chrono::nanoseconds::max()) ? timeout
+                                                        : Uptime() + timeout;
+  }
+
+  Gpio & gpio_;
+  std::chrono::nanoseconds deadline_;
+  std::atomic<bool> triggered_ = false;
+};
+
+/// Suspend the coroutine until a UART port has received data.
+///
+/// USAGE:
+///
+///    if (co_await sjsu::coroutine::UartData(uart, 100ms))
+///    {
+///      size_t count = uart.Read(buffer);
+///    }
+class UartData : public PolledAwaitable<UartData>
+{
+ public:
+  /// @param uart - port to wait on.
+  /// @param timeout - maximum time to wait.
+  explicit UartData(
+      Uart & uart,
+      std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max())
+      : uart_(uart),
+        deadline_(timeout == std::chrono::nanoseconds::max()
+                      ? timeout
+                      : Uptime() + timeout)
+  {
+  }
+
+  /// @return true - once data is available or the timeout has elapsed.
+  bool IsReady() const
+  {
+    return uart_.HasData() || Uptime() >= deadline_;
+  }
+
+  /// @return true - if data is available, false if it timed out.
+  bool await_resume() const  // NOLINT
+  {
+    return uart_.HasData();
+  }
+
+ private:
+  Uart & uart_;
+  std::chrono::nanoseconds deadline_;
+};
+
+/// Start an I2C transaction and suspend the coroutine until it completes or
+/// its timeout elapses. Uses I2c::TransactionAsync(), so drivers without
+/// interrupt support complete the transaction before the coroutine suspends.
+///
+/// USAGE:
+///
+///    std::errc status = co_await sjsu::coroutine::I2cTransfer(i2c, {
+///        .operation = sjsu::I2c::Operation::kRead,
+///        .address   = 0x1D,
+///        .data_in   = buffer.data(),
+///        .in_length = buffer.size(),
+///    });
+class I2cTransfer : public PolledAwaitable<I2cTransfer>
+{
+ public:
+  /// @param i2c - bus to perform the transaction on.
+  /// @param transaction - transaction to perform. The buffers it references
+  ///        must remain valid until the awaitable has been resumed.
+  I2cTransfer(I2c & i2c, const I2c::Transaction_t & transaction)
+      : deadline_(Uptime() + transaction.timeout),
+        transaction_(i2c, transaction)
+  {
+  }
+
+  /// @return true - once the transaction is done or has timed out.
+  bool IsReady() const
+  {
+    return !transaction_.IsBusy() || Uptime() >= deadline_;
+  }
+
+  /// @return std::errc - result of the transaction, std::errc::timed_out if it
+  ///         did not complete in time.
+  std::errc await_resume() const  // NOLINT
+  {
+    if (transaction_.IsBusy())
+    {
+      return std::errc::timed_out;
+    }
+    return transaction_.Status();
+  }
+
+ private:
+  std::chrono::nanoseconds deadline_;
+  I2c::AsyncTransaction transaction_;
+};
+
+/// Queue a transfer with a SPI device and suspend the coroutine until the
+/// transfer has completed, see SpiBus::Enqueue().
+///
+/// USAGE:
+///
+///    bool transferred =
+///        co_await sjsu::coroutine::SpiTransfer(flash, segments);
+class SpiTransfer : public PolledAwaitable<SpiTransfer>
+{
+ public:
+  /// @param device - device to transfer with.
+  /// @param segments - segments to transfer. The list and the buffers it
+  ///        references must remain valid until the awaitable has been resumed.
+  SpiTransfer(SpiDevice & device, std::span<const Spi::Segment_t> segments)
+  {
+    queued_ = device.TransferAsync(segments, [this]() { done_ = true; });
+  }
+
+  SpiTransfer(const SpiTransfer &) = delete;
+  SpiTransfer & operator=(const SpiTransfer &) = delete;
+
+  /// @return true - once the transfer has completed or if it was not queued.
+  bool IsReady() const
+  {
+    return !queued_ || done_;
+  }
+
+  /// @return true - if the transfer was performed, false if the bus queue
+  ///         was full.
+  bool await_resume() const  // NOLINT
+  {
+    return queued_;
+  }
+
+ private:
+  bool queued_            = false;
+  std::atomic<bool> done_ = false;
+};
+}  // namespace sjsu::coroutine
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace sjsu
+{
+/// Masks interrupts for as long as it is in scope, so that a short sequence,
+/// such as a read-modify-write of a register shared with an interrupt, cannot
+/// be interrupted. The previous interrupt mask is restored when it goes out of
+/// scope, so critical sections can be nested.
+///
+/// On ARM this sets PRIMASK. Elsewhere, such as on host, there are no
+/// interrupts to mask and it does nothing.
+///
+/// USAGE:
+///
+///    {
+///      sjsu::CriticalSection lock;
+///      shared_count++;
+///    }
+class CriticalSection
+{
+ public:
+  CriticalSection()
+  {
+#if defined(__arm__)
+    asm volatile("mrs %0, primask" : "=r"(primask_));
+    asm volatile("cpsid i" ::: "memory");
+#endif
+  }
+
+  CriticalSection(const CriticalSection &) = delete;
+  CriticalSection & operator=(const CriticalSection &) = delete;
+
+  ~CriticalSection()
+  {
+#if defined(__arm__)
+    asm volatile("msr primask, %0" ::"r"(primask_) : "memory");
+#endif
+  }
+
+ private:
+  [[maybe_unused]] uint32_t primask_ = 0;
+};
+}  // namespace sjsu
@@ -4,66 +4,121 @@
 
 #include <algorithm>
 #include <array>
-#include <cctype>
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <libcore/utility/ansi_terminal_codes.hpp>
 #include <libcore/utility/build_info.hpp>
-
+#include <libcore/utility/log_ring.hpp>
+#include <libcore/utility/stack_usage.hpp>
+#include <span>
+#include <string_view>
 
 namespace sjsu
 {
 namespace debug
 {
+/// Number of bytes shown in each row of a hexdump.
+inline constexpr size_t kHexdumpBytesPerRow = 16;
+
+/// Number of characters in a full row of a hexdump, including its newline:
+/// the offset, the bytes in hex and the bytes as characters.
+inline constexpr size_t kHexdumpRowLength = 79;
+
 // =====================================
 // Hidden utility functions for Hexdump
 // =====================================
-inline void PrintCharacterRow(const uint8_t * bytes,
-                              size_t length,
-                              char * buffer,
-                              int position)
+inline constexpr char kHexDigits[] = "0123456789ABCDEF";
+
+inline char * WriteHexOffset(size_t offset, char * row)
 {
-  buffer[position++] = '|';
-  for (size_t j = 0; j < length; j++)
+  for (int shift = 28; shift >= 0; shift -= 4)
   {
-    if (isprint(bytes[j]))
-    {
-      buffer[position++] = bytes[j];
-    }
-    else
-    {
-      buffer[position++] = '.';
-    }
+    *row++ = kHexDigits[(offset >> shift) & 0xF];
   }
-  buffer[position++] = '|';
-  buffer[position++] = '\n';
+  *row++ = ' ';
+  *row++ = ' ';
+  return row;
+}
+
+inline constexpr char PrintableCharacter(uint8_t byte)
+{
+  // The characters isprint() accepts in the "C" locale.
+  return (0x20 <= byte && byte < 0x7F) ? static_cast<char>(byte) : '.';
 }
 
-inline int PrintHexBytesRow(const uint8_t * bytes,
-                            size_t length,
-                            char * buffer,
-                            int position)
+/// Format one row of a hexdump, in the same layout as the UNIX
+/// `hexdump -C` program, without calling into libc:
+///
+///   00000010  48 65 6C 6C 6F 20 57 6F  72 6C 64 21 0A 00 00 00  |Hello Wo...|
+///
+/// @param offset - position of the row's first byte within the dump.
+/// @param bytes - up to kHexdumpBytesPerRow bytes to show in the row.
+/// @param row - buffer to write the row, ending with a newline, into. It is
+///        not null terminated.
+/// @return size_t - number of characters written.
+inline size_t FormatHexdumpRow(size_t offset,
+                               std::span<const uint8_t> bytes,
+                               std::span<char, kHexdumpRowLength> row)
 {
-  for (size_t j = 0; j < 16; j++)
+  const size_t kLength = std::min(bytes.size(), kHexdumpBytesPerRow);
+  char * position      = WriteHexOffset(offset, row.data());
+
+  for (size_t j = 0; j < kHexdumpBytesPerRow; j++)
   {
-    if (j < length)
+    if (j < kLength)
     {
-      position += snprintf(&buffer[position], 4, "%02X ", bytes[j]);  // NOLINT
+      *position++ = kHexDigits[bytes[j] >> 4];
+      *position++ = kHexDigits[bytes[j] & 0xF];
     }
     else
     {
-      position += snprintf(&buffer[position], 4, "   ");  // NOLINT
+      *position++ = ' ';
+      *position++ = ' ';
     }
+    *position++ = ' ';
 
     if (j == 7)
     {
-      buffer[position++] = ' ';
+      *position++ = ' ';
     }
   }
-  buffer[position++] = ' ';
-  return position;
+  *position++ = ' ';
+
+  *position++ = '|';
+  for (size_t j = 0; j < kLength; j++)
+  {
+    *position++ = PrintableCharacter(bytes[j]);
+  }
+  *position++ = '|';
+  *position++ = '\n';
+
+  return static_cast<size_t>(position - row.data());
+}
+
+/// Format a hexdump one row at a time, handing each row to `writer`, followed
+/// by a final line holding the length of the data.
+///
+/// @param data - bytes to dump.
+/// @param writer - callable with the signature `void(std::string_view row)`.
+///        Each row ends with a newline.
+template <typename Writer>
+inline void HexdumpRows(std::span<const uint8_t> data, Writer && writer)
+{
+  std::array<char, kHexdumpRowLength> row;
+
+  for (size_t i = 0; i < data.size(); i += kHexdumpBytesPerRow)
+  {
+    const auto kBytes =
+        data.subspan(i, std::min(kHexdumpBytesPerRow, data.size() - i));
+    const size_t kRowLength = FormatHexdumpRow(i, kBytes, row);
+    writer(std::string_view(row.data(), kRowLength));
+  }
+
+  char * end = WriteHexOffset(data.size(), row.data());
+  *end++     = '\n';
+  writer(std::string_view(row.data(), static_cast<size_t>(end - row.data())));
 }
 
 /// Similar to the UNIX hexdump program, this function will read the bytes from
@@ -76,60 +131,51 @@ inline int PrintHexBytesRow(const uint8_t * bytes,
 ///   // Subtract 1 to ignore null character
 ///   sjsu::debug::Hexdump(some_string, sizeof(some_string) - 1);
 ///
+/// @tparam kNumberOfRowsBuffered - number of rows formatted before they are
+///         written to stdout together.
 /// @param address - location to start reading bytes from
 /// @param length - the number of bytes to read from the starting location
 template <size_t kNumberOfRowsBuffered = 1>
-inline void Hexdump(void * address, size_t length)
+inline void Hexdump(const void * address, size_t length)
 {
   // Verify that the number of rows specified is 1 or more
   static_assert(kNumberOfRowsBuffered > 0,
                 "Number of buffered rows must be greater than zero.");
 
-  // The number of bytes required to hold a row of hexdump data + newline
-  static constexpr size_t kRowMaximumLength = 79;
-
-  // Define a buffer that will contain the bytes for each row of the hex dump.
-  // +1 to size for NULL CHARACTER.
-  std::array<char, (kNumberOfRowsBuffered * kRowMaximumLength) + 1> rows;
-
-  // Fill the rows
-  std::fill(rows.begin(), rows.end(), '\0');
-
-  // Convert the void* to a uint8_t* so that the value are interpreted as
-  // numerical bytes.
-  uint8_t * bytes = static_cast<uint8_t *>(address);
-
-  size_t row_position = 0;
-
-  for (size_t i = 0; i < length; i += 16, row_position++)
-  {
-    // If the row position goes above the number rows, reset the rows and print
-    // them.
-    if (row_position >= kNumberOfRowsBuffered)
-    {
-      printf("%s", rows.data());
-      std::fill(rows.begin(), rows.end(), '\0');
-      row_position = 0;
-    }
-
-    // Point to the start of the current rows.
-    char * row = &rows[row_position * kRowMaximumLength];
-
-    // Print the starting address position of the row
-    int position = snprintf(row, 11, "%08zX  ", i);  // NOLINT
-
-    // Figure out the number of bytes to display
-    size_t bytes_to_print = (i + 15 > length) ? (length % 16) : 16;
-
-    position = PrintHexBytesRow(&bytes[i], bytes_to_print, row, position);
-    PrintCharacterRow(&bytes[i], bytes_to_print, row, position);
-  }
-
-  // Print out the last of the data rows
-  printf("%s", rows.data());
+  std::array<char, kNumberOfRowsBuffered * kHexdumpRowLength> rows;
+  size_t used = 0;
+
+  HexdumpRows(std::span(static_cast<const uint8_t *>(address), length),
+              [&rows, &used](std::string_view row) {
+                if (used + row.size() > rows.size())
+                {
+                  fwrite(rows.data(), 1, used, stdout);
+                  used = 0;
+                }
+                std::copy(row.begin(), row.end(), &rows[used]);
+                used += row.size();
+              });
+
+  fwrite(rows.data(), 1, used, stdout);
+}
 
-  // Print out the amount of data
-  printf("%08zX  \n", length);
+/// Hexdump into a LogRing, one record per row, rather than printing, so that
+/// dumping from time critical code only costs formatting the rows. The rows
+/// are printed whenever the ring is drained.
+///
+/// @param ring - ring to write the rows into.
+/// @param address - location to start reading bytes from.
+/// @param length - the number of bytes to read from the starting location.
+/// @return true - if every row was stored.
+/// @return false - if the ring ran out of room and some rows were dropped.
+inline bool Hexdump(LogRing & ring, const void * address, size_t length)
+{
+  bool stored = true;
+  HexdumpRows(std::span(static_cast<const uint8_t *>(address), length),
+              [&ring, &stored](std::string_view row) {
+                stored &= ring.Write(row.data(), row.size());
+              });
+  return stored;
 }
 
 /// Generate a string of text that represents a hexdump of any data type.
@@ -138,40 +184,28 @@ inline void Hexdump(void * address, size_t length)
 /// @param address - address of the structure to be convereted into a hexdumped
 /// array.
 /// @return auto - std::array<char, N> where N is the number characters needed
-/// to represent the hexdump data.
+/// to represent the hexdump data. Characters after the last row are null.
 template <class Structure>
 inline auto HexdumpStructure(const Structure & address)
 {
   static constexpr size_t kLength = sizeof(Structure);
-  // The number of bytes required to hold a row of hexdump data + newline
-  static constexpr size_t kRowMaximumLength = 79;
+  static constexpr size_t kRows =
+      (kLength + kHexdumpBytesPerRow - 1) / kHexdumpBytesPerRow;
 
-  // Define a buffer that will contain the bytes for each row of the hex dump.
   // +1 to size for NULL CHARACTER.
-  std::array<char, ((kLength + 1) * kRowMaximumLength)> rows;
-
-  // Fill the rows
+  std::array<char, (kRows * kHexdumpRowLength) + 1> rows;
   std::fill(rows.begin(), rows.end(), '\0');
 
-  // Convert the void* to a uint8_t* so that the value are interpreted as
-  // numerical bytes.
-  const uint8_t * bytes = reinterpret_cast<const uint8_t *>(&address);
-
-  size_t row_position = 0;
+  const auto kBytes = std::span(
+      reinterpret_cast<const uint8_t *>(&address), kLength);
 
-  for (size_t i = 0; i < kLength; i += 16, row_position++)
+  size_t used = 0;
+  for (size_t i = 0; i < kLength; i += kHexdumpBytesPerRow)
   {
-    // Point to the start of the current rows.
-    char * row = &rows[row_position * kRowMaximumLength];
-
-    // Print the starting address position of the row
-    int position = snprintf(row, 11, "%08zX  ", i);  // NOLINT
-
-    // Figure out the number of bytes to display
-    size_t bytes_to_print = (i + 15 > kLength) ? (kLength % 16) : 16;
-
-    position = PrintHexBytesRow(&bytes[i], bytes_to_print, row, position);
-    PrintCharacterRow(&bytes[i], bytes_to_print, row, position);
+    used += FormatHexdumpRow(
+        i,
+        kBytes.subspan(i, std::min(kHexdumpBytesPerRow, kLength - i)),
+        std::span<char, kHexdumpRowLength>(&rows[used], kHexdumpRowLength));
   }
 
   return rows;
@@ -179,11 +213,56 @@ inline auto HexdumpStructure(const Structure & address)
 
 /// Only prints hexdump if the log level for the application is above DEBUG
 template <size_t kNumberOfRowsBuffered = 1>
-inline void HexdumpDebug(void * address, size_t length)
+inline void HexdumpDebug(const void * address, size_t length)
 {
   Hexdump<kNumberOfRowsBuffered>(address, length);
 }
 
+/// Print the high-water mark of a stack painted by stack::Paint(), as:
+///
+///   main: 1184 of 4096 bytes used (28%)
+///
+/// @param name - name of the stack.
+/// @param stack - memory of the stack, lowest address first.
+inline void PrintStackUsage(std::string_view name,
+                            std::span<const uint32_t> stack)
+{
+  const size_t kUsed = stack::Used(stack);
+  const size_t kSize = stack.size_bytes();
+  printf("%.*s: %zu of %zu bytes used (%zu%%)\n",
+         static_cast<int>(name.size()),
+         name.data(),
+         kUsed,
+         kSize,
+         (kSize == 0) ? 0 : kUsed * 100 / kSize);
+}
+
+/// Print the deepest stack each interrupt measured by an
+/// InstrumentedInterruptController, with stack pointer sampling enabled, has
+/// been entered with, as:
+///
+///   IRQ 21: entered with 312 bytes of stack in use
+///
+/// Together with PrintStackUsage() of the interrupt stack, this shows which
+/// handlers leave room to shrink it.
+///
+/// @param controller - the InstrumentedInterruptController.
+/// @param stack_top - address just past the end of the stack interrupts run
+///        on, the initial stack pointer.
+template <class Controller>
+inline void PrintInterruptStackDepths(const Controller & controller,
+                                      uintptr_t stack_top)
+{
+  controller.ForEach([stack_top](const auto & irq) {
+    if (irq.lowest_stack_pointer != 0)
+    {
+      printf("IRQ %d: entered with %zu bytes of stack in use\n",
+             irq.interrupt_request_number,
+             static_cast<size_t>(stack_top - irq.lowest_stack_pointer));
+    }
+  });
+}
+
 // ==============================================
 // Hidden Backtrace Utility Functions
 // ==============================================
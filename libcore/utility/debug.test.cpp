@@ -0,0 +1,106 @@
+#include <libcore/utility/debug.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing debug Hexdump")
+{
+  constexpr char kText[] = "Hello World!\n\x01\x7F\x80 and more.";
+  const auto kBytes =
+      std::span(reinterpret_cast<const uint8_t *>(kText), sizeof(kText) - 1);
+
+  SECTION("FormatHexdumpRow() formats a full row")
+  {
+    // Setup
+    std::array<char, debug::kHexdumpRowLength> row;
+
+    // Exercise
+    size_t length = debug::FormatHexdumpRow(0x10, kBytes.first(16), row);
+
+    // Verify
+    CHECK(debug::kHexdumpRowLength == length);
+    CHECK("00000010  48 65 6C 6C 6F 20 57 6F  72 6C 64 21 0A 01 7F 80  "
+          "|Hello World!....|\n" == std::string(row.data(), length));
+  }
+
+  SECTION("FormatHexdumpRow() pads a partial row")
+  {
+    // Setup
+    std::array<char, debug::kHexdumpRowLength> row;
+
+    // Exercise
+    size_t length = debug::FormatHexdumpRow(0x20, kBytes.first(3), row);
+
+    // Verify
+    CHECK("00000020  48 65 6C                                          "
+          "|Hel|\n" == std::string(row.data(), length));
+  }
+
+  SECTION("HexdumpRows() ends with the length")
+  {
+    // Setup
+    std::string dump;
+
+    // Exercise
+    debug::HexdumpRows(kBytes,
+                       [&dump](std::string_view row) { dump.append(row); });
+
+    // Verify
+    CHECK("00000000  48 65 6C 6C 6F 20 57 6F  72 6C 64 21 0A 01 7F 80  "
+          "|Hello World!....|\n"
+          "00000010  20 61 6E 64 20 6D 6F 72  65 2E                    "
+          "| and more.|\n"
+          "0000001A  \n" == dump);
+  }
+
+  SECTION("Hexdump() into a LogRing stores one record per row")
+  {
+    // Setup
+    StaticLogRing<256> ring;
+    std::string drained;
+
+    // Exercise
+    bool stored = debug::Hexdump(ring, kText, sizeof(kText) - 1);
+    ring.Drain([&drained](std::span<const uint8_t> chunk) {
+      drained.append(chunk.begin(), chunk.end());
+    });
+
+    // Verify
+    CHECK(stored);
+    CHECK(79 + 73 + 11 == drained.size());
+    CHECK(drained.ends_with("0000001A  \n"));
+  }
+
+  SECTION("Hexdump() into a full LogRing reports dropped rows")
+  {
+    // Setup
+    StaticLogRing<128> ring;
+
+    // Exercise
+    bool stored = debug::Hexdump(ring, kText, sizeof(kText) - 1);
+
+    // Verify
+    CHECK(!stored);
+    CHECK(0 < ring.Dropped());
+  }
+
+  SECTION("HexdumpStructure() only reads the structure")
+  {
+    // Setup
+    const std::array<uint8_t, 15> kStructure = { 'a', 'b', 'c' };
+
+    // Exercise
+    auto rows = debug::HexdumpStructure(kStructure);
+
+    // Verify
+    CHECK("00000000  61 62 63 00 00 00 00 00  00 00 00 00 00 00 00     "
+          "|abc............|\n" == std::string(rows.data()));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include <libcore/utility/cache.hpp>
+
+namespace sjsu
+{
+/// A fixed size array for DMA transfers that starts on a cache line and is
+/// padded to whole cache lines, so that no other data shares its lines.
+/// Cache maintenance of the buffer therefore never discards or overwrites
+/// other data, and the D-cache of a Cortex-M7 can stay enabled for memory
+/// used by DMA.
+///
+/// - Call Clean() after the CPU writes the buffer and before DMA reads it,
+///   such as before Uart::WriteAsync().
+/// - Call Invalidate() before DMA writes the buffer and again before the CPU
+///   reads what it wrote, such as around Storage::ReadAsync().
+///
+/// Both do nothing on processors without a data cache, see
+/// SJ2_HAS_DATA_CACHE. Buffers placed with SJ2_NON_CACHEABLE need neither.
+///
+/// USAGE:
+///
+///    sjsu::DmaBuffer<uint8_t, 64> packet;
+///    Encode(packet.Span());
+///    packet.Clean();
+///    uart.WriteAsync(packet);
+///
+///    sjsu::DmaBuffer<uint8_t, 512> block;
+///    block.Invalidate();
+///    spi.Transfer({}, block);
+///    block.Invalidate();
+///    Process(block.Span());
+///
+/// @tparam T - type of each element. Must be trivially copyable, since DMA
+///         copies its bytes.
+/// @tparam kSize - number of elements.
+template <typename T, size_t kSize>
+class alignas(kCacheLineSize) DmaBuffer
+{
+ public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "DmaBuffer elements must be trivially copyable.");
+  static_assert(kSize > 0, "DmaBuffer size must not be zero.");
+
+  /// @return std::span<T, kSize> - the elements.
+  std::span<T, kSize> Span()
+  {
+    return elements_;
+  }
+
+  /// @return std::span<const T, kSize> - the elements.
+  std::span<const T, kSize> Span() const
+  {
+    return elements_;
+  }
+
+  /// @param index - element to access.
+  /// @return T & - the element.
+  T & operator[](size_t index)
+  {
+    return elements_[index];
+  }
+
+  /// @param index - element to access.
+  /// @return const T & - the element.
+  const T & operator[](size_t index) const
+  {
+    return elements_[index];
+  }
+
+  /// @return T * - the first element.
+  T * data()
+  {
+    return elements_.data();
+  }
+
+  /// @return const T * - the first element.
+  const T * data() const
+  {
+    return elements_.data();
+  }
+
+  /// @return size_t - number of elements.
+  static constexpr size_t size()
+  {
+    return kSize;
+  }
+
+  /// @return T * - the first element. As a contiguous range, the buffer
+  ///         converts to a std::span, to pass it to Spi::Transfer() or
+  ///         Uart::Write().
+  T * begin()
+  {
+    return elements_.data();
+  }
+
+  /// @return const T * - the first element.
+  const T * begin() const
+  {
+    return elements_.data();
+  }
+
+  /// @return T * - past the last element.
+  T * end()
+  {
+    return elements_.data() + kSize;
+  }
+
+  /// @return const T * - past the last element.
+  const T * end() const
+  {
+    return elements_.data() + kSize;
+  }
+
+  /// Write the buffer from the data cache to memory, so that DMA reads what
+  /// the CPU wrote.
+  void Clean() const
+  {
+    DataCache::Clean(this, sizeof(*this));
+  }
+
+  /// Discard the buffer from the data cache, so that the CPU reads what DMA
+  /// wrote.
+  void Invalidate()
+  {
+    DataCache::Invalidate(this, sizeof(*this));
+  }
+
+ private:
+  std::array<T, kSize> elements_{};
+};
+}  // namespace sjsu
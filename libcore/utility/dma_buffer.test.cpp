@@ -0,0 +1,85 @@
+#include <libcore/utility/dma_buffer.hpp>
+
+#include <cstdint>
+#include <span>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing DataCache")
+{
+  SECTION("Lines() covers every line the memory touches")
+  {
+    // Exercise
+    constexpr auto kWhole   = DataCache::Lines(0x2000'0040, 64);
+    constexpr auto kPartial = DataCache::Lines(0x2000'0044, 30);
+
+    // Verify
+    CHECK(0x2000'0040 == kWhole.begin);
+    CHECK(0x2000'0080 == kWhole.end);
+    CHECK(0x2000'0040 == kPartial.begin);
+    CHECK(0x2000'0080 == kPartial.end);
+  }
+
+  SECTION("IsLineAligned() requires both the address and size to be aligned")
+  {
+    // Exercise & Verify
+    CHECK(DataCache::IsLineAligned(0x2000'0040, kCacheLineSize * 2));
+    CHECK(!DataCache::IsLineAligned(0x2000'0041, kCacheLineSize));
+    CHECK(!DataCache::IsLineAligned(0x2000'0040, kCacheLineSize + 1));
+  }
+}
+
+TEST_CASE("Testing DmaBuffer")
+{
+  SECTION("Buffers start on a cache line and fill whole lines")
+  {
+    // Setup
+    DmaBuffer<uint8_t, 10> first;
+    DmaBuffer<uint16_t, 40> second;
+
+    // Exercise & Verify
+    static_assert(alignof(DmaBuffer<uint8_t, 10>) == kCacheLineSize);
+    static_assert(sizeof(DmaBuffer<uint8_t, 10>) == kCacheLineSize);
+    static_assert(sizeof(DmaBuffer<uint16_t, 40>) % kCacheLineSize == 0);
+    CHECK(DataCache::IsLineAligned(reinterpret_cast<uintptr_t>(&first),
+                                   sizeof(first)));
+    CHECK(DataCache::IsLineAligned(reinterpret_cast<uintptr_t>(&second),
+                                   sizeof(second)));
+  }
+
+  SECTION("Buffers are zeroed and convert to spans")
+  {
+    // Setup
+    DmaBuffer<uint8_t, 4> buffer;
+
+    // Exercise
+    buffer[2]                           = 7;
+    std::span<uint8_t> writable         = buffer;
+    std::span<const uint8_t> const_view = buffer;
+
+    // Verify
+    CHECK(4 == buffer.size());
+    CHECK(buffer.data() == writable.data());
+    CHECK(4 == const_view.size());
+    CHECK(0 == buffer.Span()[0]);
+    CHECK(7 == const_view[2]);
+  }
+
+  SECTION("Cache maintenance leaves the contents alone")
+  {
+    // Setup
+    DmaBuffer<uint32_t, 8> buffer;
+    buffer[0] = 0x1234'5678;
+
+    // Exercise
+    buffer.Clean();
+    buffer.Invalidate();
+    DataCache::Invalidate(buffer.Span());
+
+    // Verify
+    CHECK(0x1234'5678 == buffer[0]);
+  }
+}
+}  // namespace sjsu
@@ -155,7 +155,7 @@ class Exception : std::exception
   void Print() const
   {
     /// Print the colored error text to STDOUT
-    sjsu::log::Print("Error:%s(%d):%s:%d:%s(): %s\n",
+    sjsu::log::Print("Error:{}({}):{}:{}:{}(): {}\n",
                      Stringify(code_),
                      static_cast<int>(code_),
                      file_,
@@ -170,6 +170,18 @@ class Exception : std::exception
     return code_;
   }
 
+  /// @return const char* - name of the file where this exception was created.
+  const char * GetFile() const
+  {
+    return file_;
+  }
+
+  /// @return int - line of the file where this exception was created.
+  int GetLine() const
+  {
+    return line_;
+  }
+
   /// Check if the exception object has and error code equal to the compared
   /// error code
   ///
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include <libcore/utility/critical_section.hpp>
+#include <libcore/utility/debug.hpp>
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/log.hpp>
+#include <libcore/utility/result.hpp>
+#include <libcore/utility/time/time.hpp>
+
+#if !defined(SJ2_NO_INIT)
+#if defined(__arm__)
+/// Place a variable in the .noinit section, which the startup code neither
+/// zeroes nor initializes, so its contents survive a reset that keeps RAM
+/// powered. The linker script must define the section as NOLOAD.
+#define SJ2_NO_INIT __attribute__((section(".noinit")))
+#else
+#define SJ2_NO_INIT
+#endif
+#endif
+
+#if !defined(SJ2_ERROR_RING_CAPACITY)
+/// Number of errors an ErrorRing keeps before overwriting the oldest.
+#define SJ2_ERROR_RING_CAPACITY 16
+#endif
+
+namespace sjsu
+{
+/// A single error recorded in an ErrorRing.
+struct ErrorRecord_t
+{
+  /// Longest file name kept, including its NULL terminator. Longer names are
+  /// cut short.
+  static constexpr size_t kFileLength = 18;
+
+  /// Uptime when the error was recorded, in microseconds.
+  uint64_t uptime;
+  /// Error code of the error.
+  int32_t code;
+  /// Line of the file where the error was created.
+  uint16_t line;
+  /// Name of the file where the error was created, without its directories.
+  std::array<char, kFileLength> file;
+};
+
+/// Fixed size history of errors for post-mortem debugging.
+///
+/// Recording an error only copies its code, line, file name and the uptime
+/// into the ring, rather than printing it over a slow serial link, so it
+/// does not disturb the timing of the code that failed. When the ring is
+/// full, the oldest error is overwritten.
+///
+/// ErrorRing has no constructor, so an instance declared with SJ2_NO_INIT is
+/// left untouched by the startup code and its history survives a reset, such
+/// as one from a watchdog or a hard fault handler. The ring checks its own
+/// header before it is used and starts empty if it holds garbage, such as
+/// after a power cycle.
+///
+/// USAGE:
+///
+///    SJ2_NO_INIT sjsu::ErrorRing error_ring;
+///
+///    sjsu::SysCallManager::SetErrorRing(&error_ring);
+///    // ...
+///    error_ring.Record(std::errc::timed_out);
+///    // ... after a reset
+///    error_ring.Print();
+///    error_ring.Dump();
+class ErrorRing
+{
+ public:
+  /// Number of errors kept before the oldest is overwritten.
+  static constexpr size_t kCapacity = SJ2_ERROR_RING_CAPACITY;
+
+  /// Value of the header of an intact ring.
+  static constexpr uint32_t kMagic = 0x4552'5247;
+
+  /// Record an error. Safe to call from interrupts.
+  ///
+  /// @param code - error code of the error.
+  /// @param location - location of the error. Defaults to the caller.
+  void Record(std::errc code,
+              const std::experimental::source_location & location =
+                  std::experimental::source_location::current())
+  {
+    Append(code, location.file_name(), location.line());
+  }
+
+  /// Record an exception, with the location it was created at.
+  ///
+  /// @param exception - the exception to record.
+  void Record(const Exception & exception)
+  {
+    Append(exception.GetCode(),
+           exception.GetFile(),
+           static_cast<uint32_t>(exception.GetLine()));
+  }
+
+  /// Record the error of a failed Result.
+  ///
+  /// @param error - the error to record.
+  void Record(const Error_t & error)
+  {
+    Append(error.code, error.file, error.line);
+  }
+
+  /// Forget all recorded errors.
+  void Clear()
+  {
+    magic_ = kMagic;
+    total_ = 0;
+  }
+
+  /// @return true - if the ring holds a valid history, rather than the
+  ///         garbage left in RAM after a power cycle.
+  bool IsIntact() const
+  {
+    return magic_ == kMagic;
+  }
+
+  /// @return size_t - number of errors held, at most kCapacity.
+  size_t Count() const
+  {
+    return IsIntact() ? std::min<size_t>(total_, kCapacity) : 0;
+  }
+
+  /// @return uint32_t - number of errors recorded since the ring was last
+  ///         cleared, including those that have been overwritten.
+  uint32_t GetTotal() const
+  {
+    return IsIntact() ? total_ : 0;
+  }
+
+  /// @param index - index of the error, where 0 is the oldest held. Must be
+  ///        less than Count().
+  /// @return const ErrorRecord_t& - the error.
+  const ErrorRecord_t & operator[](size_t index) const
+  {
+    const size_t kOldest = total_ - Count();
+    return records_[(kOldest + index) % kCapacity];
+  }
+
+  /// Print the errors held, oldest first.
+  void Print() const
+  {
+    for (size_t i = 0; i < Count(); i++)
+    {
+      const ErrorRecord_t & record = (*this)[i];
+      sjsu::log::Print("[{} us] {}({}):{}:{}\n",
+                       record.uptime,
+                       Stringify(static_cast<std::errc>(record.code)),
+                       record.code,
+                       record.file.data(),
+                       record.line);
+    }
+  }
+
+  /// Hexdump the ring, including its header, for when the records cannot be
+  /// trusted to print, such as from a fault handler.
+  void Dump()
+  {
+    debug::Hexdump(this, sizeof(*this));
+  }
+
+ private:
+  void Append(std::errc code, const char * file, uint32_t line)
+  {
+    const uint64_t kUptime = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(Uptime())
+            .count());
+
+    CriticalSection lock;
+    if (!IsIntact())
+    {
+      Clear();
+    }
+
+    ErrorRecord_t & record = records_[total_ % kCapacity];
+    record.uptime          = kUptime;
+    record.code            = static_cast<int32_t>(code);
+    record.line            = static_cast<uint16_t>(line);
+    CopyBasename(record.file, file);
+    total_++;
+  }
+
+  static void CopyBasename(std::array<char, ErrorRecord_t::kFileLength> & to,
+                           const char * path)
+  {
+    const char * basename = path;
+    for (const char * c = path; *c != '\0'; c++)
+    {
+      if (*c == '/' || *c == '\\')
+      {
+        basename = c + 1;
+      }
+    }
+
+    size_t i = 0;
+    for (; i < to.size() - 1 && basename[i] != '\0'; i++)
+    {
+      to[i] = basename[i];
+    }
+    to[i] = '\0';
+  }
+
+  // Members are left without initializers, so a SJ2_NO_INIT ring is not
+  // touched by the startup code.
+  uint32_t magic_;
+  uint32_t total_;
+  std::array<ErrorRecord_t, kCapacity> records_;
+};
+}  // namespace sjsu
@@ -0,0 +1,78 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/error_ring.hpp>
+
+#include <chrono>
+#include <string_view>
+
+namespace sjsu
+{
+TEST_CASE("Testing ErrorRing")
+{
+  // Setup
+  // Value initialize, as a global would be, instead of leaving garbage.
+  ErrorRing ring{};
+  SetUptimeFunction([]() -> std::chrono::nanoseconds { return 5ms; });
+
+  SECTION("Starts empty until it is intact")
+  {
+    // Verify
+    CHECK(!ring.IsIntact());
+    CHECK(0 == ring.Count());
+    CHECK(0 == ring.GetTotal());
+  }
+
+  SECTION("Record")
+  {
+    // Setup
+    const Exception kException(std::errc::io_error, "Bus fault.");
+
+    // Exercise
+    ring.Record(std::errc::timed_out);
+    ring.Record(kException);
+    ring.Record(Error_t(std::errc::bad_message));
+
+    // Verify
+    CHECK(ring.IsIntact());
+    REQUIRE(3 == ring.Count());
+    CHECK(static_cast<int>(std::errc::timed_out) == ring[0].code);
+    CHECK(static_cast<int>(std::errc::io_error) == ring[1].code);
+    CHECK(static_cast<int>(std::errc::bad_message) == ring[2].code);
+    CHECK(5'000 == ring[0].uptime);
+    CHECK(kException.GetLine() == ring[1].line);
+    // Only the basename is kept, and it is cut short to fit.
+    CHECK(std::string_view(ring[0].file.data()) == "error_ring.test.c");
+  }
+
+  SECTION("Overwrites the oldest once full")
+  {
+    // Exercise
+    for (size_t i = 0; i < ErrorRing::kCapacity + 2; i++)
+    {
+      ring.Record(i < 2 ? std::errc::io_error : std::errc::timed_out);
+    }
+
+    // Verify
+    CHECK(ErrorRing::kCapacity == ring.Count());
+    CHECK(ErrorRing::kCapacity + 2 == ring.GetTotal());
+    for (size_t i = 0; i < ring.Count(); i++)
+    {
+      CHECK(static_cast<int>(std::errc::timed_out) == ring[i].code);
+    }
+  }
+
+  SECTION("Clear")
+  {
+    // Setup
+    ring.Record(std::errc::timed_out);
+
+    // Exercise
+    ring.Clear();
+
+    // Verify
+    CHECK(ring.IsIntact());
+    CHECK(0 == ring.Count());
+  }
+
+  SetUptimeFunction(DefaultUptime);
+}
+}  // namespace sjsu
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <libcore/utility/inplace_function.hpp>
+
+namespace sjsu
+{
+/// Work posted to an EventQueue. Small enough to capture a pointer and a
+/// value, such as `[this, id]`.
+using DeferredWork = InplaceFunction<void(void), 2 * sizeof(void *)>;
+
+/// Fixed size, lock-free queue of work to run outside of interrupt context.
+///
+/// Interrupt service routines Post() a small piece of work and return, and the
+/// work is run later by Dispatch(), called from the main loop or from a low
+/// priority software interrupt. Any number of contexts may post, including
+/// interrupts that preempt each other, while a single context dispatches.
+///
+/// Each slot carries a sequence number, so a producer claims a slot with a
+/// single compare-and-swap and publishes it with a release store, without
+/// disabling interrupts. Requires a processor with atomic compare-and-swap,
+/// such as Cortex-M3 and above.
+///
+/// When the queue is full, Post() drops the work and counts an overflow.
+///
+/// @tparam kCapacity - number of slots. Must be a power of 2.
+template <size_t kCapacity>
+class EventQueue
+{
+ public:
+  static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                "EventQueue capacity must be a power of 2.");
+
+  EventQueue()
+  {
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  EventQueue(const EventQueue &) = delete;
+  EventQueue & operator=(const EventQueue &) = delete;
+
+  /// Add work to the end of the queue. Safe to call from any context.
+  ///
+  /// @param work - work to run from Dispatch().
+  /// @return true - if the work was queued, false if the queue was full.
+  bool Post(const DeferredWork & work)
+  {
+    size_t position = write_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+      Slot_t & slot = slots_[position & kMask];
+      const intptr_t kDifference =
+          static_cast<intptr_t>(slot.sequence.load(std::memory_order_acquire)) -
+          static_cast<intptr_t>(position);
+
+      if (kDifference == 0)
+      {
+        if (write_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed))
+        {
+          slot.work = work;
+          slot.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (kDifference < 0)
+      {
+        overflows_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      else
+      {
+        position = write_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Run the work at the front of the queue. Must only be called from one
+  /// context.
+  ///
+  /// @return true - if work was run, false if the queue was empty.
+  bool DispatchOne()
+  {
+    Slot_t & slot         = slots_[read_ & kMask];
+    const size_t kPublish = read_ + 1;
+
+    if (slot.sequence.load(std::memory_order_acquire) != kPublish)
+    {
+      return false;
+    }
+
+    DeferredWork work = slot.work;
+    slot.work         = nullptr;
+    slot.sequence.store(read_ + kCapacity, std::memory_order_release);
+    read_++;
+
+    work();
+    return true;
+  }
+
+  /// Run queued work until the queue is empty or `limit` pieces of work have
+  /// been run. Must only be called from one context.
+  ///
+  /// @param limit - maximum number of pieces of work to run.
+  /// @return size_t - number of pieces of work run.
+  size_t Dispatch(size_t limit = SIZE_MAX)
+  {
+    size_t dispatched = 0;
+    while (dispatched < limit && DispatchOne())
+    {
+      dispatched++;
+    }
+    return dispatched;
+  }
+
+  /// @return size_t - number of pieces of work waiting, approximate while
+  ///         other contexts are posting.
+  size_t Size() const
+  {
+    return write_.load(std::memory_order_relaxed) - read_;
+  }
+
+  /// @return uint32_t - number of pieces of work dropped because the queue
+  ///         was full.
+  uint32_t Overflows() const
+  {
+    return overflows_.load(std::memory_order_relaxed);
+  }
+
+  /// Reset the overflow count to zero.
+  void ResetOverflows()
+  {
+    overflows_.store(0, std::memory_order_relaxed);
+  }
+
+  /// @return constexpr size_t - number of slots.
+  constexpr size_t Capacity() const
+  {
+    return kCapacity;
+  }
+
+ private:
+  static constexpr size_t kMask = kCapacity - 1;
+
+  struct Slot_t
+  {
+    std::atomic<size_t> sequence;
+    DeferredWork work;
+  };
+
+  std::array<Slot_t, kCapacity> slots_;
+  std::atomic<size_t> write_       = 0;
+  size_t read_                     = 0;
+  std::atomic<uint32_t> overflows_ = 0;
+};
+
+/// A set of EventQueues, one per priority, dispatched highest priority first.
+///
+/// USAGE:
+///
+///    sjsu::EventDispatcher<16, 2> events;
+///
+///    // Within the CAN receive interrupt, keep only the urgent part.
+///    can.settings.handler = [&events, &network](sjsu::Can & can) {
+///      events.Post(0, [&network, &can]() { network.ReceiveHandler(can); });
+///    };
+///
+///    // Within the main loop, or a low priority software interrupt.
+///    events.Dispatch();
+///
+/// @tparam kCapacity - number of slots of each priority's queue. Must be a
+///         power of 2.
+/// @tparam kPriorities - number of priorities. Priority 0 is the highest.
+template <size_t kCapacity, size_t kPriorities = 2>
+class EventDispatcher
+{
+ public:
+  static_assert(kPriorities > 0, "EventDispatcher needs a priority.");
+
+  /// Add work to the queue of a priority. Safe to call from any context.
+  ///
+  /// @param priority - priority of the work, 0 is the highest. Values beyond
+  ///        the lowest priority are treated as the lowest priority.
+  /// @param work - work to run from Dispatch().
+  /// @return true - if the work was queued, false if that priority's queue
+  ///         was full.
+  bool Post(size_t priority, const DeferredWork & work)
+  {
+    return Queue(priority).Post(work);
+  }
+
+  /// Run queued work, always choosing the highest priority work waiting,
+  /// until every queue is empty or `limit` pieces of work have been run.
+  /// Must only be called from one context.
+  ///
+  /// @param limit - maximum number of pieces of work to run.
+  /// @return size_t - number of pieces of work run.
+  size_t Dispatch(size_t limit = SIZE_MAX)
+  {
+    size_t dispatched = 0;
+
+    while (dispatched < limit && DispatchHighest())
+    {
+      dispatched++;
+    }
+
+    return dispatched;
+  }
+
+  /// @param priority - priority of the queue.
+  /// @return uint32_t - number of pieces of work of that priority dropped
+  ///         because its queue was full.
+  uint32_t Overflows(size_t priority) const
+  {
+    return queues_[std::min(priority, kPriorities - 1)].Overflows();
+  }
+
+  /// @return size_t - number of pieces of work waiting across every priority.
+  size_t Size() const
+  {
+    size_t size = 0;
+    for (const auto & queue : queues_)
+    {
+      size += queue.Size();
+    }
+    return size;
+  }
+
+ private:
+  EventQueue<kCapacity> & Queue(size_t priority)
+  {
+    return queues_[std::min(priority, kPriorities - 1)];
+  }
+
+  bool DispatchHighest()
+  {
+    for (auto & queue : queues_)
+    {
+      if (queue.DispatchOne())
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::array<EventQueue<kCapacity>, kPriorities> queues_;
+};
+}  // namespace sjsu
@@ -0,0 +1,112 @@
+#include <libcore/utility/event_queue.hpp>
+
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing EventQueue")
+{
+  EventQueue<4> test_subject;
+  std::vector<int> log;
+
+  SECTION("Dispatch() runs work in the order it was posted")
+  {
+    // Setup
+    CHECK(test_subject.Post([&log]() { log.push_back(1); }));
+    CHECK(test_subject.Post([&log]() { log.push_back(2); }));
+
+    // Exercise
+    size_t dispatched = test_subject.Dispatch();
+
+    // Verify
+    CHECK(2 == dispatched);
+    CHECK(std::vector<int>{ 1, 2 } == log);
+    CHECK(0 == test_subject.Size());
+  }
+
+  SECTION("Full queue drops work and counts overflows")
+  {
+    // Setup
+    for (int i = 0; i < 4; i++)
+    {
+      REQUIRE(test_subject.Post([&log, i]() { log.push_back(i); }));
+    }
+
+    // Exercise
+    bool posted = test_subject.Post([&log]() { log.push_back(99); });
+    test_subject.Dispatch(3);
+
+    // Verify
+    CHECK(!posted);
+    CHECK(1 == test_subject.Overflows());
+    CHECK(std::vector<int>{ 0, 1, 2 } == log);
+    CHECK(1 == test_subject.Size());
+  }
+
+  SECTION("Slots are reused after wrapping around")
+  {
+    // Exercise
+    for (int i = 0; i < 10; i++)
+    {
+      REQUIRE(test_subject.Post([&log, i]() { log.push_back(i); }));
+      REQUIRE(test_subject.DispatchOne());
+    }
+
+    // Verify
+    CHECK(10 == log.size());
+    CHECK(9 == log.back());
+    CHECK(!test_subject.DispatchOne());
+    CHECK(0 == test_subject.Overflows());
+  }
+
+  SECTION("Work may post more work")
+  {
+    // Setup
+    test_subject.Post(
+        [&log, this_queue = &test_subject]()
+        {
+          log.push_back(1);
+          this_queue->Post([&log]() { log.push_back(2); });
+        });
+
+    // Exercise
+    test_subject.Dispatch();
+
+    // Verify
+    CHECK(std::vector<int>{ 1, 2 } == log);
+  }
+}
+
+TEST_CASE("Testing EventDispatcher")
+{
+  EventDispatcher<2, 3> test_subject;
+  std::vector<int> log;
+
+  SECTION("Higher priorities are dispatched first")
+  {
+    // Setup
+    test_subject.Post(2, [&log]() { log.push_back(20); });
+    test_subject.Post(1, [&log]() { log.push_back(10); });
+    test_subject.Post(
+        2,
+        [&log, this_dispatcher = &test_subject]()
+        {
+          log.push_back(21);
+          this_dispatcher->Post(0, [&log]() { log.push_back(0); });
+        });
+    test_subject.Post(2, [&log]() { log.push_back(22); });
+
+    // Exercise
+    size_t dispatched = test_subject.Dispatch();
+
+    // Verify
+    CHECK(4 == dispatched);
+    CHECK(std::vector<int>{ 10, 20, 21, 0 } == log);
+    CHECK(1 == test_subject.Overflows(2));
+    CHECK(0 == test_subject.Overflows(0));
+    CHECK(0 == test_subject.Size());
+  }
+}
+}  // namespace sjsu
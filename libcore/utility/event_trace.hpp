@@ -0,0 +1,289 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string_view>
+
+#include <libcore/utility/time/cycle_counter.hpp>
+
+/// Set to 1 to compile in the trace points marked with SJ2_TRACE_SCOPE() and
+/// SJ2_TRACE_MARKER(), including those in Module::Initialize(),
+/// I2c transactions and InstrumentedInterruptController. When 0, the macros
+/// expand to nothing.
+#ifndef SJ2_EVENT_TRACING
+#define SJ2_EVENT_TRACING 0
+#endif
+
+namespace sjsu::trace
+{
+/// Kind of a trace event.
+enum class Type : uint8_t
+{
+  /// Start of a span of time, such as an interrupt handler being entered.
+  kBegin,
+  /// End of the most recent span that has not ended.
+  kEnd,
+  /// A single point in time.
+  kMarker,
+};
+
+/// A trace event, as stored in an EventBuffer.
+struct Event_t
+{
+  /// CycleCounter count when the event happened.
+  uint32_t timestamp;
+  /// Value recorded with the event, such as an interrupt request number or an
+  /// I2C address.
+  uint32_t argument;
+  /// Name of the event. Must be a string with static storage duration.
+  const char * name;
+  /// Kind of event.
+  Type type;
+};
+
+/// Fixed size record of the most recent trace events, kept in RAM, for
+/// seeing how interrupt handlers, the main loop and bus transactions
+/// interleave.
+///
+/// Recording an event costs one atomic increment, a CycleCounter read and
+/// a few stores, and is safe from any context, including interrupts. When the
+/// buffer is full, the oldest events are overwritten, so the buffer always
+/// holds the events leading up to the moment it is read. Stop recording before
+/// exporting, so that events are not overwritten while they are read.
+///
+/// Requires lock-free 32-bit atomics, which excludes ARMv6-M (Cortex-M0/M0+)
+/// targets.
+///
+/// Use StaticEventBuffer to allocate the storage statically.
+class EventBuffer
+{
+ public:
+  /// @param storage - memory for the events. Its size must be a power of 2.
+  ///        Must outlive this object.
+  explicit EventBuffer(std::span<Event_t> storage) : storage_(storage) {}
+
+  EventBuffer(const EventBuffer &) = delete;
+  EventBuffer & operator=(const EventBuffer &) = delete;
+
+  /// Record an event now.
+  ///
+  /// @param type - kind of event.
+  /// @param name - name of the event, with static storage duration.
+  /// @param argument - value recorded with the event.
+  void Record(Type type, const char * name, uint32_t argument = 0)
+  {
+    const uint32_t kIndex = next_.fetch_add(1, std::memory_order_relaxed);
+    Event_t & event       = storage_[kIndex & (storage_.size() - 1)];
+
+    event.timestamp = CycleCounter::Read();
+    event.argument  = argument;
+    event.name      = name;
+    event.type      = type;
+  }
+
+  /// @return size_t - number of events held, at most the capacity.
+  size_t Size() const
+  {
+    return std::min<size_t>(next_.load(std::memory_order_relaxed),
+                            storage_.size());
+  }
+
+  /// @return uint32_t - number of events recorded since the last Clear(),
+  ///         including those that have been overwritten.
+  uint32_t Recorded() const
+  {
+    return next_.load(std::memory_order_relaxed);
+  }
+
+  /// Discard every event.
+  void Clear()
+  {
+    next_.store(0, std::memory_order_relaxed);
+  }
+
+  /// Call `callback` with each event held, oldest first.
+  ///
+  /// @param callback - callable with the signature `void(const Event_t &)`.
+  template <typename Callback>
+  void ForEach(Callback && callback) const
+  {
+    const uint32_t kNext = next_.load(std::memory_order_relaxed);
+    for (uint32_t i = kNext - static_cast<uint32_t>(Size()); i != kNext; i++)
+    {
+      callback(storage_[i & (storage_.size() - 1)]);
+    }
+  }
+
+  /// Write the events held as a JSON array in the Trace Event Format, which
+  /// can be loaded into Perfetto (ui.perfetto.dev) or chrome://tracing to be
+  /// viewed as a timeline. Timestamps are in microseconds from the oldest
+  /// event.
+  ///
+  /// @param writer - callable with the signature `void(std::string_view)`,
+  ///        called with the JSON a piece at a time.
+  /// @param counts_per_microsecond - rate of the CycleCounter: the CPU clock
+  ///        in MHz, or 1000 on platforms where it counts nanoseconds.
+  template <typename Writer>
+  void ExportJson(Writer && writer,
+                  uint32_t counts_per_microsecond =
+                      CycleCounter::kCountsCycles ? 1 : 1000) const
+  {
+    constexpr const char * kPhase[] = { "B", "E", "i" };
+
+    uint64_t elapsed  = 0;
+    uint32_t previous = 0;
+    bool first        = true;
+
+    writer("[\n");
+    ForEach([&](const Event_t & event) {
+      if (!first)
+      {
+        // Events can be stored slightly out of order when an interrupt
+        // records one between another context reading the CycleCounter and
+        // storing its event, so the difference is signed. Accumulating the
+        // differences also undoes the counter wrapping around.
+        elapsed += static_cast<int32_t>(event.timestamp - previous);
+      }
+      previous = event.timestamp;
+
+      std::array<char, 192> line;
+      int length = snprintf(
+          line.data(),
+          line.size(),
+          "%s{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%" PRIu64 ".%03" PRIu64
+          ",\"pid\":0,\"tid\":0%s,\"args\":{\"argument\":%" PRIu32 "}}",
+          first ? "" : ",\n",
+          event.name,
+          kPhase[static_cast<size_t>(event.type)],
+          elapsed / counts_per_microsecond,
+          (elapsed % counts_per_microsecond) * 1000 / counts_per_microsecond,
+          (event.type == Type::kMarker) ? ",\"s\":\"t\"" : "",
+          event.argument);
+      writer(std::string_view(
+          line.data(), std::min<size_t>(length, line.size() - 1)));
+      first = false;
+    });
+    writer("\n]\n");
+  }
+
+ private:
+  std::span<Event_t> storage_;
+  std::atomic<uint32_t> next_ = 0;
+};
+
+/// An EventBuffer with its own storage.
+///
+/// @tparam kCapacity - number of events held. Must be a power of 2.
+template <size_t kCapacity>
+class StaticEventBuffer : public EventBuffer
+{
+ public:
+  static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                "Capacity must be a power of 2.");
+
+  StaticEventBuffer() : EventBuffer(storage_) {}
+
+ private:
+  std::array<Event_t, kCapacity> storage_ = {};
+};
+
+/// Buffer that Record() stores events into, nullptr when not recording.
+inline EventBuffer * active_buffer = nullptr;
+
+/// Start recording events into `buffer`. Call sjsu::CycleCounter::Enable()
+/// once at startup for the timestamps to count.
+///
+/// @param buffer - buffer to record into. Must outlive its use here.
+inline void Start(EventBuffer & buffer)
+{
+  active_buffer = &buffer;
+}
+
+/// Stop recording events.
+inline void Stop()
+{
+  active_buffer = nullptr;
+}
+
+/// Record an event into the active buffer, if there is one.
+///
+/// @param type - kind of event.
+/// @param name - name of the event, with static storage duration.
+/// @param argument - value recorded with the event.
+inline void Record(Type type, const char * name, uint32_t argument = 0)
+{
+  EventBuffer * buffer = active_buffer;
+  if (buffer != nullptr)
+  {
+    buffer->Record(type, name, argument);
+  }
+}
+
+/// Record a single point in time.
+///
+/// @param name - name of the event, with static storage duration.
+/// @param argument - value recorded with the event.
+inline void Marker(const char * name, uint32_t argument = 0)
+{
+  Record(Type::kMarker, name, argument);
+}
+
+/// Records a span from its construction to its destruction.
+class Scope
+{
+ public:
+  /// @param name - name of the span, with static storage duration.
+  /// @param argument - value recorded with both ends of the span.
+  explicit Scope(const char * name, uint32_t argument = 0)
+      : name_(name), argument_(argument)
+  {
+    Record(Type::kBegin, name_, argument_);
+  }
+
+  Scope(const Scope &) = delete;
+  Scope & operator=(const Scope &) = delete;
+
+  ~Scope()
+  {
+    Record(Type::kEnd, name_, argument_);
+  }
+
+ private:
+  const char * name_;
+  uint32_t argument_;
+};
+}  // namespace sjsu::trace
+
+#define SJ2_TRACE_CONCAT_HELPER(a, b) a##b
+#define SJ2_TRACE_CONCAT(a, b) SJ2_TRACE_CONCAT_HELPER(a, b)
+
+#if SJ2_EVENT_TRACING
+/// Trace the rest of the enclosing scope as a span named `name`, recorded with
+/// `argument`. Compiles to nothing unless SJ2_EVENT_TRACING is 1. At most one
+/// use per line.
+///
+/// Usage:
+///
+///    void Controller::Update()
+///    {
+///      SJ2_TRACE_SCOPE("Controller::Update", 0);
+///      ...
+///    }
+#define SJ2_TRACE_SCOPE(name, argument)                          \
+  ::sjsu::trace::Scope SJ2_TRACE_CONCAT(sj2_trace_scope, __LINE__)( \
+      name, static_cast<uint32_t>(argument))
+
+/// Trace a single point in time named `name`, recorded with `argument`.
+/// Compiles to nothing unless SJ2_EVENT_TRACING is 1.
+#define SJ2_TRACE_MARKER(name, argument) \
+  ::sjsu::trace::Marker(name, static_cast<uint32_t>(argument))
+#else
+#define SJ2_TRACE_SCOPE(name, argument) static_cast<void>(0)
+#define SJ2_TRACE_MARKER(name, argument) static_cast<void>(0)
+#endif
@@ -0,0 +1,92 @@
+#include <libcore/utility/event_trace.hpp>
+
+#include <string>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing event trace")
+{
+  trace::StaticEventBuffer<4> buffer;
+
+  SECTION("Events are only recorded while started")
+  {
+    // Exercise
+    trace::Marker("before");
+    trace::Start(buffer);
+    {
+      trace::Scope scope("scope", 7);
+      trace::Marker("inside", 1);
+    }
+    trace::Stop();
+    trace::Marker("after");
+
+    // Verify
+    std::vector<std::string> names;
+    std::vector<trace::Type> types;
+    buffer.ForEach([&](const trace::Event_t & event) {
+      names.push_back(event.name);
+      types.push_back(event.type);
+    });
+
+    CHECK(std::vector<std::string>{ "scope", "inside", "scope" } == names);
+    CHECK(std::vector<trace::Type>{ trace::Type::kBegin,
+                                    trace::Type::kMarker,
+                                    trace::Type::kEnd } == types);
+  }
+
+  SECTION("Oldest events are overwritten when full")
+  {
+    // Exercise
+    for (uint32_t i = 0; i < 6; i++)
+    {
+      buffer.Record(trace::Type::kMarker, "marker", i);
+    }
+
+    // Verify
+    std::vector<uint32_t> arguments;
+    buffer.ForEach([&arguments](const trace::Event_t & event) {
+      arguments.push_back(event.argument);
+    });
+
+    CHECK(4 == buffer.Size());
+    CHECK(6 == buffer.Recorded());
+    CHECK(std::vector<uint32_t>{ 2, 3, 4, 5 } == arguments);
+  }
+
+  SECTION("Clear() discards every event")
+  {
+    // Setup
+    buffer.Record(trace::Type::kMarker, "marker");
+
+    // Exercise
+    buffer.Clear();
+
+    // Verify
+    CHECK(0 == buffer.Size());
+  }
+
+  SECTION("ExportJson() writes the Trace Event Format")
+  {
+    // Setup
+    buffer.Record(trace::Type::kBegin, "I2c::Transaction", 0x48);
+    buffer.Record(trace::Type::kMarker, "marker", 1);
+    buffer.Record(trace::Type::kEnd, "I2c::Transaction", 0x48);
+    std::string json;
+
+    // Exercise
+    buffer.ExportJson([&json](std::string_view text) { json.append(text); });
+
+    // Verify
+    CHECK(json.starts_with("[\n{\"name\":\"I2c::Transaction\",\"ph\":\"B\","
+                           "\"ts\":0.000,\"pid\":0,\"tid\":0,"
+                           "\"args\":{\"argument\":72}},\n"));
+    CHECK(json.find("\"ph\":\"i\"") != std::string::npos);
+    CHECK(json.find(",\"s\":\"t\",") != std::string::npos);
+    CHECK(json.find("\"ph\":\"E\"") != std::string::npos);
+    CHECK(json.ends_with("}}\n]\n"));
+  }
+}
+}  // namespace sjsu
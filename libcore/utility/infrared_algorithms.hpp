@@ -1,6 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <tuple>
+
 #include <libcore/utility/math/bit.hpp>
 #include <libcore/utility/math/units.hpp>
 
@@ -64,6 +68,40 @@ inline bool IsDurationWithinTolerance(
   return (min <= duration) && (duration <= max);
 }
 
+/// The range of durations, in microseconds, accepted as an expected duration.
+/// Computing the range once, at compile time for constant configurations,
+/// makes checking a duration two integer comparisons.
+struct DurationRange_t
+{
+  /// Shortest accepted duration.
+  uint16_t min = 0;
+  /// Longest accepted duration.
+  uint16_t max = 0;
+
+  /// @param expected_duration - the expected duration.
+  /// @param tolerance - the acceptable tolerance percentage.
+  /// @return constexpr DurationRange_t - the durations that
+  ///         IsDurationWithinTolerance() accepts.
+  static constexpr DurationRange_t From(
+      std::chrono::microseconds expected_duration,
+      float tolerance)
+  {
+    return {
+      .min = static_cast<uint16_t>(
+          static_cast<float>(expected_duration.count()) * (1.0f - tolerance)),
+      .max = static_cast<uint16_t>(
+          static_cast<float>(expected_duration.count()) * (1.0f + tolerance)),
+    };
+  }
+
+  /// @param duration - the duration, in microseconds, to check.
+  /// @return true - if the duration is within the range.
+  constexpr bool Contains(uint16_t duration) const
+  {
+    return (min <= duration) && (duration <= max);
+  }
+};
+
 // ==================================
 // Pulse Duration Modulation Decoding
 // ==================================
@@ -117,6 +155,636 @@ struct PulseDurationConfiguration_t
   std::chrono::microseconds header_repeat_space = 0us;
 };
 
+/// A pulse duration modulation protocol with the accepted range of each of
+/// its durations precomputed, for decoding without floating point math.
+struct PulseDurationProtocol_t
+{
+  /// Accepted durations of the header mark.
+  DurationRange_t header_mark;
+  /// Accepted durations of the header space.
+  DurationRange_t header_space;
+  /// Accepted durations of the header space of a repeat frame.
+  DurationRange_t header_repeat_space;
+  /// Accepted durations of the fixed duration of a data pulse.
+  DurationRange_t data;
+  /// Accepted durations for a logical high data pulse.
+  DurationRange_t logic_high;
+  /// Accepted durations for a logical low data pulse.
+  DurationRange_t logic_low;
+  /// The pulse duration encoding type.
+  PulseDurationType encoding_type;
+  /// True if the encoding uses repeat frames.
+  bool uses_repeat_frames;
+  /// Number of data bits in a frame, from 1 to 32.
+  uint8_t bits;
+  /// True if the least significant bit is sent first, as with Sony SIRC.
+  bool lsb_first;
+
+  /// @param configuration - the durations and tolerance of the protocol.
+  /// @param bits - number of data bits in a frame, from 1 to 32.
+  /// @param lsb_first - true if the least significant bit is sent first.
+  /// @return constexpr PulseDurationProtocol_t - the protocol with the
+  ///         ranges of its durations computed.
+  static constexpr PulseDurationProtocol_t From(
+      const PulseDurationConfiguration_t & configuration,
+      uint8_t bits,
+      bool lsb_first = false)
+  {
+    const float kTolerance = configuration.tolerance;
+    return {
+      .header_mark = DurationRange_t::From(configuration.header_mark_duration,
+                                           kTolerance),
+      .header_space = DurationRange_t::From(
+          configuration.header_space_duration, kTolerance),
+      .header_repeat_space = DurationRange_t::From(
+          configuration.header_repeat_space, kTolerance),
+      .data = DurationRange_t::From(configuration.data_duration, kTolerance),
+      .logic_high =
+          DurationRange_t::From(configuration.logic_high_duration, kTolerance),
+      .logic_low =
+          DurationRange_t::From(configuration.logic_low_duration, kTolerance),
+      .encoding_type      = configuration.encoding_type,
+      .uses_repeat_frames = configuration.uses_repeat_frames,
+      .bits               = bits,
+      .lsb_first          = lsb_first,
+    };
+  }
+};
+
+/// Precomputed tables of common pulse duration protocols.
+namespace protocols
+{
+/// NEC: 32 bits, logic level in the space, with repeat frames.
+inline constexpr PulseDurationProtocol_t kNec = PulseDurationProtocol_t::From(
+    {
+        .header_mark_duration  = 9000us,
+        .header_space_duration = 4500us,
+        .data_duration         = 562us,
+        .logic_high_duration   = 1687us,
+        .logic_low_duration    = 562us,
+        .encoding_type         = PulseDurationType::kDistance,
+        .tolerance             = 0.25f,
+        .uses_repeat_frames    = true,
+        .header_repeat_space   = 2250us,
+    },
+    32);
+
+/// Samsung: 32 bits, logic level in the space.
+inline constexpr PulseDurationProtocol_t kSamsung =
+    PulseDurationProtocol_t::From(
+        {
+            .header_mark_duration  = 4500us,
+            .header_space_duration = 4500us,
+            .data_duration         = 560us,
+            .logic_high_duration   = 1690us,
+            .logic_low_duration    = 560us,
+            .encoding_type         = PulseDurationType::kDistance,
+            .tolerance             = 0.25f,
+        },
+        32);
+
+/// JVC: 16 bits, logic level in the space. Repeat frames have no header, so
+/// only the first frame is decoded.
+inline constexpr PulseDurationProtocol_t kJvc = PulseDurationProtocol_t::From(
+    {
+        .header_mark_duration  = 8400us,
+        .header_space_duration = 4200us,
+        .data_duration         = 526us,
+        .logic_high_duration   = 1574us,
+        .logic_low_duration    = 526us,
+        .encoding_type         = PulseDurationType::kDistance,
+        .tolerance             = 0.25f,
+    },
+    16);
+
+/// Sony SIRC: 12 bits, least significant first, logic level in the mark.
+inline constexpr PulseDurationProtocol_t kSony12 =
+    PulseDurationProtocol_t::From(
+        {
+            .header_mark_duration  = 2400us,
+            .header_space_duration = 600us,
+            .data_duration         = 600us,
+            .logic_high_duration   = 1200us,
+            .logic_low_duration    = 600us,
+            .encoding_type         = PulseDurationType::kLength,
+            .tolerance             = 0.25f,
+        },
+        12,
+        true);
+}  // namespace protocols
+
+/// Progress of a streaming decoder.
+enum class DecodeStatus : uint8_t
+{
+  /// The pulses so far are valid, and more are needed.
+  kInProgress,
+  /// A frame has been decoded.
+  kComplete,
+  /// The pulses do not form a frame of the protocol.
+  kError,
+};
+
+/// Decodes a pulse duration modulated frame one pulse at a time, as each
+/// pulse is captured, for example from the capture interrupt of a receiver.
+/// The frame is decoded as soon as its last data pulse arrives, rather than
+/// after the whole frame has been buffered.
+///
+/// Every check is an integer comparison against the precomputed ranges of a
+/// PulseDurationProtocol_t.
+///
+/// USAGE:
+///
+///    sjsu::infrared::PulseDurationDecoder decoder(
+///        sjsu::infrared::protocols::kNec);
+///
+///    void OnPulse(uint16_t duration, size_t index)
+///    {
+///      if (index == 0)
+///      {
+///        decoder.Reset();
+///      }
+///      if (decoder.Push(duration) == sjsu::infrared::DecodeStatus::kComplete)
+///      {
+///        Handle(decoder.Result());
+///      }
+///    }
+class PulseDurationDecoder
+{
+ public:
+  /// @param protocol - the protocol to decode. Must outlive the decoder.
+  constexpr explicit PulseDurationDecoder(
+      const PulseDurationProtocol_t & protocol)
+      : protocol_(&protocol)
+  {
+  }
+
+  /// Decode the next pulse of the frame.
+  ///
+  /// @param duration - the duration of the pulse in microseconds, starting
+  ///        with the header mark and alternating between marks and spaces.
+  /// @return DecodeStatus - the status after the pulse. Once complete or
+  ///         failed, further pulses are ignored until Reset().
+  constexpr DecodeStatus Push(uint16_t duration)
+  {
+    if (status_ != DecodeStatus::kInProgress)
+    {
+      return status_;
+    }
+
+    const size_t kPulse = pulses_++;
+    if (kPulse == 0)
+    {
+      return Check(protocol_->header_mark.Contains(duration));
+    }
+
+    if (kPulse == 1)
+    {
+      repeat_ = protocol_->uses_repeat_frames &&
+                protocol_->header_repeat_space.Contains(duration);
+      return Check(repeat_ || protocol_->header_space.Contains(duration));
+    }
+
+    // A repeat frame ends with its stop mark.
+    if (repeat_)
+    {
+      status_ = protocol_->data.Contains(duration) ? DecodeStatus::kComplete
+                                                   : DecodeStatus::kError;
+      return status_;
+    }
+
+    return DataPulse(kPulse, duration);
+  }
+
+  /// @return DecodedFrame_t - the frame decoded so far. Valid once Push()
+  ///         returned kComplete.
+  constexpr DecodedFrame_t Result() const
+  {
+    return {
+      .data      = data_,
+      .is_valid  = status_ == DecodeStatus::kComplete,
+      .is_repeat = status_ == DecodeStatus::kComplete && repeat_,
+    };
+  }
+
+  /// Start decoding a new frame.
+  constexpr void Reset()
+  {
+    status_ = DecodeStatus::kInProgress;
+    pulses_ = 0;
+    data_   = 0;
+    repeat_ = false;
+  }
+
+ private:
+  constexpr DecodeStatus Check(bool valid)
+  {
+    status_ = valid ? DecodeStatus::kInProgress : DecodeStatus::kError;
+    return status_;
+  }
+
+  constexpr DecodeStatus DataPulse(size_t pulse, uint16_t duration)
+  {
+    // Data pulses are pairs of a mark and a space, after the header. One of
+    // each pair has a fixed duration, the other holds the logic level.
+    const bool kIsMark  = (pulse % 2) == 0;
+    const bool kIsFixed = kIsMark == (protocol_->encoding_type ==
+                                      PulseDurationType::kDistance);
+    if (kIsFixed)
+    {
+      if (!protocol_->data.Contains(duration))
+      {
+        return status_ = DecodeStatus::kError;
+      }
+    }
+    else
+    {
+      const size_t kBit = (pulse - 2) / 2;
+      const uint32_t kPosition =
+          protocol_->lsb_first ? kBit : protocol_->bits - 1 - kBit;
+      if (protocol_->logic_high.Contains(duration))
+      {
+        data_ = sjsu::bit::Set(data_, kPosition);
+      }
+      else if (!protocol_->logic_low.Contains(duration))
+      {
+        return status_ = DecodeStatus::kError;
+      }
+    }
+
+    // The pulse holding the logic level of the last bit completes the frame.
+    // With pulse distance encoding, that is the space of the last pair. With
+    // pulse length encoding, it is the mark, as the space after it is only
+    // measured once the next frame starts.
+    const size_t kLastPulse =
+        (2 * size_t{ protocol_->bits }) +
+        ((protocol_->encoding_type == PulseDurationType::kDistance) ? 1 : 0);
+    if (pulse == kLastPulse)
+    {
+      return status_ = DecodeStatus::kComplete;
+    }
+    return DecodeStatus::kInProgress;
+  }
+
+  const PulseDurationProtocol_t * protocol_;
+  DecodeStatus status_ = DecodeStatus::kInProgress;
+  size_t pulses_       = 0;
+  uint32_t data_       = 0;
+  bool repeat_         = false;
+};
+
+/// A marker for BiphaseConfiguration_t::double_width_bit, when no bit is
+/// sent at twice the width of the others.
+inline constexpr uint8_t kNoDoubleWidthBit = 0xFF;
+
+/// The configuration of a bi-phase (Manchester) protocol, such as RC5 and RC6,
+/// where each bit is a transition in the middle of the bit time, split into
+/// two halves of opposite levels.
+struct BiphaseConfiguration_t
+{
+  /// The expected duration of half of a bit.
+  std::chrono::microseconds half_bit_duration;
+  /// The acceptable tolerance level in percentage of each duration.
+  float tolerance;
+  /// Number of bits in a frame, including start bits, from 1 to 32.
+  uint8_t bits;
+  /// True if a logical high is a mark followed by a space, as with RC6.
+  /// False if it is a space followed by a mark, as with RC5.
+  bool one_starts_with_mark;
+  /// The expected duration of the leader mark, or 0 if there is no leader.
+  /// Without a leader, the first half of the first bit must be a space, which
+  /// is not seen by the receiver.
+  std::chrono::microseconds header_mark_duration = 0us;
+  /// The expected duration of the leader space.
+  std::chrono::microseconds header_space_duration = 0us;
+  /// Index of a bit sent at twice the width of the others, such as the RC6
+  /// trailer bit, or kNoDoubleWidthBit.
+  uint8_t double_width_bit = kNoDoubleWidthBit;
+};
+
+/// A bi-phase protocol with the accepted range of each duration precomputed.
+struct BiphaseProtocol_t
+{
+  /// Accepted durations of the leader mark.
+  DurationRange_t header_mark;
+  /// Accepted durations of the leader space.
+  DurationRange_t header_space;
+  /// Accepted durations of 1 to 4 half bits, as consecutive halves of the
+  /// same level form a single pulse.
+  std::array<DurationRange_t, 4> half_bits;
+  /// True if the protocol starts with a leader.
+  bool has_header;
+  /// Number of bits in a frame.
+  uint8_t bits;
+  /// True if a logical high is a mark followed by a space.
+  bool one_starts_with_mark;
+  /// Index of the bit sent at twice the width of the others.
+  uint8_t double_width_bit;
+
+  /// @param configuration - the configuration of the protocol.
+  /// @return constexpr BiphaseProtocol_t - the protocol with the ranges of
+  ///         its durations computed.
+  static constexpr BiphaseProtocol_t From(
+      const BiphaseConfiguration_t & configuration)
+  {
+    const float kTolerance = configuration.tolerance;
+    const auto kHalf       = configuration.half_bit_duration;
+    return {
+      .header_mark = DurationRange_t::From(configuration.header_mark_duration,
+                                           kTolerance),
+      .header_space = DurationRange_t::From(
+          configuration.header_space_duration, kTolerance),
+      .half_bits = { {
+          DurationRange_t::From(kHalf, kTolerance),
+          DurationRange_t::From(kHalf * 2, kTolerance),
+          DurationRange_t::From(kHalf * 3, kTolerance),
+          DurationRange_t::From(kHalf * 4, kTolerance),
+      } },
+      .has_header           = configuration.header_mark_duration != 0us,
+      .bits                 = configuration.bits,
+      .one_starts_with_mark = configuration.one_starts_with_mark,
+      .double_width_bit     = configuration.double_width_bit,
+    };
+  }
+};
+
+namespace protocols
+{
+/// Philips RC5: 14 bits, the 2 start bits, toggle, 5 bits of address and 6
+/// bits of command, most significant first.
+inline constexpr BiphaseProtocol_t kRc5 = BiphaseProtocol_t::From({
+    .half_bit_duration    = 889us,
+    .tolerance            = 0.25f,
+    .bits                 = 14,
+    .one_starts_with_mark = false,
+});
+
+/// Philips RC6 mode 0: 21 bits after the leader, the start bit, 3 mode bits,
+/// the double width trailer (toggle) bit, 8 bits of address and 8 bits of
+/// command, most significant first.
+inline constexpr BiphaseProtocol_t kRc6 = BiphaseProtocol_t::From({
+    .half_bit_duration     = 444us,
+    .tolerance             = 0.25f,
+    .bits                  = 21,
+    .one_starts_with_mark  = true,
+    .header_mark_duration  = 2666us,
+    .header_space_duration = 889us,
+    .double_width_bit      = 4,
+});
+}  // namespace protocols
+
+/// Decodes a bi-phase frame one pulse at a time, like PulseDurationDecoder.
+///
+/// Each pulse is measured in half bits, with integer comparisons against the
+/// precomputed ranges of a BiphaseProtocol_t, then split into the halves of
+/// the bits it spans.
+class BiphaseDecoder
+{
+ public:
+  /// @param protocol - the protocol to decode. Must outlive the decoder.
+  constexpr explicit BiphaseDecoder(const BiphaseProtocol_t & protocol)
+      : protocol_(&protocol)
+  {
+  }
+
+  /// Decode the next pulse of the frame.
+  ///
+  /// @param duration - the duration of the pulse in microseconds, starting
+  ///        with the first mark and alternating between marks and spaces.
+  /// @return DecodeStatus - the status after the pulse. Once complete or
+  ///         failed, further pulses are ignored until Reset().
+  constexpr DecodeStatus Push(uint16_t duration)
+  {
+    if (status_ != DecodeStatus::kInProgress)
+    {
+      return status_;
+    }
+
+    const size_t kPulse = pulses_++;
+    const bool kIsMark  = (kPulse % 2) == 0;
+    if (protocol_->has_header && kPulse < 2)
+    {
+      const auto & kRange =
+          (kPulse == 0) ? protocol_->header_mark : protocol_->header_space;
+      status_ = kRange.Contains(duration) ? DecodeStatus::kInProgress
+                                          : DecodeStatus::kError;
+      return status_;
+    }
+    if (!protocol_->has_header && kPulse == 0)
+    {
+      // The first half of the first bit is a space, before the first edge.
+      AddHalf(false);
+    }
+
+    size_t halves = 0;
+    for (size_t i = 0; i < protocol_->half_bits.size(); i++)
+    {
+      if (protocol_->half_bits[i].Contains(duration))
+      {
+        halves = i + 1;
+        break;
+      }
+    }
+    if (halves == 0)
+    {
+      return status_ = DecodeStatus::kError;
+    }
+
+    while (halves > 0 && status_ == DecodeStatus::kInProgress)
+    {
+      const size_t kWidth = (bit_ == protocol_->double_width_bit) ? 2 : 1;
+      if (halves < kWidth)
+      {
+        return status_ = DecodeStatus::kError;
+      }
+      halves -= kWidth;
+      AddHalf(kIsMark);
+    }
+
+    // A last bit that starts with a mark ends with a space, which is only
+    // measured once the next frame starts.
+    if (status_ == DecodeStatus::kInProgress && has_first_half_ &&
+        first_half_is_mark_ && bit_ + 1 == protocol_->bits)
+    {
+      AddHalf(false);
+    }
+    return status_;
+  }
+
+  /// @return DecodedFrame_t - the frame decoded so far. Valid once Push()
+  ///         returned kComplete.
+  constexpr DecodedFrame_t Result() const
+  {
+    return {
+      .data      = data_,
+      .is_valid  = status_ == DecodeStatus::kComplete,
+      .is_repeat = false,
+    };
+  }
+
+  /// Start decoding a new frame.
+  constexpr void Reset()
+  {
+    status_         = DecodeStatus::kInProgress;
+    pulses_         = 0;
+    data_           = 0;
+    bit_            = 0;
+    has_first_half_ = false;
+  }
+
+ private:
+  constexpr void AddHalf(bool is_mark)
+  {
+    if (!has_first_half_)
+    {
+      first_half_is_mark_ = is_mark;
+      has_first_half_     = true;
+      return;
+    }
+
+    // Both halves of a bit have the same level, without a transition.
+    has_first_half_ = false;
+    if (is_mark == first_half_is_mark_)
+    {
+      status_ = DecodeStatus::kError;
+      return;
+    }
+
+    data_ <<= 1;
+    if (first_half_is_mark_ == protocol_->one_starts_with_mark)
+    {
+      data_ = sjsu::bit::Set(data_, 0);
+    }
+    if (++bit_ == protocol_->bits)
+    {
+      status_ = DecodeStatus::kComplete;
+    }
+  }
+
+  const BiphaseProtocol_t * protocol_;
+  DecodeStatus status_     = DecodeStatus::kInProgress;
+  size_t pulses_           = 0;
+  uint32_t data_           = 0;
+  size_t bit_              = 0;
+  bool has_first_half_     = false;
+  bool first_half_is_mark_ = false;
+};
+
+/// Runs several streaming decoders, such as PulseDurationDecoder and
+/// BiphaseDecoder, over the same pulses at once, and reports the first
+/// protocol to decode a frame. Every pulse is decoded once per protocol as it
+/// arrives, without scanning a buffer per protocol.
+///
+/// USAGE:
+///
+///    namespace protocols = sjsu::infrared::protocols;
+///    sjsu::infrared::MultiProtocolDecoder decoder(
+///        sjsu::infrared::PulseDurationDecoder(protocols::kNec),
+///        sjsu::infrared::PulseDurationDecoder(protocols::kSony12),
+///        sjsu::infrared::BiphaseDecoder(protocols::kRc5),
+///        sjsu::infrared::BiphaseDecoder(protocols::kRc6));
+///
+///    if (decoder.Push(duration) == sjsu::infrared::DecodeStatus::kComplete)
+///    {
+///      auto [protocol, frame] = decoder.Result();
+///    }
+///
+/// @tparam Decoders - streaming decoders, with Push(), Result() and Reset().
+template <typename... Decoders>
+class MultiProtocolDecoder
+{
+ public:
+  /// The protocol that decoded a frame, and the frame.
+  struct Match_t
+  {
+    /// Index of the protocol's decoder, in the order of the constructor.
+    size_t protocol;
+    /// The decoded frame.
+    DecodedFrame_t frame;
+  };
+
+  /// @param decoders - the decoders of each protocol, in order of priority
+  ///        when several decode the same pulses.
+  constexpr explicit MultiProtocolDecoder(Decoders... decoders)
+      : decoders_(decoders...)
+  {
+  }
+
+  /// Decode the next pulse with every protocol that still matches.
+  ///
+  /// @param duration - the duration of the pulse in microseconds.
+  /// @return DecodeStatus - kComplete once a protocol has decoded a frame,
+  ///         kError once no protocol matches. Further pulses are ignored
+  ///         until Reset().
+  constexpr DecodeStatus Push(uint16_t duration)
+  {
+    if (status_ != DecodeStatus::kInProgress)
+    {
+      return status_;
+    }
+
+    bool in_progress = false;
+    size_t index     = 0;
+    std::apply(
+        [&](auto &... decoder) {
+          (Step(decoder, duration, index++, in_progress), ...);
+        },
+        decoders_);
+
+    if (match_ != kNoMatch)
+    {
+      status_ = DecodeStatus::kComplete;
+    }
+    else if (!in_progress)
+    {
+      status_ = DecodeStatus::kError;
+    }
+    return status_;
+  }
+
+  /// @return Match_t - the protocol that decoded a frame and the frame. The
+  ///         frame is only valid once Push() returned kComplete.
+  constexpr Match_t Result() const
+  {
+    Match_t result = { .protocol = match_, .frame = {} };
+    size_t index   = 0;
+    std::apply(
+        [&](const auto &... decoder) {
+          ((index++ == match_ ? (result.frame = decoder.Result(), 0) : 0), ...);
+        },
+        decoders_);
+    return result;
+  }
+
+  /// Start decoding a new frame with every protocol.
+  constexpr void Reset()
+  {
+    std::apply([](auto &... decoder) { (decoder.Reset(), ...); }, decoders_);
+    status_ = DecodeStatus::kInProgress;
+    match_  = kNoMatch;
+  }
+
+ private:
+  static constexpr size_t kNoMatch = sizeof...(Decoders);
+
+  template <typename Decoder>
+  constexpr void Step(Decoder & decoder,
+                      uint16_t duration,
+                      size_t index,
+                      bool & in_progress)
+  {
+    const DecodeStatus kStatus = decoder.Push(duration);
+    if (kStatus == DecodeStatus::kComplete && match_ == kNoMatch)
+    {
+      match_ = index;
+    }
+    in_progress = in_progress || kStatus == DecodeStatus::kInProgress;
+  }
+
+  std::tuple<Decoders...> decoders_;
+  DecodeStatus status_ = DecodeStatus::kInProgress;
+  size_t match_        = kNoMatch;
+};
+
 /// Generic decoding function to decode data frames that is encoded using pulse
 /// duration modulation.
 ///
@@ -150,15 +818,15 @@ inline const DecodedFrame_t Decode(
   {
     return kInvalidFrame;
   }
+  // Compute the accepted range of each duration once, rather than per pulse.
+  const PulseDurationProtocol_t kProtocol =
+      PulseDurationProtocol_t::From(configurations, 32);
+
   // Validate the frame's header by checking the first two pulses
   const uint16_t kHeaderMark  = data_frame->pulse_buffer[0];
   const uint16_t kHeaderSpace = data_frame->pulse_buffer[1];
 
-  const bool kHeaderMarkIsValid =
-      IsDurationWithinTolerance(kHeaderMark,
-                                configurations.header_mark_duration,
-                                configurations.tolerance);
-  if (!kHeaderMarkIsValid)
+  if (!kProtocol.header_mark.Contains(kHeaderMark))
   {
     return kInvalidFrame;
   }
@@ -170,13 +838,8 @@ inline const DecodedFrame_t Decode(
       configurations.uses_repeat_frames)
   {
     const uint16_t kStopMark = data_frame->pulse_buffer[2];
-    const bool kRepeatSpaceValid =
-        IsDurationWithinTolerance(kHeaderSpace,
-                                  configurations.header_repeat_space,
-                                  configurations.tolerance);
-    const bool kStopMarkValid = IsDurationWithinTolerance(
-        kStopMark, configurations.data_duration, configurations.tolerance);
-    if (kRepeatSpaceValid && kStopMarkValid)
+    if (kProtocol.header_repeat_space.Contains(kHeaderSpace) &&
+        kProtocol.data.Contains(kStopMark))
     {
       return DecodedFrame_t({
           .data      = 0,
@@ -185,11 +848,7 @@ inline const DecodedFrame_t Decode(
       });
     }
   }
-  const bool kHeaderSpaceIsValid =
-      IsDurationWithinTolerance(kHeaderSpace,
-                                configurations.header_space_duration,
-                                configurations.tolerance);
-  if (!kHeaderSpaceIsValid)
+  if (!kProtocol.header_space.Contains(kHeaderSpace))
   {
     return kInvalidFrame;
   }
@@ -225,23 +884,17 @@ inline const DecodedFrame_t Decode(
         break;
     }
 
-    if (!IsDurationWithinTolerance(fixed_data_duration,
-                                   configurations.data_duration,
-                                   configurations.tolerance))
+    if (!kProtocol.data.Contains(fixed_data_duration))
     {
       return kInvalidFrame;
     }
 
     decoded_data <<= 1;
-    if (IsDurationWithinTolerance(duration_for_logic_level,
-                                  configurations.logic_high_duration,
-                                  configurations.tolerance))
+    if (kProtocol.logic_high.Contains(duration_for_logic_level))
     {
       decoded_data = sjsu::bit::Set(decoded_data, 0);
     }
-    else if (!IsDurationWithinTolerance(duration_for_logic_level,
-                                        configurations.logic_low_duration,
-                                        configurations.tolerance))
+    else if (!kProtocol.logic_low.Contains(duration_for_logic_level))
     {
       return kInvalidFrame;
     }
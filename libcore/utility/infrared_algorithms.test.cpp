@@ -1,3 +1,6 @@
+#include <utility>
+#include <vector>
+
 #include <libcore/testing/testing_frameworks.hpp>
 #include <libcore/utility/infrared_algorithms.hpp>
 
@@ -198,5 +201,289 @@ TEST_CASE("Testing Infrared Algorithms")
     }
   }
 }
+
+namespace
+{
+/// Pulses of a bi-phase frame, merging halves of the same level and dropping
+/// the spaces before the first mark and after the last mark.
+///
+/// @param bits - the bits of the frame, most significant first.
+/// @param count - number of bits.
+/// @param half - duration of half a bit.
+/// @param one_starts_with_mark - the logic level of a mark then a space.
+/// @param double_width_bit - index of the bit sent at twice the width.
+std::vector<uint16_t> BiphasePulses(uint32_t bits,
+                                    size_t count,
+                                    uint16_t half,
+                                    bool one_starts_with_mark,
+                                    size_t double_width_bit = 0xFF)
+{
+  // Levels and durations of each half bit, true for a mark.
+  std::vector<std::pair<bool, uint16_t>> halves;
+  for (size_t i = 0; i < count; i++)
+  {
+    const bool kOne  = (bits >> (count - 1 - i)) & 1;
+    const bool kMark = (kOne == one_starts_with_mark);
+    const uint16_t kDuration =
+        static_cast<uint16_t>((i == double_width_bit) ? half * 2 : half);
+    halves.push_back({ kMark, kDuration });
+    halves.push_back({ !kMark, kDuration });
+  }
+
+  std::vector<uint16_t> pulses;
+  bool level = false;
+  for (auto [is_mark, duration] : halves)
+  {
+    if (pulses.empty() && !is_mark)
+    {
+      continue;
+    }
+    if (!pulses.empty() && is_mark == level)
+    {
+      pulses.back() = static_cast<uint16_t>(pulses.back() + duration);
+    }
+    else
+    {
+      pulses.push_back(duration);
+    }
+    level = is_mark;
+  }
+  if (!level)
+  {
+    pulses.pop_back();
+  }
+  return pulses;
+}
+
+template <typename Decoder>
+DecodeStatus PushAll(Decoder & decoder, const std::vector<uint16_t> & pulses)
+{
+  DecodeStatus status = DecodeStatus::kInProgress;
+  for (auto pulse : pulses)
+  {
+    status = decoder.Push(pulse);
+  }
+  return status;
+}
+}  // namespace
+
+TEST_CASE("Testing PulseDurationDecoder")
+{
+  // Setup
+  // Pulses of an NEC frame of 0xA5, with 24 more bits of 0.
+  std::vector<uint16_t> pulses = { 9010, 4490 };
+  for (int bit = 31; bit >= 0; bit--)
+  {
+    const bool kHigh = (bit >= 24) && ((0xA5 >> (bit - 24)) & 1);
+    pulses.push_back(560);
+    pulses.push_back(kHigh ? 1690 : 565);
+  }
+  pulses.push_back(560);
+
+  PulseDurationDecoder decoder(protocols::kNec);
+
+  SECTION("Ranges are computed at compile time")
+  {
+    // Verify
+    static_assert(6750 == protocols::kNec.header_mark.min);
+    static_assert(11250 == protocols::kNec.header_mark.max);
+    CHECK(DurationRange_t::From(100us, 0.05f).Contains(97));
+  }
+
+  SECTION("Completes at the last data pulse")
+  {
+    // Exercise
+    DecodeStatus status = DecodeStatus::kInProgress;
+    size_t pushed       = 0;
+    while (status == DecodeStatus::kInProgress)
+    {
+      status = decoder.Push(pulses[pushed++]);
+    }
+
+    // Verify
+    CHECK(DecodeStatus::kComplete == status);
+    CHECK(pulses.size() - 1 == pushed);
+    CHECK(decoder.Result().is_valid);
+    CHECK(!decoder.Result().is_repeat);
+    CHECK(0xA500'0000 == decoder.Result().data);
+  }
+
+  SECTION("Repeat frames")
+  {
+    // Exercise
+    decoder.Push(9000);
+    decoder.Push(2250);
+    DecodeStatus status = decoder.Push(560);
+
+    // Verify
+    CHECK(DecodeStatus::kComplete == status);
+    CHECK(decoder.Result().is_repeat);
+  }
+
+  SECTION("Invalid pulses fail until reset")
+  {
+    // Setup
+    pulses[5] = 3000;
+
+    // Exercise
+    DecodeStatus status = DecodeStatus::kInProgress;
+    for (size_t i = 0; i < 8; i++)
+    {
+      status = decoder.Push(pulses[i]);
+    }
+    bool was_valid = decoder.Result().is_valid;
+    decoder.Reset();
+    DecodeStatus after_reset = decoder.Push(9000);
+
+    // Verify
+    CHECK(DecodeStatus::kError == status);
+    CHECK(!was_valid);
+    CHECK(DecodeStatus::kInProgress == after_reset);
+  }
+
+  SECTION("Pulse length encoding")
+  {
+    // Setup
+    constexpr auto kProtocol = PulseDurationProtocol_t::From(
+        {
+            .header_mark_duration  = 2400us,
+            .header_space_duration = 600us,
+            .data_duration         = 600us,
+            .logic_high_duration   = 1200us,
+            .logic_low_duration    = 600us,
+            .encoding_type         = PulseDurationType::kLength,
+            .tolerance             = 0.2f,
+        },
+        2);
+    PulseDurationDecoder length_decoder(kProtocol);
+
+    // Exercise
+    DecodeStatus status = DecodeStatus::kInProgress;
+    for (uint16_t pulse : { 2400, 600, 1200, 600, 600, 600 })
+    {
+      status = length_decoder.Push(pulse);
+    }
+
+    // Verify
+    CHECK(DecodeStatus::kComplete == status);
+    CHECK(0b10 == length_decoder.Result().data);
+  }
+}
+
+TEST_CASE("Testing BiphaseDecoder")
+{
+  SECTION("RC5")
+  {
+    // Setup
+    // Start bits 11, toggle 0, address 00101, command 110101 and the same
+    // frame ending in a 1.
+    constexpr uint32_t kFrame = 0b11'0'00101'110101;
+    BiphaseDecoder decoder(protocols::kRc5);
+
+    for (uint32_t frame : { kFrame, kFrame ^ 1 })
+    {
+      decoder.Reset();
+
+      // Exercise
+      DecodeStatus status =
+          PushAll(decoder, BiphasePulses(frame, 14, 889, false));
+
+      // Verify
+      CHECK(DecodeStatus::kComplete == status);
+      CHECK(frame == decoder.Result().data);
+    }
+  }
+
+  SECTION("RC6 with its double width trailer bit")
+  {
+    // Setup
+    // Start bit 1, mode 000, trailer 1, address 0x1D and command 0x5A.
+    constexpr uint32_t kFrame    = (0b1'000'1 << 16) | 0x1D5A;
+    std::vector<uint16_t> pulses = { 2666, 889 };
+    auto data                    = BiphasePulses(kFrame, 21, 444, true, 4);
+    pulses.insert(pulses.end(), data.begin(), data.end());
+    BiphaseDecoder decoder(protocols::kRc6);
+
+    // Exercise
+    DecodeStatus status = PushAll(decoder, pulses);
+
+    // Verify
+    CHECK(DecodeStatus::kComplete == status);
+    CHECK(kFrame == decoder.Result().data);
+  }
+
+  SECTION("Pulses that are not whole half bits fail")
+  {
+    // Setup
+    BiphaseDecoder decoder(protocols::kRc5);
+
+    // Exercise
+    DecodeStatus status = decoder.Push(1300);
+
+    // Verify
+    CHECK(DecodeStatus::kError == status);
+  }
+}
+
+TEST_CASE("Testing MultiProtocolDecoder")
+{
+  // Setup
+  MultiProtocolDecoder decoder(PulseDurationDecoder(protocols::kNec),
+                               PulseDurationDecoder(protocols::kSony12),
+                               BiphaseDecoder(protocols::kRc5),
+                               BiphaseDecoder(protocols::kRc6));
+
+  SECTION("Reports the protocol that decoded the frame")
+  {
+    // Setup
+    constexpr uint32_t kFrame = 0b11'1'10000'000011;
+
+    // Exercise
+    DecodeStatus status =
+        PushAll(decoder, BiphasePulses(kFrame, 14, 889, false));
+    auto [protocol, frame] = decoder.Result();
+
+    // Verify
+    CHECK(DecodeStatus::kComplete == status);
+    CHECK(2 == protocol);
+    CHECK(frame.is_valid);
+    CHECK(kFrame == frame.data);
+  }
+
+  SECTION("Sony SIRC is decoded least significant bit first")
+  {
+    // Setup
+    // Command 0x15 then address 0x01, least significant bit first.
+    std::vector<uint16_t> pulses = { 2400, 600 };
+    constexpr uint32_t kFrame    = (0x01 << 7) | 0x15;
+    for (size_t bit = 0; bit < 12; bit++)
+    {
+      pulses.push_back(((kFrame >> bit) & 1) ? 1200 : 600);
+      pulses.push_back(600);
+    }
+    pulses.pop_back();
+
+    // Exercise
+    DecodeStatus status = PushAll(decoder, pulses);
+
+    // Verify
+    CHECK(DecodeStatus::kComplete == status);
+    CHECK(1 == decoder.Result().protocol);
+    CHECK(kFrame == decoder.Result().frame.data);
+  }
+
+  SECTION("Fails once no protocol matches, until reset")
+  {
+    // Exercise
+    DecodeStatus status = decoder.Push(5000);
+    decoder.Reset();
+    DecodeStatus after_reset = decoder.Push(9000);
+
+    // Verify
+    CHECK(DecodeStatus::kError == status);
+    CHECK(DecodeStatus::kInProgress == after_reset);
+    CHECK(!decoder.Result().frame.is_valid);
+  }
+}
 }  // namespace infrared
 }  // namespace sjsu
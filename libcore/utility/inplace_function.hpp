@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sjsu
+{
+/// Default number of bytes an InplaceFunction can hold. Enough for a lambda
+/// capturing a few references or pointers, or a pointer to member function
+/// along with its object.
+inline constexpr size_t kInplaceFunctionCapacity = 4 * sizeof(void *);
+
+template <typename Signature, size_t kCapacity = kInplaceFunctionCapacity>
+class InplaceFunction;
+
+/// Drop-in replacement for std::function which stores its callable within
+/// itself rather than on the heap, and never throws.
+///
+/// The callable is stored in a buffer of kCapacity bytes. Assigning a
+/// callable that does not fit is a compile time error rather than a heap
+/// allocation. Calls go through a single function pointer, without the
+/// exception handling std::function needs, which makes it suitable for
+/// interrupt service routines.
+///
+/// Calling an empty InplaceFunction calls std::abort(). Zero initialized
+/// memory holds an empty InplaceFunction.
+///
+/// USAGE:
+///
+///    InplaceFunction<void(int)> callback = [&counter](int amount) {
+///      counter += amount;
+///    };
+///    callback(5);
+///
+/// @tparam Result - return type of the function.
+/// @tparam Args - argument types of the function.
+/// @tparam kCapacity - maximum size of the stored callable in bytes.
+template <typename Result, typename... Args, size_t kCapacity>
+class InplaceFunction<Result(Args...), kCapacity>
+{
+ public:
+  /// Alignment of the storage for the callable.
+  static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+  /// Construct an empty function. constexpr, so that objects holding an
+  /// InplaceFunction can be constant initialized.
+  constexpr InplaceFunction() noexcept : storage_{} {}
+
+  /// Construct an empty function.
+  constexpr InplaceFunction(std::nullptr_t) noexcept  // NOLINT
+      : InplaceFunction()
+  {
+  }
+
+  /// Store a callable, such as a lambda, function pointer or functor.
+  ///
+  /// @param callable - callable to store. Must fit within kCapacity bytes.
+  template <typename Callable>
+  requires(!std::is_same_v<std::remove_cvref_t<Callable>, InplaceFunction> &&
+           std::is_invocable_r_v<Result, std::decay_t<Callable> &, Args...>)
+  InplaceFunction(Callable && callable) noexcept  // NOLINT
+  {
+    using Stored = std::decay_t<Callable>;
+
+    static_assert(sizeof(Stored) <= kCapacity,
+                  "Callable does not fit within the InplaceFunction. Capture "
+                  "less or increase the InplaceFunction's capacity.");
+    static_assert(alignof(Stored) <= kAlignment,
+                  "Callable's alignment is too strict for InplaceFunction.");
+    static_assert(std::is_nothrow_copy_constructible_v<Stored>,
+                  "Callable must be copyable without throwing.");
+
+    if constexpr (std::is_pointer_v<std::remove_cvref_t<Callable>> ||
+                  std::is_member_pointer_v<std::remove_cvref_t<Callable>>)
+    {
+      // A null function pointer is treated as an empty function, as with
+      // std::function.
+      if (callable == nullptr)
+      {
+        return;
+      }
+    }
+
+    new (&storage_) Stored(std::forward<Callable>(callable));
+    operations_ = &kOperations<Stored>;
+  }
+
+  InplaceFunction(const InplaceFunction & other) noexcept
+  {
+    CopyFrom(other);
+  }
+
+  InplaceFunction & operator=(const InplaceFunction & other) noexcept
+  {
+    if (this != &other)
+    {
+      Clear();
+      CopyFrom(other);
+    }
+    return *this;
+  }
+
+  InplaceFunction & operator=(std::nullptr_t) noexcept
+  {
+    Clear();
+    return *this;
+  }
+
+  constexpr ~InplaceFunction()
+  {
+    Clear();
+  }
+
+  /// Call the stored callable.
+  ///
+  /// @param args - arguments to pass to the callable.
+  /// @return Result - the result of the callable.
+  Result operator()(Args... args) const
+  {
+    if (operations_ == nullptr)
+    {
+      std::abort();
+    }
+    return operations_->invoke(&storage_, std::forward<Args>(args)...);
+  }
+
+  /// @return true - if a callable is stored.
+  explicit operator bool() const noexcept
+  {
+    return operations_ != nullptr;
+  }
+
+  /// @return true - if `function` is empty.
+  friend bool operator==(const InplaceFunction & function,
+                         std::nullptr_t) noexcept
+  {
+    return !function;
+  }
+
+ private:
+  struct Operations_t
+  {
+    Result (*invoke)(void * storage, Args &&... args);
+    void (*copy)(void * destination, const void * source);
+    void (*destroy)(void * storage);
+  };
+
+  template <typename Stored>
+  static constexpr Operations_t kOperations = {
+    .invoke = [](void * storage, Args &&... args) -> Result
+    {
+      return std::invoke(*static_cast<Stored *>(storage),
+                         std::forward<Args>(args)...);
+    },
+    .copy = [](void * destination, const void * source)
+    { new (destination) Stored(*static_cast<const Stored *>(source)); },
+    .destroy = [](void * storage)
+    { static_cast<Stored *>(storage)->~Stored(); },
+  };
+
+  void CopyFrom(const InplaceFunction & other)
+  {
+    if (other.operations_ != nullptr)
+    {
+      other.operations_->copy(&storage_, &other.storage_);
+    }
+    operations_ = other.operations_;
+  }
+
+  constexpr void Clear()
+  {
+    if (operations_ != nullptr)
+    {
+      operations_->destroy(&storage_);
+    }
+    operations_ = nullptr;
+  }
+
+  /// Mutable so that callables with a non-const call operator, such as
+  /// mutable lambdas, can be called through operator()() const, as with
+  /// std::function.
+  alignas(kAlignment) mutable std::byte storage_[kCapacity];
+  /// nullptr when empty, so that zero initialized memory holds an empty
+  /// function.
+  const Operations_t * operations_ = nullptr;
+};
+}  // namespace sjsu
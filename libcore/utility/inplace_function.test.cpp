@@ -0,0 +1,181 @@
+#include <libcore/utility/inplace_function.hpp>
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+int Double(int value)
+{
+  return value * 2;
+}
+
+struct Counter
+{
+  int Add(int amount)
+  {
+    total += amount;
+    return total;
+  }
+
+  int total = 0;
+};
+
+/// Counts copies and destructions to check the lifetime of stored callables.
+struct LifetimeTracker
+{
+  LifetimeTracker(int & copy_count, int & destroy_count)
+      : copies(&copy_count), destructions(&destroy_count)
+  {
+  }
+
+  LifetimeTracker(const LifetimeTracker & other) noexcept
+      : copies(other.copies), destructions(other.destructions)
+  {
+    (*copies)++;
+  }
+
+  ~LifetimeTracker()
+  {
+    (*destructions)++;
+  }
+
+  void operator()() const {}
+
+  int * copies;
+  int * destructions;
+};
+
+template <typename Callable>
+concept Storable = std::is_constructible_v<InplaceFunction<void()>, Callable>;
+
+static_assert(!Storable<int>);
+static_assert(Storable<void (*)()>);
+}  // namespace
+
+TEST_CASE("Testing InplaceFunction")
+{
+  SECTION("Empty by default")
+  {
+    // Setup
+    InplaceFunction<int(int)> function;
+    InplaceFunction<int(int)> null_function     = nullptr;
+    int (*null_pointer)(int)                    = nullptr;
+    InplaceFunction<int(int)> from_null_pointer = null_pointer;
+
+    // Verify
+    CHECK(!function);
+    CHECK(function == nullptr);
+    CHECK(!null_function);
+    CHECK(!from_null_pointer);
+  }
+
+  SECTION("Function pointer")
+  {
+    // Setup
+    InplaceFunction<int(int)> function = Double;
+
+    // Exercise
+    int result = function(21);
+
+    // Verify
+    CHECK(function);
+    CHECK(42 == result);
+  }
+
+  SECTION("Lambda with captures")
+  {
+    // Setup
+    int base                           = 10;
+    int calls                          = 0;
+    InplaceFunction<int(int)> function = [&base, &calls](int value)
+    {
+      calls++;
+      return base + value;
+    };
+
+    // Exercise
+    base       = 20;
+    int result = function(1);
+
+    // Verify
+    CHECK(21 == result);
+    CHECK(1 == calls);
+  }
+
+  SECTION("Mutable lambda keeps its state")
+  {
+    // Setup
+    InplaceFunction<int()> function = [count = 0]() mutable { return ++count; };
+
+    // Exercise
+    function();
+    function();
+    int result = function();
+
+    // Verify
+    CHECK(3 == result);
+  }
+
+  SECTION("Pointer to member function")
+  {
+    // Setup
+    Counter counter;
+    InplaceFunction<int(Counter &, int)> function = &Counter::Add;
+
+    // Exercise
+    function(counter, 5);
+    function(counter, 6);
+
+    // Verify
+    CHECK(11 == counter.total);
+  }
+
+  SECTION("Copy and reassignment manage the stored callable's lifetime")
+  {
+    // Setup
+    int copies       = 0;
+    int destructions = 0;
+
+    {
+      InplaceFunction<void()> function = LifetimeTracker(copies, destructions);
+      // The temporary passed in was destroyed.
+      CHECK(1 == destructions);
+
+      // Exercise
+      InplaceFunction<void()> copy = function;
+      CHECK(copy);
+      CHECK(2 == copies);
+
+      copy = nullptr;
+      CHECK(!copy);
+      CHECK(2 == destructions);
+
+      copy = function;
+      CHECK(3 == copies);
+    }
+
+    // Verify
+    CHECK(3 == copies);
+    CHECK(4 == destructions);
+  }
+
+  SECTION("Capacity")
+  {
+    // Setup
+    std::array<uint8_t, 64> large_capture{};
+    InplaceFunction<size_t(), 64> function = [large_capture]()
+    { return large_capture.size(); };
+
+    // Verify
+    CHECK(64 == function());
+    static_assert(sizeof(InplaceFunction<void()>) <=
+                  kInplaceFunctionCapacity + 2 * alignof(std::max_align_t));
+  }
+}
+}  // namespace sjsu
@@ -5,9 +5,13 @@
 /// @{
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <experimental/source_location>
 #include <libcore/utility/ansi_terminal_codes.hpp>
+#include <libcore/utility/constexpr.hpp>
+#include <libcore/utility/math/units.hpp>
 #include <libcore/utility/time/time.hpp>
 #include <string_view>
 #include <type_traits>
@@ -37,98 +41,290 @@
 
 namespace sjsu::log
 {
-using DecoratorFunction =
-    std::function<void(const std::experimental::source_location &,
-                       std::chrono::nanoseconds)>;
+/// A float or double argument of a log. fmt is built without floating point
+/// support, which would pull in large tables and soft float code, so logs
+/// pass floating point arguments, including the values of units types, as
+/// this type, which is formatted in fixed point with integer arithmetic.
+///
+/// Supports a precision and the `f` presentation type, for example "{:.2f}"
+/// or "{:.1}", of up to 9 digits. The default is 3 digits. NaN prints as
+/// "nan" and values beyond the range of uint64_t as "inf".
+struct FixedPoint_t
+{
+  /// Value to format.
+  float value;
+};
+}  // namespace sjsu::log
 
-struct Decorators
+/// Formats sjsu::log::FixedPoint_t, see it for the supported format.
+template <>
+struct fmt::formatter<sjsu::log::FixedPoint_t>
 {
-  static inline DecoratorFunction info_prefix =
-      [](const std::experimental::source_location & location,
-         std::chrono::nanoseconds nanos)
+  /// Parse the precision. Invalid formats fail to compile.
+  template <typename ParseContext>
+  constexpr auto parse(ParseContext & ctx)
   {
-    if constexpr ((DEBUG_LOGS || INFO_LOGS) && ENABLE_LOGS)
+    auto it = ctx.begin();
+    if (it != ctx.end() && *it == '.')
     {
-      fmt::print(
-          "{}:{}:{}:{}s> " SJ2_HI_BLACK,
-          location.file_name(),
-          location.line(),
-          location.function_name(),
-          std::chrono::duration_cast<std::chrono::seconds>(nanos).count());
+      it++;
+      if (it == ctx.end() || *it < '0' || *it > '9')
+      {
+        ctx.on_error("fixed point precision must be a digit from 0 to 9");
+      }
+      precision = *it++ - '0';
     }
-  };
-  static inline DecoratorFunction debug_prefix =
-      [](const std::experimental::source_location & location,
-         std::chrono::nanoseconds nanos)
-  {
-    if constexpr (DEBUG_LOGS && ENABLE_LOGS)
+    if (it != ctx.end() && *it == 'f')
     {
-      fmt::print(
-          "{}:{}:{}:{}s> " SJ2_HI_YELLOW,
-          location.file_name(),
-          location.line(),
-          location.function_name(),
-          std::chrono::duration_cast<std::chrono::seconds>(nanos).count());
+      it++;
     }
-  };
-  static inline DecoratorFunction print_prefix =
-      [](const std::experimental::source_location & location,
-         std::chrono::nanoseconds nanos)
-  {
-    if constexpr (ENABLE_LOGS)
+    if (it != ctx.end() && *it != '}')
     {
-      fmt::print(
-          "{}:{}:{}:{}s> " SJ2_HI_BOLD_WHITE,
-          location.file_name(),
-          location.line(),
-          location.function_name(),
-          std::chrono::duration_cast<std::chrono::seconds>(nanos).count());
+      ctx.on_error("fixed point only supports a precision and 'f'");
     }
-  };
-  static inline DecoratorFunction critical_prefix =
-      [](const std::experimental::source_location & location,
-         std::chrono::nanoseconds nanos)
+    return it;
+  }
+
+  /// Print the number rounded to the precision.
+  template <typename FormatContext>
+  auto format(sjsu::log::FixedPoint_t number, FormatContext & ctx) const
   {
-    if constexpr (ENABLE_LOGS)
+    constexpr std::array<uint32_t, 10> kScales = {
+      1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000,
+      1'000'000'000,
+    };
+
+    float value = number.value;
+    if (value != value)
     {
-      fmt::print(
-          "{}:{}:{}:{}s> " SJ2_RED,
-          location.file_name(),
-          location.line(),
-          location.function_name(),
-          std::chrono::duration_cast<std::chrono::seconds>(nanos).count());
+      return fmt::format_to(ctx.out(), "nan");
     }
-  };
 
-  static inline std::function<void(void)> info_suffix = []()
-  {
-    if constexpr ((DEBUG_LOGS || INFO_LOGS) && ENABLE_LOGS)
+    const bool kNegative = value < 0;
+    value                = kNegative ? -value : value;
+    if (value >= 1.8e19f)
     {
-      fmt::print(SJ2_COLOR_RESET);
+      return fmt::format_to(ctx.out(), "{}inf", kNegative ? "-" : "");
     }
-  };
-  static inline std::function<void(void)> debug_suffix = []()
-  {
-    if constexpr (DEBUG_LOGS && ENABLE_LOGS)
+
+    const uint32_t kScale = kScales[precision];
+    uint64_t whole        = static_cast<uint64_t>(value);
+    uint64_t fraction     = static_cast<uint64_t>(
+        ((value - static_cast<float>(whole)) * static_cast<float>(kScale)) +
+        0.5f);
+    if (fraction >= kScale)
+    {
+      whole++;
+      fraction -= kScale;
+    }
+
+    // Values that round to zero are printed without a sign.
+    const char * sign = (kNegative && (whole != 0 || fraction != 0)) ? "-" : "";
+    if (precision == 0)
     {
-      fmt::print(SJ2_COLOR_RESET);
+      return fmt::format_to(ctx.out(), "{}{}", sign, whole);
     }
-  };
-  static inline std::function<void(void)> print_suffix = []()
+    return fmt::format_to(
+        ctx.out(), "{}{}.{:0{}}", sign, whole, fraction, precision);
+  }
+
+  /// Number of digits after the decimal point.
+  int precision = 3;
+};
+
+/// Formats the value of a units type, without its unit, in fixed point, or as
+/// an integer for units types held in integers.
+template <class Units, typename T, template <typename> class NonLinearScale>
+struct fmt::formatter<units::unit_t<Units, T, NonLinearScale>>
+    : fmt::formatter<sjsu::log::FixedPoint_t>
+{
+  /// Print the value of the unit.
+  template <typename FormatContext>
+  auto format(const units::unit_t<Units, T, NonLinearScale> & unit,
+              FormatContext & ctx) const
   {
-    if constexpr (ENABLE_LOGS)
+    if constexpr (std::is_integral_v<T>)
+    {
+      return fmt::format_to(ctx.out(), "{}", unit.template to<T>());
+    }
+    else
     {
-      fmt::print(SJ2_COLOR_RESET);
+      return fmt::formatter<sjsu::log::FixedPoint_t>::format(
+          sjsu::log::FixedPoint_t{ unit.template to<float>() }, ctx);
     }
-  };
-  static inline std::function<void(void)> critical_suffix = []()
+  }
+};
+
+namespace sjsu::log
+{
+/// Severity of a log.
+enum class Level
+{
+  kDebug,
+  kInfo,
+  kPrint,
+  kCritical,
+  /// Not a severity. Used as a threshold to disable every log.
+  kOff,
+};
+
+/// Location in the source code where a log was made.
+///
+/// The constructor is consteval, so the basename of the file is found by the
+/// compiler rather than by scanning the full path on every log.
+struct Location_t
+{
+  /// @param location - location of the log. Defaults to the location of the
+  ///        caller.
+  consteval Location_t(  // NOLINT
+      const std::experimental::source_location & location =
+          std::experimental::source_location::current())
+      : file(FileBasename(location.file_name())),
+        function(location.function_name()),
+        line(location.line())
+  {
+  }
+
+  /// Basename of the source file.
+  const char * file;
+  /// Name of the enclosing function.
+  const char * function;
+  /// Line number within the source file.
+  uint32_t line;
+};
+
+/// Prints the text surrounding each log. A decorator is a type with the
+/// following static member function templates:
+///
+///    template <Level level>
+///    static void Prefix(const Location_t & location);
+///
+///    template <Level level>
+///    static void Suffix();
+///
+/// The decorator is selected at compile time, so its calls can be inlined or
+/// removed entirely. To use a different decorator, define
+/// SJ2_LOG_DECORATOR_HEADER as the path to a header which defines the
+/// decorator and SJ2_LOG_DECORATOR as its name, for example:
+///
+///    -DSJ2_LOG_DECORATOR_HEADER="<project/quiet_logs.hpp>"
+///    -DSJ2_LOG_DECORATOR=project::QuietLogs
+///
+/// The header is included by this file after Level and Location_t are
+/// declared.
+///
+/// DefaultDecorator prints the file, line, function and uptime of each log
+/// and colors the log by its level.
+struct DefaultDecorator
+{
+  /// @tparam level - severity of the log.
+  /// @param location - location in the source code of the log.
+  template <Level level>
+  static void Prefix(const Location_t & location)
+  {
+    fmt::print(
+        "{}:{}:{}:{}s> {}",
+        location.file,
+        location.line,
+        location.function,
+        std::chrono::duration_cast<std::chrono::seconds>(sjsu::Uptime())
+            .count(),
+        Color(level));
+  }
+
+  /// @tparam level - severity of the log.
+  template <Level level>
+  static void Suffix()
   {
-    if constexpr (ENABLE_LOGS)
+    fmt::print(SJ2_COLOR_RESET);
+  }
+
+ private:
+  static constexpr const char * Color(Level level)
+  {
+    switch (level)
     {
-      fmt::print(SJ2_COLOR_RESET);
+      case Level::kDebug: return SJ2_HI_YELLOW;
+      case Level::kInfo: return SJ2_HI_BLACK;
+      case Level::kPrint: return SJ2_HI_BOLD_WHITE;
+      case Level::kCritical:
+      default: return SJ2_RED;
     }
-  };
+  }
 };
+}  // namespace sjsu::log
+
+#if defined(SJ2_LOG_DECORATOR_HEADER)
+#include SJ2_LOG_DECORATOR_HEADER
+#endif
+
+#ifndef SJ2_LOG_DECORATOR
+#define SJ2_LOG_DECORATOR ::sjsu::log::DefaultDecorator
+#endif
+
+namespace sjsu::log
+{
+/// The decorator used by every log. See DefaultDecorator.
+using Decorator = SJ2_LOG_DECORATOR;
+
+namespace detail
+{
+/// Whether logs of a level are compiled in, as selected by the ENABLE_LOGS,
+/// INFO_LOGS and DEBUG_LOGS macros.
+template <Level level>
+inline constexpr bool kCompiledIn =
+    ENABLE_LOGS && (level != Level::kDebug || DEBUG_LOGS) &&
+    (level != Level::kInfo || DEBUG_LOGS || INFO_LOGS);
+
+/// Type a log argument of type T is formatted as: FixedPoint_t for float and
+/// double, and T itself otherwise.
+template <typename T>
+using Formatted_t =
+    std::conditional_t<std::is_floating_point_v<T>, FixedPoint_t, T>;
+
+/// @param arg - argument of a log.
+/// @return `arg` as its Formatted_t.
+template <typename T>
+constexpr decltype(auto) Format(const T & arg)
+{
+  if constexpr (std::is_floating_point_v<T>)
+  {
+    return FixedPoint_t{ static_cast<float>(arg) };
+  }
+  else
+  {
+    return (arg);
+  }
+}
+}  // namespace detail
+
+/// Format string of a log with arguments of types `Args`. Constructing it
+/// from a string literal parses the string at compile time, so a format that
+/// does not match its arguments fails to compile rather than printing
+/// garbage.
+///
+/// @tparam Args - types of the arguments of the log.
+template <typename... Args>
+using FormatString = fmt::format_string<detail::Formatted_t<Args>...>;
+
+namespace detail
+{
+/// Print a decorated log.
+///
+/// @tparam level - severity of the log.
+/// @param location - location in the source code of the log.
+/// @param format - fmt style format string.
+/// @param args - arguments for the format string.
+template <Level level, typename... Args>
+void Emit(const Location_t & location,
+          FormatString<Args...> format,
+          const Args &... args)
+{
+  Decorator::Prefix<level>(location);
+  fmt::vprint(format, fmt::make_format_args(Format(args)...));
+  Decorator::Suffix<level>();
+}
+}  // namespace detail
 
 /// Specialized log object that labels the log with a preceeding "DEBUG" label.
 /// Will only log if the SJ2_LOG_LEVEL is level SJ2_LOG_LEVEL_DEBUG or greater.
@@ -141,16 +337,14 @@ struct Info  // NOLINT
   /// @param args - variadic list of parameters to be passed to the log object
   /// @param location - the location in the source code where this object was
   ///        constructed.
-  Info(const char (&format)[N],
+  Info(FormatString<Args...> format,
        Args... args,
-       const std::experimental::source_location & location =
+       const Location_t & location =
            std::experimental::source_location::current())
   {
-    if constexpr ((DEBUG_LOGS || INFO_LOGS) && ENABLE_LOGS)
+    if constexpr (detail::kCompiledIn<Level::kInfo>)
     {
-      Decorators::info_prefix(location, sjsu::Uptime());
-      fmt::print(fmt::runtime(format), args...);
-      Decorators::info_suffix();
+      detail::Emit<Level::kInfo>(location, format, args...);
     }
   }
 };
@@ -163,16 +357,14 @@ struct Debug  // NOLINT
   /// @param args - variadic list of parameters to be passed to the log object
   /// @param location - the location in the source code where this object was
   ///        constructed.
-  Debug(const char (&format)[N],
+  Debug(FormatString<Args...> format,
         Args... args,
-        const std::experimental::source_location & location =
+        const Location_t & location =
             std::experimental::source_location::current())
   {
-    if constexpr (DEBUG_LOGS && ENABLE_LOGS)
+    if constexpr (detail::kCompiledIn<Level::kDebug>)
     {
-      Decorators::debug_prefix(location, sjsu::Uptime());
-      fmt::print(fmt::runtime(format), args...);
-      Decorators::debug_suffix();
+      detail::Emit<Level::kDebug>(location, format, args...);
     }
   }
 };
@@ -185,16 +377,14 @@ struct Print  // NOLINT
   /// @param args - variadic list of parameters to be passed to the log object
   /// @param location - the location in the source code where this object was
   ///        constructed.
-  constexpr Print(const char (&format)[N],
+  constexpr Print(FormatString<Args...> format,
                   Args... args,
-                  const std::experimental::source_location & location =
+                  const Location_t & location =
                       std::experimental::source_location::current())
   {
-    if constexpr (ENABLE_LOGS)
+    if constexpr (detail::kCompiledIn<Level::kPrint>)
     {
-      Decorators::print_prefix(location, sjsu::Uptime());
-      fmt::print(fmt::runtime(format), args...);
-      Decorators::print_suffix();
+      detail::Emit<Level::kPrint>(location, format, args...);
     }
   }
 };
@@ -202,16 +392,14 @@ struct Print  // NOLINT
 template <size_t N, typename... Args>
 struct Critical  // NOLINT
 {
-  Critical(const char (&format)[N],
+  Critical(FormatString<Args...> format,
            Args... args,
-           const std::experimental::source_location & location =
+           const Location_t & location =
                std::experimental::source_location::current())
   {
-    if constexpr (ENABLE_LOGS)
+    if constexpr (detail::kCompiledIn<Level::kCritical>)
     {
-      Decorators::critical_prefix(location, sjsu::Uptime());
-      fmt::print(fmt::runtime(format), args...);
-      Decorators::critical_suffix();
+      detail::Emit<Level::kCritical>(location, format, args...);
     }
   }
 };
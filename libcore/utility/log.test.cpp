@@ -0,0 +1,109 @@
+#include <libcore/utility/log.hpp>
+
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::log
+{
+namespace
+{
+constexpr Location_t CaptureLocation(
+    const Location_t & location =
+        std::experimental::source_location::current())
+{
+  return location;
+}
+
+/// Format a log's arguments as the log would, without its decoration.
+template <typename... Args>
+std::string FormatLog(FormatString<Args...> format, const Args &... args)
+{
+  std::string text;
+  fmt::vformat_to(std::back_inserter(text),
+                  format,
+                  fmt::make_format_args(detail::Format(args)...));
+  return text;
+}
+}  // namespace
+
+TEST_CASE("Testing log::Location_t")
+{
+  SECTION("Captures the caller's location with the file basename")
+  {
+    // Exercise
+    constexpr uint32_t kExpectedLine = __LINE__ + 1;
+    Location_t location              = CaptureLocation();
+
+    // Verify
+    CHECK(std::string_view("log.test.cpp") == location.file);
+    CHECK(kExpectedLine == location.line);
+    CHECK(std::string_view(location.function).find("DOCTEST") !=
+          std::string_view::npos);
+  }
+
+  SECTION("Basename is found at compile time")
+  {
+    // Setup
+    constexpr Location_t kLocation = CaptureLocation();
+
+    // Verify
+    static_assert(std::string_view(kLocation.file) == "log.test.cpp");
+  }
+}
+
+TEST_CASE("Testing log fixed point formatting")
+{
+  SECTION("Floats default to 3 digits after the decimal point")
+  {
+    // Exercise & Verify
+    CHECK("1.500" == FormatLog("{}", 1.5f));
+    CHECK("-273.150" == FormatLog("{}", -273.15f));
+    CHECK("0.000" == FormatLog("{}", 0.0f));
+  }
+
+  SECTION("Precision rounds to the nearest digit")
+  {
+    // Exercise & Verify
+    CHECK("3.14" == FormatLog("{:.2f}", 3.14159f));
+    CHECK("2.7183" == FormatLog("{:.4}", 2.718281828));
+    CHECK("10.0" == FormatLog("{:.1f}", 9.96f));
+    CHECK("42" == FormatLog("{:.0f}", 41.6f));
+    CHECK("0.05" == FormatLog("{:.2f}", 0.05f));
+  }
+
+  SECTION("Values that round to zero have no sign")
+  {
+    // Exercise & Verify
+    CHECK("0.00" == FormatLog("{:.2f}", -0.001f));
+    CHECK("-0.01" == FormatLog("{:.2f}", -0.009f));
+  }
+
+  SECTION("NaN and values out of range")
+  {
+    // Exercise & Verify
+    CHECK("nan" == FormatLog("{}", std::numeric_limits<float>::quiet_NaN()));
+    CHECK("inf" == FormatLog("{}", std::numeric_limits<float>::infinity()));
+    CHECK("-inf" == FormatLog("{}", -1e30f));
+  }
+
+  SECTION("Units print their value")
+  {
+    // Exercise & Verify
+    CHECK("3.300 V" == FormatLog("{} V", 3.3_V));
+    CHECK("21.5C" ==
+          FormatLog("{:.1f}C", units::temperature::celsius_t(21.5f)));
+    CHECK("1500 Hz" == FormatLog("{} Hz", units::integer::hertz_t(1'500)));
+  }
+
+  SECTION("Other arguments are formatted as usual")
+  {
+    // Exercise & Verify
+    CHECK("id 7: ok, 1.25" == FormatLog("id {}: {}, {:.2f}", 7, "ok", 1.25f));
+  }
+}
+}  // namespace sjsu::log
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include <libcore/utility/log.hpp>
+
+/// Runtime log level that every module starts with. Logs below this level are
+/// skipped until the module's level is lowered at runtime.
+#ifndef SJ2_LOG_MODULE_LEVEL
+#define SJ2_LOG_MODULE_LEVEL ::sjsu::log::Level::kDebug
+#endif
+
+namespace sjsu::log
+{
+/// Name of a logging module, usable as a template argument.
+///
+/// @tparam N - length of the name including the null terminator.
+template <size_t N>
+struct ModuleName_t
+{
+  /// @param name - string literal name of the module.
+  consteval ModuleName_t(const char (&name)[N])  // NOLINT
+  {
+    for (size_t i = 0; i < N; i++)
+    {
+      characters[i] = name[i];
+    }
+  }
+
+  /// @return constexpr std::string_view - the name without the terminator.
+  constexpr std::string_view View() const
+  {
+    return std::string_view(characters, N - 1);
+  }
+
+  /// Characters of the name, including the null terminator.
+  char characters[N];
+};
+
+/// Table of the runtime log level of every logging module, used to change a
+/// module's level by name, for example from a command line.
+class ModuleLevels
+{
+ public:
+  /// Runtime level of a single module. Each Module has one entry, which adds
+  /// itself to the table when it is constructed.
+  struct Entry_t
+  {
+    /// @param module_name - name of the module.
+    /// @param initial_level - level to start with.
+    Entry_t(std::string_view module_name, Level initial_level)
+        : name(module_name), level(initial_level), next(list)
+    {
+      list = this;
+    }
+
+    /// Name of the module.
+    const std::string_view name;
+    /// Logs below this level are skipped.
+    std::atomic<Level> level;
+    /// Next entry in the table.
+    Entry_t * const next;
+  };
+
+  /// Change the level of a module.
+  ///
+  /// @param name - name of the module.
+  /// @param level - new level of the module.
+  /// @return true - if the module was found.
+  static bool Set(std::string_view name, Level level)
+  {
+    bool found = false;
+    ForEach(
+        [name, level, &found](Entry_t & entry)
+        {
+          if (entry.name == name)
+          {
+            entry.level.store(level, std::memory_order_relaxed);
+            found = true;
+          }
+        });
+    return found;
+  }
+
+  /// @param name - name of the module.
+  /// @return std::optional<Level> - level of the module or std::nullopt if no
+  ///         module has that name.
+  static std::optional<Level> Get(std::string_view name)
+  {
+    std::optional<Level> result;
+    ForEach(
+        [name, &result](Entry_t & entry)
+        {
+          if (entry.name == name)
+          {
+            result = entry.level.load(std::memory_order_relaxed);
+          }
+        });
+    return result;
+  }
+
+  /// Change the level of every module.
+  ///
+  /// @param level - new level of every module.
+  static void SetAll(Level level)
+  {
+    ForEach([level](Entry_t & entry)
+            { entry.level.store(level, std::memory_order_relaxed); });
+  }
+
+  /// Call `callback` with every module's entry, for example to list the
+  /// modules and their levels.
+  ///
+  /// @param callback - callable with the signature `void(Entry_t &)`.
+  template <typename Callback>
+  static void ForEach(Callback && callback)
+  {
+    for (Entry_t * entry = list; entry != nullptr; entry = entry->next)
+    {
+      callback(*entry);
+    }
+  }
+
+ private:
+  static inline Entry_t * list = nullptr;
+};
+
+/// Logs belonging to a module, whose level can be changed at runtime.
+///
+/// Each log first checks whether its level is compiled in, as with the logs
+/// in log.hpp, and then compares its level against the module's runtime
+/// level. The runtime check is a single load of a variable at a fixed
+/// address and a compare, made before any formatting begins, so disabled
+/// logs cost only a few cycles.
+///
+/// Usage:
+///
+///    using I2cLog = sjsu::log::Module<"lpc40xx::I2c">;
+///
+///    I2cLog::Debug("Address {} NACKed", address);
+///
+///    // Later, for example from a command line:
+///    sjsu::log::ModuleLevels::Set("lpc40xx::I2c", sjsu::log::Level::kDebug);
+///
+/// @tparam name - name of the module, used to change its level by name.
+template <ModuleName_t name>
+class Module
+{
+ public:
+  /// Name of the module.
+  static constexpr std::string_view kName = name.View();
+
+  /// @param level - severity of a log.
+  /// @return true - if logs of that level are currently enabled.
+  static bool IsEnabled(Level level)
+  {
+    return level >= entry.level.load(std::memory_order_relaxed);
+  }
+
+  /// @param level - logs below this level will be skipped.
+  static void SetLevel(Level level)
+  {
+    entry.level.store(level, std::memory_order_relaxed);
+  }
+
+  /// @return Level - logs below this level are skipped.
+  static Level GetLevel()
+  {
+    return entry.level.load(std::memory_order_relaxed);
+  }
+
+  /// @tparam Args - Variadic type array to describe the args variable pack.
+  template <size_t N, typename... Args>
+  struct Debug  // NOLINT
+  {
+    /// @param format - format string to be used for logging
+    /// @param args - variadic list of parameters to be passed to the log
+    /// @param location - the location in the source code of the log.
+    Debug(FormatString<Args...> format,
+          Args... args,
+          const Location_t & location =
+              std::experimental::source_location::current())
+    {
+      Log<Level::kDebug>(location, format, args...);
+    }
+  };
+
+  /// @tparam Args - Variadic type array to describe the args variable pack.
+  template <size_t N, typename... Args>
+  struct Info  // NOLINT
+  {
+    /// @param format - format string to be used for logging
+    /// @param args - variadic list of parameters to be passed to the log
+    /// @param location - the location in the source code of the log.
+    Info(FormatString<Args...> format,
+         Args... args,
+         const Location_t & location =
+             std::experimental::source_location::current())
+    {
+      Log<Level::kInfo>(location, format, args...);
+    }
+  };
+
+  /// @tparam Args - Variadic type array to describe the args variable pack.
+  template <size_t N, typename... Args>
+  struct Print  // NOLINT
+  {
+    /// @param format - format string to be used for logging
+    /// @param args - variadic list of parameters to be passed to the log
+    /// @param location - the location in the source code of the log.
+    Print(FormatString<Args...> format,
+          Args... args,
+          const Location_t & location =
+              std::experimental::source_location::current())
+    {
+      Log<Level::kPrint>(location, format, args...);
+    }
+  };
+
+  /// @tparam Args - Variadic type array to describe the args variable pack.
+  template <size_t N, typename... Args>
+  struct Critical  // NOLINT
+  {
+    /// @param format - format string to be used for logging
+    /// @param args - variadic list of parameters to be passed to the log
+    /// @param location - the location in the source code of the log.
+    Critical(FormatString<Args...> format,
+             Args... args,
+             const Location_t & location =
+                 std::experimental::source_location::current())
+    {
+      Log<Level::kCritical>(location, format, args...);
+    }
+  };
+
+  /// Deduction guide for Debug
+  template <size_t N, typename... Args>
+  Debug(const char (&format)[N], Args...) -> Debug<N, Args...>;
+
+  /// Deduction guide for Info
+  template <size_t N, typename... Args>
+  Info(const char (&format)[N], Args...) -> Info<N, Args...>;
+
+  /// Deduction guide for Print
+  template <size_t N, typename... Args>
+  Print(const char (&format)[N], Args...) -> Print<N, Args...>;
+
+  /// Deduction guide for Critical
+  template <size_t N, typename... Args>
+  Critical(const char (&format)[N], Args...) -> Critical<N, Args...>;
+
+ private:
+  template <Level level, typename... Args>
+  static void Log(const Location_t & location,
+                  FormatString<Args...> format,
+                  const Args &... args)
+  {
+    if constexpr (detail::kCompiledIn<level>)
+    {
+      if (IsEnabled(level))
+      {
+        detail::Emit<level>(location, format, args...);
+      }
+    }
+  }
+
+  static inline ModuleLevels::Entry_t entry{ kName, SJ2_LOG_MODULE_LEVEL };
+};
+}  // namespace sjsu::log
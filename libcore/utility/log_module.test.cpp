@@ -0,0 +1,89 @@
+#include <libcore/utility/log_module.hpp>
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::log
+{
+namespace
+{
+using SensorLog = Module<"test::Sensor">;
+using MotorLog  = Module<"test::Motor">;
+}  // namespace
+
+TEST_CASE("Testing log::Module")
+{
+  // Setup
+  SensorLog::SetLevel(Level::kDebug);
+  MotorLog::SetLevel(Level::kDebug);
+
+  SECTION("Name and default level")
+  {
+    // Verify
+    static_assert(SensorLog::kName == "test::Sensor");
+    CHECK(SensorLog::IsEnabled(Level::kDebug));
+    CHECK(SensorLog::IsEnabled(Level::kCritical));
+  }
+
+  SECTION("SetLevel() skips logs below the level")
+  {
+    // Exercise
+    SensorLog::SetLevel(Level::kPrint);
+
+    // Verify
+    CHECK(Level::kPrint == SensorLog::GetLevel());
+    CHECK(!SensorLog::IsEnabled(Level::kDebug));
+    CHECK(!SensorLog::IsEnabled(Level::kInfo));
+    CHECK(SensorLog::IsEnabled(Level::kPrint));
+    CHECK(SensorLog::IsEnabled(Level::kCritical));
+    // Other modules are unaffected.
+    CHECK(MotorLog::IsEnabled(Level::kDebug));
+  }
+
+  SECTION("Level::kOff disables every log")
+  {
+    // Exercise
+    MotorLog::SetLevel(Level::kOff);
+
+    // Verify
+    CHECK(!MotorLog::IsEnabled(Level::kCritical));
+    // A disabled log does nothing.
+    MotorLog::Critical("This should not be printed {}\n", 5);
+  }
+
+  SECTION("ModuleLevels::Set() and Get() find modules by name")
+  {
+    // Exercise
+    bool found   = ModuleLevels::Set("test::Motor", Level::kCritical);
+    bool missing = ModuleLevels::Set("test::Missing", Level::kCritical);
+
+    // Verify
+    CHECK(found);
+    CHECK(!missing);
+    CHECK(Level::kCritical == MotorLog::GetLevel());
+    CHECK(Level::kCritical == ModuleLevels::Get("test::Motor"));
+    CHECK(Level::kDebug == ModuleLevels::Get("test::Sensor"));
+    CHECK(!ModuleLevels::Get("test::Missing").has_value());
+  }
+
+  SECTION("ModuleLevels::SetAll() and ForEach()")
+  {
+    // Setup
+    std::vector<std::string_view> names;
+
+    // Exercise
+    ModuleLevels::SetAll(Level::kInfo);
+    ModuleLevels::ForEach([&names](ModuleLevels::Entry_t & entry)
+                          { names.push_back(entry.name); });
+
+    // Verify
+    CHECK(Level::kInfo == SensorLog::GetLevel());
+    CHECK(Level::kInfo == MotorLog::GetLevel());
+    CHECK(std::find(names.begin(), names.end(), "test::Sensor") != names.end());
+    CHECK(std::find(names.begin(), names.end(), "test::Motor") != names.end());
+  }
+}
+}  // namespace sjsu::log
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include <libcore/utility/log.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu::log
+{
+/// State of a single rate limited log call site.
+///
+/// The first log at a site is printed and starts a window. Logs made during
+/// the window are suppressed and counted. The first log after the window has
+/// passed is printed along with the number of logs suppressed before it, and
+/// starts a new window.
+///
+/// Not safe to share between contexts that may preempt each other; a race
+/// only affects the suppressed count and which log is printed.
+class RateLimit_t
+{
+ public:
+  /// @param window - minimum time between printed logs.
+  constexpr explicit RateLimit_t(std::chrono::nanoseconds window)
+      : window_(window)
+  {
+  }
+
+  /// Record a log made at `now` and decide whether it should be printed.
+  ///
+  /// @param now - uptime of the log.
+  /// @return std::optional<uint32_t> - std::nullopt if the log should be
+  ///         suppressed. Otherwise, the number of logs suppressed since the
+  ///         last printed log.
+  constexpr std::optional<uint32_t> Check(std::chrono::nanoseconds now)
+  {
+    if (started_ && now - window_start_ < window_)
+    {
+      suppressed_++;
+      return std::nullopt;
+    }
+
+    const uint32_t kSuppressed = suppressed_;
+    started_                   = true;
+    window_start_              = now;
+    suppressed_                = 0;
+    return kSuppressed;
+  }
+
+  /// @return uint32_t - number of logs suppressed in the current window.
+  constexpr uint32_t Suppressed() const
+  {
+    return suppressed_;
+  }
+
+ private:
+  std::chrono::nanoseconds window_;
+  std::chrono::nanoseconds window_start_ = std::chrono::nanoseconds(0);
+  uint32_t suppressed_                   = 0;
+  bool started_                          = false;
+};
+
+/// Print a log unless `limit` suppresses it. When logs were suppressed before
+/// this one, a log stating how many were suppressed is printed first.
+///
+/// Usually called through SJ2_LOG_RATE_LIMITED(), which stores the state of
+/// each call site statically.
+///
+/// @tparam level - severity of the log.
+/// @param limit - state of the call site.
+/// @param location - the location in the source code of the log.
+/// @param format - fmt style format string.
+/// @param args - arguments for the format string.
+template <Level level, typename... Args>
+void RateLimited(RateLimit_t & limit,
+                 const Location_t & location,
+                 FormatString<Args...> format,
+                 const Args &... args)
+{
+  if constexpr (detail::kCompiledIn<level>)
+  {
+    const auto kSuppressed = limit.Check(sjsu::Uptime());
+
+    if (!kSuppressed)
+    {
+      return;
+    }
+
+    if (*kSuppressed > 0)
+    {
+      detail::Emit<level>(location, "Suppressed {} times\n", *kSuppressed);
+    }
+
+    detail::Emit<level>(location, format, args...);
+  }
+}
+}  // namespace sjsu::log
+
+/// Log at most once per `window` from this call site. Repeats within the
+/// window are suppressed and counted, and the count is printed before the next
+/// log that is let through. The state of the call site is a static variable,
+/// so there is no allocation or lookup.
+///
+/// Usage:
+///
+///    SJ2_LOG_RATE_LIMITED(
+///        sjsu::log::Level::kCritical, 1s, "Sensor {} not responding\n", id);
+///
+/// @param level - sjsu::log::Level of the log.
+/// @param window - minimum time between printed logs.
+/// @param format - fmt style format string literal.
+/// @param ... - arguments for the format string.
+#define SJ2_LOG_RATE_LIMITED(level, window, format, ...)                    \
+  do                                                                        \
+  {                                                                         \
+    static ::sjsu::log::RateLimit_t sj2_rate_limit(window);                 \
+    ::sjsu::log::RateLimited<level>(                                        \
+        sj2_rate_limit,                                                     \
+        std::experimental::source_location::current(),                      \
+        format __VA_OPT__(, ) __VA_ARGS__);                                 \
+  } while (0)
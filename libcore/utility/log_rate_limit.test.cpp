@@ -0,0 +1,76 @@
+#include <libcore/utility/log_rate_limit.hpp>
+
+#include <chrono>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::log
+{
+TEST_CASE("Testing log::RateLimit_t")
+{
+  RateLimit_t limit(std::chrono::milliseconds(100));
+
+  SECTION("First log is printed")
+  {
+    // Exercise
+    auto result = limit.Check(std::chrono::milliseconds(5));
+
+    // Verify
+    REQUIRE(result.has_value());
+    CHECK(0 == *result);
+  }
+
+  SECTION("Logs within the window are suppressed and counted")
+  {
+    // Setup
+    limit.Check(std::chrono::milliseconds(0));
+
+    // Exercise
+    auto second = limit.Check(std::chrono::milliseconds(10));
+    auto third  = limit.Check(std::chrono::milliseconds(99));
+
+    // Verify
+    CHECK(!second.has_value());
+    CHECK(!third.has_value());
+    CHECK(2 == limit.Suppressed());
+  }
+
+  SECTION("First log after the window reports the suppressed count")
+  {
+    // Setup
+    limit.Check(std::chrono::milliseconds(0));
+    limit.Check(std::chrono::milliseconds(10));
+    limit.Check(std::chrono::milliseconds(20));
+
+    // Exercise
+    auto result = limit.Check(std::chrono::milliseconds(100));
+    auto next   = limit.Check(std::chrono::milliseconds(150));
+    auto after  = limit.Check(std::chrono::milliseconds(200));
+
+    // Verify
+    REQUIRE(result.has_value());
+    CHECK(2 == *result);
+    CHECK(!next.has_value());
+    REQUIRE(after.has_value());
+    CHECK(1 == *after);
+  }
+}
+
+TEST_CASE("Testing SJ2_LOG_RATE_LIMITED")
+{
+  // Setup
+  SetUptimeFunction([]() { return std::chrono::nanoseconds(0); });
+
+  // Exercise
+  // Debug logs are compiled out of the tests, so this only checks that the
+  // macro can be used with and without arguments.
+  for (int i = 0; i < 3; i++)
+  {
+    SJ2_LOG_RATE_LIMITED(Level::kDebug, std::chrono::seconds(1), "{}\n", i);
+    SJ2_LOG_RATE_LIMITED(Level::kDebug, std::chrono::seconds(1), "Loop\n");
+  }
+
+  // Cleanup
+  SetUptimeFunction(DefaultUptime);
+}
+}  // namespace sjsu::log
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace sjsu
+{
+/// Lock-free, multi-producer, single-consumer buffer of log records.
+///
+/// Producers, including interrupt service routines, append whole records with
+/// Write() without ever blocking. When there is not enough room, the record is
+/// dropped and counted rather than waiting for the consumer. The consumer
+/// calls Drain() from a context that can afford to block, such as the idle
+/// loop or a low priority task, which hands the buffered bytes to a writer in
+/// large chunks.
+///
+/// Each record is stored as a 32-bit header holding its length and a
+/// "committed" flag, followed by its bytes padded to a multiple of 4. A
+/// producer claims space for its record with a single compare-and-swap, copies
+/// the record in and then sets the committed flag. The consumer stops at the
+/// first record that is not yet committed, so records are always drained in
+/// the order that their space was claimed, and a record that is being written
+/// when an interrupt preempts its producer simply holds back the records
+/// after it until it is committed.
+///
+/// Requires lock-free 32-bit atomics with compare-and-swap, which excludes
+/// ARMv6-M (Cortex-M0/M0+) targets.
+///
+/// Use StaticLogRing to allocate the storage statically.
+class LogRing
+{
+ public:
+  /// Size in bytes of the header that precedes each record.
+  static constexpr size_t kHeaderSize = sizeof(uint32_t);
+
+  /// Largest record that can be stored.
+  static constexpr size_t kMaximumRecordLength = 0xFFFF;
+
+  /// Number of bytes Drain() collects before passing them to the writer.
+  static constexpr size_t kDrainChunkSize = 128;
+
+  /// @param storage - memory for the records. Its size in bytes must be a
+  ///        power of 2. Must outlive this object.
+  /// @param initial_position - position of the first record in the stream of
+  ///        bytes written. Must be a multiple of 4. Positions wrap around
+  ///        after SIZE_MAX bytes, so this lets tests start just before that
+  ///        point.
+  explicit LogRing(std::span<uint32_t> storage, size_t initial_position = 0)
+      : storage_(storage),
+        capacity_(storage.size_bytes()),
+        reserve_(initial_position),
+        read_(initial_position)
+  {
+  }
+
+  LogRing(const LogRing &) = delete;
+  LogRing & operator=(const LogRing &) = delete;
+
+  /// Append a record. Safe to call from any number of contexts at once,
+  /// including interrupts. Never blocks.
+  ///
+  /// @param record - bytes of the record.
+  /// @return true - if the record was stored.
+  /// @return false - if there was not enough room and the record was dropped.
+  bool Write(std::span<const uint8_t> record)
+  {
+    if (record.empty())
+    {
+      return true;
+    }
+
+    const size_t kSize = kHeaderSize + RoundUp(record.size());
+
+    if (record.size() > kMaximumRecordLength || kSize > capacity_)
+    {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    // Claim the space for this record. The read position is loaded before the
+    // reserve position, so the reserved space can only be over estimated.
+    size_t position = reserve_.load(std::memory_order_relaxed);
+    do
+    {
+      // Compare distances rather than positions, which wrap around.
+      const size_t kRead = read_.load(std::memory_order_acquire);
+      if (position + kSize - kRead > capacity_)
+      {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    } while (!reserve_.compare_exchange_weak(
+        position, position + kSize, std::memory_order_relaxed));
+
+    CopyIn(position + kHeaderSize, record);
+
+    // Publish the record. Its bytes become visible to the consumer along with
+    // the committed flag.
+    Header(position).store(kCommitted | static_cast<uint32_t>(record.size()),
+                           std::memory_order_release);
+    return true;
+  }
+
+  /// Append a string as a record. See Write(std::span<const uint8_t>).
+  ///
+  /// @param text - characters of the record.
+  /// @param length - number of characters.
+  /// @return true - if the record was stored.
+  bool Write(const char * text, size_t length)
+  {
+    return Write(std::span<const uint8_t>(
+        reinterpret_cast<const uint8_t *>(text), length));
+  }
+
+  /// Hand every committed record to `writer`, oldest first. Must only be
+  /// called from one context at a time.
+  ///
+  /// Record bytes are gathered into chunks of up to kDrainChunkSize bytes,
+  /// so that many short records make few calls to the writer. Record
+  /// boundaries are not preserved.
+  ///
+  /// @param writer - callable with the signature
+  ///        `void(std::span<const uint8_t> chunk)`.
+  /// @return size_t - number of record bytes passed to the writer.
+  template <typename Writer>
+  size_t Drain(Writer && writer)
+  {
+    std::array<uint8_t, kDrainChunkSize> chunk;
+    size_t chunk_length = 0;
+    size_t total        = 0;
+    size_t read         = read_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+      const uint32_t kHeader = Header(read).load(std::memory_order_acquire);
+
+      if ((kHeader & kCommitted) == 0)
+      {
+        break;
+      }
+
+      const size_t kLength = kHeader & kLengthMask;
+
+      for (size_t copied = 0; copied < kLength;)
+      {
+        if (chunk_length == chunk.size())
+        {
+          writer(std::span<const uint8_t>(chunk.data(), chunk_length));
+          chunk_length = 0;
+        }
+
+        const size_t kAmount =
+            std::min(kLength - copied, chunk.size() - chunk_length);
+        CopyOut(read + kHeaderSize + copied,
+                std::span<uint8_t>(chunk.data() + chunk_length, kAmount));
+        copied += kAmount;
+        chunk_length += kAmount;
+      }
+
+      // Clear the whole record, so that no stale bytes can be mistaken for a
+      // committed header once this space is reused, then hand the space back
+      // to the producers.
+      const size_t kSize = kHeaderSize + RoundUp(kLength);
+      Clear(read, kSize);
+      read += kSize;
+      read_.store(read, std::memory_order_release);
+      total += kLength;
+    }
+
+    if (chunk_length > 0)
+    {
+      writer(std::span<const uint8_t>(chunk.data(), chunk_length));
+    }
+
+    return total;
+  }
+
+  /// @return uint32_t - number of records dropped because the buffer was
+  ///         full or they were too large.
+  uint32_t Dropped() const
+  {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+  /// Reset the count returned by Dropped() to 0.
+  void ResetDropped()
+  {
+    dropped_.store(0, std::memory_order_relaxed);
+  }
+
+  /// @return size_t - number of bytes of the buffer, including headers and
+  ///         padding, that are claimed by records which have not been
+  ///         drained.
+  size_t Used() const
+  {
+    return reserve_.load(std::memory_order_acquire) -
+           read_.load(std::memory_order_acquire);
+  }
+
+  /// @return size_t - size of the buffer in bytes.
+  size_t Capacity() const
+  {
+    return capacity_;
+  }
+
+ private:
+  static constexpr uint32_t kCommitted  = 1UL << 31;
+  static constexpr uint32_t kLengthMask = 0xFFFF;
+
+  static constexpr size_t RoundUp(size_t length)
+  {
+    return (length + (kHeaderSize - 1)) & ~(kHeaderSize - 1);
+  }
+
+  std::atomic_ref<uint32_t> Header(size_t position)
+  {
+    return std::atomic_ref<uint32_t>(
+        storage_[(position & (capacity_ - 1)) / kHeaderSize]);
+  }
+
+  uint8_t * Bytes()
+  {
+    return reinterpret_cast<uint8_t *>(storage_.data());
+  }
+
+  void CopyIn(size_t position, std::span<const uint8_t> data)
+  {
+    const size_t kStart = position & (capacity_ - 1);
+    const size_t kFirst = std::min(data.size(), capacity_ - kStart);
+    std::memcpy(Bytes() + kStart, data.data(), kFirst);
+    std::memcpy(Bytes(), data.data() + kFirst, data.size() - kFirst);
+  }
+
+  void CopyOut(size_t position, std::span<uint8_t> data)
+  {
+    const size_t kStart = position & (capacity_ - 1);
+    const size_t kFirst = std::min(data.size(), capacity_ - kStart);
+    std::memcpy(data.data(), Bytes() + kStart, kFirst);
+    std::memcpy(data.data() + kFirst, Bytes(), data.size() - kFirst);
+  }
+
+  void Clear(size_t position, size_t size)
+  {
+    const size_t kStart = position & (capacity_ - 1);
+    const size_t kFirst = std::min(size, capacity_ - kStart);
+    std::memset(Bytes() + kStart, 0, kFirst);
+    std::memset(Bytes(), 0, size - kFirst);
+  }
+
+  std::span<uint32_t> storage_;
+  size_t capacity_;
+  std::atomic<size_t> reserve_;
+  std::atomic<size_t> read_;
+  std::atomic<uint32_t> dropped_ = 0;
+};
+
+/// LogRing with statically allocated storage.
+///
+/// @tparam kCapacity - size of the buffer in bytes. Must be a power of 2 and at
+///         least 8.
+template <size_t kCapacity>
+class StaticLogRing : public LogRing
+{
+ public:
+  static_assert(kCapacity >= 8 && (kCapacity & (kCapacity - 1)) == 0,
+                "StaticLogRing capacity must be a power of 2.");
+
+  StaticLogRing() : LogRing(storage_) {}
+
+ private:
+  std::array<uint32_t, kCapacity / sizeof(uint32_t)> storage_ = {};
+};
+}  // namespace sjsu
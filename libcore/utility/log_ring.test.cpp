@@ -0,0 +1,187 @@
+#include <libcore/utility/log_ring.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+/// Collects everything that a LogRing drains.
+struct DrainCollector
+{
+  void operator()(std::span<const uint8_t> chunk)
+  {
+    text.append(chunk.begin(), chunk.end());
+    chunk_sizes.push_back(chunk.size());
+  }
+
+  std::string text;
+  std::vector<size_t> chunk_sizes;
+};
+}  // namespace
+
+TEST_CASE("Testing LogRing")
+{
+  StaticLogRing<64> ring;
+  DrainCollector collector;
+
+  SECTION("Initial state")
+  {
+    // Exercise
+    size_t drained = ring.Drain(collector);
+
+    // Verify
+    CHECK(0 == drained);
+    CHECK(collector.chunk_sizes.empty());
+    CHECK(0 == ring.Used());
+    CHECK(0 == ring.Dropped());
+    CHECK(64 == ring.Capacity());
+  }
+
+  SECTION("Drain() returns records in order and batched together")
+  {
+    // Exercise
+    CHECK(ring.Write("hello ", 6));
+    CHECK(ring.Write("world", 5));
+    CHECK(ring.Write("!\n", 2));
+
+    // Verify
+    // Each record takes a 4 byte header and is padded to a multiple of 4.
+    CHECK(4 + 8 + 4 + 8 + 4 + 4 == ring.Used());
+    CHECK(13 == ring.Drain(collector));
+    CHECK("hello world!\n" == collector.text);
+    CHECK(std::vector<size_t>{ 13 } == collector.chunk_sizes);
+    CHECK(0 == ring.Used());
+  }
+
+  SECTION("Empty records are ignored")
+  {
+    // Exercise
+    CHECK(ring.Write("", 0));
+
+    // Verify
+    CHECK(0 == ring.Used());
+    CHECK(0 == ring.Drain(collector));
+  }
+
+  SECTION("Records are dropped and counted when the ring is full")
+  {
+    // Setup
+    const std::string kRecord(28, 'a');
+
+    // Exercise
+    CHECK(ring.Write(kRecord.data(), kRecord.size()));
+    CHECK(ring.Write(kRecord.data(), kRecord.size()));
+    bool third_stored = ring.Write("b", 1);
+
+    // Verify
+    CHECK(!third_stored);
+    CHECK(1 == ring.Dropped());
+    CHECK(56 == ring.Drain(collector));
+    CHECK(kRecord + kRecord == collector.text);
+
+    // Space is available again once drained.
+    CHECK(ring.Write("b", 1));
+    ring.ResetDropped();
+    CHECK(0 == ring.Dropped());
+  }
+
+  SECTION("Records larger than the ring are dropped")
+  {
+    // Setup
+    const std::string kRecord(61, 'a');
+
+    // Exercise
+    bool stored = ring.Write(kRecord.data(), kRecord.size());
+
+    // Verify
+    CHECK(!stored);
+    CHECK(1 == ring.Dropped());
+    CHECK(0 == ring.Used());
+  }
+
+  SECTION("Records wrap around the end of the ring")
+  {
+    // Setup
+    std::string expected;
+
+    // Exercise
+    // Records of 4 + 12 bytes advance the ring by a quarter each time, while
+    // records of 4 + 16 bytes do not evenly divide it, so their bytes
+    // eventually straddle the end of the ring.
+    for (int i = 0; i < 10; i++)
+    {
+      const std::string kRecord(9 + (i % 2) * 4, static_cast<char>('a' + i));
+      CHECK(ring.Write(kRecord.data(), kRecord.size()));
+      expected += kRecord;
+      ring.Drain(collector);
+    }
+
+    // Verify
+    CHECK(expected == collector.text);
+    CHECK(0 == ring.Dropped());
+    CHECK(0 == ring.Used());
+  }
+
+  SECTION("Positions wrap around SIZE_MAX")
+  {
+    // Setup
+    std::array<uint32_t, 16> storage = {};
+    LogRing wrapping_ring(storage, SIZE_MAX - 31);
+    std::string expected;
+
+    // Exercise
+    // Each record takes 4 + 8 bytes, so the positions wrap around during the
+    // third record and the ring is full after the fifth.
+    for (int i = 0; i < 5; i++)
+    {
+      const std::string kRecord(8, static_cast<char>('a' + i));
+      CHECK(wrapping_ring.Write(kRecord.data(), kRecord.size()));
+      expected += kRecord;
+    }
+    const bool kFullWrite = wrapping_ring.Write("full", 4);
+    const size_t kUsedWhenFull = wrapping_ring.Used();
+    wrapping_ring.Drain(collector);
+    const bool kDrainedWrite = wrapping_ring.Write("more", 4);
+
+    // Verify
+    CHECK(!kFullWrite);
+    CHECK(1 == wrapping_ring.Dropped());
+    CHECK(60 == kUsedWhenFull);
+    CHECK(expected == collector.text);
+    CHECK(kDrainedWrite);
+    CHECK(8 == wrapping_ring.Used());
+  }
+
+  SECTION("Drain() splits large amounts into chunks")
+  {
+    // Setup
+    StaticLogRing<512> large_ring;
+    std::string expected;
+
+    for (int i = 0; i < 5; i++)
+    {
+      const std::string kRecord(60, static_cast<char>('a' + i));
+      CHECK(large_ring.Write(kRecord.data(), kRecord.size()));
+      expected += kRecord;
+    }
+
+    // Exercise
+    size_t drained = large_ring.Drain(collector);
+
+    // Verify
+    CHECK(300 == drained);
+    CHECK(expected == collector.text);
+    CHECK(std::vector<size_t>{ LogRing::kDrainChunkSize,
+                               LogRing::kDrainChunkSize,
+                               300 - 2 * LogRing::kDrainChunkSize } ==
+          collector.chunk_sizes);
+  }
+}
+}  // namespace sjsu
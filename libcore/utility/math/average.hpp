@@ -3,8 +3,22 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
 
 namespace sjsu
 {
@@ -59,4 +73,371 @@ constexpr float Average(const T (&array)[size])
 {
   return Average(array, size);
 }
+
+namespace internal
+{
+/// The smallest integer type that can hold the sum of `kCount` values of
+/// type T. Sums of 16 bit values use 32 bit integers, which are native to the
+/// processor, for up to 65536 values.
+template <std::integral T, size_t kCount>
+using Accumulator_t = std::conditional_t<
+    (sizeof(T) <= 2 && kCount <= 65536),
+    std::conditional_t<std::is_signed_v<T>, int32_t, uint32_t>,
+    std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+/// The number of 16 bit values summed in 32 bits before adding the sum to the
+/// total.
+inline constexpr size_t kBlockSumChunk = 65536;
+
+/// Sum up to kBlockSumChunk values with four independent accumulators, so the
+/// additions can be pipelined.
+///
+/// @param samples - the values to sum.
+/// @return the sum in the native integer type.
+template <std::integral T>
+constexpr auto BlockSumChunk(std::span<const T> samples)
+{
+  std::array<Accumulator_t<T, kBlockSumChunk>, 4> sums = {};
+  size_t i                                             = 0;
+
+  for (; i + 4 <= samples.size(); i += 4)
+  {
+    sums[0] += samples[i + 0];
+    sums[1] += samples[i + 1];
+    sums[2] += samples[i + 2];
+    sums[3] += samples[i + 3];
+  }
+
+  for (; i < samples.size(); i++)
+  {
+    sums[0] += samples[i];
+  }
+
+  return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+#if defined(__ARM_FEATURE_DSP)
+/// Sum up to kBlockSumChunk signed 16 bit values with the SMLAD instruction,
+/// which adds both halves of a word to the accumulator at once.
+///
+/// @param samples - the values to sum.
+/// @return int32_t - the sum.
+inline int32_t ArmBlockSumChunk(std::span<const int16_t> samples)
+{
+  // Multiplying both halfwords by 1 makes SMLAD a dual add.
+  constexpr uint32_t kOnes = 0x0001'0001;
+  int32_t sum              = 0;
+  size_t i                 = 0;
+
+  for (; i + 2 <= samples.size(); i += 2)
+  {
+    uint32_t pair;
+    std::memcpy(&pair, &samples[i], sizeof(pair));
+    sum = __smlad(pair, kOnes, sum);
+  }
+
+  if (i < samples.size())
+  {
+    sum += samples[i];
+  }
+
+  return sum;
+}
+#endif
+}  // namespace internal
+
+/// Calculates the sum of a span of integers using integer accumulation. The
+/// result is exact for any number of samples that fit in 64 bits.
+///
+/// On cores with the ARM DSP extension, signed 16 bit samples are summed two
+/// at a time.
+///
+/// @tparam T - integer type of the samples.
+/// @param samples - the values to sum.
+/// @return the sum as a 64 bit integer of the same signedness as T.
+template <std::integral T>
+constexpr auto BlockSum(std::span<const T> samples)
+{
+  using Sum_t = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+  Sum_t sum   = 0;
+
+  while (!samples.empty())
+  {
+    const size_t kLength = std::min(samples.size(), internal::kBlockSumChunk);
+    const auto kChunk    = samples.first(kLength);
+
+#if defined(__ARM_FEATURE_DSP)
+    if constexpr (std::is_same_v<T, int16_t>)
+    {
+      if (!std::is_constant_evaluated())
+      {
+        sum += internal::ArmBlockSumChunk(kChunk);
+        samples = samples.subspan(kLength);
+        continue;
+      }
+    }
+#endif
+
+    if constexpr (sizeof(T) <= 2)
+    {
+      sum += internal::BlockSumChunk(kChunk);
+    }
+    else
+    {
+      for (const auto & sample : kChunk)
+      {
+        sum += sample;
+      }
+    }
+    samples = samples.subspan(kLength);
+  }
+
+  return sum;
+}
+
+/// Calculates the average of a span of integers using integer accumulation,
+/// for filtering blocks of samples, such as an ADC buffer, without converting
+/// each sample to a float.
+///
+/// USAGE:
+///
+///    std::array<uint16_t, 64> samples;
+///    adc.ReadSamples(samples);
+///    uint16_t average = sjsu::BlockAverage<uint16_t>(samples);
+///
+/// @tparam T - integer type of the samples.
+/// @param samples - the values to average.
+/// @return T - the average, rounded toward zero, or 0 if `samples` is empty.
+template <std::integral T>
+constexpr T BlockAverage(std::span<const T> samples)
+{
+  if (samples.empty())
+  {
+    return 0;
+  }
+
+  using Sum_t = decltype(BlockSum(samples));
+  return static_cast<T>(BlockSum(samples) /
+                        static_cast<Sum_t>(samples.size()));
+}
+
+/// A moving average of the last `kWindow` samples, updated in constant time
+/// by keeping the samples in a ring buffer along with their running sum.
+///
+/// USAGE:
+///
+///    sjsu::MovingAverage<uint16_t, 16> filter;
+///    uint16_t filtered = filter.Add(static_cast<uint16_t>(adc.Read()));
+///
+/// @tparam T - integer type of the samples.
+/// @tparam kWindow - number of samples to average. Powers of 2 make the
+///         division a shift.
+template <std::integral T, size_t kWindow>
+class MovingAverage
+{
+ public:
+  static_assert(kWindow > 0, "The window must hold at least one sample.");
+
+  /// Type of the running sum, which is 32 bits wide where possible.
+  using Sum_t = internal::Accumulator_t<T, kWindow>;
+
+  /// Add a sample, replacing the oldest sample once the window is full.
+  ///
+  /// @param sample - the new sample.
+  /// @return T - the average of the samples in the window.
+  constexpr T Add(T sample)
+  {
+    sum_ = static_cast<Sum_t>(sum_ - samples_[index_] + sample);
+    samples_[index_] = sample;
+    index_           = (index_ + 1 == kWindow) ? 0 : index_ + 1;
+    count_           = std::min(count_ + 1, kWindow);
+    return Average();
+  }
+
+  /// @return T - the average of the samples in the window, rounded toward
+  ///         zero, or 0 if no samples have been added.
+  constexpr T Average() const
+  {
+    if (IsFull())
+    {
+      return static_cast<T>(sum_ / static_cast<Sum_t>(kWindow));
+    }
+    if (count_ == 0)
+    {
+      return 0;
+    }
+    return static_cast<T>(sum_ / static_cast<Sum_t>(count_));
+  }
+
+  /// @return Sum_t - the sum of the samples in the window.
+  constexpr Sum_t Sum() const
+  {
+    return sum_;
+  }
+
+  /// @return size_t - the number of samples in the window.
+  constexpr size_t Count() const
+  {
+    return count_;
+  }
+
+  /// @return true - if the window holds kWindow samples.
+  constexpr bool IsFull() const
+  {
+    return count_ == kWindow;
+  }
+
+  /// Remove every sample from the window.
+  constexpr void Reset()
+  {
+    samples_ = {};
+    sum_     = 0;
+    index_   = 0;
+    count_   = 0;
+  }
+
+ private:
+  std::array<T, kWindow> samples_ = {};
+  Sum_t sum_                      = 0;
+  size_t index_                   = 0;
+  size_t count_                   = 0;
+};
+
+/// An exponential moving average with a smoothing factor of 1 / 2^kShift,
+/// computed with integer adds and shifts.
+///
+/// The average is kept scaled by 2^kShift, so that no precision is lost to
+/// the shift between samples. Each sample moves the average 1 / 2^kShift of
+/// the way toward it, which takes roughly 2^kShift samples to settle.
+///
+/// USAGE:
+///
+///    sjsu::ExponentialMovingAverage<4, uint16_t> filter;
+///    uint16_t filtered = filter.Add(static_cast<uint16_t>(adc.Read()));
+///
+/// @tparam kShift - log2 of the inverse of the smoothing factor.
+/// @tparam T - integer type of the samples.
+template <int kShift, std::integral T = int32_t>
+class ExponentialMovingAverage
+{
+ public:
+  static_assert(kShift >= 0 && kShift < 32, "The shift must be 0 to 31.");
+
+  /// Type of the scaled average, which is 32 bits wide where possible.
+  using Accumulator_t =
+      std::conditional_t<(sizeof(T) <= 2 && kShift <= 14), int32_t, int64_t>;
+
+  /// @param initial - the average before any samples are added.
+  constexpr explicit ExponentialMovingAverage(T initial = 0)
+  {
+    Reset(initial);
+  }
+
+  /// @param sample - the new sample.
+  /// @return T - the updated average.
+  constexpr T Add(T sample)
+  {
+    accumulator_ += static_cast<Accumulator_t>(sample) - Average();
+    return Average();
+  }
+
+  /// @return T - the current average, rounded down.
+  constexpr T Average() const
+  {
+    return static_cast<T>(accumulator_ >> kShift);
+  }
+
+  /// @param initial - the new average, such as the first sample, to avoid
+  ///        settling from 0.
+  constexpr void Reset(T initial = 0)
+  {
+    accumulator_ = static_cast<Accumulator_t>(initial) << kShift;
+  }
+
+ private:
+  Accumulator_t accumulator_ = 0;
+};
+
+/// Running count, mean, variance, minimum and maximum of a stream of samples,
+/// updated in constant time and memory with Welford's algorithm, which does
+/// not suffer from the cancellation of summing squares.
+///
+/// USAGE:
+///
+///    sjsu::RunningStatistics<float> noise;
+///    for (auto sample : samples)
+///    {
+///      noise.Add(sample);
+///    }
+///    float deviation = noise.StandardDeviation();
+///
+/// @tparam Float - floating point type to compute the statistics in.
+template <std::floating_point Float = float>
+class RunningStatistics
+{
+ public:
+  /// @param sample - the new sample.
+  constexpr void Add(Float sample)
+  {
+    count_++;
+    const Float kDelta = sample - mean_;
+    mean_ += kDelta / static_cast<Float>(count_);
+    sum_of_squares_ += kDelta * (sample - mean_);
+    minimum_ = std::min(minimum_, sample);
+    maximum_ = std::max(maximum_, sample);
+  }
+
+  /// @return size_t - the number of samples added.
+  constexpr size_t Count() const
+  {
+    return count_;
+  }
+
+  /// @return Float - the mean of the samples, or 0 if there are none.
+  constexpr Float Mean() const
+  {
+    return mean_;
+  }
+
+  /// @return Float - the sample variance, or 0 for fewer than 2 samples.
+  constexpr Float Variance() const
+  {
+    if (count_ < 2)
+    {
+      return 0;
+    }
+    return sum_of_squares_ / static_cast<Float>(count_ - 1);
+  }
+
+  /// @return Float - the square root of the sample variance.
+  Float StandardDeviation() const
+  {
+    return std::sqrt(Variance());
+  }
+
+  /// @return Float - the smallest sample, or +infinity if there are none.
+  constexpr Float Minimum() const
+  {
+    return minimum_;
+  }
+
+  /// @return Float - the largest sample, or -infinity if there are none.
+  constexpr Float Maximum() const
+  {
+    return maximum_;
+  }
+
+  /// Forget every sample added.
+  constexpr void Reset()
+  {
+    *this = RunningStatistics();
+  }
+
+ private:
+  size_t count_         = 0;
+  Float mean_           = 0;
+  Float sum_of_squares_ = 0;
+  Float minimum_        = std::numeric_limits<Float>::infinity();
+  Float maximum_        = -std::numeric_limits<Float>::infinity();
+};
 }  // namespace sjsu
@@ -1,4 +1,6 @@
+#include <array>
 #include <cstdint>
+#include <vector>
 
 #include <libcore/testing/testing_frameworks.hpp>
 #include <libcore/utility/math/average.hpp>
@@ -53,4 +55,137 @@ TEST_CASE("Testing Average Function")
   const float kAvgSix = Average(kArray2, std::size(kArray2));
   APPROX_EQUALITY(kExpectedSix, kAvgSix, kResolution);
 }
+
+TEST_CASE("Testing BlockSum and BlockAverage")
+{
+  SECTION("Sums are exact in integers")
+  {
+    // Setup
+    // Over 65536 samples, so that more than one chunk is summed.
+    std::vector<uint16_t> samples(70'000, 65535);
+    samples[7] = 0;
+
+    // Exercise
+    uint64_t sum = BlockSum<uint16_t>(samples);
+
+    // Verify
+    CHECK(uint64_t{ 65535 } * 69'999 == sum);
+  }
+
+  SECTION("Signed samples")
+  {
+    // Setup
+    constexpr std::array<int16_t, 5> kSamples = { -32768, -2, 7, 3, -5 };
+
+    // Exercise
+    constexpr int64_t kSum = BlockSum<int16_t>(kSamples);
+    const int16_t kMean    = BlockAverage<int16_t>(kSamples);
+
+    // Verify
+    static_assert(-32765 == kSum);
+    CHECK(-6553 == kMean);
+    CHECK(0 == BlockAverage<int16_t>({}));
+  }
+}
+
+TEST_CASE("Testing MovingAverage")
+{
+  // Setup
+  MovingAverage<uint16_t, 4> filter;
+
+  SECTION("Averages the samples added until the window is full")
+  {
+    // Exercise & Verify
+    CHECK(0 == filter.Average());
+    CHECK(10 == filter.Add(10));
+    CHECK(15 == filter.Add(20));
+    CHECK(!filter.IsFull());
+  }
+
+  SECTION("Replaces the oldest sample")
+  {
+    // Setup
+    for (uint16_t sample : { 65535, 65535, 65535, 65535 })
+    {
+      filter.Add(sample);
+    }
+
+    // Exercise
+    uint16_t average = filter.Add(3);
+
+    // Verify
+    static_assert(std::is_same_v<uint32_t, decltype(filter)::Sum_t>);
+    CHECK(filter.IsFull());
+    CHECK(65535 * 3 + 3 == filter.Sum());
+    CHECK((65535 * 3 + 3) / 4 == average);
+  }
+
+  SECTION("Reset() empties the window")
+  {
+    // Setup
+    filter.Add(100);
+
+    // Exercise
+    filter.Reset();
+
+    // Verify
+    CHECK(0 == filter.Count());
+    CHECK(1 == filter.Add(1));
+  }
+}
+
+TEST_CASE("Testing ExponentialMovingAverage")
+{
+  SECTION("Moves toward each sample by the smoothing factor")
+  {
+    // Setup
+    ExponentialMovingAverage<2> filter(100);
+
+    // Exercise
+    int32_t first = filter.Add(200);
+
+    // Verify
+    CHECK(125 == first);
+  }
+
+  SECTION("Settles at a constant input")
+  {
+    // Setup
+    ExponentialMovingAverage<4, uint16_t> filter;
+
+    // Exercise
+    uint16_t average = 0;
+    for (int i = 0; i < 400; i++)
+    {
+      average = filter.Add(4000);
+    }
+
+    // Verify
+    static_assert(std::is_same_v<int32_t, decltype(filter)::Accumulator_t>);
+    CHECK(4000 - average <= 1);
+  }
+}
+
+TEST_CASE("Testing RunningStatistics")
+{
+  // Setup
+  RunningStatistics<double> statistics;
+
+  // Exercise
+  for (double sample : { 2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0 })
+  {
+    statistics.Add(sample);
+  }
+
+  // Verify
+  CHECK(8 == statistics.Count());
+  CHECK(5.0 == doctest::Approx(statistics.Mean()));
+  CHECK(32.0 / 7.0 == doctest::Approx(statistics.Variance()));
+  CHECK(2.0 == statistics.Minimum());
+  CHECK(9.0 == statistics.Maximum());
+
+  statistics.Reset();
+  CHECK(0 == statistics.Count());
+  CHECK(0 == statistics.Variance());
+}
 }  // namespace sjsu
@@ -0,0 +1,32 @@
+#include <libcore/testing/benchmark.hpp>
+#include <libcore/utility/math/bit.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+SJ2_BENCHMARK("bit::StreamExtract<uint32_t> unaligned")
+{
+  std::array<uint8_t, 8> stream = { 0xAB, 0xCD, 0xEF, 0x01,
+                                    0x23, 0x45, 0x67, 0x89 };
+  return benchmark::Run(name, [&stream]() {
+    benchmark::DoNotOptimize(stream);
+    benchmark::DoNotOptimize(bit::StreamExtract<uint32_t>(
+        stream.data(), stream.size(), { .position = 5, .width = 27 }));
+  });
+}
+
+SJ2_BENCHMARK("bit::StreamExtract<uint16_t> big endian")
+{
+  std::array<uint8_t, 8> stream = { 0xAB, 0xCD, 0xEF, 0x01,
+                                    0x23, 0x45, 0x67, 0x89 };
+  return benchmark::Run(name, [&stream]() {
+    benchmark::DoNotOptimize(stream);
+    benchmark::DoNotOptimize(
+        bit::StreamExtract<uint16_t>(stream.data(),
+                                     stream.size(),
+                                     { .position = 12, .width = 16 },
+                                     Endian::kBig));
+  });
+}
+}  // namespace sjsu
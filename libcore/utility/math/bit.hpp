@@ -3,10 +3,13 @@
 /// manipulation on target registers and values easy, expressive, and readable.
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <type_traits>
 
 namespace sjsu
@@ -468,9 +471,15 @@ constexpr T StreamExtract(const uint8_t * stream,
     next_byte_ptr += scan_direction;
     T finished_byte = 0;
 
-    if (kShiftAmount > 0)
+    if (kShiftAmount >= std::numeric_limits<T>::digits)
     {
-      finished_byte = kNextByte << kShiftAmount;
+      // The byte only holds bits beyond the width of T. Shifting by more than
+      // the width of the promoted type is undefined, so skip it.
+      break;
+    }
+    else if (kShiftAmount > 0)
+    {
+      finished_byte = static_cast<T>(static_cast<T>(kNextByte) << kShiftAmount);
     }
     else
     {
@@ -503,6 +512,432 @@ constexpr T StreamExtract(const std::array<uint8_t, size> & stream,
   return StreamExtract<T>(stream.data(), stream.size(), mask, endian);
 }
 
+namespace detail
+{
+/// Load 8 consecutive bytes of a byte stream into an integer with the byte at
+/// `first` being the least significant. "Consecutive" follows the ordering of
+/// StreamExtract(): for Endian::kBig the bytes are taken going forward from
+/// `stream[first]`, and for Endian::kLittle going backwards from
+/// `stream[size - 1 - first]`. Bytes beyond the end of the stream are zero.
+///
+/// @param stream - byte stream to load from.
+/// @param first - index, in significance order, of the first byte to load.
+/// @param endian - byte ordering of the stream.
+/// @return constexpr uint64_t - the loaded bytes.
+constexpr uint64_t StreamLoad(std::span<const uint8_t> stream,
+                              size_t first,
+                              Endian endian)
+{
+  uint64_t window = 0;
+
+  if (first + sizeof(window) <= stream.size())
+  {
+    // The whole window is within the stream, so load it with a single copy and
+    // at most one byte swap rather than one shift per byte.
+    std::array<uint8_t, sizeof(window)> bytes;
+    std::endian stream_order = std::endian::little;
+
+    if (endian == Endian::kBig)
+    {
+      std::copy_n(stream.begin() + first, bytes.size(), bytes.begin());
+    }
+    else
+    {
+      std::copy_n(
+          stream.end() - first - bytes.size(), bytes.size(), bytes.begin());
+      stream_order = std::endian::big;
+    }
+
+    window = std::bit_cast<uint64_t>(bytes);
+
+    if (stream_order != std::endian::native)
+    {
+      window = __builtin_bswap64(window);
+    }
+
+    return window;
+  }
+
+  for (size_t i = 0; i < sizeof(window) && first + i < stream.size(); i++)
+  {
+    const size_t kIndex = (endian == Endian::kBig)
+                              ? first + i
+                              : stream.size() - 1 - (first + i);
+    window |= static_cast<uint64_t>(stream[kIndex]) << (8 * i);
+  }
+
+  return window;
+}
+
+/// @param width - number of bits, up to 64.
+/// @return constexpr uint64_t - value with the lower `width` bits set.
+constexpr uint64_t StreamWidthMask(uint32_t width)
+{
+  return (width >= 64) ? std::numeric_limits<uint64_t>::max()
+                       : ((uint64_t{ 1 } << width) - 1);
+}
+}  // namespace detail
+
+/// Extract several fields from a byte stream in a single pass.
+///
+/// Produces the same results as calling StreamExtract() for each mask, but
+/// loads the stream up to 8 bytes at a time and reuses the loaded bytes for
+/// every following field that lies within them. This is significantly faster
+/// when decoding structures with many packed fields such as CAN signals or an
+/// SD card's CSD and CID registers. Listing the masks in ascending position
+/// order gives the most reuse.
+///
+/// Usage:
+///
+///    auto [c_size, block_length] =
+///        bit::StreamExtractFields<uint32_t>(csd, { kCSize, kBlockLength });
+///
+/// @tparam T - numeric type of each field. Can only be uint8_t, 16, 32 and 64.
+/// @tparam N - number of fields. Deduced from `masks`.
+/// @param stream - byte array containing the bits to be extracted.
+/// @param masks - locations of each field within the stream.
+/// @param endian - indicates if the stream is little or big endian.
+/// @return constexpr std::array<T, N> - the extracted fields, in the same order
+///         as `masks`.
+template <typename T, size_t N>
+constexpr std::array<T, N> StreamExtractFields(
+    std::span<const uint8_t> stream,
+    const Mask (&masks)[N],
+    Endian endian = Endian::kLittle)
+{
+  static_assert(
+      std::is_same<T, uint8_t>::value || std::is_same<T, uint16_t>::value ||
+          std::is_same<T, uint32_t>::value || std::is_same<T, uint64_t>::value,
+      "only unsigned integers are allowed to be used in "
+      "sjsu::bit::StreamExtractFields().");
+
+  std::array<T, N> fields       = {};
+  uint64_t window               = 0;
+  size_t window_start           = 0;
+  bool window_loaded            = false;
+  constexpr size_t kWindowBytes = sizeof(window);
+
+  for (size_t i = 0; i < N; i++)
+  {
+    const Mask kMask          = masks[i];
+    const size_t kFirstByte   = kMask.position / 8;
+    const size_t kOffset      = kMask.position % 8;
+    const size_t kBytesNeeded = (kOffset + kMask.width + 7) / 8;
+
+    // Reload the window only if this field is not already within it.
+    if (!window_loaded || kFirstByte < window_start ||
+        kFirstByte + std::min(kBytesNeeded, kWindowBytes) >
+            window_start + kWindowBytes)
+    {
+      window        = detail::StreamLoad(stream, kFirstByte, endian);
+      window_start  = kFirstByte;
+      window_loaded = true;
+    }
+
+    const size_t kShift = ((kFirstByte - window_start) * 8) + kOffset;
+    uint64_t field      = window >> kShift;
+
+    // A 64-bit field that is not byte aligned spans 9 bytes. Its upper bits
+    // are in the byte following the window.
+    if (kShift + kMask.width > 64)
+    {
+      const uint64_t kNext = detail::StreamLoad(
+          stream, window_start + kWindowBytes, endian);
+      field |= kNext << (64 - kShift);
+    }
+
+    fields[i] = static_cast<T>(field & detail::StreamWidthMask(kMask.width));
+  }
+
+  return fields;
+}
+
+/// Extract a field from a byte stream, loading up to 8 bytes at a time. Same
+/// result as StreamExtract(), see StreamExtractFields() for details.
+///
+/// @tparam T - numeric type to be returned. Can only be uint8_t, 16, 32 and 64.
+/// @param stream - byte array containing the bits to be extracted.
+/// @param mask - the mask containing the location of the bits to be extracted.
+/// @param endian - indicates if the value is little or big endian.
+/// @return constexpr T - bits extracted from the stream.
+template <typename T>
+constexpr T StreamExtractField(std::span<const uint8_t> stream,
+                               Mask mask,
+                               Endian endian = Endian::kLittle)
+{
+  return StreamExtractFields<T>(stream, { mask }, endian)[0];
+}
+
+/// Insert a value into a set of contiguous bits of a byte stream. This is the
+/// inverse of StreamExtract() and uses the same bit numbering. Bits of the
+/// stream outside of the mask are left untouched, as are any bits of the mask
+/// that are beyond the end of the stream.
+///
+/// Usage:
+///
+///    std::array<uint8_t, 8> frame = {};
+///    bit::StreamInsert(frame, { .position = 12, .width = 10 }, rpm);
+///
+/// @param stream - byte array to insert the bits into.
+/// @param mask - the location within the stream to insert the value into.
+/// @param value - the value to insert. Only the lower `mask.width` bits are
+///        used.
+/// @param endian - indicates if the stream is little or big endian.
+constexpr void StreamInsert(std::span<uint8_t> stream,
+                            Mask mask,
+                            uint64_t value,
+                            Endian endian = Endian::kLittle)
+{
+  const size_t kFirstByte = mask.position / 8;
+  const size_t kOffset    = mask.position % 8;
+  const size_t kLastBit   = kOffset + mask.width;
+
+  value &= detail::StreamWidthMask(mask.width);
+
+  // Walk each byte the field touches, merging in the bits of the value that
+  // belong to that byte.
+  for (size_t bit = 0; bit < kLastBit; bit += 8)
+  {
+    const size_t kByte = kFirstByte + (bit / 8);
+
+    if (kByte >= stream.size())
+    {
+      break;
+    }
+
+    // Portion of the field that lands in this byte, in the byte's bit
+    // positions.
+    const size_t kLow        = (bit == 0) ? kOffset : 0;
+    const size_t kHigh       = std::min<size_t>(kLastBit - bit, 8);
+    const uint8_t kByteMask  = static_cast<uint8_t>(
+        detail::StreamWidthMask(static_cast<uint32_t>(kHigh - kLow)) << kLow);
+    const size_t kValueShift = bit + kLow - kOffset;
+    const uint8_t kBits =
+        static_cast<uint8_t>((value >> kValueShift) << kLow) & kByteMask;
+
+    const size_t kIndex = (endian == Endian::kBig)
+                              ? kByte
+                              : stream.size() - 1 - kByte;
+    stream[kIndex] =
+        static_cast<uint8_t>((stream[kIndex] & ~kByteMask) | kBits);
+  }
+}
+
+/// A bit field whose position and width are part of its type, so that
+/// extracting and inserting it compiles to a constant shift and mask, even
+/// where the call is not inlined. Converts to a Mask for the functions that
+/// take one.
+///
+/// USAGE:
+///
+///    using kMode   = sjsu::bit::Field<0, 3>;
+///    using kEnable = sjsu::bit::Field<7>;
+///
+///    uint32_t mode = kMode::Extract(reg);
+///    reg = sjsu::bit::InsertFields<kMode, kEnable>(reg, 0b101, 1);
+///
+/// @tparam kPosition - the first bit of the field.
+/// @tparam kWidth - number of bits of the field.
+template <uint32_t kPosition, uint32_t kWidth = 1>
+struct Field
+{
+  static_assert(kWidth > 0 && kPosition + kWidth <= 64,
+                "Field must be between 1 and 64 bits within 64 bits.");
+
+  /// The first bit of the field.
+  static constexpr uint32_t kFieldPosition = kPosition;
+
+  /// Number of bits of the field.
+  static constexpr uint32_t kFieldWidth = kWidth;
+
+  /// The field as a Mask.
+  static constexpr Mask kMask = { .position = kPosition, .width = kWidth };
+
+  /// @tparam T - type of the register.
+  /// @return T - the bits of the field in place.
+  template <typename T>
+  static constexpr T Bits()
+  {
+    static_assert(kPosition + kWidth <= sizeof(T) * 8,
+                  "Field does not fit in the register type.");
+    constexpr uint64_t kOnes =
+        (kWidth == 64) ? ~uint64_t{ 0 } : (uint64_t{ 1 } << kWidth) - 1;
+    return static_cast<T>(kOnes << kPosition);
+  }
+
+  /// @param target - the register value.
+  /// @return T - the value of the field.
+  template <typename T>
+  [[nodiscard]] static constexpr T Extract(T target)
+  {
+    using UnsignedT = std::make_unsigned_t<T>;
+    return static_cast<T>((static_cast<UnsignedT>(target) & Bits<T>()) >>
+                          kPosition);
+  }
+
+  /// @param value - value of the field.
+  /// @return T - the value in place, with every other bit 0.
+  template <typename T, typename U>
+  [[nodiscard]] static constexpr T Encode(U value)
+  {
+    using UnsignedT = std::make_unsigned_t<T>;
+    return static_cast<T>((static_cast<UnsignedT>(value) << kPosition) &
+                          static_cast<UnsignedT>(Bits<T>()));
+  }
+
+  /// @param target - the register value.
+  /// @param value - value to insert into the field.
+  /// @return T - `target` with the field replaced by `value`.
+  template <typename T, typename U>
+  [[nodiscard]] static constexpr T Insert(T target, U value)
+  {
+    return static_cast<T>((target & ~Bits<T>()) | Encode<T>(value));
+  }
+
+  /// @return Mask - the field as a Mask.
+  constexpr operator Mask() const
+  {
+    return kMask;
+  }
+};
+
+/// Insert the values of several fields with one mask, such as to build the
+/// value of a register that is then written once.
+///
+/// @tparam Fields - the fields, in the order of the values.
+/// @param target - the register value.
+/// @param values - the value of each field.
+/// @return T - `target` with each field replaced by its value.
+template <class... Fields, typename T, typename... U>
+[[nodiscard]] constexpr T InsertFields(T target, U... values)
+{
+  static_assert(sizeof...(Fields) == sizeof...(U),
+                "InsertFields needs a value for every field.");
+  constexpr T kMask =
+      static_cast<T>((T{ 0 } | ... | Fields::template Bits<T>()));
+  return static_cast<T>((target & ~kMask) |
+                        (T{ 0 } | ... | Fields::template Encode<T>(values)));
+}
+
+namespace detail
+{
+template <typename>
+struct MemberPointer_t;
+
+template <typename Class, typename Member>
+struct MemberPointer_t<Member Class::*>
+{
+  using Struct_t = Class;
+  using Member_t = Member;
+};
+}  // namespace detail
+
+/// Binds a member of a structure to a Field of a register, for Layout.
+///
+/// @tparam kMember - pointer to the member.
+/// @tparam FieldType - the Field holding the member.
+template <auto kMember, class FieldType>
+struct MemberField
+{
+  /// The structure the member belongs to.
+  using Struct_t =
+      typename detail::MemberPointer_t<decltype(kMember)>::Struct_t;
+  /// The type of the member.
+  using Member_t =
+      typename detail::MemberPointer_t<decltype(kMember)>::Member_t;
+  /// The field of the member.
+  using Field_t = FieldType;
+  /// Pointer to the member.
+  static constexpr auto kPointer = kMember;
+};
+
+/// The layout of a register as a structure, with a MemberField for each
+/// field, to decode a whole register value into a structure and to encode it
+/// back in one write. Members may be integers, bools or enums.
+///
+/// USAGE:
+///
+///    struct Status_t
+///    {
+///      bool ready;
+///      Mode mode;
+///      uint8_t count;
+///    };
+///
+///    using StatusLayout = sjsu::bit::Layout<
+///        sjsu::bit::MemberField<&Status_t::ready, sjsu::bit::Field<0>>,
+///        sjsu::bit::MemberField<&Status_t::mode, sjsu::bit::Field<1, 2>>,
+///        sjsu::bit::MemberField<&Status_t::count, sjsu::bit::Field<8, 8>>>;
+///
+///    Status_t status = StatusLayout::Decode(device->STATUS);
+///    status.mode     = Mode::kFast;
+///    device->STATUS  = StatusLayout::Insert(device->STATUS, status);
+///
+/// @tparam Members - MemberField for each field of the structure.
+template <class First, class... Members>
+struct Layout
+{
+  /// The structure described by the layout.
+  using Struct_t = typename First::Struct_t;
+
+  static_assert((std::is_same_v<Struct_t, typename Members::Struct_t> && ...),
+                "Every member of a Layout must be of the same structure.");
+
+  /// @tparam T - type of the register.
+  /// @return T - the bits of every field of the layout.
+  template <typename T>
+  static constexpr T Bits()
+  {
+    return static_cast<T>(First::Field_t::template Bits<T>() |
+                          (T{ 0 } | ... |
+                           Members::Field_t::template Bits<T>()));
+  }
+
+  /// @param value - the register value.
+  /// @return Struct_t - the value of each field of the register.
+  template <typename T>
+  [[nodiscard]] static constexpr Struct_t Decode(T value)
+  {
+    Struct_t result{};
+    DecodeMember<First>(result, value);
+    (DecodeMember<Members>(result, value), ...);
+    return result;
+  }
+
+  /// @param fields - the value of each field.
+  /// @return T - the register value with each field, and every other bit 0.
+  template <typename T>
+  [[nodiscard]] static constexpr T Encode(const Struct_t & fields)
+  {
+    return static_cast<T>(EncodeMember<First, T>(fields) |
+                          (T{ 0 } | ... | EncodeMember<Members, T>(fields)));
+  }
+
+  /// @param target - the register value.
+  /// @param fields - the value of each field.
+  /// @return T - `target` with every field of the layout replaced.
+  template <typename T>
+  [[nodiscard]] static constexpr T Insert(T target, const Struct_t & fields)
+  {
+    return static_cast<T>((target & ~Bits<T>()) | Encode<T>(fields));
+  }
+
+ private:
+  template <class Member, typename T>
+  static constexpr void DecodeMember(Struct_t & result, T value)
+  {
+    result.*Member::kPointer = static_cast<typename Member::Member_t>(
+        Member::Field_t::Extract(value));
+  }
+
+  template <class Member, typename T>
+  static constexpr T EncodeMember(const Struct_t & fields)
+  {
+    return Member::Field_t::template Encode<T>(
+        static_cast<std::make_unsigned_t<T>>(fields.*Member::kPointer));
+  }
+};
+
 // TODO(#1173): Add unit tests for this class.
 ///
 /// @tparam T - the numeric type of the register. This should not be explicitly
@@ -490,5 +490,192 @@ TEST_CASE("Testing Bit Manipulations")
       }
     }
   }
+
+  SECTION("StreamExtractFields")
+  {
+    // Setup
+    std::array<uint8_t, 16> stream;
+    uint8_t seed = 0x5A;
+    for (auto & byte : stream)
+    {
+      seed = static_cast<uint8_t>((seed * 37) + 11);
+      byte = seed;
+    }
+
+    SECTION("Matches StreamExtract() for every position and width")
+    {
+      for (auto endian : { Endian::kLittle, Endian::kBig })
+      {
+        for (uint32_t width = 1; width <= 32; width++)
+        {
+          for (uint32_t position = 0; position + width <= 128; position++)
+          {
+            bit::Mask mask = { .position = position, .width = width };
+            INFO("position = " << position << " :: width = " << width);
+            CHECK(bit::StreamExtract<uint32_t>(stream, mask, endian) ==
+                  bit::StreamExtractField<uint32_t>(stream, mask, endian));
+          }
+        }
+      }
+    }
+
+    SECTION("64-bit unaligned field spans 9 bytes")
+    {
+      bit::Mask mask = { .position = 4, .width = 64 };
+      uint64_t upper = bit::StreamExtractField<uint64_t>(
+          stream, { .position = 36, .width = 32 }, Endian::kBig);
+      uint64_t lower = bit::StreamExtractField<uint64_t>(
+          stream, { .position = 4, .width = 32 }, Endian::kBig);
+
+      CHECK(((upper << 32) | lower) ==
+            bit::StreamExtractField<uint64_t>(stream, mask, Endian::kBig));
+    }
+
+    SECTION("Multiple fields of the SD card CSD register")
+    {
+      constexpr std::array<uint8_t, 16> kCSD = {
+        0x40, 0x0E, 0x00, 0x32, 0x5B, 0x59, 0x00, 0x00,
+        0x3B, 0x37, 0x7F, 0x80, 0x0A, 0x40, 0x40, 0xAF,
+      };
+      constexpr bit::Mask kCSize         = bit::MaskFromRange(48, 69);
+      constexpr bit::Mask kBlockLength   = bit::MaskFromRange(80, 83);
+      constexpr bit::Mask kCsdStructure  = bit::MaskFromRange(126, 127);
+      constexpr bit::Mask kTransferSpeed = bit::MaskFromRange(96, 103);
+
+      constexpr auto kFields = bit::StreamExtractFields<uint32_t>(
+          kCSD, { kCSize, kBlockLength, kCsdStructure, kTransferSpeed });
+
+      static_assert(kFields[0] == 0x3B37);
+      CHECK(bit::StreamExtract<uint32_t>(kCSD, kCSize) == kFields[0]);
+      CHECK(bit::StreamExtract<uint32_t>(kCSD, kBlockLength) == kFields[1]);
+      CHECK(bit::StreamExtract<uint32_t>(kCSD, kCsdStructure) == kFields[2]);
+      CHECK(bit::StreamExtract<uint32_t>(kCSD, kTransferSpeed) == kFields[3]);
+    }
+  }
+
+  SECTION("StreamInsert")
+  {
+    SECTION("Round trips with StreamExtract() and preserves other bits")
+    {
+      for (auto endian : { Endian::kLittle, Endian::kBig })
+      {
+        for (uint32_t width = 1; width <= 32; width++)
+        {
+          for (uint32_t position = 0; position + width <= 64; position++)
+          {
+            // Setup
+            std::array<uint8_t, 8> stream;
+            stream.fill(0xA5);
+            const std::array<uint8_t, 8> kOriginal = stream;
+
+            bit::Mask mask = { .position = position, .width = width };
+            uint32_t value = 0x13579BDF;
+
+            // Exercise
+            bit::StreamInsert(stream, mask, value, endian);
+
+            // Verify
+            INFO("position = " << position << " :: width = " << width);
+            CHECK(bit::Extract(value, { .position = 0, .width = width }) ==
+                  bit::StreamExtract<uint32_t>(stream, mask, endian));
+
+            // Restoring the original bits must give back the original stream
+            bit::StreamInsert(stream,
+                              mask,
+                              bit::StreamExtract<uint32_t>(
+                                  kOriginal, mask, endian),
+                              endian);
+            CHECK(kOriginal == stream);
+          }
+        }
+      }
+    }
+
+    SECTION("Usable in constant expressions")
+    {
+      constexpr auto kFrame = []() {
+        std::array<uint8_t, 2> frame = {};
+        bit::StreamInsert(frame, { .position = 4, .width = 8 }, 0xAB);
+        return frame;
+      }();
+
+      static_assert(kFrame == std::array<uint8_t, 2>{ 0x0A, 0xB0 });
+    }
+  }
+}
+
+namespace
+{
+enum class FieldMode : uint8_t
+{
+  kSlow = 1,
+  kFast = 2,
+};
+
+struct FieldStatus_t
+{
+  bool ready;
+  FieldMode mode;
+  uint8_t count;
+};
+
+using FieldStatusLayout = bit::Layout<
+    bit::MemberField<&FieldStatus_t::ready, bit::Field<0>>,
+    bit::MemberField<&FieldStatus_t::mode, bit::Field<1, 2>>,
+    bit::MemberField<&FieldStatus_t::count, bit::Field<8, 8>>>;
+}  // namespace
+
+TEST_CASE("Testing compile time bit fields")
+{
+  using kLow  = bit::Field<0, 4>;
+  using kHigh = bit::Field<28, 4>;
+
+  SECTION("Field extracts and inserts at its position")
+  {
+    // Verify
+    static_assert(0xF000'000F == (kLow::Bits<uint32_t>() |
+                                  kHigh::Bits<uint32_t>()));
+    static_assert(0xA == kHigh::Extract(uint32_t{ 0xA000'0005 }));
+    static_assert(0x1234'5670 == kLow::Insert(uint32_t{ 0x1234'567F }, 0));
+    CHECK(0x0000'0003 == kLow::Encode<uint32_t>(0x13));
+    CHECK(bit::Mask{ .position = 28, .width = 4 } == bit::Mask(kHigh{}));
+    CHECK(0xC == bit::Extract(uint32_t{ 0xC000'0000 }, kHigh{}));
+  }
+
+  SECTION("Full width fields")
+  {
+    // Verify
+    static_assert(~uint64_t{ 0 } == bit::Field<0, 64>::Bits<uint64_t>());
+    static_assert(0xFF == bit::Field<0, 8>::Extract(uint8_t{ 0xFF }));
+  }
+
+  SECTION("InsertFields replaces several fields at once")
+  {
+    // Exercise
+    constexpr uint32_t kResult =
+        bit::InsertFields<kLow, kHigh>(uint32_t{ 0x5555'5555 }, 0x1, 0xE);
+
+    // Verify
+    static_assert(0xE555'5551 == kResult);
+    CHECK(0xE555'5551 == kResult);
+  }
+
+  SECTION("Layout decodes and encodes a structure")
+  {
+    // Exercise
+    constexpr FieldStatus_t kStatus = FieldStatusLayout::Decode(0xFF2Du);
+    constexpr uint16_t kEncoded     = FieldStatusLayout::Encode<uint16_t>(
+        { .ready = false, .mode = FieldMode::kSlow, .count = 0x12 });
+    constexpr uint32_t kInserted = FieldStatusLayout::Insert(
+        0xFFFF'FFFFu, { .ready = false, .mode = FieldMode::kFast, .count = 0 });
+
+    // Verify
+    CHECK(kStatus.ready);
+    CHECK(FieldMode::kFast == kStatus.mode);
+    CHECK(0xFF == kStatus.count);
+    CHECK(0x1202 == kEncoded);
+    CHECK(0xFFFF'00FC == kInserted);
+    CHECK(0xFF07 == FieldStatusLayout::Bits<uint16_t>());
+  }
 }
 }  // namespace sjsu
@@ -0,0 +1,26 @@
+#include <libcore/testing/benchmark.hpp>
+#include <libcore/utility/math/byte.hpp>
+
+#include <array>
+#include <bit>
+
+namespace sjsu
+{
+SJ2_BENCHMARK("ToByteArray<uint32_t> big endian")
+{
+  uint32_t value = 0x1234'5678;
+  return benchmark::Run(name, [&value]() {
+    benchmark::DoNotOptimize(value);
+    benchmark::DoNotOptimize(ToByteArray(std::endian::big, value));
+  });
+}
+
+SJ2_BENCHMARK("ToInteger<uint32_t> big endian")
+{
+  std::array<uint8_t, 4> bytes = { 0x12, 0x34, 0x56, 0x78 };
+  return benchmark::Run(name, [&bytes]() {
+    benchmark::DoNotOptimize(bytes);
+    benchmark::DoNotOptimize(ToInteger<uint32_t>(std::endian::big, bytes));
+  });
+}
+}  // namespace sjsu
@@ -6,9 +6,86 @@
 #include <climits>
 #include <cstdint>
 #include <span>
+#include <type_traits>
 
 namespace sjsu
 {
+/// Reverse the order of the bytes of an integer. Compiles down to a single
+/// byte reversal instruction on most architectures.
+///
+/// @tparam T - integer type.
+/// @param value - the value to swap.
+/// @return constexpr T - value with its bytes in reverse order.
+template <typename T>
+constexpr T ByteSwap(T value)
+{
+  static_assert(std::is_integral_v<T>,
+                "Type T (the return type) must be intergal type.");
+
+  if constexpr (sizeof(T) == 1)
+  {
+    return value;
+  }
+  else
+  {
+    using Unsigned = std::make_unsigned_t<T>;
+    auto input     = static_cast<Unsigned>(value);
+
+    if constexpr (sizeof(T) == 2)
+    {
+      return static_cast<T>(__builtin_bswap16(input));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+      return static_cast<T>(__builtin_bswap32(input));
+    }
+    else if constexpr (sizeof(T) == 8)
+    {
+      return static_cast<T>(__builtin_bswap64(input));
+    }
+    else
+    {
+      Unsigned result = 0;
+      for (size_t i = 0; i < sizeof(T); i++)
+      {
+        result = static_cast<Unsigned>((result << CHAR_BIT) | (input & 0xFF));
+        input  = static_cast<Unsigned>(input >> CHAR_BIT);
+      }
+      return static_cast<T>(result);
+    }
+  }
+}
+
+/// Reverse the byte order of every integer in a span, in place. The loop is
+/// simple enough for the compiler to vectorize on targets that support it.
+///
+/// @tparam T - integer type.
+/// @param values - integers to swap.
+template <typename T>
+constexpr void ByteSwapInPlace(std::span<T> values)
+{
+  for (auto & value : values)
+  {
+    value = ByteSwap(value);
+  }
+}
+
+/// Convert every integer in a span, in place, between the system's native
+/// endianness and `endian`. Does nothing if they are the same. Since byte
+/// swapping is its own inverse, the same call converts in either direction.
+///
+/// @tparam T - integer type.
+/// @param endian - the non-native endianness of the values.
+/// @param values - integers to convert.
+template <typename T>
+constexpr void ConvertEndianInPlace(std::endian endian, std::span<T> values)
+{
+  if (endian != std::endian::native)
+  {
+    ByteSwapInPlace(values);
+  }
+}
+
 /// Convert a numeric value into an array of bytes.
 ///
 /// @tparam T - value to be converted into an array of bytes
@@ -25,7 +102,18 @@ constexpr auto ToByteArray(std::endian endian, T value)
   std::array<uint8_t, array_size> array = {};
   static_assert(std::is_integral_v<T>,
                 "Type T (the return type) must be intergal type.");
-  if constexpr (std::is_integral_v<T>)
+  if constexpr (std::is_integral_v<T> && array_size == sizeof(T) &&
+                !std::is_same_v<T, bool>)
+  {
+    // The array is exactly the size of the value, so its bytes are the bytes
+    // of the value in memory, swapped if the endianness differs.
+    if (endian != std::endian::native)
+    {
+      value = ByteSwap(value);
+    }
+    array = std::bit_cast<std::array<uint8_t, array_size>>(value);
+  }
+  else if constexpr (std::is_integral_v<T>)
   {
     if (endian == std::endian::little)
     {
@@ -87,6 +175,19 @@ constexpr auto ToInteger(std::endian endian, std::span<const uint8_t> array)
   static_assert(std::is_integral_v<T>,
                 "Type T (the return type) must be intergal type.");
   T value = 0;
+  if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+  {
+    if (array.size() == sizeof(T))
+    {
+      // Load the whole value at once. The copy into a local array is optimized
+      // into a single (possibly unaligned) load.
+      std::array<uint8_t, sizeof(T)> bytes;
+      std::copy_n(array.begin(), sizeof(T), bytes.begin());
+      value = std::bit_cast<T>(bytes);
+      return (endian == std::endian::native) ? value : ByteSwap(value);
+    }
+  }
+
   if constexpr (std::is_integral_v<T>)
   {
     size_t end = std::min(sizeof(T), array.size());
@@ -129,6 +230,21 @@ constexpr auto ToIntegerArray(std::endian endian,
   std::array<T, N> value = { 0 };
   std::span<const uint8_t> byte_span;
 
+  if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                sizeof(value) == N * sizeof(T))
+  {
+    if (bytes.size() == sizeof(value))
+    {
+      // Reinterpret every byte at once, then fix up the byte order of all of
+      // the integers in a single pass.
+      std::array<uint8_t, sizeof(value)> buffer;
+      std::copy_n(bytes.begin(), buffer.size(), buffer.begin());
+      value = std::bit_cast<std::array<T, N>>(buffer);
+      ConvertEndianInPlace(endian, std::span<T>(value));
+      return value;
+    }
+  }
+
   if constexpr (std::is_integral_v<T>)
   {
     for (size_t i = 0; i < bytes.size(); i += sizeof(T))
@@ -1,3 +1,4 @@
+#include <array>
 #include <cstdint>
 
 #include <libcore/testing/testing_frameworks.hpp>
@@ -9,7 +10,101 @@ TEST_CASE("Testing ToByteArray")
 {
   SECTION("uint32_t values")
   {
-    // constexpr uint32_t kTestValue = 0x01020304;
+    constexpr uint32_t kTestValue = 0x01020304;
+
+    constexpr auto kLittle = ToByteArray(std::endian::little, kTestValue);
+    constexpr auto kBig    = ToByteArray(std::endian::big, kTestValue);
+
+    static_assert(kLittle == std::array<uint8_t, 4>{ 0x04, 0x03, 0x02, 0x01 });
+    static_assert(kBig == std::array<uint8_t, 4>{ 0x01, 0x02, 0x03, 0x04 });
+    CHECK(ToByteArray(std::endian::little, kTestValue) == kLittle);
+    CHECK(ToByteArray(std::endian::big, kTestValue) == kBig);
+  }
+
+  SECTION("Array wider than the value")
+  {
+    constexpr auto kBig = ToByteArray<uint16_t, 4>(std::endian::big, 0xABCD);
+
+    CHECK(kBig == std::array<uint8_t, 4>{ 0x00, 0x00, 0xAB, 0xCD });
+  }
+}
+
+TEST_CASE("Testing ToInteger")
+{
+  constexpr std::array<uint8_t, 4> kBytes = { 0x01, 0x02, 0x03, 0x04 };
+
+  SECTION("Full width")
+  {
+    static_assert(ToInteger<uint32_t>(std::endian::big, kBytes) == 0x01020304);
+    CHECK(0x01020304 == ToInteger<uint32_t>(std::endian::big, kBytes));
+    CHECK(0x04030201 == ToInteger<uint32_t>(std::endian::little, kBytes));
+    CHECK(-2 == ToInteger<int16_t>(std::endian::big,
+                                   std::array<uint8_t, 2>{ 0xFF, 0xFE }));
+  }
+
+  SECTION("Span narrower than the integer")
+  {
+    std::span<const uint8_t> three_bytes(kBytes.data(), 3);
+
+    CHECK(0x010203 == ToInteger<uint32_t>(std::endian::big, three_bytes));
+    CHECK(0x030201 == ToInteger<uint32_t>(std::endian::little, three_bytes));
+  }
+}
+
+TEST_CASE("Testing ToIntegerArray")
+{
+  constexpr std::array<uint8_t, 6> kBytes = { 0x00, 0x01, 0xFF, 0xFE,
+                                              0x7F, 0xFF };
+
+  SECTION("Big endian")
+  {
+    constexpr auto kValues = ToIntegerArray<int16_t, 3>(std::endian::big,
+                                                        kBytes);
+
+    static_assert(kValues == std::array<int16_t, 3>{ 1, -2, 0x7FFF });
+    CHECK(ToIntegerArray<int16_t, 3>(std::endian::big, kBytes) == kValues);
+  }
+
+  SECTION("Little endian")
+  {
+    auto values = ToIntegerArray<uint16_t, 3>(std::endian::little, kBytes);
+
+    CHECK(values == std::array<uint16_t, 3>{ 0x0100, 0xFEFF, 0xFF7F });
+  }
+}
+
+TEST_CASE("Testing ByteSwap")
+{
+  SECTION("Single values")
+  {
+    static_assert(ByteSwap<uint8_t>(0x12) == 0x12);
+    static_assert(ByteSwap<uint16_t>(0x1234) == 0x3412);
+    static_assert(ByteSwap<uint32_t>(0x12345678) == 0x78563412);
+    static_assert(ByteSwap<uint64_t>(0x0102030405060708) == 0x0807060504030201);
+    CHECK(ByteSwap<int16_t>(-2) == static_cast<int16_t>(0xFEFF));
+  }
+
+  SECTION("ByteSwapInPlace()")
+  {
+    std::array<uint32_t, 3> values = { 0x11223344, 0x55667788, 0 };
+
+    ByteSwapInPlace(std::span<uint32_t>(values));
+
+    CHECK(values == std::array<uint32_t, 3>{ 0x44332211, 0x88776655, 0 });
+  }
+
+  SECTION("ConvertEndianInPlace()")
+  {
+    std::array<uint16_t, 2> values = { 0x1234, 0xABCD };
+
+    ConvertEndianInPlace(std::endian::native, std::span<uint16_t>(values));
+    CHECK(values == std::array<uint16_t, 2>{ 0x1234, 0xABCD });
+
+    constexpr auto kOther = (std::endian::native == std::endian::little)
+                                ? std::endian::big
+                                : std::endian::little;
+    ConvertEndianInPlace(kOther, std::span<uint16_t>(values));
+    CHECK(values == std::array<uint16_t, 2>{ 0x3412, 0xCDAB });
   }
 }
 }  // namespace sjsu
@@ -0,0 +1,38 @@
+#include <libcore/testing/benchmark.hpp>
+#include <libcore/utility/math/crc.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+// The table generators are called through volatile pointers, as a direct call
+// would be evaluated at compile time.
+
+SJ2_BENCHMARK("crc::GenerateCrc7Table")
+{
+  auto * volatile generate = &crc::GenerateCrc7Table<uint8_t>;
+  return benchmark::Run(
+      name,
+      [generate]() { benchmark::DoNotOptimize(generate()); },
+      { .iterations = 10 });
+}
+
+SJ2_BENCHMARK("crc::GenerateCrc16Table")
+{
+  auto * volatile generate = &crc::GenerateCrc16Table;
+  return benchmark::Run(
+      name,
+      [generate]() { benchmark::DoNotOptimize(generate()); },
+      { .iterations = 10 });
+}
+
+SJ2_BENCHMARK("crc::Crc16 of a 512 byte block")
+{
+  std::array<uint8_t, 512> block;
+  block.fill(0xA5);
+  return benchmark::Run(name, [&block]() {
+    benchmark::DoNotOptimize(block);
+    benchmark::DoNotOptimize(crc::Crc16(block));
+  });
+}
+}  // namespace sjsu
@@ -1,9 +1,16 @@
 #pragma once
 
-#include <cstdlib>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <span>
 #include <type_traits>
 
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
 namespace sjsu
 {
 namespace crc
@@ -37,7 +44,7 @@ constexpr static CrcTableConfig_t<T> GenerateCrc7Table()
   CrcTableConfig_t<T> crc_table = CrcTableConfig_t<T>();
   size_t i = 0, j = 0;
   // generate a table value for all 256 possible byte values
-  for (i = 0; i < 0xFF; i++)
+  for (i = 0; i < crc_table.kTableSize; i++)
   {
     bool most_significant_bit_set = static_cast<bool>(i & 0x80);
     uint8_t polynomial_compare = static_cast<uint8_t>(i) ^ crc_table.kPoly8bit;
@@ -89,5 +96,544 @@ constexpr static CrcTableConfig_t<uint16_t> GenerateCrc16Table()
   }
   return table;
 }
+
+/// CRC-7 lookup table for SD/MMC command frames. Being `inline constexpr`, the
+/// table is generated at compile time and stored in read-only memory rather
+/// than being constructed at runtime.
+inline constexpr CrcTableConfig_t<uint8_t> kCrc7Table =
+    GenerateCrc7Table<uint8_t>();
+
+/// CRC-16-CCITT lookup table for SD/MMC data blocks. See kCrc7Table.
+inline constexpr CrcTableConfig_t<uint16_t> kCrc16Table = GenerateCrc16Table();
+
+/// Calculate the CRC-7 of a buffer, as used by SD/MMC command frames.
+///
+/// Usage:
+///
+///    uint8_t crc = crc::Crc7(command_bytes);
+///    // The last byte of an SD command holds the CRC followed by a 1 bit.
+///    uint8_t last_byte = static_cast<uint8_t>((crc << 1) | 1);
+///
+/// @param data - bytes to calculate the CRC of.
+/// @param crc - result of a previous call, to continue the calculation across
+///        multiple buffers. Use 0 for a new calculation.
+/// @return constexpr uint8_t - the 7-bit CRC, in the lower 7 bits.
+constexpr uint8_t Crc7(std::span<const uint8_t> data, uint8_t crc = 0)
+{
+  for (uint8_t byte : data)
+  {
+    crc = kCrc7Table.crc_table[static_cast<uint8_t>(crc << 1) ^ byte];
+  }
+  return crc;
+}
+
+/// Calculate the CRC-16-CCITT of a buffer, as used by SD/MMC data blocks.
+///
+/// @param data - bytes to calculate the CRC of.
+/// @param crc - result of a previous call, to continue the calculation across
+///        multiple buffers. Use 0 for a new calculation.
+/// @return constexpr uint16_t - the 16-bit CRC.
+constexpr uint16_t Crc16(std::span<const uint8_t> data, uint16_t crc = 0)
+{
+  for (uint8_t byte : data)
+  {
+    const uint8_t kIndex = static_cast<uint8_t>((crc >> 8) ^ byte);
+    crc = static_cast<uint16_t>((crc << 8) ^ kCrc16Table.crc_table[kIndex]);
+  }
+  return crc;
+}
+
+// =============================================================================
+// CRC Engine
+// =============================================================================
+
+/// Parameters of a CRC algorithm using the widely used "Rocksoft" model, which
+/// is also how CRC catalogues list them. Any CRC up to 64 bits wide can be
+/// described with this structure.
+struct Definition_t
+{
+  /// Number of bits in the CRC.
+  uint8_t width;
+  /// Generator polynomial, without the leading x^width term, in normal (not
+  /// reflected) form.
+  uint64_t polynomial;
+  /// Starting value of the CRC register.
+  uint64_t initial;
+  /// Value XOR'd with the CRC register to produce the final result.
+  uint64_t final_xor;
+  /// If true, the bits of each input byte are processed LSB first.
+  bool reflect_input;
+  /// If true, the CRC register is bit reversed before the final XOR.
+  bool reflect_output;
+};
+
+/// CRC-7 used by SD/MMC cards for command and response frames.
+inline constexpr Definition_t kCrc7 = {
+  .width          = 7,
+  .polynomial     = 0x09,
+  .initial        = 0x00,
+  .final_xor      = 0x00,
+  .reflect_input  = false,
+  .reflect_output = false,
+};
+
+/// CRC-16-CCITT with a zero initial value (also known as CRC-16/XMODEM). Used
+/// by SD/MMC cards for data blocks.
+inline constexpr Definition_t kCrc16Ccitt = {
+  .width          = 16,
+  .polynomial     = 0x1021,
+  .initial        = 0x0000,
+  .final_xor      = 0x0000,
+  .reflect_input  = false,
+  .reflect_output = false,
+};
+
+/// CRC-32 used by Ethernet, zlib, PNG and most firmware image formats.
+inline constexpr Definition_t kCrc32 = {
+  .width          = 32,
+  .polynomial     = 0x04C1'1DB7,
+  .initial        = 0xFFFF'FFFF,
+  .final_xor      = 0xFFFF'FFFF,
+  .reflect_input  = true,
+  .reflect_output = true,
+};
+
+/// CRC-32C (Castagnoli) used by iSCSI, ext4 and SCTP. Has better error
+/// detection properties than CRC-32 for the same cost.
+inline constexpr Definition_t kCrc32c = {
+  .width          = 32,
+  .polynomial     = 0x1EDC'6F41,
+  .initial        = 0xFFFF'FFFF,
+  .final_xor      = 0xFFFF'FFFF,
+  .reflect_input  = true,
+  .reflect_output = true,
+};
+
+/// Reverse the lower `width` bits of a value.
+///
+/// @param value - value to reflect.
+/// @param width - number of bits to reflect.
+/// @return constexpr uint64_t - the reflected bits.
+constexpr uint64_t Reflect(uint64_t value, uint8_t width)
+{
+  uint64_t result = 0;
+  for (uint8_t i = 0; i < width; i++)
+  {
+    result = (result << 1) | ((value >> i) & 1);
+  }
+  return result;
+}
+
+/// Hook for hardware accelerated CRC calculation, such as a microcontroller's
+/// CRC peripheral. Platforms enable it by specializing this template for a
+/// Definition_t, setting `kSupported` to true and providing an Update()
+/// function, which Engine will then use at runtime in place of its tables:
+///
+///    template <>
+///    struct Acceleration<crc::kCrc32>
+///    {
+///      static constexpr bool kSupported = true;
+///      static uint64_t Update(uint64_t state, std::span<const uint8_t> data);
+///    };
+///
+/// `state` is the engine's internal CRC register, which for reflected CRCs is
+/// held bit reversed, matching most hardware implementations. Update() must
+/// return the register after processing `data` without applying the final XOR
+/// or output reflection.
+///
+/// Targets with the ARMv8 CRC32 extension use it automatically for kCrc32 and
+/// kCrc32c.
+///
+/// @tparam definition - the CRC algorithm being accelerated.
+template <Definition_t definition>
+struct Acceleration
+{
+  /// Set to true in specializations that provide Update().
+  static constexpr bool kSupported = false;
+
+  /// @param state - current CRC register.
+  /// @return uint64_t - the unchanged register.
+  static uint64_t Update(uint64_t state, std::span<const uint8_t>)
+  {
+    return state;
+  }
+};
+
+#if defined(__ARM_FEATURE_CRC32)
+namespace internal
+{
+/// Process a buffer using the ARMv8 CRC32 instructions.
+///
+/// @tparam kCastagnoli - use the CRC-32C instructions rather than CRC-32.
+/// @param state - current CRC register.
+/// @param data - bytes to process.
+/// @return uint64_t - the updated register.
+template <bool kCastagnoli>
+inline uint64_t ArmCrc32(uint64_t state, std::span<const uint8_t> data)
+{
+  uint32_t crc = static_cast<uint32_t>(state);
+  size_t i     = 0;
+
+  for (; i + sizeof(uint32_t) <= data.size(); i += sizeof(uint32_t))
+  {
+    uint32_t word;
+    __builtin_memcpy(&word, &data[i], sizeof(word));
+    crc = kCastagnoli ? __crc32cw(crc, word) : __crc32w(crc, word);
+  }
+
+  for (; i < data.size(); i++)
+  {
+    crc = kCastagnoli ? __crc32cb(crc, data[i]) : __crc32b(crc, data[i]);
+  }
+
+  return crc;
+}
+}  // namespace internal
+
+/// ARMv8 CRC32 instruction acceleration for CRC-32.
+template <>
+struct Acceleration<kCrc32>
+{
+  /// This acceleration is available.
+  static constexpr bool kSupported = true;
+
+  /// @param state - current CRC register.
+  /// @param data - bytes to process.
+  /// @return uint64_t - the updated register.
+  static uint64_t Update(uint64_t state, std::span<const uint8_t> data)
+  {
+    return internal::ArmCrc32<false>(state, data);
+  }
+};
+
+/// ARMv8 CRC32 instruction acceleration for CRC-32C.
+template <>
+struct Acceleration<kCrc32c>
+{
+  /// This acceleration is available.
+  static constexpr bool kSupported = true;
+
+  /// @param state - current CRC register.
+  /// @param data - bytes to process.
+  /// @return uint64_t - the updated register.
+  static uint64_t Update(uint64_t state, std::span<const uint8_t> data)
+  {
+    return internal::ArmCrc32<true>(state, data);
+  }
+};
+#endif
+
+/// Table driven CRC calculator for any CRC described by a Definition_t.
+///
+/// The lookup tables are generated at compile time and placed in read-only
+/// memory. With `slices` greater than 1, the engine uses the "slicing-by-N"
+/// technique: N tables allow N bytes to be processed per iteration with
+/// independent lookups, which is several times faster than the classic
+/// byte-at-a-time table. Each slice costs 256 entries of the CRC's integer
+/// type, so slicing-by-8 for CRC-32 uses 8 KiB of flash. Use 1 on memory
+/// constrained targets.
+///
+/// The CRC may be calculated incrementally, which is useful when the data
+/// arrives in chunks, such as SD card blocks or firmware image pages:
+///
+///    crc::Engine<crc::kCrc32> crc;
+///    while (auto chunk = ReadNextChunk())
+///    {
+///      crc.Update(chunk);
+///    }
+///    uint32_t checksum = crc.Get();
+///
+/// Or all at once:
+///
+///    uint32_t checksum = crc::Engine<crc::kCrc32>::Calculate(image);
+///
+/// @tparam definition - the CRC algorithm to calculate.
+/// @tparam slices - number of bytes processed per iteration. Must be 1, 2, 4
+///         or 8.
+template <Definition_t definition, size_t slices = 8>
+class Engine
+{
+ public:
+  static_assert(definition.width >= 1 && definition.width <= 64,
+                "CRC width must be between 1 and 64 bits.");
+  static_assert(slices == 1 || slices == 2 || slices == 4 || slices == 8,
+                "CRC engine slices must be 1, 2, 4 or 8.");
+
+  /// Smallest unsigned integer type that can hold the CRC.
+  using Value_t = std::conditional_t<
+      (definition.width <= 8),
+      uint8_t,
+      std::conditional_t<(definition.width <= 16),
+                         uint16_t,
+                         std::conditional_t<(definition.width <= 32),
+                                            uint32_t,
+                                            uint64_t>>>;
+
+  /// Calculate the CRC of a buffer in one call.
+  ///
+  /// @param data - bytes to calculate the CRC of.
+  /// @return constexpr Value_t - the CRC.
+  static constexpr Value_t Calculate(std::span<const uint8_t> data)
+  {
+    Engine engine;
+    engine.Update(data);
+    return engine.Get();
+  }
+
+  /// Start a new CRC calculation.
+  constexpr Engine() : state_(kInitialState) {}
+
+  /// Add bytes to the CRC calculation.
+  ///
+  /// @param data - the next bytes of the message.
+  /// @return constexpr Engine& - reference to this object to allow chaining.
+  constexpr Engine & Update(std::span<const uint8_t> data)
+  {
+    if constexpr (Acceleration<definition>::kSupported)
+    {
+      if (!std::is_constant_evaluated())
+      {
+        state_ = static_cast<Value_t>(
+            Acceleration<definition>::Update(state_, data));
+        return *this;
+      }
+    }
+
+    size_t i = 0;
+
+    if constexpr (slices > 1)
+    {
+      for (; i + slices <= data.size(); i += slices)
+      {
+        state_ = UpdateSlice(state_, data.subspan(i, slices));
+      }
+    }
+
+    for (; i < data.size(); i++)
+    {
+      state_ = UpdateByte(state_, data[i]);
+    }
+
+    return *this;
+  }
+
+  /// @return constexpr Value_t - the CRC of every byte passed to Update() so
+  ///         far. Does not modify the state, so more bytes may still be added.
+  constexpr Value_t Get() const
+  {
+    uint64_t result = state_;
+
+    if constexpr (!definition.reflect_input)
+    {
+      result >>= (kRegisterWidth - definition.width);
+    }
+
+    if constexpr (definition.reflect_input != definition.reflect_output)
+    {
+      result = Reflect(result, definition.width);
+    }
+
+    return static_cast<Value_t>((result ^ definition.final_xor) & kMask);
+  }
+
+  /// Discard the current calculation and start a new one.
+  constexpr void Reset()
+  {
+    state_ = kInitialState;
+  }
+
+ private:
+  /// Width of the register used to hold the CRC while it is being calculated.
+  static constexpr size_t kRegisterWidth = sizeof(Value_t) * 8;
+
+  /// Mask of the bits of the CRC.
+  static constexpr uint64_t kMask =
+      (definition.width >= 64) ? ~uint64_t{ 0 }
+                               : ((uint64_t{ 1 } << definition.width) - 1);
+
+  /// Non-reflected CRCs are processed with the CRC aligned to the most
+  /// significant bit of the register, so that CRCs narrower than a byte, such
+  /// as CRC-7, can be processed a byte at a time. Reflected CRCs are aligned to
+  /// the least significant bit.
+  static constexpr Value_t kPolynomial =
+      definition.reflect_input
+          ? static_cast<Value_t>(
+                Reflect(definition.polynomial, definition.width))
+          : static_cast<Value_t>(definition.polynomial
+                                 << (kRegisterWidth - definition.width));
+
+  /// Register value at the start of a calculation.
+  static constexpr Value_t kInitialState =
+      definition.reflect_input
+          ? static_cast<Value_t>(
+                Reflect(definition.initial & kMask, definition.width))
+          : static_cast<Value_t>((definition.initial & kMask)
+                                 << (kRegisterWidth - definition.width));
+
+  /// @return the CRC register after processing a single byte starting from a
+  ///         zero register.
+  static constexpr Value_t ComputeByte(uint8_t byte)
+  {
+    Value_t crc = 0;
+
+    if constexpr (definition.reflect_input)
+    {
+      crc = byte;
+      for (size_t bit = 0; bit < 8; bit++)
+      {
+        crc = static_cast<Value_t>((crc & 1) ? (crc >> 1) ^ kPolynomial
+                                             : (crc >> 1));
+      }
+    }
+    else
+    {
+      constexpr Value_t kTopBit = static_cast<Value_t>(
+          Value_t{ 1 } << (kRegisterWidth - 1));
+      crc = static_cast<Value_t>(Value_t{ byte } << (kRegisterWidth - 8));
+      for (size_t bit = 0; bit < 8; bit++)
+      {
+        crc = static_cast<Value_t>((crc & kTopBit) ? (crc << 1) ^ kPolynomial
+                                                   : (crc << 1));
+      }
+    }
+
+    return crc;
+  }
+
+  /// @return the register after processing one zero byte, using table 0.
+  static constexpr Value_t Advance(
+      const std::array<Value_t, 256> & table, Value_t crc)
+  {
+    if constexpr (definition.reflect_input)
+    {
+      return static_cast<Value_t>(table[crc & 0xFF] ^ ShiftDown(crc, 8));
+    }
+    else
+    {
+      return static_cast<Value_t>(table[crc >> (kRegisterWidth - 8)] ^
+                                  ShiftUp(crc, 8));
+    }
+  }
+
+  /// Shift a register down, yielding 0 if every bit is shifted out.
+  static constexpr Value_t ShiftDown(Value_t value, size_t amount)
+  {
+    return (amount >= kRegisterWidth) ? 0
+                                      : static_cast<Value_t>(value >> amount);
+  }
+
+  /// Shift a register up, yielding 0 if every bit is shifted out.
+  static constexpr Value_t ShiftUp(Value_t value, size_t amount)
+  {
+    return (amount >= kRegisterWidth) ? 0
+                                      : static_cast<Value_t>(value << amount);
+  }
+
+  /// Process a single byte of the message with table 0.
+  static constexpr Value_t UpdateByte(Value_t crc, uint8_t byte)
+  {
+    if constexpr (definition.reflect_input)
+    {
+      return static_cast<Value_t>(kTables[0][(crc ^ byte) & 0xFF] ^
+                                  ShiftDown(crc, 8));
+    }
+    else
+    {
+      const size_t kIndex = ((crc >> (kRegisterWidth - 8)) ^ byte) & 0xFF;
+      return static_cast<Value_t>(kTables[0][kIndex] ^ ShiftUp(crc, 8));
+    }
+  }
+
+  /// Process `slices` bytes of the message at once. Each byte is combined
+  /// with the matching bits of the register and looked up in the table that
+  /// accounts for the number of bytes that follow it within the slice.
+  static constexpr Value_t UpdateSlice(Value_t crc,
+                                       std::span<const uint8_t> bytes)
+  {
+    constexpr size_t kSliceBits = slices * 8;
+    Value_t result              = 0;
+
+    if constexpr (definition.reflect_input)
+    {
+      // The first byte of the slice lines up with the least significant byte
+      // of the register.
+      uint64_t combined = crc;
+      for (size_t i = 0; i < slices; i++)
+      {
+        combined ^= uint64_t{ bytes[i] } << (8 * i);
+      }
+
+      result = ShiftDown(crc, kSliceBits);
+      for (size_t i = 0; i < slices; i++)
+      {
+        result ^= kTables[slices - 1 - i][(combined >> (8 * i)) & 0xFF];
+      }
+    }
+    else
+    {
+      // The first byte of the slice lines up with the most significant byte
+      // of the register.
+      uint64_t combined = 0;
+      if constexpr (kRegisterWidth >= kSliceBits)
+      {
+        combined = crc >> (kRegisterWidth - kSliceBits);
+      }
+      else
+      {
+        combined = uint64_t{ crc } << (kSliceBits - kRegisterWidth);
+      }
+
+      for (size_t i = 0; i < slices; i++)
+      {
+        combined ^= uint64_t{ bytes[i] } << (kSliceBits - 8 - (8 * i));
+      }
+
+      result = ShiftUp(crc, kSliceBits);
+      for (size_t i = 0; i < slices; i++)
+      {
+        const size_t kShift = kSliceBits - 8 - (8 * i);
+        result ^= kTables[slices - 1 - i][(combined >> kShift) & 0xFF];
+      }
+    }
+
+    return result;
+  }
+
+ public:
+  /// Lookup tables used by the engine. Table 0 is the classic byte-at-a-time
+  /// table. Table `k` advances a byte through `k` additional zero bytes.
+  static constexpr auto kTables = []() {
+    std::array<std::array<Value_t, 256>, slices> tables = {};
+
+    for (size_t byte = 0; byte < 256; byte++)
+    {
+      tables[0][byte] = ComputeByte(static_cast<uint8_t>(byte));
+    }
+
+    for (size_t k = 1; k < slices; k++)
+    {
+      for (size_t byte = 0; byte < 256; byte++)
+      {
+        tables[k][byte] = Advance(tables[0], tables[k - 1][byte]);
+      }
+    }
+
+    return tables;
+  }();
+
+ private:
+  Value_t state_;
+};
+
+/// Calculate the CRC of a buffer.
+///
+/// @tparam definition - the CRC algorithm to calculate.
+/// @param data - bytes to calculate the CRC of.
+/// @return constexpr auto - the CRC.
+template <Definition_t definition>
+constexpr auto Calculate(std::span<const uint8_t> data)
+{
+  return Engine<definition>::Calculate(data);
+}
 }  // namespace crc
 }  // namespace sjsu
@@ -1,7 +1,195 @@
 #include <libcore/testing/testing_frameworks.hpp>
 #include <libcore/utility/math/crc.hpp>
 
+#include <array>
+#include <cstdint>
+
 namespace sjsu
 {
-TEST_CASE("Testing crc") {}
+namespace
+{
+/// CRC catalogues list the CRC of the ASCII string "123456789" as the check
+/// value of each algorithm.
+constexpr std::array<uint8_t, 9> kCheckString = { '1', '2', '3', '4', '5',
+                                                  '6', '7', '8', '9' };
+
+constexpr std::span<const uint8_t> CheckBytes()
+{
+  return kCheckString;
+}
+
+/// Bit by bit implementation of the Rocksoft model to compare against.
+uint64_t ReferenceCrc(crc::Definition_t definition,
+                      std::span<const uint8_t> data)
+{
+  const uint64_t kTopBit = uint64_t{ 1 } << (definition.width - 1);
+  const uint64_t kMask   = (kTopBit << 1) - 1;
+  uint64_t crc           = definition.initial & kMask;
+
+  for (uint8_t byte : data)
+  {
+    if (definition.reflect_input)
+    {
+      byte = static_cast<uint8_t>(crc::Reflect(byte, 8));
+    }
+
+    for (int bit = 7; bit >= 0; bit--)
+    {
+      bool feedback = ((crc & kTopBit) != 0) != (((byte >> bit) & 1) != 0);
+      crc           = (crc << 1) & kMask;
+      if (feedback)
+      {
+        crc ^= definition.polynomial & kMask;
+      }
+    }
+  }
+
+  if (definition.reflect_output)
+  {
+    crc = crc::Reflect(crc, definition.width);
+  }
+
+  return (crc ^ definition.final_xor) & kMask;
+}
+
+/// Definition used to test the Acceleration hook.
+constexpr crc::Definition_t kAcceleratedCrc = {
+  .width          = 16,
+  .polynomial     = 0x8005,
+  .initial        = 0x0000,
+  .final_xor      = 0x0000,
+  .reflect_input  = true,
+  .reflect_output = true,
+};
+
+int accelerated_calls = 0;
+}  // namespace
+
+template <>
+struct crc::Acceleration<kAcceleratedCrc>
+{
+  static constexpr bool kSupported = true;
+
+  static uint64_t Update(uint64_t state, std::span<const uint8_t> data)
+  {
+    accelerated_calls++;
+    return (state + data.size()) & 0xFFFF;
+  }
+};
+
+TEST_CASE("Testing crc")
+{
+  SECTION("Check values")
+  {
+    static_assert(crc::Calculate<crc::kCrc7>(CheckBytes()) == 0x75);
+    static_assert(crc::Calculate<crc::kCrc16Ccitt>(CheckBytes()) == 0x31C3);
+    static_assert(crc::Calculate<crc::kCrc32>(CheckBytes()) == 0xCBF4'3926);
+    static_assert(crc::Calculate<crc::kCrc32c>(CheckBytes()) == 0xE306'9283);
+
+    CHECK(0x75 == crc::Calculate<crc::kCrc7>(CheckBytes()));
+    CHECK(0x31C3 == crc::Calculate<crc::kCrc16Ccitt>(CheckBytes()));
+    CHECK(0xCBF4'3926 == crc::Calculate<crc::kCrc32>(CheckBytes()));
+    CHECK(0xE306'9283 == crc::Calculate<crc::kCrc32c>(CheckBytes()));
+  }
+
+  SECTION("SD card lookup tables")
+  {
+    // The last entry of the CRC-7 table used to be left as 0.
+    static_assert(crc::kCrc7Table.crc_table[255] != 0);
+    static_assert(crc::Crc7(CheckBytes()) == 0x75);
+    static_assert(crc::Crc16(CheckBytes()) == 0x31C3);
+
+    for (size_t i = 0; i < 256; i++)
+    {
+      const std::array<uint8_t, 1> kByte = { static_cast<uint8_t>(i) };
+      INFO("byte = " << i);
+      CHECK(crc::Calculate<crc::kCrc7>(kByte) == crc::Crc7(kByte));
+      CHECK(crc::Calculate<crc::kCrc16Ccitt>(kByte) == crc::Crc16(kByte));
+    }
+
+    // CMD0 (GO_IDLE_STATE) is always sent with a CRC byte of 0x95.
+    constexpr std::array<uint8_t, 5> kCmd0 = { 0x40, 0x00, 0x00, 0x00, 0x00 };
+    CHECK(0x95 == ((crc::Crc7(kCmd0) << 1) | 1));
+
+    // Continuing a calculation across buffers gives the same result.
+    CHECK(crc::Crc7(CheckBytes()) ==
+          crc::Crc7(CheckBytes().subspan(4), crc::Crc7(CheckBytes().first(4))));
+    CHECK(crc::Crc16(CheckBytes()) ==
+          crc::Crc16(CheckBytes().subspan(3),
+                     crc::Crc16(CheckBytes().first(3))));
+  }
+
+  SECTION("Every slice count matches the bitwise reference")
+  {
+    // Setup
+    std::array<uint8_t, 67> data;
+    uint8_t seed = 0x3C;
+    for (auto & byte : data)
+    {
+      seed = static_cast<uint8_t>((seed * 73) + 29);
+      byte = seed;
+    }
+
+    // Exercise & Verify
+    for (size_t length = 0; length <= data.size(); length++)
+    {
+      auto message = std::span<const uint8_t>(data).first(length);
+      INFO("length = " << length);
+
+      CHECK(ReferenceCrc(crc::kCrc7, message) ==
+            crc::Engine<crc::kCrc7, 8>::Calculate(message));
+      CHECK(ReferenceCrc(crc::kCrc7, message) ==
+            crc::Engine<crc::kCrc7, 1>::Calculate(message));
+      CHECK(ReferenceCrc(crc::kCrc16Ccitt, message) ==
+            crc::Engine<crc::kCrc16Ccitt, 4>::Calculate(message));
+      CHECK(ReferenceCrc(crc::kCrc16Ccitt, message) ==
+            crc::Engine<crc::kCrc16Ccitt, 8>::Calculate(message));
+      CHECK(ReferenceCrc(crc::kCrc32, message) ==
+            crc::Engine<crc::kCrc32, 2>::Calculate(message));
+      CHECK(ReferenceCrc(crc::kCrc32, message) ==
+            crc::Engine<crc::kCrc32, 8>::Calculate(message));
+      CHECK(ReferenceCrc(crc::kCrc32c, message) ==
+            crc::Engine<crc::kCrc32c, 4>::Calculate(message));
+    }
+  }
+
+  SECTION("Incremental Update() across chunks")
+  {
+    // Setup
+    crc::Engine<crc::kCrc32> engine;
+
+    // Exercise
+    engine.Update(CheckBytes().first(2));
+    engine.Update(CheckBytes().subspan(2, 5));
+    uint32_t partial = engine.Get();
+    engine.Update(CheckBytes().subspan(7));
+
+    // Verify
+    CHECK(crc::Calculate<crc::kCrc32>(CheckBytes().first(7)) == partial);
+    CHECK(0xCBF4'3926 == engine.Get());
+
+    // Exercise
+    engine.Reset();
+    engine.Update(CheckBytes());
+
+    // Verify
+    CHECK(0xCBF4'3926 == engine.Get());
+  }
+
+  SECTION("Acceleration hook is used at runtime")
+  {
+    // Setup
+    accelerated_calls = 0;
+    crc::Engine<kAcceleratedCrc> engine;
+
+    // Exercise
+    engine.Update(CheckBytes());
+
+    // Verify
+    CHECK(1 == accelerated_calls);
+    CHECK(9 == engine.Get());
+    // The tables are still used in constant expressions.
+    static_assert(crc::Calculate<kAcceleratedCrc>(CheckBytes()) == 0xBB3D);
+  }
+}
 }  // namespace sjsu
@@ -0,0 +1,46 @@
+#include <libcore/testing/benchmark.hpp>
+#include <libcore/utility/math/dsp.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+namespace
+{
+constexpr auto kBiquads = dsp::ButterworthLowPass<2>(50_Hz, 1_kHz);
+constexpr auto kTaps    = dsp::FirLowPass<32>(100_Hz, 1_kHz);
+}  // namespace
+
+SJ2_BENCHMARK("dsp::BiquadCascade<float, 2> of 256 samples")
+{
+  dsp::BiquadCascade<float, 2> filter(kBiquads);
+  std::array<float, 256> samples;
+  samples.fill(0.25f);
+  return benchmark::Run(name, [&filter, &samples]() {
+    benchmark::DoNotOptimize(samples);
+    filter.Process(samples, samples);
+  });
+}
+
+SJ2_BENCHMARK("dsp::BiquadCascade<q15_t, 2> of 256 samples")
+{
+  dsp::BiquadCascade<dsp::q15_t, 2> filter(kBiquads);
+  std::array<dsp::q15_t, 256> samples;
+  samples.fill(8192);
+  return benchmark::Run(name, [&filter, &samples]() {
+    benchmark::DoNotOptimize(samples);
+    filter.Process(samples, samples);
+  });
+}
+
+SJ2_BENCHMARK("dsp::FirFilter<q15_t, 32> of 256 samples")
+{
+  dsp::FirFilter<dsp::q15_t, 32> filter(kTaps);
+  std::array<dsp::q15_t, 256> samples;
+  samples.fill(8192);
+  return benchmark::Run(name, [&filter, &samples]() {
+    benchmark::DoNotOptimize(samples);
+    filter.Process(samples, samples);
+  });
+}
+}  // namespace sjsu
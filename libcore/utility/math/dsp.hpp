@@ -0,0 +1,710 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <system_error>
+#include <type_traits>
+
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/math/units.hpp>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+namespace sjsu::dsp
+{
+/// A fixed point sample from -1 to 1 - 2^-15, held in 15 fraction bits.
+using q15_t = int16_t;
+/// A fixed point sample from -1 to 1 - 2^-31, held in 31 fraction bits.
+using q31_t = int32_t;
+
+/// The sample types filters work on: float, q15_t and q31_t.
+template <typename T>
+concept Sample = std::is_same_v<T, float> || std::is_same_v<T, q15_t> ||
+                 std::is_same_v<T, q31_t>;
+
+/// Coefficients of a second order IIR filter section, normalized so a0 is 1:
+///
+///    y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+struct Biquad_t
+{
+  /// Weight of the input sample.
+  float b0 = 1;
+  /// Weight of the previous input sample.
+  float b1 = 0;
+  /// Weight of the input sample before that.
+  float b2 = 0;
+  /// Weight of the previous output sample, subtracted.
+  float a1 = 0;
+  /// Weight of the output sample before that, subtracted.
+  float a2 = 0;
+};
+
+/// Quality factor of a second order Butterworth filter, 1 / sqrt(2), which
+/// is as flat as possible in the pass band.
+inline constexpr float kButterworthQ = 0.70710678f;
+
+namespace internal
+{
+inline constexpr double kPi = 3.14159265358979323846;
+
+/// sin(x) by its Taylor series, so that filters can be designed at compile
+/// time.
+constexpr double Sin(double x)
+{
+  while (x > kPi)
+  {
+    x -= 2 * kPi;
+  }
+  while (x < -kPi)
+  {
+    x += 2 * kPi;
+  }
+
+  double term = x;
+  double sum  = x;
+  for (int n = 1; n < 16; n++)
+  {
+    term *= -x * x / ((2.0 * n) * ((2.0 * n) + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+/// cos(x), see Sin().
+constexpr double Cos(double x)
+{
+  return Sin(x + (kPi / 2));
+}
+
+/// @return double - the cutoff frequency as an angle per sample, in radians.
+/// @throw std::errc::invalid_argument - if the cutoff is not between 0 and
+///        half of the sample rate.
+constexpr double NormalizedCutoff(units::frequency::hertz_t cutoff,
+                                  units::frequency::hertz_t sample_rate)
+{
+  const double kCutoff = cutoff.to<double>();
+  const double kRate   = sample_rate.to<double>();
+  if (!(0 < kCutoff && kCutoff < kRate / 2))
+  {
+    throw Exception(std::errc::invalid_argument,
+                    "Cutoff must be between 0 Hz and half the sample rate.");
+  }
+  return 2 * kPi * kCutoff / kRate;
+}
+
+/// @return T - `value` limited to the range of T.
+template <typename T>
+constexpr T Saturate(int64_t value)
+{
+  return static_cast<T>(std::clamp<int64_t>(value,
+                                            std::numeric_limits<T>::min(),
+                                            std::numeric_limits<T>::max()));
+}
+
+/// @return T - `value` scaled by 2^kFractionBits, rounded to the nearest
+///         integer and limited to the range of T.
+template <typename T, int kFractionBits>
+constexpr T Quantize(double value)
+{
+  const double kScale  = static_cast<double>(int64_t{ 1 } << kFractionBits);
+  const double kScaled = value * kScale;
+  const double kLimited =
+      std::clamp<double>(kScaled,
+                         static_cast<double>(std::numeric_limits<T>::min()),
+                         static_cast<double>(std::numeric_limits<T>::max()));
+  return static_cast<T>(kLimited + ((kLimited < 0) ? -0.5 : 0.5));
+}
+
+/// @return uint32_t - two 16 bit values packed into a word, `low` in the
+///         lower half, the layout of the ARM dual 16 bit instructions.
+constexpr uint32_t Pack(int16_t low, int16_t high)
+{
+  return static_cast<uint16_t>(low) |
+         (static_cast<uint32_t>(static_cast<uint16_t>(high)) << 16);
+}
+
+/// Add the products of the lower and of the upper halves of two packed
+/// words to a sum, with the SMLALD instruction when the core has the ARM DSP
+/// extension.
+///
+/// @param a - a pair of 16 bit values, see Pack().
+/// @param b - a pair of 16 bit values, see Pack().
+/// @param sum - the sum to add to.
+/// @return int64_t - the new sum.
+inline int64_t MultiplyAccumulatePairs(uint32_t a, uint32_t b, int64_t sum)
+{
+#if defined(__ARM_FEATURE_DSP)
+  return __smlald(static_cast<int32_t>(a), static_cast<int32_t>(b), sum);
+#else
+  const auto kLowA  = static_cast<int16_t>(a);
+  const auto kLowB  = static_cast<int16_t>(b);
+  const auto kHighA = static_cast<int16_t>(a >> 16);
+  const auto kHighB = static_cast<int16_t>(b >> 16);
+  return sum + (int32_t{ kLowA } * kLowB) + (int32_t{ kHighA } * kHighB);
+#endif
+}
+}  // namespace internal
+
+/// Convert a float from -1 to 1 to a fixed point sample, rounding to the
+/// nearest value and saturating at the limits.
+///
+/// @tparam T - q15_t or q31_t.
+/// @param value - the sample as a float.
+/// @return constexpr T - the fixed point sample.
+template <typename T>
+constexpr T FromFloat(float value)
+{
+  return internal::Quantize<T, (sizeof(T) * 8) - 1>(value);
+}
+
+/// @param sample - a q15_t or q31_t sample.
+/// @return constexpr float - the sample as a float from -1 to 1.
+template <typename T>
+constexpr float ToFloat(T sample)
+{
+  return static_cast<float>(sample) /
+         static_cast<float>(int64_t{ 1 } << ((sizeof(T) * 8) - 1));
+}
+
+/// Design a second order low pass filter, from the Audio EQ Cookbook by
+/// Robert Bristow-Johnson, with a gain of 1 at 0 Hz.
+///
+/// @param cutoff - frequency of the -3 dB point when q is kButterworthQ.
+/// @param sample_rate - rate of the samples to be filtered.
+/// @param q - quality factor, higher values peak around the cutoff.
+/// @return constexpr Biquad_t - the coefficients.
+/// @throw std::errc::invalid_argument - if the cutoff is not between 0 and
+///        half of the sample rate.
+constexpr Biquad_t LowPass(units::frequency::hertz_t cutoff,
+                           units::frequency::hertz_t sample_rate,
+                           float q = kButterworthQ)
+{
+  const double kOmega = internal::NormalizedCutoff(cutoff, sample_rate);
+  const double kCos   = internal::Cos(kOmega);
+  const double kAlpha = internal::Sin(kOmega) / (2 * q);
+  const double kA0    = 1 + kAlpha;
+  return Biquad_t{
+    .b0 = static_cast<float>(((1 - kCos) / 2) / kA0),
+    .b1 = static_cast<float>((1 - kCos) / kA0),
+    .b2 = static_cast<float>(((1 - kCos) / 2) / kA0),
+    .a1 = static_cast<float>((-2 * kCos) / kA0),
+    .a2 = static_cast<float>((1 - kAlpha) / kA0),
+  };
+}
+
+/// Design a second order high pass filter, with a gain of 1 at half the
+/// sample rate. See LowPass().
+///
+/// @param cutoff - frequency of the -3 dB point when q is kButterworthQ.
+/// @param sample_rate - rate of the samples to be filtered.
+/// @param q - quality factor, higher values peak around the cutoff.
+/// @return constexpr Biquad_t - the coefficients.
+/// @throw std::errc::invalid_argument - if the cutoff is not between 0 and
+///        half of the sample rate.
+constexpr Biquad_t HighPass(units::frequency::hertz_t cutoff,
+                            units::frequency::hertz_t sample_rate,
+                            float q = kButterworthQ)
+{
+  const double kOmega = internal::NormalizedCutoff(cutoff, sample_rate);
+  const double kCos   = internal::Cos(kOmega);
+  const double kAlpha = internal::Sin(kOmega) / (2 * q);
+  const double kA0    = 1 + kAlpha;
+  return Biquad_t{
+    .b0 = static_cast<float>(((1 + kCos) / 2) / kA0),
+    .b1 = static_cast<float>(-(1 + kCos) / kA0),
+    .b2 = static_cast<float>(((1 + kCos) / 2) / kA0),
+    .a1 = static_cast<float>((-2 * kCos) / kA0),
+    .a2 = static_cast<float>((1 - kAlpha) / kA0),
+  };
+}
+
+/// @param section - index of a second order section.
+/// @param sections - number of sections of the filter.
+/// @return constexpr float - quality factor of the section of a Butterworth
+///         filter of order 2 * sections, 1 / (2 cos((2k + 1) pi / 4n)).
+constexpr float ButterworthQ(size_t section, size_t sections)
+{
+  const double kAngle =
+      static_cast<double>((2 * section) + 1) * internal::kPi /
+      static_cast<double>(4 * sections);
+  return static_cast<float>(1 / (2 * internal::Cos(kAngle)));
+}
+
+/// Design a Butterworth low pass filter of order 2 * kSections, as sections
+/// for a BiquadCascade. Each additional section makes the roll off past the
+/// cutoff steeper by 12 dB per octave.
+///
+/// @tparam kSections - number of second order sections.
+/// @param cutoff - frequency of the -3 dB point.
+/// @param sample_rate - rate of the samples to be filtered.
+/// @return constexpr std::array<Biquad_t, kSections> - the sections.
+/// @throw std::errc::invalid_argument - if the cutoff is not between 0 and
+///        half of the sample rate.
+template <size_t kSections>
+constexpr std::array<Biquad_t, kSections> ButterworthLowPass(
+    units::frequency::hertz_t cutoff,
+    units::frequency::hertz_t sample_rate)
+{
+  std::array<Biquad_t, kSections> sections;
+  for (size_t k = 0; k < kSections; k++)
+  {
+    sections[k] = LowPass(cutoff, sample_rate, ButterworthQ(k, kSections));
+  }
+  return sections;
+}
+
+/// Design a Butterworth high pass filter of order 2 * kSections. See
+/// ButterworthLowPass().
+///
+/// @tparam kSections - number of second order sections.
+/// @param cutoff - frequency of the -3 dB point.
+/// @param sample_rate - rate of the samples to be filtered.
+/// @return constexpr std::array<Biquad_t, kSections> - the sections.
+/// @throw std::errc::invalid_argument - if the cutoff is not between 0 and
+///        half of the sample rate.
+template <size_t kSections>
+constexpr std::array<Biquad_t, kSections> ButterworthHighPass(
+    units::frequency::hertz_t cutoff,
+    units::frequency::hertz_t sample_rate)
+{
+  std::array<Biquad_t, kSections> sections;
+  for (size_t k = 0; k < kSections; k++)
+  {
+    sections[k] = HighPass(cutoff, sample_rate, ButterworthQ(k, kSections));
+  }
+  return sections;
+}
+
+/// Design a linear phase FIR low pass filter, a sinc windowed by a Hamming
+/// window, with a gain of 1 at 0 Hz.
+///
+/// @tparam kTaps - number of coefficients. More taps give a sharper cutoff.
+/// @param cutoff - frequency of the -6 dB point.
+/// @param sample_rate - rate of the samples to be filtered.
+/// @return constexpr std::array<float, kTaps> - the coefficients.
+/// @throw std::errc::invalid_argument - if the cutoff is not between 0 and
+///        half of the sample rate.
+template <size_t kTaps>
+constexpr std::array<float, kTaps> FirLowPass(
+    units::frequency::hertz_t cutoff,
+    units::frequency::hertz_t sample_rate)
+{
+  static_assert(kTaps > 0, "A filter needs at least one tap.");
+
+  const double kOmega  = internal::NormalizedCutoff(cutoff, sample_rate);
+  const double kMiddle = static_cast<double>(kTaps - 1) / 2;
+
+  std::array<double, kTaps> taps;
+  double sum = 0;
+  for (size_t n = 0; n < kTaps; n++)
+  {
+    const double kOffset = static_cast<double>(n) - kMiddle;
+    const double kSinc   = (kOffset == 0)
+                             ? kOmega / internal::kPi
+                             : internal::Sin(kOmega * kOffset) /
+                                   (internal::kPi * kOffset);
+    const double kWindow =
+        (kTaps == 1) ? 1
+                     : 0.54 - (0.46 * internal::Cos(2 * internal::kPi *
+                                                    static_cast<double>(n) /
+                                                    (kTaps - 1)));
+    taps[n] = kSinc * kWindow;
+    sum += taps[n];
+  }
+
+  std::array<float, kTaps> coefficients;
+  for (size_t n = 0; n < kTaps; n++)
+  {
+    coefficients[n] = static_cast<float>(taps[n] / sum);
+  }
+  return coefficients;
+}
+
+/// Design a linear phase FIR high pass filter, the spectral inversion of
+/// FirLowPass(), with a gain of 1 at half the sample rate.
+///
+/// @tparam kTaps - number of coefficients, which must be odd.
+/// @param cutoff - frequency of the -6 dB point.
+/// @param sample_rate - rate of the samples to be filtered.
+/// @return constexpr std::array<float, kTaps> - the coefficients.
+/// @throw std::errc::invalid_argument - if the cutoff is not between 0 and
+///        half of the sample rate.
+template <size_t kTaps>
+constexpr std::array<float, kTaps> FirHighPass(
+    units::frequency::hertz_t cutoff,
+    units::frequency::hertz_t sample_rate)
+{
+  static_assert(kTaps % 2 == 1, "High pass FIR filters need an odd number "
+                                "of taps.");
+
+  std::array<float, kTaps> coefficients =
+      FirLowPass<kTaps>(cutoff, sample_rate);
+  for (auto & coefficient : coefficients)
+  {
+    coefficient = -coefficient;
+  }
+  coefficients[kTaps / 2] += 1;
+  return coefficients;
+}
+
+/// A cascade of second order IIR sections, such as a Butterworth filter,
+/// filtering a stream of samples a block at a time.
+///
+/// Float filters use the transposed direct form II, with 2 values of state
+/// per section. Fixed point filters use the direct form I, which cannot
+/// overflow inside a section, with coefficients quantized to 2 integer bits,
+/// so that they range from -2 to 2, and products summed in 64 bits:
+///
+///  - q15_t: 14 fraction bit coefficients. On cores with the ARM DSP
+///    extension, the 4 products of the previous samples of a section are
+///    computed 2 at a time with SMLALD. Coefficients of filters with a cutoff
+///    below about 1/100 of the sample rate lose too much precision, and
+///    should use q31_t instead.
+///  - q31_t: 30 fraction bit coefficients.
+///
+/// USAGE:
+///
+///    constexpr auto kDesign = sjsu::dsp::ButterworthLowPass<2>(50_Hz, 1_kHz);
+///    sjsu::dsp::BiquadCascade<sjsu::dsp::q15_t, 2> filter(kDesign);
+///
+///    adc.ReadSamples(samples);
+///    filter.Process(samples, samples);
+///
+/// @tparam T - sample type, float, q15_t or q31_t.
+/// @tparam kSections - number of second order sections.
+template <Sample T, size_t kSections>
+class BiquadCascade
+{
+ public:
+  static_assert(kSections > 0, "A cascade needs at least one section.");
+
+  /// @param sections - coefficients of each section, applied in order.
+  explicit constexpr BiquadCascade(
+      const std::array<Biquad_t, kSections> & sections)
+  {
+    for (size_t i = 0; i < kSections; i++)
+    {
+      const Biquad_t & kIn = sections[i];
+      Section_t & out      = sections_[i];
+      if constexpr (std::is_same_v<T, float>)
+      {
+        out.coefficients = kIn;
+      }
+      else if constexpr (std::is_same_v<T, q15_t>)
+      {
+        // The feedback coefficients are negated, so every product is added.
+        out.b0 = Coefficient(kIn.b0);
+        out.b1_b2 = internal::Pack(Coefficient(kIn.b1), Coefficient(kIn.b2));
+        out.a1_a2 =
+            internal::Pack(Coefficient(-kIn.a1), Coefficient(-kIn.a2));
+      }
+      else
+      {
+        out.coefficients = { Coefficient(kIn.b0),  Coefficient(kIn.b1),
+                             Coefficient(kIn.b2),  Coefficient(-kIn.a1),
+                             Coefficient(-kIn.a2) };
+      }
+    }
+  }
+
+  /// Filter a single sample.
+  ///
+  /// @param sample - the next input sample.
+  /// @return T - the next output sample.
+  T Process(T sample)
+  {
+    for (auto & section : sections_)
+    {
+      sample = Step(section, sample);
+    }
+    return sample;
+  }
+
+  /// Filter a block of samples. `input` and `output` may be the same span,
+  /// to filter the samples in place.
+  ///
+  /// @param input - the next input samples.
+  /// @param output - filled with the output samples. Filters as many samples
+  ///        as fit.
+  void Process(std::span<const T> input, std::span<T> output)
+  {
+    const size_t kCount = std::min(input.size(), output.size());
+    if (input.data() != output.data())
+    {
+      std::copy_n(input.begin(), kCount, output.begin());
+    }
+
+    // Filter the whole block one section at a time, so each section's
+    // coefficients and state stay in registers.
+    for (auto & section : sections_)
+    {
+      for (size_t i = 0; i < kCount; i++)
+      {
+        output[i] = Step(section, output[i]);
+      }
+    }
+  }
+
+  /// Clear the state of the filter, as if every past sample was 0.
+  void Reset()
+  {
+    for (auto & section : sections_)
+    {
+      section.ClearState();
+    }
+  }
+
+ private:
+  /// Fraction bits of the coefficients of fixed point filters.
+  static constexpr int kCoefficientBits = (sizeof(T) * 8) - 2;
+
+  static constexpr T Coefficient(float value)
+  {
+    return internal::Quantize<T, kCoefficientBits>(value);
+  }
+
+  struct FloatSection_t
+  {
+    Biquad_t coefficients = {};
+    float s1              = 0;
+    float s2              = 0;
+
+    void ClearState()
+    {
+      s1 = 0;
+      s2 = 0;
+    }
+  };
+
+  struct Q15Section_t
+  {
+    q15_t b0         = 0;
+    uint32_t b1_b2   = 0;
+    uint32_t a1_a2   = 0;
+    /// x[n-1] and x[n-2], packed.
+    uint32_t inputs  = 0;
+    /// y[n-1] and y[n-2], packed.
+    uint32_t outputs = 0;
+
+    void ClearState()
+    {
+      inputs  = 0;
+      outputs = 0;
+    }
+  };
+
+  struct Q31Section_t
+  {
+    /// b0, b1, b2, -a1, -a2.
+    std::array<q31_t, 5> coefficients = {};
+    /// x[n-1], x[n-2], y[n-1], y[n-2].
+    std::array<q31_t, 4> state = {};
+
+    void ClearState()
+    {
+      state = {};
+    }
+  };
+
+  using Section_t = std::conditional_t<
+      std::is_same_v<T, float>,
+      FloatSection_t,
+      std::conditional_t<std::is_same_v<T, q15_t>, Q15Section_t, Q31Section_t>>;
+
+  static T Step(Section_t & section, T x)
+  {
+    if constexpr (std::is_same_v<T, float>)
+    {
+      const Biquad_t & kC = section.coefficients;
+      const float kY      = (kC.b0 * x) + section.s1;
+      section.s1          = (kC.b1 * x) - (kC.a1 * kY) + section.s2;
+      section.s2          = (kC.b2 * x) - (kC.a2 * kY);
+      return kY;
+    }
+    else if constexpr (std::is_same_v<T, q15_t>)
+    {
+      using internal::MultiplyAccumulatePairs;
+      constexpr int64_t kHalf = int64_t{ 1 } << (kCoefficientBits - 1);
+
+      int64_t sum = int32_t{ section.b0 } * x;
+      sum = MultiplyAccumulatePairs(section.b1_b2, section.inputs, sum);
+      sum = MultiplyAccumulatePairs(section.a1_a2, section.outputs, sum);
+      const q15_t kY =
+          internal::Saturate<q15_t>((sum + kHalf) >> kCoefficientBits);
+
+      // The previous sample moves to the upper half.
+      const auto kX1  = static_cast<q15_t>(section.inputs);
+      const auto kY1  = static_cast<q15_t>(section.outputs);
+      section.inputs  = internal::Pack(x, kX1);
+      section.outputs = internal::Pack(kY, kY1);
+      return kY;
+    }
+    else
+    {
+      const auto & kC = section.coefficients;
+      auto & state    = section.state;
+      // Summed modulo 2^64, as a partial sum may leave the range of int64_t
+      // when the final one does not.
+      uint64_t sum = static_cast<uint64_t>(int64_t{ kC[0] } * x);
+      sum += static_cast<uint64_t>(int64_t{ kC[1] } * state[0]);
+      sum += static_cast<uint64_t>(int64_t{ kC[2] } * state[1]);
+      sum += static_cast<uint64_t>(int64_t{ kC[3] } * state[2]);
+      sum += static_cast<uint64_t>(int64_t{ kC[4] } * state[3]);
+      const q31_t kY = internal::Saturate<q31_t>(
+          (static_cast<int64_t>(sum) +
+           (int64_t{ 1 } << (kCoefficientBits - 1))) >>
+          kCoefficientBits);
+      state = { x, state[0], kY, state[2] };
+      return kY;
+    }
+  }
+
+  std::array<Section_t, kSections> sections_ = {};
+};
+
+/// A finite impulse response filter, filtering a stream of samples a block
+/// at a time.
+///
+/// The past samples are kept twice in a buffer of 2 * kTaps samples, so the
+/// last kTaps samples are always contiguous and each output is a single dot
+/// product without wrapping around. Fixed point filters sum their products in
+/// 64 bits, and the coefficients range from -1 to 1:
+///
+///  - q15_t: on cores with the ARM DSP extension, products are computed 2 at
+///    a time with SMLALD.
+///  - q31_t: the output saturates if the sum of the absolute values of the
+///    coefficients is larger than 2.
+///
+/// USAGE:
+///
+///    constexpr auto kTaps = sjsu::dsp::FirLowPass<31>(100_Hz, 1_kHz);
+///    sjsu::dsp::FirFilter<sjsu::dsp::q15_t, 31> filter(kTaps);
+///
+///    filter.Process(samples, filtered);
+///
+/// @tparam T - sample type, float, q15_t or q31_t.
+/// @tparam kTaps - number of coefficients.
+template <Sample T, size_t kTaps>
+class FirFilter
+{
+ public:
+  static_assert(kTaps > 0, "A filter needs at least one tap.");
+
+  /// @param taps - the impulse response of the filter, h[0] first.
+  explicit constexpr FirFilter(const std::array<float, kTaps> & taps)
+  {
+    // Reversed, so that the oldest sample of the window is multiplied by the
+    // first coefficient.
+    for (size_t i = 0; i < kTaps; i++)
+    {
+      const float kTap = taps[kTaps - 1 - i];
+      if constexpr (std::is_same_v<T, float>)
+      {
+        coefficients_[i] = kTap;
+      }
+      else
+      {
+        coefficients_[i] = FromFloat<T>(kTap);
+      }
+    }
+
+    if constexpr (std::is_same_v<T, q15_t>)
+    {
+      for (size_t i = 0; i + 1 < kTaps; i += 2)
+      {
+        pairs_[i / 2] = internal::Pack(coefficients_[i], coefficients_[i + 1]);
+      }
+    }
+  }
+
+  /// Filter a single sample.
+  ///
+  /// @param sample - the next input sample.
+  /// @return T - the next output sample.
+  T Process(T sample)
+  {
+    history_[position_]         = sample;
+    history_[position_ + kTaps] = sample;
+    const T * kWindow           = &history_[position_ + 1];
+    position_                   = (position_ + 1 == kTaps) ? 0 : position_ + 1;
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+      float sum = 0;
+      for (size_t i = 0; i < kTaps; i++)
+      {
+        sum += coefficients_[i] * kWindow[i];
+      }
+      return sum;
+    }
+    else if constexpr (std::is_same_v<T, q15_t>)
+    {
+      int64_t sum = 0;
+      size_t i    = 0;
+      for (; i + 1 < kTaps; i += 2)
+      {
+        uint32_t samples;
+        std::memcpy(&samples, &kWindow[i], sizeof(samples));
+        if constexpr (std::endian::native == std::endian::big)
+        {
+          samples = (samples << 16) | (samples >> 16);
+        }
+        sum = internal::MultiplyAccumulatePairs(pairs_[i / 2], samples, sum);
+      }
+      if (i < kTaps)
+      {
+        sum += int32_t{ coefficients_[i] } * kWindow[i];
+      }
+      return internal::Saturate<q15_t>((sum + (1 << 14)) >> 15);
+    }
+    else
+    {
+      uint64_t sum = 0;
+      for (size_t i = 0; i < kTaps; i++)
+      {
+        sum += static_cast<uint64_t>(int64_t{ coefficients_[i] } * kWindow[i]);
+      }
+      return internal::Saturate<q31_t>(
+          (static_cast<int64_t>(sum) + (int64_t{ 1 } << 30)) >> 31);
+    }
+  }
+
+  /// Filter a block of samples. `input` and `output` may be the same span,
+  /// to filter the samples in place.
+  ///
+  /// @param input - the next input samples.
+  /// @param output - filled with the output samples. Filters as many samples
+  ///        as fit.
+  void Process(std::span<const T> input, std::span<T> output)
+  {
+    const size_t kCount = std::min(input.size(), output.size());
+    for (size_t i = 0; i < kCount; i++)
+    {
+      output[i] = Process(input[i]);
+    }
+  }
+
+  /// Clear the past samples, as if they were all 0.
+  void Reset()
+  {
+    history_  = {};
+    position_ = 0;
+  }
+
+ private:
+  std::array<T, kTaps> coefficients_ = {};
+  /// Coefficients of q15_t filters packed in pairs, see internal::Pack().
+  std::array<uint32_t, (std::is_same_v<T, q15_t> ? kTaps / 2 : 0)> pairs_ =
+      {};
+  std::array<T, 2 * kTaps> history_ = {};
+  size_t position_                  = 0;
+};
+}  // namespace sjsu::dsp
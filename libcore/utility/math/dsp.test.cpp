@@ -0,0 +1,286 @@
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/math/dsp.hpp>
+
+namespace sjsu::dsp
+{
+namespace
+{
+constexpr units::frequency::hertz_t kRate = 1_kHz;
+
+/// @return std::vector<float> - `count` samples of a sine wave of amplitude
+///         `amplitude` at `frequency`, sampled at kRate.
+std::vector<float> Sine(float frequency, size_t count, float amplitude = 0.5f)
+{
+  std::vector<float> samples(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    samples[i] = amplitude * std::sin(2 * static_cast<float>(internal::kPi) *
+                                      frequency * static_cast<float>(i) /
+                                      kRate.to<float>());
+  }
+  return samples;
+}
+
+/// @return float - the largest absolute value of the second half of
+///         `samples`, after the filter has settled.
+float SettledPeak(const std::vector<float> & samples)
+{
+  float peak = 0;
+  for (size_t i = samples.size() / 2; i < samples.size(); i++)
+  {
+    peak = std::max(peak, std::abs(samples[i]));
+  }
+  return peak;
+}
+
+/// @return std::vector<float> - `input` filtered by `filter`, converted to
+///         and from the filter's sample type.
+template <typename T, typename Filter>
+std::vector<float> Run(Filter & filter, const std::vector<float> & input)
+{
+  std::vector<T> samples(input.size());
+  for (size_t i = 0; i < input.size(); i++)
+  {
+    if constexpr (std::is_same_v<T, float>)
+    {
+      samples[i] = input[i];
+    }
+    else
+    {
+      samples[i] = FromFloat<T>(input[i]);
+    }
+  }
+
+  filter.Process(samples, samples);
+
+  std::vector<float> output(samples.size());
+  for (size_t i = 0; i < samples.size(); i++)
+  {
+    if constexpr (std::is_same_v<T, float>)
+    {
+      output[i] = samples[i];
+    }
+    else
+    {
+      output[i] = ToFloat(samples[i]);
+    }
+  }
+  return output;
+}
+}  // namespace
+
+TEST_CASE("Testing DSP filters")
+{
+  SECTION("Filters are designed at compile time")
+  {
+    // Exercise
+    constexpr auto kLowPass  = ButterworthLowPass<2>(100_Hz, kRate);
+    constexpr auto kHighPass = HighPass(100_Hz, kRate);
+    constexpr auto kFir      = FirLowPass<15>(100_Hz, kRate);
+
+    // Verify
+    // Gain at 0 Hz: the sum of the b's over the sum of 1 and the a's.
+    for (const auto & section : kLowPass)
+    {
+      const float kGain = (section.b0 + section.b1 + section.b2) /
+                          (1 + section.a1 + section.a2);
+      CHECK(1.0f == doctest::Approx(kGain).epsilon(0.0001));
+    }
+    // Gain at half the sample rate, where the sign of every other sample
+    // flips.
+    const float kNyquistGain =
+        (kHighPass.b0 - kHighPass.b1 + kHighPass.b2) /
+        (1 - kHighPass.a1 + kHighPass.a2);
+    CHECK(1.0f == doctest::Approx(kNyquistGain).epsilon(0.0001));
+    float sum = 0;
+    for (float tap : kFir)
+    {
+      sum += tap;
+    }
+    CHECK(1.0f == doctest::Approx(sum).epsilon(0.0001));
+    CHECK(kFir[0] == doctest::Approx(kFir[14]));
+    CHECK(ButterworthQ(0, 1) == doctest::Approx(kButterworthQ));
+  }
+
+  SECTION("Butterworth low pass attenuates by 3 dB at the cutoff")
+  {
+    // Setup
+    BiquadCascade<float, 1> filter({ LowPass(100_Hz, kRate) });
+
+    // Exercise
+    const float kPass   = SettledPeak(Run<float>(filter, Sine(10, 1000)));
+    filter.Reset();
+    const float kCutoff = SettledPeak(Run<float>(filter, Sine(100, 1000)));
+    filter.Reset();
+    const float kStop   = SettledPeak(Run<float>(filter, Sine(400, 1000)));
+
+    // Verify
+    CHECK(0.5f == doctest::Approx(kPass).epsilon(0.01));
+    CHECK(0.5f * kButterworthQ == doctest::Approx(kCutoff).epsilon(0.02));
+    CHECK(kStop < 0.5f * 0.05f);
+  }
+
+  SECTION("Fixed point cascades follow the float cascade")
+  {
+    // Setup
+    constexpr auto kDesign = ButterworthLowPass<2>(50_Hz, kRate);
+    BiquadCascade<float, 2> reference(kDesign);
+    BiquadCascade<q15_t, 2> q15(kDesign);
+    BiquadCascade<q31_t, 2> q31(kDesign);
+    std::vector<float> input = Sine(20, 400, 0.6f);
+    const auto kNoise        = Sine(300, 400, 0.3f);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+      input[i] += kNoise[i];
+    }
+
+    // Exercise
+    const auto kReference = Run<float>(reference, input);
+    const auto kQ15       = Run<q15_t>(q15, input);
+    const auto kQ31       = Run<q31_t>(q31, input);
+
+    // Verify
+    float q15_error = 0;
+    float q31_error = 0;
+    for (size_t i = 0; i < input.size(); i++)
+    {
+      q15_error = std::max(q15_error, std::abs(kQ15[i] - kReference[i]));
+      q31_error = std::max(q31_error, std::abs(kQ31[i] - kReference[i]));
+    }
+    CHECK(q15_error < 0.005f);
+    CHECK(q31_error < 0.00001f);
+  }
+
+  SECTION("High pass removes an offset")
+  {
+    // Setup
+    BiquadCascade<q31_t, 2> filter(ButterworthHighPass<2>(20_Hz, kRate));
+    std::vector<float> input = Sine(200, 1000, 0.4f);
+    for (auto & sample : input)
+    {
+      sample += 0.5f;
+    }
+
+    // Exercise
+    const auto kOutput = Run<q31_t>(filter, input);
+
+    // Verify
+    float sum = 0;
+    for (size_t i = 500; i < kOutput.size(); i++)
+    {
+      sum += kOutput[i];
+    }
+    CHECK(std::abs(sum / 500) < 0.001f);
+    CHECK(0.4f == doctest::Approx(SettledPeak(kOutput)).epsilon(0.02));
+  }
+
+  SECTION("Blocks and single samples give the same output")
+  {
+    // Setup
+    constexpr auto kDesign = ButterworthLowPass<3>(80_Hz, kRate);
+    BiquadCascade<q15_t, 3> by_block(kDesign);
+    BiquadCascade<q15_t, 3> by_sample(kDesign);
+    std::array<q15_t, 64> input;
+    for (size_t i = 0; i < input.size(); i++)
+    {
+      input[i] = static_cast<q15_t>((i % 7) * 3000 - 9000);
+    }
+    std::array<q15_t, 64> output;
+
+    // Exercise
+    by_block.Process(std::span<const q15_t>(input).first(30),
+                     std::span(output).first(30));
+    by_block.Process(std::span<const q15_t>(input).subspan(30),
+                     std::span(output).subspan(30));
+
+    // Verify
+    for (size_t i = 0; i < input.size(); i++)
+    {
+      CHECK(by_sample.Process(input[i]) == output[i]);
+    }
+  }
+
+  SECTION("FIR impulse response is its coefficients")
+  {
+    // Setup
+    constexpr std::array<float, 5> kTaps = { 0.5f, -0.25f, 0.125f, 0, -0.5f };
+    FirFilter<float, 5> floats(kTaps);
+    FirFilter<q15_t, 5> q15(kTaps);
+    FirFilter<q31_t, 5> q31(kTaps);
+
+    for (size_t n = 0; n < 12; n++)
+    {
+      // Exercise
+      const float kFloat = floats.Process((n == 0) ? 0.5f : 0.0f);
+      const q15_t kQ15   = q15.Process((n == 0) ? FromFloat<q15_t>(0.5f) : 0);
+      const q31_t kQ31   = q31.Process((n == 0) ? FromFloat<q31_t>(0.5f) : 0);
+
+      // Verify
+      const float kExpected = (n < 5) ? kTaps[n] / 2 : 0.0f;
+      CHECK(kExpected == kFloat);
+      CHECK(FromFloat<q15_t>(kExpected) == kQ15);
+      CHECK(FromFloat<q31_t>(kExpected) == kQ31);
+    }
+  }
+
+  SECTION("FIR low and high pass split a signal")
+  {
+    // Setup
+    constexpr auto kLowTaps  = FirLowPass<63>(100_Hz, kRate);
+    constexpr auto kHighTaps = FirHighPass<63>(100_Hz, kRate);
+    FirFilter<q15_t, 63> low(kLowTaps);
+    FirFilter<q15_t, 63> high(kHighTaps);
+
+    // Exercise
+    const float kLowOfSlow  = SettledPeak(Run<q15_t>(low, Sine(20, 400)));
+    const float kHighOfSlow = SettledPeak(Run<q15_t>(high, Sine(20, 400)));
+    low.Reset();
+    high.Reset();
+    const float kLowOfFast  = SettledPeak(Run<q15_t>(low, Sine(250, 400)));
+    const float kHighOfFast = SettledPeak(Run<q15_t>(high, Sine(250, 400)));
+
+    // Verify
+    CHECK(0.5f == doctest::Approx(kLowOfSlow).epsilon(0.01));
+    CHECK(kHighOfSlow < 0.01f);
+    CHECK(kLowOfFast < 0.01f);
+    CHECK(0.5f == doctest::Approx(kHighOfFast).epsilon(0.01));
+  }
+
+  SECTION("Fixed point outputs saturate")
+  {
+    // Setup
+    BiquadCascade<q15_t, 1> gain({ Biquad_t{ .b0 = 1.5f } });
+    FirFilter<q15_t, 2> sum({ 0.9f, 0.9f });
+
+    // Exercise & Verify
+    CHECK(INT16_MAX == gain.Process(FromFloat<q15_t>(0.9f)));
+    CHECK(INT16_MIN == gain.Process(FromFloat<q15_t>(-0.9f)));
+    sum.Process(INT16_MAX);
+    CHECK(INT16_MAX == sum.Process(INT16_MAX));
+  }
+
+  SECTION("Pairs of 16 bit values are multiplied and summed")
+  {
+    // Setup
+    const uint32_t kA = internal::Pack(-3, 32767);
+    const uint32_t kB = internal::Pack(-32768, -2);
+
+    // Exercise & Verify
+    CHECK(10 + (3 * 32768) - (2 * 32767) ==
+          internal::MultiplyAccumulatePairs(kA, kB, 10));
+  }
+
+  SECTION("Cutoffs outside of the sample rate are rejected")
+  {
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(LowPass(0_Hz, kRate), std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(HighPass(500_Hz, kRate), std::errc::invalid_argument);
+    SJ2_CHECK_EXCEPTION(FirLowPass<3>(600_Hz, kRate),
+                        std::errc::invalid_argument);
+  }
+}
+}  // namespace sjsu::dsp
@@ -0,0 +1,27 @@
+#include <libcore/testing/benchmark.hpp>
+#include <libcore/utility/math/fft.hpp>
+
+#include <array>
+
+namespace sjsu
+{
+SJ2_BENCHMARK("dsp::RealFft<float, 256>::Transform")
+{
+  std::array<float, 256> samples;
+  return benchmark::Run(name, [&samples]() {
+    samples.fill(0.25f);
+    benchmark::DoNotOptimize(samples);
+    dsp::RealFft<float, 256>::Transform(samples);
+  });
+}
+
+SJ2_BENCHMARK("dsp::RealFft<q15_t, 256>::Transform")
+{
+  std::array<dsp::q15_t, 256> samples;
+  return benchmark::Run(name, [&samples]() {
+    samples.fill(8192);
+    benchmark::DoNotOptimize(samples);
+    dsp::RealFft<dsp::q15_t, 256>::Transform(samples);
+  });
+}
+}  // namespace sjsu
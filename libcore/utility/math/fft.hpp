@@ -0,0 +1,408 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <libcore/utility/math/dsp.hpp>
+#include <libcore/utility/math/units.hpp>
+
+namespace sjsu::dsp
+{
+/// A frequency bin and its magnitude, found by FindPeaks().
+template <typename T>
+struct Peak_t
+{
+  /// Index of the bin, see RealFft::BinFrequency().
+  size_t bin = 0;
+  /// Magnitude of the bin.
+  T magnitude = 0;
+};
+
+/// An in-place FFT of real samples, such as accelerometer readings, for
+/// computing spectra on the device.
+///
+/// The kSize real samples are transformed as kSize / 2 complex samples, even
+/// samples as the real parts and odd samples as the imaginary parts, with an
+/// iterative radix-2 FFT, and the result is then split into the spectrum of
+/// the real samples. This takes half the time and none of the memory of
+/// transforming kSize complex samples with zero imaginary parts.
+///
+/// The twiddle factors are computed at compile time into a table of kSize / 2
+/// complex values, which is placed in flash.
+///
+/// Each butterfly halves its results, so q15_t samples cannot overflow, and
+/// float samples are scaled the same way. The spectrum is therefore divided
+/// by kSize: bin 0 holds the mean of the samples and a sine wave of amplitude
+/// A between two bins has a magnitude of A / 2 in its bin.
+///
+/// USAGE:
+///
+///    using Fft = sjsu::dsp::RealFft<float, 256>;
+///    static constexpr auto kWindow = sjsu::dsp::HannWindow<float, 256>();
+///
+///    std::array<float, 256> samples = ReadAccelerometer();
+///    sjsu::dsp::ApplyWindow<float>(samples, kWindow);
+///    Fft::Transform(samples);
+///
+///    std::array<float, Fft::kBins> magnitudes;
+///    Fft::Magnitudes(samples, magnitudes);
+///
+///    std::array<sjsu::dsp::Peak_t<float>, 4> peaks;
+///    size_t found = sjsu::dsp::FindPeaks<float>(magnitudes, peaks);
+///
+/// @tparam T - sample type, float or q15_t.
+/// @tparam kSize - number of real samples, a power of 2 of at least 4.
+template <Sample T, size_t kSize>
+class RealFft
+{
+ public:
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, q15_t>,
+                "RealFft supports float and q15_t samples.");
+  static_assert(std::has_single_bit(kSize) && kSize >= 4,
+                "The FFT size must be a power of 2 of at least 4.");
+
+  /// Number of frequency bins, from 0 Hz to half the sample rate.
+  static constexpr size_t kBins = (kSize / 2) + 1;
+
+  /// Replace kSize real samples with their spectrum. Bin k, from 1 to
+  /// kSize / 2 - 1, has its real part at index 2k and its imaginary part at
+  /// index 2k + 1. Bins 0 and kSize / 2 have no imaginary part, and their
+  /// real parts are at index 0 and 1.
+  ///
+  /// @param samples - the samples, replaced by the spectrum.
+  static void Transform(std::span<T, kSize> samples)
+  {
+    BitReverse(samples);
+
+    // Complex FFT of the kSize / 2 complex samples.
+    for (size_t length = 2; length <= kHalf; length *= 2)
+    {
+      const size_t kStride = kSize / length;
+      for (size_t start = 0; start < kHalf; start += length)
+      {
+        for (size_t j = 0; j < length / 2; j++)
+        {
+          const size_t kTop    = 2 * (start + j);
+          const size_t kBottom = kTop + length;
+          const Complex_t kW   = kTwiddles[j * kStride];
+
+          const auto [kRe, kIm] =
+              Multiply(samples[kBottom], samples[kBottom + 1], kW);
+          const Wide_t kTopRe = samples[kTop];
+          const Wide_t kTopIm = samples[kTop + 1];
+
+          samples[kTop]        = Half(kTopRe + kRe);
+          samples[kTop + 1]    = Half(kTopIm + kIm);
+          samples[kBottom]     = Half(kTopRe - kRe);
+          samples[kBottom + 1] = Half(kTopIm - kIm);
+        }
+      }
+    }
+
+    Split(samples);
+  }
+
+  /// Compute the magnitude of each bin of a spectrum.
+  ///
+  /// @param spectrum - a spectrum from Transform().
+  /// @param magnitudes - filled with the magnitudes of bins 0 to kSize / 2.
+  static void Magnitudes(std::span<const T, kSize> spectrum,
+                         std::span<T, kBins> magnitudes)
+  {
+    magnitudes[0]     = Absolute(spectrum[0]);
+    magnitudes[kHalf] = Absolute(spectrum[1]);
+    for (size_t k = 1; k < kHalf; k++)
+    {
+      magnitudes[k] = Magnitude(spectrum[2 * k], spectrum[(2 * k) + 1]);
+    }
+  }
+
+  /// @param bin - index of a bin.
+  /// @param sample_rate - rate the samples were taken at.
+  /// @return constexpr units::frequency::hertz_t - the frequency at the
+  ///         center of the bin.
+  static constexpr units::frequency::hertz_t BinFrequency(
+      size_t bin,
+      units::frequency::hertz_t sample_rate)
+  {
+    return sample_rate * static_cast<float>(bin) / static_cast<float>(kSize);
+  }
+
+ private:
+  static constexpr size_t kHalf = kSize / 2;
+
+  /// Type holding sums and products before they are halved.
+  using Wide_t = std::conditional_t<std::is_same_v<T, float>, float, int32_t>;
+
+  struct Complex_t
+  {
+    T re = 0;
+    T im = 0;
+  };
+
+  /// exp(-2 pi i k / kSize) for k from 0 to kSize / 2 - 1.
+  static constexpr std::array<Complex_t, kHalf> kTwiddles = []() {
+    std::array<Complex_t, kHalf> twiddles;
+    for (size_t k = 0; k < kHalf; k++)
+    {
+      const double kAngle =
+          -2 * internal::kPi * static_cast<double>(k) / kSize;
+      if constexpr (std::is_same_v<T, float>)
+      {
+        twiddles[k] = { static_cast<float>(internal::Cos(kAngle)),
+                        static_cast<float>(internal::Sin(kAngle)) };
+      }
+      else
+      {
+        twiddles[k] = { FromFloat<q15_t>(static_cast<float>(
+                            internal::Cos(kAngle))),
+                        FromFloat<q15_t>(static_cast<float>(
+                            internal::Sin(kAngle))) };
+      }
+    }
+    return twiddles;
+  }();
+
+  /// Reorder the complex samples to bit reversed order of their index.
+  static void BitReverse(std::span<T, kSize> samples)
+  {
+    size_t j = 0;
+    for (size_t i = 0; i < kHalf - 1; i++)
+    {
+      if (i < j)
+      {
+        std::swap(samples[2 * i], samples[2 * j]);
+        std::swap(samples[(2 * i) + 1], samples[(2 * j) + 1]);
+      }
+      size_t bit = kHalf / 2;
+      while (j & bit)
+      {
+        j ^= bit;
+        bit /= 2;
+      }
+      j |= bit;
+    }
+  }
+
+  /// Split the FFT of the complex samples into the spectrum of the real
+  /// samples. With Z the FFT and W the twiddle factors, bins k and
+  /// kSize / 2 - k are computed together from:
+  ///
+  ///    E = (Z[k] + conj(Z[kSize / 2 - k])) / 2
+  ///    O = -i (Z[k] - conj(Z[kSize / 2 - k])) / 2
+  ///    X[k] = (E + W[k] O) / 2
+  ///    X[kSize / 2 - k] = conj(E - W[k] O) / 2
+  static void Split(std::span<T, kSize> samples)
+  {
+    const Wide_t kRe0 = samples[0];
+    const Wide_t kIm0 = samples[1];
+    samples[0]        = Half(kRe0 + kIm0);
+    samples[1]        = Half(kRe0 - kIm0);
+
+    for (size_t k = 1; k <= kHalf / 2; k++)
+    {
+      const size_t kMirror = kHalf - k;
+      const Wide_t kRe     = samples[2 * k];
+      const Wide_t kIm     = samples[(2 * k) + 1];
+      const Wide_t kMRe    = samples[2 * kMirror];
+      const Wide_t kMIm    = samples[(2 * kMirror) + 1];
+
+      const Wide_t kEvenRe = Half(kRe + kMRe);
+      const Wide_t kEvenIm = Half(kIm - kMIm);
+      const Wide_t kOddRe  = Half(kIm + kMIm);
+      const Wide_t kOddIm  = Half(kMRe - kRe);
+
+      const auto [kWoRe, kWoIm] =
+          Multiply(static_cast<T>(kOddRe), static_cast<T>(kOddIm),
+                   kTwiddles[k]);
+
+      samples[2 * k]             = Half(kEvenRe + kWoRe);
+      samples[(2 * k) + 1]       = Half(kEvenIm + kWoIm);
+      samples[2 * kMirror]       = Half(kEvenRe - kWoRe);
+      samples[(2 * kMirror) + 1] = Half(kWoIm - kEvenIm);
+    }
+  }
+
+  /// @return the product of (re + i im) and w, before it is scaled back to
+  ///         a sample.
+  static std::pair<Wide_t, Wide_t> Multiply(T re, T im, Complex_t w)
+  {
+    if constexpr (std::is_same_v<T, float>)
+    {
+      return { (re * w.re) - (im * w.im), (re * w.im) + (im * w.re) };
+    }
+    else
+    {
+      // |(re + i im) w| is at most sqrt(2) 2^30, so the sums fit in 32 bits.
+      constexpr int32_t kRound = 1 << 14;
+      const int32_t kRe = (int32_t{ re } * w.re) - (int32_t{ im } * w.im);
+      const int32_t kIm = (int32_t{ re } * w.im) + (int32_t{ im } * w.re);
+      return { (kRe + kRound) >> 15, (kIm + kRound) >> 15 };
+    }
+  }
+
+  static T Half(Wide_t value)
+  {
+    if constexpr (std::is_same_v<T, float>)
+    {
+      return value * 0.5f;
+    }
+    else
+    {
+      return internal::Saturate<q15_t>(value >> 1);
+    }
+  }
+
+  static T Absolute(T value)
+  {
+    if constexpr (std::is_same_v<T, float>)
+    {
+      return std::abs(value);
+    }
+    else
+    {
+      return internal::Saturate<q15_t>(std::abs(int32_t{ value }));
+    }
+  }
+
+  static T Magnitude(T re, T im)
+  {
+    if constexpr (std::is_same_v<T, float>)
+    {
+      return std::sqrt((re * re) + (im * im));
+    }
+    else
+    {
+      const uint32_t kSquare =
+          static_cast<uint32_t>((int32_t{ re } * re) + (int32_t{ im } * im));
+      return internal::Saturate<q15_t>(SquareRoot(kSquare));
+    }
+  }
+
+  /// @return uint32_t - the integer square root of `value`, rounded down,
+  ///         one result bit per iteration.
+  static uint32_t SquareRoot(uint32_t value)
+  {
+    uint32_t root = 0;
+    uint32_t bit  = uint32_t{ 1 } << 30;
+    while (bit > value)
+    {
+      bit >>= 2;
+    }
+    while (bit != 0)
+    {
+      if (value >= root + bit)
+      {
+        value -= root + bit;
+        root = (root >> 1) + bit;
+      }
+      else
+      {
+        root >>= 1;
+      }
+      bit >>= 2;
+    }
+    return root;
+  }
+};
+
+/// A Hann window, which reduces the leakage of a tone into the bins far from
+/// it, at the cost of spreading it over the bins next to it.
+///
+/// @tparam T - sample type, float or q15_t.
+/// @tparam kSize - number of samples.
+/// @return constexpr std::array<T, kSize> - the window, for ApplyWindow().
+template <Sample T, size_t kSize>
+constexpr std::array<T, kSize> HannWindow()
+{
+  std::array<T, kSize> window;
+  for (size_t n = 0; n < kSize; n++)
+  {
+    const double kValue =
+        0.5 - (0.5 * internal::Cos(2 * internal::kPi * static_cast<double>(n) /
+                                   static_cast<double>(kSize)));
+    if constexpr (std::is_same_v<T, float>)
+    {
+      window[n] = static_cast<float>(kValue);
+    }
+    else
+    {
+      window[n] = FromFloat<T>(static_cast<float>(kValue));
+    }
+  }
+  return window;
+}
+
+/// Multiply samples by a window, such as HannWindow(), before a transform.
+///
+/// @tparam T - sample type, float, q15_t or q31_t.
+/// @param samples - the samples, multiplied in place.
+/// @param window - the window, at least as long as `samples`.
+template <Sample T>
+void ApplyWindow(std::span<T> samples, std::span<const T> window)
+{
+  const size_t kCount = std::min(samples.size(), window.size());
+  for (size_t i = 0; i < kCount; i++)
+  {
+    if constexpr (std::is_same_v<T, float>)
+    {
+      samples[i] *= window[i];
+    }
+    else
+    {
+      constexpr int kBits     = (sizeof(T) * 8) - 1;
+      constexpr int64_t kHalf = int64_t{ 1 } << (kBits - 1);
+      const int64_t kProduct  = int64_t{ samples[i] } * window[i];
+      samples[i]              = static_cast<T>((kProduct + kHalf) >> kBits);
+    }
+  }
+}
+
+/// Find the largest peaks of a spectrum, the bins larger than both of their
+/// neighbours, so that only those need to be reported.
+///
+/// @tparam T - magnitude type, float or q15_t.
+/// @param magnitudes - magnitudes from RealFft::Magnitudes().
+/// @param peaks - filled with the largest peaks, largest first.
+/// @return size_t - number of peaks found, at most `peaks.size()`.
+template <typename T>
+size_t FindPeaks(std::span<const T> magnitudes, std::span<Peak_t<T>> peaks)
+{
+  size_t found = 0;
+  for (size_t bin = 0; bin < magnitudes.size(); bin++)
+  {
+    const T kMagnitude     = magnitudes[bin];
+    const bool kAboveLeft  = (bin == 0) || kMagnitude > magnitudes[bin - 1];
+    const bool kAboveRight = (bin + 1 == magnitudes.size()) ||
+                             kMagnitude >= magnitudes[bin + 1];
+    if (!kAboveLeft || !kAboveRight || kMagnitude == 0)
+    {
+      continue;
+    }
+
+    // Insert the peak in order, dropping the smallest if the list is full.
+    size_t position = found;
+    while (position > 0 && peaks[position - 1].magnitude < kMagnitude)
+    {
+      if (position < peaks.size())
+      {
+        peaks[position] = peaks[position - 1];
+      }
+      position--;
+    }
+    if (position < peaks.size())
+    {
+      peaks[position] = { .bin = bin, .magnitude = kMagnitude };
+      found           = std::min(found + 1, peaks.size());
+    }
+  }
+  return found;
+}
+}  // namespace sjsu::dsp
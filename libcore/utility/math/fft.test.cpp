@@ -0,0 +1,202 @@
+#include <array>
+#include <cmath>
+#include <complex>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/math/fft.hpp>
+
+namespace sjsu::dsp
+{
+namespace
+{
+/// @return std::array<float, kSize> - a tone of `amplitude` completing
+///         `cycles` cycles over the samples, plus an offset.
+template <size_t kSize>
+std::array<float, kSize> Tone(float cycles, float amplitude, float offset = 0)
+{
+  constexpr float kTwoPi = 2 * static_cast<float>(internal::kPi);
+  std::array<float, kSize> samples;
+  for (size_t n = 0; n < kSize; n++)
+  {
+    const float kPhase = kTwoPi * cycles * static_cast<float>(n) / kSize;
+    samples[n]         = offset + (amplitude * std::cos(kPhase));
+  }
+  return samples;
+}
+
+/// @return std::complex<double> - bin k of the spectrum of `samples`,
+///         computed directly and divided by the number of samples.
+template <size_t kSize>
+std::complex<double> Dft(const std::array<float, kSize> & samples, size_t k)
+{
+  std::complex<double> sum = 0;
+  for (size_t n = 0; n < kSize; n++)
+  {
+    sum += static_cast<double>(samples[n]) *
+           std::polar(1.0, -2 * internal::kPi * static_cast<double>(k * n) /
+                               kSize);
+  }
+  return sum / static_cast<double>(kSize);
+}
+}  // namespace
+
+TEST_CASE("Testing RealFft")
+{
+  SECTION("Float spectrum matches the DFT")
+  {
+    // Setup
+    std::array<float, 64> samples;
+    for (size_t n = 0; n < samples.size(); n++)
+    {
+      samples[n] = std::sin(static_cast<float>(n * n) * 0.37f) * 0.8f;
+    }
+    const auto kInput = samples;
+
+    // Exercise
+    RealFft<float, 64>::Transform(samples);
+
+    // Verify
+    CHECK(Dft(kInput, 0).real() == doctest::Approx(samples[0]));
+    CHECK(Dft(kInput, 32).real() == doctest::Approx(samples[1]));
+    double error = 0;
+    for (size_t k = 1; k < 32; k++)
+    {
+      const auto kExpected = Dft(kInput, k);
+      error = std::max(error, std::abs(kExpected.real() - samples[2 * k]));
+      error = std::max(error, std::abs(kExpected.imag() - samples[2 * k + 1]));
+    }
+    CHECK(error < 1e-6);
+  }
+
+  SECTION("Every size transforms correctly")
+  {
+    // Setup
+    auto small = Tone<4>(1, 0.5f, 0.25f);
+    auto large = Tone<1024>(100, 0.5f, 0.25f);
+
+    // Exercise
+    RealFft<float, 4>::Transform(small);
+    RealFft<float, 1024>::Transform(large);
+
+    // Verify
+    CHECK(0.25f == doctest::Approx(small[0]));
+    CHECK(0.25f == doctest::Approx(small[2]));
+    CHECK(0.25f == doctest::Approx(large[0]));
+    CHECK(0.25f == doctest::Approx(large[200]).epsilon(0.0001));
+    CHECK(std::abs(large[202]) < 0.0001f);
+  }
+
+  SECTION("Q15 spectrum follows the float spectrum")
+  {
+    // Setup
+    using Fft           = RealFft<q15_t, 256>;
+    const auto kFloats  = Tone<256>(37, 0.6f, -0.1f);
+    std::array<q15_t, 256> samples;
+    for (size_t n = 0; n < samples.size(); n++)
+    {
+      samples[n] = FromFloat<q15_t>(kFloats[n]);
+    }
+    auto reference = kFloats;
+
+    // Exercise
+    Fft::Transform(samples);
+    RealFft<float, 256>::Transform(reference);
+
+    // Verify
+    float error = 0;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+      error = std::max(error, std::abs(ToFloat(samples[i]) - reference[i]));
+    }
+    CHECK(error < 0.002f);
+    CHECK(0.3f == doctest::Approx(ToFloat(samples[2 * 37])).epsilon(0.01));
+  }
+
+  SECTION("Magnitudes and peaks of a vibration")
+  {
+    // Setup
+    using Fft = RealFft<q15_t, 128>;
+    const auto kLow  = Tone<128>(10, 0.5f);
+    const auto kHigh = Tone<128>(40, 0.2f);
+    std::array<q15_t, 128> samples;
+    for (size_t n = 0; n < samples.size(); n++)
+    {
+      samples[n] = FromFloat<q15_t>(kLow[n] + kHigh[n]);
+    }
+    std::array<q15_t, Fft::kBins> magnitudes;
+    std::array<Peak_t<q15_t>, 3> peaks;
+
+    // Exercise
+    Fft::Transform(samples);
+    Fft::Magnitudes(samples, magnitudes);
+    const size_t kFound = FindPeaks<q15_t>(magnitudes, peaks);
+
+    // Verify
+    REQUIRE(2 <= kFound);
+    CHECK(10 == peaks[0].bin);
+    CHECK(40 == peaks[1].bin);
+    CHECK(0.25f == doctest::Approx(ToFloat(peaks[0].magnitude)).epsilon(0.01));
+    CHECK(0.1f == doctest::Approx(ToFloat(peaks[1].magnitude)).epsilon(0.02));
+    CHECK(250_Hz == Fft::BinFrequency(10, 3200_Hz));
+  }
+
+  SECTION("A Hann window confines a tone between bins")
+  {
+    // Setup
+    constexpr auto kWindow = HannWindow<float, 128>();
+    auto plain             = Tone<128>(20.5f, 0.5f);
+    auto windowed          = plain;
+    std::array<float, 65> plain_magnitudes;
+    std::array<float, 65> windowed_magnitudes;
+
+    // Exercise
+    ApplyWindow<float>(windowed, kWindow);
+    RealFft<float, 128>::Transform(plain);
+    RealFft<float, 128>::Transform(windowed);
+    RealFft<float, 128>::Magnitudes(plain, plain_magnitudes);
+    RealFft<float, 128>::Magnitudes(windowed, windowed_magnitudes);
+
+    // Verify
+    CHECK(0.0f == doctest::Approx(kWindow[0]));
+    CHECK(1.0f == doctest::Approx(kWindow[64]));
+    // Ten bins away, the leakage is far lower with the window.
+    CHECK(windowed_magnitudes[30] * 50 < plain_magnitudes[30]);
+  }
+
+  SECTION("Q15 windows round like the float window")
+  {
+    // Setup
+    constexpr auto kFloatWindow = HannWindow<float, 16>();
+    constexpr auto kQ15Window   = HannWindow<q15_t, 16>();
+    std::array<q15_t, 16> samples;
+    samples.fill(FromFloat<q15_t>(-0.5f));
+
+    // Exercise
+    ApplyWindow<q15_t>(samples, kQ15Window);
+
+    // Verify
+    for (size_t n = 0; n < samples.size(); n++)
+    {
+      CHECK(-0.5f * kFloatWindow[n] ==
+            doctest::Approx(ToFloat(samples[n])).epsilon(0.001));
+    }
+  }
+
+  SECTION("Peaks are limited to the list, largest first")
+  {
+    // Setup
+    constexpr std::array<float, 10> kMagnitudes = { 5, 1, 3, 1, 9,
+                                                    9, 1, 4, 2, 6 };
+    std::array<Peak_t<float>, 3> peaks;
+
+    // Exercise
+    const size_t kFound = FindPeaks<float>(kMagnitudes, peaks);
+
+    // Verify
+    CHECK(3 == kFound);
+    CHECK(4 == peaks[0].bin);
+    CHECK(9 == peaks[1].bin);
+    CHECK(0 == peaks[2].bin);
+  }
+}
+}  // namespace sjsu::dsp
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace sjsu
@@ -91,4 +95,190 @@ constexpr NewRangeMax Map(Input value,
 
   return static_cast<NewRangeMax>(mapped);
 };
+
+/// Remap values from one range to another like Map(), with the ratio between
+/// the ranges computed once, when the map is constructed, so that mapping a
+/// value needs no division. Declare it constexpr to compute the ratio at
+/// compile time.
+///
+/// When both the input and output are integers, the ratio is a Q16.16 fixed
+/// point number and a value is mapped with an integer multiply, add and
+/// shift, rounded to the nearest integer. Otherwise the ratio is a floating
+/// point number and a value is mapped with a multiply and add.
+///
+/// USAGE:
+///
+///    // 12-bit ADC counts to millivolts
+///    static constexpr sjsu::LinearMap<uint32_t> kToMillivolts(
+///        0, 4095, 0, 3300);
+///    uint32_t millivolts = kToMillivolts(adc.Read());
+///
+/// @tparam Input - arithmetic type of the values to map.
+/// @tparam Output - arithmetic type of the mapped values.
+template <typename Input, typename Output = Input>
+class LinearMap
+{
+ public:
+  static_assert(std::is_arithmetic_v<Input> && std::is_arithmetic_v<Output>,
+                "Input and Output must be arithmetic types (like int, char, "
+                "float, etc).");
+
+  /// True if values are mapped using Q16.16 fixed point.
+  static constexpr bool kFixedPoint =
+      std::is_integral_v<Input> && std::is_integral_v<Output>;
+
+  /// Number of fraction bits of the fixed point ratio.
+  static constexpr int kFractionBits = 16;
+
+  /// Type of the ratio between the ranges.
+  using Ratio_t = std::conditional_t<kFixedPoint,
+                                     int64_t,
+                                     std::common_type_t<Input, Output, float>>;
+
+  /// Maps every value to 0.
+  constexpr LinearMap() = default;
+
+  /// Same arguments as Map(). If `min` equals `max`, every value maps to
+  /// `new_min`. For fixed point maps, the ranges must fit in 31 bits.
+  ///
+  /// @param min - current minimum value that the value can reach
+  /// @param max - current maximum value that the value can reach
+  /// @param new_min - the new minimum value to scale and shift the value to
+  /// @param new_max - the new maximum value to scale and shift the value to
+  constexpr LinearMap(Input min, Input max, Output new_min, Output new_max)
+      : min_(min), new_min_(new_min)
+  {
+    if (min == max)
+    {
+      return;
+    }
+
+    if constexpr (kFixedPoint)
+    {
+      const int64_t kRange    = static_cast<int64_t>(max) - min;
+      const int64_t kNewRange = static_cast<int64_t>(new_max) - new_min;
+      ratio_ = (kNewRange * (int64_t{ 1 } << kFractionBits)) / kRange;
+    }
+    else
+    {
+      ratio_ = (static_cast<Ratio_t>(new_max) - static_cast<Ratio_t>(new_min)) /
+               (static_cast<Ratio_t>(max) - static_cast<Ratio_t>(min));
+    }
+  }
+
+  /// @param value - the value that will be mapped to the new range.
+  /// @return constexpr Output - the mapped value.
+  constexpr Output operator()(Input value) const
+  {
+    if constexpr (kFixedPoint)
+    {
+      constexpr int64_t kHalf = int64_t{ 1 } << (kFractionBits - 1);
+      const int64_t kOffset   = static_cast<int64_t>(value) - min_;
+      return static_cast<Output>(new_min_ +
+                                 (((kOffset * ratio_) + kHalf) >>
+                                  kFractionBits));
+    }
+    else
+    {
+      const Ratio_t kOffset =
+          static_cast<Ratio_t>(value) - static_cast<Ratio_t>(min_);
+      return static_cast<Output>((kOffset * ratio_) +
+                                 static_cast<Ratio_t>(new_min_));
+    }
+  }
+
+  /// @return constexpr Ratio_t - the ratio between the new and current
+  ///         ranges, in Q16.16 for fixed point maps.
+  constexpr Ratio_t Ratio() const
+  {
+    return ratio_;
+  }
+
+ private:
+  Input min_      = 0;
+  Output new_min_ = 0;
+  Ratio_t ratio_  = 0;
+};
+
+/// Maps values through a curve of points with linear interpolation between
+/// them, such as the calibration curve of a nonlinear sensor. The slope of
+/// each segment is computed when the map is constructed, so mapping a value
+/// is a binary search and a LinearMap, with no division.
+///
+/// Values below the first point or above the last point map to the output of
+/// that point.
+///
+/// USAGE:
+///
+///    // Thermistor ADC counts to tenths of a degree celsius
+///    static constexpr sjsu::PiecewiseLinearMap<int32_t, 4> kToDeciCelsius({
+///        { .input = 400, .output = 1000 },
+///        { .input = 1200, .output = 500 },
+///        { .input = 2600, .output = 250 },
+///        { .input = 3900, .output = 0 },
+///    });
+///    int32_t temperature = kToDeciCelsius(adc.Read());
+///
+/// @tparam T - arithmetic type of the values.
+/// @tparam kPoints - number of points on the curve.
+template <typename T, size_t kPoints>
+class PiecewiseLinearMap
+{
+ public:
+  static_assert(kPoints >= 2, "A curve needs at least 2 points.");
+
+  /// A point on the curve.
+  struct Point_t
+  {
+    /// The value to map.
+    T input;
+    /// What the value maps to.
+    T output;
+  };
+
+  /// @param points - the points of the curve, in increasing order of input.
+  constexpr explicit PiecewiseLinearMap(const Point_t (&points)[kPoints])
+  {
+    std::copy_n(points, kPoints, points_.begin());
+    for (size_t i = 0; i < kPoints - 1; i++)
+    {
+      segments_[i] = LinearMap<T>(points[i].input,
+                                  points[i + 1].input,
+                                  points[i].output,
+                                  points[i + 1].output);
+    }
+  }
+
+  /// @param value - the value that will be mapped through the curve.
+  /// @return constexpr T - the value on the curve.
+  constexpr T operator()(T value) const
+  {
+    if (value <= points_.front().input)
+    {
+      return points_.front().output;
+    }
+    if (value >= points_.back().input)
+    {
+      return points_.back().output;
+    }
+
+    // The first point past the value ends the segment the value is on.
+    auto end = std::upper_bound(
+        points_.begin(), points_.end(), value, [](T v, const Point_t & point) {
+          return v < point.input;
+        });
+    return segments_[static_cast<size_t>(end - points_.begin()) - 1](value);
+  }
+
+  /// @return constexpr const std::array<Point_t, kPoints>& - the points of
+  ///         the curve.
+  constexpr const std::array<Point_t, kPoints> & Points() const
+  {
+    return points_;
+  }
+
+ private:
+  std::array<Point_t, kPoints> points_ = {};
+  std::array<LinearMap<T>, kPoints - 1> segments_ = {};
+};
 }  // namespace sjsu
@@ -37,4 +37,92 @@ TEST_CASE("Testing Numeric Range remapping utility function")
     CHECK(double_error <= 0.1);
   }
 }
+
+TEST_CASE("Testing LinearMap")
+{
+  SECTION("Integers are mapped in fixed point like Map()")
+  {
+    // Setup
+    constexpr LinearMap<int32_t> kPercentToBipolar(0, 100, -10, 10);
+    constexpr LinearMap<int32_t> kSignedToUnsigned(-128, 127, 0, 255);
+
+    // Exercise & Verify
+    static_assert(LinearMap<int32_t>::kFixedPoint);
+    static_assert(5 == kPercentToBipolar(75));
+    static_assert(255 == kSignedToUnsigned(127));
+    CHECK(-10 == kPercentToBipolar(0));
+    CHECK(-50 == LinearMap<int32_t>(100, 200, -100, 100)(125));
+  }
+
+  SECTION("Rounds to the nearest integer")
+  {
+    // Setup
+    constexpr LinearMap<uint32_t> kToMillivolts(0, 4095, 0, 3300);
+
+    // Exercise & Verify
+    CHECK(3300 == kToMillivolts(4095));
+    CHECK(1612 == kToMillivolts(2000));  // 1611.72
+    CHECK(415 == kToMillivolts(515));    // 415.02
+  }
+
+  SECTION("Floating point outputs use a floating point ratio")
+  {
+    // Setup
+    constexpr LinearMap<int, float> kToVolts(0, 1024, 0.0f, 3.3f);
+
+    // Exercise
+    float volts = kToVolts(310);
+
+    // Verify
+    static_assert(!decltype(kToVolts)::kFixedPoint);
+    CHECK(volts == doctest::Approx(Map(310, 0, 1024, 0.0f, 3.3f)));
+  }
+
+  SECTION("Empty input range maps to the new minimum")
+  {
+    // Setup
+    constexpr LinearMap<int32_t> kFlat(5, 5, 7, 100);
+
+    // Exercise & Verify
+    CHECK(7 == kFlat(1000));
+  }
+}
+
+TEST_CASE("Testing PiecewiseLinearMap")
+{
+  // Setup
+  using Curve = PiecewiseLinearMap<int32_t, 3>;
+  static constexpr Curve kCurve({
+      { .input = 0, .output = 0 },
+      { .input = 10, .output = 100 },
+      { .input = 20, .output = 50 },
+  });
+
+  SECTION("Interpolates between points")
+  {
+    // Exercise & Verify
+    static_assert(50 == kCurve(5));
+    CHECK(100 == kCurve(10));
+    CHECK(75 == kCurve(15));
+  }
+
+  SECTION("Clamps outside of the curve")
+  {
+    // Exercise & Verify
+    CHECK(0 == kCurve(-100));
+    CHECK(50 == kCurve(25));
+  }
+
+  SECTION("Floating point curves")
+  {
+    // Setup
+    constexpr PiecewiseLinearMap<float, 2> kLine({
+        { .input = 1.0f, .output = 2.0f },
+        { .input = 3.0f, .output = 0.0f },
+    });
+
+    // Exercise & Verify
+    CHECK(1.5f == doctest::Approx(kLine(1.5f)));
+  }
+}
 }  // namespace sjsu
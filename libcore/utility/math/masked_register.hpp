@@ -0,0 +1,240 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <libcore/utility/critical_section.hpp>
+#include <libcore/utility/math/bit.hpp>
+
+#if !defined(SJ2_HAS_BIT_BAND)
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+/// Cortex-M3 and M4 map each bit of the first megabyte of SRAM and of the
+/// peripherals to a word of the bit-band alias regions. Define as 0 for
+/// Cortex-M7, which shares their architecture but has no bit-banding.
+#define SJ2_HAS_BIT_BAND 1
+#else
+#define SJ2_HAS_BIT_BAND 0
+#endif
+#endif
+
+namespace sjsu::bit
+{
+/// How a MaskedRegister writes its changes to the register.
+enum class RegisterAccess : uint8_t
+{
+  /// Read the register once, then write it once with the changed bits.
+  kReadModifyWrite,
+  /// kReadModifyWrite with interrupts masked, so an interrupt that changes
+  /// other bits of the register between the read and the write is not undone.
+  kInterruptSafe,
+  /// Write the bits to set to a set register and the bits to clear to a clear
+  /// register, such as the set and clear registers of many GPIO peripherals.
+  /// Each write is atomic and the register is never read.
+  kSetClear,
+  /// Write a single changed bit through its bit-band alias, which is atomic.
+  /// Changes of more than one bit, and registers outside of the bit-band
+  /// regions, fall back to kInterruptSafe.
+  kBitBand,
+};
+
+/// @param address - address of a word in a bit-band region.
+/// @param bit - the bit of the word.
+/// @return uintptr_t - the address of the word of the bit-band alias of the
+///         bit, or 0 if `address` is not within a bit-band region.
+constexpr uintptr_t BitBandAlias(uintptr_t address, uint32_t bit)
+{
+  constexpr uintptr_t kRegionSize = 0x0010'0000;
+  constexpr uintptr_t kAliasStart = 0x0200'0000;
+  constexpr uintptr_t kRegions[]  = { 0x2000'0000, 0x4000'0000 };
+
+  for (uintptr_t region : kRegions)
+  {
+    if (address >= region && address - region < kRegionSize)
+    {
+      return region + kAliasStart + (address - region) * 32 + bit * 4;
+    }
+  }
+  return 0;
+}
+
+/// Collects changes to the fields of a register, then writes them to it at
+/// once with Save(), without reading the register when it is constructed.
+///
+/// Unlike Register, only the fields that were changed are written. The set
+/// and cleared bits are kept as two masks, so a chain of Set(), Clear() and
+/// Insert() with constant arguments folds into constants and Save() is a
+/// single masked write, or with RegisterAccess::kSetClear, a write to each of
+/// the set and clear registers.
+///
+/// USAGE:
+///
+///    sjsu::bit::MaskedRegister(&uart->LCR)
+///        .Insert(0b11, kWordLength)
+///        .Clear(kStopBit)
+///        .Set(kDivisorLatch)
+///        .Save();
+///
+///    sjsu::bit::MaskedRegister<uint32_t, RegisterAccess::kSetClear>(
+///        &gpio->PIN, &gpio->SET, &gpio->CLR)
+///        .Set(kLed)
+///        .Save();
+///
+/// @tparam T - the numeric type of the register.
+/// @tparam kAccess - how the changes are written to the register.
+template <typename T, RegisterAccess kAccess = RegisterAccess::kReadModifyWrite>
+class MaskedRegister
+{
+ public:
+  /// @param reg - address of the register to change.
+  explicit constexpr MaskedRegister(volatile T * reg)
+      : reg_(reg), set_register_(nullptr), clear_register_(nullptr)
+  {
+    static_assert(kAccess != RegisterAccess::kSetClear,
+                  "RegisterAccess::kSetClear needs set and clear registers.");
+  }
+
+  /// @param reg - address of the register to change.
+  /// @param set_register - register where writing a 1 sets the bit of `reg`.
+  /// @param clear_register - register where writing a 1 clears the bit of
+  ///        `reg`.
+  constexpr MaskedRegister(volatile T * reg,
+                           volatile T * set_register,
+                           volatile T * clear_register)
+      : reg_(reg), set_register_(set_register), clear_register_(clear_register)
+  {
+    static_assert(kAccess == RegisterAccess::kSetClear,
+                  "Set and clear registers are only used by "
+                  "RegisterAccess::kSetClear.");
+  }
+
+  /// Set the bits of the mask when saved.
+  ///
+  /// @param mask - the bits to set.
+  /// @return constexpr MaskedRegister& - reference to itself to allow for
+  ///         method chaining.
+  constexpr MaskedRegister & Set(Mask mask)
+  {
+    const T kBits = Bits(mask);
+    set_          = static_cast<T>(set_ | kBits);
+    clear_        = static_cast<T>(clear_ & ~kBits);
+    return *this;
+  }
+
+  /// Clear the bits of the mask when saved.
+  ///
+  /// @param mask - the bits to clear.
+  /// @return constexpr MaskedRegister& - reference to itself to allow for
+  ///         method chaining.
+  constexpr MaskedRegister & Clear(Mask mask)
+  {
+    const T kBits = Bits(mask);
+    clear_        = static_cast<T>(clear_ | kBits);
+    set_          = static_cast<T>(set_ & ~kBits);
+    return *this;
+  }
+
+  /// Insert a value into the field of the mask when saved.
+  ///
+  /// @param value - value to insert into the field.
+  /// @param mask - the field to insert the value into.
+  /// @return constexpr MaskedRegister& - reference to itself to allow for
+  ///         method chaining.
+  constexpr MaskedRegister & Insert(T value, Mask mask)
+  {
+    const T kField = Bits(mask);
+    const T kValue = bit::Insert(T{ 0 }, value, mask);
+    set_           = static_cast<T>((set_ & ~kField) | kValue);
+    clear_         = static_cast<T>((clear_ & ~kField) | (kField & ~kValue));
+    return *this;
+  }
+
+  /// Write the changes to the register. The changes are kept, so saving again
+  /// writes them again.
+  ///
+  /// @return constexpr MaskedRegister& - reference to itself to allow for
+  ///         method chaining.
+  MaskedRegister & Save()
+  {
+    if constexpr (kAccess == RegisterAccess::kSetClear)
+    {
+      if (set_ != 0)
+      {
+        *set_register_ = set_;
+      }
+      if (clear_ != 0)
+      {
+        *clear_register_ = clear_;
+      }
+    }
+    else if constexpr (kAccess == RegisterAccess::kReadModifyWrite)
+    {
+      Write();
+    }
+    else
+    {
+      if constexpr (kAccess == RegisterAccess::kBitBand && SJ2_HAS_BIT_BAND)
+      {
+        if (SaveWithBitBand())
+        {
+          return *this;
+        }
+      }
+
+      CriticalSection lock;
+      Write();
+    }
+    return *this;
+  }
+
+  /// @return T - the bits that will be set.
+  constexpr T GetSetBits() const
+  {
+    return set_;
+  }
+
+  /// @return T - the bits that will be cleared.
+  constexpr T GetClearBits() const
+  {
+    return clear_;
+  }
+
+ private:
+  static constexpr T Bits(Mask mask)
+  {
+    return bit::Insert(T{ 0 }, std::numeric_limits<T>::max(), mask);
+  }
+
+  void Write()
+  {
+    *reg_ = static_cast<T>((*reg_ & ~(set_ | clear_)) | set_);
+  }
+
+  /// @return true - if the change was a single bit written through its
+  ///         bit-band alias.
+  bool SaveWithBitBand()
+  {
+    const T kChanged = static_cast<T>(set_ | clear_);
+    if (!std::has_single_bit(kChanged))
+    {
+      return false;
+    }
+
+    const uintptr_t kAlias =
+        BitBandAlias(reinterpret_cast<uintptr_t>(reg_),
+                     static_cast<uint32_t>(std::countr_zero(kChanged)));
+    if (kAlias == 0)
+    {
+      return false;
+    }
+
+    *reinterpret_cast<volatile uint32_t *>(kAlias) = (set_ != 0);
+    return true;
+  }
+
+  volatile T * reg_;
+  volatile T * set_register_;
+  volatile T * clear_register_;
+  T set_   = 0;
+  T clear_ = 0;
+};
+}  // namespace sjsu::bit
@@ -0,0 +1,87 @@
+#include <libcore/utility/math/masked_register.hpp>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::bit
+{
+TEST_CASE("Testing MaskedRegister")
+{
+  constexpr Mask kLow   = MaskFromRange(0, 3);
+  constexpr Mask kBit7  = MaskFromRange(7);
+  constexpr Mask kBit9  = MaskFromRange(9);
+  volatile uint32_t reg = 0xFFFF'0F80;
+
+  SECTION("Only the changed fields are written")
+  {
+    // Exercise
+    MaskedRegister test_subject(&reg);
+    reg = 0xAAAA'0000;
+    test_subject.Insert(0b0101, kLow).Clear(kBit7).Set(kBit9).Save();
+
+    // Verify
+    CHECK(0xAAAA'0205 == reg);
+  }
+
+  SECTION("Later changes of a field replace earlier ones")
+  {
+    // Exercise
+    auto test_subject = MaskedRegister(&reg).Set(kBit7).Insert(0xF, kLow);
+    test_subject.Clear(kBit7).Insert(0x3, kLow);
+
+    // Verify
+    CHECK(0x0000'0003 == test_subject.GetSetBits());
+    CHECK(0x0000'008C == test_subject.GetClearBits());
+  }
+
+  SECTION("Chains of constant changes fold at compile time")
+  {
+    // Verify
+    constexpr uint32_t kSet = MaskedRegister<uint32_t>(nullptr)
+                                  .Insert(0b1010, kLow)
+                                  .Set(kBit9)
+                                  .GetSetBits();
+    static_assert(kSet == 0x20A);
+    CHECK(0x20A == kSet);
+  }
+
+  SECTION("Set and clear registers are written without reading")
+  {
+    // Setup
+    volatile uint32_t set   = 0;
+    volatile uint32_t clear = 0;
+
+    // Exercise
+    MaskedRegister<uint32_t, RegisterAccess::kSetClear>(&reg, &set, &clear)
+        .Set(kBit9)
+        .Clear(kBit7)
+        .Save();
+
+    // Verify
+    CHECK(0x200 == set);
+    CHECK(0x080 == clear);
+    CHECK(0xFFFF'0F80 == reg);
+  }
+
+  SECTION("Interrupt safe and bit-band writes fall back to a masked write")
+  {
+    // Exercise
+    MaskedRegister<uint32_t, RegisterAccess::kInterruptSafe>(&reg)
+        .Clear(kBit7)
+        .Save();
+    MaskedRegister<uint32_t, RegisterAccess::kBitBand>(&reg).Set(kLow).Save();
+
+    // Verify
+    CHECK(0xFFFF'0F0F == reg);
+  }
+
+  SECTION("Bit-band aliases of SRAM and peripheral bits")
+  {
+    // Verify
+    CHECK(0x2200'0000 == BitBandAlias(0x2000'0000, 0));
+    CHECK(0x4240'0004 == BitBandAlias(0x4002'0000, 1));
+    CHECK(0x4202'0004 == BitBandAlias(0x4000'1000, 1));
+    CHECK(0 == BitBandAlias(0x1000'0000, 0));
+    CHECK(0 == BitBandAlias(0x4010'0000, 0));
+  }
+}
+}  // namespace sjsu::bit
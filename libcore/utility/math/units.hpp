@@ -22,6 +22,7 @@
 #define ENABLE_PREDEFINED_LUMINOUS_FLUX_UNITS
 #define ENABLE_PREDEFINED_VOLTAGE_UNITS
 #define ENABLE_PREDEFINED_IMPEDANCE_UNITS
+#define ENABLE_PREDEFINED_CAPACITANCE_UNITS
 #define ENABLE_PREDEFINED_CURRENT_UNITS
 #define ENABLE_PREDEFINED_TIME_UNITS
 #define ENABLE_PREDEFINED_CHARGE_UNITS
@@ -31,6 +32,129 @@
 
 #include <libcore/external/units/units.h>
 #include <chrono>
+#include <cstdint>
+#include <type_traits>
 
 using namespace std::chrono_literals;  // NOLINT
 using namespace units::literals;  // NOLINT
+
+namespace units::detail
+{
+// The vendored library converts by multiplying and dividing by std::size_t
+// ratios, which turns a negative integer value into a huge unsigned one, so
+// -1250999 uV converts to garbage instead of -1250 mV. The specializations
+// below, for the ratios between the SI prefixes of the integer units, do the
+// arithmetic in std::intmax_t for signed values and std::uintmax_t for
+// unsigned ones, rounding toward zero. Floating point values are converted
+// exactly as the library does.
+
+/// Conversion by the ratio kNumerator / kDenominator that is exact for
+/// integers of either signedness.
+template <std::size_t kNumerator, std::size_t kDenominator>
+struct integer_exact_convert
+{
+  template <typename T>
+  inline constexpr T operator()(const T & value) const noexcept
+  {
+    if constexpr (std::is_integral_v<T>)
+    {
+      using Wide = std::conditional_t<std::is_signed_v<T>,
+                                      std::intmax_t,
+                                      std::uintmax_t>;
+      return static_cast<T>(static_cast<Wide>(value) *
+                            static_cast<Wide>(kNumerator) /
+                            static_cast<Wide>(kDenominator));
+    }
+    else if constexpr (kDenominator == 1)
+    {
+      return value * kNumerator;
+    }
+    else
+    {
+      return value / kDenominator;
+    }
+  }
+};
+
+template <>
+struct normal_convert<1'000, 1> : integer_exact_convert<1'000, 1>
+{
+};
+template <>
+struct normal_convert<1, 1'000> : integer_exact_convert<1, 1'000>
+{
+};
+template <>
+struct normal_convert<1'000'000, 1> : integer_exact_convert<1'000'000, 1>
+{
+};
+template <>
+struct normal_convert<1, 1'000'000> : integer_exact_convert<1, 1'000'000>
+{
+};
+template <>
+struct normal_convert<1'000'000'000, 1>
+    : integer_exact_convert<1'000'000'000, 1>
+{
+};
+template <>
+struct normal_convert<1, 1'000'000'000>
+    : integer_exact_convert<1, 1'000'000'000>
+{
+};
+}  // namespace units::detail
+
+namespace units::integer
+{
+// Units held in integers rather than floats, for code that runs often, such
+// as converting ADC samples or computing timer and PWM settings, on targets
+// without an FPU where every float operation is a library call. They keep the
+// dimensional checks of the units library, and conversions between them are
+// a multiplication or division by the ratio of the units, rounded toward
+// zero. Pick the unit small enough that the values of interest are whole
+// numbers of it.
+//
+// Floating point units and literals convert to them with Round(), which is
+// done at compile time when given a constant:
+//
+//    constexpr auto kRate = units::integer::Round<units::integer::hertz_t>(
+//        1.5_MHz);
+
+/// Frequency in hertz, up to 4.29 GHz.
+using hertz_t = unit_t<frequency::hertz, uint32_t>;
+/// Frequency in kilohertz.
+using kilohertz_t = unit_t<frequency::kilohertz, uint32_t>;
+/// Frequency in megahertz.
+using megahertz_t = unit_t<frequency::megahertz, uint32_t>;
+/// Voltage in microvolts, up to +/- 2147 V.
+using microvolt_t = unit_t<voltage::microvolt, int32_t>;
+/// Voltage in millivolts.
+using millivolt_t = unit_t<voltage::millivolt, int32_t>;
+/// Current in microamperes, up to +/- 2147 A.
+using microampere_t = unit_t<current::microampere, int32_t>;
+/// Current in milliamperes.
+using milliampere_t = unit_t<current::milliampere, int32_t>;
+/// Length in micrometers, up to +/- 2147 m.
+using micrometer_t = unit_t<length::micrometer, int32_t>;
+/// Length in millimeters.
+using millimeter_t = unit_t<length::millimeter, int32_t>;
+/// Temperature in thousandths of a degree celsius.
+using millicelsius_t =
+    unit_t<unit<std::milli, temperature::celsius>, int32_t>;
+
+/// Convert a unit, such as a floating point literal, to an integer unit,
+/// rounding to the nearest whole number of it.
+///
+/// @tparam IntegerUnit - one of the integer units, such as hertz_t.
+/// @param value - a unit of the same dimension.
+/// @return constexpr IntegerUnit - the value in the integer unit.
+template <class IntegerUnit, class Unit>
+constexpr IntegerUnit Round(Unit value)
+{
+  using Integer = typename IntegerUnit::underlying_type;
+  using Double  = unit_t<typename IntegerUnit::unit_type, double>;
+  const double kValue = Double(value).template to<double>();
+  return IntegerUnit(
+      static_cast<Integer>(kValue + ((kValue < 0) ? -0.5 : 0.5)));
+}
+}  // namespace units::integer
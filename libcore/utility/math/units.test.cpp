@@ -0,0 +1,102 @@
+#include <cstdint>
+#include <type_traits>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/math/units.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing integer units")
+{
+  using units::integer::hertz_t;
+  using units::integer::megahertz_t;
+  using units::integer::microvolt_t;
+  using units::integer::millicelsius_t;
+  using units::integer::millivolt_t;
+
+  SECTION("Values are held in integers")
+  {
+    // Exercise & Verify
+    static_assert(std::is_same_v<hertz_t::underlying_type, uint32_t>);
+    static_assert(std::is_same_v<microvolt_t::underlying_type, int32_t>);
+    static_assert(sizeof(hertz_t) == sizeof(uint32_t));
+  }
+
+  SECTION("Conversions between integer units are exact")
+  {
+    // Setup
+    constexpr megahertz_t kClock(48);
+    constexpr millivolt_t kNegative(-1250);
+
+    // Exercise
+    constexpr hertz_t kClockHz            = kClock;
+    constexpr microvolt_t kNegativeMicro  = kNegative;
+    constexpr millivolt_t kNegativeMilli  = microvolt_t(-1'250'999);
+    constexpr megahertz_t kTruncatedClock = hertz_t(47'999'999);
+
+    // Verify
+    CHECK(48'000'000 == kClockHz.to<uint32_t>());
+    CHECK(-1'250'000 == kNegativeMicro.to<int32_t>());
+    CHECK(-1250 == kNegativeMilli.to<int32_t>());
+    CHECK(47 == kTruncatedClock.to<uint32_t>());
+  }
+
+  SECTION("Unsigned values above INT64_MAX convert exactly")
+  {
+    // Setup
+    using Hertz64     = units::unit_t<units::frequency::hertz, uint64_t>;
+    using Kilohertz64 = units::unit_t<units::frequency::kilohertz, uint64_t>;
+
+    // Exercise
+    constexpr Kilohertz64 kKilohertz = Hertz64(18'000'000'000'000'000'999u);
+
+    // Verify
+    CHECK(18'000'000'000'000'000u == kKilohertz.to<uint64_t>());
+  }
+
+  SECTION("Arithmetic and comparisons stay in integers")
+  {
+    // Setup
+    constexpr hertz_t kRate(100'000);
+
+    // Exercise
+    constexpr auto kDouble = kRate * 2;
+    constexpr auto kSum    = kRate + hertz_t(5);
+
+    // Verify
+    static_assert(std::is_same_v<decltype(kSum)::underlying_type, uint32_t>);
+    CHECK(200'000 == kDouble.to<uint32_t>());
+    CHECK(100'005 == kSum.to<uint32_t>());
+    CHECK(kRate < megahertz_t(1));
+    CHECK(kRate == hertz_t(100'000));
+  }
+
+  SECTION("Round() converts floating point units to the nearest integer")
+  {
+    // Exercise
+    constexpr auto kRate    = units::integer::Round<hertz_t>(1.5_MHz);
+    constexpr auto kVoltage = units::integer::Round<microvolt_t>(3.3_V);
+    constexpr auto kBelow   = units::integer::Round<millivolt_t>(-0.0016_V);
+    constexpr auto kWarm    = units::integer::Round<millicelsius_t>(
+        units::temperature::kelvin_t(300));
+
+    // Verify
+    CHECK(1'500'000 == kRate.to<uint32_t>());
+    CHECK(3'300'000 == kVoltage.to<int32_t>());
+    CHECK(-2 == kBelow.to<int32_t>());
+    CHECK(26'850 == kWarm.to<int32_t>());
+  }
+
+  SECTION("Integer units convert back to floating point units")
+  {
+    // Setup
+    constexpr microvolt_t kVoltage(1'650'000);
+
+    // Exercise
+    const units::voltage::volt_t kVolts = kVoltage;
+
+    // Verify
+    CHECK(1.65f == doctest::Approx(kVolts.to<float>()));
+  }
+}
+}  // namespace sjsu
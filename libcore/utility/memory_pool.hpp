@@ -0,0 +1,255 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <tuple>
+
+namespace sjsu
+{
+/// Polymorphic memory resource which hands out fixed size blocks from a
+/// statically allocated buffer. Unlike StaticMemoryResource, deallocated
+/// blocks are reused, and both allocation and deallocation take constant
+/// time.
+///
+/// Each allocation takes a whole block, so this is best suited to containers
+/// that allocate one node at a time such as std::pmr::list, std::pmr::map or
+/// std::pmr::unordered_map (whose bucket array must still fit in one block).
+/// Requests larger than a block, with stricter alignment than the pool, or
+/// made when every block is in use throw std::bad_alloc.
+///
+/// USAGE:
+///
+///    StaticBlockPool<32, 16> pool;
+///    std::pmr::list<Message_t> messages(&pool);
+///
+/// @tparam kBlockSize - largest allocation in bytes.
+/// @tparam kBlockCount - number of blocks.
+/// @tparam kAlignment - alignment of every block.
+template <size_t kBlockSize,
+          size_t kBlockCount,
+          size_t kAlignment = alignof(std::max_align_t)>
+class StaticBlockPool : public std::pmr::memory_resource
+{
+ public:
+  static_assert(kBlockSize > 0 && kBlockCount > 0,
+                "Pool must have at least one block of at least one byte.");
+  static_assert((kAlignment & (kAlignment - 1)) == 0,
+                "Alignment must be a power of 2.");
+
+  /// Distance between the start of each block. Each block must be able to
+  /// hold the free list link and keep the next block aligned.
+  static constexpr size_t kStride =
+      ((std::max(kBlockSize, sizeof(void *)) + kAlignment - 1) / kAlignment) *
+      kAlignment;
+
+  StaticBlockPool() = default;
+  StaticBlockPool(const StaticBlockPool &) = delete;
+  StaticBlockPool & operator=(const StaticBlockPool &) = delete;
+
+  /// @return size_t - the total number of bytes that this allocator can
+  /// allocate before throwing a std::bad_alloc exception.
+  constexpr std::size_t Capacity() const
+  {
+    return kBlockSize * kBlockCount;
+  }
+
+  /// @return size_t - number of bytes in blocks that are in use.
+  std::size_t MemoryUsed() const
+  {
+    return blocks_used_ * kBlockSize;
+  }
+
+  /// @return int - Bytes that have yet to be allocated from this allocator.
+  int MemoryAvailable() const
+  {
+    return Capacity() - MemoryUsed();
+  }
+
+  /// @return size_t - number of blocks that are in use.
+  std::size_t BlocksUsed() const
+  {
+    return blocks_used_;
+  }
+
+  /// Allocate a block without throwing.
+  ///
+  /// @param bytes - number of bytes requested.
+  /// @param alignment - required alignment.
+  /// @return void* - the block or nullptr if the request cannot be met.
+  void * TryAllocate(std::size_t bytes, std::size_t alignment)
+  {
+    if (bytes > kBlockSize || alignment > kAlignment)
+    {
+      return nullptr;
+    }
+
+    std::byte * block = nullptr;
+
+    if (free_list_ != nullptr)
+    {
+      block      = reinterpret_cast<std::byte *>(free_list_);
+      free_list_ = free_list_->next;
+    }
+    else if (untouched_ < kBlockCount)
+    {
+      // Blocks are first handed out in order, so that constructing the pool
+      // does not need to link every block into the free list.
+      block = &buffer_[untouched_ * kStride];
+      untouched_++;
+    }
+    else
+    {
+      return nullptr;
+    }
+
+    blocks_used_++;
+    return block;
+  }
+
+  /// Return a block to the pool.
+  ///
+  /// @param block - block previously returned by this pool.
+  void Release(void * block)
+  {
+    free_list_ = new (block) FreeBlock{ free_list_ };
+    blocks_used_--;
+  }
+
+  /// @param pointer - a pointer to check.
+  /// @return true - if `pointer` is within this pool's buffer.
+  bool Owns(const void * pointer) const
+  {
+    auto address = reinterpret_cast<uintptr_t>(pointer);
+    auto start   = reinterpret_cast<uintptr_t>(buffer_.data());
+    return start <= address && address < start + buffer_.size();
+  }
+
+ protected:
+  /// Implemenation of the do_allocate() method for std::pmr::memory_resource
+  void * do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    void * block = TryAllocate(bytes, alignment);
+    if (block == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    return block;
+  }
+
+  /// Implemenation of the do_deallocate() method for std::pmr::memory_resource
+  void do_deallocate(void * p, std::size_t, std::size_t) override
+  {
+    Release(p);
+  }
+
+  /// Implemenation of the do_is_equal() method for std::pmr::memory_resource
+  bool do_is_equal(
+      const std::pmr::memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+
+ private:
+  struct FreeBlock
+  {
+    FreeBlock * next;
+  };
+
+  alignas(kAlignment) std::array<std::byte, kStride * kBlockCount> buffer_;
+  FreeBlock * free_list_ = nullptr;
+  size_t untouched_      = 0;
+  size_t blocks_used_    = 0;
+};
+
+/// Polymorphic memory resource made of several StaticBlockPools of increasing
+/// block size. Each allocation is served by the pool with the smallest blocks
+/// that fit it, falling back to pools of larger blocks when that pool is
+/// exhausted. Allocation and deallocation take constant time with respect to
+/// the number of allocations.
+///
+/// USAGE:
+///
+///    // 8 blocks each of 16, 64 and 256 bytes.
+///    StaticSizeClassPool<8, 16, 64, 256> memory_resource;
+///    std::pmr::vector<uint8_t> payload(&memory_resource);
+///
+/// @tparam kBlocksPerClass - number of blocks for each size class.
+/// @tparam kClassSizes - block size of each class, in increasing order.
+template <size_t kBlocksPerClass, size_t... kClassSizes>
+class StaticSizeClassPool : public std::pmr::memory_resource
+{
+ public:
+  static_assert(sizeof...(kClassSizes) > 0,
+                "At least one size class is required.");
+  static_assert(std::ranges::is_sorted(std::array{ kClassSizes... }),
+                "Size classes must be in increasing order.");
+
+  StaticSizeClassPool() = default;
+  StaticSizeClassPool(const StaticSizeClassPool &) = delete;
+  StaticSizeClassPool & operator=(const StaticSizeClassPool &) = delete;
+
+  /// @return size_t - the total number of bytes that this allocator can
+  /// allocate before throwing a std::bad_alloc exception.
+  constexpr std::size_t Capacity() const
+  {
+    return ((kClassSizes * kBlocksPerClass) + ...);
+  }
+
+  /// @return size_t - number of bytes in blocks that are in use.
+  std::size_t MemoryUsed() const
+  {
+    return std::apply([](const auto &... pool)
+                      { return (pool.MemoryUsed() + ...); },
+                      pools_);
+  }
+
+  /// @return int - Bytes that have yet to be allocated from this allocator.
+  int MemoryAvailable() const
+  {
+    return Capacity() - MemoryUsed();
+  }
+
+ protected:
+  /// Implemenation of the do_allocate() method for std::pmr::memory_resource
+  void * do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    void * block = nullptr;
+    std::apply(
+        [&block, bytes, alignment](auto &... pool)
+        {
+          // Stops at the first pool that can serve the request.
+          ((block = pool.TryAllocate(bytes, alignment)) || ...);
+        },
+        pools_);
+
+    if (block == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    return block;
+  }
+
+  /// Implemenation of the do_deallocate() method for std::pmr::memory_resource
+  void do_deallocate(void * p, std::size_t, std::size_t) override
+  {
+    std::apply(
+        [p](auto &... pool)
+        { ((pool.Owns(p) ? (pool.Release(p), true) : false) || ...); },
+        pools_);
+  }
+
+  /// Implemenation of the do_is_equal() method for std::pmr::memory_resource
+  bool do_is_equal(
+      const std::pmr::memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+
+ private:
+  std::tuple<StaticBlockPool<kClassSizes, kBlocksPerClass>...> pools_;
+};
+}  // namespace sjsu
@@ -0,0 +1,131 @@
+#include <libcore/utility/memory_pool.hpp>
+
+#include <cstdint>
+#include <list>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing StaticBlockPool")
+{
+  StaticBlockPool<24, 4> pool;
+
+  SECTION("Initial metrics")
+  {
+    // Verify
+    CHECK(24 * 4 == pool.Capacity());
+    CHECK(0 == pool.MemoryUsed());
+    CHECK(24 * 4 == pool.MemoryAvailable());
+  }
+
+  SECTION("Allocates distinct aligned blocks")
+  {
+    // Exercise
+    void * block0 = pool.allocate(24, 8);
+    void * block1 = pool.allocate(1, 1);
+
+    // Verify
+    CHECK(block0 != block1);
+    CHECK(pool.Owns(block0));
+    CHECK(pool.Owns(block1));
+    CHECK(0 == reinterpret_cast<uintptr_t>(block0) % alignof(std::max_align_t));
+    CHECK(0 == reinterpret_cast<uintptr_t>(block1) % alignof(std::max_align_t));
+    CHECK(2 == pool.BlocksUsed());
+    CHECK(48 == pool.MemoryUsed());
+  }
+
+  SECTION("Deallocated blocks are reused")
+  {
+    // Setup
+    void * block0 = pool.allocate(8, 8);
+    void * block1 = pool.allocate(8, 8);
+
+    // Exercise
+    pool.deallocate(block0, 8, 8);
+    void * again = pool.allocate(8, 8);
+
+    // Verify
+    CHECK(block0 == again);
+    CHECK(block1 != again);
+    CHECK(2 == pool.BlocksUsed());
+  }
+
+  SECTION("Throws when exhausted or the request does not fit")
+  {
+    // Exercise & Verify
+    CHECK_THROWS_AS(static_cast<void>(pool.allocate(25, 1)), std::bad_alloc);
+    CHECK(nullptr == pool.TryAllocate(8, 1024));
+
+    for (int i = 0; i < 4; i++)
+    {
+      [[maybe_unused]] void * block = pool.allocate(24, 8);
+    }
+    CHECK_THROWS_AS(static_cast<void>(pool.allocate(1, 1)), std::bad_alloc);
+  }
+
+  SECTION("Works with node based containers")
+  {
+    // Setup
+    StaticBlockPool<64, 8> list_pool;
+    std::pmr::list<int> list(&list_pool);
+
+    // Exercise
+    // Far more insertions than blocks, which only works if blocks are reused.
+    for (int i = 0; i < 100; i++)
+    {
+      list.push_back(i);
+      list.push_back(i);
+      list.pop_front();
+      list.pop_front();
+    }
+    list.push_back(7);
+
+    // Verify
+    CHECK(1 == list.size());
+    CHECK(1 == list_pool.BlocksUsed());
+  }
+}
+
+TEST_CASE("Testing StaticSizeClassPool")
+{
+  StaticSizeClassPool<2, 16, 64> pool;
+
+  SECTION("Initial metrics")
+  {
+    // Verify
+    CHECK(2 * (16 + 64) == pool.Capacity());
+    CHECK(0 == pool.MemoryUsed());
+  }
+
+  SECTION("Uses the smallest class that fits and falls back to larger ones")
+  {
+    // Exercise
+    [[maybe_unused]] void * small0 = pool.allocate(10, 8);
+    CHECK(16 == pool.MemoryUsed());
+    [[maybe_unused]] void * large = pool.allocate(40, 8);
+    CHECK(16 + 64 == pool.MemoryUsed());
+    [[maybe_unused]] void * small1 = pool.allocate(16, 8);
+    CHECK(32 + 64 == pool.MemoryUsed());
+    // The 16 byte class is full, so this is served from the 64 byte class.
+    void * fallback = pool.allocate(1, 1);
+
+    // Verify
+    CHECK(32 + 128 == pool.MemoryUsed());
+    CHECK_THROWS_AS(static_cast<void>(pool.allocate(1, 1)), std::bad_alloc);
+
+    // Deallocation finds the class that the block came from.
+    pool.deallocate(fallback, 1, 1);
+    CHECK(32 + 64 == pool.MemoryUsed());
+  }
+
+  SECTION("Throws for requests larger than every class")
+  {
+    // Exercise & Verify
+    CHECK_THROWS_AS(static_cast<void>(pool.allocate(65, 1)), std::bad_alloc);
+  }
+}
+}  // namespace sjsu
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory_resource>
+#include <new>
 
 namespace sjsu
 {
@@ -34,14 +38,68 @@ template <size_t kBufferSizeBytes>
 class StaticMemoryResource : public std::pmr::memory_resource
 {
  public:
-  StaticMemoryResource()
-      : buffer_{},
-        unallocated_memory_(buffer_.data()),
-        resource_(buffer_.data(),
-                  buffer_.size(),
-                  std::pmr::null_memory_resource())
+  /// Allocation statistics, used to size the buffer. Updating them costs a
+  /// few additions per allocation, so they are always enabled.
+  struct Statistics_t
   {
-  }
+    /// Sum of the sizes requested by every successful allocation.
+    std::size_t bytes_requested = 0;
+    /// Bytes skipped to align allocations.
+    std::size_t alignment_padding = 0;
+    /// Largest value MemoryUsed() has reached.
+    std::size_t peak_used = 0;
+    /// Number of successful allocations.
+    std::size_t allocations = 0;
+    /// Number of allocations that threw std::bad_alloc.
+    std::size_t failed_allocations = 0;
+  };
+
+  /// A saved allocation position, see Mark() and Rewind().
+  struct Mark_t
+  {
+    /// Value of MemoryUsed() when the mark was made.
+    std::size_t offset;
+  };
+
+  /// Releases every allocation made during its lifetime when it is destroyed,
+  /// by rewinding the resource to where it was when the scope was created.
+  ///
+  /// USAGE:
+  ///
+  ///    StaticMemoryResource<1024> scratch;
+  ///
+  ///    void ControlCycle()
+  ///    {
+  ///      StaticMemoryResource<1024>::Scope frame(scratch);
+  ///      std::pmr::vector<uint8_t> packet(&scratch);
+  ///      // ...
+  ///    }  // packet's memory is reclaimed here
+  ///
+  /// Objects allocated within the scope must be destroyed before the scope
+  /// ends.
+  class Scope
+  {
+   public:
+    /// @param resource - the resource to rewind when this scope ends.
+    explicit Scope(StaticMemoryResource & resource)
+        : resource_(resource), mark_(resource.Mark())
+    {
+    }
+
+    Scope(const Scope &) = delete;
+    Scope & operator=(const Scope &) = delete;
+
+    ~Scope()
+    {
+      resource_.Rewind(mark_);
+    }
+
+   private:
+    StaticMemoryResource & resource_;
+    Mark_t mark_;
+  };
+
+  StaticMemoryResource() : buffer_{}, unallocated_memory_(buffer_.data()) {}
 
   /// @return size_t - the total number of bytes that this allocator can
   /// allocate before throwing a std::bad_alloc exception.
@@ -50,7 +108,8 @@ class StaticMemoryResource : public std::pmr::memory_resource
     return kBufferSizeBytes;
   }
 
-  /// @return size_t - number of bytes that have already been allocated.
+  /// @return size_t - number of bytes that have already been allocated,
+  ///         including the padding used to align them.
   std::size_t MemoryUsed() const
   {
     return unallocated_memory_ - buffer_.data();
@@ -62,41 +121,84 @@ class StaticMemoryResource : public std::pmr::memory_resource
     return Capacity() - MemoryUsed();
   }
 
+  /// @return Mark_t - the current allocation position, to later Rewind() to.
+  Mark_t Mark() const
+  {
+    return Mark_t{ MemoryUsed() };
+  }
+
+  /// Release every allocation made since `mark` was made, in constant time.
+  /// Memory allocated before the mark is untouched. Marks made after `mark`
+  /// are invalidated. Rewinding forward past the current position does
+  /// nothing.
+  ///
+  /// @param mark - position returned by Mark().
+  void Rewind(Mark_t mark)
+  {
+    if (mark.offset < MemoryUsed())
+    {
+      unallocated_memory_ = buffer_.data() + mark.offset;
+    }
+  }
+
+  /// Release every allocation.
+  void Reset()
+  {
+    Rewind(Mark_t{ 0 });
+  }
+
+  /// @return const Statistics_t& - allocation statistics since construction.
+  const Statistics_t & GetStatistics() const
+  {
+    return statistics_;
+  }
+
  protected:
   /// Implemenation of the do_allocate() method for std::pmr::memory_resource
   void * do_allocate(std::size_t bytes, std::size_t alignment) override
   {
-    // Request a pointer to unallocated memory from the
-    // monotonic_buffer_resource buffer.
-    void * allocated_address = resource_.allocate(bytes, alignment);
+    // Bump allocate from the buffer: skip forward to the next aligned
+    // address, then move the unallocated pointer past the allocation.
+    const auto kAddress = reinterpret_cast<uintptr_t>(unallocated_memory_);
+    const size_t kPadding =
+        ((kAddress + alignment - 1) & ~(uintptr_t{ alignment } - 1)) -
+        kAddress;
+    const size_t kAvailable = MemoryAvailable();
+
+    if (kPadding > kAvailable || bytes > kAvailable - kPadding)
+    {
+      statistics_.failed_allocations++;
+      throw std::bad_alloc();
+    }
 
-    // If the above call has not thrown a std::bad_alloc exception, then the
-    // allocated address must contain a valid address from buffer. To get the
-    // location of the unallocated memory, simply add the number of bytes to
-    // allocate_address variable.
-    unallocated_memory_ = static_cast<std::byte *>(allocated_address) + bytes;
+    std::byte * allocated_address = unallocated_memory_ + kPadding;
+    unallocated_memory_           = allocated_address + bytes;
+
+    statistics_.bytes_requested += bytes;
+    statistics_.alignment_padding += kPadding;
+    statistics_.allocations++;
+    statistics_.peak_used = std::max(statistics_.peak_used, MemoryUsed());
 
     return allocated_address;
   }
 
   /// Implemenation of the do_deallocate() method for std::pmr::memory_resource
-  void do_deallocate(void * p,
-                     std::size_t bytes,
-                     std::size_t alignment) override
-  {
-    return resource_.deallocate(p, bytes, alignment);
-  }
+  ///
+  /// Memory is never reclaimed, as with std::pmr::monotonic_buffer_resource.
+  void do_deallocate(void *, std::size_t, std::size_t) override {}
 
   /// Implemenation of the do_is_equal() method for std::pmr::memory_resource
-  bool do_is_equal(
-      const std::pmr::memory_resource & other) const noexcept override
+  ///
+  /// Memory from this resource can only be deallocated through itself, which
+  /// std::pmr::memory_resource's operator==() already checks by address.
+  bool do_is_equal(const std::pmr::memory_resource &) const noexcept override
   {
-    return resource_.is_equal(other);
+    return false;
   }
 
  private:
   std::array<std::byte, kBufferSizeBytes> buffer_;
   std::byte * unallocated_memory_;
-  std::pmr::monotonic_buffer_resource resource_;
+  Statistics_t statistics_;
 };
 }  // namespace sjsu
@@ -1,6 +1,8 @@
 #include <libcore/utility/memory_resource.hpp>
 
 #include <cstdint>
+#include <memory_resource>
+#include <vector>
 
 #include <libcore/testing/testing_frameworks.hpp>
 
@@ -131,6 +133,68 @@ TEST_CASE("Testing StaticMemoryResource")
         std::bad_alloc);
   }
 
+  SECTION("Statistics")
+  {
+    // Setup
+    StaticMemoryResource<32> allocator;
+
+    // Exercise
+    // Exercise: Memory Allocation --> [x] [-] [-] [-] [x] [x] [x] [x] ...
+    [[maybe_unused]] void * allocate_block0 = allocator.allocate(1, 1);
+    [[maybe_unused]] void * allocate_block1 = allocator.allocate(4, 4);
+    CHECK_THROWS_AS(static_cast<void>(allocator.allocate(32, 1)),
+                    std::bad_alloc);
+
+    // Verify
+    const auto & statistics = allocator.GetStatistics();
+    CHECK(8 == allocator.MemoryUsed());
+    CHECK(5 == statistics.bytes_requested);
+    CHECK(3 == statistics.alignment_padding);
+    CHECK(8 == statistics.peak_used);
+    CHECK(2 == statistics.allocations);
+    CHECK(1 == statistics.failed_allocations);
+  }
+
+  SECTION("Mark() and Rewind()")
+  {
+    // Setup
+    StaticMemoryResource<32> allocator;
+    void * persistent = allocator.allocate(4, 4);
+
+    // Exercise
+    auto mark     = allocator.Mark();
+    void * frame0 = allocator.allocate(16, 4);
+    allocator.Rewind(mark);
+    void * frame1 = allocator.allocate(16, 4);
+
+    // Verify
+    CHECK(frame0 == frame1);
+    CHECK(persistent != frame1);
+    CHECK(20 == allocator.MemoryUsed());
+    CHECK(20 == allocator.GetStatistics().peak_used);
+
+    allocator.Reset();
+    CHECK(0 == allocator.MemoryUsed());
+  }
+
+  SECTION("Scope releases its allocations")
+  {
+    // Setup
+    StaticMemoryResource<64> allocator;
+    [[maybe_unused]] void * persistent = allocator.allocate(8, 8);
+
+    // Exercise
+    for (int frame = 0; frame < 10; frame++)
+    {
+      StaticMemoryResource<64>::Scope scope(allocator);
+      std::pmr::vector<uint8_t> scratch(&allocator);
+      scratch.resize(40);
+    }
+
+    // Verify
+    CHECK(8 == allocator.MemoryUsed());
+  }
+
   SECTION("Test .is_equal()")
   {
     // Setup
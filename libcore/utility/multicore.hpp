@@ -0,0 +1,291 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <libcore/utility/cache.hpp>
+#include <libcore/utility/inplace_function.hpp>
+
+namespace sjsu
+{
+/// Lock-free queue of fixed size messages from one core to another, such as
+/// Can::Message_t frames or batches of sensor samples, for splitting bus I/O
+/// and computation across the cores of a dual core processor like the RP2040
+/// or STM32H7.
+///
+/// Exactly one core (or context) may send and exactly one may receive. The
+/// read and write positions live on separate cache lines, so each core only
+/// writes its own line, and the acquire and release ordering of the positions
+/// makes a message's contents visible to the receiver before its position.
+///
+/// An optional doorbell is rung after every Send(), to raise an interrupt on
+/// the receiving core, for example by writing to the RP2040 SIO FIFO or
+/// taking and releasing an STM32H7 hardware semaphore. The receiver should
+/// Receive() until the mailbox is empty each time it is interrupted.
+///
+/// The mailbox must be in memory both cores see coherently. On the STM32H7
+/// that means a region the Cortex-M7 does not cache, set up with the MPU, as
+/// its data cache is not coherent with the Cortex-M4.
+///
+/// USAGE:
+///
+///    // In shared, non-cacheable memory:
+///    sjsu::Mailbox<sjsu::Can::Message_t, 32> can_frames;
+///
+///    // I/O core, from the CAN receive interrupt:
+///    can_frames.Send(message);
+///
+///    // Computation core:
+///    while (auto message = can_frames.Receive())
+///    {
+///      Process(*message);
+///    }
+///
+/// @tparam T - message type. Must be trivially copyable.
+/// @tparam kCapacity - number of messages the mailbox can hold. Must be a
+///         power of 2.
+template <typename T, size_t kCapacity>
+class Mailbox
+{
+ public:
+  static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                "Mailbox capacity must be a power of 2.");
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Mailbox messages must be trivially copyable.");
+  static_assert(std::atomic<size_t>::is_always_lock_free,
+                "Mailbox requires lock-free atomic loads and stores.");
+
+  /// Function that signals the receiving core that a message was sent.
+  using Doorbell = InplaceFunction<void(void)>;
+
+  Mailbox() = default;
+  Mailbox(const Mailbox &) = delete;
+  Mailbox & operator=(const Mailbox &) = delete;
+
+  /// Set the doorbell rung after every Send(). Set it before either core
+  /// starts using the mailbox.
+  ///
+  /// @param doorbell - function to call, or nullptr for none.
+  void SetDoorbell(Doorbell doorbell)
+  {
+    doorbell_ = std::move(doorbell);
+  }
+
+  // ===========================================================================
+  // Sender Methods
+  // ===========================================================================
+
+  /// Send a message.
+  ///
+  /// @param message - message to copy into the mailbox.
+  /// @return true - if the message was sent.
+  /// @return false - if the mailbox is full and the message was dropped.
+  bool Send(const T & message)
+  {
+    const size_t kWrite = write_.value.load(std::memory_order_relaxed);
+    const size_t kRead  = read_.value.load(std::memory_order_acquire);
+    if (kWrite - kRead >= kCapacity)
+    {
+      dropped_++;
+      return false;
+    }
+
+    slots_[kWrite & kMask] = message;
+    write_.value.store(kWrite + 1, std::memory_order_release);
+
+    if (doorbell_)
+    {
+      doorbell_();
+    }
+    return true;
+  }
+
+  /// @return uint32_t - number of messages dropped because the mailbox was
+  ///         full. Only read it from the sending core.
+  uint32_t Dropped() const
+  {
+    return dropped_;
+  }
+
+  // ===========================================================================
+  // Receiver Methods
+  // ===========================================================================
+
+  /// Take the oldest message.
+  ///
+  /// @return std::optional<T> - the message, or std::nullopt if the mailbox
+  ///         is empty.
+  std::optional<T> Receive()
+  {
+    const size_t kRead  = read_.value.load(std::memory_order_relaxed);
+    const size_t kWrite = write_.value.load(std::memory_order_acquire);
+    if (kRead == kWrite)
+    {
+      return std::nullopt;
+    }
+
+    T message = slots_[kRead & kMask];
+    read_.value.store(kRead + 1, std::memory_order_release);
+    return message;
+  }
+
+  // ===========================================================================
+  // Shared Methods
+  // ===========================================================================
+
+  /// @return size_t - number of messages waiting. Only a snapshot, as the
+  ///         other core may change it at any time.
+  size_t Size() const
+  {
+    return write_.value.load(std::memory_order_acquire) -
+           read_.value.load(std::memory_order_acquire);
+  }
+
+  /// @return constexpr size_t - maximum number of messages waiting.
+  static constexpr size_t Capacity()
+  {
+    return kCapacity;
+  }
+
+ private:
+  static constexpr size_t kMask = kCapacity - 1;
+
+  /// A position, alone on its cache line.
+  struct alignas(kCacheLineSize) Position_t
+  {
+    std::atomic<size_t> value = 0;
+  };
+
+  alignas(kCacheLineSize) std::array<T, kCapacity> slots_{};
+  Position_t write_;
+  Position_t read_;
+  // Only written by the sender, so it is kept off the receiver's cache line.
+  alignas(kCacheLineSize) uint32_t dropped_ = 0;
+  Doorbell doorbell_                         = nullptr;
+};
+
+/// Lock for rare updates of state shared between cores, which waits by
+/// spinning. Hold it for as short a time as possible, and mask interrupts
+/// with a CriticalSection while holding it if an interrupt on the same core
+/// may also take it, otherwise the interrupt spins forever.
+///
+/// Requires atomic read-modify-write instructions, such as the exclusive
+/// loads and stores of ARMv7-M. The RP2040's Cortex-M0+ cores have none; use
+/// HardwareSpinlock with one of its SIO spinlocks instead.
+///
+/// USAGE:
+///
+///    sjsu::Spinlock calibration_lock;
+///    {
+///      sjsu::ScopedLock lock(calibration_lock);
+///      calibration = new_calibration;
+///    }
+class Spinlock
+{
+ public:
+  /// Wait until the lock is free and take it.
+  void Lock()
+  {
+    while (!TryLock())
+    {
+      // Spin on a plain load, so the waiting core does not keep claiming the
+      // cache line with exclusive accesses.
+      while (locked_.load(std::memory_order_relaxed))
+      {
+      }
+    }
+  }
+
+  /// Take the lock if it is free.
+  ///
+  /// @return true - if the lock was taken.
+  bool TryLock()
+  {
+    return !locked_.exchange(true, std::memory_order_acquire);
+  }
+
+  /// Release the lock. Only call it while holding the lock.
+  void Unlock()
+  {
+    locked_.store(false, std::memory_order_release);
+  }
+
+ private:
+  alignas(kCacheLineSize) std::atomic<bool> locked_ = false;
+};
+
+/// Lock backed by a hardware spinlock register, such as one of the 32 SIO
+/// spinlocks of the RP2040: reading the register claims the lock and returns
+/// non-zero if it was free, and writing any value releases it.
+class HardwareSpinlock
+{
+ public:
+  /// @param lock_register - the hardware spinlock register.
+  explicit HardwareSpinlock(volatile uint32_t * lock_register)
+      : lock_register_(lock_register)
+  {
+  }
+
+  /// Wait until the lock is free and take it.
+  void Lock()
+  {
+    while (!TryLock())
+    {
+    }
+  }
+
+  /// Take the lock if it is free.
+  ///
+  /// @return true - if the lock was taken.
+  bool TryLock()
+  {
+    if (*lock_register_ == 0)
+    {
+      return false;
+    }
+    // Accesses made while holding the lock must not move before it is taken.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+
+  /// Release the lock. Only call it while holding the lock.
+  void Unlock()
+  {
+    std::atomic_thread_fence(std::memory_order_release);
+    *lock_register_ = 1;
+  }
+
+ private:
+  volatile uint32_t * lock_register_;
+};
+
+/// Holds a Spinlock or HardwareSpinlock for as long as it is in scope.
+///
+/// @tparam Lock - type of the lock.
+template <typename Lock>
+class ScopedLock
+{
+ public:
+  /// @param lock - lock to take, and release at the end of the scope.
+  explicit ScopedLock(Lock & lock) : lock_(lock)
+  {
+    lock_.Lock();
+  }
+
+  ScopedLock(const ScopedLock &) = delete;
+  ScopedLock & operator=(const ScopedLock &) = delete;
+
+  ~ScopedLock()
+  {
+    lock_.Unlock();
+  }
+
+ private:
+  Lock & lock_;
+};
+}  // namespace sjsu
@@ -0,0 +1,189 @@
+#include <libcore/utility/multicore.hpp>
+
+#include <cstdint>
+#include <thread>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+namespace
+{
+struct Frame_t
+{
+  uint32_t sequence;
+  uint32_t check;
+};
+}  // namespace
+
+TEST_CASE("Testing Mailbox")
+{
+  Mailbox<Frame_t, 8> mailbox;
+
+  SECTION("Starts empty")
+  {
+    // Exercise & Verify
+    CHECK(0 == mailbox.Size());
+    CHECK(8 == mailbox.Capacity());
+    CHECK(!mailbox.Receive().has_value());
+  }
+
+  SECTION("Receives messages in the order they were sent")
+  {
+    // Setup
+    mailbox.Send({ .sequence = 1, .check = 10 });
+    mailbox.Send({ .sequence = 2, .check = 20 });
+
+    // Exercise
+    auto first  = mailbox.Receive();
+    auto second = mailbox.Receive();
+
+    // Verify
+    REQUIRE(first.has_value());
+    REQUIRE(second.has_value());
+    CHECK(1 == first->sequence);
+    CHECK(20 == second->check);
+    CHECK(!mailbox.Receive().has_value());
+  }
+
+  SECTION("Drops messages when full")
+  {
+    // Setup
+    for (uint32_t i = 0; i < mailbox.Capacity(); i++)
+    {
+      CHECK(mailbox.Send({ .sequence = i, .check = 0 }));
+    }
+
+    // Exercise
+    bool sent = mailbox.Send({ .sequence = 100, .check = 0 });
+
+    // Verify
+    CHECK(!sent);
+    CHECK(1 == mailbox.Dropped());
+    CHECK(8 == mailbox.Size());
+    CHECK(0 == mailbox.Receive()->sequence);
+  }
+
+  SECTION("Rings the doorbell after each message")
+  {
+    // Setup
+    int rings = 0;
+    mailbox.SetDoorbell([&mailbox, &rings]() {
+      // The message must already be visible when the doorbell rings.
+      CHECK(mailbox.Size() == static_cast<size_t>(rings + 1));
+      rings++;
+    });
+
+    // Exercise
+    mailbox.Send({ .sequence = 1, .check = 0 });
+    mailbox.Send({ .sequence = 2, .check = 0 });
+
+    // Verify
+    CHECK(2 == rings);
+  }
+
+  SECTION("Passes messages intact between threads")
+  {
+    // Setup
+    constexpr uint32_t kMessages = 100'000;
+    uint32_t received            = 0;
+    uint32_t corrupted           = 0;
+    uint32_t out_of_order        = 0;
+
+    // Exercise
+    std::thread consumer([&]() {
+      while (received < kMessages)
+      {
+        if (auto frame = mailbox.Receive())
+        {
+          corrupted += (frame->check != ~frame->sequence);
+          out_of_order += (frame->sequence != received);
+          received++;
+        }
+      }
+    });
+    for (uint32_t i = 0; i < kMessages; i++)
+    {
+      while (!mailbox.Send({ .sequence = i, .check = ~i }))
+      {
+      }
+    }
+    consumer.join();
+
+    // Verify
+    CHECK(kMessages == received);
+    CHECK(0 == corrupted);
+    CHECK(0 == out_of_order);
+  }
+}
+
+TEST_CASE("Testing Spinlock")
+{
+  Spinlock lock;
+
+  SECTION("TryLock() fails while the lock is held")
+  {
+    // Setup
+    REQUIRE(lock.TryLock());
+
+    // Exercise & Verify
+    CHECK(!lock.TryLock());
+    lock.Unlock();
+    CHECK(lock.TryLock());
+  }
+
+  SECTION("Protects shared state between threads")
+  {
+    // Setup
+    constexpr int kIncrements = 100'000;
+    int counter               = 0;
+    auto increment            = [&]() {
+      for (int i = 0; i < kIncrements; i++)
+      {
+        ScopedLock guard(lock);
+        counter++;
+      }
+    };
+
+    // Exercise
+    std::thread other(increment);
+    increment();
+    other.join();
+
+    // Verify
+    CHECK(2 * kIncrements == counter);
+  }
+}
+
+TEST_CASE("Testing HardwareSpinlock")
+{
+  // Simulates an RP2040 SIO spinlock register, which reads non-zero when the
+  // lock was free and is claimed by that read.
+  volatile uint32_t lock_register = 0;
+  HardwareSpinlock lock(&lock_register);
+
+  SECTION("TryLock() fails when the register reads 0")
+  {
+    // Exercise & Verify
+    CHECK(!lock.TryLock());
+  }
+
+  SECTION("TryLock() succeeds when the register reads non-zero")
+  {
+    // Setup
+    lock_register = 1u << 3;
+
+    // Exercise & Verify
+    CHECK(lock.TryLock());
+  }
+
+  SECTION("Unlock() writes the register")
+  {
+    // Exercise
+    lock.Unlock();
+
+    // Verify
+    CHECK(0 != lock_register);
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,238 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <experimental/source_location>
+
+#include <libcore/utility/log.hpp>
+#include <libcore/utility/time/cycle_counter.hpp>
+
+/// Set to 1 to compile in the regions marked with SJ2_PROFILE_SCOPE(). When 0,
+/// the macro expands to nothing.
+#ifndef SJ2_PROFILING
+#define SJ2_PROFILING 0
+#endif
+
+namespace sjsu::profile
+{
+/// Statistics of a single profiled region of code, in counts of the
+/// CycleCounter: CPU cycles, or nanoseconds on platforms without a cycle
+/// counter.
+///
+/// A Site_t is usually a static variable declared by SJ2_PROFILE_SCOPE(). Its
+/// constructor is constexpr, so it is constant initialized and entering the
+/// region does not check a guard variable. Each site adds itself to the list
+/// walked by ForEach() the first time it records a measurement.
+///
+/// Not safe to record into the same site from contexts that may preempt each
+/// other; a race only affects the recorded statistics.
+class Site_t
+{
+ public:
+  /// Number of histogram buckets. Bucket `i` counts measurements `m` where
+  /// std::bit_width(m) == i, i.e. bucket 0 holds 0 and bucket `i` holds
+  /// [2^(i-1), 2^i).
+  static constexpr size_t kBuckets = 33;
+
+  /// @param name - name of the region.
+  /// @param location - location of the region in the source code. Defaults
+  ///        to the location of the caller.
+  constexpr Site_t(const char * name,
+                   const log::Location_t & location =
+                       std::experimental::source_location::current())
+      : name_(name), location_(location)
+  {
+  }
+
+  Site_t(const Site_t &) = delete;
+  Site_t & operator=(const Site_t &) = delete;
+
+  /// Record a single measurement.
+  ///
+  /// @param counts - duration of the region in CycleCounter counts.
+  void Record(uint32_t counts)
+  {
+    if (!linked_)
+    {
+      linked_ = true;
+      next_   = list;
+      list    = this;
+    }
+
+    if (count_ == 0 || counts < minimum_)
+    {
+      minimum_ = counts;
+    }
+    if (counts > maximum_)
+    {
+      maximum_ = counts;
+    }
+    total_ += counts;
+    count_++;
+    histogram_[std::bit_width(counts)]++;
+  }
+
+  /// Clear the statistics of the site.
+  void Reset()
+  {
+    count_   = 0;
+    total_   = 0;
+    minimum_ = 0;
+    maximum_ = 0;
+    histogram_.fill(0);
+  }
+
+  /// @return const char* - name of the region.
+  const char * Name() const
+  {
+    return name_;
+  }
+
+  /// @return const log::Location_t& - location of the region.
+  const log::Location_t & Location() const
+  {
+    return location_;
+  }
+
+  /// @return uint32_t - number of measurements.
+  uint32_t Count() const
+  {
+    return count_;
+  }
+
+  /// @return uint32_t - shortest measurement, 0 if there are none.
+  uint32_t Minimum() const
+  {
+    return minimum_;
+  }
+
+  /// @return uint32_t - longest measurement, 0 if there are none.
+  uint32_t Maximum() const
+  {
+    return maximum_;
+  }
+
+  /// @return uint32_t - mean of the measurements, 0 if there are none.
+  uint32_t Mean() const
+  {
+    return (count_ == 0) ? 0 : static_cast<uint32_t>(total_ / count_);
+  }
+
+  /// @return const std::array<uint32_t, kBuckets>& - log2 histogram of the
+  ///         measurements.
+  const std::array<uint32_t, kBuckets> & Histogram() const
+  {
+    return histogram_;
+  }
+
+  /// Call `callback` with every site that has recorded a measurement, most
+  /// recently first recorded first.
+  ///
+  /// @param callback - callable with the signature `void(Site_t &)`.
+  template <typename Callback>
+  static void ForEach(Callback && callback)
+  {
+    for (Site_t * site = list; site != nullptr; site = site->next_)
+    {
+      callback(*site);
+    }
+  }
+
+ private:
+  static inline Site_t * list = nullptr;
+
+  const char * name_;
+  log::Location_t location_;
+  Site_t * next_      = nullptr;
+  bool linked_        = false;
+  uint32_t count_     = 0;
+  uint32_t minimum_   = 0;
+  uint32_t maximum_   = 0;
+  uint64_t total_     = 0;
+  std::array<uint32_t, kBuckets> histogram_{};
+};
+
+/// Measures the time between its construction and destruction and records it
+/// into a Site_t.
+class Scope
+{
+ public:
+  /// @param site - site to record into.
+  explicit Scope(Site_t & site) : site_(site), start_(CycleCounter::Read()) {}
+
+  Scope(const Scope &) = delete;
+  Scope & operator=(const Scope &) = delete;
+
+  ~Scope()
+  {
+    site_.Record(CycleCounter::Elapsed(start_, CycleCounter::Read()));
+  }
+
+ private:
+  Site_t & site_;
+  uint32_t start_;
+};
+
+/// Print the statistics and non-empty histogram buckets of every site through
+/// log::Print.
+inline void Dump()
+{
+  constexpr const char * kUnit = CycleCounter::kCountsCycles ? "cycles" : "ns";
+
+  Site_t::ForEach(
+      [kUnit](const Site_t & site)
+      {
+        log::Print("{} ({}:{}) count={} min={} mean={} max={} {}\n",
+                   site.Name(),
+                   site.Location().file,
+                   site.Location().line,
+                   site.Count(),
+                   site.Minimum(),
+                   site.Mean(),
+                   site.Maximum(),
+                   kUnit);
+
+        const auto & histogram = site.Histogram();
+        for (size_t i = 0; i < histogram.size(); i++)
+        {
+          if (histogram[i] != 0)
+          {
+            const uint64_t kLower = (i == 0) ? 0 : uint64_t{ 1 } << (i - 1);
+            const uint64_t kUpper = uint64_t{ 1 } << i;
+            log::Print("  [{}, {}): {}\n", kLower, kUpper, histogram[i]);
+          }
+        }
+      });
+}
+}  // namespace sjsu::profile
+
+#define SJ2_PROFILE_CONCAT_HELPER(a, b) a##b
+#define SJ2_PROFILE_CONCAT(a, b) SJ2_PROFILE_CONCAT_HELPER(a, b)
+
+/// Profile the rest of the enclosing scope. The statistics of each use are
+/// stored in a static Site_t, keyed by its location in the source code, and
+/// printed by sjsu::profile::Dump(). Call sjsu::CycleCounter::Enable() once
+/// at startup.
+///
+/// Compiles to nothing unless SJ2_PROFILING is 1. At most one use per line.
+///
+/// Usage:
+///
+///    void Spi::Transfer()
+///    {
+///      SJ2_PROFILE_SCOPE("Spi::Transfer");
+///      // ...
+///    }
+///
+/// @param name - string literal name of the region.
+#if SJ2_PROFILING
+#define SJ2_PROFILE_SCOPE(name)                                             \
+  static constinit ::sjsu::profile::Site_t SJ2_PROFILE_CONCAT(              \
+      sj2_profile_site, __LINE__)(name);                                    \
+  ::sjsu::profile::Scope SJ2_PROFILE_CONCAT(sj2_profile_scope, __LINE__)(   \
+      SJ2_PROFILE_CONCAT(sj2_profile_site, __LINE__))
+#else
+#define SJ2_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
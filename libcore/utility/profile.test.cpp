@@ -0,0 +1,85 @@
+#include <libcore/utility/profile.hpp>
+
+#include <cstdint>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::profile
+{
+TEST_CASE("Testing profile::Site_t")
+{
+  SECTION("Starts empty")
+  {
+    // Setup
+    Site_t site("empty");
+
+    // Verify
+    CHECK(0 == site.Count());
+    CHECK(0 == site.Minimum());
+    CHECK(0 == site.Maximum());
+    CHECK(0 == site.Mean());
+    CHECK(std::string_view("empty") == site.Name());
+    CHECK(std::string_view("profile.test.cpp") == site.Location().file);
+  }
+
+  SECTION("Record()")
+  {
+    // Setup
+    static constinit Site_t site("record");
+
+    // Exercise
+    site.Record(10);
+    site.Record(3);
+    site.Record(20);
+    site.Record(0);
+
+    // Verify
+    CHECK(4 == site.Count());
+    CHECK(0 == site.Minimum());
+    CHECK(20 == site.Maximum());
+    CHECK(8 == site.Mean());
+    CHECK(1 == site.Histogram()[0]);
+    CHECK(1 == site.Histogram()[2]);
+    CHECK(1 == site.Histogram()[4]);
+    CHECK(1 == site.Histogram()[5]);
+    CHECK(0 == site.Histogram()[1]);
+  }
+
+  SECTION("Reset()")
+  {
+    // Setup
+    static constinit Site_t site("reset");
+    site.Record(10);
+
+    // Exercise
+    site.Reset();
+
+    // Verify
+    CHECK(0 == site.Count());
+    CHECK(0 == site.Maximum());
+    CHECK(0 == site.Histogram()[4]);
+  }
+
+  SECTION("Scope records into its site")
+  {
+    // Setup
+    static constinit Site_t site("scope");
+
+    // Exercise
+    {
+      Scope scope(site);
+    }
+    {
+      Scope scope(site);
+    }
+
+    // Verify
+    CHECK(2 == site.Count());
+    CHECK(site.Minimum() <= site.Maximum());
+
+    bool found = false;
+    Site_t::ForEach([&found](Site_t & other) { found |= (&other == &site); });
+    CHECK(found);
+  }
+}
+}  // namespace sjsu::profile
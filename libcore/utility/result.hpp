@@ -0,0 +1,262 @@
+#pragma once
+
+#include <cstdint>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/log.hpp>
+
+namespace sjsu
+{
+/// An error returned by value rather than thrown, for code that cannot afford
+/// the flash of exception tables or the latency of unwinding. Alongside its
+/// error code, it records the file and line where it was created, similar to
+/// sjsu::Exception.
+struct Error_t
+{
+  /// @param error_code - error code that represents this error.
+  /// @param location - location of where this error was created.
+  constexpr Error_t(  // NOLINT
+      std::errc error_code,
+      const std::experimental::source_location & location =
+          std::experimental::source_location::current())
+      : code(error_code), file(location.file_name()), line(location.line())
+  {
+  }
+
+  /// @param exception - exception to convert into an error, keeping the
+  ///        location that it was created at.
+  explicit Error_t(const Exception & exception)
+      : code(exception.GetCode()),
+        file(exception.GetFile()),
+        line(static_cast<uint32_t>(exception.GetLine()))
+  {
+  }
+
+  /// Print the error code and its location to STDOUT.
+  void Print() const
+  {
+    sjsu::log::Print("Error:{}({}):{}:{}\n",
+                     Stringify(code),
+                     static_cast<int>(code),
+                     file,
+                     static_cast<int>(line));
+  }
+
+  /// @param error - the error to check.
+  /// @param error_code - the error code to compare against.
+  /// @return true - `error` has the error code `error_code`.
+  friend constexpr bool operator==(const Error_t & error, std::errc error_code)
+  {
+    return error.code == error_code;
+  }
+
+  /// Error code associated with this error.
+  std::errc code = std::errc{};
+
+  /// Name of the file where this error was created.
+  const char * file = Exception::kEmptyMessage;
+
+  /// Line of the file where this error was created.
+  uint32_t line = 0;
+};
+
+/// Holds either the value of type T returned by a successful operation or the
+/// Error_t of a failed one, like std::expected. Nothing is thrown when
+/// accessing a Result, so check it before using its value.
+///
+/// USAGE:
+///
+///    sjsu::Result<uint8_t> ReadStatus()
+///    {
+///      std::array<uint8_t, 1> status;
+///      auto result = i2c.TryWriteThenRead(kAddress, kStatus, status);
+///      if (!result)
+///      {
+///        return result.Error();
+///      }
+///      return status[0];
+///    }
+///
+/// @tparam T - type of the value of a successful operation.
+template <typename T>
+class [[nodiscard]] Result
+{
+ public:
+  /// @param value - the value of a successful operation.
+  constexpr Result(T value) : storage_(std::move(value)) {}  // NOLINT
+
+  /// @param error - the error of a failed operation.
+  constexpr Result(Error_t error) : storage_(error) {}  // NOLINT
+
+  /// @return true - if the operation succeeded and the result holds a value.
+  constexpr bool HasValue() const
+  {
+    return std::holds_alternative<T>(storage_);
+  }
+
+  /// @return true - if the operation succeeded and the result holds a value.
+  constexpr explicit operator bool() const
+  {
+    return HasValue();
+  }
+
+  /// @return T& - the value. The result must hold a value.
+  constexpr T & Value()
+  {
+    return *std::get_if<T>(&storage_);
+  }
+
+  /// @return const T& - the value. The result must hold a value.
+  constexpr const T & Value() const
+  {
+    return *std::get_if<T>(&storage_);
+  }
+
+  /// @param fallback - value to return if the operation failed.
+  /// @return T - the value, or `fallback` if the operation failed.
+  constexpr T ValueOr(T fallback) const
+  {
+    return HasValue() ? Value() : fallback;
+  }
+
+  /// @return Error_t - the error, or an error with a code of 0 if the
+  ///         operation succeeded.
+  constexpr Error_t Error() const
+  {
+    const Error_t * error = std::get_if<Error_t>(&storage_);
+    return error ? *error : Error_t(std::errc{});
+  }
+
+  /// @return std::errc - the error code, or 0 if the operation succeeded.
+  constexpr std::errc GetCode() const
+  {
+    return Error().code;
+  }
+
+  /// Convert the result into the throwing style of error handling, for code
+  /// that calls a non-throwing operation from a throwing one.
+  ///
+  /// @return T - the value.
+  /// @throw sjsu::Exception - with the error code of the failed operation.
+  T OrThrow() const
+  {
+    if (!HasValue())
+    {
+      throw Exception(GetCode(), "Result holds an error.");
+    }
+    return Value();
+  }
+
+ private:
+  std::variant<T, Error_t> storage_;
+};
+
+/// The result of an operation that only succeeds or fails.
+template <>
+class [[nodiscard]] Result<void>
+{
+ public:
+  /// A successful result.
+  constexpr Result() : error_(std::errc{}) {}
+
+  /// @param error - the error of a failed operation. An error code of 0 means
+  ///        success.
+  constexpr Result(Error_t error) : error_(error) {}  // NOLINT
+
+  /// @return true - if the operation succeeded.
+  constexpr bool HasValue() const
+  {
+    return error_.code == std::errc{};
+  }
+
+  /// @return true - if the operation succeeded.
+  constexpr explicit operator bool() const
+  {
+    return HasValue();
+  }
+
+  /// @return Error_t - the error, or an error with a code of 0 if the
+  ///         operation succeeded.
+  constexpr Error_t Error() const
+  {
+    return error_;
+  }
+
+  /// @return std::errc - the error code, or 0 if the operation succeeded.
+  constexpr std::errc GetCode() const
+  {
+    return error_.code;
+  }
+
+  /// Convert the result into the throwing style of error handling.
+  ///
+  /// @throw sjsu::Exception - with the error code of the failed operation.
+  void OrThrow() const
+  {
+    if (!HasValue())
+    {
+      throw Exception(GetCode(), "Result holds an error.");
+    }
+  }
+
+ private:
+  Error_t error_;
+};
+
+/// Convert the status code of an operation into a Result<void>.
+///
+/// @param status - status of the operation, where 0 means success.
+/// @param location - location recorded in the error if the operation failed.
+/// @return Result<void> - the status as a result.
+constexpr Result<void> ToResult(
+    std::errc status,
+    const std::experimental::source_location & location =
+        std::experimental::source_location::current())
+{
+  if (status == std::errc{})
+  {
+    return {};
+  }
+  return Error_t(status, location);
+}
+
+/// Call an operation that reports errors by throwing sjsu::Exception and
+/// return its outcome as a Result. This is how the non-throwing variants of
+/// the peripheral interfaces are implemented by default, until a driver
+/// overrides them with code that never throws. When exceptions are disabled,
+/// the operation is simply called.
+///
+/// @param operation - the operation to call.
+/// @return Result<R> - the value returned by the operation, or the error it
+///         threw, with the location that the error was created at.
+template <typename Operation>
+auto Capture(Operation && operation)
+    -> Result<std::invoke_result_t<Operation>>
+{
+  using Return_t = std::invoke_result_t<Operation>;
+#if defined(__cpp_exceptions)
+  try
+  {
+#endif
+    if constexpr (std::is_void_v<Return_t>)
+    {
+      operation();
+      return {};
+    }
+    else
+    {
+      return operation();
+    }
+#if defined(__cpp_exceptions)
+  }
+  catch (const Exception & exception)
+  {
+    return Error_t(exception);
+  }
+#endif
+}
+}  // namespace sjsu
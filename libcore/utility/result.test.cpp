@@ -0,0 +1,86 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/result.hpp>
+
+#include <string_view>
+
+namespace sjsu
+{
+namespace
+{
+Result<int> HalfOfEven(int value)
+{
+  if (value % 2 != 0)
+  {
+    return Error_t(std::errc::invalid_argument);
+  }
+  return value / 2;
+}
+}  // namespace
+
+TEST_CASE("Testing Result")
+{
+  SECTION("Value")
+  {
+    // Exercise
+    auto result = HalfOfEven(8);
+
+    // Verify
+    CHECK(result.HasValue());
+    CHECK(static_cast<bool>(result));
+    CHECK(4 == result.Value());
+    CHECK(4 == result.ValueOr(-1));
+    CHECK(4 == result.OrThrow());
+    CHECK(std::errc{} == result.GetCode());
+  }
+
+  SECTION("Error")
+  {
+    // Exercise
+    auto result = HalfOfEven(7);
+
+    // Verify
+    CHECK(!result.HasValue());
+    CHECK(-1 == result.ValueOr(-1));
+    CHECK(result.Error() == std::errc::invalid_argument);
+    CHECK(std::string_view(result.Error().file).ends_with("result.test.cpp"));
+    CHECK(0 != result.Error().line);
+    CHECK_THROWS_AS(result.OrThrow(), sjsu::Exception);
+  }
+
+  SECTION("void")
+  {
+    // Setup
+    Result<void> success;
+    Result<void> failure = Error_t(std::errc::timed_out);
+
+    // Verify
+    CHECK(success);
+    CHECK(!failure);
+    CHECK(std::errc::timed_out == failure.GetCode());
+    CHECK(ToResult(std::errc{}));
+    CHECK(ToResult(std::errc::io_error).GetCode() == std::errc::io_error);
+    CHECK_THROWS_AS(failure.OrThrow(), sjsu::Exception);
+  }
+
+  SECTION("Capture")
+  {
+    // Setup
+    int calls = 0;
+
+    // Exercise
+    auto value   = Capture([&calls]() { return ++calls; });
+    auto nothing = Capture([&calls]() { calls++; });
+    auto thrown  = Capture([]() -> int {
+      throw Exception(std::errc::bad_message, "Corrupt frame.");
+    });
+
+    // Verify
+    CHECK(2 == calls);
+    CHECK(1 == value.Value());
+    CHECK(nothing);
+    CHECK(thrown.GetCode() == std::errc::bad_message);
+    // The location is where the exception was created.
+    CHECK(std::string_view(thrown.Error().file).ends_with("result.test.cpp"));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace sjsu
+{
+/// Statically sized, lock-free, single-producer/single-consumer ring buffer.
+///
+/// Intended to be filled by an interrupt service routine (the producer) and
+/// drained by application code (the consumer), such as a UART driver's receive
+/// ISR feeding a protocol parser. No locks or critical sections are needed as
+/// long as only one context writes and only one context reads.
+///
+/// The read and write positions are free running counters which are masked
+/// into the storage array, which is why the capacity must be a power of 2.
+/// This lets the buffer use every slot of its storage and makes Size() a
+/// single subtraction.
+///
+/// The consumer can access the buffered data in place using Peek(), which
+/// returns the largest contiguous readable region, followed by Consume() to
+/// release those elements back to the producer.
+///
+/// USAGE:
+///
+///    RingBuffer<uint8_t, 64> rx_buffer;
+///
+///    // Within an ISR
+///    rx_buffer.Push(uart_data_register);
+///
+///    // Within application code
+///    auto region = rx_buffer.Peek();
+///    size_t parsed = ParseInPlace(region);
+///    rx_buffer.Consume(parsed);
+///
+/// @tparam T - type of each element in the buffer.
+/// @tparam kCapacity - number of elements the buffer can hold. Must be a power
+///         of 2.
+template <typename T, size_t kCapacity>
+class RingBuffer
+{
+ public:
+  static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                "RingBuffer capacity must be a power of 2.");
+
+  // ===========================================================================
+  // Producer Methods
+  // ===========================================================================
+
+  /// Add a single element to the end of the buffer.
+  ///
+  /// @param value - element to add.
+  /// @return true - if the element was added.
+  /// @return false - if the buffer is full and the element was dropped.
+  bool Push(const T & value)
+  {
+    const size_t write = write_.load(std::memory_order_relaxed);
+    const size_t read  = read_.load(std::memory_order_acquire);
+
+    if (write - read >= kCapacity)
+    {
+      return false;
+    }
+
+    buffer_[write & kMask] = value;
+    write_.store(write + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Add as many elements from `data` as will fit into the buffer.
+  ///
+  /// @param data - elements to add to the buffer.
+  /// @return size_t - number of elements from the start of `data` that were
+  ///         added to the buffer.
+  size_t Write(std::span<const T> data)
+  {
+    const size_t write  = write_.load(std::memory_order_relaxed);
+    const size_t read   = read_.load(std::memory_order_acquire);
+    const size_t amount = std::min(data.size(), kCapacity - (write - read));
+
+    // Copy in up to two pieces, the first up to the end of the storage array
+    // and the second wrapping around to the start of it.
+    const size_t start = write & kMask;
+    const size_t first = std::min(amount, kCapacity - start);
+    std::copy_n(data.begin(), first, buffer_.begin() + start);
+    std::copy_n(data.begin() + first, amount - first, buffer_.begin());
+
+    write_.store(write + amount, std::memory_order_release);
+    return amount;
+  }
+
+  // ===========================================================================
+  // Consumer Methods
+  // ===========================================================================
+
+  /// @return std::span<const T> - the largest contiguous region of readable
+  ///         elements, starting with the oldest element. The region may be
+  ///         shorter than Size() if the data wraps around the end of the
+  ///         storage array, in which case another Peek() after Consume() will
+  ///         return the rest. Elements stay valid until they are consumed.
+  std::span<const T> Peek() const
+  {
+    const size_t read  = read_.load(std::memory_order_relaxed);
+    const size_t write = write_.load(std::memory_order_acquire);
+    const size_t start = read & kMask;
+    const size_t count = std::min(write - read, kCapacity - start);
+    return std::span<const T>(buffer_.data() + start, count);
+  }
+
+  /// Release elements from the front of the buffer back to the producer.
+  ///
+  /// @param count - number of elements to release. Clamped to Size().
+  void Consume(size_t count)
+  {
+    const size_t read  = read_.load(std::memory_order_relaxed);
+    const size_t write = write_.load(std::memory_order_acquire);
+    count              = std::min(count, write - read);
+    read_.store(read + count, std::memory_order_release);
+  }
+
+  /// Remove and return the oldest element in the buffer.
+  ///
+  /// @return std::optional<T> - the oldest element or std::nullopt if the
+  ///         buffer is empty.
+  std::optional<T> Pop()
+  {
+    const size_t read  = read_.load(std::memory_order_relaxed);
+    const size_t write = write_.load(std::memory_order_acquire);
+
+    if (read == write)
+    {
+      return std::nullopt;
+    }
+
+    T value = buffer_[read & kMask];
+    read_.store(read + 1, std::memory_order_release);
+    return value;
+  }
+
+  /// Copy elements out of the buffer and consume them.
+  ///
+  /// @param data - destination for the elements.
+  /// @return size_t - number of elements copied into `data`.
+  size_t Read(std::span<T> data)
+  {
+    size_t total = 0;
+
+    // At most two passes are needed: one up to the end of the storage array
+    // and one for the portion that wrapped around.
+    for (int pass = 0; pass < 2 && total < data.size(); pass++)
+    {
+      auto region  = Peek();
+      size_t count = std::min(region.size(), data.size() - total);
+      std::copy_n(region.begin(), count, data.begin() + total);
+      Consume(count);
+      total += count;
+    }
+
+    return total;
+  }
+
+  /// Discard every element currently in the buffer. Must only be called from
+  /// the consumer.
+  void Clear()
+  {
+    read_.store(write_.load(std::memory_order_acquire),
+                std::memory_order_release);
+  }
+
+  // ===========================================================================
+  // Status Methods
+  // ===========================================================================
+
+  /// @return size_t - number of elements currently held in the buffer.
+  size_t Size() const
+  {
+    return write_.load(std::memory_order_acquire) -
+           read_.load(std::memory_order_acquire);
+  }
+
+  /// @return constexpr size_t - maximum number of elements the buffer can hold.
+  static constexpr size_t Capacity()
+  {
+    return kCapacity;
+  }
+
+  /// @return true - if there are no elements in the buffer.
+  bool IsEmpty() const
+  {
+    return Size() == 0;
+  }
+
+  /// @return true - if no more elements can be added to the buffer.
+  bool IsFull() const
+  {
+    return Size() >= kCapacity;
+  }
+
+ private:
+  static constexpr size_t kMask = kCapacity - 1;
+
+  std::array<T, kCapacity> buffer_{};
+  std::atomic<size_t> write_ = 0;
+  std::atomic<size_t> read_  = 0;
+};
+}  // namespace sjsu
@@ -0,0 +1,148 @@
+#include <libcore/utility/ring_buffer.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing RingBuffer")
+{
+  RingBuffer<uint8_t, 8> ring_buffer;
+
+  SECTION("Initial state")
+  {
+    // Verify
+    CHECK(ring_buffer.IsEmpty());
+    CHECK(!ring_buffer.IsFull());
+    CHECK(0 == ring_buffer.Size());
+    CHECK(8 == ring_buffer.Capacity());
+    CHECK(ring_buffer.Peek().empty());
+    CHECK(!ring_buffer.Pop().has_value());
+  }
+
+  SECTION("Push() and Pop()")
+  {
+    // Exercise
+    CHECK(ring_buffer.Push(0xAA));
+    CHECK(ring_buffer.Push(0xBB));
+
+    // Verify
+    CHECK(2 == ring_buffer.Size());
+    CHECK(0xAA == ring_buffer.Pop().value());
+    CHECK(0xBB == ring_buffer.Pop().value());
+    CHECK(ring_buffer.IsEmpty());
+  }
+
+  SECTION("Push() drops elements when full")
+  {
+    // Setup
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      CHECK(ring_buffer.Push(i));
+    }
+
+    // Exercise
+    bool pushed = ring_buffer.Push(0xFF);
+
+    // Verify
+    CHECK(!pushed);
+    CHECK(ring_buffer.IsFull());
+    CHECK(0 == ring_buffer.Pop().value());
+  }
+
+  SECTION("Write() only copies what fits")
+  {
+    // Setup
+    std::array<uint8_t, 10> payload = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    // Exercise
+    size_t written = ring_buffer.Write(payload);
+
+    // Verify
+    CHECK(8 == written);
+    CHECK(ring_buffer.IsFull());
+  }
+
+  SECTION("Peek() and Consume() across the wrap around")
+  {
+    // Setup
+    // Move the read/write positions to the middle of the storage array.
+    std::array<uint8_t, 6> filler = {};
+    ring_buffer.Write(filler);
+    ring_buffer.Consume(filler.size());
+
+    std::array<uint8_t, 5> payload = { 0x10, 0x20, 0x30, 0x40, 0x50 };
+    ring_buffer.Write(payload);
+
+    // Exercise
+    auto first_region = ring_buffer.Peek();
+    std::array<uint8_t, 2> first_copy;
+    std::copy(first_region.begin(), first_region.end(), first_copy.begin());
+    ring_buffer.Consume(first_region.size());
+    auto second_region = ring_buffer.Peek();
+
+    // Verify
+    REQUIRE(2 == first_region.size());
+    CHECK(0x10 == first_copy[0]);
+    CHECK(0x20 == first_copy[1]);
+    REQUIRE(3 == second_region.size());
+    CHECK(0x30 == second_region[0]);
+    CHECK(0x40 == second_region[1]);
+    CHECK(0x50 == second_region[2]);
+  }
+
+  SECTION("Consume() is clamped to Size()")
+  {
+    // Setup
+    ring_buffer.Push(0x01);
+
+    // Exercise
+    ring_buffer.Consume(100);
+
+    // Verify
+    CHECK(ring_buffer.IsEmpty());
+    CHECK(ring_buffer.Push(0x02));
+    CHECK(1 == ring_buffer.Size());
+  }
+
+  SECTION("Read() across the wrap around")
+  {
+    // Setup
+    std::array<uint8_t, 7> filler = {};
+    ring_buffer.Write(filler);
+    ring_buffer.Consume(filler.size());
+
+    std::array<uint8_t, 4> payload = { 0xA1, 0xA2, 0xA3, 0xA4 };
+    ring_buffer.Write(payload);
+
+    std::array<uint8_t, 6> destination = {};
+
+    // Exercise
+    size_t bytes_read = ring_buffer.Read(destination);
+
+    // Verify
+    CHECK(4 == bytes_read);
+    CHECK(0xA1 == destination[0]);
+    CHECK(0xA2 == destination[1]);
+    CHECK(0xA3 == destination[2]);
+    CHECK(0xA4 == destination[3]);
+    CHECK(ring_buffer.IsEmpty());
+  }
+
+  SECTION("Clear()")
+  {
+    // Setup
+    ring_buffer.Push(0x01);
+    ring_buffer.Push(0x02);
+
+    // Exercise
+    ring_buffer.Clear();
+
+    // Verify
+    CHECK(ring_buffer.IsEmpty());
+    CHECK(ring_buffer.Peek().empty());
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include <libcore/utility/critical_section.hpp>
+
+namespace sjsu
+{
+/// A sequence lock protects a value that is written rarely or from a context
+/// that must never block, such as an interrupt service routine, and read from
+/// contexts that can afford to retry, such as a control loop.
+///
+/// Writers never wait. Each write increments the sequence number once before
+/// and once after modifying the value, so the sequence number is odd while a
+/// write is in progress and even otherwise. Readers copy the value and then
+/// check that the sequence number was even and unchanged during the copy; if
+/// not, the copy may be torn and is retried.
+///
+/// Since every completed write advances the sequence number by 2, readers can
+/// also use the sequence number to detect whether the value has changed since
+/// they last looked at it, without comparing the value itself.
+///
+/// USAGE:
+///
+///    SeqLock<Sample_t> latest_sample;
+///
+///    // Within an ISR
+///    latest_sample.Write(new_sample);
+///
+///    // Within a control loop
+///    uint32_t last_sequence = 0;
+///    if (auto sample = latest_sample.ReadIfChanged(last_sequence))
+///    {
+///      Process(*sample);
+///    }
+///
+/// Writers claim the lock with an atomic compare-and-swap. ARMv6-M processors,
+/// such as the Cortex-M0, have no instructions to build one from, so on those
+/// targets the claim is made within a CriticalSection instead.
+///
+/// @tparam T - type of the protected value. Must be trivially copyable, since
+///         readers may copy it while it is being written.
+template <typename T>
+class SeqLock
+{
+ public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "SeqLock can only protect trivially copyable types.");
+
+  /// @param initial_value - value returned by reads before the first write.
+  constexpr explicit SeqLock(const T & initial_value = T{}) noexcept
+      : value_(initial_value)
+  {
+  }
+
+  SeqLock(const SeqLock &) = delete;
+  SeqLock & operator=(const SeqLock &) = delete;
+
+  /// Replace the protected value. Never blocks.
+  ///
+  /// @param new_value - value to store.
+  /// @return true - if the value was written.
+  /// @return false - if another write was already in progress, for example
+  ///         when an interrupt preempted a writer of the same lock, in which
+  ///         case the value is left to the other writer.
+  bool Write(const T & new_value) noexcept
+  {
+    uint32_t sequence;
+    if (!Claim(sequence))
+    {
+      return false;
+    }
+
+    // Ensures the odd sequence number is visible before any part of the new
+    // value is.
+    std::atomic_thread_fence(std::memory_order_release);
+
+    value_ = new_value;
+
+    // Publishes the new value along with the new even sequence number.
+    sequence_.store(sequence + 2, std::memory_order_release);
+    return true;
+  }
+
+  /// Attempt to read the value once.
+  ///
+  /// @param sequence - if provided, set to the sequence number of the value
+  ///        returned.
+  /// @return std::optional<T> - the value, or std::nullopt if a write occurred
+  ///         during the read.
+  std::optional<T> TryRead(uint32_t * sequence = nullptr) const noexcept
+  {
+    const uint32_t kStart = sequence_.load(std::memory_order_acquire);
+
+    if ((kStart & 1) != 0)
+    {
+      return std::nullopt;
+    }
+
+    const T kCopy = value_;
+
+    // Ensures the copy of the value completes before the sequence number is
+    // checked again.
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (sequence_.load(std::memory_order_relaxed) != kStart)
+    {
+      return std::nullopt;
+    }
+
+    if (sequence != nullptr)
+    {
+      *sequence = kStart;
+    }
+
+    return kCopy;
+  }
+
+  /// Read the value, retrying until a copy is obtained that was not modified
+  /// during the read.
+  ///
+  /// @param sequence - if provided, set to the sequence number of the value
+  ///        returned.
+  /// @return T - a consistent copy of the value.
+  T Read(uint32_t * sequence = nullptr) const noexcept
+  {
+    while (true)
+    {
+      if (auto value = TryRead(sequence))
+      {
+        return *value;
+      }
+    }
+  }
+
+  /// Read the value only if it has been written since `last_sequence`.
+  ///
+  /// @param last_sequence - sequence number of the last value the caller
+  ///        processed. Updated to the sequence number of the returned value.
+  ///        Start with 0 to receive the first value written.
+  /// @return std::optional<T> - the new value, or std::nullopt if it has not
+  ///         changed.
+  std::optional<T> ReadIfChanged(uint32_t & last_sequence) const noexcept
+  {
+    if (!ChangedSince(last_sequence))
+    {
+      return std::nullopt;
+    }
+
+    return Read(&last_sequence);
+  }
+
+  /// @param sequence - a sequence number previously returned by this lock.
+  /// @return true - if a write has started since `sequence`.
+  bool ChangedSince(uint32_t sequence) const noexcept
+  {
+    return sequence_.load(std::memory_order_acquire) != sequence;
+  }
+
+  /// @return uint32_t - the current sequence number. Odd while a write is in
+  ///         progress.
+  uint32_t Sequence() const noexcept
+  {
+    return sequence_.load(std::memory_order_acquire);
+  }
+
+  /// @return true - if a write is currently in progress.
+  bool IsWriting() const noexcept
+  {
+    return (Sequence() & 1) != 0;
+  }
+
+ private:
+  /// Claim the lock by moving the sequence number from even to odd. If it is
+  /// already odd, or another writer claims it first, there is a write in
+  /// progress that must not be interleaved with this one.
+  ///
+  /// @param sequence - set to the even sequence number that was claimed.
+  /// @return true - if the lock was claimed.
+  bool Claim(uint32_t & sequence) noexcept
+  {
+#if defined(__ARM_ARCH_6M__)
+    CriticalSection lock;
+    sequence = sequence_.load(std::memory_order_relaxed);
+    if ((sequence & 1) != 0)
+    {
+      return false;
+    }
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    return true;
+#else
+    sequence = sequence_.load(std::memory_order_relaxed);
+    return (sequence & 1) == 0 &&
+           sequence_.compare_exchange_strong(
+               sequence, sequence + 1, std::memory_order_relaxed);
+#endif
+  }
+
+  std::atomic<uint32_t> sequence_ = 0;
+  T value_;
+};
+}  // namespace sjsu
@@ -0,0 +1,62 @@
+#include <libcore/utility/seqlock.hpp>
+
+#include <cstdint>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing SeqLock")
+{
+  struct Sample_t
+  {
+    int32_t x;
+    int32_t y;
+  };
+
+  SeqLock<Sample_t> lock(Sample_t{ .x = 1, .y = 2 });
+
+  SECTION("Read() returns the initial value")
+  {
+    // Exercise
+    uint32_t sequence = 0xFFFF;
+    auto sample       = lock.Read(&sequence);
+
+    // Verify
+    CHECK(1 == sample.x);
+    CHECK(2 == sample.y);
+    CHECK(0 == sequence);
+    CHECK(!lock.IsWriting());
+  }
+
+  SECTION("Write() advances the sequence by 2")
+  {
+    // Exercise
+    bool written = lock.Write(Sample_t{ .x = 3, .y = 4 });
+
+    // Verify
+    CHECK(written);
+    CHECK(2 == lock.Sequence());
+    CHECK(3 == lock.Read().x);
+    CHECK(4 == lock.Read().y);
+  }
+
+  SECTION("ReadIfChanged() only returns new values")
+  {
+    // Setup
+    uint32_t last_sequence = lock.Sequence();
+
+    // Exercise & Verify
+    CHECK(!lock.ReadIfChanged(last_sequence).has_value());
+
+    lock.Write(Sample_t{ .x = 5, .y = 6 });
+    auto changed = lock.ReadIfChanged(last_sequence);
+    REQUIRE(changed.has_value());
+    CHECK(5 == changed->x);
+    CHECK(2 == last_sequence);
+
+    CHECK(!lock.ReadIfChanged(last_sequence).has_value());
+    CHECK(!lock.ChangedSince(last_sequence));
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <system_error>
+#include <type_traits>
+
+#include <libcore/utility/error_handling.hpp>
+#include <libcore/utility/math/byte.hpp>
+
+namespace sjsu::serialization
+{
+namespace detail
+{
+/// Splits a pointer to a data member into its class and member types.
+template <typename>
+struct MemberTraits;
+
+/// @tparam C - class holding the member.
+/// @tparam M - type of the member.
+template <typename C, typename M>
+struct MemberTraits<M C::*>
+{
+  /// Class holding the member.
+  using Class_t = C;
+  /// Type of the member.
+  using Value_t = M;
+};
+
+template <typename>
+inline constexpr bool kIsStdArray = false;
+
+template <typename T, size_t N>
+inline constexpr bool kIsStdArray<std::array<T, N>> = true;
+
+/// The type of a field, or of its elements if it is a std::array.
+template <typename T>
+struct Element
+{
+  /// The field's type.
+  using Type_t = T;
+};
+
+/// @tparam T - type of the elements.
+/// @tparam N - number of elements.
+template <typename T, size_t N>
+struct Element<std::array<T, N>>
+{
+  /// The type of the elements.
+  using Type_t = T;
+};
+
+/// @tparam T - type of a field.
+/// @return true - if the field can be serialized: an integer, bool, enum,
+///         float or double, or a std::array of these.
+template <typename T>
+constexpr bool IsSerializable()
+{
+  if constexpr (kIsStdArray<T>)
+  {
+    return IsSerializable<typename T::value_type>();
+  }
+  else
+  {
+    return std::is_integral_v<T> || std::is_enum_v<T> ||
+           (std::is_floating_point_v<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+  }
+}
+
+/// Unsigned integer with the same size as a floating point type.
+template <typename T>
+using FloatBits_t =
+    std::conditional_t<(sizeof(T) == sizeof(uint32_t)), uint32_t, uint64_t>;
+
+/// Write a value to bytes with the given endianness.
+///
+/// @param endian - byte order of the bytes.
+/// @param value - value to write.
+/// @param bytes - destination, at least sizeof(T) bytes.
+template <typename T>
+constexpr void Store(std::endian endian, const T & value, uint8_t * bytes)
+{
+  if constexpr (kIsStdArray<T>)
+  {
+    for (size_t i = 0; i < value.size(); i++)
+    {
+      Store(endian, value[i], bytes + (i * sizeof(typename T::value_type)));
+    }
+  }
+  else if constexpr (std::is_enum_v<T>)
+  {
+    Store(endian, static_cast<std::underlying_type_t<T>>(value), bytes);
+  }
+  else if constexpr (std::is_same_v<T, bool>)
+  {
+    bytes[0] = value ? 1 : 0;
+  }
+  else if constexpr (std::is_floating_point_v<T>)
+  {
+    Store(endian, std::bit_cast<FloatBits_t<T>>(value), bytes);
+  }
+  else
+  {
+    const auto kBytes = ToByteArray(endian, value);
+    std::copy(kBytes.begin(), kBytes.end(), bytes);
+  }
+}
+
+/// Read a value from bytes with the given endianness.
+///
+/// @param endian - byte order of the bytes.
+/// @param bytes - source, at least sizeof(T) bytes.
+/// @param value - destination of the value.
+template <typename T>
+constexpr void Load(std::endian endian, const uint8_t * bytes, T & value)
+{
+  if constexpr (kIsStdArray<T>)
+  {
+    for (size_t i = 0; i < value.size(); i++)
+    {
+      Load(endian, bytes + (i * sizeof(typename T::value_type)), value[i]);
+    }
+  }
+  else if constexpr (std::is_enum_v<T>)
+  {
+    std::underlying_type_t<T> raw{};
+    Load(endian, bytes, raw);
+    value = static_cast<T>(raw);
+  }
+  else if constexpr (std::is_same_v<T, bool>)
+  {
+    value = (bytes[0] != 0);
+  }
+  else if constexpr (std::is_floating_point_v<T>)
+  {
+    FloatBits_t<T> raw = 0;
+    Load(endian, bytes, raw);
+    value = std::bit_cast<T>(raw);
+  }
+  else
+  {
+    value = ToInteger<T>(endian, std::span<const uint8_t>(bytes, sizeof(T)));
+  }
+}
+}  // namespace detail
+
+/// One field of a Layout: a data member and the byte order it is serialized
+/// with.
+///
+/// @tparam kMember - pointer to the data member, such as `&Imu_t::x`.
+/// @tparam kEndian - byte order of the field, and of each element of arrays.
+template <auto kMember, std::endian kEndian = std::endian::little>
+struct Field
+{
+  /// Class holding the member.
+  using Class_t = typename detail::MemberTraits<decltype(kMember)>::Class_t;
+  /// Type of the member.
+  using Value_t = typename detail::MemberTraits<decltype(kMember)>::Value_t;
+
+  static_assert(detail::IsSerializable<Value_t>(),
+                "Fields must be integers, bools, enums, floats, doubles or "
+                "std::arrays of these.");
+
+  /// Number of bytes of the field.
+  static constexpr size_t kSize = sizeof(Value_t);
+
+  /// The field's bytes are the same as its bytes in memory.
+  /// Bools are excluded, as not every byte is a valid bool.
+  static constexpr bool kIsNative =
+      (kEndian == std::endian::native ||
+       sizeof(typename detail::Element<Value_t>::Type_t) == 1) &&
+      !std::is_same_v<typename detail::Element<Value_t>::Type_t, bool>;
+
+  /// @param value - object holding the field.
+  /// @param bytes - destination, at least kSize bytes.
+  static constexpr void Encode(const Class_t & value, uint8_t * bytes)
+  {
+    detail::Store(kEndian, value.*kMember, bytes);
+  }
+
+  /// @param bytes - source, at least kSize bytes.
+  /// @param value - object receiving the field.
+  static constexpr void Decode(const uint8_t * bytes, Class_t & value)
+  {
+    detail::Load(kEndian, bytes, value.*kMember);
+  }
+
+  /// @param value - object holding the field.
+  /// @return size_t - offset of the field within the object.
+  static size_t Offset(const Class_t & value)
+  {
+    return static_cast<size_t>(
+        reinterpret_cast<const uint8_t *>(&(value.*kMember)) -
+        reinterpret_cast<const uint8_t *>(&value));
+  }
+};
+
+/// A compile time description of how a struct is serialized: its fields, in
+/// order, each with its byte order. Encode() and Decode() write and read the
+/// fields directly to and from a span of bytes, such as a UART frame, an
+/// ISO-TP message or a storage record, with no intermediate arrays.
+///
+/// When the serialized form is the same as the struct in memory, meaning the
+/// fields are listed in declaration order, cover the struct without padding
+/// and all use the native byte order, the struct is copied with a single
+/// memcpy. This is decided per Layout and folded away by the compiler.
+///
+/// USAGE:
+///
+///    struct Imu_t
+///    {
+///      uint32_t timestamp;
+///      std::array<int16_t, 3> acceleration;
+///      uint16_t flags;
+///    };
+///
+///    using ImuLayout = sjsu::serialization::Layout<
+///        Imu_t,
+///        sjsu::serialization::Field<&Imu_t::timestamp>,
+///        sjsu::serialization::Field<&Imu_t::acceleration>,
+///        sjsu::serialization::Field<&Imu_t::flags>>;
+///
+///    std::array<uint8_t, ImuLayout::kSize> bytes;
+///    ImuLayout::Encode(imu, bytes);
+///    link.Send(bytes);
+///
+///    Imu_t received = ImuLayout::Decode(*link.Receive());
+///
+/// @tparam T - the struct. Must be default constructible.
+/// @tparam Fields - a Field for each serialized member of T.
+template <typename T, typename... Fields>
+class Layout
+{
+ public:
+  static_assert((std::is_same_v<T, typename Fields::Class_t> && ...),
+                "Every field must be a member of the layout's struct.");
+
+  /// Number of bytes of the serialized struct.
+  static constexpr size_t kSize = (Fields::kSize + ... + 0);
+
+  /// Serialize a struct.
+  ///
+  /// @param value - struct to serialize.
+  /// @param bytes - destination of the serialized struct.
+  /// @return constexpr size_t - kSize, the number of bytes written.
+  /// @throw std::errc::no_buffer_space - if `bytes` is shorter than kSize.
+  static constexpr size_t Encode(const T & value, std::span<uint8_t> bytes)
+  {
+    if (bytes.size() < kSize)
+    {
+      throw Exception(std::errc::no_buffer_space,
+                      "Buffer is too small for the serialized struct.");
+    }
+
+    if (!std::is_constant_evaluated() && IsMemoryImage())
+    {
+      std::memcpy(bytes.data(), &value, kSize);
+      return kSize;
+    }
+
+    size_t offset = 0;
+    ((Fields::Encode(value, bytes.data() + offset), offset += Fields::kSize),
+     ...);
+    return kSize;
+  }
+
+  /// Deserialize a struct into an existing object. Members without a field
+  /// are left unchanged, unless the struct is copied as a whole, in which
+  /// case there are no such members.
+  ///
+  /// @param bytes - the serialized struct.
+  /// @param value - object receiving the fields.
+  /// @throw std::errc::message_size - if `bytes` is shorter than kSize.
+  static constexpr void Decode(std::span<const uint8_t> bytes, T & value)
+  {
+    if (bytes.size() < kSize)
+    {
+      throw Exception(std::errc::message_size,
+                      "Too few bytes for the serialized struct.");
+    }
+
+    if (!std::is_constant_evaluated() && IsMemoryImage())
+    {
+      std::memcpy(&value, bytes.data(), kSize);
+      return;
+    }
+
+    size_t offset = 0;
+    ((Fields::Decode(bytes.data() + offset, value), offset += Fields::kSize),
+     ...);
+  }
+
+  /// @param bytes - the serialized struct.
+  /// @return constexpr T - the deserialized struct, with members without a
+  ///         field value initialized.
+  /// @throw std::errc::message_size - if `bytes` is shorter than kSize.
+  static constexpr T Decode(std::span<const uint8_t> bytes)
+  {
+    T value{};
+    Decode(bytes, value);
+    return value;
+  }
+
+  /// @return true - if the serialized struct is the same as the struct in
+  ///         memory, so it is copied with memcpy.
+  static bool IsMemoryImage()
+  {
+    if constexpr (!kMayBeMemoryImage)
+    {
+      return false;
+    }
+    else
+    {
+      // Offsets of members cannot be compared in constant expressions, but
+      // the compiler folds this into a constant.
+      const T kObject{};
+      size_t offset = 0;
+      bool in_order = true;
+      ((in_order = in_order && (Fields::Offset(kObject) == offset),
+        offset += Fields::kSize),
+       ...);
+      return in_order;
+    }
+  }
+
+ private:
+  static constexpr bool kMayBeMemoryImage =
+      std::is_trivially_copyable_v<T> && sizeof(T) == kSize &&
+      (Fields::kIsNative && ...);
+};
+}  // namespace sjsu::serialization
@@ -0,0 +1,173 @@
+#include <libcore/utility/serialization.hpp>
+
+#include <cstring>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu::serialization
+{
+namespace
+{
+enum class Mode : uint8_t
+{
+  kIdle    = 0,
+  kRunning = 2,
+};
+
+struct Imu_t
+{
+  uint32_t timestamp;
+  std::array<int16_t, 3> acceleration;
+  uint16_t flags;
+};
+
+struct Status_t
+{
+  uint16_t voltage;
+  Mode mode;
+  bool fault;
+  float temperature;
+  uint8_t unused;
+};
+
+using NativeImu = Layout<Imu_t,
+                         Field<&Imu_t::timestamp, std::endian::native>,
+                         Field<&Imu_t::acceleration, std::endian::native>,
+                         Field<&Imu_t::flags, std::endian::native>>;
+
+using BigImu = Layout<Imu_t,
+                      Field<&Imu_t::timestamp, std::endian::big>,
+                      Field<&Imu_t::acceleration, std::endian::big>,
+                      Field<&Imu_t::flags, std::endian::big>>;
+
+using ReorderedImu = Layout<Imu_t,
+                            Field<&Imu_t::flags, std::endian::native>,
+                            Field<&Imu_t::timestamp, std::endian::native>,
+                            Field<&Imu_t::acceleration, std::endian::native>>;
+
+using StatusLayout = Layout<Status_t,
+                            Field<&Status_t::voltage, std::endian::big>,
+                            Field<&Status_t::mode>,
+                            Field<&Status_t::fault>,
+                            Field<&Status_t::temperature>>;
+
+constexpr Imu_t kImu = {
+  .timestamp    = 0x1234'5678,
+  .acceleration = { 1, -2, 0x0304 },
+  .flags        = 0xA55A,
+};
+
+static_assert(12 == NativeImu::kSize);
+static_assert(8 == StatusLayout::kSize);
+
+// Encoding is usable in constant expressions.
+static_assert([]() {
+  std::array<uint8_t, BigImu::kSize> bytes{};
+  BigImu::Encode(kImu, bytes);
+  return bytes[0] == 0x12 && bytes[3] == 0x78 && bytes[5] == 0x01 &&
+         bytes[11] == 0x5A;
+}());
+}  // namespace
+
+TEST_CASE("Testing serialization")
+{
+  SECTION("Big endian fields")
+  {
+    // Setup
+    std::array<uint8_t, BigImu::kSize> bytes{};
+
+    // Exercise
+    const size_t kWritten = BigImu::Encode(kImu, bytes);
+    const Imu_t kDecoded  = BigImu::Decode(bytes);
+
+    // Verify
+    CHECK(12 == kWritten);
+    CHECK(std::array<uint8_t, 12>{ 0x12, 0x34, 0x56, 0x78, 0x00, 0x01, 0xFF,
+                                   0xFE, 0x03, 0x04, 0xA5, 0x5A } == bytes);
+    CHECK((std::endian::native == std::endian::big) ==
+          BigImu::IsMemoryImage());
+    CHECK(kImu.timestamp == kDecoded.timestamp);
+    CHECK(kImu.acceleration == kDecoded.acceleration);
+    CHECK(kImu.flags == kDecoded.flags);
+  }
+
+  SECTION("Structs matching their layout are copied whole")
+  {
+    // Setup
+    std::array<uint8_t, NativeImu::kSize> bytes{};
+    std::array<uint8_t, sizeof(Imu_t)> memory;
+    std::memcpy(memory.data(), &kImu, sizeof(kImu));
+
+    // Exercise
+    NativeImu::Encode(kImu, bytes);
+
+    // Verify
+    CHECK(NativeImu::IsMemoryImage());
+    CHECK(!ReorderedImu::IsMemoryImage());
+    CHECK(!StatusLayout::IsMemoryImage());
+    CHECK(memory == bytes);
+    CHECK(kImu.flags == NativeImu::Decode(bytes).flags);
+  }
+
+  SECTION("Field order follows the layout")
+  {
+    // Setup
+    std::array<uint8_t, ReorderedImu::kSize> bytes{};
+
+    // Exercise
+    ReorderedImu::Encode(kImu, bytes);
+    const Imu_t kDecoded = ReorderedImu::Decode(bytes);
+
+    // Verify
+    CHECK(kImu.flags == ToInteger<uint16_t>(std::endian::native,
+                                            std::span(bytes).first(2)));
+    CHECK(kImu.timestamp == kDecoded.timestamp);
+    CHECK(kImu.acceleration == kDecoded.acceleration);
+    CHECK(kImu.flags == kDecoded.flags);
+  }
+
+  SECTION("Enums, bools and floats")
+  {
+    // Setup
+    const Status_t kStatus = {
+      .voltage     = 0x0C80,
+      .mode        = Mode::kRunning,
+      .fault       = true,
+      .temperature = 21.5f,
+      .unused      = 0x77,
+    };
+    std::array<uint8_t, 10> bytes;
+    bytes.fill(0xEE);
+    Status_t decoded{};
+    decoded.unused = 0x11;
+
+    // Exercise
+    StatusLayout::Encode(kStatus, bytes);
+    StatusLayout::Decode(bytes, decoded);
+
+    // Verify
+    CHECK(0x0C == bytes[0]);
+    CHECK(0x80 == bytes[1]);
+    CHECK(2 == bytes[2]);
+    CHECK(1 == bytes[3]);
+    CHECK(0xEE == bytes[8]);
+    CHECK(0x0C80 == decoded.voltage);
+    CHECK(Mode::kRunning == decoded.mode);
+    CHECK(decoded.fault);
+    CHECK(21.5f == decoded.temperature);
+    CHECK(0x11 == decoded.unused);
+  }
+
+  SECTION("Short buffers are rejected")
+  {
+    // Setup
+    std::array<uint8_t, 11> bytes{};
+
+    // Exercise & Verify
+    SJ2_CHECK_EXCEPTION(NativeImu::Encode(kImu, bytes),
+                        std::errc::no_buffer_space);
+    SJ2_CHECK_EXCEPTION(std::ignore = BigImu::Decode(bytes),
+                        std::errc::message_size);
+  }
+}
+}  // namespace sjsu::serialization
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace sjsu::stack
+{
+/// Value written to every word of an unused stack by Paint().
+inline constexpr uint32_t kPaint = 0xA5A5'A5A5;
+
+/// Number of bytes below the current stack pointer that Paint() leaves alone,
+/// covering its own frame and the red zone some ABIs allow below the stack
+/// pointer.
+inline constexpr size_t kPaintMargin = 256;
+
+/// @return uintptr_t - the stack pointer of the calling function.
+[[gnu::always_inline]] inline uintptr_t CurrentStackPointer()
+{
+#if defined(__arm__) || defined(__aarch64__)
+  uintptr_t stack_pointer;
+  asm volatile("mov %0, sp" : "=r"(stack_pointer));
+  return stack_pointer;
+#elif defined(__x86_64__)
+  uintptr_t stack_pointer;
+  asm volatile("mov %%rsp, %0" : "=r"(stack_pointer));
+  return stack_pointer;
+#else
+  return reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+#endif
+}
+
+/// Fill the unused part of a stack with kPaint, so that Unused() can later
+/// find how deep the stack has ever grown: the "high-water mark".
+///
+/// Stacks grow downward, from the end of `stack` toward its start. When the
+/// stack pointer is within `stack`, as when painting the running stack at
+/// boot, only the words more than kPaintMargin bytes below it are painted.
+/// Otherwise, as for a task stack that is not yet running, every word is.
+///
+/// Usage, with the bounds of the main stack taken from the linker script:
+///
+///    // First thing in main()
+///    sjsu::stack::Paint(main_stack);
+///
+///    // Later, on demand or from a periodic task
+///    sjsu::debug::PrintStackUsage("main", main_stack);
+///
+/// @param stack - memory of the stack, lowest address first.
+inline void Paint(std::span<uint32_t> stack)
+{
+  const uintptr_t kStackPointer = CurrentStackPointer();
+  const uintptr_t kStart = reinterpret_cast<uintptr_t>(stack.data());
+  const uintptr_t kEnd   = reinterpret_cast<uintptr_t>(stack.data() +
+                                                     stack.size());
+
+  size_t words = stack.size();
+  if (kStart <= kStackPointer && kStackPointer <= kEnd)
+  {
+    const uintptr_t kLimit =
+        (kStackPointer - kStart > kPaintMargin) ? kStackPointer - kPaintMargin
+                                                : kStart;
+    words = (kLimit - kStart) / sizeof(uint32_t);
+  }
+
+  // volatile, so the compiler does not turn the loop into a call to memset(),
+  // whose frame would land in the memory being painted.
+  volatile uint32_t * word = stack.data();
+  for (size_t i = 0; i < words; i++)
+  {
+    word[i] = kPaint;
+  }
+}
+
+/// @param stack - memory of a stack painted by Paint(), lowest address first.
+/// @return size_t - number of bytes at the bottom of the stack that have never
+///         been used since it was painted.
+inline size_t Unused(std::span<const uint32_t> stack)
+{
+  size_t words = 0;
+  while (words < stack.size() && stack[words] == kPaint)
+  {
+    words++;
+  }
+  return words * sizeof(uint32_t);
+}
+
+/// @param stack - memory of a stack painted by Paint(), lowest address first.
+/// @return size_t - the most bytes of the stack that have ever been in use
+///         since it was painted.
+inline size_t Used(std::span<const uint32_t> stack)
+{
+  return stack.size_bytes() - Unused(stack);
+}
+}  // namespace sjsu::stack
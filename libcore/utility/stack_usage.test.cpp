@@ -0,0 +1,58 @@
+#include <libcore/utility/stack_usage.hpp>
+
+#include <array>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing stack usage")
+{
+  std::array<uint32_t, 32> stack;
+  stack.fill(0);
+
+  SECTION("Paint() fills a stack that is not running")
+  {
+    // Exercise
+    stack::Paint(stack);
+
+    // Verify
+    CHECK(stack.size() * sizeof(uint32_t) == stack::Unused(stack));
+    CHECK(0 == stack::Used(stack));
+  }
+
+  SECTION("Used() finds the deepest word written")
+  {
+    // Setup
+    stack::Paint(stack);
+
+    // Exercise - a call chain reaches 10 words deep, then returns, leaving a
+    // word that happens to match the paint within the used part.
+    stack[stack.size() - 10] = 0x1234;
+    stack[stack.size() - 5]  = stack::kPaint;
+
+    // Verify
+    CHECK(10 * sizeof(uint32_t) == stack::Used(stack));
+    CHECK(22 * sizeof(uint32_t) == stack::Unused(stack));
+  }
+
+  SECTION("Paint() leaves the running part of the stack alone")
+  {
+    // Setup - a region spanning the unused memory below this frame and the
+    // top of this frame.
+    constexpr size_t kBelow = 256;
+    constexpr size_t kAbove = 8;
+    const uintptr_t kStackPointer = stack::CurrentStackPointer() & ~0b11;
+    auto * bottom = reinterpret_cast<uint32_t *>(kStackPointer) - kBelow;
+    std::span<uint32_t> region(bottom, kBelow + kAbove);
+
+    // Exercise
+    stack::Paint(region);
+
+    // Verify
+    CHECK(0 < stack::Unused(region));
+    CHECK(stack::Unused(region) <=
+          kBelow * sizeof(uint32_t) - stack::kPaintMargin);
+  }
+}
+}  // namespace sjsu
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <libcore/peripherals/system_controller.hpp>
+#include <libcore/platform/constants.hpp>
+#include <libcore/utility/math/units.hpp>
+
+#if !defined(SJ2_HAS_DWT_CYCLE_COUNTER)
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+    defined(__ARM_ARCH_8M_MAIN__)
+/// Cortex-M3 and above have a cycle counter within their Data Watchpoint and
+/// Trace (DWT) unit. Cortex-M0 and M0+ do not.
+#define SJ2_HAS_DWT_CYCLE_COUNTER 1
+#else
+#define SJ2_HAS_DWT_CYCLE_COUNTER 0
+#endif
+#endif
+
+#if !SJ2_HAS_DWT_CYCLE_COUNTER
+#include <time.h>
+#endif
+
+namespace sjsu
+{
+/// Free running 32-bit counter with the finest resolution the platform has.
+///
+/// On Cortex-M3 and above this is the DWT CYCCNT register, which counts CPU
+/// cycles and can be read in a single instruction. Elsewhere, such as on
+/// host, it counts nanoseconds of the monotonic clock.
+///
+/// The counter wraps around every 2^32 counts, which is about 42 seconds at
+/// 100 MHz. Elapsed() gives the correct count across a single wrap around.
+/// For longer intervals use ExtendedCycleCounter or StopWatch.
+class CycleCounter
+{
+ public:
+  /// true if the counter counts CPU cycles, false if it counts nanoseconds.
+  static constexpr bool kCountsCycles = SJ2_HAS_DWT_CYCLE_COUNTER;
+
+  /// Start the counter. Must be called once before Read() is used. Does
+  /// nothing on platforms without a cycle counter.
+  static void Enable()
+  {
+#if SJ2_HAS_DWT_CYCLE_COUNTER
+    // Enable the DWT and ITM units (DEMCR.TRCENA), then the cycle counter
+    // (DWT_CTRL.CYCCNTENA).
+    *Register(kDemcrAddress)      = *Register(kDemcrAddress) | (1 << 24);
+    *Register(kCycleCountAddress) = 0;
+    *Register(kDwtControlAddress) = *Register(kDwtControlAddress) | (1 << 0);
+#endif
+  }
+
+  /// @return uint32_t - current count.
+  static uint32_t Read()
+  {
+#if SJ2_HAS_DWT_CYCLE_COUNTER
+    return *Register(kCycleCountAddress);
+#else
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint32_t>(static_cast<uint64_t>(now.tv_sec) *
+                                     1'000'000'000 +
+                                 now.tv_nsec);
+#endif
+  }
+
+  /// @param start - count read at the start of the interval.
+  /// @param end - count read at the end of the interval.
+  /// @return uint32_t - number of counts between `start` and `end`, correct as
+  ///         long as the counter wrapped around at most once.
+  static constexpr uint32_t Elapsed(uint32_t start, uint32_t end)
+  {
+    // Unsigned subtraction is modulo 2^32, which undoes a single wrap around.
+    return end - start;
+  }
+
+  /// Convert a number of CPU cycles into time.
+  ///
+  /// @param cycles - number of cycles.
+  /// @param rate - clock rate of the CPU.
+  /// @return std::chrono::nanoseconds - time `cycles` take at `rate`, rounded
+  ///         down. 0 if `rate` is 0 Hz.
+  static constexpr std::chrono::nanoseconds ToDuration(
+      uint64_t cycles, units::frequency::hertz_t rate)
+  {
+    constexpr uint64_t kNanosecondsPerSecond = 1'000'000'000;
+    const uint64_t kHertz = static_cast<uint64_t>(rate.to<double>());
+
+    if (kHertz == 0)
+    {
+      return std::chrono::nanoseconds(0);
+    }
+
+    // Split into whole seconds and the remainder so that the multiplication
+    // cannot overflow for any 64-bit count.
+    const uint64_t kSeconds   = cycles / kHertz;
+    const uint64_t kRemainder = cycles % kHertz;
+    return std::chrono::nanoseconds(kSeconds * kNanosecondsPerSecond +
+                                    (kRemainder * kNanosecondsPerSecond) /
+                                        kHertz);
+  }
+
+  /// Convert counts of this counter into time, using the clock rate of
+  /// `cpu_clock` from the platform's SystemController when the counter counts
+  /// cycles.
+  ///
+  /// @param counts - number of counts.
+  /// @param cpu_clock - resource ID of the clock driving the CPU.
+  /// @return std::chrono::nanoseconds - time taken by `counts`.
+  static std::chrono::nanoseconds ToDuration(uint64_t counts,
+                                             ResourceID cpu_clock)
+  {
+    if constexpr (kCountsCycles)
+    {
+      return ToDuration(
+          counts,
+          SystemController::GetPlatformController().GetClockRate(cpu_clock));
+    }
+    else
+    {
+      return std::chrono::nanoseconds(counts);
+    }
+  }
+
+ private:
+#if SJ2_HAS_DWT_CYCLE_COUNTER
+  static constexpr uintptr_t kDemcrAddress      = 0xE000'EDFC;
+  static constexpr uintptr_t kDwtControlAddress = 0xE000'1000;
+  static constexpr uintptr_t kCycleCountAddress = 0xE000'1004;
+
+  static volatile uint32_t * Register(uintptr_t address)
+  {
+    return reinterpret_cast<volatile uint32_t *>(address);
+  }
+#endif
+};
+
+/// Extends the 32-bit CycleCounter to 64 bits by counting its wrap arounds.
+///
+/// Read() must be called at least once per wrap around of the counter, for
+/// example from a periodic timer interrupt, otherwise a wrap around is
+/// missed. Only use an instance from a single context.
+class ExtendedCycleCounter
+{
+ public:
+  /// @return uint64_t - the current count, extended to 64 bits.
+  uint64_t Read()
+  {
+    return Extend(CycleCounter::Read());
+  }
+
+  /// Extend a 32-bit count read from the counter.
+  ///
+  /// @param count - 32-bit count, read after the previous call.
+  /// @return uint64_t - `count` extended to 64 bits.
+  constexpr uint64_t Extend(uint32_t count)
+  {
+    if (count < last_count_)
+    {
+      wraps_++;
+    }
+    last_count_ = count;
+    return (static_cast<uint64_t>(wraps_) << 32) | count;
+  }
+
+ private:
+  uint32_t last_count_ = 0;
+  uint32_t wraps_      = 0;
+};
+}  // namespace sjsu
@@ -0,0 +1,57 @@
+#include <cstdint>
+
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/time/cycle_counter.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing CycleCounter")
+{
+  SECTION("Elapsed()")
+  {
+    // Exercise + Verify
+    CHECK(100 == CycleCounter::Elapsed(50, 150));
+    CHECK(0 == CycleCounter::Elapsed(150, 150));
+    CHECK(16 == CycleCounter::Elapsed(UINT32_MAX - 5, 10));
+  }
+
+  SECTION("ToDuration() with a clock rate")
+  {
+    // Exercise + Verify
+    CHECK(1us == CycleCounter::ToDuration(100, 100_MHz));
+    CHECK(10ns == CycleCounter::ToDuration(1, 100_MHz));
+    CHECK(1s == CycleCounter::ToDuration(48'000'000, 48_MHz));
+    CHECK(58ns == CycleCounter::ToDuration(7, 120_MHz));
+    CHECK(0ns == CycleCounter::ToDuration(100, 0_Hz));
+    // Large enough that cycles * 1e9 would overflow 64 bits.
+    CHECK(std::chrono::hours(1'000'000) ==
+          CycleCounter::ToDuration(3'600'000'000'000'000, 1_MHz));
+  }
+
+  SECTION("Read() increases")
+  {
+    // Setup
+    CycleCounter::Enable();
+    uint32_t start = CycleCounter::Read();
+
+    // Exercise
+    uint32_t elapsed = CycleCounter::Elapsed(start, CycleCounter::Read());
+
+    // Verify
+    CHECK(elapsed < 1'000'000'000);
+  }
+
+  SECTION("ExtendedCycleCounter")
+  {
+    // Setup
+    ExtendedCycleCounter test_subject;
+
+    // Exercise + Verify
+    CHECK(10 == test_subject.Extend(10));
+    CHECK(UINT32_MAX == test_subject.Extend(UINT32_MAX));
+    CHECK((uint64_t{ 1 } << 32) + 5 == test_subject.Extend(5));
+    CHECK((uint64_t{ 1 } << 32) + 5 == test_subject.Extend(5));
+    CHECK((uint64_t{ 2 } << 32) + 1 == test_subject.Extend(1));
+  }
+}
+}  // namespace sjsu
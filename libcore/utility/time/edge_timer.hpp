@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <libcore/peripherals/system_controller.hpp>
+#include <libcore/platform/constants.hpp>
+#include <libcore/utility/math/units.hpp>
+#include <libcore/utility/time/cycle_counter.hpp>
+
+namespace sjsu
+{
+/// Paces the edges of a bit-banged signal with the CycleCounter.
+///
+/// Each WaitForEdge() waits until one period after the previous edge's
+/// deadline, rather than for one period from when it is called, so the time
+/// spent changing pins and computing the next bit is absorbed into the wait
+/// and the signal keeps its rate without being calibrated for the speed of
+/// the pins. If an edge is late by more than a period, such as after an
+/// interrupt, the timer restarts from the late edge instead of rushing the
+/// following edges.
+///
+/// USAGE:
+///
+///    sjsu::EdgeTimer timer(1_MHz);  // 500 kHz clock, 2 edges per cycle
+///    timer.Start();
+///    for (int i = 0; i < 16; i++)
+///    {
+///      clock.Toggle();
+///      timer.WaitForEdge();
+///    }
+class EdgeTimer
+{
+ public:
+  /// @param edge_rate - number of edges per second. A clock has 2 edges per
+  ///        cycle.
+  /// @param cpu_clock - resource ID of the clock driving the CPU, used to
+  ///        convert the rate to cycles on platforms where the CycleCounter
+  ///        counts cycles.
+  explicit EdgeTimer(units::frequency::hertz_t edge_rate = 0_Hz,
+                     ResourceID cpu_clock                = {})
+  {
+    SetRate(edge_rate, cpu_clock);
+  }
+
+  /// @param edge_rate - number of edges per second. 0 Hz waits for nothing,
+  ///        so edges are as fast as the pins can go.
+  /// @param cpu_clock - resource ID of the clock driving the CPU.
+  void SetRate(units::frequency::hertz_t edge_rate, ResourceID cpu_clock = {})
+  {
+    CycleCounter::Enable();
+
+    double counter_rate = 1e9;
+    if constexpr (CycleCounter::kCountsCycles)
+    {
+      counter_rate = SystemController::GetPlatformController()
+                         .GetClockRate(cpu_clock)
+                         .to<double>();
+    }
+
+    // Periods are kept below half the range of the counter, so that a passed
+    // deadline can be told apart from one that is still ahead.
+    const double kEdgeRate = edge_rate.to<double>();
+    period_                = 0;
+    if (kEdgeRate > 0)
+    {
+      period_ = static_cast<uint32_t>(
+          std::min(counter_rate / kEdgeRate, double{ INT32_MAX }));
+    }
+  }
+
+  /// Start timing from now, before the first edge.
+  void Start()
+  {
+    deadline_ = CycleCounter::Read();
+  }
+
+  /// Wait until one period after the previous edge.
+  void WaitForEdge()
+  {
+    if (period_ == 0)
+    {
+      return;
+    }
+
+    deadline_ += period_;
+
+    // Counts until the deadline, which wrap to more than a period once the
+    // deadline has passed.
+    uint32_t remaining = CycleCounter::Elapsed(CycleCounter::Read(), deadline_);
+    if (remaining > period_)
+    {
+      const uint32_t kLate = 0 - remaining;
+      if (kLate > period_)
+      {
+        deadline_ -= remaining;
+      }
+      return;
+    }
+
+    while (remaining != 0 && remaining <= period_)
+    {
+      remaining = CycleCounter::Elapsed(CycleCounter::Read(), deadline_);
+    }
+  }
+
+  /// @return uint32_t - counts of the CycleCounter between edges.
+  uint32_t GetPeriod() const
+  {
+    return period_;
+  }
+
+ private:
+  uint32_t period_   = 0;
+  uint32_t deadline_ = 0;
+};
+}  // namespace sjsu
@@ -10,6 +10,10 @@
 //
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+
+#include <libcore/utility/time/cycle_counter.hpp>
 #include <libcore/utility/time/time.hpp>
 
 namespace sjsu
@@ -54,4 +58,85 @@ class StopWatch
   std::chrono::nanoseconds calibrate_delta_ = 0ns;
   std::chrono::nanoseconds start_ticks_     = 0ns;
 };
+
+/// A stop watch backed by the CycleCounter, for timing short sections of code
+/// such as interrupt service routines to the CPU cycle. Start() and Stop() are
+/// a single register read each, and do not call Uptime().
+///
+/// Intervals must be shorter than one wrap around of the CycleCounter, which
+/// is about 42 seconds at 100 MHz. Use StopWatch for longer intervals.
+///
+/// Usage:
+///
+///    sjsu::CycleCounter::Enable();
+///
+///    sjsu::CycleStopWatch stopwatch(kCpuClock);
+///    stopwatch.Calibrate();
+///    stopwatch.Start();
+///
+///    // Do some work that takes some time to perform ...
+///
+///    uint32_t cycles = stopwatch.Stop();
+///    auto time_delta = stopwatch.ToDuration(cycles);
+///
+class CycleStopWatch
+{
+ public:
+  /// @param cpu_clock - resource ID of the clock driving the CPU, used to
+  ///        convert cycles into time.
+  explicit CycleStopWatch(ResourceID cpu_clock) : cpu_clock_(cpu_clock) {}
+
+  /// Measures the smallest number of counts between Start() and Stop() over a
+  /// few attempts, which is then removed from every measurement. Taking the
+  /// smallest ignores attempts that were interrupted.
+  void Calibrate()
+  {
+    constexpr int kAttempts = 8;
+
+    calibrate_delta_ = 0;
+    uint32_t minimum = UINT32_MAX;
+    for (int i = 0; i < kAttempts; i++)
+    {
+      Start();
+      minimum = std::min(minimum, Stop());
+    }
+    calibrate_delta_ = minimum;
+  }
+
+  /// Reads the counter and stores it for comparison against the count when
+  /// Stop() is called.
+  void Start()
+  {
+    start_count_ = CycleCounter::Read();
+  }
+
+  /// @return uint32_t - number of counts since Start() was called, less the
+  ///         calibration delta. Counts are CPU cycles, or nanoseconds on
+  ///         platforms without a cycle counter.
+  uint32_t Stop()
+  {
+    const uint32_t kElapsed =
+        CycleCounter::Elapsed(start_count_, CycleCounter::Read());
+    return (kElapsed > calibrate_delta_) ? kElapsed - calibrate_delta_ : 0;
+  }
+
+  /// @param counts - counts returned by Stop().
+  /// @return std::chrono::nanoseconds - the counts converted into time using
+  ///         the current clock rate of the CPU.
+  std::chrono::nanoseconds ToDuration(uint32_t counts) const
+  {
+    return CycleCounter::ToDuration(counts, cpu_clock_);
+  }
+
+  /// This is used to inspect the calibration delta in counts.
+  uint32_t GetCalibrationDelta() const
+  {
+    return calibrate_delta_;
+  }
+
+ private:
+  ResourceID cpu_clock_;
+  uint32_t calibrate_delta_ = 0;
+  uint32_t start_count_     = 0;
+};
 }  // namespace sjsu
@@ -79,4 +79,38 @@ TEST_CASE("Testing StopWatch Utilities")
     CHECK(kDelay[6] == actual_delta6);
   }
 }
+
+TEST_CASE("Testing CycleStopWatch")
+{
+  SECTION("Calibrate")
+  {
+    // Setup
+    CycleStopWatch test_subject(ResourceID::Define<0>());
+
+    // Exercise
+    test_subject.Calibrate();
+
+    // Verify
+    CHECK(test_subject.GetCalibrationDelta() < 1'000'000);
+  }
+
+  SECTION("Start and Stop")
+  {
+    // Setup
+    CycleStopWatch test_subject(ResourceID::Define<0>());
+    test_subject.Calibrate();
+
+    // Exercise
+    test_subject.Start();
+    uint32_t first = test_subject.Stop();
+    uint32_t later = test_subject.Stop();
+
+    // Verify
+    CHECK(first <= later);
+    if constexpr (!CycleCounter::kCountsCycles)
+    {
+      CHECK(std::chrono::nanoseconds(later) == test_subject.ToDuration(later));
+    }
+  }
+}
 }  // namespace sjsu
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+
+#include <libcore/peripherals/system_timer.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Put the processor to sleep until the next interrupt. Does nothing on
+/// platforms other than ARM.
+inline void WaitForInterrupt()
+{
+#if defined(__arm__)
+  asm volatile("wfi");
+#endif
+}
+
+/// Make Wait() and Delay() sleep rather than busy loop. Between each check
+/// of their condition, `system_timer` is asked to wake the processor at the
+/// deadline and the processor waits for an interrupt, so a wait wakes only at
+/// its deadline, on an interrupt that may have completed it, or on the system
+/// timer's periodic tick. Wait() calls the sleep function with interrupts
+/// masked, right after its last check, so an interrupt that arrives in
+/// between keeps `wfi` from sleeping and runs once Wait() unmasks them.
+///
+/// Host builds keep busy looping, as there is no interrupt to wake on.
+///
+/// Usage:
+///
+///    sjsu::EnableTicklessWait(system_timer);
+///    sjsu::Delay(500ms);  // Sleeps
+///
+/// @param system_timer - system timer used to wake the processor.
+inline void EnableTicklessWait(SystemTimer & system_timer)
+{
+  if constexpr (build::IsPlatform("host"))
+  {
+    return;
+  }
+
+  SetSleepFunction(
+      [&system_timer](std::chrono::nanoseconds deadline)
+      {
+        if (deadline != std::chrono::nanoseconds::max())
+        {
+          system_timer.ScheduleWakeUp(deadline);
+        }
+        WaitForInterrupt();
+      });
+}
+
+/// Return Wait() and Delay() to busy looping.
+inline void DisableTicklessWait()
+{
+  SetSleepFunction(nullptr);
+}
+}  // namespace sjsu
@@ -1,16 +1,34 @@
 #pragma once
 
+#include <cerrno>
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
 #include <functional>
 #include <libcore/utility/build_info.hpp>
+#include <libcore/utility/critical_section.hpp>
+#include <libcore/utility/inplace_function.hpp>
 #include <libcore/utility/math/units.hpp>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <time.h>
+#endif
 
 namespace sjsu
 {
 /// Definition of an UptimeFunction
-using UptimeFunction = std::function<std::chrono::nanoseconds(void)>;
+using UptimeFunction = InplaceFunction<std::chrono::nanoseconds(void)>;
+
+/// Definition of a SleepFunction. It is called by Wait() with the uptime of
+/// the wait's deadline, std::chrono::nanoseconds::max() for no deadline, and
+/// should put the processor to sleep until the deadline or the next interrupt,
+/// whichever comes first.
+using SleepFunction = InplaceFunction<void(std::chrono::nanoseconds)>;
+
+/// Plain function pointer form of an uptime function. Called directly by
+/// Uptime(), without any type erasure.
+using UptimeFunctionPointer = std::chrono::nanoseconds (*)();
 
 /// A default uptime function that is used for testing or platforms without a
 /// means to keep time. It should not be used in production.
@@ -24,9 +42,65 @@ inline std::chrono::nanoseconds DefaultUptime()
   return default_uptime;
 }
 
-/// Global Uptime function, preset to DefaultUptime() for testing purposes.
-/// In general, this function is overwritten by
-inline UptimeFunction Uptime = DefaultUptime;  // NOLINT
+#if defined(__linux__)
+/// Uptime from the Linux CLOCK_MONOTONIC clock, which is read through the vDSO
+/// without a syscall. It is the same clock the kernel timestamps GPIO events
+/// with.
+///
+/// @return std::chrono::nanoseconds - time since the system booted.
+inline std::chrono::nanoseconds LinuxUptime()
+{
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return std::chrono::seconds(now.tv_sec) +
+         std::chrono::nanoseconds(now.tv_nsec);
+}
+#endif
+
+namespace detail
+{
+/// Uptime source used by Uptime() when set. Linux builds start with
+/// LinuxUptime(). Every other platform, including the host unit tests, starts
+/// with DefaultUptime(), which Linux programs can opt into with
+/// SetUptimeFunction(DefaultUptime).
+#if defined(__linux__)
+inline UptimeFunctionPointer uptime_pointer =
+    build::IsPlatform("linux") ? LinuxUptime : DefaultUptime;
+#else
+inline UptimeFunctionPointer uptime_pointer = DefaultUptime;
+#endif
+
+/// Fallback uptime source for callables that are not plain functions, used by
+/// Uptime() when uptime_pointer is nullptr.
+inline UptimeFunction uptime_function = nullptr;
+
+/// Called by Wait() between checks, when set.
+inline SleepFunction sleep_function = nullptr;
+}  // namespace detail
+
+/// Returns the system uptime.
+///
+/// Platforms with a counter that can be read inline can define
+/// SJ2_UPTIME_SOURCE as the name of an inline function returning
+/// std::chrono::nanoseconds, which is then called directly and
+/// SetUptimeFunction() has no effect. Otherwise the function set by
+/// SetUptimeFunction() is called, directly through a function pointer when it
+/// is a plain function, which is preset to DefaultUptime() for testing
+/// purposes.
+///
+/// @return std::chrono::nanoseconds - time since the system started.
+inline std::chrono::nanoseconds Uptime()
+{
+#if defined(SJ2_UPTIME_SOURCE)
+  return SJ2_UPTIME_SOURCE();
+#else
+  if (detail::uptime_pointer != nullptr) [[likely]]
+  {
+    return detail::uptime_pointer();
+  }
+  return detail::uptime_function();
+#endif
+}
 
 /// Global count of the time.
 inline std::chrono::nanoseconds global_time = 0ns;
@@ -34,56 +108,116 @@ inline std::chrono::nanoseconds global_time = 0ns;
 /// Returns the system uptime in nanoseconds, do not use this function directly
 ///
 /// @param uptime_function - new system wide uptime function to override the
-///        previous one.
-inline void SetUptimeFunction(UptimeFunction uptime_function)
+///        previous one. Plain functions and lambdas without captures are
+///        called through a function pointer, other callables through an
+///        UptimeFunction. nullptr restores DefaultUptime().
+template <typename Function>
+inline void SetUptimeFunction(Function && uptime_function)
 {
-  Uptime = uptime_function;
+  if constexpr (std::is_convertible_v<Function, UptimeFunctionPointer>)
+  {
+    UptimeFunctionPointer pointer = uptime_function;
+
+    detail::uptime_pointer  = (pointer != nullptr) ? pointer : DefaultUptime;
+    detail::uptime_function = nullptr;
+  }
+  else
+  {
+    detail::uptime_function = UptimeFunction(uptime_function);
+    detail::uptime_pointer  = nullptr;
+  }
 }
 
+/// Set the function that Wait() and Delay() use to sleep between checks,
+/// instead of busy looping. See EnableTicklessWait() in tickless.hpp.
+///
+/// @param sleep_function - function to sleep with, or nullptr to busy loop.
+inline void SetSleepFunction(SleepFunction sleep_function)
+{
+  detail::sleep_function = sleep_function;
+}
+
+namespace detail
+{
+/// Check `is_done` and, if it is not done and a sleep function is installed,
+/// sleep until `deadline`.
+///
+/// The last check and the sleep run with interrupts masked. Otherwise an
+/// interrupt that completes the wait between the check and the sleep would be
+/// missed, and the processor would sleep until the deadline or the next tick.
+/// Waiting for an interrupt still wakes on an interrupt that is pending while
+/// masked, which then runs once the mask is lifted.
+///
+/// @return true if `is_done` returned true.
+template <typename IsDone>
+inline bool CheckOrSleep(std::chrono::nanoseconds deadline, IsDone & is_done)
+{
+  if (!sleep_function)
+  {
+    return is_done();
+  }
+
+  CriticalSection lock;
+  if (is_done())
+  {
+    return true;
+  }
+  sleep_function(deadline);
+  return false;
+}
+}  // namespace detail
+
 /// Wait will until the is_done parameter returns true
 ///
+/// The predicate is called directly rather than through a std::function, so
+/// it can be inlined into the polling loop. The deadline is computed once, and
+/// a timeout of std::chrono::nanoseconds::max() polls without reading the
+/// uptime at all.
+///
 /// @param timeout the maximum amount of time to wait for the is_done to
 ///        return true.
 /// @param is_done will be run in a tight loop until it returns true or the
-///        timeout time has elapsed.
+///        timeout time has elapsed. If a sleep function has been set with
+///        SetSleepFunction(), the processor sleeps between each run until the
+///        timeout or an interrupt wakes it.
 /// @returns true when the is_done routine returned true before timeout time
 /// elapsed.
-inline bool Wait(std::chrono::nanoseconds timeout,
-                 std::function<bool()> is_done)
+template <typename IsDone>
+requires std::is_invocable_r_v<bool, IsDone &>
+inline bool Wait(std::chrono::nanoseconds timeout, IsDone && is_done)
 {
-  std::chrono::nanoseconds timeout_time;
-
   if (timeout == std::chrono::nanoseconds::max())
   {
-    // TODO(#983): This is a cheap hack to keep overflows from happening, but
-    // what if the system hsa been on for a long period of time and a new
-    // timeout overflows? This needs to be handled properly.
-    timeout_time = timeout;
+    while (!detail::CheckOrSleep(timeout, is_done))
+    {
+      continue;
+    }
+    return true;
   }
-  else if (timeout == 0ns)
+
+  if (timeout == 0ns)
   {
     return false;
   }
+
+  std::chrono::nanoseconds timeout_time;
+  if (detail::uptime_pointer == DefaultUptime)
+  {
+    // NOTE: The fake uptime counter increments by 1us with each call, which
+    // results in the uptime being 1us further along then it should be. To
+    // counter act the extra calls to Uptime() in this function, we
+    // substract 2us.
+    timeout_time = (Uptime() + timeout) - 2us;
+  }
   else
   {
-    if constexpr (build::IsPlatform("host"))
-    {
-      // NOTE: During host tests the default uptime counter will auto increment
-      // by 1, which will resulting in the default uptime being 1ns additional
-      // then it should. To counter act the calls to extra calls to Uptime() in
-      // this function, we substract 2ns.
-      timeout_time = (Uptime() + timeout) - 2us;
-    }
-    else
-    {
-      timeout_time = Uptime() + timeout;
-    }
+    timeout_time = Uptime() + timeout;
   }
 
   global_time = Uptime();
   while (global_time <= timeout_time)
   {
-    if (is_done())
+    if (detail::CheckOrSleep(timeout_time, is_done))
     {
       return true;
     }
@@ -93,6 +227,20 @@ inline bool Wait(std::chrono::nanoseconds timeout,
   return false;
 }
 
+/// Overload of `Wait` that takes a type erased predicate, kept for code that
+/// already holds a std::function. See Wait(std::chrono::nanoseconds, IsDone).
+///
+/// @param timeout the maximum amount of time to wait for the is_done to
+///        return true.
+/// @param is_done predicate to run until it returns true.
+/// @returns true when the is_done routine returned true before timeout time
+/// elapsed.
+inline bool Wait(std::chrono::nanoseconds timeout,
+                 std::function<bool()> is_done)
+{
+  return Wait<std::function<bool()> &>(timeout, is_done);
+}
+
 /// Overload of `Wait` that merely takes a timeout.
 ///
 /// @param timeout - the amount of time to wait.
@@ -102,46 +250,43 @@ inline bool Wait(std::chrono::nanoseconds timeout)
   return Wait(timeout, []() -> bool { return false; });
 }
 
-/// Declare an external linkage to the linux nanosleep() function. This is
-/// not needed for linux builds but is required to keep the ARM compiler from
-/// stating that the nanosleep() function does not exist, as it is "ifdef"
-/// out in the header file.
-///
-/// During the linking stage, since the constexpr if will fail, this path
-/// will be removed form the code, and thus no linking errors due to an
-/// undefined function call.
-extern int nanosleep(const timespec *, const timespec *);  // NOLINT
-
 /// Delay the system for a duration of time
+///
+/// On Linux builds the thread sleeps until the monotonic clock reaches the end
+/// of the delay, rather than busy looping in Wait(), which would drive the CPU
+/// utilization up to maximum. Sleeping until an absolute time means the delay
+/// does not grow when the sleep is interrupted by a signal. A sleep function
+/// installed with SetSleepFunction(), such as a running VirtualClock, or an
+/// uptime function other than LinuxUptime() takes precedence, and the delay
+/// goes through Wait() on the installed functions instead.
 inline void Delay(std::chrono::nanoseconds delay_time)
 {
-  // For Linux Systems since using Wait (which will busy loop) will drive the
-  // CPU utilization up to maximum.
-  if constexpr (build::IsPlatform("linux"))
+#if defined(__linux__)
+  if (build::IsPlatform("linux") && !detail::sleep_function &&
+      detail::uptime_pointer == LinuxUptime)
   {
-    // Needs to use the linux timespec structure to pass into nanosleep
-    timespec ts;
+    constexpr int64_t kNanosecondsPerSecond = 1'000'000'000;
 
-    // Error code return value to be checked if the sleep has finished.
-    int res;
+    timespec wake_up;
+    clock_gettime(CLOCK_MONOTONIC, &wake_up);
 
-    // Convert delay time to seconds to be stored into timespec structure.
-    // Using time mod 1000000000 to trim off the time greater than a second.
-    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(delay_time);
-    ts.tv_sec    = static_cast<decltype(ts.tv_sec)>(seconds.count());
-    ts.tv_nsec =
-        static_cast<decltype(ts.tv_nsec)>(delay_time.count() % 1000000000);
+    const int64_t kNanoseconds = wake_up.tv_nsec + delay_time.count();
+    wake_up.tv_sec += static_cast<decltype(wake_up.tv_sec)>(
+        kNanoseconds / kNanosecondsPerSecond);
+    wake_up.tv_nsec = static_cast<decltype(wake_up.tv_nsec)>(
+        kNanoseconds % kNanosecondsPerSecond);
 
-    do
+    while (clock_nanosleep(
+               CLOCK_MONOTONIC, TIMER_ABSTIME, &wake_up, nullptr) == EINTR)
     {
-      res = nanosleep(&ts, &ts);
-    } while (res);
-  }
-  else
-  {
-    // For all other systems use the Wait function to loop until time is up.
-    Wait(delay_time);
+      continue;
+    }
+    return;
   }
+#endif
+
+  // For all other systems use the Wait function to loop until time is up.
+  Wait(delay_time);
 }
 
 /// Halt system by putting it into infinite loop
@@ -40,6 +40,36 @@ TEST_CASE("Testing Time Utility")
     CHECK(uptime_was_set);
   }
 
+  SECTION("SetUptimeFunction() with a plain function")
+  {
+    // Setup
+    SetUptimeFunction([]() -> std::chrono::nanoseconds { return 42ms; });
+
+    // Exercise + Verify
+    CHECK(42ms == Uptime());
+
+    // Setup
+    SetUptimeFunction(DefaultUptime);
+    auto first_uptime = Uptime();
+
+    // Exercise + Verify
+    CHECK(first_uptime + 1us == Uptime());
+  }
+
+  SECTION("SetUptimeFunction(nullptr) restores DefaultUptime()")
+  {
+    // Setup
+    SetUptimeFunction([]() -> std::chrono::nanoseconds { return 42ms; });
+
+    // Exercise
+    SetUptimeFunction(nullptr);
+    auto first_uptime = Uptime();
+
+    // Verify
+    CHECK(bool{ detail::uptime_pointer == DefaultUptime });
+    CHECK(first_uptime + 1us == Uptime());
+  }
+
   SECTION("Delay()")
   {
     // Setup
@@ -96,6 +126,18 @@ TEST_CASE("Testing Time Utility")
     CHECK((current_timestamp + 4us + timeout_time) != final_uptime);
   }
 
+  SECTION("Wait() with a std::function")
+  {
+    // Setup
+    SetUptimeFunction(DefaultUptime);
+    int checks                        = 0;
+    std::function<bool()> is_complete = [&checks]() { return ++checks == 3; };
+
+    // Exercise + Verify
+    CHECK(Wait(500us, is_complete));
+    CHECK(3 == checks);
+  }
+
   SECTION("Wait() max time")
   {
     // Setup
@@ -122,10 +164,58 @@ TEST_CASE("Testing Time Utility")
       return false;
     }));
 
+    // Verify: waiting forever does not read the uptime.
+    CHECK(time_until_complete < callback_counter);
+    CHECK((current_timestamp + 1us) == Uptime());
+  }
+
+#if defined(__linux__)
+  SECTION("LinuxUptime() follows the monotonic clock")
+  {
+    // Setup
+    SetUptimeFunction(LinuxUptime);
+    auto start = Uptime();
+
+    // Exercise
+    bool result = Wait(1ms);
+    auto end    = Uptime();
+    SetUptimeFunction(DefaultUptime);
+
     // Verify
-    auto final_uptime = Uptime();
-    CHECK((current_timestamp + 3us + time_until_complete) == final_uptime);
-    CHECK((current_timestamp + 3us + timeout_time) != final_uptime);
+    CHECK(!result);
+    CHECK(start > 0ns);
+    CHECK(end - start >= 1ms);
+  }
+
+#endif
+  SECTION("Wait() sleeps between checks when a sleep function is set")
+  {
+    // Setup
+    SetUptimeFunction(DefaultUptime);
+    int checks = 0;
+    int sleeps = 0;
+    std::chrono::nanoseconds deadline(0);
+    SetSleepFunction(
+        [&sleeps, &deadline](std::chrono::nanoseconds wake_up)
+        {
+          sleeps++;
+          deadline = wake_up;
+        });
+    auto current_timestamp = Uptime();
+
+    // Exercise
+    bool result = Wait(100us,
+                       [&checks]()
+                       {
+                         checks++;
+                         return checks == 3;
+                       });
+    SetSleepFunction(nullptr);
+
+    // Verify
+    CHECK(result);
+    CHECK(2 == sleeps);
+    CHECK(current_timestamp + 100us - 1us == deadline);
   }
 }
 }  // namespace sjsu
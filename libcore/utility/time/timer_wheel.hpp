@@ -0,0 +1,381 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <libcore/utility/inplace_function.hpp>
+
+namespace sjsu
+{
+/// Hierarchical timer wheel, for keeping track of many timeouts, such as
+/// per-node heartbeats and retries, without scanning all of them every loop.
+///
+/// Tick() is called at a fixed period, usually from the SystemTimer's
+/// callback, and calls the callback of every timer that expires on that tick.
+/// Scheduling and cancelling a timer take constant time, and a tick takes time
+/// proportional to the number of timers that expire or move between levels.
+///
+/// Timers are kept in kLevels wheels of 64 slots. The first wheel holds timers
+/// expiring within 64 ticks, one slot per tick. Each following wheel covers 64
+/// times the range of the one before it, and its timers move down a level
+/// when their slot is reached. With 4 levels, timeouts up to 2^24 ticks are
+/// exact; longer timeouts are parked in the last level until they are close
+/// enough to be placed.
+///
+/// Timer storage is a fixed array of kCapacity entries, so nothing is
+/// allocated.
+///
+/// Not safe to use from multiple contexts at once. Schedule() and Cancel()
+/// may be called from the callbacks of timers, otherwise they must not be
+/// interrupted by Tick(), for example by disabling the system timer's
+/// interrupt around the call.
+///
+/// USAGE:
+///
+///    sjsu::TimerWheel<128> timers(1ms);
+///
+///    system_timer.settings.frequency = 1_kHz;
+///    system_timer.settings.callback  = [&timers]() { timers.Tick(); };
+///    system_timer.Initialize();
+///
+///    auto heartbeat = timers.Schedule(500ms, [&node]() { node.Lost(); });
+///    // On receiving the heartbeat:
+///    timers.Cancel(heartbeat);
+///
+/// @tparam kCapacity - maximum number of pending timers.
+/// @tparam kLevels - number of wheels.
+template <size_t kCapacity, size_t kLevels = 4>
+class TimerWheel
+{
+ public:
+  static_assert(kCapacity > 0 && kCapacity < UINT16_MAX,
+                "TimerWheel capacity must be between 1 and 65534.");
+  static_assert(kLevels > 0 && kLevels <= 10,
+                "TimerWheel must have between 1 and 10 levels.");
+
+  /// Function called when a timer expires.
+  using Callback = InplaceFunction<void(void)>;
+
+  /// Refers to a scheduled timer. A handle stays safe to use after its timer
+  /// has expired or been cancelled, even once its storage is reused.
+  struct Handle_t
+  {
+    /// Index of the timer's storage.
+    uint16_t index = kNone;
+    /// Count of how many times the storage has been used, to tell old
+    /// handles apart from new ones.
+    uint16_t generation = 0;
+
+    /// @return true - if the handle was returned by a successful Schedule().
+    constexpr bool IsValid() const
+    {
+      return index != kNone;
+    }
+  };
+
+  /// Number of bits of the tick count handled by each level.
+  static constexpr size_t kSlotBits = 6;
+  /// Number of slots in each level.
+  static constexpr size_t kSlots = 1 << kSlotBits;
+
+  /// @param tick_period - time between calls to Tick().
+  explicit TimerWheel(std::chrono::nanoseconds tick_period)
+      : tick_period_(tick_period)
+  {
+    heads_.fill(kNone);
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+      timers_[i].next = (i + 1 < kCapacity) ? static_cast<uint16_t>(i + 1)
+                                            : kNone;
+    }
+    free_ = 0;
+  }
+
+  TimerWheel(const TimerWheel &) = delete;
+  TimerWheel & operator=(const TimerWheel &) = delete;
+
+  /// Schedule `callback` to be called once after `delay`.
+  ///
+  /// @param delay - time until the timer expires, rounded up to a whole
+  ///        number of ticks and at least one tick.
+  /// @param callback - function to call from Tick() when the timer expires.
+  /// @return Handle_t - handle to the timer. Not valid if every timer is in
+  ///         use.
+  Handle_t Schedule(std::chrono::nanoseconds delay, Callback callback)
+  {
+    return Add(ToTicks(delay), 0, callback);
+  }
+
+  /// Schedule `callback` to be called every `period` until cancelled.
+  ///
+  /// @param period - time between calls, rounded up to a whole number of
+  ///        ticks and at least one tick.
+  /// @param callback - function to call from Tick() each period.
+  /// @return Handle_t - handle to the timer. Not valid if every timer is in
+  ///         use.
+  Handle_t SchedulePeriodic(std::chrono::nanoseconds period, Callback callback)
+  {
+    const uint64_t kTicks = ToTicks(period);
+    return Add(kTicks, kTicks, callback);
+  }
+
+  /// Stop a timer from expiring.
+  ///
+  /// @param handle - handle to the timer.
+  /// @return true - if the timer was pending and has been cancelled.
+  bool Cancel(Handle_t handle)
+  {
+    if (!IsPending(handle))
+    {
+      return false;
+    }
+    Release(handle.index);
+    return true;
+  }
+
+  /// @param handle - handle to a timer.
+  /// @return true - if the timer has yet to expire or is periodic and has not
+  ///         been cancelled.
+  bool IsPending(Handle_t handle) const
+  {
+    return handle.IsValid() && handle.index < kCapacity &&
+           timers_[handle.index].list != kNone &&
+           timers_[handle.index].generation == handle.generation;
+  }
+
+  /// Advance the wheel by one tick and call the callbacks of the timers that
+  /// expire on it.
+  void Tick()
+  {
+    now_++;
+
+    // Move the timers of every higher level slot that has been reached down
+    // to the levels below it, from the top down.
+    for (size_t level = kLevels - 1; level > 0; level--)
+    {
+      if ((now_ & ((uint64_t{ 1 } << (level * kSlotBits)) - 1)) == 0)
+      {
+        Cascade(ListOf(level, SlotOf(level, now_)));
+      }
+    }
+
+    // Move the expiring timers to their own list, so that callbacks can
+    // schedule and cancel any timer while the list is walked.
+    Splice(ListOf(0, SlotOf(0, now_)), kExpiring);
+
+    while (heads_[kExpiring] != kNone)
+    {
+      const uint16_t kIndex = heads_[kExpiring];
+      Timer_t & timer       = timers_[kIndex];
+      Unlink(kIndex);
+
+      if (timer.expires != now_)
+      {
+        // Parked beyond the range of the wheel, place it again.
+        Insert(kIndex);
+        continue;
+      }
+
+      // Call a copy of the callback, so that the callback can cancel its own
+      // timer, or schedule a new one into the same storage.
+      Callback callback = timer.callback;
+
+      if (timer.period != 0)
+      {
+        timer.expires += timer.period;
+        Insert(kIndex);
+      }
+      else
+      {
+        Release(kIndex);
+      }
+
+      callback();
+    }
+  }
+
+  /// @return uint64_t - number of ticks since the wheel was constructed.
+  uint64_t Now() const
+  {
+    return now_;
+  }
+
+  /// @return size_t - number of pending timers.
+  size_t Pending() const
+  {
+    return pending_;
+  }
+
+  /// @return constexpr size_t - maximum number of pending timers.
+  constexpr size_t Capacity() const
+  {
+    return kCapacity;
+  }
+
+ private:
+  static constexpr uint16_t kNone = UINT16_MAX;
+  /// List of the timers expiring on the current tick.
+  static constexpr size_t kExpiring = kLevels * kSlots;
+
+  struct Timer_t
+  {
+    Callback callback;
+    uint64_t expires    = 0;
+    uint64_t period     = 0;
+    uint16_t next       = kNone;
+    uint16_t previous   = kNone;
+    /// List the timer is in, kNone when it is free.
+    uint16_t list       = kNone;
+    uint16_t generation = 0;
+  };
+
+  static constexpr size_t SlotOf(size_t level, uint64_t tick)
+  {
+    return (tick >> (level * kSlotBits)) & (kSlots - 1);
+  }
+
+  static constexpr uint16_t ListOf(size_t level, size_t slot)
+  {
+    return static_cast<uint16_t>(level * kSlots + slot);
+  }
+
+  uint64_t ToTicks(std::chrono::nanoseconds delay) const
+  {
+    if (delay <= tick_period_ || tick_period_.count() <= 0)
+    {
+      return 1;
+    }
+    return (delay.count() + tick_period_.count() - 1) / tick_period_.count();
+  }
+
+  Handle_t Add(uint64_t ticks, uint64_t period, const Callback & callback)
+  {
+    if (free_ == kNone)
+    {
+      return Handle_t{};
+    }
+
+    const uint16_t kIndex = free_;
+    Timer_t & timer       = timers_[kIndex];
+    free_                 = timer.next;
+
+    timer.callback = callback;
+    timer.expires  = now_ + ticks;
+    timer.period   = period;
+    Insert(kIndex);
+    pending_++;
+
+    return Handle_t{ .index = kIndex, .generation = timer.generation };
+  }
+
+  void Release(uint16_t index)
+  {
+    Timer_t & timer = timers_[index];
+    Unlink(index);
+    timer.callback = nullptr;
+    timer.generation++;
+    timer.next = free_;
+    free_      = index;
+    pending_--;
+  }
+
+  /// Place a timer in the lowest level whose range covers its expiry.
+  void Insert(uint16_t index)
+  {
+    const uint64_t kExpires = timers_[index].expires;
+
+    for (size_t level = 0; level < kLevels; level++)
+    {
+      const size_t kShift = level * kSlotBits;
+      if ((kExpires >> kShift) - (now_ >> kShift) < kSlots)
+      {
+        Link(index, ListOf(level, SlotOf(level, kExpires)));
+        return;
+      }
+    }
+
+    // Beyond the range of the wheel. Park it in the last slot of the top
+    // level to be reached.
+    constexpr size_t kTop = kLevels - 1;
+    Link(index, ListOf(kTop, SlotOf(kTop, now_) == 0 ? kSlots - 1
+                                                     : SlotOf(kTop, now_) - 1));
+  }
+
+  void Cascade(uint16_t list)
+  {
+    uint16_t index = heads_[list];
+    heads_[list]   = kNone;
+
+    while (index != kNone)
+    {
+      const uint16_t kNext = timers_[index].next;
+      timers_[index].list  = kNone;
+      Insert(index);
+      index = kNext;
+    }
+  }
+
+  void Splice(uint16_t from, uint16_t to)
+  {
+    uint16_t index = heads_[from];
+    heads_[from]   = kNone;
+
+    while (index != kNone)
+    {
+      const uint16_t kNext = timers_[index].next;
+      timers_[index].list  = kNone;
+      Link(index, to);
+      index = kNext;
+    }
+  }
+
+  void Link(uint16_t index, uint16_t list)
+  {
+    Timer_t & timer = timers_[index];
+    timer.list      = list;
+    timer.previous  = kNone;
+    timer.next      = heads_[list];
+    if (timer.next != kNone)
+    {
+      timers_[timer.next].previous = index;
+    }
+    heads_[list] = index;
+  }
+
+  void Unlink(uint16_t index)
+  {
+    Timer_t & timer = timers_[index];
+    if (timer.list == kNone)
+    {
+      return;
+    }
+
+    if (timer.previous != kNone)
+    {
+      timers_[timer.previous].next = timer.next;
+    }
+    else
+    {
+      heads_[timer.list] = timer.next;
+    }
+
+    if (timer.next != kNone)
+    {
+      timers_[timer.next].previous = timer.previous;
+    }
+
+    timer.list     = kNone;
+    timer.next     = kNone;
+    timer.previous = kNone;
+  }
+
+  std::chrono::nanoseconds tick_period_;
+  std::array<Timer_t, kCapacity> timers_;
+  std::array<uint16_t, kLevels * kSlots + 1> heads_;
+  uint64_t now_    = 0;
+  size_t pending_  = 0;
+  uint16_t free_   = kNone;
+};
+}  // namespace sjsu
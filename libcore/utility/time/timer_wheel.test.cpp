@@ -0,0 +1,172 @@
+#include <libcore/utility/time/timer_wheel.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing TimerWheel")
+{
+  TimerWheel<8> test_subject(1ms);
+
+  SECTION("Timer expires on its tick")
+  {
+    // Setup
+    int calls   = 0;
+    auto handle = test_subject.Schedule(5ms, [&calls]() { calls++; });
+
+    // Exercise + Verify
+    REQUIRE(handle.IsValid());
+    CHECK(test_subject.IsPending(handle));
+    for (int i = 0; i < 4; i++)
+    {
+      test_subject.Tick();
+    }
+    CHECK(0 == calls);
+    test_subject.Tick();
+    CHECK(1 == calls);
+    CHECK(!test_subject.IsPending(handle));
+    CHECK(0 == test_subject.Pending());
+  }
+
+  SECTION("Delays are rounded up to whole ticks")
+  {
+    // Setup
+    int calls = 0;
+    test_subject.Schedule(1500us, [&calls]() { calls++; });
+    test_subject.Schedule(0ms, [&calls]() { calls++; });
+
+    // Exercise + Verify
+    test_subject.Tick();
+    CHECK(1 == calls);
+    test_subject.Tick();
+    CHECK(2 == calls);
+  }
+
+  SECTION("Long timeouts move down the levels and expire on time")
+  {
+    // Setup
+    const std::vector<uint64_t> kTicks = { 63, 64, 65, 4095, 4096, 70'000 };
+    std::vector<uint64_t> expired;
+    for (uint64_t ticks : kTicks)
+    {
+      test_subject.Schedule(
+          std::chrono::milliseconds(ticks),
+          [&expired, this_wheel = &test_subject]()
+          { expired.push_back(this_wheel->Now()); });
+    }
+
+    // Exercise
+    for (uint64_t i = 0; i < 70'000; i++)
+    {
+      test_subject.Tick();
+    }
+
+    // Verify
+    CHECK(kTicks == expired);
+  }
+
+  SECTION("Timeouts beyond the range of the wheel")
+  {
+    // Setup
+    TimerWheel<2, 1> small(1ms);
+    uint64_t expired_at = 0;
+    small.Schedule(200ms,
+                   [&expired_at, &small]() { expired_at = small.Now(); });
+
+    // Exercise
+    for (int i = 0; i < 300; i++)
+    {
+      small.Tick();
+    }
+
+    // Verify
+    CHECK(200 == expired_at);
+  }
+
+  SECTION("Cancel()")
+  {
+    // Setup
+    int calls   = 0;
+    auto handle = test_subject.Schedule(3ms, [&calls]() { calls++; });
+
+    // Exercise
+    bool cancelled       = test_subject.Cancel(handle);
+    bool cancelled_again = test_subject.Cancel(handle);
+    for (int i = 0; i < 5; i++)
+    {
+      test_subject.Tick();
+    }
+
+    // Verify
+    CHECK(cancelled);
+    CHECK(!cancelled_again);
+    CHECK(0 == calls);
+    CHECK(0 == test_subject.Pending());
+  }
+
+  SECTION("Stale handles do not cancel reused storage")
+  {
+    // Setup
+    int calls = 0;
+    auto old  = test_subject.Schedule(1ms, []() {});
+    test_subject.Tick();
+    auto fresh = test_subject.Schedule(1ms, [&calls]() { calls++; });
+
+    // Exercise
+    bool cancelled = test_subject.Cancel(old);
+    test_subject.Tick();
+
+    // Verify
+    CHECK(old.index == fresh.index);
+    CHECK(!cancelled);
+    CHECK(1 == calls);
+  }
+
+  SECTION("Periodic timers repeat until cancelled from their callback")
+  {
+    // Setup
+    int calls = 0;
+    TimerWheel<8>::Handle_t handle;
+    handle = test_subject.SchedulePeriodic(
+        2ms,
+        [&calls, &handle, this_wheel = &test_subject]()
+        {
+          calls++;
+          if (calls == 3)
+          {
+            this_wheel->Cancel(handle);
+          }
+        });
+
+    // Exercise
+    for (int i = 0; i < 20; i++)
+    {
+      test_subject.Tick();
+    }
+
+    // Verify
+    CHECK(3 == calls);
+    CHECK(0 == test_subject.Pending());
+  }
+
+  SECTION("Full wheel returns an invalid handle")
+  {
+    // Setup
+    for (size_t i = 0; i < test_subject.Capacity(); i++)
+    {
+      REQUIRE(test_subject.Schedule(10ms, []() {}).IsValid());
+    }
+
+    // Exercise
+    auto handle = test_subject.Schedule(10ms, []() {});
+
+    // Verify
+    CHECK(!handle.IsValid());
+    CHECK(!test_subject.IsPending(handle));
+    CHECK(8 == test_subject.Pending());
+  }
+}
+}  // namespace sjsu
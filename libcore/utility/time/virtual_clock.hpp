@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <utility>
+
+#include <libcore/utility/inplace_function.hpp>
+#include <libcore/utility/time/time.hpp>
+
+namespace sjsu
+{
+/// Deterministic simulated time, for simulations and tests that exercise
+/// timeouts.
+///
+/// While a VirtualClock is running, Uptime() returns its simulated time,
+/// which only moves when something waits. Wait() and Delay() jump straight to
+/// the next scheduled event or to their deadline, whichever comes first, so a
+/// simulated 10 minute delay returns immediately. Events scheduled with
+/// Schedule() are called in time order, on the simulated timeline, from
+/// within the Wait(), Delay() or Advance() that reaches them, which makes them
+/// the simulation's equivalent of interrupts.
+///
+/// A wait that times out ends 1ns after its deadline, the first instant at
+/// which Wait() considers it to have expired.
+///
+/// Only one VirtualClock can run at a time, and it is not safe to use from
+/// multiple threads.
+///
+/// USAGE:
+///
+///    sjsu::VirtualClock clock;
+///    clock.Start();
+///    clock.ScheduleAfter(250ms, [&response]() { response.ready = true; });
+///    // Returns true with Uptime() at 250ms, without waiting in real time.
+///    bool ok = sjsu::Wait(1s, [&response]() { return response.ready; });
+class VirtualClock
+{
+ public:
+  /// Function called when the simulated time reaches an event.
+  using Event = InplaceFunction<void(void)>;
+
+  /// @param start - simulated uptime to start at.
+  explicit VirtualClock(std::chrono::nanoseconds start = 0ns) : now_(start) {}
+
+  VirtualClock(const VirtualClock &) = delete;
+  VirtualClock & operator=(const VirtualClock &) = delete;
+
+  ~VirtualClock()
+  {
+    Stop();
+  }
+
+  /// Make Uptime(), Wait() and Delay() use this clock. The uptime and sleep
+  /// functions installed before Start() are restored by Stop().
+  void Start()
+  {
+    if (!running_)
+    {
+      previous_uptime_pointer_  = detail::uptime_pointer;
+      previous_uptime_function_ = detail::uptime_function;
+      previous_sleep_function_  = detail::sleep_function;
+    }
+    SetUptimeFunction([this]() { return now_; });
+    SetSleepFunction(
+        [this](std::chrono::nanoseconds deadline) { SleepUntil(deadline); });
+    running_ = true;
+  }
+
+  /// Return Uptime(), Wait() and Delay() to the functions installed before
+  /// Start().
+  void Stop()
+  {
+    if (running_)
+    {
+      detail::uptime_pointer  = previous_uptime_pointer_;
+      detail::uptime_function = previous_uptime_function_;
+      detail::sleep_function  = previous_sleep_function_;
+      running_                = false;
+    }
+  }
+
+  /// @return std::chrono::nanoseconds - the simulated uptime.
+  std::chrono::nanoseconds Now() const
+  {
+    return now_;
+  }
+
+  /// Call `event` when the simulated time reaches `time`. Events at the same
+  /// time are called in the order they were scheduled. Events may schedule
+  /// further events.
+  ///
+  /// @param time - simulated uptime of the event. Times in the past are
+  ///        called on the next wait.
+  /// @param event - function to call.
+  void Schedule(std::chrono::nanoseconds time, Event event)
+  {
+    events_.emplace(time, std::move(event));
+  }
+
+  /// Call `event` once `delay` of simulated time has passed.
+  ///
+  /// @param delay - time from now until the event.
+  /// @param event - function to call.
+  void ScheduleAfter(std::chrono::nanoseconds delay, Event event)
+  {
+    Schedule(now_ + delay, std::move(event));
+  }
+
+  /// @return size_t - number of events that have not been reached yet.
+  size_t PendingEvents() const
+  {
+    return events_.size();
+  }
+
+  /// Move the simulated time forward, calling every event reached on the way.
+  ///
+  /// @param duration - amount of time to move forward.
+  void Advance(std::chrono::nanoseconds duration)
+  {
+    const auto kEnd = now_ + duration;
+    while (!events_.empty() && events_.begin()->first <= kEnd)
+    {
+      RunNextEvent();
+    }
+    now_ = kEnd;
+  }
+
+ private:
+  /// The sleep function of Wait(). Wakes at the next event if it comes before
+  /// the deadline, as an interrupt would, otherwise just after the deadline.
+  void SleepUntil(std::chrono::nanoseconds deadline)
+  {
+    if (!events_.empty() && events_.begin()->first <= deadline)
+    {
+      RunNextEvent();
+    }
+    else if (deadline != std::chrono::nanoseconds::max())
+    {
+      now_ = std::max(now_, deadline + 1ns);
+    }
+  }
+
+  void RunNextEvent()
+  {
+    auto next = events_.extract(events_.begin());
+    now_      = std::max(now_, next.key());
+    next.mapped()();
+  }
+
+  std::chrono::nanoseconds now_;
+  bool running_ = false;
+  std::multimap<std::chrono::nanoseconds, Event> events_;
+  UptimeFunctionPointer previous_uptime_pointer_ = nullptr;
+  UptimeFunction previous_uptime_function_       = nullptr;
+  SleepFunction previous_sleep_function_         = nullptr;
+};
+}  // namespace sjsu
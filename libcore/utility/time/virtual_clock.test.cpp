@@ -0,0 +1,114 @@
+#include <libcore/testing/testing_frameworks.hpp>
+#include <libcore/utility/time/virtual_clock.hpp>
+
+#include <vector>
+
+namespace sjsu
+{
+TEST_CASE("Testing VirtualClock")
+{
+  // Setup
+  VirtualClock clock(1s);
+  clock.Start();
+
+  SECTION("Uptime() does not move on its own")
+  {
+    // Exercise + Verify
+    CHECK(1s == Uptime());
+    CHECK(1s == Uptime());
+  }
+
+  SECTION("Delay() jumps to its deadline")
+  {
+    // Exercise
+    Delay(10min);
+
+    // Verify
+    CHECK(1s + 10min + 1ns == Uptime());
+  }
+
+  SECTION("Wait() wakes at events and completes")
+  {
+    // Setup
+    bool ready = false;
+    clock.ScheduleAfter(250ms, [&ready]() { ready = true; });
+
+    // Exercise
+    bool result = Wait(1s, [&ready]() { return ready; });
+
+    // Verify
+    CHECK(result);
+    CHECK(1s + 250ms == Uptime());
+    CHECK(0 == clock.PendingEvents());
+  }
+
+  SECTION("Wait() times out before later events")
+  {
+    // Setup
+    clock.ScheduleAfter(2s, []() {});
+
+    // Exercise
+    bool result = Wait(1s, []() { return false; });
+
+    // Verify
+    CHECK(!result);
+    CHECK(2s + 1ns == Uptime());
+    CHECK(1 == clock.PendingEvents());
+  }
+
+  SECTION("Advance() calls events in time order")
+  {
+    // Setup
+    std::vector<int> order;
+    clock.Schedule(3s, [&order]() { order.push_back(3); });
+    clock.Schedule(2s, [&order, &clock]() {
+      order.push_back(2);
+      clock.ScheduleAfter(500ms, [&order]() { order.push_back(25); });
+    });
+    clock.Schedule(2s, [&order]() { order.push_back(22); });
+
+    // Exercise
+    clock.Advance(2s);
+
+    // Verify
+    CHECK(std::vector<int>{ 2, 22, 25, 3 } == order);
+    CHECK(3s == Uptime());
+  }
+
+  SECTION("Stop() restores the default uptime")
+  {
+    // Exercise
+    clock.Stop();
+    auto first = Uptime();
+
+    // Verify
+    CHECK(first + 1us == Uptime());
+  }
+
+  SECTION("Stop() restores the functions installed before Start()")
+  {
+    // Setup
+    clock.Stop();
+    int sleeps = 0;
+    SetUptimeFunction([]() { return 5s; });
+    SetSleepFunction([&sleeps](std::chrono::nanoseconds) { sleeps++; });
+    VirtualClock inner(1min);
+
+    // Exercise
+    inner.Start();
+    Delay(1s);
+    inner.Stop();
+
+    // Verify
+    CHECK(1min + 1s + 1ns == inner.Now());
+    CHECK(0 == sleeps);
+    CHECK(5s == Uptime());
+    Wait(std::chrono::nanoseconds::max(), [&sleeps]() { return sleeps > 0; });
+    CHECK(1 == sleeps);
+
+    // Cleanup
+    SetUptimeFunction(DefaultUptime);
+    SetSleepFunction(nullptr);
+  }
+}
+}  // namespace sjsu
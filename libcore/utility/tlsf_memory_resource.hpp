@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+namespace sjsu
+{
+/// General purpose polymorphic memory resource using the Two-Level Segregated
+/// Fit (TLSF) algorithm over a statically allocated buffer.
+///
+/// Unlike StaticMemoryResource, deallocated memory is reused and merged with
+/// neighbouring free memory. Both allocation and deallocation take constant
+/// time regardless of the number or size of the allocations, which makes it
+/// suitable for long running code using std::pmr containers of any kind.
+///
+/// Free blocks are kept in lists indexed by two levels: the first by the power
+/// of 2 of their size and the second by which of 16 equal subdivisions of that
+/// power of 2 their size falls in. Bitmaps of the non-empty lists let an
+/// allocation find a free block large enough with two count-trailing-zeros
+/// instructions.
+///
+/// Each allocation carries a header of two pointers. Requests with stricter
+/// alignment than kAlignment, or that cannot be met, throw std::bad_alloc.
+///
+/// USAGE:
+///
+///    StaticTlsfResource<4096> memory_resource;
+///    std::pmr::vector<int> sampled_data(&memory_resource);
+///
+/// @tparam kBufferSizeBytes - Number of bytes to statically allocate for the
+///         memory resource.
+template <size_t kBufferSizeBytes>
+class StaticTlsfResource : public std::pmr::memory_resource
+{
+ private:
+  struct Block
+  {
+    /// Block immediately before this one in the buffer, nullptr for the first.
+    Block * previous_physical;
+    /// Size of the block's payload, with kFreeFlag in the lowest bit.
+    size_t size_and_flag;
+    /// Free list links, only valid while the block is free. These overlap the
+    /// payload of allocated blocks.
+    Block * next_free;
+    Block * previous_free;
+  };
+
+ public:
+  /// Size of the header in front of every allocation.
+  static constexpr size_t kHeaderSize = offsetof(Block, next_free);
+
+  /// Alignment of every allocation.
+  static constexpr size_t kAlignment = kHeaderSize;
+
+  static_assert(kBufferSizeBytes >= 4 * kHeaderSize,
+                "Buffer is too small to hold any allocation.");
+
+  StaticTlsfResource()
+  {
+    // One free block covers the buffer, followed by a zero sized, allocated
+    // sentinel so that every real block has a next physical block.
+    const size_t kUsable = (kBufferSizeBytes / kAlignment) * kAlignment;
+
+    Block * first = new (buffer_.data()) Block{
+      .previous_physical = nullptr,
+      .size_and_flag     = kUsable - kHeaderSize - sizeof(Block),
+      .next_free         = nullptr,
+      .previous_free     = nullptr,
+    };
+    new (buffer_.data() + kUsable - sizeof(Block)) Block{
+      .previous_physical = first,
+      .size_and_flag     = 0,
+      .next_free         = nullptr,
+      .previous_free     = nullptr,
+    };
+
+    Insert(first);
+  }
+
+  StaticTlsfResource(const StaticTlsfResource &) = delete;
+  StaticTlsfResource & operator=(const StaticTlsfResource &) = delete;
+
+  /// @return size_t - the number of bytes in the buffer.
+  constexpr std::size_t Capacity() const
+  {
+    return kBufferSizeBytes;
+  }
+
+  /// @return size_t - number of bytes taken by allocations, including their
+  ///         headers and padding.
+  std::size_t MemoryUsed() const
+  {
+    return memory_used_;
+  }
+
+  /// @return int - Bytes that are not part of an allocation. Because of
+  ///         headers and fragmentation, the largest single allocation
+  ///         possible may be smaller.
+  int MemoryAvailable() const
+  {
+    return Capacity() - MemoryUsed();
+  }
+
+ protected:
+  /// Implemenation of the do_allocate() method for std::pmr::memory_resource
+  void * do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    if (alignment > kAlignment || bytes > kBufferSizeBytes)
+    {
+      throw std::bad_alloc();
+    }
+
+    const size_t kSize = std::max(RoundUp(bytes), kMinimumPayload);
+    Block * block      = FindFree(kSize);
+
+    if (block == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+
+    Remove(block);
+
+    // Split off the part of the block that is not needed, if it is large
+    // enough to be a block of its own.
+    if (Size(block) >= kSize + kHeaderSize + kMinimumPayload)
+    {
+      Block * remainder = new (Payload(block) + kSize) Block{
+        .previous_physical = block,
+        .size_and_flag     = Size(block) - kSize - kHeaderSize,
+        .next_free         = nullptr,
+        .previous_free     = nullptr,
+      };
+      NextPhysical(remainder)->previous_physical = remainder;
+      block->size_and_flag                       = kSize;
+      Insert(remainder);
+    }
+
+    memory_used_ += kHeaderSize + Size(block);
+    return Payload(block);
+  }
+
+  /// Implemenation of the do_deallocate() method for std::pmr::memory_resource
+  void do_deallocate(void * p, std::size_t, std::size_t) override
+  {
+    Block * block = reinterpret_cast<Block *>(static_cast<std::byte *>(p) -
+                                              kHeaderSize);
+    memory_used_ -= kHeaderSize + Size(block);
+
+    // Merge with the free neighbours on either side.
+    Block * next = NextPhysical(block);
+    if (IsFree(next))
+    {
+      Remove(next);
+      block->size_and_flag = Size(block) + kHeaderSize + Size(next);
+      NextPhysical(block)->previous_physical = block;
+    }
+
+    Block * previous = block->previous_physical;
+    if (previous != nullptr && IsFree(previous))
+    {
+      Remove(previous);
+      previous->size_and_flag = Size(previous) + kHeaderSize + Size(block);
+      NextPhysical(previous)->previous_physical = previous;
+      block                                     = previous;
+    }
+
+    Insert(block);
+  }
+
+  /// Implemenation of the do_is_equal() method for std::pmr::memory_resource
+  bool do_is_equal(
+      const std::pmr::memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+
+ private:
+  static constexpr size_t kFreeFlag       = 1;
+  static constexpr uint32_t kAllBits      = ~uint32_t{ 0 };
+  static constexpr size_t kMinimumPayload = sizeof(Block) - kHeaderSize;
+
+  /// The second level divides each power of 2 into 2^kSecondLevelBits lists.
+  static constexpr size_t kSecondLevelBits  = 4;
+  static constexpr size_t kSecondLevelCount = 1 << kSecondLevelBits;
+
+  /// Sizes below kSmallSize are all kept in the first, linearly divided,
+  /// first level list.
+  static constexpr size_t kSmallSize = kSecondLevelCount * kAlignment;
+  static constexpr size_t kFirstLevelShift = std::bit_width(kSmallSize) - 1;
+  static constexpr size_t kFirstLevelCount =
+      std::bit_width(kBufferSizeBytes) > kFirstLevelShift
+          ? std::bit_width(kBufferSizeBytes) - kFirstLevelShift + 1
+          : 1;
+
+  static_assert(kFirstLevelCount <= 32, "Buffer is too large.");
+
+  struct Index_t
+  {
+    size_t first;
+    size_t second;
+  };
+
+  static constexpr size_t RoundUp(size_t bytes)
+  {
+    return (bytes + kAlignment - 1) & ~(kAlignment - 1);
+  }
+
+  static constexpr Index_t Map(size_t size)
+  {
+    if (size < kSmallSize)
+    {
+      return { 0, size / kAlignment };
+    }
+
+    const size_t kLog2 = std::bit_width(size) - 1;
+    return {
+      kLog2 - kFirstLevelShift + 1,
+      (size >> (kLog2 - kSecondLevelBits)) ^ kSecondLevelCount,
+    };
+  }
+
+  static size_t Size(const Block * block)
+  {
+    return block->size_and_flag & ~kFreeFlag;
+  }
+
+  static bool IsFree(const Block * block)
+  {
+    return block->size_and_flag & kFreeFlag;
+  }
+
+  static std::byte * Payload(Block * block)
+  {
+    return reinterpret_cast<std::byte *>(block) + kHeaderSize;
+  }
+
+  static Block * NextPhysical(Block * block)
+  {
+    return reinterpret_cast<Block *>(Payload(block) + Size(block));
+  }
+
+  Block * FindFree(size_t size)
+  {
+    // Round up to the start of the next list, so that every block in the
+    // list found is large enough.
+    if (size >= kSmallSize)
+    {
+      size += (size_t{ 1 } << (std::bit_width(size) - 1 - kSecondLevelBits)) -
+              1;
+    }
+
+    auto [first, second] = Map(size);
+    if (first >= kFirstLevelCount)
+    {
+      return nullptr;
+    }
+
+    uint32_t second_map = second_level_map_[first] & (kAllBits << second);
+    if (second_map == 0)
+    {
+      const uint32_t kFirstMap =
+          (first + 1 < 32) ? first_level_map_ & (kAllBits << (first + 1)) : 0;
+      if (kFirstMap == 0)
+      {
+        return nullptr;
+      }
+      first      = std::countr_zero(kFirstMap);
+      second_map = second_level_map_[first];
+    }
+
+    return free_lists_[first][std::countr_zero(second_map)];
+  }
+
+  void Insert(Block * block)
+  {
+    auto [first, second] = Map(Size(block));
+    Block *& head        = free_lists_[first][second];
+
+    block->size_and_flag |= kFreeFlag;
+    block->previous_free = nullptr;
+    block->next_free     = head;
+    if (head != nullptr)
+    {
+      head->previous_free = block;
+    }
+    head = block;
+
+    first_level_map_ |= uint32_t{ 1 } << first;
+    second_level_map_[first] |= uint32_t{ 1 } << second;
+  }
+
+  void Remove(Block * block)
+  {
+    auto [first, second] = Map(Size(block));
+
+    if (block->previous_free != nullptr)
+    {
+      block->previous_free->next_free = block->next_free;
+    }
+    else
+    {
+      free_lists_[first][second] = block->next_free;
+    }
+
+    if (block->next_free != nullptr)
+    {
+      block->next_free->previous_free = block->previous_free;
+    }
+
+    if (free_lists_[first][second] == nullptr)
+    {
+      second_level_map_[first] &= ~(uint32_t{ 1 } << second);
+      if (second_level_map_[first] == 0)
+      {
+        first_level_map_ &= ~(uint32_t{ 1 } << first);
+      }
+    }
+
+    block->size_and_flag &= ~kFreeFlag;
+  }
+
+  alignas(kAlignment) std::array<std::byte, kBufferSizeBytes> buffer_;
+  std::array<std::array<Block *, kSecondLevelCount>, kFirstLevelCount>
+      free_lists_{};
+  std::array<uint32_t, kFirstLevelCount> second_level_map_{};
+  uint32_t first_level_map_ = 0;
+  size_t memory_used_       = 0;
+};
+}  // namespace sjsu
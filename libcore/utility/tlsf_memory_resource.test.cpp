@@ -0,0 +1,142 @@
+#include <libcore/utility/tlsf_memory_resource.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <vector>
+
+#include <libcore/testing/testing_frameworks.hpp>
+
+namespace sjsu
+{
+TEST_CASE("Testing StaticTlsfResource")
+{
+  StaticTlsfResource<2048> memory_resource;
+
+  SECTION("Initial metrics")
+  {
+    // Verify
+    CHECK(2048 == memory_resource.Capacity());
+    CHECK(0 == memory_resource.MemoryUsed());
+    CHECK(2048 == memory_resource.MemoryAvailable());
+  }
+
+  SECTION("Allocations are aligned and tracked")
+  {
+    // Exercise
+    void * block0 = memory_resource.allocate(1, 1);
+    void * block1 = memory_resource.allocate(100, 8);
+
+    // Verify
+    using Resource = StaticTlsfResource<2048>;
+    CHECK(block0 != block1);
+    CHECK(0 == reinterpret_cast<uintptr_t>(block0) % Resource::kAlignment);
+    CHECK(0 == reinterpret_cast<uintptr_t>(block1) % Resource::kAlignment);
+    CHECK(memory_resource.MemoryUsed() >= 101 + 2 * Resource::kHeaderSize);
+
+    memory_resource.deallocate(block1, 100, 8);
+    memory_resource.deallocate(block0, 1, 1);
+    CHECK(0 == memory_resource.MemoryUsed());
+  }
+
+  SECTION("Freed memory is merged and reused")
+  {
+    // Setup
+    void * block0 = memory_resource.allocate(512, 8);
+    void * block1 = memory_resource.allocate(512, 8);
+    void * block2 = memory_resource.allocate(512, 8);
+
+    // Exercise
+    // Freeing the neighbours in this order requires merging in both
+    // directions to make room for the large allocation.
+    memory_resource.deallocate(block0, 512, 8);
+    memory_resource.deallocate(block2, 512, 8);
+    memory_resource.deallocate(block1, 512, 8);
+    void * large = memory_resource.allocate(1800, 8);
+
+    // Verify
+    CHECK(block0 == large);
+  }
+
+  SECTION("Throws when the request cannot be met")
+  {
+    // Exercise & Verify
+    CHECK_THROWS_AS(static_cast<void>(memory_resource.allocate(4096, 8)),
+                    std::bad_alloc);
+    CHECK_THROWS_AS(static_cast<void>(memory_resource.allocate(8, 1024)),
+                    std::bad_alloc);
+  }
+
+  SECTION("Random allocations keep their contents and are all reclaimed")
+  {
+    // Setup
+    struct Allocation_t
+    {
+      uint8_t * data;
+      size_t size;
+    };
+    std::vector<Allocation_t> allocations;
+    std::mt19937 random(1234);
+
+    // Exercise
+    for (int i = 0; i < 2000; i++)
+    {
+      if (allocations.empty() || random() % 3 != 0)
+      {
+        const size_t kSize = 1 + random() % 200;
+        try
+        {
+          auto * data = static_cast<uint8_t *>(
+              memory_resource.allocate(kSize, alignof(uint32_t)));
+          std::fill_n(data, kSize, static_cast<uint8_t>(kSize));
+          allocations.push_back({ data, kSize });
+        }
+        catch (const std::bad_alloc &)
+        {
+          continue;
+        }
+      }
+      else
+      {
+        const size_t kIndex = random() % allocations.size();
+        auto allocation     = allocations[kIndex];
+        CHECK(std::all_of(allocation.data,
+                          allocation.data + allocation.size,
+                          [&allocation](uint8_t value)
+                          { return value == uint8_t(allocation.size); }));
+        memory_resource.deallocate(allocation.data, allocation.size, 4);
+        allocations.erase(allocations.begin() + kIndex);
+      }
+    }
+
+    for (auto allocation : allocations)
+    {
+      memory_resource.deallocate(allocation.data, allocation.size, 4);
+    }
+
+    // Verify
+    CHECK(0 == memory_resource.MemoryUsed());
+    // Everything has been merged back into one block.
+    CHECK_NOTHROW(memory_resource.deallocate(
+        memory_resource.allocate(1800, 8), 1800, 8));
+  }
+
+  SECTION("Works with std::pmr containers")
+  {
+    // Setup
+    std::pmr::vector<int> values(&memory_resource);
+
+    // Exercise
+    for (int i = 0; i < 100; i++)
+    {
+      values.push_back(i);
+    }
+
+    // Verify
+    CHECK(100 == values.size());
+    CHECK(99 == values.back());
+  }
+}
+}  // namespace sjsu
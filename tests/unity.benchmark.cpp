@@ -0,0 +1,18 @@
+#include <libcore/testing/benchmark.hpp>
+
+#include <libcore/peripherals/can.benchmark.cpp>                           // NOLINT
+#include <libcore/peripherals/gpio_interrupt_table.benchmark.cpp>          // NOLINT
+#include <libcore/systems/graphical_terminal.benchmark.cpp>                // NOLINT
+#include <libcore/systems/graphics.benchmark.cpp>                          // NOLINT
+#include <libcore/systems/sensor_fusion.benchmark.cpp>                     // NOLINT
+#include <libcore/utility/math/bit.benchmark.cpp>                          // NOLINT
+#include <libcore/utility/math/byte.benchmark.cpp>                         // NOLINT
+#include <libcore/utility/math/crc.benchmark.cpp>                          // NOLINT
+#include <libcore/utility/math/dsp.benchmark.cpp>                          // NOLINT
+#include <libcore/utility/math/fft.benchmark.cpp>                          // NOLINT
+
+int main()
+{
+  sjsu::benchmark::RunAll();
+  return 0;
+}
@@ -1,28 +1,118 @@
-#include <libcore/devices/memory_access_protocol.test.cpp>  // NOLINT
-#include <libcore/devices/parallel_bus.test.cpp>            // NOLINT
-#include <libcore/devices/servo.test.cpp>                   // NOLINT
-#include <libcore/peripherals/adc.test.cpp>                 // NOLINT
-#include <libcore/peripherals/can.test.cpp>                 // NOLINT
-#include <libcore/peripherals/gpio.test.cpp>                // NOLINT
-#include <libcore/peripherals/hardware_counter.test.cpp>    // NOLINT
-#include <libcore/peripherals/i2c.test.cpp>                 // NOLINT
-#include <libcore/peripherals/interrupt.test.cpp>           // NOLINT
-#include <libcore/peripherals/pwm.test.cpp>                 // NOLINT
-#include <libcore/peripherals/uart.test.cpp>                // NOLINT
-#include <libcore/systems/graphical_terminal.test.cpp>      // NOLINT
-#include <libcore/systems/graphics.test.cpp>                // NOLINT
-#include <libcore/utility/build_info.test.cpp>              // NOLINT
-#include <libcore/utility/constexpr.test.cpp>               // NOLINT
-#include <libcore/utility/enum.test.cpp>                    // NOLINT
-#include <libcore/utility/error_handling.test.cpp>          // NOLINT
-#include <libcore/utility/infrared_algorithms.test.cpp>     // NOLINT
-#include <libcore/utility/math/average.test.cpp>            // NOLINT
-#include <libcore/utility/math/bit.test.cpp>                // NOLINT
-#include <libcore/utility/math/byte.test.cpp>               // NOLINT
-#include <libcore/utility/math/crc.test.cpp>                // NOLINT
-#include <libcore/utility/math/limits.test.cpp>             // NOLINT
-#include <libcore/utility/math/map.test.cpp>                // NOLINT
-#include <libcore/utility/memory_resource.test.cpp>         // NOLINT
-#include <libcore/utility/time/stopwatch.test.cpp>          // NOLINT
-#include <libcore/utility/time/time.test.cpp>               // NOLINT
-#include <libcore/utility/time/timeout_timer.test.cpp>      // NOLINT
\ No newline at end of file
+#include <libcore/devices/accelerometer.test.cpp>                          // NOLINT
+#include <libcore/devices/at_socket_multiplexer.test.cpp>                  // NOLINT
+#include <libcore/devices/block_cache.test.cpp>                            // NOLINT
+#include <libcore/devices/capture_frequency_counter.test.cpp>              // NOLINT
+#include <libcore/devices/debounced_inputs.test.cpp>                       // NOLINT
+#include <libcore/devices/distance_sensor.test.cpp>                        // NOLINT
+#include <libcore/devices/double_buffered_display.test.cpp>                // NOLINT
+#include <libcore/devices/energy_profiler.test.cpp>                        // NOLINT
+#include <libcore/devices/framebuffer_display.test.cpp>                    // NOLINT
+#include <libcore/devices/internet_socket.test.cpp>                        // NOLINT
+#include <libcore/devices/memory_access_protocol.test.cpp>                 // NOLINT
+#include <libcore/devices/parallel_bus.test.cpp>                           // NOLINT
+#include <libcore/devices/port_parallel_bus.test.cpp>                      // NOLINT
+#include <libcore/devices/register_map.test.cpp>                           // NOLINT
+#include <libcore/devices/sd_card.test.cpp>                                // NOLINT
+#include <libcore/devices/servo.test.cpp>                                  // NOLINT
+#include <libcore/devices/socket_pool.test.cpp>                            // NOLINT
+#include <libcore/module.test.cpp>                                         // NOLINT
+#include <libcore/peripherals/adc.test.cpp>                                // NOLINT
+#include <libcore/peripherals/bit_bang_i2c.test.cpp>                       // NOLINT
+#include <libcore/peripherals/bit_bang_spi.test.cpp>                       // NOLINT
+#include <libcore/peripherals/can.test.cpp>                                // NOLINT
+#include <libcore/peripherals/dac.test.cpp>                                // NOLINT
+#include <libcore/peripherals/dma.test.cpp>                                // NOLINT
+#include <libcore/peripherals/gpio.test.cpp>                               // NOLINT
+#include <libcore/peripherals/gpio_interrupt_table.test.cpp>               // NOLINT
+#include <libcore/peripherals/gpio_port.test.cpp>                          // NOLINT
+#include <libcore/peripherals/hardware_counter.test.cpp>                   // NOLINT
+#include <libcore/peripherals/i2c.test.cpp>                                // NOLINT
+#include <libcore/peripherals/i2c_bus.test.cpp>                            // NOLINT
+#include <libcore/peripherals/instrumented_interrupt_controller.test.cpp>  // NOLINT
+#include <libcore/peripherals/interface_concepts.test.cpp>                 // NOLINT
+#include <libcore/peripherals/interrupt.test.cpp>                          // NOLINT
+#include <libcore/peripherals/pulse_capture.test.cpp>                      // NOLINT
+#include <libcore/peripherals/pwm.test.cpp>                                // NOLINT
+#include <libcore/peripherals/quad_spi.test.cpp>                           // NOLINT
+#include <libcore/peripherals/quadrature_encoder.test.cpp>                 // NOLINT
+#include <libcore/peripherals/spi.test.cpp>                                // NOLINT
+#include <libcore/peripherals/spi_bus.test.cpp>                            // NOLINT
+#include <libcore/peripherals/storage.test.cpp>                            // NOLINT
+#include <libcore/peripherals/uart.test.cpp>                               // NOLINT
+#include <libcore/platform/debug_output.test.cpp>                          // NOLINT
+#include <libcore/platform/host/can.test.cpp>                              // NOLINT
+#include <libcore/platform/host/errno.test.cpp>                            // NOLINT
+#include <libcore/platform/host/gpio.test.cpp>                             // NOLINT
+#include <libcore/platform/host/i2c.test.cpp>                              // NOLINT
+#include <libcore/platform/host/spi.test.cpp>                              // NOLINT
+#include <libcore/platform/host/uart.test.cpp>                             // NOLINT
+#include <libcore/systems/ansi_screen.test.cpp>                            // NOLINT
+#include <libcore/systems/boot_sequence.test.cpp>                          // NOLINT
+#include <libcore/systems/can_bus_monitor.test.cpp>                        // NOLINT
+#include <libcore/systems/can_signals.test.cpp>                            // NOLINT
+#include <libcore/systems/can_transmit_queue.test.cpp>                     // NOLINT
+#include <libcore/systems/clock_scaler.test.cpp>                           // NOLINT
+#include <libcore/systems/font.test.cpp>                                   // NOLINT
+#include <libcore/systems/framed_uart.test.cpp>                            // NOLINT
+#include <libcore/systems/graphical_terminal.test.cpp>                     // NOLINT
+#include <libcore/systems/graphics.test.cpp>                               // NOLINT
+#include <libcore/systems/iso_tp.test.cpp>                                 // NOLINT
+#include <libcore/systems/key_value_store.test.cpp>                        // NOLINT
+#include <libcore/systems/metrics.test.cpp>                                // NOLINT
+#include <libcore/systems/mqtt_client.test.cpp>                            // NOLINT
+#include <libcore/systems/periodic_executor.test.cpp>                      // NOLINT
+#include <libcore/systems/power_manager.test.cpp>                          // NOLINT
+#include <libcore/systems/record_store.test.cpp>                           // NOLINT
+#include <libcore/systems/rle_image.test.cpp>                              // NOLINT
+#include <libcore/systems/sensor_fusion.test.cpp>                          // NOLINT
+#include <libcore/systems/sensor_scheduler.test.cpp>                       // NOLINT
+#include <libcore/systems/tile_layer.test.cpp>                             // NOLINT
+#include <libcore/systems/watchdog_supervisor.test.cpp>                    // NOLINT
+#include <libcore/testing/bus_recorder.test.cpp>                           // NOLINT
+#include <libcore/testing/ram_storage.test.cpp>                            // NOLINT
+#include <libcore/testing/simulated_peripherals.test.cpp>                  // NOLINT
+#include <libcore/utility/binary_log.test.cpp>                             // NOLINT
+#include <libcore/utility/buffered_writer.test.cpp>                        // NOLINT
+#include <libcore/utility/build_info.test.cpp>                             // NOLINT
+#include <libcore/utility/compression.test.cpp>                            // NOLINT
+#include <libcore/utility/constexpr.test.cpp>                              // NOLINT
+#include <libcore/utility/coroutine.test.cpp>                              // NOLINT
+#include <libcore/utility/debug.test.cpp>                                  // NOLINT
+#include <libcore/utility/dma_buffer.test.cpp>                             // NOLINT
+#include <libcore/utility/enum.test.cpp>                                   // NOLINT
+#include <libcore/utility/error_handling.test.cpp>                         // NOLINT
+#include <libcore/utility/error_ring.test.cpp>                             // NOLINT
+#include <libcore/utility/event_queue.test.cpp>                            // NOLINT
+#include <libcore/utility/event_trace.test.cpp>                            // NOLINT
+#include <libcore/utility/infrared_algorithms.test.cpp>                    // NOLINT
+#include <libcore/utility/inplace_function.test.cpp>                       // NOLINT
+#include <libcore/utility/log.test.cpp>                                    // NOLINT
+#include <libcore/utility/log_module.test.cpp>                             // NOLINT
+#include <libcore/utility/log_rate_limit.test.cpp>                         // NOLINT
+#include <libcore/utility/log_ring.test.cpp>                               // NOLINT
+#include <libcore/utility/math/average.test.cpp>                           // NOLINT
+#include <libcore/utility/math/bit.test.cpp>                               // NOLINT
+#include <libcore/utility/math/byte.test.cpp>                              // NOLINT
+#include <libcore/utility/math/crc.test.cpp>                               // NOLINT
+#include <libcore/utility/math/dsp.test.cpp>                               // NOLINT
+#include <libcore/utility/math/fft.test.cpp>                               // NOLINT
+#include <libcore/utility/math/limits.test.cpp>                            // NOLINT
+#include <libcore/utility/math/map.test.cpp>                               // NOLINT
+#include <libcore/utility/math/masked_register.test.cpp>                   // NOLINT
+#include <libcore/utility/math/units.test.cpp>                             // NOLINT
+#include <libcore/utility/memory_pool.test.cpp>                            // NOLINT
+#include <libcore/utility/memory_resource.test.cpp>                        // NOLINT
+#include <libcore/utility/multicore.test.cpp>                              // NOLINT
+#include <libcore/utility/profile.test.cpp>                                // NOLINT
+#include <libcore/utility/result.test.cpp>                                 // NOLINT
+#include <libcore/utility/ring_buffer.test.cpp>                            // NOLINT
+#include <libcore/utility/seqlock.test.cpp>                                // NOLINT
+#include <libcore/utility/serialization.test.cpp>                          // NOLINT
+#include <libcore/utility/stack_usage.test.cpp>                            // NOLINT
+#include <libcore/utility/time/cycle_counter.test.cpp>                     // NOLINT
+#include <libcore/utility/time/stopwatch.test.cpp>                         // NOLINT
+#include <libcore/utility/time/time.test.cpp>                              // NOLINT
+#include <libcore/utility/time/timeout_timer.test.cpp>                     // NOLINT
+#include <libcore/utility/time/timer_wheel.test.cpp>                       // NOLINT
+#include <libcore/utility/time/virtual_clock.test.cpp>                     // NOLINT
+#include <libcore/utility/tlsf_memory_resource.test.cpp>                   // NOLINT
\ No newline at end of file